@@ -17,6 +17,11 @@ struct ExchangeCredentials {
     std::string ws_trade_endpoint;
     std::string rest_endpoint;
     bool enabled{true};
+    bool redundant_feed{false};         // Subscribe public stream on two lines (A/B) and arbitrate
+    int ws_rotate_minutes{0};           // Planned make-before-break public stream rotation (0 = off)
+    bool ws_deflate{false};             // Offer permessage-deflate on the public stream
+    bool ws_deflate_context_takeover{true};
+    int ws_deflate_window_bits{15};     // 9..15
 };
 
 // Runtime configuration (loaded from YAML)
@@ -40,6 +45,12 @@ struct RuntimeConfig {
     int strategy_threads{1};
     int order_exec_threads{2};
     bool use_cpu_affinity{false};
+    // Busy-poll reactor for io threads on isolated cores (threading.busy_poll)
+    bool io_busy_poll{false};
+    int io_spin_idle_us{200};          // Pure spin after the last event
+    int io_max_idle_sleep_us{0};       // Backoff ceiling past the spin (0 = yield only)
+    int socket_busy_poll_us{0};        // SO_BUSY_POLL on market-data sockets (0 = off)
+    int socket_rcvbuf_bytes{0};        // SO_RCVBUF on market-data sockets (0 = kernel default)
 
     // Logging
     std::string log_level{"info"};
@@ -50,8 +61,56 @@ struct RuntimeConfig {
     // Performance options
     bool use_io_uring{false};
     bool preallocate_buffers{true};
+    bool ktls_offload{false};          // Kernel TLS record crypto on venue connections (performance.ktls)
     int buffer_pool_size{256};
     int ring_buffer_size{4096};
+
+    // Composite USDT/KRW rate (fx section)
+    double fx_epsilon_bps{0.5};        // Republish (and reprice everything) past this move
+    double fx_max_deviation_bps{80.0}; // Venue quotes this far from the rolling median are dropped
+    int fx_stale_ms{5000};             // Venue leaves the composite after this long without a quote
+    int fx_reseed_after{5};            // Consecutive rejections that accept a new level
+
+    // Korean leg split across Bithumb and Upbit (routing section)
+    bool korean_split_routing{false};
+    int routing_max_book_age_ms{1000};      // Older depth falls back to the signal's venue alone
+    double routing_min_gain_krw{0.0};       // Split only when it saves more than this per chunk
+    double routing_max_price_gap_bps{5.0};  // Other venue's asks within this count as entry depth
+
+    // IOC limit legs instead of market orders (execution.price_protection section)
+    bool price_protection{false};
+    double price_protection_band_bps{15.0};  // Limit = signal quote -/+ this
+    int price_protection_reprice_attempts{2};  // Korean IOC remainder retried at the latest quote
+    // Post-only Korean bid with hedge-on-fill (execution.maker_entry section)
+    bool maker_entry{false};
+    double maker_edge_buffer_pct{0.02};   // Net edge kept above the gate at the resting price
+    double maker_reprice_bps{3.0};        // Re-quote on this much drift of the target bid
+    int maker_max_rest_ms{3000};          // Resting bid cancelled after this
+    double maker_min_hedge_usdt{5.0};     // Fill increments hedged once they reach this
+    // Submit timeout and client order id retries (execution.order_submit section)
+    int order_submit_timeout_ms{10000};   // Unanswered past this: resolved by client id lookup
+    int order_submit_attempts{3};         // Submits sharing one client order id
+    int order_submit_lookup_delay_ms{50}; // Venue lag before the lookup
+
+    // Spot-margin borrow interest on the foreign short (borrow section)
+    bool borrow_cost{true};
+    int borrow_refresh_sec{600};              // Venue borrow rates re-fetched this often
+    double borrow_expected_hold_hours{24.0};  // Holding time charged on the entry edge
+
+    // In-memory event rings dumped on SIGUSR1 / crash / hedge mismatch (flight_recorder section)
+    bool flight_recorder{true};
+    int flight_window_sec{30};                // Dumps keep events this recent
+    int flight_events_per_thread{32768};      // Ring slots per thread (64 bytes each)
+
+    // New listings added while running (listing section)
+    bool listing_watch{true};
+    int listing_poll_sec{15};                 // Venue market lists re-fetched this often
+
+    // Extra trading accounts per venue, the exchanges section's keys being account 0 (accounts section)
+    std::unordered_map<Exchange, std::vector<ExchangeCredentials>> extra_accounts;
+    double account_order_rate_per_sec{10.0};  // Order budget per account (the venue's per-key limit)
+    double account_order_burst{20.0};
+    int account_balance_refresh_sec{30};      // Account balances re-fetched this often
 };
 
 // Configuration loader
@@ -91,6 +150,7 @@ constexpr const char* OKX_REST = "https://www.okx.com";
 
 // Upbit
 constexpr const char* UPBIT_WS = "wss://api.upbit.com/websocket/v1";
+constexpr const char* UPBIT_WS_PRIVATE = "wss://api.upbit.com/websocket/v1/private";
 constexpr const char* UPBIT_REST = "https://api.upbit.com";
 
 } // namespace endpoints
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "kimp/core/optimization.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kimp::opt {
+
+struct CpuInfo {
+    int cpu{-1};
+    int package{0};
+    int core{-1};            // Physical core: lowest CPU among its SMT siblings
+    int l3{-1};              // L3 domain: lowest CPU sharing its L3 (-1 unknown)
+    bool isolated{false};    // isolcpus
+    bool nohz_full{false};
+    bool nic_irq{false};     // Takes NIC interrupts per /proc/interrupts
+};
+
+/**
+ * Online CPUs of this host as sysfs and /proc/interrupts describe them
+ *
+ * Reads <cpu_root>/online, isolated, nohz_full and per CPU
+ * topology/{physical_package_id,thread_siblings_list} and the level 3
+ * cache/index<N>/shared_cpu_list. A CPU is marked nic_irq when it took at
+ * least 5% of a NIC queue interrupt (eth*, ens*, enp*, mlx*, virtio
+ * input/output, ...). Missing files leave the matching fields at their
+ * defaults; an unreadable online list gives an empty topology.
+ */
+struct CpuTopology {
+    std::vector<CpuInfo> cpus;  // Ascending CPU number
+
+    bool empty() const noexcept { return cpus.empty(); }
+    std::size_t physical_cores() const;
+    std::size_t l3_domains() const;
+
+    static CpuTopology discover(const std::string& cpu_root = "/sys/devices/system/cpu",
+                                const std::string& interrupts_path = "/proc/interrupts");
+};
+
+// "0-3,8,10-11" -> {0,1,2,3,8,10,11}; anything unparsable gives an empty list
+std::vector<int> parse_cpu_list(std::string_view text);
+std::string format_cpu_list(std::vector<int> cpus);
+
+struct ThreadPlan {
+    ThreadConfig config;
+    std::string topology;            // One-line host summary
+    std::vector<std::string> notes;  // Compromises the planner had to make
+
+    std::string describe() const;    // Multi-line, for the startup log
+};
+
+/**
+ * Places the bot's threads on the host topology
+ *
+ * - io (Bithumb, Bybit), strategy and execution get distinct physical
+ *   cores, never two SMT siblings, all in one L3 domain when it is big
+ *   enough; isolated / nohz_full cores first, NIC IRQ cores and CPU 0 last
+ * - execution workers spread over the execution core and the free cores
+ *   left in that L3 domain
+ * - logger and exporter take non-isolated cores, outside the hot L3 domain
+ *   when possible; they share one core, then go unpinned, when short
+ *
+ * Fewer than 4 physical cores leaves every thread to the scheduler; an
+ * empty topology gives ThreadConfig::fallback().
+ */
+ThreadPlan plan_threads(const CpuTopology& topology);
+
+// Plan for this host, discovered once; ThreadConfig::optimal() returns its config
+const ThreadPlan& host_thread_plan();
+
+} // namespace kimp::opt
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+namespace kimp {
+
+enum class FlightEventType : uint8_t {
+    Quote = 1,      // v0 bid, v1 ask, v2 bid qty, v3 ask qty
+    EntryDecision,  // id trace; v0 premium, v1 net edge %, v2 Korean ask, v3 foreign bid
+    ExitDecision,   // id trace; v0 premium, v1 exit threshold, v2 Korean bid, v3 foreign ask
+    LegSubmit,      // v0 quantity, v1 limit (0 = market), v2 KRW amount
+    LegAck,         // id client order id; v0 quantity, v1 price, v2 submit -> ack us; flags status
+    LegFill,        // id client order id; v0 filled, v1 average price; flags status
+};
+
+const char* flight_event_type_name(FlightEventType type) noexcept;
+
+/**
+ * One 64-byte flight recorder slot
+ *
+ * ticks is the raw cycle counter (TSC / CNTVCT) or steady clock ns where
+ * neither exists; the dump header carries the anchors converting it to
+ * wall time. exchange / counter_exchange are Exchange values.
+ */
+struct FlightEvent {
+    uint64_t ticks{0};
+    uint64_t id{0};
+    double v[4]{};
+    FlightEventType type{FlightEventType::Quote};
+    uint8_t exchange{0};
+    uint8_t counter_exchange{0};
+    uint8_t side{0};   // Side for legs
+    uint8_t flags{0};  // OrderStatus for acks and fills
+    std::array<char, 11> symbol{};  // SymbolId base (at most 11 chars)
+};
+static_assert(sizeof(FlightEvent) == 64, "flight events are one cache line");
+
+inline constexpr std::array<char, 8> FLIGHT_DUMP_MAGIC{'K', 'F', 'L', 'T', 'R', 'E', 'C', '1'};
+
+struct FlightRecorderOptions {
+    bool enabled{true};
+    std::string dir{"trade_logs/flight"};
+    uint32_t window_sec{30};                  // Events older than this at dump time are left out
+    std::size_t events_per_thread{1U << 15};  // Rounded up to a power of two
+};
+
+/**
+ * Always-on in-memory flight recorder
+ *
+ * Features:
+ * - One single-writer ring per recording thread, claimed on its first
+ *   event: record() is a counter read, a 64-byte store and a release
+ *   store of the ring head, with no locks or shared cache lines
+ * - dump() is async-signal-safe (open/write/close into a preallocated
+ *   path), so it runs from SIGUSR1, from fatal signal handlers and from
+ *   OrderManager when a hedge mismatch stops trading
+ * - Each ring is dumped with its head before and after the copy so the
+ *   reader can drop slots overwritten while the dump ran
+ * - Each ring carries an alternate signal stack for its thread, so a stack
+ *   overflow on any recording thread still dumps
+ *
+ * Rings of exited threads go back to a free list and keep their events
+ * until a new thread claims them; from then on the ring dumps only the new
+ * owner's events, under its tid and name.
+ */
+class FlightRecorder {
+public:
+    static constexpr std::size_t MAX_THREADS = 64;
+
+    // Allocates nothing; rings are sized here and created per thread on first use
+    static void configure(const FlightRecorderOptions& options);
+    static void set_enabled(bool enabled) noexcept {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+    [[nodiscard]] static bool enabled() noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static uint64_t now_ticks() noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return steady_ticks();
+#endif
+    }
+
+    static void record(FlightEventType type, Exchange ex, const SymbolId& symbol, uint64_t id,
+                       double v0 = 0.0, double v1 = 0.0, double v2 = 0.0, double v3 = 0.0,
+                       uint8_t side = 0, uint8_t flags = 0,
+                       Exchange counter = Exchange::Count) noexcept {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        Ring* ring = tls_ring_;
+        if (ring == nullptr && (ring = claim_ring()) == nullptr) {
+            return;
+        }
+        const uint64_t seq = ring->head.load(std::memory_order_relaxed);
+        FlightEvent& e = ring->events[seq & ring->mask];
+        e.ticks = now_ticks();
+        e.id = id;
+        e.v[0] = v0;
+        e.v[1] = v1;
+        e.v[2] = v2;
+        e.v[3] = v3;
+        e.type = type;
+        e.exchange = static_cast<uint8_t>(ex);
+        e.counter_exchange = static_cast<uint8_t>(counter);
+        e.side = side;
+        std::memcpy(e.symbol.data(), symbol.base.data(), e.symbol.size());
+        e.flags = flags;
+        ring->head.store(seq + 1, std::memory_order_release);
+    }
+
+    // Writes <dir>/flight_<wall ms>_<reason>.bin; async-signal-safe, one dump at a time
+    static bool dump(const char* reason) noexcept;
+    [[nodiscard]] static const char* last_dump_path() noexcept { return last_path_; }
+
+    // SIGUSR1 dumps and continues; SIGSEGV/SIGBUS/SIGFPE/SIGILL/SIGABRT dump, then re-raise
+    static void install_signal_handlers();
+
+    // Slots in the calling thread's ring (0 before its first event)
+    [[nodiscard]] static std::size_t thread_ring_capacity() noexcept;
+
+private:
+    struct Ring {
+        alignas(64) std::atomic<uint64_t> head{0};
+        FlightEvent* events{nullptr};
+        uint64_t mask{0};
+        std::atomic<uint64_t> start{0};  // First sequence of the current owner
+        uint32_t tid{0};
+        char name[16]{};
+        char* alt_stack{nullptr};
+        std::atomic<bool> owned{false};
+    };
+
+    static uint64_t steady_ticks() noexcept;
+    static Ring* claim_ring() noexcept;
+    static void release_ring(Ring* ring) noexcept;
+    static void on_signal(int sig) noexcept;
+
+    friend struct FlightRingOwner;
+
+    static std::atomic<bool> enabled_;
+    static thread_local Ring* tls_ring_;
+    static std::atomic<Ring*> rings_[MAX_THREADS];
+    static std::atomic<std::size_t> ring_count_;
+    static std::size_t capacity_;
+    static uint64_t window_ns_;
+    static uint64_t anchor_ticks_;
+    static int64_t anchor_mono_ns_;
+    static double ns_per_tick_;
+    static char dir_[384];
+    static char last_path_[512];
+};
+
+// ── Reader (kimp_bot --flight-decode) ──
+
+struct FlightThreadDump {
+    uint32_t tid{0};
+    std::string name;
+    uint64_t capacity{0};
+    uint64_t overwritten{0};  // Oldest slots dropped: the writer may have reused them during the dump
+    std::vector<FlightEvent> events;
+};
+
+struct FlightDump {
+    std::string reason;
+    int64_t wall_ns{0};      // Dump time
+    uint64_t ticks{0};       // Counter at dump time
+    double ns_per_tick{1.0};
+    uint64_t window_ns{0};
+    std::vector<FlightThreadDump> threads;
+
+    // Wall clock ns of an event, from the dump-time anchor
+    int64_t event_wall_ns(const FlightEvent& e) const noexcept {
+        const auto behind = static_cast<int64_t>(ticks - e.ticks);  // Negative past the anchor
+        return wall_ns - static_cast<int64_t>(static_cast<double>(behind) * ns_per_tick);
+    }
+};
+
+// Reads a dump; false (with error) on a missing file or bad header
+bool read_flight_dump(const std::string& path, FlightDump& out, std::string* error = nullptr);
+
+// All threads merged in time order, one line per event
+std::string format_flight_dump(const FlightDump& dump);
+
+}  // namespace kimp
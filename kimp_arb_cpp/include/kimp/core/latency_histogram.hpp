@@ -0,0 +1,89 @@
+#pragma once
+
+#include "kimp/memory/ring_buffer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace kimp {
+
+/**
+ * Lock-free latency histogram for always-on hot-path measurements
+ *
+ * log2 buckets of microseconds: bucket i holds [2^(i-1), 2^i) us, 0 = <1us.
+ * Negative samples (clock disagreement) are counted apart, not bucketed.
+ */
+class LatencyHistogram {
+public:
+    static constexpr std::size_t BUCKETS = 24;
+
+    struct Summary {
+        uint64_t count{0};
+        uint64_t negative{0};
+        double avg_us{0.0};
+        double p50_us{0.0};  // Bucket upper bounds (log2 resolution)
+        double p99_us{0.0};
+        double max_us{0.0};
+    };
+
+    void record(int64_t ns) noexcept {
+        if (ns < 0) {
+            negative_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const uint64_t us = static_cast<uint64_t>(ns / 1000);
+        const std::size_t bucket = std::min<std::size_t>(
+            us == 0 ? 0 : static_cast<std::size_t>(64 - __builtin_clzll(us)), BUCKETS - 1);
+        hist_[bucket].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_ns_.fetch_add(ns, std::memory_order_relaxed);
+        int64_t prev = max_ns_.load(std::memory_order_relaxed);
+        while (ns > prev && !max_ns_.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    Summary summary() const noexcept {
+        Summary out;
+        out.count = count_.load(std::memory_order_relaxed);
+        out.negative = negative_.load(std::memory_order_relaxed);
+        if (out.count == 0) {
+            return out;
+        }
+        out.avg_us = static_cast<double>(sum_ns_.load(std::memory_order_relaxed)) /
+                     static_cast<double>(out.count) / 1000.0;
+        out.max_us = static_cast<double>(max_ns_.load(std::memory_order_relaxed)) / 1000.0;
+
+        std::array<uint64_t, BUCKETS> counts{};
+        uint64_t total = 0;
+        for (std::size_t i = 0; i < BUCKETS; ++i) {
+            counts[i] = hist_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        auto quantile = [&](double q) {
+            const uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total));
+            uint64_t seen = 0;
+            for (std::size_t i = 0; i < BUCKETS; ++i) {
+                seen += counts[i];
+                if (seen > rank) {
+                    return std::min(static_cast<double>(uint64_t{1} << i), out.max_us);
+                }
+            }
+            return out.max_us;
+        };
+        out.p50_us = quantile(0.50);
+        out.p99_us = quantile(0.99);
+        return out;
+    }
+
+private:
+    alignas(memory::CACHE_LINE_SIZE) std::array<std::atomic<uint64_t>, BUCKETS> hist_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> negative_{0};
+    std::atomic<int64_t> sum_ns_{0};
+    std::atomic<int64_t> max_ns_{0};
+};
+
+} // namespace kimp
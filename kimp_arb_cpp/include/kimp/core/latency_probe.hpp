@@ -103,6 +103,9 @@ struct LatencyProbeStartOptions {
     bool benchmark_clock_on_start{true};
 };
 
+// SignalDetected events carry the triggering market-data frame's kernel
+// receive timing when available: aux0 = kernel RX -> WS handler ns,
+// aux1 = kernel RX -> signal ns (both 0 when the kernel stamp is unknown).
 struct LatencyEvent {
     uint64_t run_id{0};
     uint64_t trace_id{0};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "kimp/core/optimization.hpp"
+
 #include <spdlog/spdlog.h>
 #include <spdlog/async.h>
 #include <spdlog/sinks/rotating_file_sink.h>
@@ -17,10 +19,15 @@ public:
                      int max_size_mb = 100,
                      int max_files = 10,
                      int queue_size = 8192,
-                     bool console_output = true) {
+                     bool console_output = true,
+                     int cpu_core = -1) {
         try {
-            // Initialize async logging
-            spdlog::init_thread_pool(queue_size, 1);
+            // Initialize async logging; the worker is pinned when a core is given
+            spdlog::init_thread_pool(queue_size, 1, [cpu_core]() {
+                if (cpu_core >= 0) {
+                    opt::pin_to_core(cpu_core);
+                }
+            });
 
             // Create sinks
             auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
@@ -8,6 +8,9 @@
 
 #include <thread>
 #include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
 #include <charconv>
 #include <string_view>
 #include <cstdlib>
@@ -186,29 +189,48 @@ struct ThreadConfig {
     int io_bybit_core = 1;
     int strategy_core = 2;
     int execution_core = 3;
+    int logger_core = -1;   // spdlog async worker
+    int export_core = 3;    // JSON exporter
+    // Lifecycle / fill query worker cores, execution_core first;
+    // empty means execution_core + n capped to the last CPU
+    std::vector<int> execution_cores;
+
+    // Core for the n-th execution worker, -1 when unpinned
+    int execution_worker_core(std::size_t n) const {
+        if (execution_core < 0) {
+            return -1;
+        }
+        if (!execution_cores.empty()) {
+            return execution_cores[n % execution_cores.size()];
+        }
+        const int total_cores = static_cast<int>(std::thread::hardware_concurrency());
+        if (total_cores <= 0) {
+            return -1;
+        }
+        return std::min(execution_core + static_cast<int>(n), total_cores - 1);
+    }
+
+    // Topology-aware placement for this host (cpu_topology.cpp), planned once
+    static ThreadConfig optimal();
 
-    static ThreadConfig optimal() {
+    // Layout by CPU count alone, for hosts without a readable sysfs topology
+    static ThreadConfig fallback() {
         ThreadConfig cfg;
         int num_cores = std::thread::hardware_concurrency();
 
-        if (num_cores >= 8) {
-            // High-end server: dedicated cores
-            cfg.io_bithumb_core = 0;
-            cfg.io_bybit_core = 1;
-            cfg.strategy_core = 2;
-            cfg.execution_core = 3;
-        } else if (num_cores >= 4) {
-            // Mid-range: share some cores
+        if (num_cores >= 4) {
             cfg.io_bithumb_core = 0;
             cfg.io_bybit_core = 1;
             cfg.strategy_core = 2;
             cfg.execution_core = 3;
+            cfg.export_core = 3;
         } else {
             // Low-end: no pinning
             cfg.io_bithumb_core = -1;
             cfg.io_bybit_core = -1;
             cfg.strategy_core = -1;
             cfg.execution_core = -1;
+            cfg.export_core = -1;
         }
 
         return cfg;
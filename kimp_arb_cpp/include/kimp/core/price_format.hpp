@@ -31,4 +31,33 @@ inline std::string format_decimal_trimmed(double value, int max_decimals = 8) {
     return out;
 }
 
+// KRW market price unit (Upbit table; Bithumb uses the same grid)
+inline double krw_tick_size(double price) {
+    if (price >= 1'000'000.0) return 1000.0;
+    if (price >= 500'000.0) return 500.0;
+    if (price >= 100'000.0) return 100.0;
+    if (price >= 50'000.0) return 50.0;
+    if (price >= 10'000.0) return 10.0;
+    if (price >= 5'000.0) return 5.0;
+    if (price >= 100.0) return 1.0;
+    if (price >= 10.0) return 0.1;
+    if (price >= 1.0) return 0.01;
+    if (price >= 0.1) return 0.001;
+    if (price >= 0.01) return 0.0001;
+    if (price >= 0.001) return 0.00001;
+    if (price >= 0.0001) return 0.000001;
+    return 0.0000001;
+}
+
+// Snap a limit price onto the tick grid without widening it: buys round
+// down, sells round up (tick <= 0 leaves the price as is)
+inline double round_limit_to_tick(double price, double tick, bool buy) {
+    if (!(tick > 0.0) || !(price > 0.0)) {
+        return price;
+    }
+    const double steps = price / tick;
+    const double snapped = (buy ? std::floor(steps + 1e-9) : std::ceil(steps - 1e-9)) * tick;
+    return snapped > 0.0 ? snapped : tick;
+}
+
 }  // namespace kimp::format
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <chrono>
@@ -75,7 +76,8 @@ enum class OrderStatus : uint8_t {
     Filled = 2,
     Cancelled = 3,
     Rejected = 4,
-    Expired = 5
+    Expired = 5,
+    Unknown = 6  // Submit never answered: may be live under client_id
 };
 
 // Symbol identifier (fixed-size for cache efficiency)
@@ -201,6 +203,10 @@ struct alignas(64) Ticker {
     SymbolId symbol;
     Timestamp timestamp{};
     uint64_t sequence{0};
+    int64_t kernel_rx_ns{0};  // Kernel RX time of the source frame (CLOCK_REALTIME ns, 0 = unknown)
+    int64_t rx_queue_ns{0};   // Kernel RX -> WebSocket handler (socket queue + io thread wakeup)
+    int64_t venue_event_ns{0};  // Venue event time on the local clock (offset-corrected CLOCK_REALTIME ns, 0 = unknown)
+    int64_t venue_age_ns{0};    // Venue event -> WebSocket handler (0 = unknown)
 
     Price last{0.0};
     Price bid{0.0};
@@ -258,8 +264,17 @@ struct Position {
     // Position sizes
     double position_size_usd{0.0};
     Quantity korean_amount{0.0};    // Coins held on Korean exchange
+    Quantity korean_split_amount{0.0};  // Part of korean_amount held on the other Korean venue (split-routed buys)
     Quantity foreign_amount{0.0};   // Contracts/coins shorted on foreign exchange
 
+    // Trading accounts holding the legs (0 = the venue's main account)
+    uint8_t korean_account{0};
+    uint8_t foreign_account{0};
+
+    // Borrow interest on the foreign short, settled up to borrow_accrued_at
+    double borrow_interest_coins{0.0};
+    SystemTimestamp borrow_accrued_at{};
+
     // Status
     bool is_active{false};
 
@@ -287,6 +302,7 @@ struct Order {
     Price average_price{0.0};
 
     std::string order_id_str;  // Exchange-native order ID for async fill queries
+    std::string client_id;     // Venue client order ID (orderLinkId / clOrdId / identifier), kept across retries
 
     SystemTimestamp create_time{};
     SystemTimestamp update_time{};
@@ -370,10 +386,15 @@ struct TradingConfig {
     static constexpr double UPBIT_FEE_RATE   = 0.0005;        // 0.05% (KRW마켓 taker)
     static constexpr double BYBIT_FEE_RATE   = 0.0010;        // 0.10% (VIP0 taker)
     static constexpr double OKX_FEE_RATE     = 0.0010;        // 0.10% (Regular taker)
+    static constexpr double BITHUMB_MAKER_FEE_RATE = 0.0004;  // KRW markets charge makers the taker rate;
+    static constexpr double UPBIT_MAKER_FEE_RATE   = 0.0005;  // a maker leg saves the spread, not the fee
 
     static constexpr double get_korean_fee_rate(Exchange ex) noexcept {
         return (ex == Exchange::Upbit) ? UPBIT_FEE_RATE : BITHUMB_FEE_RATE;
     }
+    static constexpr double get_korean_maker_fee_rate(Exchange ex) noexcept {
+        return (ex == Exchange::Upbit) ? UPBIT_MAKER_FEE_RATE : BITHUMB_MAKER_FEE_RATE;
+    }
     static constexpr double get_foreign_fee_rate(Exchange ex) noexcept {
         return (ex == Exchange::OKX) ? OKX_FEE_RATE : BYBIT_FEE_RATE;
     }
@@ -403,6 +424,11 @@ struct TradingConfig {
     // Fallback fixed exit threshold (used when no position entry_premium available)
     static constexpr double EXIT_PREMIUM_THRESHOLD = 0.25;    // Exit floor: premium >= +0.25%
 
+    // Exit premium that recovers entry, fees and the short's accrued borrow interest
+    static constexpr double dynamic_exit_threshold(double entry_premium, double borrow_cost_pct = 0.0) noexcept {
+        return std::max(entry_premium + DYNAMIC_EXIT_SPREAD + borrow_cost_pct, EXIT_PREMIUM_THRESHOLD);
+    }
+
     static constexpr double MAX_PRICE_DIFF_PERCENT = 50.0;
     static constexpr double MIN_ORDER_KRW = 5000.0;           // Minimum order in KRW
 
@@ -417,7 +443,6 @@ struct TradingConfig {
     static constexpr uint64_t MAX_QUOTE_DESYNC_MS_EXIT = 5000;    // 5s desync tolerance
     static constexpr double MAX_KOREAN_SPREAD_PCT_EXIT = 3.50;    // 3.5% (spread already in bid/ask premium)
     static constexpr double MAX_FOREIGN_SPREAD_PCT_EXIT = 1.50;   // 1.5%
-    static constexpr double MAX_USDT_JUMP_PCT = 1.50;         // Filter abnormal USDT/KRW jumps
     static constexpr uint64_t USDT_FULL_SCAN_DEBOUNCE_MS = 40;   // Keep FX refresh reactive without excessive rescans
     static constexpr uint64_t ENTRY_FAST_SCAN_COOLDOWN_MS = 20;  // Faster event-driven entry rescans on fresh ticks
     static constexpr uint64_t ENTRY_STALL_TIMEOUT_MS = 120000;   // 2min: finalize partial position if no split progress
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "kimp/exchange/exchange_base.hpp"
+#include "kimp/memory/grow_only_map.hpp"
 #include "kimp/utils/crypto.hpp"
 
 #include <simdjson.h>
@@ -21,6 +22,8 @@ namespace kimp::exchange::bithumb {
  */
 class BithumbExchange : public KoreanExchangeBase {
 private:
+    // Public-stream silence before failover (orderbookdepth deltas are bursty)
+    static constexpr auto PUBLIC_WS_STALL_BUDGET = std::chrono::milliseconds(5000);
     static constexpr std::size_t ORDERBOOK_SNAPSHOT_DEPTH = 5;
     static constexpr std::size_t ORDERBOOK_BBO_DEPTH = 1;
     static constexpr auto ORDERBOOK_RESYNC_INTERVAL = std::chrono::milliseconds(500);
@@ -57,10 +60,9 @@ private:
     std::mutex orderbook_mutex_;
 
     // Lock-free BBO cache for hot ticker path
-    // SAFETY: orderbook_bbo_ map structure is populated once during subscribe_orderbook()
-    // and fetch_orderbook_snapshot(), BEFORE orderbook_ready_ is set to true.
-    // After that, only atomic values inside BBO are updated — the map itself is never
-    // modified. This allows lock-free reads from the ticker hot path.
+    // SAFETY: orderbook_bbo_ is insert-only. Entries are added by subscribe_orderbook()
+    // and add_market_subscriptions() (new listings) and published fully built, and
+    // existing entries never move, so the ticker hot path reads without a lock.
     struct BBO {
         std::atomic<double> best_bid{0.0};
         std::atomic<double> best_ask{0.0};
@@ -68,7 +70,8 @@ private:
         std::atomic<double> best_ask_qty{0.0};
         std::atomic<double> last_price{0.0};  // replaces last_price_cache_
     };
-    std::unordered_map<SymbolId, BBO> orderbook_bbo_;
+    static constexpr std::size_t MAX_BBO_SYMBOLS = 1024;
+    memory::GrowOnlyMap<SymbolId, BBO, MAX_BBO_SYMBOLS> orderbook_bbo_;
     std::atomic<bool> orderbook_ready_{false};
     std::atomic<bool> orderbook_resync_running_{false};
     std::thread orderbook_resync_thread_;
@@ -84,6 +87,7 @@ public:
 
     void subscribe_ticker(const std::vector<SymbolId>& symbols) override;
     void subscribe_orderbook(const std::vector<SymbolId>& symbols) override;
+    void add_market_subscriptions(const std::vector<SymbolId>& symbols) override;
 
     std::vector<SymbolId> get_available_symbols() override;
     std::vector<Ticker> fetch_all_tickers() override;
@@ -104,6 +108,8 @@ protected:
     void on_ws_message(std::string_view message) override;
     void on_ws_connected() override;
     void on_ws_disconnected() override;
+    bool fetch_server_time_ns(int64_t& server_ns) override;
+    int64_t venue_event_time_ms(std::string_view message) const override;
     void on_private_ws_message(std::string_view message);
 
 private:
@@ -126,6 +132,9 @@ private:
     bool query_order_detail_ws(const std::string& order_id, Order& order);
 
     std::optional<Ticker> make_bbo_ticker(const SymbolId& symbol);
+    // Top OrderBook::MAX_LEVELS of the maintained depth (only built when an
+    // orderbook callback is installed, e.g. paper execution)
+    bool make_depth_book(const SymbolId& symbol, OrderBook& out);
     bool parse_ticker_message(std::string_view message, Ticker& ticker);
     std::vector<SymbolId> parse_orderbookdepth_message(std::string_view message);
     void update_bbo(const SymbolId& symbol);
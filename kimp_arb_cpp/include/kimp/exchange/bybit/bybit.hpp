@@ -24,12 +24,16 @@ namespace kimp::exchange::bybit {
  */
 class BybitExchange : public ForeignShortExchangeBase {
 private:
+    // Public-stream silence before failover (orderbook.1 ticks every 10-100ms)
+    static constexpr auto PUBLIC_WS_STALL_BUDGET = std::chrono::milliseconds(3000);
+
     simdjson::ondemand::parser json_parser_;
     simdjson::padded_string json_buffer_{8192};
     struct LotSize {
         double min_qty{0.0};
         double qty_step{0.0};
         double min_notional{0.0};
+        double tick_size{0.0};
     };
     std::unordered_map<std::string, LotSize> lot_size_cache_;
     mutable std::shared_mutex metadata_mutex_;
@@ -57,6 +61,9 @@ private:
     std::mutex subscription_mutex_;
     std::atomic<bool> spot_margin_mode_ready_{false};
     std::mutex spot_margin_mutex_;
+    // Short closes left Unknown: the borrow is repaid once lookup finds them
+    std::unordered_set<std::string> unrepaid_closes_;
+    std::mutex unrepaid_closes_mutex_;
 
 public:
     BybitExchange(net::io_context& ioc, ExchangeCredentials creds)
@@ -68,18 +75,24 @@ public:
 
     void subscribe_ticker(const std::vector<SymbolId>& symbols) override;
     void subscribe_orderbook(const std::vector<SymbolId>& symbols) override;
+    void add_market_subscriptions(const std::vector<SymbolId>& symbols) override;
 
     std::vector<SymbolId> get_available_symbols() override;
     std::vector<Ticker> fetch_all_tickers() override;
 
     Order place_market_order(const SymbolId& symbol, Side side, Quantity quantity) override;
     bool cancel_order(uint64_t order_id) override;
+    bool supports_ioc() const override { return true; }
+    Order place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) override;
 
     bool prepare_shorting(const SymbolId& symbol) override;
     std::vector<Position> get_short_positions() override;
     bool close_short_position(const SymbolId& symbol) override;
     Order open_short(const SymbolId& symbol, Quantity quantity) override;
     Order close_short(const SymbolId& symbol, Quantity quantity) override;
+    Order open_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) override;
+    Order close_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) override;
+    LookupReply lookup_client_order(Order& order) override;
 
     double get_balance(const std::string& currency) override;
     std::vector<AccountBalance> get_all_balances() override;
@@ -95,23 +108,43 @@ public:
     // Calls GET /v5/asset/coin/query-info (requires auth).
     std::unordered_map<std::string, std::unordered_set<std::string>> fetch_deposit_networks();
 
+    // Fetch the account's hourly borrow rate per coin (fraction per hour).
+    // Calls GET /v5/account/collateral-info (requires auth).
+    std::unordered_map<std::string, double> fetch_borrow_rates();
+
 protected:
     void on_ws_message(std::string_view message) override;
     void on_ws_connected() override;
     void on_ws_disconnected() override;
+    bool fetch_server_time_ns(int64_t& server_ns) override;
+    int64_t venue_event_time_ms(std::string_view message) const override;
 
 private:
     std::string generate_signature(int64_t timestamp, const std::string& params) const;
     std::string resolve_public_ws_endpoint() const;
+    // Batched orderbook subscribe requests for symbols (no list bookkeeping)
+    void send_orderbook_subscribe(const std::vector<SymbolId>& symbols);
 
     std::unordered_map<std::string, std::string> build_auth_headers(
         const std::string& params = "") const;
 
     bool ensure_spot_margin_mode();
     bool parse_ticker_message(std::string_view message, Ticker& ticker);
-    bool parse_order_response(const std::string& response, Order& order, std::string* order_id_out = nullptr);
+    // duplicate_id: set when the venue refused an orderLinkId it already holds
+    bool parse_order_response(const std::string& response, Order& order, std::string* order_id_out = nullptr,
+                              bool* duplicate_id = nullptr);
+    // POST /v5/order/create under order.client_id; unanswered submits are
+    // resolved by orderLinkId and retried with it (order_submit.hpp)
+    void submit_order(const std::string& body, Order& order, const char* what);
+    LookupReply lookup_order_link(Order& order);
     double normalize_order_qty(const SymbolId& symbol, double qty, bool is_open) const;
     double normalize_close_qty(const SymbolId& symbol, double qty) const;
+    // Limit price on the tick grid, never beyond the requested price
+    double normalize_limit_price(const SymbolId& symbol, double price, bool buy) const;
+    // limit_price 0 = market order
+    Order place_spot_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price);
+    Order open_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price);
+    Order close_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price);
 
     std::string symbol_to_bybit(const SymbolId& symbol) const {
         return std::string(symbol.get_base()) + std::string(symbol.get_quote());
@@ -61,9 +61,12 @@ public:
      * Place order synchronously via WebSocket Trade API
      * Blocks until ACK received or timeout (1s)
      * Returns Order with status Filled (on ACK success) or Rejected (on failure/timeout)
+     * limit_price > 0 sends an IOC limit order instead of a market order;
+     * a non-empty client_id goes out as orderLinkId
      */
     Order place_order_sync(const std::string& symbol, Side side, double qty,
-                           bool is_leverage);
+                           bool is_leverage, double limit_price = 0.0,
+                           const std::string& client_id = {});
 
 private:
     void authenticate();
@@ -2,8 +2,12 @@
 
 #include "kimp/core/types.hpp"
 #include "kimp/core/config.hpp"
+#include "kimp/core/latency_histogram.hpp"
 #include "kimp/network/websocket_client.hpp"
 #include "kimp/network/connection_pool.hpp"
+#include "kimp/network/feed_arbiter.hpp"
+#include "kimp/network/venue_clock.hpp"
+#include "kimp/exchange/order_submit.hpp"
 #include "kimp/memory/ring_buffer.hpp"
 
 #include <boost/asio.hpp>
@@ -11,13 +15,17 @@
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <atomic>
 #include <mutex>
+#include <functional>
 #include <future>
+#include <optional>
 
 namespace kimp::exchange {
 
@@ -54,6 +62,8 @@ struct AccountBalance {
  * - DNS caching
  * - HTTP/1.1 keep-alive
  * - TCP_NODELAY for minimal latency
+ * - Per-request deadline over the blocking write and read (SocketDeadline);
+ *   a request past it fails with no status, and POSTs are never resent
  */
 class RestClient {
 private:
@@ -92,14 +102,24 @@ public:
         return connection_pool_->get_stats();
     }
 
+    static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{10000};
+
+    // Stands in for the network (tests): every request goes to it instead
+    using Transport = std::function<HttpResponse(http::verb method, const std::string& target,
+                                                 const std::string& body, std::chrono::milliseconds timeout)>;
+    void set_transport(Transport transport) { transport_ = std::move(transport); }
+
     // Synchronous GET request
     HttpResponse get(const std::string& target,
-                     const std::unordered_map<std::string, std::string>& headers = {});
+                     const std::unordered_map<std::string, std::string>& headers = {},
+                     std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
 
-    // Synchronous POST request
+    // Synchronous POST request. No response (status_code 0) leaves the
+    // outcome unknown: the venue may have processed it
     HttpResponse post(const std::string& target,
                       const std::string& body,
-                      const std::unordered_map<std::string, std::string>& headers = {});
+                      const std::unordered_map<std::string, std::string>& headers = {},
+                      std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
 
     // Synchronous DELETE request
     HttpResponse del(const std::string& target,
@@ -114,10 +134,13 @@ public:
                                           const std::unordered_map<std::string, std::string>& headers = {});
 
 private:
+    Transport transport_;
+
     HttpResponse do_request(http::verb method,
                             const std::string& target,
                             const std::string& body,
-                            const std::unordered_map<std::string, std::string>& headers);
+                            const std::unordered_map<std::string, std::string>& headers,
+                            std::chrono::milliseconds timeout);
 };
 
 /**
@@ -140,6 +163,10 @@ public:
     // WebSocket subscriptions
     virtual void subscribe_ticker(const std::vector<SymbolId>& symbols) = 0;
     virtual void subscribe_orderbook(const std::vector<SymbolId>& symbols) = 0;
+    // New listings: streams the symbols on the live connection and keeps them
+    // for reconnects, without resubscribing the existing ones. Known symbols
+    // are skipped.
+    virtual void add_market_subscriptions(const std::vector<SymbolId>& /*symbols*/) {}
 
     // Callbacks
     virtual void set_ticker_callback(TickerCallback cb) = 0;
@@ -155,6 +182,39 @@ public:
     virtual Order place_market_buy_cost(const SymbolId& symbol, Price cost) = 0;  // For Korean exchanges
     virtual bool cancel_order(uint64_t order_id) = 0;
 
+    // Immediate-or-cancel limit order: fills at limit_price or better, the
+    // rest is cancelled by the venue. Venues without IOC reject it.
+    virtual bool supports_ioc() const { return false; }
+    virtual Order place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
+        Order order;
+        order.symbol = symbol;
+        order.side = side;
+        order.type = OrderType::Limit;
+        order.price = limit_price;
+        order.quantity = quantity;
+        order.status = OrderStatus::Rejected;
+        return order;
+    }
+
+    // Post-only limit order: rests on the book, cancelled by the venue when
+    // it would cross. Acked New; venues without post-only reject it.
+    virtual bool supports_post_only() const { return false; }
+    virtual Order place_post_only_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
+        Order order;
+        order.symbol = symbol;
+        order.side = side;
+        order.type = OrderType::Limit;
+        order.price = limit_price;
+        order.quantity = quantity;
+        order.status = OrderStatus::Rejected;
+        return order;
+    }
+
+    // Order under order.client_id, for a submit left Unknown: Found fills in
+    // the venue id and the order's state. Venues without client ids never
+    // leave a submit Unknown.
+    virtual LookupReply lookup_client_order(Order& /*order*/) { return LookupReply::Unknown; }
+
     // Balance
     virtual double get_balance(const std::string& currency) = 0;
     virtual std::vector<AccountBalance> get_all_balances() { return {}; }
@@ -189,6 +249,71 @@ protected:
     // Event queue
     memory::SPSCRingBuffer<Ticker, 4096> ticker_queue_;
 
+    // Redundant public feed: line B mirrors ws_client_ (line A) and the
+    // arbiter forwards whichever copy of each update arrives first.
+    static constexpr uint8_t FEED_LINE_A = 0;
+    static constexpr uint8_t FEED_LINE_B = 1;
+    static inline thread_local uint8_t current_feed_line_ = FEED_LINE_A;
+    std::shared_ptr<network::WebSocketClient> ws_client_b_;
+    std::unique_ptr<network::FeedArbiter> feed_arbiter_;
+    std::mutex public_subscriptions_mutex_;
+    std::vector<std::string> public_subscriptions_;
+
+    // Public stream session (line A). ws_client_ is swapped on rotation, so
+    // it is only read under public_ws_mutex_; the hot path compares the
+    // delivering client against active_public_ws_ instead.
+    mutable std::mutex public_ws_mutex_;
+    std::shared_ptr<network::WebSocketClient> standby_ws_;
+    std::atomic<network::WebSocketClient*> active_public_ws_{nullptr};
+    std::string public_ws_url_;
+    std::string public_ws_name_;
+    std::chrono::milliseconds public_ws_stall_budget_{0};
+    int64_t rotation_started_ns_{0};
+    net::steady_timer rotation_timer_;
+
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<int64_t> last_public_msg_ns_{0};
+    std::atomic<bool> public_session_fresh_{false};
+    std::atomic<uint64_t> ws_rotations_{0};
+    std::atomic<uint64_t> ws_rotation_aborts_{0};
+    std::atomic<uint64_t> ws_stalls_{0};
+    std::atomic<int64_t> ws_last_blind_us_{0};
+    std::atomic<int64_t> ws_max_blind_us_{0};
+
+    // Receive-path tuning for public market-data sockets; set once at
+    // startup, before any exchange connects.
+    static inline network::SocketTuning market_data_socket_tuning_{};
+
+    // Order submit timeout and client-id retries; set once at startup
+    static inline OrderSubmitPolicy order_submit_policy_{};
+
+    // Socket-to-handler delay of public frames (kernel RX -> on_read)
+    LatencyHistogram rx_queue_hist_;
+
+    // Venue clock model (fed by sample_clock()) and the one-way feed latency
+    // it makes measurable: venue event time -> kernel RX, offset-corrected.
+    network::VenueClock venue_clock_;
+    LatencyHistogram feed_latency_hist_;
+
+    // Venue event time of the frame being handled, for dispatch_ticker.
+    // No member initializers: the thread_local below is initialized in-class.
+    struct VenueEventInfo {
+        int64_t local_ns;  // Event time on the local CLOCK_REALTIME (0 = unknown)
+        int64_t age_ns;    // Event -> frame handler
+    };
+    static inline thread_local VenueEventInfo current_venue_event_{};
+
+    // Marks messages delivered by line B for the duration of one handler call
+    struct FeedLineScope {
+        explicit FeedLineScope(uint8_t line) noexcept : previous_(current_feed_line_) {
+            current_feed_line_ = line;
+        }
+        ~FeedLineScope() { current_feed_line_ = previous_; }
+        FeedLineScope(const FeedLineScope&) = delete;
+        FeedLineScope& operator=(const FeedLineScope&) = delete;
+    private:
+        uint8_t previous_;
+    };
+
 public:
     ExchangeBase(Exchange id, MarketType type, std::string name,
                  net::io_context& ioc, ExchangeCredentials creds)
@@ -196,11 +321,16 @@ public:
         , market_type_(type)
         , name_(std::move(name))
         , credentials_(std::move(creds))
-        , io_context_(ioc) {
+        , io_context_(ioc)
+        , rotation_timer_(ioc) {
 
         // Initialize REST client with connection pooling
         std::string host = extract_host(credentials_.rest_endpoint);
         rest_client_ = std::make_unique<RestClient>(io_context_, host);
+
+        if (credentials_.redundant_feed) {
+            feed_arbiter_ = std::make_unique<network::FeedArbiter>();
+        }
     }
 
     // Initialize REST connection pool (call before using REST API)
@@ -218,6 +348,13 @@ public:
         }
     }
 
+    // Routes REST calls to a stand-in network (tests)
+    void set_rest_transport(RestClient::Transport transport) {
+        if (rest_client_) {
+            rest_client_->set_transport(std::move(transport));
+        }
+    }
+
     // Get REST client stats for monitoring
     network::ConnectionPool::Stats get_rest_stats() const {
         if (rest_client_) {
@@ -226,6 +363,100 @@ public:
         return {};
     }
 
+    static void set_market_data_socket_tuning(const network::SocketTuning& tuning) {
+        market_data_socket_tuning_ = tuning;
+    }
+
+    static void set_order_submit_policy(const OrderSubmitPolicy& policy) {
+        order_submit_policy_ = policy;
+    }
+    static const OrderSubmitPolicy& order_submit_policy() noexcept { return order_submit_policy_; }
+
+    // Redundant feed reporting (nullopt when the venue runs a single line)
+    bool redundant_feed_enabled() const noexcept { return feed_arbiter_ != nullptr; }
+    std::optional<network::FeedArbiter::Stats> get_feed_arbiter_stats() const {
+        if (!feed_arbiter_) {
+            return std::nullopt;
+        }
+        return feed_arbiter_->stats();
+    }
+
+    // Public stream failover reporting
+    struct PublicStreamStats {
+        uint64_t rotations{0};        // Completed make-before-break switches
+        uint64_t rotation_aborts{0};  // Standby never produced data; fell back to reconnect
+        uint64_t stalls{0};           // Stall budget expiries on the active session
+        double last_blind_ms{0.0};    // Data gap across the most recent session change
+        double max_blind_ms{0.0};
+    };
+
+    struct RxQueueStats {
+        uint64_t frames{0};
+        double avg_us{0.0};
+        double p50_us{0.0};  // Bucket upper bounds (log2 resolution)
+        double p99_us{0.0};
+        double max_us{0.0};
+    };
+
+    RxQueueStats get_rx_queue_stats() const {
+        const auto summary = rx_queue_hist_.summary();
+        RxQueueStats stats;
+        stats.frames = summary.count;
+        stats.avg_us = summary.avg_us;
+        stats.p50_us = summary.p50_us;
+        stats.p99_us = summary.p99_us;
+        stats.max_us = summary.max_us;
+        return stats;
+    }
+
+    // Venue clock sync and one-way feed latency reporting
+    struct ClockSyncStats {
+        network::VenueClock::Estimate clock;
+        uint64_t clock_steps{0};
+        LatencyHistogram::Summary feed_latency;  // negative = event stamped "after" RX
+    };
+
+    ClockSyncStats get_clock_sync_stats() const {
+        return {venue_clock_.estimate(), venue_clock_.steps(), feed_latency_hist_.summary()};
+    }
+
+    const network::VenueClock& venue_clock() const noexcept { return venue_clock_; }
+
+    // One server-time round trip; call from a background thread. False when
+    // the venue has no time source or the request failed.
+    bool sample_clock() {
+        const int64_t send_ns = realtime_now_ns();
+        int64_t server_ns = 0;
+        if (!fetch_server_time_ns(server_ns)) {
+            return false;
+        }
+        return venue_clock_.add_sample({send_ns, server_ns, realtime_now_ns()});
+    }
+
+    PublicStreamStats get_public_stream_stats() const {
+        PublicStreamStats stats;
+        stats.rotations = ws_rotations_.load(std::memory_order_relaxed);
+        stats.rotation_aborts = ws_rotation_aborts_.load(std::memory_order_relaxed);
+        stats.stalls = ws_stalls_.load(std::memory_order_relaxed);
+        stats.last_blind_ms = static_cast<double>(ws_last_blind_us_.load(std::memory_order_relaxed)) / 1000.0;
+        stats.max_blind_ms = static_cast<double>(ws_max_blind_us_.load(std::memory_order_relaxed)) / 1000.0;
+        return stats;
+    }
+
+    // Open a replacement public session, replay subscriptions on it and
+    // switch over on its first data frame. False if one is already pending.
+    bool rotate_public_ws(const std::string& reason) {
+        std::lock_guard lock(public_ws_mutex_);
+        if (public_ws_url_.empty() || !ws_client_ || standby_ws_) {
+            return false;
+        }
+        standby_ws_ = make_public_ws_client(public_ws_name_);
+        rotation_started_ns_ = steady_now_ns();
+        Logger::info("[{}] Rotating public stream ({})", name_, reason);
+        standby_ws_->connect(public_ws_url_);
+        return true;
+    }
+
     // IExchange implementation
     Exchange get_exchange_id() const override { return exchange_id_; }
     MarketType get_market_type() const override { return market_type_; }
@@ -254,8 +485,28 @@ public:
     }
 
 protected:
-    // Dispatch callbacks
+    // Dispatch callbacks. Tickers parsed inside a public-stream frame carry
+    // that frame's kernel receive time and offset-corrected venue event time.
     void dispatch_ticker(const Ticker& ticker) {
+        const auto& rx = network::WebSocketClient::current_frame_rx();
+        const auto& venue = current_venue_event_;
+        if ((rx.valid() && ticker.kernel_rx_ns == 0) || (venue.local_ns != 0 && ticker.venue_event_ns == 0)) {
+            Ticker stamped = ticker;
+            if (rx.valid() && ticker.kernel_rx_ns == 0) {
+                stamped.kernel_rx_ns = rx.kernel_rx_ns;
+                stamped.rx_queue_ns = rx.queue_ns();
+            }
+            if (venue.local_ns != 0 && ticker.venue_event_ns == 0) {
+                stamped.venue_event_ns = venue.local_ns;
+                stamped.venue_age_ns = venue.age_ns;
+            }
+            deliver_ticker(stamped);
+            return;
+        }
+        deliver_ticker(ticker);
+    }
+
+    void deliver_ticker(const Ticker& ticker) {
         // Update cache
         {
             std::lock_guard lock(price_mutex_);
@@ -295,6 +546,17 @@ protected:
         return next_order_id_.fetch_add(1, std::memory_order_relaxed);
     }
 
+    // Local and venue client order ID, fixed before the first submit
+    void assign_client_order_id(Order& order) {
+        order.client_order_id = generate_order_id();
+        order.client_id = format_client_order_id(order.client_order_id);
+    }
+
+    // No HTTP answer, or a gateway error: the venue may have taken the order
+    static bool outcome_unknown(const HttpResponse& response) noexcept {
+        return response.status_code == 0 || response.status_code >= 500;
+    }
+
     // Extract host from URL
     static std::string extract_host(const std::string& url) {
         // Remove protocol
@@ -313,6 +575,400 @@ protected:
         return host;
     }
 
+    static int64_t steady_now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static int64_t realtime_now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    // Venue clocks worse than this (RTT/2 bound) are not used to age quotes
+    static constexpr int64_t MAX_VENUE_CLOCK_ERROR_NS = 50'000'000;
+
+    // Venue server time for clock sampling (CLOCK_REALTIME-domain ns).
+    // Millisecond sources should report the middle of their tick.
+    virtual bool fetch_server_time_ns(int64_t& /*server_ns*/) { return false; }
+
+    // Venue event time carried by a public frame (epoch ms, 0 = none)
+    virtual int64_t venue_event_time_ms(std::string_view /*message*/) const { return 0; }
+
+    // Open the public stream (line A). stall_budget is the longest silence
+    // this venue's subscriptions can legitimately produce; past it the
+    // session is rotated instead of waiting for TCP or the ping to fail.
+    void start_public_ws(std::string client_name, std::string url,
+                         std::chrono::milliseconds stall_budget) {
+        std::shared_ptr<network::WebSocketClient> client;
+        {
+            std::lock_guard lock(public_ws_mutex_);
+            public_ws_name_ = std::move(client_name);
+            public_ws_url_ = std::move(url);
+            public_ws_stall_budget_ = stall_budget;
+            ws_client_ = make_public_ws_client(public_ws_name_);
+            active_public_ws_.store(ws_client_.get(), std::memory_order_release);
+            client = ws_client_;
+        }
+        client->connect(public_ws_url_);
+        schedule_planned_rotation();
+    }
+
+    void stop_public_ws() {
+        rotation_timer_.cancel();
+        std::shared_ptr<network::WebSocketClient> active;
+        std::shared_ptr<network::WebSocketClient> standby;
+        {
+            std::lock_guard lock(public_ws_mutex_);
+            active = ws_client_;
+            standby = std::move(standby_ws_);
+        }
+        if (standby) {
+            standby->disconnect();
+        }
+        stop_redundant_feed();
+        if (active) {
+            active->disconnect();
+        }
+    }
+
+    bool public_ws_connected() const {
+        std::lock_guard lock(public_ws_mutex_);
+        return ws_client_ && ws_client_->is_connected();
+    }
+
+    // Public-stream send. Payloads are journaled so a standby session or
+    // line B can replay them on its own (re)connect; a repeated payload is a
+    // resubscription of the active session and is not mirrored.
+    void send_public(std::string payload) {
+        bool is_new = false;
+        {
+            std::lock_guard lock(public_subscriptions_mutex_);
+            if (std::find(public_subscriptions_.begin(), public_subscriptions_.end(), payload) ==
+                public_subscriptions_.end()) {
+                public_subscriptions_.push_back(payload);
+                is_new = true;
+            }
+        }
+        std::shared_ptr<network::WebSocketClient> active;
+        std::shared_ptr<network::WebSocketClient> standby;
+        {
+            std::lock_guard lock(public_ws_mutex_);
+            active = ws_client_;
+            standby = standby_ws_;
+        }
+        if (is_new) {
+            if (standby && standby->is_connected()) {
+                standby->send(payload);
+            }
+            if (ws_client_b_ && ws_client_b_->is_connected()) {
+                ws_client_b_->send(payload);
+            }
+        }
+        if (active) {
+            active->send(std::move(payload));
+        }
+    }
+
+    network::DeflateOptions public_ws_deflate() const noexcept {
+        return {credentials_.ws_deflate, credentials_.ws_deflate_context_takeover,
+                credentials_.ws_deflate_window_bits};
+    }
+
+    std::shared_ptr<network::WebSocketClient> make_public_ws_client(const std::string& client_name) {
+        auto client = std::make_shared<network::WebSocketClient>(io_context_, client_name);
+        network::WebSocketClient* raw = client.get();
+        client->set_message_callback([this, raw](std::string_view msg, network::MessageType /*type*/) {
+            on_public_ws_message(raw, msg);
+        });
+        client->set_connect_callback([this, raw](bool success, const std::string& error) {
+            on_public_ws_connect(raw, success, error);
+        });
+        client->set_disconnect_callback([this, raw](const std::string& reason) {
+            on_public_ws_disconnect(raw, reason);
+        });
+        client->set_stall_timeout(public_ws_stall_budget_);
+        client->set_rx_timestamping(true);
+        client->set_socket_tuning(market_data_socket_tuning_);
+        client->set_deflate(public_ws_deflate());
+        client->set_stall_callback([this, raw](int64_t silent_ms) {
+            on_public_ws_stall(raw, silent_ms);
+        });
+        return client;
+    }
+
+    // Frames from a superseded session are dropped; the first frame from the
+    // standby promotes it and retires the old session.
+    void on_public_ws_message(network::WebSocketClient* from, std::string_view message) {
+        if (from != active_public_ws_.load(std::memory_order_acquire) && !promote_standby(from)) {
+            return;
+        }
+        const int64_t now_ns = steady_now_ns();
+        if (public_session_fresh_.load(std::memory_order_relaxed) &&
+            public_session_fresh_.exchange(false, std::memory_order_relaxed)) {
+            record_blind_gap(now_ns);
+        }
+        last_public_msg_ns_.store(now_ns, std::memory_order_relaxed);
+        record_rx_queue_delay();
+        VenueEventScope venue_event(stamp_venue_event(message));
+        on_ws_message(message);
+    }
+
+    void record_rx_queue_delay() {
+        const auto& rx = network::WebSocketClient::current_frame_rx();
+        if (rx.valid()) {
+            rx_queue_hist_.record(std::max<int64_t>(0, rx.queue_ns()));
+        }
+    }
+
+    // Map the frame's venue event time onto our clock and record the feed
+    // latency. Returns what dispatch_ticker stamps on tickers of this frame;
+    // empty until the clock is synced to within MAX_VENUE_CLOCK_ERROR_NS.
+    VenueEventInfo stamp_venue_event(std::string_view message) {
+        const int64_t event_ms = venue_event_time_ms(message);
+        if (event_ms <= 0) {
+            return {};
+        }
+        const auto clock = venue_clock_.estimate();
+        if (!clock.synced || clock.error_ns > MAX_VENUE_CLOCK_ERROR_NS) {
+            return {};
+        }
+        const int64_t event_local_ns = clock.venue_to_local_ns(event_ms * 1'000'000);
+        const auto& rx = network::WebSocketClient::current_frame_rx();
+        const int64_t handler_ns = rx.valid() ? rx.handler_ns : realtime_now_ns();
+        const int64_t arrival_ns = rx.valid() ? rx.kernel_rx_ns : handler_ns;
+        feed_latency_hist_.record(arrival_ns - event_local_ns);
+        return {event_local_ns, std::max<int64_t>(0, handler_ns - event_local_ns)};
+    }
+
+    struct VenueEventScope {
+        explicit VenueEventScope(const VenueEventInfo& info) noexcept : previous_(current_venue_event_) {
+            current_venue_event_ = info;
+        }
+        ~VenueEventScope() { current_venue_event_ = previous_; }
+        VenueEventScope(const VenueEventScope&) = delete;
+        VenueEventScope& operator=(const VenueEventScope&) = delete;
+    private:
+        VenueEventInfo previous_;
+    };
+
+    void on_public_ws_connect(network::WebSocketClient* from, bool success, const std::string& error) {
+        if (from == active_public_ws_.load(std::memory_order_acquire)) {
+            if (!success) {
+                Logger::error("[{}] WebSocket connect failed: {}", name_, error);
+                return;
+            }
+            public_session_fresh_.store(true, std::memory_order_relaxed);
+            on_ws_connected();
+            return;
+        }
+
+        std::shared_ptr<network::WebSocketClient> standby;
+        {
+            std::lock_guard lock(public_ws_mutex_);
+            if (standby_ws_.get() == from) {
+                standby = standby_ws_;
+            }
+        }
+        if (!standby || !success) {
+            return;
+        }
+        // Subscribe from the journal; on_ws_connected would reset state that
+        // the still-live session is keeping current.
+        std::vector<std::string> replay;
+        {
+            std::lock_guard lock(public_subscriptions_mutex_);
+            replay = public_subscriptions_;
+        }
+        for (auto& payload : replay) {
+            standby->send(std::move(payload));
+        }
+        Logger::info("[{}] Standby public stream connected, replayed {} subscriptions",
+                     name_, replay.size());
+    }
+
+    void on_public_ws_disconnect(network::WebSocketClient* from, const std::string& reason) {
+        if (from != active_public_ws_.load(std::memory_order_acquire)) {
+            return;
+        }
+        Logger::debug("[{}] Public stream disconnected: {}", name_, reason);
+        on_ws_disconnected();
+    }
+
+    void on_public_ws_stall(network::WebSocketClient* from, int64_t silent_ms) {
+        {
+            std::lock_guard lock(public_subscriptions_mutex_);
+            if (public_subscriptions_.empty()) {
+                return;  // Nothing subscribed yet, silence is expected
+            }
+        }
+
+        std::shared_ptr<network::WebSocketClient> active;
+        std::shared_ptr<network::WebSocketClient> abandoned;
+        {
+            std::lock_guard lock(public_ws_mutex_);
+            if (standby_ws_.get() == from) {
+                // Replacement connected but never delivered; retry on the next stall
+                abandoned = std::move(standby_ws_);
+            } else if (from == ws_client_.get()) {
+                ws_stalls_.fetch_add(1, std::memory_order_relaxed);
+                if (standby_ws_ &&
+                    steady_now_ns() - rotation_started_ns_ >
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(public_ws_stall_budget_).count()) {
+                    // The standby did not take over within a budget either:
+                    // give up on make-before-break and reconnect in place.
+                    abandoned = std::move(standby_ws_);
+                    active = ws_client_;
+                    ws_rotation_aborts_.fetch_add(1, std::memory_order_relaxed);
+                }
+            } else {
+                return;
+            }
+        }
+
+        if (abandoned) {
+            abandoned->disconnect();
+        }
+        if (active) {
+            Logger::warn("[{}] Standby public stream never delivered, reconnecting in place", name_);
+            active->force_reconnect("stall");
+            return;
+        }
+        if (!abandoned) {
+            rotate_public_ws(fmt::format("stall {}ms", silent_ms));
+        }
+    }
+
+    bool promote_standby(network::WebSocketClient* from) {
+        std::shared_ptr<network::WebSocketClient> retired;
+        {
+            std::lock_guard lock(public_ws_mutex_);
+            if (!standby_ws_ || standby_ws_.get() != from) {
+                return false;
+            }
+            retired = std::move(ws_client_);
+            ws_client_ = std::move(standby_ws_);
+            active_public_ws_.store(ws_client_.get(), std::memory_order_release);
+        }
+        const int64_t now_ns = steady_now_ns();
+        public_session_fresh_.store(false, std::memory_order_relaxed);
+        record_blind_gap(now_ns);
+        ws_rotations_.fetch_add(1, std::memory_order_relaxed);
+        connected_.store(true, std::memory_order_release);
+        Logger::info("[{}] Public stream switched to standby session (blind {:.1f}ms)",
+                     name_, static_cast<double>(ws_last_blind_us_.load(std::memory_order_relaxed)) / 1000.0);
+        if (retired) {
+            net::post(io_context_, [retired = std::move(retired)] { retired->disconnect(); });
+        }
+        return true;
+    }
+
+    void record_blind_gap(int64_t now_ns) {
+        const int64_t last_ns = last_public_msg_ns_.load(std::memory_order_relaxed);
+        if (last_ns == 0) {
+            return;
+        }
+        const int64_t gap_us = std::max<int64_t>(0, (now_ns - last_ns) / 1000);
+        ws_last_blind_us_.store(gap_us, std::memory_order_relaxed);
+        int64_t prev = ws_max_blind_us_.load(std::memory_order_relaxed);
+        while (gap_us > prev &&
+               !ws_max_blind_us_.compare_exchange_weak(prev, gap_us, std::memory_order_relaxed)) {
+        }
+    }
+
+    void schedule_planned_rotation() {
+        if (credentials_.ws_rotate_minutes <= 0) {
+            return;
+        }
+        auto weak_self = weak_from_this();
+        if (weak_self.expired()) {
+            return;
+        }
+        rotation_timer_.expires_after(std::chrono::minutes(credentials_.ws_rotate_minutes));
+        rotation_timer_.async_wait([weak_self](const boost::system::error_code& ec) {
+            if (ec) {
+                return;
+            }
+            auto self = weak_self.lock();
+            if (!self) {
+                return;
+            }
+            self->rotate_public_ws("planned");
+            self->schedule_planned_rotation();
+        });
+    }
+
+    // Open line B against the same public endpoint (no-op unless redundant_feed)
+    void start_redundant_feed(const std::string& url) {
+        if (!feed_arbiter_ || ws_client_b_) {
+            return;
+        }
+
+        ws_client_b_ = std::make_shared<network::WebSocketClient>(io_context_, name_ + "-WS-B");
+        // Prefer a different resolved address than line A so the two lines
+        // do not share one TCP path when the venue publishes several IPs.
+        ws_client_b_->set_endpoint_preference(1);
+        ws_client_b_->set_stall_timeout(public_ws_stall_budget_);
+        ws_client_b_->set_rx_timestamping(true);
+        ws_client_b_->set_socket_tuning(market_data_socket_tuning_);
+        ws_client_b_->set_deflate(public_ws_deflate());
+        ws_client_b_->set_stall_callback([this](int64_t /*silent_ms*/) {
+            std::lock_guard lock(public_subscriptions_mutex_);
+            if (!public_subscriptions_.empty()) {
+                ws_client_b_->force_reconnect("stall");
+            }
+        });
+
+        ws_client_b_->set_message_callback([this](std::string_view msg, network::MessageType /*type*/) {
+            FeedLineScope scope(FEED_LINE_B);
+            record_rx_queue_delay();
+            VenueEventScope venue_event(stamp_venue_event(msg));
+            on_ws_message(msg);
+        });
+
+        ws_client_b_->set_connect_callback([this](bool success, const std::string& error) {
+            if (!success) {
+                Logger::error("[{}] Redundant feed line B connect failed: {}", name_, error);
+                return;
+            }
+            std::vector<std::string> replay;
+            {
+                std::lock_guard lock(public_subscriptions_mutex_);
+                replay = public_subscriptions_;
+            }
+            for (auto& payload : replay) {
+                ws_client_b_->send(std::move(payload));
+            }
+            Logger::info("[{}] Redundant feed line B connected, replayed {} subscriptions",
+                         name_, replay.size());
+        });
+
+        ws_client_b_->set_disconnect_callback([this](const std::string& reason) {
+            Logger::warn("[{}] Redundant feed line B disconnected: {}", name_, reason);
+        });
+
+        ws_client_b_->connect(url);
+    }
+
+    void stop_redundant_feed() {
+        if (ws_client_b_) {
+            ws_client_b_->disconnect();
+        }
+    }
+
+    // Redundant-feed gate: true when this update must be processed. Call it
+    // before any state mutation so late copies from the slower line cannot
+    // roll a book or BBO cache back. Always true on single-line venues.
+    bool accept_feed_update(uint64_t key, uint64_t version, std::string_view frame) {
+        if (!feed_arbiter_) {
+            return true;
+        }
+        const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        return feed_arbiter_->offer(key, version, frame, current_feed_line_, now_ns) ==
+               network::FeedVerdict::First;
+    }
+
     // WebSocket message handler (to be overridden)
     virtual void on_ws_message(std::string_view message) = 0;
     virtual void on_ws_connected() = 0;
@@ -359,6 +1015,14 @@ public:
 
     // Close short position
     virtual Order close_short(const SymbolId& symbol, Quantity quantity) = 0;
+
+    // IOC limit variants of open_short/close_short (see supports_ioc())
+    virtual Order open_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) {
+        return place_ioc_order(symbol, Side::Sell, quantity, limit_price);
+    }
+    virtual Order close_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) {
+        return place_ioc_order(symbol, Side::Buy, quantity, limit_price);
+    }
 };
 
 } // namespace kimp::exchange
@@ -24,12 +24,16 @@ namespace kimp::exchange::okx {
  */
 class OkxExchange : public ForeignShortExchangeBase {
 private:
+    // Public-stream silence before failover (bbo-tbt pushes on every BBO change)
+    static constexpr auto PUBLIC_WS_STALL_BUDGET = std::chrono::milliseconds(3000);
+
     simdjson::ondemand::parser json_parser_;
     simdjson::padded_string json_buffer_{8192};
     struct LotSize {
         double min_qty{0.0};
         double qty_step{0.0};
         double min_notional{0.0};
+        double tick_size{0.0};
     };
     std::unordered_map<std::string, LotSize> lot_size_cache_;
     mutable std::shared_mutex metadata_mutex_;
@@ -68,18 +72,24 @@ public:
 
     void subscribe_ticker(const std::vector<SymbolId>& symbols) override;
     void subscribe_orderbook(const std::vector<SymbolId>& symbols) override;
+    void add_market_subscriptions(const std::vector<SymbolId>& symbols) override;
 
     std::vector<SymbolId> get_available_symbols() override;
     std::vector<Ticker> fetch_all_tickers() override;
 
     Order place_market_order(const SymbolId& symbol, Side side, Quantity quantity) override;
     bool cancel_order(uint64_t order_id) override;
+    bool supports_ioc() const override { return true; }
+    Order place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) override;
 
     bool prepare_shorting(const SymbolId& symbol) override;
     std::vector<Position> get_short_positions() override;
     bool close_short_position(const SymbolId& symbol) override;
     Order open_short(const SymbolId& symbol, Quantity quantity) override;
     Order close_short(const SymbolId& symbol, Quantity quantity) override;
+    Order open_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) override;
+    Order close_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) override;
+    LookupReply lookup_client_order(Order& order) override { return lookup_cl_ord(order); }
 
     double get_balance(const std::string& currency) override;
     std::vector<AccountBalance> get_all_balances() override;
@@ -92,10 +102,16 @@ public:
     // Calls GET /api/v5/asset/currencies (requires auth).
     std::unordered_map<std::string, std::unordered_set<std::string>> fetch_deposit_networks();
 
+    // Fetch the account's hourly borrow rate per coin (fraction per hour).
+    // Calls GET /api/v5/account/interest-rate (requires auth).
+    std::unordered_map<std::string, double> fetch_borrow_rates();
+
 protected:
     void on_ws_message(std::string_view message) override;
     void on_ws_connected() override;
     void on_ws_disconnected() override;
+    bool fetch_server_time_ns(int64_t& server_ns) override;
+    int64_t venue_event_time_ms(std::string_view message) const override;
 
 private:
     // OKX: Base64(HMAC-SHA256(timestamp + method + requestPath + body, secret))
@@ -105,6 +121,8 @@ private:
                                    const std::string& body = "") const;
 
     std::string resolve_public_ws_endpoint() const;
+    // Batched orderbook subscribe requests for symbols (no list bookkeeping)
+    void send_orderbook_subscribe(const std::vector<SymbolId>& symbols);
 
     std::unordered_map<std::string, std::string> build_auth_headers(
         const std::string& method,
@@ -113,8 +131,20 @@ private:
 
     bool ensure_margin_mode();
     bool parse_ticker_message(std::string_view message, Ticker& ticker);
-    bool parse_order_response(const std::string& response, Order& order, std::string* order_id_out = nullptr);
+    // duplicate_id: set when the venue refused a clOrdId it already holds
+    bool parse_order_response(const std::string& response, Order& order, std::string* order_id_out = nullptr,
+                              bool* duplicate_id = nullptr);
+    // POST /api/v5/trade/order under order.client_id; unanswered submits are
+    // resolved by clOrdId and retried with it (order_submit.hpp)
+    void submit_order(const std::string& body, Order& order, const char* what);
+    LookupReply lookup_cl_ord(Order& order);
     double normalize_order_qty(const SymbolId& symbol, double qty, bool is_open) const;
+    // Limit price on the tick grid, never beyond the requested price
+    double normalize_limit_price(const SymbolId& symbol, double price, bool buy) const;
+    // limit_price 0 = market order
+    Order place_spot_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price);
+    Order open_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price);
+    Order close_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price);
 
     std::string symbol_to_okx(const SymbolId& symbol) const {
         return std::string(symbol.get_base()) + "-" + std::string(symbol.get_quote());
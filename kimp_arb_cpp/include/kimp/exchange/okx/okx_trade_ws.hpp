@@ -66,9 +66,12 @@ public:
      * OKX WS order format:
      *   {"id":"msgId","op":"order","args":[{"instId":"BTC-USDT","tdMode":"cross",
      *    "side":"sell","ordType":"market","sz":"0.001"}]}
+     * limit_price > 0 sends ordType "ioc" with px instead; a non-empty
+     * client_id goes out as clOrdId
      */
     Order place_order_sync(const std::string& inst_id, Side side, double qty,
-                           const std::string& td_mode);
+                           const std::string& td_mode, double limit_price = 0.0,
+                           const std::string& client_id = {});
 
 private:
     void authenticate();
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace kimp::exchange {
+
+// Order submit timeout and client-id retries (execution.order_submit section)
+struct OrderSubmitPolicy {
+    std::chrono::milliseconds timeout{10000};    // One submit or lookup request; past it the outcome is unknown
+    int attempts{3};                             // Submits sharing one client order id
+    std::chrono::milliseconds lookup_delay{50};  // Venue lag before asking for the client id
+};
+
+// Venue answer to one submit
+enum class SubmitReply : uint8_t {
+    Accepted,   // Acked: the order carries the venue id and ack status
+    Rejected,   // Refused: nothing exists under the client id
+    Duplicate,  // Client id already taken: an earlier attempt landed
+    Unknown     // No answer (timeout, dropped connection, 5xx): may or may not exist
+};
+
+// Venue answer to a lookup by client id
+enum class LookupReply : uint8_t { Found, NotFound, Unknown };
+
+struct SubmitOutcome {
+    SubmitReply reply{SubmitReply::Rejected};  // Accepted, Rejected, or Unknown when never resolved
+    int submits{0};
+    int lookups{0};
+    bool reconciled{false};  // Resolved by a client id lookup instead of the ack
+};
+
+/**
+ * Client order id: "kp" + session stamp + sequence, both base 36.
+ *
+ * The session stamp is the process start in ms, so ids stay unique across
+ * restarts (Upbit's identifier is unique for the account's lifetime). At
+ * most 23 alphanumerics, inside OKX clOrdId (32) and Bybit orderLinkId (36).
+ */
+inline std::string format_client_order_id(uint64_t sequence) {
+    static const uint64_t session = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    auto base36 = [](uint64_t v, std::string& out) {
+        char buf[16];
+        int n = 0;
+        do {
+            const auto digit = static_cast<int>(v % 36);
+            buf[n++] = static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+            v /= 36;
+        } while (v != 0);
+        while (n > 0) {
+            out.push_back(buf[--n]);
+        }
+    };
+    std::string id = "kp";
+    base36(session, id);
+    base36(sequence, id);
+    return id;
+}
+
+/**
+ * Submit order under order.client_id until the venue's answer is known.
+ *
+ * Every attempt reuses the client id, so the venue accepts at most one of
+ * them: a retry after a dropped response comes back Duplicate instead of a
+ * second order. Whenever a submit goes unanswered (or is a Duplicate) the
+ * venue is asked for the client id before the next attempt:
+ *
+ * - Found: the earlier attempt landed; lookup has filled in the order
+ * - NotFound / Unknown: submit again with the same id
+ *
+ * The last lookup decides: NotFound settles Rejected (venue receive windows
+ * bound how late a lost copy can still land), anything else stays Unknown
+ * with order.status Unknown: the order may be live, so the caller must
+ * resolve it by client id before sending the leg again.
+ *
+ * submit(Order&) -> SubmitReply sets status and venue id on Accepted;
+ * lookup(Order&) -> LookupReply does the same on Found.
+ */
+template <typename Submit, typename Lookup>
+SubmitOutcome submit_idempotent(const OrderSubmitPolicy& policy, Order& order, Submit&& submit, Lookup&& lookup) {
+    SubmitOutcome out;
+    const int attempts = std::max(1, policy.attempts);
+    LookupReply last = LookupReply::Unknown;
+
+    for (int attempt = 0; attempt < attempts; ++attempt) {
+        ++out.submits;
+        const SubmitReply reply = submit(order);
+        if (reply == SubmitReply::Accepted || reply == SubmitReply::Rejected) {
+            out.reply = reply;
+            return out;
+        }
+
+        if (policy.lookup_delay.count() > 0) {
+            std::this_thread::sleep_for(policy.lookup_delay);
+        }
+        ++out.lookups;
+        last = lookup(order);
+        if (last == LookupReply::Found) {
+            out.reconciled = true;
+            out.reply = order.status == OrderStatus::Rejected ? SubmitReply::Rejected : SubmitReply::Accepted;
+            return out;
+        }
+        if (reply == SubmitReply::Duplicate) {
+            last = LookupReply::Unknown;  // The venue holds it; its order index lags
+        }
+    }
+
+    out.reply = last == LookupReply::NotFound ? SubmitReply::Rejected : SubmitReply::Unknown;
+    order.status = out.reply == SubmitReply::Rejected ? OrderStatus::Rejected : OrderStatus::Unknown;
+    return out;
+}
+
+} // namespace kimp::exchange
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "kimp/exchange/exchange_base.hpp"
+#include "kimp/memory/grow_only_map.hpp"
+#include "kimp/exchange/upbit/upbit_fee_collector.hpp"
 #include "kimp/core/optimization.hpp"
 
 #include <simdjson.h>
 #include <map>
+#include <unordered_set>
 #include <condition_variable>
 #include <thread>
 
@@ -17,10 +20,15 @@ namespace kimp::exchange::upbit {
  * - KRW spot markets (Korean exchange)
  * - WebSocket for real-time orderbook data (gzip-compressed binary frames)
  * - REST API for available markets (/v1/market/all)
+ * - Private myOrder stream (JWT handshake) caching the cumulative fill of
+ *   resting orders, so post-only bids are tracked without REST polling
  * - Symbol format: "KRW-BTC" (quote-base)
  */
 class UpbitExchange : public KoreanExchangeBase {
 private:
+    // Public-stream silence before failover (KRW books are thinner)
+    static constexpr auto PUBLIC_WS_STALL_BUDGET = std::chrono::milliseconds(5000);
+
     std::atomic<double> usdt_krw_price_{0.0};
 
     // Store subscribed symbols for reconnection
@@ -28,37 +36,55 @@ private:
     std::vector<SymbolId> subscribed_orderbooks_;
     std::mutex subscription_mutex_;
 
-    // Lock-free BBO cache for hot ticker path
+    // Lock-free BBO cache for hot ticker path (insert-only: new listings add entries)
     struct BBO {
         std::atomic<double> best_bid{0.0};
         std::atomic<double> best_ask{0.0};
         std::atomic<double> best_bid_qty{0.0};
         std::atomic<double> best_ask_qty{0.0};
     };
-    std::unordered_map<SymbolId, BBO> orderbook_bbo_;
+    static constexpr std::size_t MAX_BBO_SYMBOLS = 1024;
+    memory::GrowOnlyMap<SymbolId, BBO, MAX_BBO_SYMBOLS> orderbook_bbo_;
 
     // Cache last known ticker price per symbol
     std::unordered_map<SymbolId, double> last_price_cache_;
     std::mutex last_price_mutex_;
 
-    // Decompression buffer for gzip WebSocket frames
-    std::vector<char> decompress_buf_;
-
     // Periodic REST snapshot overlay to prevent stale/incorrect BBO drift.
     std::atomic<bool> orderbook_resync_running_{false};
     std::thread orderbook_resync_thread_;
 
+    // Withdrawal-fee collection shares the Exchange API budget
+    WithdrawFeeCollector fee_collector_;
+
+    // myOrder stream: latest cumulative state per order uuid. Only watched
+    // (resting) orders are kept to the end; the stream also reports every
+    // market and IOC order, which are dropped on their terminal state, or
+    // after ORDER_UPDATE_TTL when that frame never comes
+    std::shared_ptr<network::WebSocketClient> private_ws_;
+    std::atomic<bool> private_ws_authenticated_{false};
+    struct OrderUpdate {
+        std::string state;  // wait / watch / trade / done / cancel
+        double filled_qty{0.0};
+        double avg_price{0.0};
+        std::chrono::steady_clock::time_point seen{};
+    };
+    static constexpr auto ORDER_UPDATE_TTL = std::chrono::seconds(60);
+    std::mutex order_updates_mutex_;
+    std::unordered_map<std::string, OrderUpdate> order_updates_;
+    std::unordered_set<std::string> watched_orders_;
+    std::chrono::steady_clock::time_point order_updates_swept_{};
+
 public:
     UpbitExchange(net::io_context& ioc, ExchangeCredentials creds)
-        : KoreanExchangeBase(Exchange::Upbit, MarketType::Spot, "Upbit", ioc, std::move(creds)) {
-        decompress_buf_.resize(65536);
-    }
+        : KoreanExchangeBase(Exchange::Upbit, MarketType::Spot, "Upbit", ioc, std::move(creds)) {}
 
     bool connect() override;
     void disconnect() override;
 
     void subscribe_ticker(const std::vector<SymbolId>& symbols) override;
     void subscribe_orderbook(const std::vector<SymbolId>& symbols) override;
+    void add_market_subscriptions(const std::vector<SymbolId>& symbols) override;
 
     std::vector<SymbolId> get_available_symbols() override;
     std::vector<Ticker> fetch_all_tickers() override;
@@ -67,15 +93,35 @@ public:
     Order place_market_order(const SymbolId& symbol, Side side, Quantity quantity) override;
     Order place_market_buy_cost(const SymbolId& symbol, Price cost) override;
     bool cancel_order(uint64_t order_id) override;
+    bool supports_ioc() const override { return true; }
+    Order place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) override;
+    bool supports_post_only() const override { return true; }
+    Order place_post_only_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) override;
+    LookupReply lookup_client_order(Order& order) override { return lookup_identifier(order); }
 
     double get_balance(const std::string& currency) override;
     std::vector<AccountBalance> get_all_balances() override;
     bool query_order_detail(const std::string& order_id, Order& order);
+    // One GET of the order's current state (no waiting for a terminal state)
+    bool refresh_order(const std::string& order_id, Order& order, std::string* state = nullptr);
+    // DELETE /v1/order; false when the venue refused (e.g. already done)
+    bool cancel_order_uuid(const std::string& order_id);
+    // Latest myOrder state of an order into filled_quantity / average_price;
+    // false when the stream has not reported it (or dropped since)
+    bool stream_order_update(const std::string& order_id, Order& order, std::string* state = nullptr);
+    // Keep the order's stream state until forget_order_update(); resting
+    // post-only orders are watched on placement
+    void watch_order_update(const std::string& order_id);
+    // Drop a finished order from the stream cache
+    void forget_order_update(const std::string& order_id);
 
 protected:
     void on_ws_message(std::string_view message) override;
     void on_ws_connected() override;
     void on_ws_disconnected() override;
+    bool fetch_server_time_ns(int64_t& server_ns) override;
+    int64_t venue_event_time_ms(std::string_view message) const override;
+    void on_private_ws_message(std::string_view message);
 
 private:
     // Decompress gzip data from WebSocket binary frames
@@ -90,6 +136,7 @@ private:
     void fetch_orderbook_snapshots(const std::vector<SymbolId>& symbols);
     void start_orderbook_resync_loop();
     void stop_orderbook_resync_loop();
+    void subscribe_private_myorder();
 
     std::string symbol_to_upbit(const SymbolId& symbol) const {
         return std::string(symbol.get_quote()) + "-" + std::string(symbol.get_base());
@@ -99,14 +146,24 @@ private:
     std::string generate_jwt_token() const;
     std::string generate_jwt_token_with_query(const std::string& query_string) const;
 
+    // POST /v1/orders with order.client_id as identifier (query and body
+    // already carry it); unanswered submits are resolved by identifier and
+    // retried with it (order_submit.hpp). False unless accepted: order.status
+    // then tells Rejected (nothing placed) from Unknown (may be live)
+    bool submit_order(const std::string& query, const std::string& body, Order& order, const char* what);
+    LookupReply lookup_identifier(Order& order);
+
 public:
     // Fetch per-network withdrawal fees for given coins.
     // Step 1: GET /v1/status/wallet → discover net_types per coin.
-    // Step 2: GET /v1/withdraws/chance per (coin, net_type) → extract fee.
+    // Step 2: GET /v1/withdraws/chance per (coin, net_type) → extract fee,
+    //         concurrently under the Exchange API rate limit; coins cached
+    //         within the TTL with unchanged net_types are skipped.
     // Returns {coin → [{network, fee_coins}]}.
-    struct NetworkFee { std::string network; double fee_coins{0.0}; };
+    using NetworkFee = WithdrawFeeCollector::NetworkFee;
     std::unordered_map<std::string, std::vector<NetworkFee>> fetch_withdrawal_fees(
         const std::vector<std::string>& coins);
+    const WithdrawFeeCollector& withdraw_fee_collector() const { return fee_collector_; }
 };
 
 } // namespace kimp::exchange::upbit
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "kimp/exchange/exchange_base.hpp"
+#include "kimp/network/token_bucket.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kimp::exchange::upbit {
+
+/**
+ * Concurrent, rate-aware collector for Upbit /v1/withdraws/chance fees
+ *
+ * Features:
+ * - One job per (coin, net_type); a small worker pool drains the jobs
+ * - Every request takes a token from a bucket sized below Upbit's
+ *   Exchange API limit (30 req/s per account)
+ * - Remaining-Req "sec=" feedback clamps the local budget; a 429 pauses
+ *   all workers for the rest of the window and retries the job; a 418
+ *   (temporary ban) stops the collection
+ * - Per-coin TTL cache: a coin whose net_type set is unchanged and whose
+ *   fees are younger than the TTL is not queried again; a coin whose
+ *   refresh fails keeps serving its last known fees
+ */
+class WithdrawFeeCollector {
+public:
+    struct NetworkFee { std::string network; double fee_coins{0.0}; };
+    using FeeMap = std::unordered_map<std::string, std::vector<NetworkFee>>;
+
+    struct Options {
+        double requests_per_sec{25.0};  // Headroom under the published 30/s
+        double burst{5.0};
+        std::size_t workers{4};         // Matches the REST connection pool size
+        std::chrono::seconds ttl{std::chrono::hours(2)};
+        int max_attempts{4};
+        std::chrono::milliseconds throttle_pause{1000};  // Upbit windows are per second
+    };
+
+    // Coin plus the withdraw-open net_types from /v1/status/wallet
+    // (empty = query the default endpoint without net_type)
+    struct CoinNetworks {
+        std::string coin;
+        std::vector<std::string> net_types;
+    };
+
+    struct Stats {
+        std::size_t coins{0};
+        std::size_t cache_hits{0};
+        std::size_t fetched{0};
+        std::size_t stale_served{0};  // Refresh failed, last known fees kept
+        uint64_t requests{0};
+        uint64_t throttled{0};        // 429 responses
+        bool banned{false};           // 418: collection stopped early
+        int64_t elapsed_ms{0};
+        std::vector<std::string> failed_coins;  // No fees at all
+    };
+
+    // Issues GET /v1/withdraws/chance for (coin, net_type); empty net_type
+    // means the default endpoint. Encoding and signing are the caller's job.
+    using RequestFn = std::function<HttpResponse(const std::string& coin, const std::string& net_type)>;
+
+    WithdrawFeeCollector() : WithdrawFeeCollector(Options{}) {}
+    explicit WithdrawFeeCollector(Options options);
+
+    FeeMap collect(const std::vector<CoinNetworks>& coins, const RequestFn& request);
+
+    // For other calls that share the Exchange API budget (wallet status)
+    network::TokenBucket& bucket() noexcept { return bucket_; }
+    void observe_response(const HttpResponse& response);
+
+    Stats last_stats() const;
+    const Options& options() const noexcept { return options_; }
+
+    // "group=default; min=1799; sec=29" -> 29
+    static std::optional<int> remaining_req_sec(const HttpResponse& response);
+    static bool parse_withdraw_fee(const std::string& body, double& fee);
+    static std::string normalize_network(std::string_view raw);
+
+private:
+    struct CacheEntry {
+        std::string signature;  // Sorted net_types the fees were fetched for
+        std::vector<NetworkFee> fees;
+        std::chrono::steady_clock::time_point fetched_at;
+    };
+
+    Options options_;
+    network::TokenBucket bucket_;
+    std::mutex collect_mutex_;  // One collect() at a time
+    mutable std::mutex mutex_;  // Guards cache_ and stats_
+    std::unordered_map<std::string, CacheEntry> cache_;
+    Stats stats_;
+};
+
+} // namespace kimp::exchange::upbit
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+#include "kimp/exchange/exchange_base.hpp"
+#include "kimp/network/token_bucket.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace kimp::execution {
+
+/**
+ * Trading accounts per venue, for sharding lifecycles across API keys
+ *
+ * Features:
+ * - Account 0 is the venue's main connector; more accounts bring their own
+ *   connector (REST client, signer, trade and private streams)
+ * - Balance view per account in the venue's quote currency (KRW on Korean
+ *   venues, USDT abroad), refreshed off the hot path
+ * - Order budget per account paced like the venue's per-key order limit
+ * - assign() picks the account with the most balance not already reserved
+ *   by open lifecycles, among those with order budget left
+ *
+ * Accounts are added before trading starts; the rest is thread-safe.
+ */
+class AccountPool {
+public:
+    using ExchangePtr = std::shared_ptr<exchange::IExchange>;
+    static constexpr std::size_t MAX_ACCOUNTS = 8;
+
+    struct Options {
+        double order_rate_per_sec{10.0};  // Per-key order limit of the venue
+        double order_burst{20.0};
+    };
+
+    struct AccountStats {
+        uint8_t account{0};
+        double balance{0.0};       // Quote currency, last refresh
+        double reserved{0.0};      // Held for open lifecycles
+        int lifecycles{0};
+        double order_budget{0.0};  // Orders that could go out now
+        uint64_t orders{0};
+    };
+
+    // Account 0; replaces the connector and budget of an existing one
+    void set_primary(Exchange ex, ExchangePtr exchange, const Options& options);
+    void set_primary(Exchange ex, ExchangePtr exchange) { set_primary(ex, std::move(exchange), Options{}); }
+    // Index of the new account, or -1 when the venue has no main account or is full
+    int add(Exchange ex, ExchangePtr exchange, const Options& options);
+    int add(Exchange ex, ExchangePtr exchange) { return add(ex, std::move(exchange), Options{}); }
+
+    std::size_t count(Exchange ex) const noexcept;
+    ExchangePtr exchange(Exchange ex, uint8_t account) const noexcept;  // Null for unknown accounts
+
+    void set_balance(Exchange ex, uint8_t account, double balance);
+    // get_balance(quote) on every account of every venue; failures keep the last value
+    void refresh_balances();
+
+    // Account for a new lifecycle needing notional (quote currency); reserves it
+    uint8_t assign(Exchange ex, double notional);
+    // Re-attaches a recovered lifecycle to the account holding it
+    void reserve(Exchange ex, uint8_t account, double notional);
+    void release(Exchange ex, uint8_t account, double notional);
+    // One order sent from account; false once it runs past its budget
+    bool consume_order(Exchange ex, uint8_t account);
+
+    std::vector<AccountStats> stats(Exchange ex) const;
+
+private:
+    struct Account {
+        Account(ExchangePtr ex, const Options& options)
+            : exchange(std::move(ex)), budget(options.order_rate_per_sec, options.order_burst) {}
+        ExchangePtr exchange;
+        network::TokenBucket budget;
+        double balance{0.0};
+        double reserved{0.0};
+        int lifecycles{0};
+        std::atomic<uint64_t> orders{0};
+    };
+    using Venue = std::array<std::shared_ptr<Account>, MAX_ACCOUNTS>;
+
+    std::shared_ptr<Account> account(Exchange ex, uint8_t index) const noexcept;
+
+    std::array<Venue, static_cast<std::size_t>(Exchange::Count)> venues_{};
+    std::array<std::atomic<std::size_t>, static_cast<std::size_t>(Exchange::Count)> counts_{};
+    mutable std::mutex mutex_;  // Balances and reservations
+};
+
+} // namespace kimp::execution
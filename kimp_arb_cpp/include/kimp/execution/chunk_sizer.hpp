@@ -0,0 +1,122 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace kimp::execution {
+
+struct ChunkSizerConfig {
+    double base_usd{TradingConfig::TARGET_ENTRY_USDT};        // Fixed-chunk size; cold-start size
+    double max_usd{TradingConfig::TARGET_ENTRY_USDT * 8.0};   // Ceiling on a grown chunk
+    double min_scale{0.5};             // Thinnest-edge chunk as a fraction of base_usd
+    double depth_fraction{0.5};        // Share of the thinner visible top level one chunk may take
+    double edge_cushion{3.0};          // Edge / drift ratio that sizes a chunk at base_usd
+    double round_trip_alpha{0.2};      // EWMA weight of a new split round trip
+    double volatility_alpha{0.1};      // EWMA weight of a new premium variance sample
+    double default_round_trip_ms{150.0};
+    uint32_t warmup_quotes{8};         // Premium samples before the edge term kicks in
+};
+
+/**
+ * Per-split notional for the spot-relay loops
+ *
+ * A chunk runs both legs back to back and then waits for the next market
+ * update, so its size trades round trips against exposure:
+ * - drift: expected premium move (1 sigma) over one split round trip,
+ *   from an EWMA of premium variance per ms and the measured round trip
+ * - edge / drift scales the base chunk: wide edge grows it (up to
+ *   max_usd), an edge inside the noise shrinks it (down to min_scale)
+ * - the result never takes more than depth_fraction of the thinner visible
+ *   top level; without depth on both legs it never grows past base_usd
+ *
+ * Not thread-safe; one instance per execution loop.
+ */
+class ChunkSizer {
+public:
+    struct Inputs {
+        double remaining_usd{0.0};       // Notional still to enter / exit
+        double korean_depth_usd{0.0};    // Visible top level on the Korean leg (0 = unknown)
+        double foreign_depth_usd{0.0};   // Visible top level on the foreign leg (0 = unknown)
+        double edge_pct{0.0};            // Premium beyond the trade threshold
+    };
+
+    struct Decision {
+        double usd{0.0};
+        double scale{1.0};               // Edge term before the depth cap
+        double drift_pct{0.0};           // 0 while warming up
+        double depth_cap_usd{0.0};       // 0 = no depth on both legs
+    };
+
+    explicit ChunkSizer(ChunkSizerConfig config = {}, double round_trip_ms = 0.0) noexcept
+        : config_(config)
+        , round_trip_ms_(round_trip_ms > 0.0 ? round_trip_ms : config.default_round_trip_ms) {}
+
+    // Premium sample of the traded pair (steady clock)
+    void observe_premium(double premium_pct, int64_t now_ns) noexcept {
+        if (last_ns_ != 0 && now_ns > last_ns_) {
+            const double dt_ms = static_cast<double>(now_ns - last_ns_) / 1e6;
+            const double move = premium_pct - last_premium_;
+            const double sample = move * move / std::max(dt_ms, 1.0);
+            variance_per_ms_ = samples_ == 0
+                ? sample
+                : variance_per_ms_ + config_.volatility_alpha * (sample - variance_per_ms_);
+            ++samples_;
+        }
+        last_premium_ = premium_pct;
+        last_ns_ = now_ns;
+    }
+
+    // Wall time of one completed split (both legs and their fill queries)
+    void observe_round_trip(double ms) noexcept {
+        if (ms <= 0.0) {
+            return;
+        }
+        round_trip_ms_ += config_.round_trip_alpha * (ms - round_trip_ms_);
+    }
+
+    double round_trip_ms() const noexcept { return round_trip_ms_; }
+    bool warm() const noexcept { return samples_ >= config_.warmup_quotes; }
+
+    double drift_pct() const noexcept {
+        return warm() ? std::sqrt(variance_per_ms_ * round_trip_ms_) : 0.0;
+    }
+
+    Decision size(const Inputs& in) const noexcept {
+        Decision out;
+        if (in.remaining_usd <= 0.0 || config_.base_usd <= 0.0) {
+            return out;
+        }
+
+        const double max_scale = std::max(1.0, config_.max_usd / config_.base_usd);
+        if (warm()) {
+            out.drift_pct = drift_pct();
+            const double ratio = in.edge_pct / std::max(out.drift_pct, 1e-6);
+            out.scale = std::clamp(ratio / config_.edge_cushion, config_.min_scale, max_scale);
+        }
+
+        double target = config_.base_usd * out.scale;
+        if (in.korean_depth_usd > 0.0 && in.foreign_depth_usd > 0.0) {
+            const double top = std::min(in.korean_depth_usd, in.foreign_depth_usd);
+            // A top level that covers the base chunk keeps covering it
+            out.depth_cap_usd = std::max(config_.depth_fraction * top, std::min(config_.base_usd, top));
+            target = std::min(target, out.depth_cap_usd);
+        } else {
+            target = std::min(target, config_.base_usd);
+        }
+        out.usd = std::min(target, in.remaining_usd);
+        return out;
+    }
+
+private:
+    ChunkSizerConfig config_;
+    double round_trip_ms_;
+    double variance_per_ms_{0.0};    // Premium variance (pct^2) per ms
+    double last_premium_{0.0};
+    int64_t last_ns_{0};
+    uint32_t samples_{0};
+};
+
+} // namespace kimp::execution
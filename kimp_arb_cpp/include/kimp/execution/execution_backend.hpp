@@ -0,0 +1,52 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+namespace kimp::execution {
+
+/**
+ * Venue-level order routing used by OrderManager's single-order helpers.
+ *
+ * OrderManager talks to the exchange connectors directly by default; an
+ * installed backend takes over every submit and fill query of the spot
+ * relay lifecycle (entry, exit, rollback and hedge corrections), so the
+ * same loop can run against simulated venues.
+ */
+class ExecutionBackend {
+public:
+    virtual ~ExecutionBackend() = default;
+
+    // Korean spot legs. krw_amount is the cost hint for cost-based market buys
+    virtual Order korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount) = 0;
+    virtual Order korean_sell(Exchange ex, const SymbolId& symbol, double quantity) = 0;
+
+    // Foreign spot-margin short legs (symbol is the USDT market)
+    virtual Order foreign_short(Exchange ex, const SymbolId& symbol, double quantity) = 0;
+    virtual Order foreign_cover(Exchange ex, const SymbolId& symbol, double quantity) = 0;
+
+    // Price-protected immediate-or-cancel limits: fill what crosses
+    // limit_price now, cancel the rest. The ack is accepted even when nothing
+    // crossed; the fill query reports the (possibly zero) filled quantity
+    virtual Order korean_buy_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) = 0;
+    virtual Order korean_sell_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) = 0;
+    virtual Order foreign_short_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) = 0;
+    virtual Order foreign_cover_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) = 0;
+    // Venues taking IOC limits; the lifecycle sends market orders elsewhere
+    virtual bool supports_ioc(Exchange ex) const = 0;
+
+    // Post-only maker limit on a Korean venue: rejected when it would cross,
+    // otherwise acked New and left resting. poll_resting refreshes the
+    // cumulative filled_quantity / average_price in place and returns false
+    // once nothing rests any more; after cancel_resting the fill is final
+    virtual Order korean_post_only(Exchange ex, const SymbolId& symbol, Side side, double quantity,
+                                   double limit_price) = 0;
+    virtual bool poll_resting(Exchange ex, Order& order) = 0;
+    virtual bool cancel_resting(Exchange ex, Order& order) = 0;
+    virtual bool supports_post_only(Exchange ex) const = 0;
+
+    // Resolve filled quantity and average price of a submitted order in place
+    virtual void query_korean_fill(Exchange ex, const SymbolId& symbol, Order& order) = 0;
+    virtual void query_foreign_fill(Exchange ex, Order& order) = 0;
+};
+
+} // namespace kimp::execution
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace kimp::execution {
+
+enum class FillAction : uint8_t {
+    Entry = 0,
+    Exit,
+    Reentry,
+};
+
+enum class FillLeg : uint8_t {
+    Foreign = 0,
+    Korean,
+};
+
+/**
+ * One filled leg of one split, keyed by the lifecycle trace id
+ *
+ * Fixed 128-byte record appended to trade_logs/fill_quality.bin after a
+ * FILL_QUALITY_MAGIC header. Times are system clock ns. Prices are in the
+ * leg's quote currency (KRW on the Korean leg, USDT on the foreign leg).
+ */
+struct FillQualityRecord {
+    uint64_t trace_id{0};
+    uint64_t decision_ns{0};          // Split decided on decision_price
+    uint64_t send_ns{0};              // Order submitted
+    uint64_t ack_ns{0};               // Submit acknowledged
+    uint64_t fill_ns{0};              // Fill confirmed; fill_quote_price sampled here
+    double decision_premium_pct{0.0};
+    double decision_price{0.0};       // Touch on the leg's side (ask for buys, bid for sells)
+    double fill_quote_price{0.0};     // Same touch at fill time (0 = unknown)
+    double fill_price{0.0};
+    double fill_qty{0.0};
+    double usdt_krw{0.0};             // Converts Korean-leg notional to USD
+    std::array<char, 24> symbol{};
+    FillAction action{FillAction::Entry};
+    FillLeg leg{FillLeg::Foreign};
+    Exchange venue{};
+    Exchange counter_venue{};
+    Side side{};
+    uint8_t reserved[11]{};
+
+    // Cost vs the decision quote, positive = worse than decided
+    double slippage_bps() const noexcept;
+    // Part of the slippage explained by the touch moving before the fill
+    double drift_bps() const noexcept;
+    double notional_usd() const noexcept;
+};
+static_assert(sizeof(FillQualityRecord) == 128, "fill quality records are fixed 128 bytes");
+
+inline constexpr std::array<char, 8> FILL_QUALITY_MAGIC{'K', 'F', 'Q', 'L', 'O', 'G', '0', '1'};
+
+enum class FillGroup : uint8_t {
+    Venue,
+    Pair,
+    Symbol,
+};
+
+struct FillQualityRow {
+    std::string key;
+    std::size_t legs{0};
+    double notional_usd{0.0};
+    double slippage_bps{0.0};         // Notional-weighted
+    double drift_bps{0.0};            // Latency-attributed share of slippage_bps
+    double impact_bps{0.0};           // Book walk / fee-less remainder
+    double slippage_usd{0.0};
+    double drift_usd{0.0};
+    double avg_ack_ms{0.0};
+    double avg_decision_to_fill_ms{0.0};
+};
+
+// Appends records (writes the header into an empty file); false on I/O error
+bool append_fill_quality(const std::string& path, const std::vector<FillQualityRecord>& records);
+
+// Reads a whole log; false (with error) on a missing file or bad header
+bool read_fill_quality(const std::string& path, std::vector<FillQualityRecord>& out,
+                       std::string* error = nullptr);
+
+// Rows sorted by slippage_usd, worst first
+std::vector<FillQualityRow> summarize_fill_quality(const std::vector<FillQualityRecord>& records,
+                                                   FillGroup group);
+
+// Per venue / pair / symbol tables for the --fill-report tool
+std::string format_fill_quality_report(const std::vector<FillQualityRecord>& records);
+
+} // namespace kimp::execution
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace kimp::execution {
+
+// One child order of a routed Korean leg
+struct KoreanRouteLeg {
+    Exchange exchange{Exchange::Bithumb};
+    double quantity{0.0};
+    double notional_krw{0.0};   // Price x quantity over the walked levels
+    double fee_krw{0.0};
+    double worst_price{0.0};    // Deepest level touched
+};
+
+struct KoreanRoute {
+    std::array<KoreanRouteLeg, 2> legs{};  // [0] primary (the signal's venue), [1] the other Korean venue
+    double total_krw{0.0};         // Buy: cost incl. fees; sell: proceeds net of fees
+    double single_venue_krw{0.0};  // Same objective with the primary venue alone (0 = it cannot take the size)
+    double beyond_depth{0.0};      // Quantity past both visible books, priced at the last level
+
+    bool buy{true};
+
+    bool split() const noexcept { return legs[0].quantity > 0.0 && legs[1].quantity > 0.0; }
+    double quantity() const noexcept { return legs[0].quantity + legs[1].quantity; }
+    // KRW saved (buy) or gained (sell) against routing everything to the primary
+    double gain_krw() const noexcept {
+        if (single_venue_krw <= 0.0) {
+            return 0.0;
+        }
+        return buy ? single_venue_krw - total_krw : total_krw - single_venue_krw;
+    }
+};
+
+/**
+ * Smart order routing for the Korean spot leg across Bithumb and Upbit
+ *
+ * Features:
+ * - Walks both venues' depth best-first by fee-adjusted price and splits the
+ *   quantity to minimize KRW cost (buy) or maximize KRW proceeds (sell);
+ *   costs are piecewise linear and convex, so the greedy merge is optimal
+ * - Per-venue quantity caps (coins held on each venue when selling)
+ * - A child below the venue minimum order is folded into the other venue
+ * - Latest depth per (Korean venue, symbol) from the orderbook feed, with a
+ *   freshness limit; the lifecycle falls back to the signal's venue alone
+ *   when either book is missing or stale
+ */
+class KoreanLegRouter {
+public:
+    struct Options {
+        uint64_t max_book_age_ms{1000};                   // Older depth is not routed on
+        double min_child_krw{TradingConfig::MIN_ORDER_KRW};
+        double min_gain_krw{0.0};                         // Split only when it saves more than this
+        double max_price_gap_bps{5.0};                    // Other venue's top counts as entry depth within this
+    };
+
+    struct VenueBook {
+        Exchange exchange{Exchange::Bithumb};
+        const OrderBookLevel* levels{nullptr};  // Best-first (asks for a buy, bids for a sell)
+        std::size_t count{0};
+        double fee_rate{0.0};
+        double max_quantity{std::numeric_limits<double>::infinity()};
+    };
+
+    KoreanLegRouter() = default;
+    explicit KoreanLegRouter(const Options& options) : options_(options) {}
+
+    const Options& options() const noexcept { return options_; }
+
+    // Depth feed; non-Korean books are ignored
+    void on_orderbook(const OrderBook& book);
+    // Latest depth if younger than max_book_age_ms
+    bool book(Exchange ex, const SymbolId& symbol, OrderBook& out) const;
+
+    // Route over the live books; nullopt when either book is unusable.
+    // Caps bound the coins taken from each venue (infinite when buying).
+    std::optional<KoreanRoute> route(Exchange primary, const SymbolId& symbol, double quantity, bool buy,
+                                     double primary_cap = std::numeric_limits<double>::infinity(),
+                                     double secondary_cap = std::numeric_limits<double>::infinity()) const;
+
+    // Coins the other venue offers no worse than the primary's fee-adjusted
+    // ask plus max_price_gap_bps, summed over its levels; 0 without depth
+    double secondary_top_ask_qty(Exchange primary, const SymbolId& symbol, double primary_ask) const;
+
+    static KoreanRoute plan(const VenueBook& primary, const VenueBook& secondary, double quantity, bool buy,
+                            double min_child_krw = TradingConfig::MIN_ORDER_KRW);
+
+    // Split by inventory alone when no depth is available: the other venue
+    // is drained first so the position collapses back onto the primary
+    static KoreanRoute inventory_split(Exchange primary, Exchange secondary, double quantity,
+                                       double primary_cap, double secondary_cap);
+
+    // Sell back part of one split in proportion to where its coins landed; a
+    // child under min_child_qty joins the other venue when that one holds enough
+    static KoreanRoute proportional_split(Exchange primary, Exchange secondary, double quantity,
+                                          double primary_held, double secondary_held, double min_child_qty = 0.0);
+
+    static Exchange other_venue(Exchange ex) noexcept {
+        return ex == Exchange::Upbit ? Exchange::Bithumb : Exchange::Upbit;
+    }
+
+private:
+    static constexpr std::size_t VENUES = static_cast<std::size_t>(Exchange::Count);
+
+    Options options_;
+    mutable std::mutex books_mutex_;
+    std::array<std::unordered_map<SymbolId, OrderBook>, VENUES> books_;
+};
+
+} // namespace kimp::execution
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "kimp/core/price_format.hpp"
+#include "kimp/core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace kimp::execution {
+
+struct MakerQuoterConfig {
+    double edge_buffer_pct{0.02};  // Net edge kept above MIN_NET_EDGE_PCT at the resting price
+    double reprice_bps{3.0};       // Re-quote when the target drifts this far from the resting price
+};
+
+/**
+ * Post-only bid for the Korean entry leg
+ *
+ * - ceiling: highest Korean price at which the chunk still clears the entry
+ *   gate against the current foreign bid (net edge above MIN_NET_EDGE_PCT
+ *   plus a buffer, and MIN_ENTRY_NET_PROFIT_KRW), with the Korean maker fee
+ *   and the relay's foreign fee events
+ * - quote: one tick above the best bid for queue priority, capped by the
+ *   ceiling and kept under the best ask so it never crosses; no quote when
+ *   the ceiling is below the best bid
+ * - decide: cancel when no quote is left, re-quote when the ceiling falls
+ *   under the resting price or the target drifts by reprice_bps
+ *
+ * Stateless apart from its configuration; safe to share.
+ */
+class MakerQuoter {
+public:
+    enum class Action : uint8_t { Keep, Reprice, Cancel };
+
+    MakerQuoter(MakerQuoterConfig config, double korean_fee_rate, double foreign_fee_rate) noexcept
+        : config_(config), korean_fee_rate_(korean_fee_rate), foreign_fee_rate_(foreign_fee_rate) {}
+
+    const MakerQuoterConfig& config() const noexcept { return config_; }
+
+    // KRW per coin; 0 when the foreign side cannot carry the chunk
+    double ceiling(double foreign_bid, double usdt_krw, double quantity) const noexcept {
+        if (foreign_bid <= 0.0 || usdt_krw <= 0.0 || quantity <= 0.0) {
+            return 0.0;
+        }
+        const double sell = foreign_bid * usdt_krw;
+        const double foreign_fees = sell * foreign_fee_rate_ * TradingConfig::FOREIGN_FEE_EVENTS;
+        // Per coin: basis = price * (1 + korean fee) + foreign fees, edge = sell / basis - 1
+        const double edge = (TradingConfig::MIN_NET_EDGE_PCT + config_.edge_buffer_pct) / 100.0;
+        const double by_edge = sell / (1.0 + edge) - foreign_fees;
+        const double by_profit = sell - foreign_fees - TradingConfig::MIN_ENTRY_NET_PROFIT_KRW / quantity;
+        return std::max(0.0, std::min(by_edge, by_profit) / (1.0 + korean_fee_rate_));
+    }
+
+    // Resting buy price on the KRW tick grid; 0 = no quote
+    static double quote(double korean_bid, double korean_ask, double ceiling) noexcept {
+        if (korean_bid <= 0.0 || korean_ask <= korean_bid || ceiling < korean_bid) {
+            return 0.0;
+        }
+        const double tick = format::krw_tick_size(korean_bid);
+        double price = format::round_limit_to_tick(std::min(korean_bid + tick, ceiling), tick, true);
+        if (price >= korean_ask) {
+            price = korean_ask - tick;
+        }
+        return price >= korean_bid - tick * 1e-6 ? price : 0.0;
+    }
+
+    Action decide(double resting_price, double target, double ceiling) const noexcept {
+        if (target <= 0.0) {
+            return Action::Cancel;
+        }
+        if (resting_price > ceiling) {
+            return Action::Reprice;
+        }
+        const double drift_bps = std::fabs(target - resting_price) / resting_price * 1e4;
+        return drift_bps >= config_.reprice_bps ? Action::Reprice : Action::Keep;
+    }
+
+    // Korean cost saved against the taker buy at ask, per coin (spread plus fee difference)
+    static double saving_per_coin(double taker_ask, double taker_fee_rate, double maker_price,
+                                  double maker_fee_rate) noexcept {
+        return taker_ask * (1.0 + taker_fee_rate) - maker_price * (1.0 + maker_fee_rate);
+    }
+
+private:
+    MakerQuoterConfig config_;
+    double korean_fee_rate_;
+    double foreign_fee_rate_;
+};
+
+} // namespace kimp::execution
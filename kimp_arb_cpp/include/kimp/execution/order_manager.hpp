@@ -1,16 +1,24 @@
 #pragma once
 
 #include "kimp/core/types.hpp"
+#include "kimp/core/latency_histogram.hpp"
 #include "kimp/core/latency_probe.hpp"
 #include "kimp/exchange/exchange_base.hpp"
 #include "kimp/exchange/bithumb/bithumb.hpp"
 #include "kimp/exchange/upbit/upbit.hpp"
 #include "kimp/exchange/bybit/bybit.hpp"
 #include "kimp/exchange/okx/okx.hpp"
+#include "kimp/execution/account_pool.hpp"
+#include "kimp/execution/chunk_sizer.hpp"
+#include "kimp/execution/fill_quality.hpp"
+#include "kimp/execution/korean_router.hpp"
+#include "kimp/execution/execution_backend.hpp"
 #include "kimp/execution/lifecycle_executor.hpp"
+#include "kimp/execution/maker_quoter.hpp"
 #include "kimp/strategy/arbitrage_engine.hpp"
 
 #include <cstddef>
+#include <functional>
 #include <latch>
 #include <memory>
 #include <mutex>
@@ -53,6 +61,8 @@ private:
         enum class Kind : uint8_t {
             Foreign,
             Korean,
+            KoreanBuySubmit,   // Child of a routed Korean leg: submit, then query its fill
+            KoreanSellSubmit,
         };
 
         Kind kind{Kind::Foreign};
@@ -66,6 +76,10 @@ private:
         LatencyStage done_stage{LatencyStage::EntryForeignFillDone};
         Order* order{nullptr};
         std::latch* done{nullptr};
+        double quantity{0.0};    // Submit kinds only
+        double krw_amount{0.0};
+        double limit_price{0.0};  // Submit kinds: IOC limit (0 = market)
+        uint8_t account{0};       // Account of ex the lifecycle trades on
     };
 
     // Exchange references
@@ -74,10 +88,25 @@ private:
     std::shared_ptr<exchange::upbit::UpbitExchange> upbit_exchange_;
     std::shared_ptr<exchange::bybit::BybitExchange> bybit_exchange_;
     std::shared_ptr<exchange::okx::OkxExchange> okx_exchange_;
+    // Main connectors as account 0, plus extra accounts lifecycles are sharded across
+    AccountPool accounts_;
 
     // Strategy engine for position tracking
     strategy::ArbitrageEngine* engine_{nullptr};
 
+    // Replaces the exchange connectors for order submits and fill queries
+    // (paper trading); null = live orders
+    std::shared_ptr<ExecutionBackend> backend_;
+
+    // Splits the Korean leg across Bithumb and Upbit; null = signal's venue only
+    std::shared_ptr<KoreanLegRouter> korean_router_;
+
+    // Split round trip per (korean, foreign) pair, carried across loops so a
+    // new lifecycle starts from the measured latency (0 = none yet)
+    static constexpr std::size_t PAIR_COUNT =
+        static_cast<std::size_t>(Exchange::Count) * static_cast<std::size_t>(Exchange::Count);
+    std::array<std::atomic<double>, PAIR_COUNT> pair_round_trip_ms_{};
+
     std::atomic<bool> running_{true};
     LifecycleExecutor<FillQueryTask, 64> fill_query_executor_;
     std::once_flag fill_query_executor_start_once_;
@@ -86,8 +115,67 @@ public:
     ~OrderManager();
 
     // Configuration
-    void set_exchange(Exchange ex, ExchangePtr exchange);
+    void set_exchange(Exchange ex, ExchangePtr exchange, const AccountPool::Options& account_options = {});
+    // Another account on ex with its own connector; index, or -1 (no main connector, or full)
+    int add_account(Exchange ex, ExchangePtr exchange, const AccountPool::Options& options = {}) {
+        return accounts_.add(ex, std::move(exchange), options);
+    }
+    AccountPool& accounts() noexcept { return accounts_; }
+    const AccountPool& accounts() const noexcept { return accounts_; }
     void set_engine(strategy::ArbitrageEngine* engine) { engine_ = engine; }
+    // Install before the first lifecycle starts
+    void set_execution_backend(std::shared_ptr<ExecutionBackend> backend) { backend_ = std::move(backend); }
+    bool is_paper() const noexcept { return backend_ != nullptr; }
+    // Install before the first lifecycle starts; needs both Korean venues set
+    void set_korean_router(std::shared_ptr<KoreanLegRouter> router) { korean_router_ = std::move(router); }
+
+    // Opening and closing legs as IOC limits at the signal quote plus a
+    // slippage band, on venues with IOC support (others stay market). Zero
+    // fills re-price on the next update; Korean remainders are re-priced at
+    // the latest quote, and what still misses is unwound at market by the
+    // hedge corrections
+    struct PriceProtection {
+        bool enabled{false};
+        double band_bps{15.0};
+        int reprice_attempts{2};
+
+        double limit(double quote, Side side) const noexcept {
+            const double band = band_bps / 10000.0;
+            return side == Side::Buy ? quote * (1.0 + band) : quote * (1.0 - band);
+        }
+    };
+    // Install before the first lifecycle starts
+    void set_price_protection(const PriceProtection& protection) { price_protection_ = protection; }
+    const PriceProtection& price_protection() const noexcept { return price_protection_; }
+
+    // Entry chunks as a post-only bid on the Korean venue (where it takes
+    // post-only orders), priced by MakerQuoter; each fill increment is hedged
+    // with a market foreign short as soon as it reaches min_hedge_usdt. The
+    // bid is re-quoted on drift and cancelled after max_rest_ms or when the
+    // edge is gone; the taker flow runs whenever no maker quote is possible
+    struct MakerEntry {
+        bool enabled{false};
+        double edge_buffer_pct{0.02};
+        double reprice_bps{3.0};
+        int max_rest_ms{3000};
+        double min_hedge_usdt{5.0};
+    };
+    struct MakerStats {
+        uint64_t chunks{0};             // Post-only orders that rested
+        uint64_t post_only_rejects{0};  // Would have crossed
+        uint64_t reprices{0};
+        uint64_t cancels{0};            // Timed out or lost the edge
+        double filled_coins{0.0};
+        double saved_krw{0.0};          // Against buying the same coins at the ask
+        LatencyHistogram::Summary hedge_delay;  // Korean fill -> hedge short filled
+    };
+    // Install before the first lifecycle starts
+    void set_maker_entry(const MakerEntry& maker) { maker_entry_ = maker; }
+    const MakerEntry& maker_entry() const noexcept { return maker_entry_; }
+    MakerStats maker_stats() const;
+
+    // Directory of entry_splits.csv / exit_splits.csv / fill_quality.bin (default trade_logs)
+    static void set_trade_log_dir(std::string dir);
 
     // Execute entry with foreign short FIRST for hedge sizing
     // 1. SHORT on Bybit spot margin
@@ -102,7 +190,7 @@ public:
     // 2. SELL on Bithumb (same amount)
     ExecutionResult execute_spot_relay_exit(const ExitSignal& signal, const Position& position);
 
-    // Prepare foreign spot margin accounts before live trading
+    // Prepare foreign spot margin accounts (every configured account) before live trading
     bool prepare_bybit_shorting(const std::vector<SymbolId>& symbols);
     bool prepare_okx_shorting(const std::vector<SymbolId>& symbols);
 
@@ -118,9 +206,10 @@ public:
     bool is_safe_to_trade(const SymbolId& symbol, Exchange korean_ex, Exchange foreign_ex);
 
     // Position update callback for crash recovery persistence
-    // Called with non-null Position* after each split (save), nullptr on full exit (delete)
+    // Called with non-null Position* after each split (save), nullptr on full exit (delete);
+    // the position carries the accounts its legs are on
     using PositionUpdateCallback = std::function<void(const Position*)>;
-    void set_position_update_callback(PositionUpdateCallback cb) { on_position_update_ = std::move(cb); }
+    void set_position_update_callback(PositionUpdateCallback cb);
 
     // Trade completion callback — called when a full enter→exit cycle completes within the lifecycle loop
     using TradeCompleteCallback = std::function<void(const Position& closed_pos, double pnl_krw, double usdt_rate)>;
@@ -131,31 +220,125 @@ public:
                                     const std::unordered_set<SymbolId>& bot_managed = {});
 
 private:
+    PriceProtection price_protection_;
+    MakerEntry maker_entry_;
+    std::atomic<uint64_t> maker_chunks_{0};
+    std::atomic<uint64_t> maker_rejects_{0};
+    std::atomic<uint64_t> maker_reprices_{0};
+    std::atomic<uint64_t> maker_cancels_{0};
+    std::atomic<double> maker_filled_coins_{0.0};
+    std::atomic<double> maker_saved_krw_{0.0};
+    LatencyHistogram maker_hedge_delay_;
     PositionUpdateCallback on_position_update_;
     TradeCompleteCallback on_trade_complete_;
     // External position blacklist (symbols we shouldn't trade)
     // Built once at startup, checked with O(1) lookup
     std::unordered_set<SymbolId> external_position_blacklist_;
     std::mutex blacklist_mutex_;
-    // Get typed exchange
+    // Get typed exchange of the calling thread's account on the venue
     KoreanExchangePtr get_korean_exchange(Exchange ex);
+    std::shared_ptr<exchange::bithumb::BithumbExchange> get_bithumb_exchange();
+    std::shared_ptr<exchange::upbit::UpbitExchange> get_upbit_exchange();
     BybitExchangePtr get_bybit_exchange();
     OkxExchangePtr get_okx_exchange();
     std::shared_ptr<exchange::ForeignShortExchangeBase> get_foreign_exchange(Exchange ex);
 
-    // Single order execution helpers
-    Order execute_korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount);
-    Order execute_foreign_short(Exchange ex, const SymbolId& symbol, double quantity);
-    Order execute_korean_sell(Exchange ex, const SymbolId& symbol, double quantity);
-    Order execute_foreign_cover(Exchange ex, const SymbolId& symbol, double quantity);
+    // Account the calling thread trades on per venue: set for a lifecycle's
+    // worker and carried into its fill queries (0 = main connector)
+    static uint8_t current_account(Exchange ex) noexcept;
+    template <typename T>
+    std::shared_ptr<T> account_connector(Exchange ex, const std::shared_ptr<T>& main) const {
+        const uint8_t account = current_account(ex);
+        return account == 0 ? main : std::dynamic_pointer_cast<T>(accounts_.exchange(ex, account));
+    }
+    void consume_order_budget(Exchange ex) { accounts_.consume_order(ex, current_account(ex)); }
+
+    // Single order execution helpers; limit_price > 0 sends an IOC limit
+    // where the venue supports it, a market order otherwise
+    Order execute_korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount,
+                             double limit_price = 0.0);
+    Order execute_foreign_short(Exchange ex, const SymbolId& symbol, double quantity, double limit_price = 0.0);
+    Order execute_korean_sell(Exchange ex, const SymbolId& symbol, double quantity, double limit_price = 0.0);
+    Order execute_foreign_cover(Exchange ex, const SymbolId& symbol, double quantity, double limit_price = 0.0);
+    bool supports_ioc(Exchange ex) const;
+    // A live submit left Unknown may be on the book: look it up by client id
+    // with backoff until the venue answers Found or NotFound, so no caller
+    // sends the leg again while it might be live. Only shutdown stops the
+    // wait, leaving it Unknown. resting: post-only ack (New) on Found
+    void reconcile_unknown_submit(exchange::IExchange& venue, Order& order, bool resting);
+    // IOC limit for a leg at quote; 0 (market) with protection off
+    double protected_limit(double quote, Side side) const noexcept;
+    // Re-price the unfilled part of a Korean IOC leg at the latest quote, up
+    // to reprice_attempts, merging the fills into order; returns coins added
+    double reprice_korean_ioc(Exchange ex, const SymbolId& symbol, Side side, double target, Order& order);
+    // Post-only Korean limit and its resting life; live orders go through Upbit
+    Order execute_korean_post_only(Exchange ex, const SymbolId& symbol, Side side, double quantity, double price);
+    bool poll_resting(Exchange ex, Order& order);    // false once nothing rests
+    bool cancel_resting(Exchange ex, Order& order);  // false when the final fill is unknown
+    bool supports_post_only(Exchange ex) const;
+    // One maker entry chunk: both legs as filled, foreign already matched to
+    // the Korean fill unless hedge_failed (the caller stops on it)
+    struct MakerChunk {
+        bool rested{false};
+        bool hedge_failed{false};
+        double korean_quantity{0.0};
+        double korean_cost{0.0};     // KRW, price x quantity
+        double foreign_quantity{0.0};
+        double foreign_value{0.0};   // USDT, price x quantity
+        double adjustment_pnl_krw{0.0};  // Residual flattened at market
+        Order korean_order;   // Fills merged into one leg for the fill-quality log
+        Order foreign_order;
+    };
+    // Each hedge short feeds its round trip to sizer
+    MakerChunk execute_maker_chunk(const ArbitrageSignal& signal, const SymbolId& foreign_symbol, double quantity,
+                                   double price, double taker_ask, ChunkSizer& sizer);
+    // Split-routed Korean leg: the child on the other venue is submitted on a
+    // fill worker while the primary child goes out here; both fills are
+    // resolved and merged into one order on the primary venue
+    struct KoreanLegFill {
+        Order order;
+        double split_quantity{0.0};  // Filled on the other venue
+    };
+    std::optional<KoreanRoute> plan_korean_buy(Exchange primary, const SymbolId& symbol, double quantity) const;
+    KoreanLegFill execute_korean_route(const KoreanRoute& route, const SymbolId& symbol, double limit_price = 0.0);
+    // Sell drawing on both venues' holdings (split_held on the other venue)
+    KoreanLegFill sell_korean_inventory(Exchange primary, const SymbolId& symbol, double quantity,
+                                        double primary_held, double split_held, double limit_price = 0.0);
+    // Submit -> ack time of a filled leg, for route scoring
+    void record_leg_latency(Exchange ex, std::chrono::steady_clock::time_point submit_start, const Order& order);
+
+    // Decision context of one split for the fill-quality log
+    struct FillQualitySplit {
+        FillAction action{FillAction::Entry};
+        uint64_t trace_id{0};
+        LatencySymbol trace_symbol{};
+        Exchange korean_ex{};
+        Exchange foreign_ex{};
+        SymbolId korean_symbol;
+        SymbolId foreign_symbol;
+        SystemTimestamp decision_time{};
+        double premium_pct{0.0};
+        double usdt_krw{0.0};
+        double foreign_price{0.0};  // Touches the split was sized on
+        double korean_price{0.0};
+    };
+    // Both filled legs of a split, with the touch at fill time
+    void record_fill_quality(const FillQualitySplit& split, const Order& foreign_order, const Order& korean_order);
 
     // Async fill price queries (parallel with hedge orders)
     void query_foreign_fill(Exchange ex, Order& order);
     void query_korean_fill(Exchange ex, const SymbolId& symbol, Order& order);
+    // query() until it answers. An IOC ack says nothing about how much crossed,
+    // so an IOC is re-queried with backoff until shutdown; a market order gets
+    // one query and keeps its full ack when that fails
+    bool await_fill(Exchange ex, Order& order, const std::function<bool()>& query);
     void ensure_fill_query_executor_started();
     void handle_fill_query(FillQueryTask&& task, std::size_t worker_index);
     void dispatch_fill_query(FillQueryTask task);
     void wait_for_next_market_update(uint64_t update_seq_before_trade);
+    ChunkSizer make_chunk_sizer(Exchange korean_ex, Exchange foreign_ex) const;
+    void record_split_round_trip(ChunkSizer& sizer, Exchange korean_ex, Exchange foreign_ex,
+                                 std::chrono::steady_clock::time_point split_start);
     bool flatten_extra_korean_long(Exchange ex, const SymbolId& symbol, double quantity, Order& order_out);
     bool flatten_extra_foreign_short(Exchange ex, const SymbolId& symbol, double quantity, Order& order_out);
 };
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "kimp/core/latency_histogram.hpp"
+#include "kimp/core/types.hpp"
+#include "kimp/execution/execution_backend.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace kimp::strategy {
+class PriceCache;
+}
+
+namespace kimp::execution {
+
+/**
+ * Empirical latency distribution given as measured quantiles
+ * (e.g. p50/p90/p99 of the submit and fill stages from the latency probe).
+ * Sampled by inverse CDF: linear between knots, clamped outside them.
+ * An empty distribution is zero latency.
+ */
+class LatencyDistribution {
+public:
+    struct Knot {
+        double quantile{0.0};  // [0, 1]
+        double ms{0.0};
+    };
+
+    LatencyDistribution() = default;
+    explicit LatencyDistribution(std::vector<Knot> knots);
+
+    bool empty() const noexcept { return knots_.empty(); }
+    double quantile_ms(double u) const noexcept;
+
+private:
+    std::vector<Knot> knots_;  // Sorted by quantile
+};
+
+struct PaperVenueModel {
+    LatencyDistribution submit;       // Send -> match at the venue; the book is read on arrival
+    LatencyDistribution fill_report;  // Match -> fill details visible to the fill query
+};
+
+/**
+ * Paper execution backend: live books, simulated orders
+ *
+ * Features:
+ * - Market orders fill by walking the latest depth snapshot of the venue
+ *   (exchange orderbook callback), falling back to the BBO cache when no
+ *   fresh depth is available; quantity past the visible depth fills at the
+ *   last level plus a configurable slippage
+ * - Per-venue submit and fill-report latencies sampled from measured
+ *   quantiles; the submit delay blocks like a REST round trip, so the book
+ *   the order meets is the one live at its arrival
+ * - IOC limits walk only the levels at or better than the limit and cancel
+ *   the rest, with no beyond-depth residual; nothing crossing is a zero fill
+ * - Post-only limits are rejected when they would cross, then rest until a
+ *   later book trades through their price (asks at or below a resting bid);
+ *   they fill at their own price and pay the maker fee
+ * - Fill details are withheld until the fill query, as on the real venues
+ * - Virtual balances per venue (KRW/USDT cash, coin holdings, short
+ *   liabilities) charged at TradingConfig taker fees; orders the balance
+ *   cannot cover are rejected
+ */
+class PaperExecution final : public ExecutionBackend {
+public:
+    struct Options {
+        std::array<PaperVenueModel, static_cast<std::size_t>(Exchange::Count)> venues{};
+        double beyond_depth_slippage_bps{10.0};  // Residual past the last visible level
+        uint64_t max_book_age_ms{2000};          // Older depth falls back to the BBO cache
+        double initial_krw{5'000'000.0};         // Per Korean venue
+        double initial_usdt{3'000.0};            // Per foreign venue
+        uint64_t seed{0};                        // 0 = nondeterministic
+
+        // Typical production round trips; replace with measured quantiles
+        static Options with_default_latencies();
+    };
+
+    struct Fill {
+        double quantity{0.0};
+        double average_price{0.0};
+        double notional{0.0};
+        bool beyond_depth{false};  // Visible depth did not cover the order
+    };
+
+    struct Balance {
+        Exchange exchange{Exchange::Bithumb};
+        std::string currency;
+        double amount{0.0};  // Negative = borrowed (foreign short liability)
+    };
+
+    struct Stats {
+        uint64_t orders{0};
+        uint64_t rejected{0};
+        uint64_t ioc_zero_fills{0};  // IOC limits with nothing at or better than the limit
+        uint64_t post_only_rejects{0};  // Post-only limits that would have crossed
+        uint64_t maker_fills{0};        // Book updates that filled a resting order
+        uint64_t beyond_depth{0};
+        uint64_t bbo_fallbacks{0};  // Filled against the one-level BBO cache
+        double fees_krw{0.0};
+        double fees_usdt{0.0};
+        LatencyHistogram::Summary submit_latency;
+        LatencyHistogram::Summary fill_latency;
+    };
+
+    // prices: BBO fallback for venues without a depth feed (may be null)
+    PaperExecution(const strategy::PriceCache* prices, Options options);
+
+    // Depth feed; install as the exchange orderbook callback
+    void on_orderbook(const OrderBook& book);
+
+    // Give the virtual venues the legs of a position opened before this
+    // session (recovered position), so its exit can be simulated.
+    void seed_position(const Position& position);
+
+    // Book walks over levels best-first; zero-quantity levels are skipped
+    static Fill walk_quantity(const OrderBookLevel* levels, std::size_t count,
+                              double quantity, double beyond_bps, bool buy) noexcept;
+    static Fill walk_cost(const OrderBookLevel* levels, std::size_t count,
+                          double cost, double beyond_bps) noexcept;
+    // Levels at or better than limit only (buy: price <= limit, sell: >= limit)
+    static Fill walk_limit(const OrderBookLevel* levels, std::size_t count,
+                           double quantity, double limit, bool buy) noexcept;
+
+    // ExecutionBackend
+    Order korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount) override;
+    Order korean_sell(Exchange ex, const SymbolId& symbol, double quantity) override;
+    Order foreign_short(Exchange ex, const SymbolId& symbol, double quantity) override;
+    Order foreign_cover(Exchange ex, const SymbolId& symbol, double quantity) override;
+    Order korean_buy_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) override;
+    Order korean_sell_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) override;
+    Order foreign_short_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) override;
+    Order foreign_cover_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) override;
+    // As live: Bithumb's order API has no IOC
+    bool supports_ioc(Exchange ex) const override { return ex != Exchange::Bithumb; }
+    Order korean_post_only(Exchange ex, const SymbolId& symbol, Side side, double quantity,
+                           double limit_price) override;
+    bool poll_resting(Exchange ex, Order& order) override;
+    bool cancel_resting(Exchange ex, Order& order) override;
+    // As live: only Upbit takes post-only orders
+    bool supports_post_only(Exchange ex) const override { return ex == Exchange::Upbit; }
+    void query_korean_fill(Exchange ex, const SymbolId& symbol, Order& order) override;
+    void query_foreign_fill(Exchange ex, Order& order) override;
+
+    double balance(Exchange ex, std::string_view currency) const;
+    std::vector<Balance> balances() const;  // Non-zero, by venue then currency
+    Stats stats() const;
+
+private:
+    struct PendingFill {
+        Fill fill;
+        int64_t ready_ns{0};  // Steady clock; fill visible to queries from here
+    };
+
+    enum class Leg : uint8_t { KoreanBuy, KoreanSell, ForeignShort, ForeignCover };
+
+    struct MakerFill {
+        double quantity{0.0};
+        int64_t ready_ns{0};
+        std::chrono::system_clock::time_point matched{};
+    };
+
+    struct RestingOrder {
+        Leg leg{Leg::KoreanBuy};
+        Exchange exchange{Exchange::Upbit};
+        SymbolId symbol{};
+        double quantity{0.0};
+        double price{0.0};
+        double filled{0.0};            // Matched so far, all at price
+        std::vector<MakerFill> fills;  // Reported to polls from their ready_ns
+    };
+
+    static constexpr std::size_t MAX_PENDING_FILLS = 1024;
+    static constexpr int64_t STALE_PENDING_NS = 60'000'000'000;
+
+    // limit_price > 0 = IOC limit by quantity
+    Order submit(Leg leg, Exchange ex, const SymbolId& symbol, double quantity, double cost,
+                 double limit_price = 0.0);
+    bool load_book(Exchange ex, const SymbolId& symbol, OrderBook& out);
+    bool settle(Leg leg, Exchange ex, const SymbolId& symbol, const Fill& fill, bool maker = false);
+    void resolve(Order& order);
+    // Fill resting orders the new book trades through
+    void match_resting(const OrderBook& book);
+    // Fills visible at now_ns (all of them when final) into order
+    static void copy_resting(const RestingOrder& resting, Order& order, int64_t now_ns, bool final);
+    double sample_ms(const LatencyDistribution& dist);
+
+    const strategy::PriceCache* prices_;
+    Options options_;
+
+    mutable std::mutex books_mutex_;
+    std::array<std::unordered_map<SymbolId, OrderBook>, static_cast<std::size_t>(Exchange::Count)> books_;
+
+    mutable std::mutex balances_mutex_;
+    std::array<std::unordered_map<std::string, double>, static_cast<std::size_t>(Exchange::Count)> balances_;
+    double fees_krw_{0.0};
+    double fees_usdt_{0.0};
+
+    std::mutex pending_mutex_;
+    std::unordered_map<std::string, PendingFill> pending_;
+
+    std::mutex resting_mutex_;
+    std::unordered_map<std::string, RestingOrder> resting_;
+
+    std::mutex rng_mutex_;
+    std::mt19937_64 rng_;
+
+    std::atomic<uint64_t> next_order_id_{1};
+    std::atomic<uint64_t> orders_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> ioc_zero_fills_{0};
+    std::atomic<uint64_t> post_only_rejects_{0};
+    std::atomic<uint64_t> maker_fills_{0};
+    std::atomic<uint64_t> beyond_depth_{0};
+    std::atomic<uint64_t> bbo_fallbacks_{0};
+    LatencyHistogram submit_hist_;
+    LatencyHistogram fill_hist_;
+};
+
+} // namespace kimp::execution
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace kimp::memory {
+
+/**
+ * Insert-only hash map with lock-free lookups
+ *
+ * Hot-path readers (WS handlers, the strategy thread) look up while a
+ * control thread adds keys at runtime, e.g. a new listing. Entries live in
+ * a deque (stable addresses, so Value may hold atomics) and are published
+ * into an open-addressing slot table with a release store: a reader sees
+ * either no entry or a fully built one. Entries are never removed.
+ *
+ * Writers are serialized by a mutex; get_or_add() returns nullptr once
+ * Capacity keys are stored.
+ */
+template <typename Key, typename Value, std::size_t Capacity, typename Hash = std::hash<Key>>
+class GrowOnlyMap {
+public:
+    GrowOnlyMap() {
+        for (auto& slot : slots_) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    GrowOnlyMap(const GrowOnlyMap&) = delete;
+    GrowOnlyMap& operator=(const GrowOnlyMap&) = delete;
+
+    Value* find(const Key& key) noexcept {
+        Node* node = find_node(key);
+        return node ? &node->value : nullptr;
+    }
+    const Value* find(const Key& key) const noexcept {
+        const Node* node = find_node(key);
+        return node ? &node->value : nullptr;
+    }
+    bool contains(const Key& key) const noexcept { return find_node(key) != nullptr; }
+
+    // Existing entry, or one built from args and then published for key
+    template <typename... Args>
+    Value* get_or_add(const Key& key, Args&&... args) {
+        std::lock_guard lock(write_mutex_);
+        if (Node* node = find_node(key)) {
+            return &node->value;
+        }
+        if (nodes_.size() >= Capacity) {
+            return nullptr;
+        }
+        Node* node = &nodes_.emplace_back(key, std::forward<Args>(args)...);
+        std::size_t i = Hash{}(key) & MASK;
+        while (slots_[i].load(std::memory_order_relaxed) != nullptr) {
+            i = (i + 1) & MASK;
+        }
+        slots_[i].store(node, std::memory_order_release);
+        size_.store(nodes_.size(), std::memory_order_release);
+        return &node->value;
+    }
+
+    std::size_t size() const noexcept { return size_.load(std::memory_order_acquire); }
+
+    // Entries in insertion order; holds the writer lock (not for hot paths)
+    template <typename F>
+    void for_each(F&& fn) {
+        std::lock_guard lock(write_mutex_);
+        for (auto& node : nodes_) {
+            fn(static_cast<const Key&>(node.key), node.value);
+        }
+    }
+
+private:
+    struct Node {
+        template <typename... Args>
+        explicit Node(const Key& k, Args&&... args) : key(k), value(std::forward<Args>(args)...) {}
+        const Key key;
+        Value value;
+    };
+
+    // Load factor stays at or under one half
+    static constexpr std::size_t SLOTS = std::bit_ceil(Capacity * 2);
+    static constexpr std::size_t MASK = SLOTS - 1;
+
+    Node* find_node(const Key& key) const noexcept {
+        std::size_t i = Hash{}(key) & MASK;
+        for (std::size_t probe = 0; probe < SLOTS; ++probe) {
+            Node* node = slots_[i].load(std::memory_order_acquire);
+            if (node == nullptr) {
+                return nullptr;
+            }
+            if (node->key == key) {
+                return node;
+            }
+            i = (i + 1) & MASK;
+        }
+        return nullptr;
+    }
+
+    std::array<std::atomic<Node*>, SLOTS> slots_;
+    std::deque<Node> nodes_;
+    std::mutex write_mutex_;
+    std::atomic<std::size_t> size_{0};
+};
+
+/**
+ * Fixed-capacity array readers index while one writer appends
+ *
+ * The element is written before size() is bumped (release), so any index
+ * below an acquired size() is fully built and never changes again.
+ */
+template <typename T, std::size_t Capacity>
+class AppendOnlyArray {
+public:
+    AppendOnlyArray() = default;
+    AppendOnlyArray(const AppendOnlyArray&) = delete;
+    AppendOnlyArray& operator=(const AppendOnlyArray&) = delete;
+
+    // Single writer (callers serialize); false when full
+    bool push_back(const T& value) {
+        const std::size_t n = size_.load(std::memory_order_relaxed);
+        if (n >= Capacity) {
+            return false;
+        }
+        items_[n] = value;
+        size_.store(n + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t size() const noexcept { return size_.load(std::memory_order_acquire); }
+    bool empty() const noexcept { return size() == 0; }
+    const T& operator[](std::size_t idx) const noexcept { return items_[idx]; }
+    const T* begin() const noexcept { return items_.data(); }
+    const T* end() const noexcept { return items_.data() + size(); }
+
+private:
+    std::array<T, Capacity> items_{};
+    std::atomic<std::size_t> size_{0};
+};
+
+} // namespace kimp::memory
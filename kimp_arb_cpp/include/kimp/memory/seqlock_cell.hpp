@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace kimp::memory {
+
+// Single-writer seqlock around a small trivially copyable value.
+// The payload lives in relaxed atomic words, so readers never race on plain
+// memory; they retry while a store is in progress. Writers must be
+// serialized by the caller.
+template <typename T>
+class SeqlockCell {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqlockCell payload must be trivially copyable");
+
+public:
+    static constexpr std::size_t WORD_COUNT = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    SeqlockCell() { store(T{}); }
+    SeqlockCell(const SeqlockCell&) = delete;
+    SeqlockCell& operator=(const SeqlockCell&) = delete;
+
+    void store(const T& value) noexcept {
+        std::array<uint64_t, WORD_COUNT> buf{};
+        std::memcpy(buf.data(), &value, sizeof(T));
+
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+            words_[i].store(buf[i], std::memory_order_relaxed);
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    T load() const noexcept {
+        std::array<uint64_t, WORD_COUNT> buf{};
+        uint64_t seq0;
+        uint64_t seq1;
+        do {
+            seq0 = seq_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+                buf[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq1 = seq_.load(std::memory_order_relaxed);
+        } while ((seq0 & 1) != 0 || seq0 != seq1);
+
+        T out;
+        std::memcpy(static_cast<void*>(&out), buf.data(), sizeof(T));
+        return out;
+    }
+
+    // Bumped on every store; lets readers skip unchanged values
+    uint64_t version() const noexcept { return seq_.load(std::memory_order_acquire) / 2; }
+
+private:
+    std::atomic<uint64_t> seq_{0};
+    std::array<std::atomic<uint64_t>, WORD_COUNT> words_{};
+};
+
+} // namespace kimp::memory
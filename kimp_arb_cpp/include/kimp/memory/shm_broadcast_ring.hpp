@@ -0,0 +1,203 @@
+#pragma once
+
+#include "kimp/memory/shm_region.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace kimp::memory {
+
+/**
+ * Single-writer, multi-reader broadcast ring in POSIX shared memory
+ *
+ * Features:
+ * - Writer never waits for readers: slot n % capacity is overwritten
+ *   when the writer laps it
+ * - Every slot carries a seqlock word (2n+1 while message n is being
+ *   written, 2n+2 once complete), so a reader knows exactly which
+ *   message it copied and detects overruns (gaps) without any shared
+ *   reader state
+ * - Payload stored in relaxed atomic words (no torn-read UB), like
+ *   SeqlockCell
+ * - epoch() changes every time the writer re-creates the ring, so
+ *   readers can tell a restarted writer from a quiet one
+ */
+template <typename T>
+class ShmBroadcastRing {
+    static_assert(std::is_trivially_copyable_v<T>, "ShmBroadcastRing payload must be trivially copyable");
+
+public:
+    static constexpr uint64_t MAGIC = 0x3130474E52534B4BULL;  // "KKSRNG01"
+    static constexpr std::size_t WORD_COUNT = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    static std::unique_ptr<ShmBroadcastRing> create(const std::string& name, std::size_t capacity,
+                                                    std::string* error = nullptr) {
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+            if (error) *error = "capacity must be a power of two";
+            return nullptr;
+        }
+        auto region = SharedMemoryRegion::create(name, bytes_for(capacity), error);
+        if (!region) {
+            return nullptr;
+        }
+        auto* header = new (region->data()) Header{};
+        header->capacity = capacity;
+        header->word_count = WORD_COUNT;
+        header->epoch = static_cast<uint64_t>(
+            std::chrono::system_clock::now().time_since_epoch().count()) | 1;
+        for (std::size_t i = 0; i < capacity; ++i) {
+            new (slot_at(region->data(), i)) Slot{};
+        }
+        header->magic.store(MAGIC, std::memory_order_release);  // Readers accept the ring from here
+        return std::unique_ptr<ShmBroadcastRing>(new ShmBroadcastRing(std::move(region), true));
+    }
+
+    static std::unique_ptr<ShmBroadcastRing> attach(const std::string& name, std::string* error = nullptr) {
+        auto region = SharedMemoryRegion::attach(name, error);
+        if (!region) {
+            return nullptr;
+        }
+        const auto* header = static_cast<const Header*>(region->data());
+        if (region->size() < sizeof(Header) ||
+            header->magic.load(std::memory_order_acquire) != MAGIC ||
+            header->word_count != WORD_COUNT ||
+            region->size() < bytes_for(header->capacity)) {
+            if (error) *error = region->name() + " is not a ring of this message type";
+            return nullptr;
+        }
+        return std::unique_ptr<ShmBroadcastRing>(new ShmBroadcastRing(std::move(region), false));
+    }
+
+    static constexpr std::size_t bytes_for(std::size_t capacity) noexcept {
+        return sizeof(Header) + capacity * sizeof(Slot);
+    }
+
+    // Writer only; publishes must be serialized by the caller
+    void publish(const T& value) noexcept {
+        std::array<uint64_t, WORD_COUNT> buf{};
+        std::memcpy(buf.data(), &value, sizeof(T));
+
+        const uint64_t n = header_->write_seq.load(std::memory_order_relaxed);
+        Slot& slot = slot_for(n);
+        slot.seq.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+            slot.words[i].store(buf[i], std::memory_order_relaxed);
+        }
+        slot.seq.store(2 * n + 2, std::memory_order_release);
+        header_->write_seq.store(n + 1, std::memory_order_release);
+    }
+
+    // Messages published so far (= sequence of the next one)
+    uint64_t published() const noexcept { return header_->write_seq.load(std::memory_order_acquire); }
+    std::size_t capacity() const noexcept { return header_->capacity; }
+    // Oldest sequence not yet overwritten, with a quarter ring of headroom
+    uint64_t oldest_available() const noexcept {
+        const uint64_t written = published();
+        const uint64_t cap = header_->capacity;
+        return written > cap ? written - cap + cap / 4 : 0;
+    }
+    uint64_t epoch() const noexcept { return header_->epoch; }
+    const std::string& name() const noexcept { return region_->name(); }
+    bool is_writer() const noexcept { return writer_; }
+
+    // One consumer's cursor; each reader thread owns its own
+    class Reader {
+    public:
+        // Starts at the next message to be published
+        explicit Reader(const ShmBroadcastRing& ring) noexcept : ring_(&ring), next_(ring.published()) {}
+        Reader(const ShmBroadcastRing& ring, uint64_t start_sequence) noexcept
+            : ring_(&ring), next_(start_sequence) {}
+
+        // Copies the next message; false once caught up. Messages the
+        // writer overwrote before we got to them are skipped and counted.
+        bool poll(T& out) noexcept {
+            std::array<uint64_t, WORD_COUNT> buf{};
+            while (true) {
+                const uint64_t n = next_;
+                const Slot& slot = ring_->slot_for(n);
+                const uint64_t done = 2 * n + 2;
+                const uint64_t seq0 = slot.seq.load(std::memory_order_acquire);
+                if (seq0 < done) {
+                    return false;  // Not written yet (or mid-write)
+                }
+                if (seq0 == done) {
+                    for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+                        buf[i] = slot.words[i].load(std::memory_order_relaxed);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot.seq.load(std::memory_order_relaxed) == seq0) {
+                        std::memcpy(static_cast<void*>(&out), buf.data(), sizeof(T));
+                        next_ = n + 1;
+                        return true;
+                    }
+                }
+                resync(n);  // Lapped before or while we copied
+            }
+        }
+
+        uint64_t next_sequence() const noexcept { return next_; }
+        uint64_t lost() const noexcept { return lost_; }   // Messages skipped
+        uint64_t gaps() const noexcept { return gaps_; }   // Overrun events
+
+    private:
+        void resync(uint64_t n) noexcept {
+            // Jump past the oldest surviving message with some headroom so
+            // the writer does not lap us again straight away
+            uint64_t target = ring_->oldest_available();
+            if (target <= n) target = n + 1;
+            lost_ += target - n;
+            ++gaps_;
+            next_ = target;
+        }
+
+        const ShmBroadcastRing* ring_;
+        uint64_t next_;
+        uint64_t lost_{0};
+        uint64_t gaps_{0};
+    };
+
+private:
+    struct Header {
+        std::atomic<uint64_t> magic{0};
+        uint64_t capacity{0};
+        uint64_t word_count{0};
+        uint64_t epoch{0};
+        alignas(64) std::atomic<uint64_t> write_seq{0};  // Own cache line: hot for every reader
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> seq{0};
+        std::array<std::atomic<uint64_t>, WORD_COUNT> words{};
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared-memory atomics must be lock-free");
+
+    ShmBroadcastRing(std::unique_ptr<SharedMemoryRegion> region, bool writer) noexcept
+        : region_(std::move(region))
+        , header_(static_cast<Header*>(region_->data()))
+        , slots_(slot_at(region_->data(), 0))
+        , mask_(header_->capacity - 1)
+        , writer_(writer) {}
+
+    static Slot* slot_at(void* base, std::size_t i) noexcept {
+        return reinterpret_cast<Slot*>(static_cast<char*>(base) + sizeof(Header)) + i;
+    }
+
+    Slot& slot_for(uint64_t n) const noexcept { return slots_[n & mask_]; }
+
+    std::unique_ptr<SharedMemoryRegion> region_;
+    Header* header_;
+    Slot* slots_;
+    uint64_t mask_;
+    bool writer_;
+};
+
+} // namespace kimp::memory
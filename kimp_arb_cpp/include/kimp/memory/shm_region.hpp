@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace kimp::memory {
+
+// POSIX shared memory object (shm_open + mmap) mapped read/write.
+// The creating process owns the name and unlinks it on destruction;
+// attached processes keep their mapping until they drop it.
+class SharedMemoryRegion {
+public:
+    // Replaces any stale object of the same name; nullptr (with error) on failure
+    static std::unique_ptr<SharedMemoryRegion> create(const std::string& name, std::size_t bytes,
+                                                      std::string* error = nullptr);
+    static std::unique_ptr<SharedMemoryRegion> attach(const std::string& name, std::string* error = nullptr);
+
+    ~SharedMemoryRegion();
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+    void* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    const std::string& name() const noexcept { return name_; }
+
+    // "/kimp_md" form required by shm_open
+    static std::string normalize_name(const std::string& name);
+
+private:
+    SharedMemoryRegion(std::string name, void* data, std::size_t size, bool owner) noexcept
+        : name_(std::move(name)), data_(data), size_(size), owner_(owner) {}
+
+    std::string name_;
+    void* data_{nullptr};
+    std::size_t size_{0};
+    bool owner_{false};
+};
+
+} // namespace kimp::memory
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "kimp/core/latency_histogram.hpp"
+#include "kimp/memory/ring_buffer.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace kimp::network {
+
+namespace net = boost::asio;
+
+/**
+ * Busy-poll reactor options (threading.busy_poll in config.yaml)
+ */
+struct BusyPollOptions {
+    bool enabled{false};
+    std::chrono::microseconds spin_idle{200};     // Pure spin after the last event
+    std::chrono::microseconds max_idle_sleep{0};  // Backoff ceiling past spin_idle (0 = yield only)
+};
+
+/**
+ * Receive-path socket options for market-data sockets
+ *
+ * SO_BUSY_POLL makes each (non-blocking) read spin on the device queue
+ * for up to busy_poll_us before reporting "no data", which pairs with
+ * the busy-poll reactor; values above net.core.busy_read need CAP_NET_ADMIN.
+ */
+struct SocketTuning {
+    int busy_poll_us{0};   // SO_BUSY_POLL (0 = off)
+    int rcvbuf_bytes{0};   // SO_RCVBUF (0 = kernel autotuning)
+
+    bool empty() const noexcept { return busy_poll_us <= 0 && rcvbuf_bytes <= 0; }
+
+    // False when the kernel rejects an option (errno is left set)
+    bool apply(int fd) const noexcept;
+};
+
+/**
+ * Runs the shared io_context on the io threads
+ *
+ * Features:
+ * - Blocking mode: plain io_context::run(), threads sleep in epoll
+ * - Busy-poll mode: loop over io_context::poll() on pinned/isolated cores,
+ *   so a ready socket is picked up without a scheduler wakeup; after
+ *   spin_idle without events the loop yields the core, or sleeps with
+ *   exponential backoff up to max_idle_sleep when that is set
+ * - Wakeup probe: handlers posted from another thread measure post -> run
+ *   latency in either mode; measure_blocking_wakeup() calibrates the epoll
+ *   baseline so the report can state latency saved against CPU burned
+ */
+class BusyPollReactor {
+public:
+    struct Report {
+        bool busy_poll{false};
+        std::size_t threads{0};
+        uint64_t handlers{0};
+        uint64_t polls{0};
+        uint64_t empty_polls{0};
+        uint64_t sleeps{0};
+        double cpu_cores{0.0};  // io-thread CPU time / wall time
+        LatencyHistogram::Summary wakeup;
+
+        double empty_poll_pct() const noexcept {
+            return polls == 0 ? 0.0 : 100.0 * static_cast<double>(empty_polls) / static_cast<double>(polls);
+        }
+    };
+
+    BusyPollReactor(net::io_context& io_context, BusyPollOptions options, std::size_t threads);
+
+    // Body of io thread `index`; returns once the io_context is stopped
+    void run(std::size_t index);
+
+    // Post a probe handler stamped now; its run latency feeds the report
+    void probe_wakeup();
+
+    Report report() const;
+
+    bool busy_poll() const noexcept { return options_.enabled; }
+    const BusyPollOptions& options() const noexcept { return options_; }
+
+    // Post -> run latency of a thread parked in epoll (private io_context)
+    static LatencyHistogram::Summary measure_blocking_wakeup(int samples);
+
+private:
+    struct alignas(memory::CACHE_LINE_SIZE) ThreadSlot {
+        std::atomic<uint64_t> handlers{0};
+        std::atomic<uint64_t> polls{0};
+        std::atomic<uint64_t> empty_polls{0};
+        std::atomic<uint64_t> sleeps{0};
+        std::atomic<int64_t> cpu_ns{0};
+        std::atomic<int64_t> wall_ns{0};
+    };
+
+    void run_busy_poll(ThreadSlot& slot);
+
+    net::io_context& io_context_;
+    BusyPollOptions options_;
+    std::size_t thread_count_;
+    std::unique_ptr<ThreadSlot[]> slots_;
+    LatencyHistogram wakeup_hist_;
+};
+
+} // namespace kimp::network
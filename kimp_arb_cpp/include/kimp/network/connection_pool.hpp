@@ -1,6 +1,7 @@
 #pragma once
 
 #include "kimp/core/optimization.hpp"
+#include "kimp/network/tls_stream.hpp"
 
 #include <boost/asio.hpp>
 #include <boost/asio/ssl/host_name_verification.hpp>
@@ -45,7 +46,7 @@ struct ConnectionPoolConfig {
  */
 class PooledConnection {
 public:
-    using SslStream = beast::ssl_stream<beast::tcp_stream>;
+    using SslStream = TlsStream;
 
     enum class State {
         Disconnected,
@@ -129,6 +130,7 @@ public:
  * - HTTP/1.1 keep-alive
  * - TCP_NODELAY for minimal latency
  * - Automatic reconnection on failure
+ * - Optional kernel TLS offload per connection (ktls::set_enabled)
  */
 class ConnectionPool {
 public:
@@ -409,9 +411,13 @@ private:
             // Set TCP keepalive
             socket.set_option(boost::asio::socket_base::keep_alive(true));
 
-            // SSL handshake
+            // SSL handshake (then kernel TLS if enabled; falls back silently)
+            if (ktls::enabled()) {
+                ktls::prepare(ssl_context_.native_handle());
+            }
             stream->set_verify_callback(ssl::host_name_verification(host_));
             stream->handshake(ssl::stream_base::client);
+            stream->try_ktls_offload();
 
             conn->set_stream(std::move(stream));
             return conn;
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "kimp/memory/ring_buffer.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace kimp::network {
+
+// Outcome of offering one market-data update to the arbiter
+enum class FeedVerdict : uint8_t {
+    First,      // First copy of this update: forward to the strategy
+    Duplicate,  // Same update already forwarded from the other line
+    Stale       // Older than what was already forwarded for this key
+};
+
+/**
+ * First-arrival arbiter for redundant (A/B) market-data lines
+ *
+ * Each venue's public stream is subscribed on two independent connections.
+ * Every update is offered here with a per-symbol key, a venue version
+ * (sequence id or exchange timestamp) and the raw frame; only the first copy
+ * is forwarded, late copies and out-of-order updates are dropped.
+ *
+ * Features:
+ * - Fixed open-addressed slot table (no allocation after construction)
+ * - Per-slot spinlock; A/B lines rarely touch the same slot at the same time
+ * - Frame fingerprint history so same-version updates are not conflated
+ * - Per-line sequence reset detection (venue restart → version goes backwards)
+ * - Per-line win count, late count and latency delta for reporting
+ */
+class FeedArbiter {
+public:
+    static constexpr uint8_t LINE_COUNT = 2;
+    static constexpr std::size_t SLOT_COUNT = 4096;       // Power of two
+    static constexpr std::size_t MAX_PROBE = 32;
+    static constexpr std::size_t HISTORY_PER_SLOT = 8;
+
+    struct LineStats {
+        uint64_t wins{0};         // Updates this line delivered first
+        uint64_t late{0};         // Copies that arrived after the other line's
+        uint64_t stale{0};        // Out-of-order updates dropped
+        uint64_t lag_ns_sum{0};   // Sum of (this copy - first copy) over late copies
+        uint64_t lag_ns_max{0};
+
+        double avg_lag_us() const noexcept {
+            return late > 0 ? static_cast<double>(lag_ns_sum) / static_cast<double>(late) / 1000.0 : 0.0;
+        }
+    };
+
+    struct Stats {
+        std::array<LineStats, LINE_COUNT> lines{};
+        uint64_t forwarded{0};
+        uint64_t table_overflow{0};  // Keys that found no slot (forwarded unarbitrated)
+
+        double win_rate(uint8_t line) const noexcept {
+            const uint64_t total = lines[0].wins + lines[1].wins;
+            return total > 0 ? static_cast<double>(lines[line].wins) / static_cast<double>(total) : 0.0;
+        }
+    };
+
+private:
+    struct HistoryEntry {
+        uint64_t fingerprint{0};
+        int64_t first_ns{0};
+    };
+
+    struct alignas(memory::CACHE_LINE_SIZE) Slot {
+        std::atomic<bool> locked{false};
+        uint64_t key{0};                 // 0 = empty
+        uint64_t version{0};             // Highest forwarded version
+        std::array<uint64_t, LINE_COUNT> line_version{};  // Last version seen per line
+        uint8_t history_head{0};
+        std::array<HistoryEntry, HISTORY_PER_SLOT> history{};
+    };
+
+    struct alignas(memory::CACHE_LINE_SIZE) LineCounters {
+        std::atomic<uint64_t> wins{0};
+        std::atomic<uint64_t> late{0};
+        std::atomic<uint64_t> stale{0};
+        std::atomic<uint64_t> lag_ns_sum{0};
+        std::atomic<uint64_t> lag_ns_max{0};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::array<LineCounters, LINE_COUNT> counters_{};
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> table_overflow_{0};
+
+public:
+    FeedArbiter() : slots_(std::make_unique<Slot[]>(SLOT_COUNT)) {}
+
+    FeedArbiter(const FeedArbiter&) = delete;
+    FeedArbiter& operator=(const FeedArbiter&) = delete;
+
+    // Offer one update. `key` identifies the symbol/channel, `version` is the
+    // venue sequence or timestamp (0 = unknown, fingerprint-only dedup).
+    FeedVerdict offer(uint64_t key, uint64_t version, std::string_view frame,
+                      uint8_t line, int64_t recv_ns) noexcept {
+        return offer_fingerprint(key, version, fingerprint(frame, version), line, recv_ns);
+    }
+
+    FeedVerdict offer_fingerprint(uint64_t key, uint64_t version, uint64_t fp,
+                                  uint8_t line, int64_t recv_ns) noexcept {
+        line = line < LINE_COUNT ? line : LINE_COUNT - 1;
+        key = key == 0 ? 1 : key;  // 0 marks an empty slot
+
+        Slot* slot = acquire_slot(key);
+        if (!slot) {
+            table_overflow_.fetch_add(1, std::memory_order_relaxed);
+            return FeedVerdict::First;
+        }
+
+        FeedVerdict verdict = FeedVerdict::First;
+        int64_t lag_ns = 0;
+
+        // Late copy of something already forwarded (any version)
+        for (const auto& h : slot->history) {
+            if (h.fingerprint == fp && h.first_ns != 0) {
+                verdict = FeedVerdict::Duplicate;
+                lag_ns = recv_ns - h.first_ns;
+                break;
+            }
+        }
+
+        if (verdict == FeedVerdict::First && version != 0 && version < slot->version) {
+            // A line can only move backwards on its own when the venue reset its
+            // sequence (restart/resubscribe); accept and re-base in that case.
+            const bool line_reset = slot->line_version[line] != 0 && version < slot->line_version[line];
+            if (!line_reset) {
+                verdict = FeedVerdict::Stale;
+            } else {
+                slot->version = version;
+            }
+        }
+
+        if (version != 0) {
+            slot->line_version[line] = version;
+        }
+
+        if (verdict == FeedVerdict::First) {
+            if (version > slot->version) {
+                slot->version = version;
+            }
+            auto& h = slot->history[slot->history_head];
+            h.fingerprint = fp;
+            h.first_ns = recv_ns != 0 ? recv_ns : 1;
+            slot->history_head = static_cast<uint8_t>((slot->history_head + 1) % HISTORY_PER_SLOT);
+        }
+
+        slot->locked.store(false, std::memory_order_release);
+
+        auto& c = counters_[line];
+        switch (verdict) {
+            case FeedVerdict::First:
+                c.wins.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case FeedVerdict::Duplicate: {
+                c.late.fetch_add(1, std::memory_order_relaxed);
+                const uint64_t lag = lag_ns > 0 ? static_cast<uint64_t>(lag_ns) : 0;
+                c.lag_ns_sum.fetch_add(lag, std::memory_order_relaxed);
+                uint64_t prev = c.lag_ns_max.load(std::memory_order_relaxed);
+                while (lag > prev &&
+                       !c.lag_ns_max.compare_exchange_weak(prev, lag, std::memory_order_relaxed)) {
+                }
+                break;
+            }
+            case FeedVerdict::Stale:
+                c.stale.fetch_add(1, std::memory_order_relaxed);
+                break;
+        }
+        return verdict;
+    }
+
+    Stats stats() const noexcept {
+        Stats s;
+        for (uint8_t i = 0; i < LINE_COUNT; ++i) {
+            s.lines[i].wins = counters_[i].wins.load(std::memory_order_relaxed);
+            s.lines[i].late = counters_[i].late.load(std::memory_order_relaxed);
+            s.lines[i].stale = counters_[i].stale.load(std::memory_order_relaxed);
+            s.lines[i].lag_ns_sum = counters_[i].lag_ns_sum.load(std::memory_order_relaxed);
+            s.lines[i].lag_ns_max = counters_[i].lag_ns_max.load(std::memory_order_relaxed);
+            s.forwarded += s.lines[i].wins;
+        }
+        s.table_overflow = table_overflow_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    // Frame fingerprint: FNV-1a over the payload, mixed with the version
+    static uint64_t fingerprint(std::string_view frame, uint64_t version = 0) noexcept {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (unsigned char ch : frame) {
+            h ^= ch;
+            h *= 0x100000001b3ULL;
+        }
+        h ^= version + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+        return h == 0 ? 1 : h;
+    }
+
+    // Parse an unsigned integer that follows `marker` (optionally quoted).
+    // Returns 0 when the marker is missing. Non-digit separators inside the
+    // value (e.g. "2024-01-02 10:11:12") are skipped until the closing quote.
+    static uint64_t parse_version(std::string_view message, std::string_view marker,
+                                  std::size_t from = 0) noexcept {
+        const std::size_t pos = message.find(marker, from);
+        if (pos == std::string_view::npos) {
+            return 0;
+        }
+        std::size_t i = pos + marker.size();
+        const bool quoted = i < message.size() && message[i] == '"';
+        if (quoted) ++i;
+
+        uint64_t value = 0;
+        for (; i < message.size(); ++i) {
+            const char ch = message[i];
+            if (ch >= '0' && ch <= '9') {
+                value = value * 10 + static_cast<uint64_t>(ch - '0');
+                continue;
+            }
+            if (!quoted || ch == '"') break;
+        }
+        return value;
+    }
+
+    // Combine a symbol hash with a channel tag so one venue's streams
+    // (e.g. ticker vs orderbook) are arbitrated independently.
+    static constexpr uint64_t make_key(uint64_t symbol_hash, uint64_t channel) noexcept {
+        return symbol_hash ^ ((channel + 1) * 0x9E3779B97F4A7C15ULL);
+    }
+
+private:
+    Slot* acquire_slot(uint64_t key) noexcept {
+        std::size_t idx = static_cast<std::size_t>(key) & (SLOT_COUNT - 1);
+        for (std::size_t probe = 0; probe < MAX_PROBE; ++probe) {
+            Slot& slot = slots_[(idx + probe) & (SLOT_COUNT - 1)];
+            while (slot.locked.exchange(true, std::memory_order_acquire)) {
+                KIMP_CPU_PAUSE();
+            }
+            if (slot.key == key) {
+                return &slot;
+            }
+            if (slot.key == 0) {
+                slot.key = key;
+                return &slot;
+            }
+            slot.locked.store(false, std::memory_order_release);
+        }
+        return nullptr;
+    }
+};
+
+} // namespace kimp::network
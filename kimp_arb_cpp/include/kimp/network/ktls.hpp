@@ -0,0 +1,78 @@
+#pragma once
+
+#include <openssl/ssl.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kimp::network::ktls {
+
+// Result of offering one established TLS session to the kernel
+struct Status {
+    bool tx{false};          // Kernel encrypts what we write
+    bool rx{false};          // Kernel decrypts what we read
+    const char* reason{""};  // Why not (static string; empty when both offloaded)
+
+    bool offloaded() const noexcept { return tx && rx; }
+};
+
+// One direction's TLS 1.3 application traffic keys, ready for TLS_TX/TLS_RX
+struct TrafficKeys {
+    uint16_t cipher_type{0};      // TLS_CIPHER_* from <linux/tls.h>
+    std::size_t key_len{0};
+    std::array<uint8_t, 32> key{};
+    std::array<uint8_t, 12> iv{};  // Static IV (GCM: 4-byte salt + 8-byte IV)
+    uint64_t sequence{0};          // Next record sequence number
+};
+
+struct Counters {
+    uint64_t offloaded{0};
+    uint64_t fallback{0};
+    const char* last_reason{""};
+};
+
+/**
+ * Kernel TLS (kTLS) offload for client sessions
+ *
+ * Boost.Asio's ssl::stream runs OpenSSL over a memory BIO pair, so
+ * OpenSSL's own SSL_OP_ENABLE_KTLS never engages. Instead the TLS 1.3
+ * traffic secrets are captured through the context's keylog hook, the
+ * record keys are derived here, and once the handshake is done the socket
+ * gets the "tls" ULP with TLS_TX/TLS_RX. From then on the transport reads
+ * and writes plaintext on the socket and the kernel does record crypto.
+ *
+ * Features:
+ * - Opt-in (set_enabled); every failure falls back to user-space TLS on
+ *   the same connection, with the reason recorded
+ * - TLS 1.3 with AES-128-GCM, AES-256-GCM or ChaCha20-Poly1305
+ * - Refuses when OpenSSL still holds undecrypted records (those would be
+ *   lost to the kernel's record stream)
+ * - Captured secrets are wiped once the keys are installed
+ *
+ * TLS 1.2 sessions and non-Linux builds always fall back.
+ */
+
+// Process-wide switch, set once at startup before any transport connects
+void set_enabled(bool enabled) noexcept;
+bool enabled() noexcept;
+
+// "tls" listed in /proc/sys/net/ipv4/tcp_available_ulp (module loaded)
+bool kernel_available() noexcept;
+
+// Install the secret-capture hook; call before each handshake (idempotent)
+void prepare(SSL_CTX* ctx) noexcept;
+
+// Derive this endpoint's write (tx) or read (rx) keys from captured secrets
+bool derive_keys(SSL* ssl, bool write_direction, TrafficKeys& out, const char** reason) noexcept;
+
+// Hand an established session's record layer to the kernel. On partial
+// success (RX only) the caller must keep writing through SSL.
+Status offload(SSL* ssl, int fd) noexcept;
+
+// TLS close_notify alert through an offloaded TX path (best effort)
+bool send_close_notify(int fd) noexcept;
+
+Counters counters() noexcept;
+
+} // namespace kimp::network::ktls
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+#include "kimp/memory/shm_broadcast_ring.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace kimp::network {
+
+// One normalized market-data update as it travels through shared memory.
+// Ticker/OrderBook timestamps are steady_clock (CLOCK_MONOTONIC), which is
+// the same clock in every process on the host, so latency stamps survive
+// the hop unchanged.
+struct alignas(64) MarketDataMessage {
+    enum class Kind : uint8_t { Ticker = 1, OrderBook = 2 };
+
+    static constexpr std::size_t PAYLOAD_SIZE = std::max(sizeof(Ticker), sizeof(OrderBook));
+
+    Kind kind{Kind::Ticker};
+    int64_t publish_ns{0};  // steady_clock ns when the gateway wrote it
+    alignas(64) std::array<std::byte, PAYLOAD_SIZE> payload{};
+};
+
+/**
+ * Gateway side: publishes every normalized ticker/book into a named
+ * shared-memory broadcast ring
+ *
+ * Features:
+ * - Any number of trading processes can attach; the gateway never waits
+ *   for them (slow readers lose messages and see a gap, not backpressure)
+ * - Safe to call from several exchange io threads (short spinlock around
+ *   the single-writer ring)
+ */
+class MarketDataPublisher {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 14;
+
+    static std::unique_ptr<MarketDataPublisher> create(const std::string& name,
+                                                       std::size_t capacity = DEFAULT_CAPACITY,
+                                                       std::string* error = nullptr);
+
+    void publish(const Ticker& ticker) noexcept;
+    void publish(const OrderBook& book) noexcept;
+
+    uint64_t published() const noexcept { return ring_->published(); }
+    const std::string& name() const noexcept { return ring_->name(); }
+
+private:
+    using Ring = memory::ShmBroadcastRing<MarketDataMessage>;
+
+    explicit MarketDataPublisher(std::unique_ptr<Ring> ring) noexcept : ring_(std::move(ring)) {}
+    void publish_message(MarketDataMessage::Kind kind, const void* data, std::size_t size) noexcept;
+
+    std::unique_ptr<Ring> ring_;
+    std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+};
+
+/**
+ * Trading-process side: attaches to a gateway's ring and replays its
+ * updates into the same callbacks the exchange clients would have fired
+ *
+ * Features:
+ * - Sequence-number gap detection (lost messages and overrun events)
+ * - Re-attaches automatically when the gateway restarts (new ring epoch)
+ * - Either a dedicated polling thread (start/stop) or manual poll()
+ */
+class MarketDataSubscriber {
+public:
+    using TickerCallback = std::function<void(const Ticker&)>;
+    using OrderBookCallback = std::function<void(const OrderBook&)>;
+
+    struct Stats {
+        uint64_t delivered{0};
+        uint64_t lost{0};         // Messages overwritten before we read them
+        uint64_t gaps{0};         // Overrun events
+        uint64_t reattaches{0};   // Gateway restarts followed
+        uint64_t lag_ns_max{0};   // Worst publish -> deliver latency
+    };
+
+    static std::unique_ptr<MarketDataSubscriber> attach(const std::string& name, std::string* error = nullptr);
+    ~MarketDataSubscriber();
+
+    void set_ticker_callback(TickerCallback cb) { on_ticker_ = std::move(cb); }
+    void set_orderbook_callback(OrderBookCallback cb) { on_orderbook_ = std::move(cb); }
+
+    // Drain up to max_messages available updates; returns how many were
+    // delivered. Not to be mixed with start().
+    std::size_t poll(std::size_t max_messages = SIZE_MAX);
+
+    // Switch to the gateway's current ring if it was re-created; true if so
+    bool reattach_if_restarted();
+
+    // Polling thread: spins, then yields, then naps while the ring is quiet
+    void start(int cpu_core = -1);
+    void stop();
+
+    Stats stats() const noexcept;
+    uint64_t epoch() const noexcept { return ring_->epoch(); }
+    const std::string& name() const noexcept { return name_; }
+
+private:
+    using Ring = memory::ShmBroadcastRing<MarketDataMessage>;
+
+    MarketDataSubscriber(std::string name, std::unique_ptr<Ring> ring);
+    void deliver(const MarketDataMessage& msg);
+    void run(int cpu_core);
+
+    std::string name_;
+    std::unique_ptr<Ring> ring_;
+    std::unique_ptr<Ring::Reader> reader_;
+    TickerCallback on_ticker_;
+    OrderBookCallback on_orderbook_;
+
+    // Counters carried over from rings we have detached from
+    uint64_t retired_lost_{0};
+    uint64_t retired_gaps_{0};
+
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> lost_{0};
+    std::atomic<uint64_t> gaps_{0};
+    std::atomic<uint64_t> reattaches_{0};
+    std::atomic<uint64_t> lag_ns_max_{0};
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+} // namespace kimp::network
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+namespace kimp::network {
+
+/**
+ * Deadline for blocking socket calls
+ *
+ * Beast applies no timeout to blocking reads and writes on a stream, so a
+ * REST call can wait on a silent venue for as long as TCP keeps the
+ * connection up. arm() hands a socket and its deadline to one watchdog
+ * thread, which shuts the socket down (SHUT_RDWR) once the deadline passes;
+ * the blocked read or write then fails at once. The descriptor stays open,
+ * so a late shutdown can never hit a reused descriptor as long as the
+ * owner disarms before closing it.
+ */
+class SocketDeadline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static SocketDeadline& instance();
+
+    // Token for disarm(); the socket is shut down at deadline unless disarmed
+    uint64_t arm(int fd, Clock::time_point deadline);
+    // True when the deadline fired first (the socket is shut down)
+    bool disarm(uint64_t token);
+
+    uint64_t fired() const;
+
+    // Arms on construction, disarms on release() or destruction
+    class Guard {
+    public:
+        Guard(int fd, std::chrono::milliseconds timeout)
+            : token_(SocketDeadline::instance().arm(fd, Clock::now() + timeout)) {}
+        ~Guard() { release(); }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        // Disarms once; true when the deadline fired first
+        bool release() {
+            if (token_ != 0) {
+                expired_ = SocketDeadline::instance().disarm(token_);
+                token_ = 0;
+            }
+            return expired_;
+        }
+
+    private:
+        uint64_t token_;
+        bool expired_{false};
+    };
+
+    ~SocketDeadline();
+    SocketDeadline(const SocketDeadline&) = delete;
+    SocketDeadline& operator=(const SocketDeadline&) = delete;
+
+private:
+    SocketDeadline();
+    void run();
+
+    struct Entry {
+        int fd;
+        Clock::time_point deadline;
+    };
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<uint64_t, Entry> armed_;
+    std::set<std::pair<Clock::time_point, uint64_t>> queue_;  // Earliest deadline first
+    std::set<uint64_t> expired_;                              // Fired, not yet disarmed
+    uint64_t next_token_{1};
+    uint64_t fired_{0};
+    bool stop_{false};
+    std::thread thread_;
+};
+
+} // namespace kimp::network
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/async_base.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/net_tstamp.h>
+#include <linux/tls.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>
+#endif
+
+namespace kimp::network {
+
+/**
+ * TCP stream that records the kernel receive time of the data it reads
+ *
+ * Features:
+ * - SO_TIMESTAMPING software RX timestamps (SO_TIMESTAMPNS fallback)
+ * - Reads via recvmsg() so the timestamp control message is not lost;
+ *   the stamp is that of the last skb consumed by each read
+ * - Drop-in lowest layer under beast::ssl_stream; until timestamps are
+ *   enabled every read goes through beast::tcp_stream (with its timeouts)
+ * - Linux only; elsewhere enable_rx_timestamps() reports false
+ * - With kernel TLS receive offload (enable_ktls_records) reads return
+ *   plaintext; post-handshake NewSessionTicket records are consumed here,
+ *   close_notify reads as EOF and any other control record fails the read
+ *
+ * Timestamps are CLOCK_REALTIME nanoseconds, the clock the kernel stamps in.
+ */
+class TimestampedTcpStream : public boost::beast::tcp_stream {
+public:
+    using boost::beast::tcp_stream::tcp_stream;
+
+    // Call once connected. Reads bypass tcp_stream timeouts afterwards, so
+    // enable after the TLS handshake when the websocket owns keepalive.
+    bool enable_rx_timestamps() noexcept {
+#if defined(__linux__)
+        const int fd = socket().native_handle();
+        const int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        if (::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) != 0) {
+            const int on = 1;
+            if (::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) != 0) {
+                return false;
+            }
+        }
+        rx_timestamps_ = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool rx_timestamps_enabled() const noexcept { return rx_timestamps_; }
+
+    // The kernel now owns the TLS record layer of this socket (TLS_RX set)
+    void enable_ktls_records() noexcept { ktls_records_ = true; }
+    bool ktls_records_enabled() const noexcept { return ktls_records_; }
+
+    // Kernel receive time of the most recently read segment (0 = none yet)
+    int64_t last_rx_realtime_ns() const noexcept { return last_rx_realtime_ns_; }
+
+    template<
+        class MutableBufferSequence,
+        BOOST_BEAST_ASYNC_TPARAM2 ReadHandler =
+            boost::asio::default_completion_token_t<executor_type>
+    >
+    BOOST_BEAST_ASYNC_RESULT2(ReadHandler)
+    async_read_some(
+        MutableBufferSequence const& buffers,
+        ReadHandler&& handler =
+            boost::asio::default_completion_token_t<executor_type>{}) {
+        if (!rx_timestamps_ && !ktls_records_) {
+            return boost::beast::tcp_stream::async_read_some(buffers, std::forward<ReadHandler>(handler));
+        }
+        return boost::asio::async_initiate<ReadHandler, void(boost::beast::error_code, std::size_t)>(
+            run_rx_read_op{this}, handler, buffers);
+    }
+
+    // Blocking reads (REST); same recvmsg path once it is active
+    template<class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence& buffers, boost::beast::error_code& ec) {
+        if (!rx_timestamps_ && !ktls_records_) {
+            return boost::beast::tcp_stream::read_some(buffers, ec);
+        }
+        ec = {};
+        std::size_t bytes = 0;
+        while (!try_receive(buffers, bytes, ec)) {
+            socket().wait(boost::asio::ip::tcp::socket::wait_read, ec);
+            if (ec) {
+                return 0;
+            }
+        }
+        return bytes;
+    }
+
+    template<class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence& buffers) {
+        boost::beast::error_code ec;
+        const std::size_t bytes = read_some(buffers, ec);
+        if (ec) {
+            BOOST_THROW_EXCEPTION(boost::system::system_error{ec});
+        }
+        return bytes;
+    }
+
+private:
+    static constexpr unsigned char TLS_RECORD_ALERT = 21;
+    static constexpr unsigned char TLS_RECORD_HANDSHAKE = 22;
+    static constexpr unsigned char TLS_RECORD_APPLICATION_DATA = 23;
+    static constexpr unsigned char TLS_HANDSHAKE_NEW_SESSION_TICKET = 4;
+
+    bool rx_timestamps_{false};
+    bool ktls_records_{false};
+    int64_t last_rx_realtime_ns_{0};
+    std::size_t ticket_bytes_left_{0};  // Rest of a NewSessionTicket split across reads
+
+    // One non-blocking recvmsg. False = would block, wait for readability.
+    template<class MutableBufferSequence>
+    bool try_receive(const MutableBufferSequence& buffers, std::size_t& bytes,
+                     boost::beast::error_code& ec) {
+#if defined(__linux__)
+        std::array<iovec, 16> iov{};
+        std::size_t iov_count = 0;
+        std::size_t total = 0;
+        for (auto it = boost::asio::buffer_sequence_begin(buffers);
+             it != boost::asio::buffer_sequence_end(buffers) && iov_count < iov.size(); ++it) {
+            boost::asio::mutable_buffer b(*it);
+            if (b.size() == 0) {
+                continue;
+            }
+            iov[iov_count].iov_base = b.data();
+            iov[iov_count].iov_len = b.size();
+            total += b.size();
+            ++iov_count;
+        }
+        if (total == 0) {
+            bytes = 0;
+            return true;
+        }
+
+        // Control records (session tickets) are swallowed and the read retried
+        while (true) {
+            alignas(cmsghdr) char control[CMSG_SPACE(sizeof(timespec) * 3) + CMSG_SPACE(sizeof(unsigned char))];
+            msghdr msg{};
+            msg.msg_iov = iov.data();
+            msg.msg_iovlen = iov_count;
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+
+            ssize_t n;
+            do {
+                n = ::recvmsg(socket().native_handle(), &msg, MSG_DONTWAIT);
+            } while (n < 0 && errno == EINTR);
+
+            if (n < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    return false;
+                }
+                ec.assign(errno, boost::system::system_category());
+                bytes = 0;
+                return true;
+            }
+            if (n == 0) {
+                ec = boost::asio::error::eof;
+                bytes = 0;
+                return true;
+            }
+
+            unsigned char record_type = TLS_RECORD_APPLICATION_DATA;
+            for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+                if (cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE) {
+                    record_type = *CMSG_DATA(cmsg);
+                    continue;
+                }
+                if (cmsg->cmsg_level != SOL_SOCKET) {
+                    continue;
+                }
+                if (cmsg->cmsg_type == SCM_TIMESTAMPING || cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+                    // SCM_TIMESTAMPING carries {software, legacy, hardware}; [0] is software
+                    timespec ts{};
+                    std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                    if (ts.tv_sec != 0 || ts.tv_nsec != 0) {
+                        last_rx_realtime_ns_ = static_cast<int64_t>(ts.tv_sec) * 1'000'000'000LL + ts.tv_nsec;
+                    }
+                }
+            }
+            if (record_type != TLS_RECORD_APPLICATION_DATA &&
+                !consume_control_record(record_type, iov[0], static_cast<std::size_t>(n), ec)) {
+                bytes = 0;
+                return true;
+            }
+            if (record_type != TLS_RECORD_APPLICATION_DATA) {
+                continue;
+            }
+            bytes = static_cast<std::size_t>(n);
+            return true;
+        }
+#else
+        (void)buffers;
+        bytes = 0;
+        ec = boost::asio::error::operation_not_supported;
+        return true;
+#endif
+    }
+
+#if defined(__linux__)
+    // Post-handshake TLS 1.3 records the kernel hands up instead of data.
+    // False (with ec) ends the read.
+    bool consume_control_record(unsigned char type, const iovec& first, std::size_t n,
+                                boost::beast::error_code& ec) {
+        const auto* data = static_cast<const unsigned char*>(first.iov_base);
+        const std::size_t seen = std::min(n, static_cast<std::size_t>(first.iov_len));
+        if (type == TLS_RECORD_HANDSHAKE) {
+            if (ticket_bytes_left_ > 0) {
+                ticket_bytes_left_ -= std::min(ticket_bytes_left_, n);
+                return true;
+            }
+            if (seen >= 4 && data[0] == TLS_HANDSHAKE_NEW_SESSION_TICKET) {
+                const std::size_t length = (std::size_t{data[1]} << 16) | (std::size_t{data[2]} << 8) | data[3];
+                ticket_bytes_left_ = 4 + length > n ? 4 + length - n : 0;
+                return true;
+            }
+            ec = boost::asio::error::operation_not_supported;  // KeyUpdate etc.: reconnect
+            return false;
+        }
+        if (type == TLS_RECORD_ALERT && seen >= 2 && data[1] == 0) {
+            ec = boost::asio::error::eof;  // close_notify
+            return false;
+        }
+        ec = boost::asio::error::connection_reset;
+        return false;
+    }
+#endif
+
+    template<class Handler, class Buffers>
+    class rx_read_op : public boost::beast::async_base<Handler, executor_type> {
+        TimestampedTcpStream& stream_;
+        Buffers buffers_;
+
+    public:
+        template<class Handler_>
+        rx_read_op(Handler_&& handler, TimestampedTcpStream& stream, const Buffers& buffers)
+            : boost::beast::async_base<Handler, executor_type>(
+                  std::forward<Handler_>(handler), stream.get_executor())
+            , stream_(stream)
+            , buffers_(buffers) {
+            (*this)({}, false);
+        }
+
+        void operator()(boost::beast::error_code ec, bool is_continuation = true) {
+            std::size_t bytes = 0;
+            if (!ec && !stream_.try_receive(buffers_, bytes, ec)) {
+                stream_.socket().async_wait(boost::asio::ip::tcp::socket::wait_read, std::move(*this));
+                return;
+            }
+            this->complete(is_continuation, ec, bytes);
+        }
+    };
+
+    struct run_rx_read_op {
+        TimestampedTcpStream* self;
+
+        template<class ReadHandler, class MutableBufferSequence>
+        void operator()(ReadHandler&& handler, const MutableBufferSequence& buffers) {
+            rx_read_op<std::decay_t<ReadHandler>, MutableBufferSequence>(
+                std::forward<ReadHandler>(handler), *self, buffers);
+        }
+    };
+};
+
+} // namespace kimp::network
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "kimp/network/ktls.hpp"
+#include "kimp/network/timestamped_tcp_stream.hpp"
+
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket/teardown.hpp>
+
+#include <utility>
+
+namespace kimp::network {
+
+/**
+ * TLS client stream that can hand its record layer to the kernel
+ *
+ * Features:
+ * - Same surface as beast::ssl_stream for handshake, SNI and verification
+ * - After the handshake, try_ktls_offload() moves record crypto into the
+ *   kernel (see ktls.hpp); reads and writes then go straight to the
+ *   socket and OpenSSL is no longer touched
+ * - Any refusal keeps the session on user-space TLS unchanged
+ * - Sync (REST) and async (WebSocket) reads/writes, plus websocket teardown
+ */
+class TlsStream {
+public:
+    using next_layer_type = boost::beast::ssl_stream<TimestampedTcpStream>;
+    using executor_type = next_layer_type::executor_type;
+
+    template<class... Args>
+    explicit TlsStream(Args&&... args) : ssl_(std::forward<Args>(args)...) {}
+
+    executor_type get_executor() noexcept { return ssl_.get_executor(); }
+    next_layer_type& next_layer() noexcept { return ssl_; }
+    const next_layer_type& next_layer() const noexcept { return ssl_; }
+    SSL* native_handle() noexcept { return ssl_.native_handle(); }
+    TimestampedTcpStream& tcp() noexcept { return ssl_.next_layer(); }
+
+    template<class VerifyCallback>
+    void set_verify_callback(VerifyCallback callback) {
+        ssl_.set_verify_callback(std::move(callback));
+    }
+
+    void handshake(boost::asio::ssl::stream_base::handshake_type type) { ssl_.handshake(type); }
+
+    template<class HandshakeHandler>
+    auto async_handshake(boost::asio::ssl::stream_base::handshake_type type, HandshakeHandler&& handler) {
+        return ssl_.async_handshake(type, std::forward<HandshakeHandler>(handler));
+    }
+
+    // Call once the TLS handshake completed and before any application data
+    ktls::Status try_ktls_offload() noexcept {
+        if (!ktls::enabled()) {
+            return {};
+        }
+        const ktls::Status status = ktls::offload(ssl_.native_handle(), tcp().socket().native_handle());
+        tx_offloaded_ = status.tx;
+        rx_offloaded_ = status.rx;
+        if (rx_offloaded_) {
+            tcp().enable_ktls_records();
+        }
+        return status;
+    }
+
+    bool ktls_tx() const noexcept { return tx_offloaded_; }
+    bool ktls_rx() const noexcept { return rx_offloaded_; }
+
+    template<class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence& buffers, boost::beast::error_code& ec) {
+        return rx_offloaded_ ? tcp().read_some(buffers, ec) : ssl_.read_some(buffers, ec);
+    }
+
+    template<class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence& buffers) {
+        return rx_offloaded_ ? tcp().read_some(buffers) : ssl_.read_some(buffers);
+    }
+
+    template<class ConstBufferSequence>
+    std::size_t write_some(const ConstBufferSequence& buffers, boost::beast::error_code& ec) {
+        return tx_offloaded_ ? tcp().write_some(buffers, ec) : ssl_.write_some(buffers, ec);
+    }
+
+    template<class ConstBufferSequence>
+    std::size_t write_some(const ConstBufferSequence& buffers) {
+        return tx_offloaded_ ? tcp().write_some(buffers) : ssl_.write_some(buffers);
+    }
+
+    template<class MutableBufferSequence, class ReadHandler>
+    BOOST_BEAST_ASYNC_RESULT2(ReadHandler)
+    async_read_some(const MutableBufferSequence& buffers, ReadHandler&& handler) {
+        if (rx_offloaded_) {
+            return tcp().async_read_some(buffers, std::forward<ReadHandler>(handler));
+        }
+        return ssl_.async_read_some(buffers, std::forward<ReadHandler>(handler));
+    }
+
+    template<class ConstBufferSequence, class WriteHandler>
+    BOOST_BEAST_ASYNC_RESULT2(WriteHandler)
+    async_write_some(const ConstBufferSequence& buffers, WriteHandler&& handler) {
+        if (tx_offloaded_) {
+            return tcp().async_write_some(buffers, std::forward<WriteHandler>(handler));
+        }
+        return ssl_.async_write_some(buffers, std::forward<WriteHandler>(handler));
+    }
+
+    // close_notify through whichever layer owns the records
+    void shutdown(boost::beast::error_code& ec) {
+        if (tx_offloaded_) {
+            ktls::send_close_notify(tcp().socket().native_handle());
+            ec = {};
+            return;
+        }
+        ssl_.shutdown(ec);
+    }
+
+private:
+    next_layer_type ssl_;
+    bool tx_offloaded_{false};
+    bool rx_offloaded_{false};
+};
+
+// websocket::stream<TlsStream> closes through these (found by ADL)
+inline void teardown(boost::beast::role_type role, TlsStream& stream, boost::beast::error_code& ec) {
+    if (stream.ktls_tx()) {
+        ktls::send_close_notify(stream.tcp().socket().native_handle());
+        boost::beast::websocket::teardown(role, stream.tcp().socket(), ec);
+        return;
+    }
+    using boost::beast::websocket::teardown;
+    teardown(role, stream.next_layer(), ec);
+}
+
+template<class TeardownHandler>
+void async_teardown(boost::beast::role_type role, TlsStream& stream, TeardownHandler&& handler) {
+    if (stream.ktls_tx()) {
+        ktls::send_close_notify(stream.tcp().socket().native_handle());
+        boost::beast::websocket::async_teardown(role, stream.tcp().socket(),
+                                                std::forward<TeardownHandler>(handler));
+        return;
+    }
+    using boost::beast::websocket::async_teardown;
+    async_teardown(role, stream.next_layer(), std::forward<TeardownHandler>(handler));
+}
+
+} // namespace kimp::network
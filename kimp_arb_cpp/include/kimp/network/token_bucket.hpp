@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace kimp::network {
+
+/**
+ * Thread-safe token bucket for pacing REST calls against a venue limit
+ *
+ * Features:
+ * - Steady refill at `rate` tokens/s up to `burst`
+ * - acquire() blocks the calling worker until a token is granted; waits
+ *   happen outside the lock so concurrent workers queue fairly
+ * - Server feedback: clamp() caps the local budget to what the venue says
+ *   is left in its window, pause_until() stops all grants after a 429
+ */
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats {
+        uint64_t granted{0};
+        uint64_t waited{0};      // Grants that had to sleep first
+        uint64_t clamped{0};     // Budgets reduced by server feedback
+        uint64_t paused{0};      // pause_until() calls (throttle responses)
+    };
+
+    TokenBucket(double rate_per_sec, double burst)
+        : rate_(std::max(rate_per_sec, 1e-3))
+        , burst_(std::max(burst, 1.0))
+        , tokens_(burst_)
+        , last_(Clock::now()) {}
+
+    // Take a token now if one is available, else report how long to wait
+    bool try_acquire(Clock::time_point now, Clock::duration& wait) {
+        std::lock_guard lock(mutex_);
+        if (now < paused_until_) {
+            wait = paused_until_ - now;
+            return false;
+        }
+        refill(now);
+        if (tokens_ >= 1.0) {
+            tokens_ -= 1.0;
+            ++stats_.granted;
+            return true;
+        }
+        wait = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>((1.0 - tokens_) / rate_));
+        return false;
+    }
+
+    void acquire() {
+        bool waited = false;
+        Clock::duration wait{};
+        while (!try_acquire(Clock::now(), wait)) {
+            waited = true;
+            std::this_thread::sleep_for(wait);
+        }
+        if (waited) {
+            std::lock_guard lock(mutex_);
+            ++stats_.waited;
+        }
+    }
+
+    // The venue reports `remaining` calls left in its current window
+    void clamp(double remaining) {
+        std::lock_guard lock(mutex_);
+        refill(Clock::now());
+        if (remaining < tokens_) {
+            tokens_ = std::max(remaining, 0.0);
+            ++stats_.clamped;
+        }
+    }
+
+    // No grants before `until`; the bucket restarts empty afterwards
+    void pause_until(Clock::time_point until) {
+        std::lock_guard lock(mutex_);
+        if (until > paused_until_) {
+            paused_until_ = until;
+            tokens_ = 0.0;
+            last_ = until;
+        }
+        ++stats_.paused;
+    }
+
+    // Tokens that could be granted at `now`, without taking any
+    double available(Clock::time_point now) const {
+        std::lock_guard lock(mutex_);
+        if (now < paused_until_) {
+            return 0.0;
+        }
+        const double elapsed = now > last_ ? std::chrono::duration<double>(now - last_).count() : 0.0;
+        return std::min(burst_, tokens_ + elapsed * rate_);
+    }
+
+    Stats stats() const {
+        std::lock_guard lock(mutex_);
+        return stats_;
+    }
+
+    double rate() const noexcept { return rate_; }
+    double burst() const noexcept { return burst_; }
+
+private:
+    void refill(Clock::time_point now) {
+        if (now <= last_) return;
+        const double elapsed = std::chrono::duration<double>(now - last_).count();
+        tokens_ = std::min(burst_, tokens_ + elapsed * rate_);
+        last_ = now;
+    }
+
+    const double rate_;
+    const double burst_;
+    mutable std::mutex mutex_;
+    double tokens_;
+    Clock::time_point last_;
+    Clock::time_point paused_until_{};
+    Stats stats_;
+};
+
+} // namespace kimp::network
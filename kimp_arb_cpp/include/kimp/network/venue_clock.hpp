@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace kimp::network {
+
+/**
+ * One server-time exchange with a venue: local send time, the venue's
+ * clock reading in the response, and local receive time. All three are
+ * CLOCK_REALTIME-domain nanoseconds.
+ */
+struct ClockSample {
+    int64_t local_send_ns{0};
+    int64_t server_ns{0};
+    int64_t local_recv_ns{0};
+
+    int64_t rtt_ns() const noexcept { return local_recv_ns - local_send_ns; }
+    int64_t midpoint_ns() const noexcept { return local_send_ns + rtt_ns() / 2; }
+    // Venue clock minus local clock, assuming symmetric paths
+    int64_t offset_ns() const noexcept { return server_ns - midpoint_ns(); }
+};
+
+/**
+ * NTP-style offset/drift model of one venue's clock against ours
+ *
+ * Features:
+ * - Clock filter: the offset comes from the lowest-RTT sample among the
+ *   most recent FILTER_DEPTH, whose error is bounded by RTT/2
+ * - Drift: least-squares slope over low-RTT samples of the window once they
+ *   span MIN_DRIFT_SPAN_NS; clamped to MAX_DRIFT_PPM
+ * - Venue clock steps (leap smear, restart) reset the window
+ * - Samples are added from a background thread; readers on the market-data
+ *   hot path get a consistent model through a seqlock, without locking
+ */
+class VenueClock {
+public:
+    static constexpr std::size_t WINDOW = 32;
+    static constexpr std::size_t FILTER_DEPTH = 8;
+    static constexpr int64_t MAX_RTT_NS = 2'000'000'000;
+    static constexpr int64_t GOOD_RTT_SLACK_NS = 500'000;
+    static constexpr int64_t MIN_DRIFT_SPAN_NS = 60'000'000'000;
+    static constexpr int64_t STEP_NS = 250'000'000;
+    static constexpr double MAX_DRIFT_PPM = 500.0;
+
+    struct Estimate {
+        bool synced{false};
+        int64_t offset_ns{0};     // Venue minus local at ref_local_ns
+        int64_t ref_local_ns{0};
+        double drift_ppm{0.0};    // d(offset)/dt
+        int64_t rtt_ns{0};        // RTT of the sample the offset came from
+        int64_t error_ns{0};      // Offset uncertainty bound (RTT/2)
+        std::size_t samples{0};
+
+        int64_t offset_at(int64_t local_ns) const noexcept {
+            return offset_ns + static_cast<int64_t>(
+                drift_ppm * 1e-6 * static_cast<double>(local_ns - ref_local_ns));
+        }
+        // Venue timestamp -> local clock
+        int64_t venue_to_local_ns(int64_t venue_ns) const noexcept {
+            return venue_ns - offset_at(venue_ns - offset_ns);
+        }
+        int64_t local_to_venue_ns(int64_t local_ns) const noexcept {
+            return local_ns + offset_at(local_ns);
+        }
+    };
+
+    // False when the sample is unusable (non-positive or oversized RTT)
+    bool add_sample(const ClockSample& sample) {
+        const int64_t rtt = sample.rtt_ns();
+        if (rtt <= 0 || rtt > MAX_RTT_NS || sample.server_ns <= 0) {
+            return false;
+        }
+
+        std::lock_guard lock(mutex_);
+        if (!window_.empty()) {
+            const Estimate current = estimate();
+            const int64_t residual = sample.offset_ns() - current.offset_at(sample.midpoint_ns());
+            if (std::llabs(residual) > STEP_NS + rtt / 2 + current.error_ns) {
+                window_.clear();
+                ++steps_;
+            }
+        }
+        window_.push_back(sample);
+        if (window_.size() > WINDOW) {
+            window_.pop_front();
+        }
+        publish(fit());
+        return true;
+    }
+
+    Estimate estimate() const noexcept {
+        Estimate est;
+        uint64_t seq0;
+        uint64_t seq1;
+        do {
+            seq0 = seq_.load(std::memory_order_acquire);
+            est.offset_ns = offset_ns_.load(std::memory_order_relaxed);
+            est.ref_local_ns = ref_local_ns_.load(std::memory_order_relaxed);
+            est.drift_ppm = drift_ppm_.load(std::memory_order_relaxed);
+            est.rtt_ns = rtt_ns_.load(std::memory_order_relaxed);
+            est.samples = samples_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq1 = seq_.load(std::memory_order_relaxed);
+        } while ((seq0 & 1) != 0 || seq0 != seq1);
+        est.synced = est.samples > 0;
+        est.error_ns = est.rtt_ns / 2;
+        return est;
+    }
+
+    bool synced() const noexcept { return samples_.load(std::memory_order_relaxed) > 0; }
+
+    uint64_t steps() const {
+        std::lock_guard lock(mutex_);
+        return steps_;
+    }
+
+private:
+    Estimate fit() const {
+        Estimate est;
+        est.synced = true;
+        est.samples = window_.size();
+
+        // Clock filter over the most recent samples
+        const std::size_t first = window_.size() > FILTER_DEPTH ? window_.size() - FILTER_DEPTH : 0;
+        const ClockSample* best = &window_[first];
+        for (std::size_t i = first + 1; i < window_.size(); ++i) {
+            if (window_[i].rtt_ns() < best->rtt_ns()) {
+                best = &window_[i];
+            }
+        }
+        est.offset_ns = best->offset_ns();
+        est.ref_local_ns = best->midpoint_ns();
+        est.rtt_ns = best->rtt_ns();
+        est.error_ns = est.rtt_ns / 2;
+
+        // Drift from low-RTT samples only; queueing on slow samples is one-sided
+        int64_t min_rtt = window_.front().rtt_ns();
+        for (const auto& s : window_) {
+            min_rtt = std::min(min_rtt, s.rtt_ns());
+        }
+        const int64_t good_rtt = 2 * min_rtt + GOOD_RTT_SLACK_NS;
+        double n = 0.0;
+        double sum_t = 0.0;
+        double sum_o = 0.0;
+        int64_t t_min = INT64_MAX;
+        int64_t t_max = INT64_MIN;
+        for (const auto& s : window_) {
+            if (s.rtt_ns() > good_rtt) continue;
+            const int64_t t = s.midpoint_ns();
+            n += 1.0;
+            sum_t += static_cast<double>(t - est.ref_local_ns);
+            sum_o += static_cast<double>(s.offset_ns() - est.offset_ns);
+            t_min = std::min(t_min, t);
+            t_max = std::max(t_max, t);
+        }
+        if (n < 3.0 || t_max - t_min < MIN_DRIFT_SPAN_NS) {
+            return est;
+        }
+        const double mean_t = sum_t / n;
+        const double mean_o = sum_o / n;
+        double sxx = 0.0;
+        double sxy = 0.0;
+        for (const auto& s : window_) {
+            if (s.rtt_ns() > good_rtt) continue;
+            const double dt = static_cast<double>(s.midpoint_ns() - est.ref_local_ns) - mean_t;
+            const double dofs = static_cast<double>(s.offset_ns() - est.offset_ns) - mean_o;
+            sxx += dt * dt;
+            sxy += dt * dofs;
+        }
+        if (sxx > 0.0) {
+            est.drift_ppm = std::clamp(sxy / sxx * 1e6, -MAX_DRIFT_PPM, MAX_DRIFT_PPM);
+        }
+        return est;
+    }
+
+    void publish(const Estimate& est) noexcept {
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        offset_ns_.store(est.offset_ns, std::memory_order_relaxed);
+        ref_local_ns_.store(est.ref_local_ns, std::memory_order_relaxed);
+        drift_ppm_.store(est.drift_ppm, std::memory_order_relaxed);
+        rtt_ns_.store(est.rtt_ns, std::memory_order_relaxed);
+        samples_.store(est.samples, std::memory_order_relaxed);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    mutable std::mutex mutex_;
+    std::deque<ClockSample> window_;
+    uint64_t steps_{0};
+
+    std::atomic<uint64_t> seq_{0};
+    std::atomic<int64_t> offset_ns_{0};
+    std::atomic<int64_t> ref_local_ns_{0};
+    std::atomic<double> drift_ppm_{0.0};
+    std::atomic<int64_t> rtt_ns_{0};
+    std::atomic<std::size_t> samples_{0};
+};
+
+} // namespace kimp::network
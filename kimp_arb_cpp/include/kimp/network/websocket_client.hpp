@@ -3,6 +3,9 @@
 #include "kimp/core/types.hpp"
 #include "kimp/core/logger.hpp"
 #include "kimp/memory/ring_buffer.hpp"
+#include "kimp/network/busy_poll_reactor.hpp"
+#include "kimp/network/timestamped_tcp_stream.hpp"
+#include "kimp/network/tls_stream.hpp"
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/ssl.hpp>
@@ -11,6 +14,8 @@
 #include <boost/asio/strand.hpp>
 #include <boost/asio/steady_timer.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <string_view>
 #include <functional>
@@ -20,6 +25,7 @@
 #include <filesystem>
 #include <cstdlib>
 #include <unordered_map>
+#include <vector>
 
 namespace kimp::network {
 
@@ -50,20 +56,44 @@ using ConnectCallback = std::function<void(bool success, const std::string& erro
 using DisconnectCallback = std::function<void(const std::string& reason)>;
 using ErrorCallback = std::function<void(const std::string& error)>;
 using HandshakeHeadersCallback = std::function<std::unordered_map<std::string, std::string>()>;
+using StallCallback = std::function<void(int64_t silent_ms)>;
+
+// permessage-deflate (RFC 7692) offer for one connection. Takes effect on
+// the next connect; venues that do not support it simply decline.
+struct DeflateOptions {
+    bool enabled{false};
+    bool context_takeover{true};  // Keep the window across messages (better ratio, ~32KB state per side)
+    int max_window_bits{15};      // 9..15; smaller windows trade ratio for memory
+};
+
+// Receive timing of the frame being delivered, CLOCK_REALTIME ns. Zero when
+// kernel timestamps are off or unavailable. Valid only inside the message
+// callback (set per frame by WebSocketClient::on_read).
+struct FrameRxInfo {
+    int64_t kernel_rx_ns{0};  // Kernel RX time of the frame's last segment
+    int64_t handler_ns{0};    // When on_read started handling the frame
+
+    bool valid() const noexcept { return kernel_rx_ns != 0; }
+    int64_t queue_ns() const noexcept { return valid() ? handler_ns - kernel_rx_ns : 0; }
+};
 
 /**
  * High-performance WebSocket client using Boost.Beast
  *
  * Features:
  * - SSL/TLS support
- * - Automatic reconnection
+ * - Automatic reconnection (immediate first retry, exponential backoff)
  * - Heartbeat/ping-pong
+ * - Application-level stall detection (no frames within a budget)
+ * - Optional kernel RX timestamps per frame (socket-to-handler delay)
+ * - Optional permessage-deflate; the inflate state lives with the stream
+ *   and is reused across messages (and across frames with context takeover)
  * - Async message sending
  * - Thread-safe operation
  */
 class WebSocketClient : public std::enable_shared_from_this<WebSocketClient> {
 public:
-    using WebSocketStream = websocket::stream<beast::ssl_stream<beast::tcp_stream>>;
+    using WebSocketStream = websocket::stream<TlsStream>;
 
 private:
     // Networking
@@ -74,6 +104,7 @@ private:
     tcp::resolver resolver_;
     net::steady_timer reconnect_timer_;
     net::steady_timer ping_timer_;
+    net::steady_timer stall_timer_;
 
     // Connection info
     std::string host_;
@@ -82,15 +113,30 @@ private:
     std::string name_;  // For logging
     std::unordered_map<std::string, std::string> handshake_headers_;
     HandshakeHeadersCallback handshake_headers_callback_;
+    std::size_t endpoint_preference_{0};  // Index of resolved address tried first
+    bool rx_timestamping_{false};
+    SocketTuning socket_tuning_;
+    DeflateOptions deflate_;
+    websocket::response_type handshake_response_;
+    std::atomic<bool> deflate_negotiated_{false};
+    static inline thread_local FrameRxInfo current_frame_rx_{};
 
     // State - cache-line aligned to prevent false sharing
     alignas(memory::CACHE_LINE_SIZE) std::atomic<ConnectionState> state_{ConnectionState::Disconnected};
     alignas(memory::CACHE_LINE_SIZE) std::atomic<bool> should_reconnect_{true};
     std::atomic<int> reconnect_attempts_{0};  // Same cache line as should_reconnect_ (both infrequent)
+    std::atomic<bool> forced_reconnect_{false};
     static constexpr int MAX_RECONNECT_ATTEMPTS = 0;  // 0 = unlimited (never give up)
-    static constexpr int RECONNECT_DELAY_MS = 1000;
+    static constexpr int RECONNECT_DELAY_MS = 250;        // Second attempt; first is immediate
     static constexpr int RECONNECT_MAX_DELAY_MS = 30000;  // Cap delay at 30 seconds
     static constexpr int PING_INTERVAL_MS = 30000;
+    static constexpr int STALL_MIN_CHECK_MS = 50;
+
+    // Stall detection: 0 = disabled. last_message_ns_ is steady-clock time of
+    // the last frame (or of the handshake before the first frame).
+    std::atomic<int64_t> stall_timeout_ms_{0};
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<int64_t> last_message_ns_{0};
+    StallCallback on_stall_;
 
     // Buffers - cache-line aligned for write path
     beast::flat_buffer read_buffer_;
@@ -114,6 +160,7 @@ public:
         , resolver_(net::make_strand(ioc))
         , reconnect_timer_(ioc)
         , ping_timer_(ioc)
+        , stall_timer_(ioc)
         , name_(std::move(name)) {
 
         // Pre-allocate read buffer to avoid growth-triggered copies
@@ -137,6 +184,8 @@ public:
     void set_connect_callback(ConnectCallback cb) { on_connect_ = std::move(cb); }
     void set_disconnect_callback(DisconnectCallback cb) { on_disconnect_ = std::move(cb); }
     void set_error_callback(ErrorCallback cb) { on_error_ = std::move(cb); }
+    // Without a stall callback a stalled session is dropped and reconnected.
+    void set_stall_callback(StallCallback cb) { on_stall_ = std::move(cb); }
 
     // Connection management
     void connect(const std::string& url);
@@ -149,6 +198,23 @@ public:
     void set_handshake_headers_callback(HandshakeHeadersCallback cb) {
         handshake_headers_callback_ = std::move(cb);
     }
+    // Rotate the resolved address list so redundant connections land on
+    // different venue IPs when DNS returns more than one.
+    void set_endpoint_preference(std::size_t index) { endpoint_preference_ = index; }
+    // Declare the session stalled when no frame arrives within timeout while
+    // connected. Catches half-open sockets long before TCP or ping notices.
+    void set_stall_timeout(std::chrono::milliseconds timeout) {
+        stall_timeout_ms_.store(timeout.count(), std::memory_order_relaxed);
+    }
+    // Stamp every frame with its kernel receive time (takes effect on the
+    // next connect; silently off where the kernel does not support it).
+    void set_rx_timestamping(bool enabled) { rx_timestamping_ = enabled; }
+    // SO_BUSY_POLL / SO_RCVBUF for this connection (applied on each connect)
+    void set_socket_tuning(const SocketTuning& tuning) { socket_tuning_ = tuning; }
+    // permessage-deflate offer (applied on each connect)
+    void set_deflate(const DeflateOptions& options) { deflate_ = options; }
+    // Drop the current session now and reconnect without backoff.
+    void force_reconnect(const std::string& reason);
 
     // Send message
     void send(std::string message);
@@ -158,6 +224,46 @@ public:
     ConnectionState state() const noexcept { return state_.load(); }
     bool is_connected() const noexcept { return state_.load() == ConnectionState::Connected; }
     const std::string& name() const noexcept { return name_; }
+    // Server accepted permessage-deflate on the current session
+    bool deflate_negotiated() const noexcept { return deflate_negotiated_.load(std::memory_order_relaxed); }
+    int64_t last_message_age_ms() const noexcept {
+        const int64_t last = last_message_ns_.load(std::memory_order_relaxed);
+        return last == 0 ? -1 : (steady_now_ns() - last) / 1'000'000;
+    }
+
+    // Receive timing of the frame currently in the message callback
+    static const FrameRxInfo& current_frame_rx() noexcept { return current_frame_rx_; }
+
+    // Publishes receive timing for the frame being delivered on this thread
+    struct FrameRxScope {
+        explicit FrameRxScope(FrameRxInfo info) noexcept { current_frame_rx_ = info; }
+        ~FrameRxScope() { current_frame_rx_ = FrameRxInfo{}; }
+        FrameRxScope(const FrameRxScope&) = delete;
+        FrameRxScope& operator=(const FrameRxScope&) = delete;
+    };
+
+    // Reconnect delay for the n-th consecutive attempt (1-based): 0, 250,
+    // 500, 1000 ... ms capped at RECONNECT_MAX_DELAY_MS.
+    static int reconnect_delay_ms(int attempt) noexcept {
+        if (attempt <= 1) {
+            return 0;
+        }
+        const int shift = std::min(attempt - 2, 16);
+        return std::min(RECONNECT_DELAY_MS << shift, RECONNECT_MAX_DELAY_MS);
+    }
+
+    // Beast option for an offer; also used by the deflate benchmark so it
+    // measures exactly what the client negotiates
+    static websocket::permessage_deflate deflate_option(const DeflateOptions& options) noexcept {
+        websocket::permessage_deflate pmd;
+        pmd.client_enable = options.enabled;
+        const int bits = std::clamp(options.max_window_bits, 9, 15);
+        pmd.client_max_window_bits = bits;
+        pmd.server_max_window_bits = bits;
+        pmd.client_no_context_takeover = !options.context_takeover;
+        pmd.server_no_context_takeover = !options.context_takeover;
+        return pmd;
+    }
 
     // Disable auto-reconnect
     void disable_reconnect() { should_reconnect_ = false; }
@@ -193,6 +299,18 @@ private:
     void schedule_ping();
     void on_ping_timer(beast::error_code ec);
 
+    // Stall detection
+    void schedule_stall_check();
+    void on_stall_timer(beast::error_code ec);
+    static int64_t steady_now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    static int64_t realtime_now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
     // Error handling
     void handle_error(const std::string& operation, beast::error_code ec);
     void notify_error(const std::string& error);
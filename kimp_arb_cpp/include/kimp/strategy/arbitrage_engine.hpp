@@ -3,7 +3,12 @@
 #include "kimp/core/types.hpp"
 #include "kimp/exchange/exchange_base.hpp"
 #include "kimp/memory/atomic_bitset.hpp"
+#include "kimp/memory/grow_only_map.hpp"
 #include "kimp/memory/ring_buffer.hpp"
+#include "kimp/strategy/borrow_cost.hpp"
+#include "kimp/strategy/fill_risk.hpp"
+#include "kimp/strategy/fx_estimator.hpp"
+#include "kimp/strategy/trade_stats.hpp"
 
 #include <array>
 #include <atomic>
@@ -44,6 +49,29 @@ public:
         uint64_t refreshed_at_ms{0};
     };
 
+    // Staged transfer-route inputs, built off to the side by a refresh.
+    // Venues present here replace their previous data wholesale; venues
+    // absent (fetch failed or disabled) keep the last published data.
+    struct TransferRouteUpdate {
+        std::unordered_map<Exchange, std::unordered_map<std::string, std::vector<NetworkFee>>> withdraw_fees;
+        std::unordered_map<Exchange, std::unordered_map<std::string, std::unordered_set<std::string>>> deposit_nets;
+        std::unordered_map<Exchange, std::unordered_map<std::string, bool>> withdraw_enabled;
+
+        bool empty() const noexcept {
+            return withdraw_fees.empty() && deposit_nets.empty() && withdraw_enabled.empty();
+        }
+    };
+
+    // What changed between two published transfer snapshots
+    struct TransferRouteDiff {
+        std::vector<std::string> changed_coins;  // Sorted, unique
+        size_t routes_opened{0};
+        size_t routes_closed{0};
+        size_t fees_changed{0};  // Still open, different fee or network
+
+        bool any() const noexcept { return !changed_coins.empty(); }
+    };
+
     struct PriceData {
         double bid{0.0};
         double ask{0.0};
@@ -52,6 +80,12 @@ public:
         double last{0.0};
         uint64_t timestamp{0};
         bool valid{false};
+        uint64_t event_ts{0};  // Venue event time, clock-offset corrected (steady ms, 0 = unknown)
+
+        // Quote time for freshness checks: when the venue produced it if known
+        uint64_t quote_ts() const noexcept {
+            return event_ts != 0 ? std::min(event_ts, timestamp) : timestamp;
+        }
     };
 
 private:
@@ -62,6 +96,7 @@ private:
         std::atomic<double> ask_qty{0.0};
         std::atomic<double> last{0.0};
         std::atomic<uint64_t> timestamp{0};
+        std::atomic<uint64_t> event_ts{0};
     };
 
     // Zero-allocation composite key (exchange + symbol)
@@ -188,7 +223,8 @@ private:
 
 public:
     void update(Exchange ex, const SymbolId& symbol, double bid, double ask, double last,
-                uint64_t timestamp_ms = 0, double bid_qty = 0.0, double ask_qty = 0.0) {
+                uint64_t timestamp_ms = 0, double bid_qty = 0.0, double ask_qty = 0.0,
+                uint64_t event_ts_ms = 0) {
         PriceKey key = make_key(ex, symbol);
         auto& shard = shard_for(key);
         const uint64_t ts = (timestamp_ms != 0)
@@ -210,6 +246,7 @@ public:
                     it->second.ask_qty.store(ask_qty, std::memory_order_relaxed);
                 }
                 it->second.last.store(last, std::memory_order_relaxed);
+                it->second.event_ts.store(event_ts_ms, std::memory_order_relaxed);
                 it->second.timestamp.store(ts, std::memory_order_release);
                 return;
             }
@@ -223,6 +260,7 @@ public:
         entry.bid_qty.store(bid_qty, std::memory_order_relaxed);
         entry.ask_qty.store(ask_qty, std::memory_order_relaxed);
         entry.last.store(last, std::memory_order_relaxed);
+        entry.event_ts.store(event_ts_ms, std::memory_order_relaxed);
         entry.timestamp.store(ts, std::memory_order_release);
     }
 
@@ -255,7 +293,8 @@ public:
             entry.ask_qty.load(std::memory_order_relaxed),
             entry.last.load(std::memory_order_relaxed),
             ts,
-            true  // valid
+            true,  // valid
+            entry.event_ts.load(std::memory_order_relaxed)
         };
     }
 
@@ -341,6 +380,78 @@ public:
     // combination into a flat lock-free map for zero-overhead hot-path reads.
     void finalize_withdraw_fees() {
         std::shared_lock lock(withdraw_fee_mutex_);
+        std::shared_ptr<const TransferSnapshot> published = build_transfer_snapshot_locked();
+        std::atomic_store_explicit(&transfer_snapshot_, std::move(published), std::memory_order_release);
+    }
+
+    // Transactional refresh: swap in every staged venue and publish the
+    // rebuilt snapshot under one lock, so readers see either the old route
+    // set or the new one, never a partially cleared venue. Returns the
+    // coins whose routes changed so callers can re-evaluate only those.
+    TransferRouteDiff apply_transfer_routes(TransferRouteUpdate update) {
+        for (auto& [ex, coin_map] : update.withdraw_fees) {
+            for (auto& [coin, fees] : coin_map) {
+                for (auto& nf : fees) nf.network = normalize_chain(nf.network);
+            }
+        }
+        for (auto& [ex, coin_map] : update.deposit_nets) {
+            for (auto& [coin, nets] : coin_map) {
+                std::unordered_set<std::string> canonical;
+                for (const auto& n : nets) canonical.insert(normalize_chain(n));
+                nets = std::move(canonical);
+            }
+        }
+
+        std::unique_lock lock(withdraw_fee_mutex_);
+        for (auto& [ex, coin_map] : update.withdraw_fees) {
+            withdraw_network_fees_[ex] = std::move(coin_map);
+        }
+        for (auto& [ex, coin_map] : update.deposit_nets) {
+            foreign_deposit_nets_[ex] = std::move(coin_map);
+        }
+        for (auto& [ex, coin_map] : update.withdraw_enabled) {
+            korean_withdraw_enabled_[ex] = std::move(coin_map);
+        }
+
+        auto next = build_transfer_snapshot_locked();
+        auto prev = std::atomic_load_explicit(&transfer_snapshot_, std::memory_order_acquire);
+        TransferRouteDiff diff = diff_transfer_snapshots(*prev, *next);
+        std::shared_ptr<const TransferSnapshot> published = std::move(next);
+        std::atomic_store_explicit(&transfer_snapshot_, std::move(published), std::memory_order_release);
+        return diff;
+    }
+
+    size_t precomputed_fee_count() const {
+        auto snapshot = std::atomic_load_explicit(&transfer_snapshot_, std::memory_order_acquire);
+        return snapshot->fees.size();
+    }
+
+    size_t available_transfer_route_count() const {
+        auto snapshot = std::atomic_load_explicit(&transfer_snapshot_, std::memory_order_acquire);
+        size_t total = 0;
+        for (const auto& [_, route] : snapshot->routes) {
+            if (route.available) ++total;
+        }
+        return total;
+    }
+
+    size_t withdraw_fee_count() const {
+        std::shared_lock lock(withdraw_fee_mutex_);
+        size_t total = 0;
+        for (const auto& [_, m] : withdraw_network_fees_) total += m.size();
+        return total;
+    }
+
+    size_t withdraw_fee_count(Exchange ex) const {
+        std::shared_lock lock(withdraw_fee_mutex_);
+        auto it = withdraw_network_fees_.find(ex);
+        return (it != withdraw_network_fees_.end()) ? it->second.size() : 0;
+    }
+
+private:
+    // Precomputes the route for every (korean_ex, foreign_ex, coin) from the
+    // stored venue data. Must be called with withdraw_fee_mutex_ held.
+    std::shared_ptr<TransferSnapshot> build_transfer_snapshot_locked() const {
         auto snapshot = std::make_shared<TransferSnapshot>();
         snapshot->refreshed_at_ms = static_cast<uint64_t>(
             std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -383,38 +494,45 @@ public:
                 }
             }
         }
-        std::shared_ptr<const TransferSnapshot> published = snapshot;
-        std::atomic_store_explicit(&transfer_snapshot_, std::move(published), std::memory_order_release);
+        return snapshot;
     }
 
-    size_t precomputed_fee_count() const {
-        auto snapshot = std::atomic_load_explicit(&transfer_snapshot_, std::memory_order_acquire);
-        return snapshot->fees.size();
+    static std::string_view coin_of_fee_key(const std::string& key) noexcept {
+        return key.size() > 4 ? std::string_view(key).substr(4) : std::string_view{};
     }
 
-    size_t available_transfer_route_count() const {
-        auto snapshot = std::atomic_load_explicit(&transfer_snapshot_, std::memory_order_acquire);
-        size_t total = 0;
-        for (const auto& [_, route] : snapshot->routes) {
-            if (route.available) ++total;
-        }
-        return total;
-    }
+    static TransferRouteDiff diff_transfer_snapshots(const TransferSnapshot& prev,
+                                                     const TransferSnapshot& next) {
+        TransferRouteDiff diff;
+        std::unordered_set<std::string> changed;
+        auto route_changed = [](const TransferRoute& a, const TransferRoute& b) {
+            return a.available != b.available || a.withdraw_open != b.withdraw_open ||
+                   a.deposit_open != b.deposit_open || a.fee_coins != b.fee_coins ||
+                   a.network != b.network;
+        };
 
-    size_t withdraw_fee_count() const {
-        std::shared_lock lock(withdraw_fee_mutex_);
-        size_t total = 0;
-        for (const auto& [_, m] : withdraw_network_fees_) total += m.size();
-        return total;
-    }
+        static const TransferRoute closed{};
+        for (const auto& [key, route] : next.routes) {
+            auto it = prev.routes.find(key);
+            const TransferRoute& before = it != prev.routes.end() ? it->second : closed;
+            if (!route_changed(before, route)) continue;
+            changed.emplace(coin_of_fee_key(key));
+            if (route.available && !before.available) ++diff.routes_opened;
+            else if (!route.available && before.available) ++diff.routes_closed;
+            else if (route.available) ++diff.fees_changed;
+        }
+        for (const auto& [key, route] : prev.routes) {
+            if (next.routes.count(key)) continue;
+            if (!route_changed(route, closed)) continue;
+            changed.emplace(coin_of_fee_key(key));
+            if (route.available) ++diff.routes_closed;
+        }
 
-    size_t withdraw_fee_count(Exchange ex) const {
-        std::shared_lock lock(withdraw_fee_mutex_);
-        auto it = withdraw_network_fees_.find(ex);
-        return (it != withdraw_network_fees_.end()) ? it->second.size() : 0;
+        diff.changed_coins.assign(changed.begin(), changed.end());
+        std::sort(diff.changed_coins.begin(), diff.changed_coins.end());
+        return diff;
     }
 
-private:
     // Must be called with withdraw_fee_mutex_ held (shared or exclusive).
     TransferRoute get_withdraw_fee_locked(Exchange korean_ex, Exchange foreign_ex,
                                           const std::string& base,
@@ -629,16 +747,16 @@ private:
     std::atomic<double> realized_pnl_usd_{0.0};       // Accumulated P&L in USD
     std::atomic<int> total_trades_{0};                 // Total trades closed
     std::atomic<int> winning_trades_{0};               // Winning trades count
-    mutable std::mutex history_mutex_;
-    std::vector<double> pnl_history_;                  // P&L per trade for stats
+    TradeStats stats_{TradingConfig::TOTAL_CAPITAL_USD};  // Streaming per-trade stats (constant memory)
 
 public:
     CapitalTracker() = default;
     explicit CapitalTracker(double initial_capital)
-        : initial_capital_(initial_capital), realized_pnl_usd_(0.0) {}
+        : initial_capital_(initial_capital), realized_pnl_usd_(0.0), stats_(initial_capital) {}
 
     void set_initial_capital(double capital) {
         initial_capital_.store(capital, std::memory_order_release);
+        stats_.set_initial_equity(capital);
     }
 
     double get_initial_capital() const {
@@ -656,6 +774,18 @@ public:
 
     // Add P&L from closed position (in USD)
     void add_realized_pnl(double pnl_usd) {
+        add_realized_pnl_totals(pnl_usd);
+        stats_.record(pnl_usd);
+    }
+
+    // Same, attributed to a symbol and exchange pair for the breakdowns
+    void add_realized_pnl(double pnl_usd, const SymbolId& symbol, Exchange korean, Exchange foreign) {
+        add_realized_pnl_totals(pnl_usd);
+        stats_.record(pnl_usd, symbol, korean, foreign);
+    }
+
+private:
+    void add_realized_pnl_totals(double pnl_usd) {
         // Update atomic P&L
         double current = realized_pnl_usd_.load(std::memory_order_relaxed);
         while (!realized_pnl_usd_.compare_exchange_weak(
@@ -666,14 +796,10 @@ public:
         if (pnl_usd > 0) {
             winning_trades_.fetch_add(1, std::memory_order_relaxed);
         }
-
-        // Store in history for stats
-        {
-            std::lock_guard lock(history_mutex_);
-            pnl_history_.push_back(pnl_usd);
-        }
     }
 
+public:
+
     // Dynamic position size: capped by POSITION_SIZE_USD (per side)
     double get_position_size_usd() const {
         double current = get_current_capital();
@@ -709,10 +835,15 @@ public:
         return (get_realized_pnl() / initial) * 100.0;
     }
 
-    // Get P&L history for analysis
+    // Streaming stats: O(1) lock-free summary and breakdowns
+    const TradeStats& stats() const { return stats_; }
+    TradeStats& stats() { return stats_; }
+
+    // P&L of the most recent trades (bounded by the stats history ring)
     std::vector<double> get_pnl_history() const {
-        std::lock_guard lock(history_mutex_);
-        return pnl_history_;
+        std::vector<double> out;
+        for (const auto& rec : stats_.recent_trades()) out.push_back(rec.pnl_usd);
+        return out;
     }
 
     // Reset for new session (keeps initial capital)
@@ -720,10 +851,7 @@ public:
         realized_pnl_usd_.store(0.0, std::memory_order_release);
         total_trades_.store(0, std::memory_order_release);
         winning_trades_.store(0, std::memory_order_release);
-        {
-            std::lock_guard lock(history_mutex_);
-            pnl_history_.clear();
-        }
+        stats_.reset();
     }
 };
 
@@ -751,6 +879,7 @@ public:
         double bybit_total_fee_krw{0.0};
         double withdraw_fee_coins{0.0};   // Korean exchange withdrawal fee in coin units
         double withdraw_fee_krw{0.0};     // Network transfer fee (Korean → Foreign) in KRW
+        double borrow_cost_krw{0.0};      // Short's borrow interest over the expected hold in KRW
         double total_fee_krw{0.0};
         double gross_spread_krw{0.0};
         double gross_edge_pct{0.0};
@@ -837,6 +966,20 @@ public:
 
         return metrics;
     }
+
+    // Charge the short's borrow interest over the expected hold like a fee.
+    // hold_cost_rate: share of the short notional (BorrowCostModel::hold_cost_rate)
+    static void apply_borrow_cost(RelayMetrics& metrics, double hold_cost_rate) {
+        if (hold_cost_rate <= 0.0 || metrics.match_sell_krw <= 0.0) {
+            return;
+        }
+        metrics.borrow_cost_krw = metrics.match_sell_krw * hold_cost_rate;
+        metrics.total_fee_krw += metrics.borrow_cost_krw;
+        metrics.net_profit_krw = metrics.gross_spread_krw - metrics.total_fee_krw;
+        metrics.net_basis_krw = metrics.match_buy_krw + metrics.total_fee_krw;
+        metrics.net_edge_pct = metrics.net_basis_krw > 0.0
+            ? (metrics.net_profit_krw / metrics.net_basis_krw) * 100.0 : 0.0;
+    }
 };
 
 /**
@@ -879,6 +1022,7 @@ public:
         double withdraw_fee_krw{0.0};
         double total_fee_krw{0.0};
         double net_profit_krw{0.0};
+        double adverse_move_pct{0.0};  // Expected premium move while the legs are in flight
         bool both_can_fill_target{false};
         uint64_t age_ms{0};
         bool quote_usable{false};
@@ -900,7 +1044,8 @@ public:
 
     // Configuration
     void set_exchange(Exchange ex, ExchangePtr exchange);
-    void add_symbol(const SymbolId& symbol);
+    // Safe while running (new listings); true when the symbol was added
+    bool add_symbol(const SymbolId& symbol);
     void add_exchange_pair(Exchange korean, Exchange foreign);
     void set_exchange_pair_entry_enabled(Exchange korean, Exchange foreign, bool enabled);
 
@@ -910,7 +1055,8 @@ public:
 
     // Data updates
     void on_ticker_update(const Ticker& ticker);
-    void on_usdt_update(Exchange ex, double price);
+    // Single USDT/KRW price from ex; true when it moved the published composite
+    bool on_usdt_update(Exchange ex, double price);
 
     // Position management
     void open_position(const Position& pos) { position_tracker_.open_position(pos); }
@@ -937,6 +1083,9 @@ public:
     double get_current_capital() const { return capital_tracker_.get_current_capital(); }
     double get_position_size_usd() const { return capital_tracker_.get_position_size_usd(); }
     void add_realized_pnl(double pnl_usd) { capital_tracker_.add_realized_pnl(pnl_usd); }
+    void add_realized_pnl(double pnl_usd, const SymbolId& symbol, Exchange korean, Exchange foreign) {
+        capital_tracker_.add_realized_pnl(pnl_usd, symbol, korean, foreign);
+    }
     const CapitalTracker& get_capital_tracker() const { return capital_tracker_; }
 
     // Signals
@@ -949,11 +1098,34 @@ public:
     std::vector<TransferBlockInfo> get_transfer_blocked_symbols() const;
     const PriceCache& get_price_cache() const { return price_cache_; }
     PriceCache& get_price_cache() { return price_cache_; }
+    // Route scoring: per-symbol volatility and per-venue leg latency
+    const FillRiskModel& get_fill_risk() const { return fill_risk_; }
+    FillRiskModel& get_fill_risk() { return fill_risk_; }
+
+    const BorrowCostModel& get_borrow_cost() const { return borrow_cost_; }
+    BorrowCostModel& get_borrow_cost() { return borrow_cost_; }
+    // Publish hourly borrow rates (coin -> rate) of a foreign venue; coins
+    // absent from the map keep their last rate. Returns the bases whose
+    // rate changed, sorted, for refresh_entry_filters()
+    std::vector<std::string> apply_borrow_rates(Exchange foreign,
+                                                const std::unordered_map<std::string, double>& hourly_rates);
+    // Current hourly rate of a monitored symbol's short (0 when unknown)
+    double get_borrow_rate(Exchange foreign, const SymbolId& korean_symbol) const;
+    // Accrued borrow interest of an open position, premium pct
+    double get_borrow_cost_pct(const Position& pos) const {
+        return BorrowCostModel::accrued_pct(pos, get_borrow_rate(pos.foreign_exchange, pos.symbol),
+                                            std::chrono::system_clock::now());
+    }
+    // Composite USDT/KRW rate published to every Korean venue's cache slot
+    const UsdtKrwEstimator& get_usdt_estimator() const { return usdt_fx_; }
+    void set_usdt_estimator_options(const UsdtKrwEstimator::Options& options) { usdt_fx_.set_options(options); }
 
     // Market data update signaling (for event-driven waits)
     uint64_t get_update_seq() const { return update_seq_.load(std::memory_order_acquire); }
     void wait_for_update(uint64_t last_seq, std::chrono::milliseconds timeout) const;
     void refresh_entry_filters();
+    // Re-evaluate only symbols whose base is in `bases` (sorted), e.g. after a transfer-route diff
+    void refresh_entry_filters(const std::vector<std::string>& bases);
 
     // Callbacks (병렬 포지션 - 각 코인별 진입/청산)
     using EntryCallback = std::function<void(const ArbitrageSignal&)>;
@@ -976,10 +1148,16 @@ private:
         size_t operator()(const SymbolId& s) const noexcept { return s.hash(); }
     };
 
-    std::vector<SymbolId> monitored_symbols_;
-    std::vector<SymbolId> foreign_symbols_;  // Pre-computed foreign symbols
-    std::unordered_map<SymbolId, size_t, SymbolIdHash> korean_symbol_index_;
-    std::unordered_map<SymbolId, size_t, SymbolIdHash> foreign_symbol_index_;
+    // Keep this comfortably above live common-symbol counts to avoid cache index overflow.
+    static constexpr size_t MAX_CACHED_SYMBOLS = 1024;
+
+    // Append-only so a listing can be added while feeds and the strategy
+    // thread read: an index below size() never changes once published
+    memory::AppendOnlyArray<SymbolId, MAX_CACHED_SYMBOLS> monitored_symbols_;
+    memory::AppendOnlyArray<SymbolId, MAX_CACHED_SYMBOLS> foreign_symbols_;  // Pre-computed foreign symbols
+    memory::GrowOnlyMap<SymbolId, size_t, MAX_CACHED_SYMBOLS, SymbolIdHash> korean_symbol_index_;
+    memory::GrowOnlyMap<SymbolId, size_t, MAX_CACHED_SYMBOLS, SymbolIdHash> foreign_symbol_index_;
+    std::mutex symbols_mutex_;  // Serializes add_symbol
 
     struct ExchangePairConfig {
         Exchange korean{Exchange::Bithumb};
@@ -998,8 +1176,6 @@ private:
     // Every ticker update recomputes only the affected symbol's premium.
     // Entry detection scans this cache-hot array instead of doing PriceCache
     // lookups + mutex + hash per symbol.  Zero-miss, zero-delay.
-    // Keep this comfortably above live common-symbol counts to avoid cache index overflow.
-    static constexpr size_t MAX_CACHED_SYMBOLS = 1024;
     struct alignas(memory::CACHE_LINE_SIZE) CachedEntryPremium {
         std::atomic<double> entry_premium{100.0};  // High default = no signal
         std::atomic<double> korean_ask{0.0};
@@ -1020,6 +1196,9 @@ private:
         std::atomic<bool> signal_fired{false};      // Dedup: reset when disqualified
     };
     std::array<CachedEntryPremium, MAX_CACHED_SYMBOLS> entry_cache_{};
+    FillRiskModel fill_risk_{MAX_CACHED_SYMBOLS};  // Indexed like entry_cache_
+    BorrowCostModel borrow_cost_{MAX_CACHED_SYMBOLS};  // Indexed like entry_cache_
+    UsdtKrwEstimator usdt_fx_;
     memory::AtomicBitset<MAX_CACHED_SYMBOLS> entry_candidate_bits_;
     memory::AtomicBitset<MAX_CACHED_SYMBOLS> entry_signal_fired_bits_;
 
@@ -1050,11 +1229,14 @@ private:
     mutable std::mutex update_mutex_;
     mutable std::condition_variable update_cv_;
     std::atomic<uint64_t> update_seq_{0};
-    std::array<std::atomic<double>, static_cast<size_t>(Exchange::Count)> last_usdt_log_{};
+    std::atomic<double> last_usdt_log_{0.0};          // Composite last logged (debug, >= 1 KRW moves)
+    std::atomic<bool> usdt_rejecting_{false};         // Warn once per rejection streak
     std::atomic<uint64_t> next_entry_scan_ms_{0};     // Throttle O(N) entry cache scans
     std::atomic<uint64_t> next_usdt_scan_ms_{0};      // Debounce bursty USDT-triggered full scans
 
     // Internal methods
+    bool apply_usdt_quote(Exchange ex, double bid, double ask, double bid_qty, double ask_qty, double last,
+                          int64_t now_ns);
     void monitor_loop();
     void check_exit_conditions();      // 각 포지션 개별 청산 체크
 
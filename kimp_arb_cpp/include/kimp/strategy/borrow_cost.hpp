@@ -0,0 +1,106 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace kimp::strategy {
+
+/**
+ * Borrow interest on the foreign spot-margin short
+ *
+ * Features:
+ * - Per (foreign venue, symbol) hourly borrow rate, refreshed periodically
+ *   from the venues and read lock-free on every tick
+ * - Entry: interest over the expected holding time, as a share of the
+ *   short notional (hold_cost_rate), charged like a fee on the entry edge
+ * - Open positions: interest accrues in borrowed coins on the Position
+ *   (borrow_interest_coins up to borrow_accrued_at), so the cost stays a
+ *   fixed share of the short when the coin price moves; accrued_pct()
+ *   adds the interest still pending at the current rate
+ *
+ * A symbol without a published rate costs nothing, which keeps the
+ * thresholds at their fee-only values until the first refresh lands.
+ */
+class BorrowCostModel {
+public:
+    static constexpr double DEFAULT_EXPECTED_HOLD_HOURS = 24.0;
+
+    explicit BorrowCostModel(std::size_t symbol_capacity)
+        : capacity_(symbol_capacity)
+        , rates_(std::make_unique<std::atomic<double>[]>(symbol_capacity * VENUES)) {}
+
+    BorrowCostModel(const BorrowCostModel&) = delete;
+    BorrowCostModel& operator=(const BorrowCostModel&) = delete;
+
+    void set_expected_hold_hours(double hours) noexcept {
+        expected_hold_hours_.store(std::max(0.0, hours), std::memory_order_relaxed);
+    }
+    double expected_hold_hours() const noexcept {
+        return expected_hold_hours_.load(std::memory_order_relaxed);
+    }
+
+    // Hourly rate as a fraction of the borrowed amount (0.00001 = 0.001%/h)
+    void set_rate(Exchange ex, std::size_t idx, double hourly_rate) noexcept {
+        if (auto* cell = find(ex, idx)) {
+            cell->store(hourly_rate > 0.0 ? hourly_rate : 0.0, std::memory_order_relaxed);
+        }
+    }
+    double hourly_rate(Exchange ex, std::size_t idx) const noexcept {
+        const auto* cell = find(ex, idx);
+        return cell ? cell->load(std::memory_order_relaxed) : 0.0;
+    }
+
+    // Share of the short notional paid over the expected hold
+    double hold_cost_rate(Exchange ex, std::size_t idx) const noexcept {
+        return hourly_rate(ex, idx) * expected_hold_hours();
+    }
+
+    static double hours_between(SystemTimestamp from, SystemTimestamp to) noexcept {
+        if (to <= from) {
+            return 0.0;
+        }
+        return std::chrono::duration<double, std::ratio<3600>>(to - from).count();
+    }
+
+    // Interest in coins on borrowed_coins held for hours
+    static double interest_coins(double borrowed_coins, double hourly_rate, double hours) noexcept {
+        if (borrowed_coins <= 0.0 || hourly_rate <= 0.0 || hours <= 0.0) {
+            return 0.0;
+        }
+        return borrowed_coins * hourly_rate * hours;
+    }
+
+    // Interest accrues from the last settlement, or from entry before the first
+    static SystemTimestamp accrued_since(const Position& pos) noexcept {
+        return pos.borrow_accrued_at > pos.entry_time ? pos.borrow_accrued_at : pos.entry_time;
+    }
+
+    // Settled plus pending interest, pct of the short (premium points)
+    static double accrued_pct(const Position& pos, double hourly_rate, SystemTimestamp now) noexcept {
+        if (pos.foreign_amount <= 0.0) {
+            return 0.0;
+        }
+        const double coins = pos.borrow_interest_coins + interest_coins(
+            pos.foreign_amount, hourly_rate, hours_between(accrued_since(pos), now));
+        return coins / pos.foreign_amount * 100.0;
+    }
+
+private:
+    static constexpr std::size_t VENUES = static_cast<std::size_t>(Exchange::Count);
+
+    std::atomic<double>* find(Exchange ex, std::size_t idx) const noexcept {
+        const auto v = static_cast<std::size_t>(ex);
+        return v < VENUES && idx < capacity_ ? &rates_[idx * VENUES + v] : nullptr;
+    }
+
+    std::size_t capacity_;
+    std::unique_ptr<std::atomic<double>[]> rates_;
+    std::atomic<double> expected_hold_hours_{DEFAULT_EXPECTED_HOLD_HOURS};
+};
+
+} // namespace kimp::strategy
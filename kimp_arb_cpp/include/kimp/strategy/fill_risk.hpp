@@ -0,0 +1,138 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace kimp::strategy {
+
+/**
+ * Expected adverse premium move while an entry's legs are in flight
+ *
+ * Features:
+ * - Per (venue, symbol) short-horizon volatility of the quote mid,
+ *   updated in O(1) per tick: EWMAs of squared log returns and of the
+ *   gaps between ticks, whose ratio is the variance per ms (robust to
+ *   bursty, irregular feeds)
+ * - Per-venue leg latency (submit -> ack) as an EWMA of measured orders,
+ *   seeded with typical round trips
+ * - adverse_move_pct(): the foreign leg is exposed for its own latency,
+ *   the Korean leg for both (it is sent after the foreign ack)
+ *
+ * All state is relaxed atomics: quotes for one venue arrive on its io
+ * thread, and a lost update under a redundant feed only skips a sample.
+ */
+class FillRiskModel {
+public:
+    static constexpr double VOLATILITY_ALPHA = 0.05;  // ~20 ticks
+    static constexpr double LATENCY_ALPHA = 0.2;
+    static constexpr double MAX_GAP_MS = 5'000.0;     // Longer silences restart the return chain
+    // Expected |move| of a normal variable is sqrt(2/pi) sigma
+    static constexpr double ADVERSE_SIGMAS = 0.7978845608;
+
+    explicit FillRiskModel(std::size_t symbol_capacity)
+        : capacity_(symbol_capacity)
+        , slots_(std::make_unique<Slot[]>(symbol_capacity * VENUES)) {
+        leg_latency_ms_[static_cast<std::size_t>(Exchange::Bithumb)].store(35.0, std::memory_order_relaxed);
+        leg_latency_ms_[static_cast<std::size_t>(Exchange::Upbit)].store(30.0, std::memory_order_relaxed);
+        leg_latency_ms_[static_cast<std::size_t>(Exchange::Bybit)].store(45.0, std::memory_order_relaxed);
+        leg_latency_ms_[static_cast<std::size_t>(Exchange::OKX)].store(50.0, std::memory_order_relaxed);
+    }
+
+    FillRiskModel(const FillRiskModel&) = delete;
+    FillRiskModel& operator=(const FillRiskModel&) = delete;
+
+    // Quote of symbol slot idx on ex (steady clock ns)
+    void on_quote(Exchange ex, std::size_t idx, double bid, double ask, int64_t ts_ns) noexcept {
+        Slot* slot = find(ex, idx);
+        if (!slot || bid <= 0.0 || ask < bid) {
+            return;
+        }
+        const double mid = (bid + ask) * 0.5;
+        const double prev_mid = slot->last_mid.load(std::memory_order_relaxed);
+        const int64_t prev_ns = slot->last_ns.exchange(ts_ns, std::memory_order_relaxed);
+        slot->last_mid.store(mid, std::memory_order_relaxed);
+        if (prev_mid <= 0.0 || ts_ns <= prev_ns) {
+            return;
+        }
+        const double gap_ms = static_cast<double>(ts_ns - prev_ns) / 1e6;
+        if (gap_ms > MAX_GAP_MS) {
+            return;
+        }
+        const double r = std::log(mid / prev_mid);
+        const bool first = slot->samples.fetch_add(1, std::memory_order_relaxed) == 0;
+        ewma(slot->sq_return, r * r, first);
+        ewma(slot->gap_ms, gap_ms, first);
+    }
+
+    void record_leg_latency(Exchange ex, double ms) noexcept {
+        const auto v = static_cast<std::size_t>(ex);
+        if (v >= VENUES || !(ms > 0.0)) {
+            return;
+        }
+        auto& cell = leg_latency_ms_[v];
+        const double prev = cell.load(std::memory_order_relaxed);
+        cell.store(prev + LATENCY_ALPHA * (ms - prev), std::memory_order_relaxed);
+    }
+
+    double leg_latency_ms(Exchange ex) const noexcept {
+        const auto v = static_cast<std::size_t>(ex);
+        return v < VENUES ? leg_latency_ms_[v].load(std::memory_order_relaxed) : 0.0;
+    }
+
+    // Log-return variance per ms of the quote mid (0 until two ticks seen)
+    double variance_per_ms(Exchange ex, std::size_t idx) const noexcept {
+        const Slot* slot = find(ex, idx);
+        if (!slot) {
+            return 0.0;
+        }
+        const double gap = slot->gap_ms.load(std::memory_order_relaxed);
+        return gap > 0.0 ? slot->sq_return.load(std::memory_order_relaxed) / gap : 0.0;
+    }
+
+    // Expected adverse move (premium pct) of an entry on korean/foreign
+    double adverse_move_pct(Exchange korean, Exchange foreign, std::size_t idx) const noexcept {
+        const double foreign_ms = leg_latency_ms(foreign);
+        const double korean_ms = foreign_ms + leg_latency_ms(korean);
+        const double variance = variance_per_ms(foreign, idx) * foreign_ms +
+                                variance_per_ms(korean, idx) * korean_ms;
+        return ADVERSE_SIGMAS * std::sqrt(variance) * 100.0;
+    }
+
+    // Net profit after the expected adverse move on the priced notional
+    static double expected_profit_krw(double net_profit_krw, double notional_krw, double adverse_pct) noexcept {
+        return net_profit_krw - notional_krw * adverse_pct / 100.0;
+    }
+
+private:
+    static constexpr std::size_t VENUES = static_cast<std::size_t>(Exchange::Count);
+
+    struct Slot {
+        std::atomic<double> sq_return{0.0};  // EWMA of squared log returns
+        std::atomic<double> gap_ms{0.0};     // EWMA of tick gaps
+        std::atomic<double> last_mid{0.0};
+        std::atomic<int64_t> last_ns{0};
+        std::atomic<uint32_t> samples{0};
+    };
+
+    static void ewma(std::atomic<double>& cell, double sample, bool first) noexcept {
+        const double prev = cell.load(std::memory_order_relaxed);
+        cell.store(first ? sample : prev + VOLATILITY_ALPHA * (sample - prev), std::memory_order_relaxed);
+    }
+
+    Slot* find(Exchange ex, std::size_t idx) const noexcept {
+        const auto v = static_cast<std::size_t>(ex);
+        return v < VENUES && idx < capacity_ ? &slots_[idx * VENUES + v] : nullptr;
+    }
+
+    std::size_t capacity_;
+    std::unique_ptr<Slot[]> slots_;
+    std::array<std::atomic<double>, VENUES> leg_latency_ms_{};
+};
+
+} // namespace kimp::strategy
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "kimp/core/optimization.hpp"
+#include "kimp/core/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace kimp::strategy {
+
+/**
+ * Composite USDT/KRW rate from the Korean venues' USDT books
+ *
+ * Features:
+ * - Per-venue price from each quote: size-weighted microprice when the
+ *   top-of-book sizes are known, else the mid, else the last trade
+ * - Outlier rejection against a short rolling median of accepted quotes;
+ *   a venue's own streak of rejections reseeds the median only once every
+ *   fresh venue quotes the new level, so one bad feed never moves it
+ * - Per-venue freshness: stale venues drop out of the composite
+ * - Composite weighted by top-of-book size (equal weights unless every
+ *   fresh venue reports sizes)
+ * - Republishes only when the composite moves by at least epsilon, so a
+ *   wobbling quote does not reprice every symbol
+ *
+ * Updates take a short spinlock (Bithumb and Upbit arrive on different io
+ * threads), allocate nothing and cost well under a microsecond. rate() is a
+ * lock-free read of the last published value.
+ */
+class UsdtKrwEstimator {
+public:
+    struct Options {
+        double epsilon_bps{0.5};         // Republish threshold (0.5 bps ~ 0.07 KRW at 1400)
+        double max_deviation_bps{80.0};  // Reject quotes this far from the rolling median
+        int64_t stale_ms{5'000};         // Older venue quotes leave the composite
+        uint32_t reseed_after{5};        // Consecutive rejections that reseed the median
+    };
+
+    struct Result {
+        bool accepted{false};   // Quote passed the outlier filter
+        bool published{false};  // rate() changed
+        double rate{0.0};       // Published rate after this quote
+    };
+
+    struct VenueState {
+        double price{0.0};     // Last accepted price (0 = none)
+        double weight{0.0};    // Top-of-book size behind it (0 = unknown)
+        int64_t ts_ns{0};
+        uint64_t accepted{0};
+        uint64_t rejected{0};
+        bool fresh{false};
+    };
+
+    struct Stats {
+        uint64_t published{0};
+        uint64_t suppressed{0};  // Accepted but moved the composite less than epsilon
+        uint64_t rejected{0};
+        uint64_t reseeds{0};
+    };
+
+    static constexpr std::size_t WINDOW = 16;
+    static constexpr std::size_t MIN_SAMPLES = 3;  // Median is not trusted below this
+
+    UsdtKrwEstimator() = default;
+    explicit UsdtKrwEstimator(const Options& options) : options_(options) {}
+
+    UsdtKrwEstimator(const UsdtKrwEstimator&) = delete;
+    UsdtKrwEstimator& operator=(const UsdtKrwEstimator&) = delete;
+
+    // Call before quotes flow
+    void set_options(const Options& options) noexcept { options_ = options; }
+    const Options& options() const noexcept { return options_; }
+
+    // One USDT/KRW quote from ex at now_ns (steady clock)
+    Result on_quote(Exchange ex, double bid, double ask, double bid_qty, double ask_qty, double last,
+                    int64_t now_ns) noexcept {
+        const auto v = static_cast<std::size_t>(ex);
+        double weight = 0.0;
+        const double price = quote_price(bid, ask, bid_qty, ask_qty, last, weight);
+        if (v >= VENUES || !(price > 0.0)) {
+            return {false, false, rate()};
+        }
+
+        Guard guard(lock_);
+        Venue& venue = venues_[v];
+        venue.quoted = price;
+        venue.quoted_ns = now_ns;
+        if (window_count_ >= MIN_SAMPLES) {
+            const double median = window_median();
+            const double deviation_bps = std::fabs(price - median) / median * 1e4;
+            if (deviation_bps > options_.max_deviation_bps) {
+                ++venue.rejected;
+                ++stats_.rejected;
+                if (++venue.reject_streak < options_.reseed_after || !venues_agree(price, now_ns)) {
+                    return {false, false, rate()};
+                }
+                // This venue stayed on the new level and every fresh venue is there too: the level moved
+                window_count_ = 0;
+                ++stats_.reseeds;
+                for (Venue& other : venues_) {
+                    other.reject_streak = 0;
+                }
+            }
+        }
+        venue.reject_streak = 0;
+        push_window(price);
+        venue.price = price;
+        venue.weight = weight;
+        venue.ts_ns = now_ns;
+        ++venue.accepted;
+
+        const double composite = composite_rate(now_ns);
+        const double published = published_.load(std::memory_order_relaxed);
+        if (published > 0.0 && std::fabs(composite - published) / published * 1e4 < options_.epsilon_bps) {
+            ++stats_.suppressed;
+            return {true, false, published};
+        }
+        published_.store(composite, std::memory_order_release);
+        ++stats_.published;
+        return {true, true, composite};
+    }
+
+    // Last published composite (0 until the first accepted quote)
+    double rate() const noexcept { return published_.load(std::memory_order_acquire); }
+
+    VenueState venue(Exchange ex, int64_t now_ns) const noexcept {
+        const auto v = static_cast<std::size_t>(ex);
+        if (v >= VENUES) {
+            return {};
+        }
+        Guard guard(lock_);
+        const Venue& venue = venues_[v];
+        return {venue.price, venue.weight, venue.ts_ns, venue.accepted, venue.rejected, is_fresh(venue, now_ns)};
+    }
+
+    Stats stats() const noexcept {
+        Guard guard(lock_);
+        return stats_;
+    }
+
+    // Per-quote price; weight is the top-of-book size (0 when unknown)
+    static double quote_price(double bid, double ask, double bid_qty, double ask_qty, double last,
+                              double& weight) noexcept {
+        weight = 0.0;
+        if (bid > 0.0 && ask >= bid) {
+            if (bid_qty > 0.0 && ask_qty > 0.0) {
+                weight = bid_qty + ask_qty;
+                // Microprice leans toward the side with less resting size
+                return (bid * ask_qty + ask * bid_qty) / weight;
+            }
+            return (bid + ask) * 0.5;
+        }
+        return last > 0.0 ? last : 0.0;
+    }
+
+private:
+    static constexpr std::size_t VENUES = static_cast<std::size_t>(Exchange::Count);
+
+    struct Venue {
+        double price{0.0};
+        double weight{0.0};
+        int64_t ts_ns{0};
+        uint64_t accepted{0};
+        uint64_t rejected{0};
+        double quoted{0.0};  // Last quote, accepted or not
+        int64_t quoted_ns{0};
+        uint32_t reject_streak{0};
+    };
+
+    class Guard {
+    public:
+        explicit Guard(std::atomic_flag& flag) noexcept : flag_(flag) {
+            while (flag_.test_and_set(std::memory_order_acquire)) {
+                opt::cpu_pause();
+            }
+        }
+        ~Guard() { flag_.clear(std::memory_order_release); }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        std::atomic_flag& flag_;
+    };
+
+    bool is_fresh(const Venue& venue, int64_t now_ns) const noexcept {
+        return venue.price > 0.0 && now_ns - venue.ts_ns <= options_.stale_ms * 1'000'000;
+    }
+
+    // Every venue that quoted within the stale window quotes near price
+    bool venues_agree(double price, int64_t now_ns) const noexcept {
+        for (const Venue& venue : venues_) {
+            if (venue.quoted > 0.0 && now_ns - venue.quoted_ns <= options_.stale_ms * 1'000'000 &&
+                std::fabs(venue.quoted - price) / price * 1e4 > options_.max_deviation_bps) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void push_window(double price) noexcept {
+        window_[window_head_] = price;
+        window_head_ = (window_head_ + 1) % WINDOW;
+        window_count_ = std::min(window_count_ + 1, WINDOW);
+    }
+
+    // Window slots are the last window_count_ pushes; order does not matter
+    double window_median() const noexcept {
+        std::array<double, WINDOW> sorted;
+        for (std::size_t i = 0; i < window_count_; ++i) {
+            sorted[i] = window_[(window_head_ + WINDOW - 1 - i) % WINDOW];
+        }
+        auto mid = sorted.begin() + static_cast<std::ptrdiff_t>(window_count_ / 2);
+        std::nth_element(sorted.begin(), mid, sorted.begin() + static_cast<std::ptrdiff_t>(window_count_));
+        return *mid;
+    }
+
+    double composite_rate(int64_t now_ns) const noexcept {
+        bool sized = true;
+        std::size_t fresh = 0;
+        for (const Venue& venue : venues_) {
+            if (is_fresh(venue, now_ns)) {
+                ++fresh;
+                sized = sized && venue.weight > 0.0;
+            }
+        }
+        double sum = 0.0;
+        double total = 0.0;
+        for (const Venue& venue : venues_) {
+            if (!is_fresh(venue, now_ns)) {
+                continue;
+            }
+            const double w = sized ? venue.weight : 1.0;
+            sum += venue.price * w;
+            total += w;
+        }
+        // fresh == 0 cannot happen: the quote just accepted is fresh
+        return fresh > 0 && total > 0.0 ? sum / total : published_.load(std::memory_order_relaxed);
+    }
+
+    Options options_;
+    mutable std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+    std::array<Venue, VENUES> venues_{};
+    std::array<double, WINDOW> window_{};
+    std::size_t window_head_{0};
+    std::size_t window_count_{0};
+    Stats stats_;
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<double> published_{0.0};
+};
+
+} // namespace kimp::strategy
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace kimp::strategy {
+
+// A coin that became tradeable, or a tradeable coin listed on another venue
+struct NewListing {
+    SymbolId symbol;                      // BASE/KRW, the engine key
+    bool new_symbol{false};               // First Korean x foreign overlap: not monitored before
+    std::vector<Exchange> korean_venues;  // New symbol: every carrier; otherwise only new venues
+    std::vector<Exchange> foreign_venues;
+};
+
+/**
+ * Detects new listings by diffing venue market lists
+ *
+ * Features:
+ * - One market fetcher per venue (get_available_symbols in the bot); an
+ *   empty result is a failed fetch and keeps the venue's last list
+ * - A coin is reported once it is carried by at least one Korean and one
+ *   foreign venue, so a Korean-only listing waits for its hedge venue
+ * - Venue lists only grow: a market that drops out and comes back (a
+ *   suspension) is not reported twice
+ * - retry() hands a listing the bot failed to add back to the next poll
+ *
+ * seed() takes the startup lists so the first poll() only reports what
+ * appeared since. Not thread-safe: one thread seeds and polls.
+ */
+class ListingWatcher {
+public:
+    using MarketFetcher = std::function<std::vector<SymbolId>()>;
+
+    void add_venue(Exchange ex, MarketFetcher fetch);
+
+    // Startup market list of a venue, already reflected in the engine
+    void seed(Exchange ex, const std::vector<SymbolId>& markets);
+
+    // Fetches every venue; new listings sorted by symbol
+    std::vector<NewListing> poll();
+
+    // Report listing again on the next poll (its setup failed); a new
+    // symbol stays unmonitored until then
+    void retry(const NewListing& listing);
+
+    bool is_monitored(const std::string& base) const { return monitored_.count(base) > 0; }
+    std::size_t venue_market_count(Exchange ex) const;
+
+private:
+    struct Venue {
+        Exchange exchange{Exchange::Bithumb};
+        MarketFetcher fetch;
+        std::unordered_set<std::string> bases;
+        bool seeded{false};
+    };
+
+    Venue* find_venue(Exchange ex);
+    const Venue* find_venue(Exchange ex) const;
+    bool carries(const Venue& venue, const std::string& base) const { return venue.bases.count(base) > 0; }
+    // Korean and foreign carriers of base across all venues
+    void carriers(const std::string& base, std::vector<Exchange>& korean, std::vector<Exchange>& foreign) const;
+
+    std::vector<Venue> venues_;
+    std::unordered_set<std::string> monitored_;  // Bases with a Korean and a foreign carrier
+    std::map<std::string, std::vector<Exchange>> retries_;  // Base -> venues to report again
+};
+
+} // namespace kimp::strategy
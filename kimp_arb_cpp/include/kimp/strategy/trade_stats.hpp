@@ -0,0 +1,319 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+#include "kimp/memory/seqlock_cell.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace kimp::strategy {
+
+/**
+ * Constant-memory streaming statistics over closed trades
+ *
+ * Features:
+ * - Welford mean/variance, profit factor, best/worst, win rate
+ * - Max drawdown of the realized equity curve (USD and % of peak)
+ * - Sharpe over the last ROLLING_WINDOW trades (per trade, not annualized)
+ * - Per-symbol (bounded table) and per exchange-pair breakdowns
+ * - Optional bounded ring of recent trades; the full history belongs in
+ *   the on-disk trade log
+ *
+ * Trades are recorded under a writer mutex (one per closed trade); every
+ * reader goes through seqlock cells, so dashboards and risk checks read in
+ * O(1) without locks or copies of the history.
+ */
+class TradeStats {
+public:
+    static constexpr std::size_t ROLLING_WINDOW = 50;
+    static constexpr std::size_t SYMBOL_SLOTS = 64;
+    static constexpr std::size_t DEFAULT_HISTORY = 256;
+    static constexpr std::size_t PAIR_COUNT =
+        static_cast<std::size_t>(Exchange::Count) * static_cast<std::size_t>(Exchange::Count);
+
+    struct Moments {
+        uint64_t trades{0};
+        uint64_t wins{0};
+        double total_pnl{0.0};
+        double mean{0.0};
+        double m2{0.0};            // Welford sum of squared deviations
+        double gross_profit{0.0};
+        double gross_loss{0.0};    // Positive magnitude
+        double best{0.0};
+        double worst{0.0};
+
+        void add(double pnl) noexcept {
+            ++trades;
+            if (pnl > 0.0) {
+                ++wins;
+                gross_profit += pnl;
+            } else {
+                gross_loss -= pnl;
+            }
+            total_pnl += pnl;
+            const double delta = pnl - mean;
+            mean += delta / static_cast<double>(trades);
+            m2 += delta * (pnl - mean);
+            best = trades == 1 ? pnl : std::max(best, pnl);
+            worst = trades == 1 ? pnl : std::min(worst, pnl);
+        }
+
+        double variance() const noexcept {
+            return trades > 1 ? m2 / static_cast<double>(trades - 1) : 0.0;
+        }
+        double stddev() const noexcept { return std::sqrt(variance()); }
+        double sharpe() const noexcept {
+            const double sd = stddev();
+            return sd > 0.0 ? mean / sd : 0.0;
+        }
+        // 0 while there are no losing trades (undefined)
+        double profit_factor() const noexcept {
+            return gross_loss > 0.0 ? gross_profit / gross_loss : 0.0;
+        }
+        double win_rate_pct() const noexcept {
+            return trades > 0 ? static_cast<double>(wins) / static_cast<double>(trades) * 100.0 : 0.0;
+        }
+    };
+
+    struct Summary {
+        Moments all;
+        double peak_equity{0.0};
+        double drawdown_usd{0.0};       // Current distance below the peak
+        double max_drawdown_usd{0.0};
+        double max_drawdown_pct{0.0};   // Of the peak at the time
+        uint32_t rolling_trades{0};
+        double rolling_mean{0.0};
+        double rolling_stddev{0.0};
+        uint64_t untracked_symbol_trades{0};  // Symbol table full
+
+        double rolling_sharpe() const noexcept {
+            return rolling_stddev > 0.0 ? rolling_mean / rolling_stddev : 0.0;
+        }
+    };
+
+    struct SymbolBreakdown {
+        SymbolId symbol;
+        Moments stats;
+    };
+
+    struct PairBreakdown {
+        Exchange korean{Exchange::Bithumb};
+        Exchange foreign{Exchange::Bybit};
+        Moments stats;
+    };
+
+    struct TradeRecord {
+        double pnl_usd{0.0};
+        SymbolId symbol;
+        Exchange korean{Exchange::Bithumb};
+        Exchange foreign{Exchange::Bybit};
+    };
+
+    explicit TradeStats(double initial_equity = 0.0,
+                        std::size_t history_capacity = DEFAULT_HISTORY)
+        : initial_equity_(initial_equity)
+        , history_capacity_(history_capacity) {
+        Summary s;
+        s.peak_equity = initial_equity;
+        summary_.store(s);
+        history_.reserve(history_capacity_);
+    }
+
+    // Drawdown is measured on initial equity + realized P&L
+    void set_initial_equity(double equity) {
+        std::lock_guard lock(write_mutex_);
+        initial_equity_ = equity;
+        Summary s = summary_.load();
+        s.peak_equity = std::max(equity + s.all.total_pnl, equity);
+        s.drawdown_usd = s.peak_equity - (equity + s.all.total_pnl);
+        summary_.store(s);
+    }
+
+    // 0 disables the recent-trade ring
+    void set_history_capacity(std::size_t capacity) {
+        std::lock_guard lock(write_mutex_);
+        history_capacity_ = capacity;
+        history_.clear();
+        history_.shrink_to_fit();
+        history_.reserve(capacity);
+        history_head_ = 0;
+    }
+
+    void record(double pnl_usd) {
+        std::lock_guard lock(write_mutex_);
+        record_locked(pnl_usd, nullptr, Exchange::Count, Exchange::Count);
+    }
+
+    void record(double pnl_usd, const SymbolId& symbol, Exchange korean, Exchange foreign) {
+        std::lock_guard lock(write_mutex_);
+        record_locked(pnl_usd, &symbol, korean, foreign);
+    }
+
+    // ── Lock-free O(1) readers ──
+
+    Summary summary() const noexcept { return summary_.load(); }
+
+    std::optional<SymbolBreakdown> symbol_breakdown(const SymbolId& symbol) const noexcept {
+        const std::size_t start = symbol.hash() & (SYMBOL_SLOTS - 1);
+        for (std::size_t probe = 0; probe < SYMBOL_SLOTS; ++probe) {
+            const auto slot = symbol_slots_[(start + probe) & (SYMBOL_SLOTS - 1)].load();
+            if (slot.symbol.get_base().empty()) return std::nullopt;
+            if (slot.symbol == symbol) return slot;
+        }
+        return std::nullopt;
+    }
+
+    PairBreakdown pair_breakdown(Exchange korean, Exchange foreign) const noexcept {
+        const std::size_t idx = pair_index(korean, foreign);
+        return idx < PAIR_COUNT ? pair_slots_[idx].load() : PairBreakdown{korean, foreign, {}};
+    }
+
+    // ── Bounded snapshots for reports ──
+
+    // Symbols with trades, best total P&L first
+    std::vector<SymbolBreakdown> symbol_breakdowns() const {
+        std::vector<SymbolBreakdown> out;
+        for (const auto& cell : symbol_slots_) {
+            auto slot = cell.load();
+            if (!slot.symbol.get_base().empty() && slot.stats.trades > 0) out.push_back(slot);
+        }
+        std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+            return a.stats.total_pnl > b.stats.total_pnl;
+        });
+        return out;
+    }
+
+    std::vector<PairBreakdown> pair_breakdowns() const {
+        std::vector<PairBreakdown> out;
+        for (const auto& cell : pair_slots_) {
+            auto slot = cell.load();
+            if (slot.stats.trades > 0) out.push_back(slot);
+        }
+        return out;
+    }
+
+    // Most recent trades, oldest first (at most the ring capacity)
+    std::vector<TradeRecord> recent_trades() const {
+        std::lock_guard lock(write_mutex_);
+        std::vector<TradeRecord> out;
+        out.reserve(history_.size());
+        if (history_.size() < history_capacity_) {
+            out = history_;
+        } else {
+            out.insert(out.end(), history_.begin() + static_cast<std::ptrdiff_t>(history_head_), history_.end());
+            out.insert(out.end(), history_.begin(), history_.begin() + static_cast<std::ptrdiff_t>(history_head_));
+        }
+        return out;
+    }
+
+    void reset() {
+        std::lock_guard lock(write_mutex_);
+        Summary s;
+        s.peak_equity = initial_equity_;
+        summary_.store(s);
+        for (auto& cell : symbol_slots_) cell.store(SymbolBreakdown{});
+        for (auto& cell : pair_slots_) cell.store(PairBreakdown{});
+        symbol_used_.fill(false);
+        rolling_ = {};
+        rolling_head_ = 0;
+        rolling_count_ = 0;
+        history_.clear();
+        history_head_ = 0;
+    }
+
+private:
+    static std::size_t pair_index(Exchange korean, Exchange foreign) noexcept {
+        return static_cast<std::size_t>(korean) * static_cast<std::size_t>(Exchange::Count) +
+               static_cast<std::size_t>(foreign);
+    }
+
+    void record_locked(double pnl_usd, const SymbolId* symbol, Exchange korean, Exchange foreign) {
+        Summary s = summary_.load();
+        s.all.add(pnl_usd);
+
+        const double equity = initial_equity_ + s.all.total_pnl;
+        s.peak_equity = std::max(s.peak_equity, equity);
+        s.drawdown_usd = s.peak_equity - equity;
+        if (s.drawdown_usd > s.max_drawdown_usd) {
+            s.max_drawdown_usd = s.drawdown_usd;
+            s.max_drawdown_pct = s.peak_equity > 0.0 ? s.drawdown_usd / s.peak_equity * 100.0 : 0.0;
+        }
+
+        // Rolling window is small; recompute exactly instead of running sums
+        rolling_[rolling_head_] = pnl_usd;
+        rolling_head_ = (rolling_head_ + 1) % ROLLING_WINDOW;
+        rolling_count_ = std::min(rolling_count_ + 1, ROLLING_WINDOW);
+        double mean = 0.0;
+        for (std::size_t i = 0; i < rolling_count_; ++i) mean += rolling_[i];
+        mean /= static_cast<double>(rolling_count_);
+        double ss = 0.0;
+        for (std::size_t i = 0; i < rolling_count_; ++i) ss += (rolling_[i] - mean) * (rolling_[i] - mean);
+        s.rolling_trades = static_cast<uint32_t>(rolling_count_);
+        s.rolling_mean = mean;
+        s.rolling_stddev = rolling_count_ > 1 ? std::sqrt(ss / static_cast<double>(rolling_count_ - 1)) : 0.0;
+
+        if (symbol != nullptr && !record_symbol(*symbol, pnl_usd)) {
+            ++s.untracked_symbol_trades;
+        }
+        const std::size_t pair = pair_index(korean, foreign);
+        if (pair < PAIR_COUNT) {
+            auto slot = pair_slots_[pair].load();
+            slot.korean = korean;
+            slot.foreign = foreign;
+            slot.stats.add(pnl_usd);
+            pair_slots_[pair].store(slot);
+        }
+        summary_.store(s);
+
+        if (history_capacity_ > 0) {
+            TradeRecord rec{pnl_usd, symbol ? *symbol : SymbolId{}, korean, foreign};
+            if (history_.size() < history_capacity_) {
+                history_.push_back(rec);
+            } else {
+                history_[history_head_] = rec;
+                history_head_ = (history_head_ + 1) % history_capacity_;
+            }
+        }
+    }
+
+    bool record_symbol(const SymbolId& symbol, double pnl_usd) {
+        const std::size_t start = symbol.hash() & (SYMBOL_SLOTS - 1);
+        for (std::size_t probe = 0; probe < SYMBOL_SLOTS; ++probe) {
+            const std::size_t idx = (start + probe) & (SYMBOL_SLOTS - 1);
+            auto slot = symbol_slots_[idx].load();
+            if (!symbol_used_[idx]) {
+                symbol_used_[idx] = true;
+                slot.symbol = symbol;
+            } else if (!(slot.symbol == symbol)) {
+                continue;
+            }
+            slot.stats.add(pnl_usd);
+            symbol_slots_[idx].store(slot);
+            return true;
+        }
+        return false;
+    }
+
+    mutable std::mutex write_mutex_;
+    double initial_equity_;
+    memory::SeqlockCell<Summary> summary_;
+    std::array<memory::SeqlockCell<SymbolBreakdown>, SYMBOL_SLOTS> symbol_slots_;
+    std::array<memory::SeqlockCell<PairBreakdown>, PAIR_COUNT> pair_slots_;
+    std::array<bool, SYMBOL_SLOTS> symbol_used_{};
+
+    std::array<double, ROLLING_WINDOW> rolling_{};
+    std::size_t rolling_head_{0};
+    std::size_t rolling_count_{0};
+
+    std::size_t history_capacity_;
+    std::vector<TradeRecord> history_;
+    std::size_t history_head_{0};
+};
+
+} // namespace kimp::strategy
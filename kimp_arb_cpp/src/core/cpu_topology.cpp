@@ -0,0 +1,415 @@
+#include "kimp/core/cpu_topology.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace kimp::opt {
+
+namespace {
+
+constexpr std::size_t HOT_THREADS = 4;  // io (Bithumb), io (Bybit), strategy, execution
+constexpr int MAX_CACHE_INDEX = 16;
+
+std::string read_file(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        return {};
+    }
+    std::ostringstream out;
+    out << in.rdbuf();
+    return out.str();
+}
+
+bool parse_int(std::string_view text, int& value) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+    if (text.empty()) {
+        return false;
+    }
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc{} && ptr == text.data() + text.size();
+}
+
+int read_int(const std::string& path, int fallback) {
+    int value = 0;
+    return parse_int(read_file(path), value) ? value : fallback;
+}
+
+// Interface names of NIC queue vectors as drivers register them
+bool is_nic_irq(std::string_view description) {
+    static constexpr std::string_view PREFIXES[] = {
+        "eth", "ens", "enp", "eno", "enx", "mlx", "ixgbe", "i40e", "ice-", "ena-",
+        "gve", "bnxt", "igb", "e1000", "hinic", "qede", "nfp",
+    };
+    std::size_t pos = 0;
+    while (pos < description.size()) {
+        while (pos < description.size() && std::isspace(static_cast<unsigned char>(description[pos]))) ++pos;
+        std::size_t end = pos;
+        while (end < description.size() && !std::isspace(static_cast<unsigned char>(description[end]))) ++end;
+        const std::string_view token = description.substr(pos, end - pos);
+        for (const auto prefix : PREFIXES) {
+            if (token.substr(0, prefix.size()) == prefix) {
+                return true;
+            }
+        }
+        if (token.substr(0, 6) == "virtio" &&
+            (token.find("-input") != std::string_view::npos || token.find("-output") != std::string_view::npos)) {
+            return true;
+        }
+        pos = end;
+    }
+    return false;
+}
+
+std::set<int> nic_irq_cpus(const std::string& interrupts_path) {
+    std::set<int> out;
+    std::istringstream in(read_file(interrupts_path));
+    std::string line;
+    if (!std::getline(in, line)) {
+        return out;
+    }
+    std::vector<int> columns;  // CPU of each count column
+    {
+        std::istringstream header(line);
+        std::string name;
+        while (header >> name) {
+            int cpu = 0;
+            if (name.rfind("CPU", 0) == 0 && parse_int(std::string_view(name).substr(3), cpu)) {
+                columns.push_back(cpu);
+            }
+        }
+    }
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string label;
+        int irq = 0;
+        if (!(fields >> label) || label.size() < 2 || label.back() != ':' ||
+            !parse_int(std::string_view(label).substr(0, label.size() - 1), irq)) {
+            continue;  // NMI, LOC, ...: not device interrupts
+        }
+        std::vector<unsigned long long> counts;
+        counts.reserve(columns.size());
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            unsigned long long count = 0;
+            if (!(fields >> count)) {
+                break;
+            }
+            counts.push_back(count);
+            total += count;
+        }
+        std::string description;
+        std::getline(fields, description);
+        if (total == 0 || !is_nic_irq(description)) {
+            continue;
+        }
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            if (counts[i] > 0 && counts[i] * 20 >= total) {
+                out.insert(columns[i]);
+            }
+        }
+    }
+    return out;
+}
+
+struct Core {
+    int key{-1};
+    int l3{-1};
+    std::vector<int> cpus;
+    bool quiet{false};         // Any sibling isolated or nohz_full
+    bool nic{false};
+    bool housekeeping{false};  // Holds CPU 0
+    bool used{false};
+    int pin{-1};               // CPU the core's thread is pinned to
+};
+
+// Lower is better for latency-critical threads
+int hot_rank(const Core& core) {
+    return (core.quiet ? 0 : 4) + (core.nic ? 2 : 0) + (core.housekeeping ? 1 : 0);
+}
+
+// Lower is better for logger / exporter: keep isolated cores and the hot cache free
+int cold_rank(const Core& core, int hot_l3) {
+    return (core.quiet ? 4 : 0) + (core.l3 >= 0 && core.l3 == hot_l3 ? 1 : 0);
+}
+
+std::string core_name(int cpu) {
+    return cpu >= 0 ? std::to_string(cpu) : std::string("-");
+}
+
+} // namespace
+
+std::vector<int> parse_cpu_list(std::string_view text) {
+    std::vector<int> cpus;
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        std::size_t end = text.find(',', pos);
+        if (end == std::string_view::npos) end = text.size();
+        const std::string_view range = text.substr(pos, end - pos);
+        pos = end + 1;
+        if (range.find_first_not_of(" \t\r\n") == std::string_view::npos) {
+            continue;
+        }
+        const std::size_t dash = range.find('-');
+        int first = 0;
+        int last = 0;
+        if (dash == std::string_view::npos) {
+            if (!parse_int(range, first)) return {};
+            last = first;
+        } else if (!parse_int(range.substr(0, dash), first) || !parse_int(range.substr(dash + 1), last) ||
+                   last < first) {
+            return {};
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::string format_cpu_list(std::vector<int> cpus) {
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    std::string out;
+    for (std::size_t i = 0; i < cpus.size();) {
+        std::size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+        if (!out.empty()) out += ',';
+        out += std::to_string(cpus[i]);
+        if (j > i) out += '-' + std::to_string(cpus[j]);
+        i = j + 1;
+    }
+    return out;
+}
+
+std::size_t CpuTopology::physical_cores() const {
+    std::set<int> cores;
+    for (const auto& c : cpus) cores.insert(c.core);
+    return cores.size();
+}
+
+std::size_t CpuTopology::l3_domains() const {
+    std::set<int> domains;
+    for (const auto& c : cpus) {
+        if (c.l3 >= 0) domains.insert(c.l3);
+    }
+    return domains.size();
+}
+
+CpuTopology CpuTopology::discover(const std::string& cpu_root, const std::string& interrupts_path) {
+    CpuTopology topology;
+    const auto online = parse_cpu_list(read_file(cpu_root + "/online"));
+    if (online.empty()) {
+        return topology;
+    }
+    const auto isolated = parse_cpu_list(read_file(cpu_root + "/isolated"));
+    const auto nohz_full = parse_cpu_list(read_file(cpu_root + "/nohz_full"));  // "(null)" when off
+    const auto nic = nic_irq_cpus(interrupts_path);
+    auto contains = [](const std::vector<int>& list, int cpu) {
+        return std::binary_search(list.begin(), list.end(), cpu);
+    };
+
+    for (int cpu : online) {
+        const std::string dir = cpu_root + "/cpu" + std::to_string(cpu);
+        CpuInfo info;
+        info.cpu = cpu;
+        info.package = read_int(dir + "/topology/physical_package_id", 0);
+        auto siblings = parse_cpu_list(read_file(dir + "/topology/thread_siblings_list"));
+        info.core = siblings.empty() ? cpu : std::min(siblings.front(), cpu);
+        for (int index = 0; index < MAX_CACHE_INDEX; ++index) {
+            const std::string cache = dir + "/cache/index" + std::to_string(index);
+            const int level = read_int(cache + "/level", -1);
+            if (level < 0 && index > 3) {
+                break;
+            }
+            if (level == 3) {
+                auto shared = parse_cpu_list(read_file(cache + "/shared_cpu_list"));
+                info.l3 = shared.empty() ? cpu : std::min(shared.front(), cpu);
+                break;
+            }
+        }
+        info.isolated = contains(isolated, cpu);
+        info.nohz_full = contains(nohz_full, cpu);
+        info.nic_irq = nic.count(cpu) > 0;
+        topology.cpus.push_back(info);
+    }
+    return topology;
+}
+
+ThreadPlan plan_threads(const CpuTopology& topology) {
+    ThreadPlan plan;
+    if (topology.empty()) {
+        plan.config = ThreadConfig::fallback();
+        plan.topology = fmt::format("CPU topology unavailable; {} CPU(s) by count",
+                                    std::thread::hardware_concurrency());
+        plan.notes.push_back("no sysfs topology: fixed layout by CPU count");
+        return plan;
+    }
+
+    std::vector<int> isolated;
+    std::vector<int> nohz;
+    std::vector<int> nic;
+    std::map<int, Core> by_key;
+    for (const auto& cpu : topology.cpus) {
+        if (cpu.isolated) isolated.push_back(cpu.cpu);
+        if (cpu.nohz_full) nohz.push_back(cpu.cpu);
+        if (cpu.nic_irq) nic.push_back(cpu.cpu);
+        Core& core = by_key[cpu.core];
+        core.key = cpu.core;
+        if (core.l3 < 0) core.l3 = cpu.l3;
+        core.cpus.push_back(cpu.cpu);
+        core.quiet = core.quiet || cpu.isolated || cpu.nohz_full;
+        core.nic = core.nic || cpu.nic_irq;
+        core.housekeeping = core.housekeeping || cpu.cpu == 0;
+    }
+    // Pin to the quietest sibling: isolated before the rest, NIC IRQ CPUs last
+    for (auto& [key, core] : by_key) {
+        int best_score = 0;
+        for (int cpu : core.cpus) {
+            const auto& info = *std::find_if(topology.cpus.begin(), topology.cpus.end(),
+                                             [cpu](const CpuInfo& c) { return c.cpu == cpu; });
+            const int score = (info.isolated || info.nohz_full ? 0 : 2) + (info.nic_irq ? 1 : 0);
+            if (core.pin < 0 || score < best_score) {
+                core.pin = cpu;
+                best_score = score;
+            }
+        }
+    }
+
+    plan.topology = fmt::format("{} CPU(s), {} physical core(s), {} L3 domain(s)",
+                                topology.cpus.size(), by_key.size(), topology.l3_domains());
+    if (!isolated.empty()) plan.topology += "; isolated " + format_cpu_list(isolated);
+    if (!nohz.empty()) plan.topology += "; nohz_full " + format_cpu_list(nohz);
+    if (!nic.empty()) plan.topology += "; NIC IRQ on " + format_cpu_list(nic);
+
+    ThreadConfig& cfg = plan.config;
+    cfg.io_bithumb_core = cfg.io_bybit_core = cfg.strategy_core = cfg.execution_core = -1;
+    cfg.logger_core = cfg.export_core = -1;
+    if (by_key.size() < HOT_THREADS) {
+        plan.notes.push_back(fmt::format("{} physical core(s) for {} hot threads: all threads left to the scheduler",
+                                         by_key.size(), HOT_THREADS));
+        return plan;
+    }
+
+    std::vector<Core*> cores;
+    for (auto& [key, core] : by_key) cores.push_back(&core);
+    auto by_hot_rank = [](const Core* a, const Core* b) {
+        const int ra = hot_rank(*a);
+        const int rb = hot_rank(*b);
+        return ra != rb ? ra < rb : a->key < b->key;
+    };
+
+    // L3 domain for the hot threads: one that fits them all, then the best cores
+    std::map<int, std::vector<Core*>> domains;
+    for (Core* core : cores) domains[core->l3].push_back(core);
+    int hot_l3 = -1;
+    std::size_t hot_fit = 0;
+    int hot_score = 0;
+    for (auto& [l3, members] : domains) {
+        std::sort(members.begin(), members.end(), by_hot_rank);
+        const std::size_t fit = std::min(members.size(), HOT_THREADS);
+        int score = 0;
+        for (std::size_t i = 0; i < fit; ++i) score += hot_rank(*members[i]);
+        if (hot_fit == 0 || fit > hot_fit || (fit == hot_fit && score < hot_score)) {
+            hot_l3 = l3;
+            hot_fit = fit;
+            hot_score = score;
+        }
+    }
+    if (hot_fit < HOT_THREADS) {
+        plan.notes.push_back(fmt::format("largest L3 domain has {} core(s): hot threads span domains", hot_fit));
+    }
+
+    // Hot domain first, then the rest by rank
+    std::vector<Core*> hot_order = domains[hot_l3];
+    {
+        std::vector<Core*> rest;
+        for (Core* core : cores) {
+            if (core->l3 != hot_l3) rest.push_back(core);
+        }
+        std::sort(rest.begin(), rest.end(), by_hot_rank);
+        hot_order.insert(hot_order.end(), rest.begin(), rest.end());
+    }
+    int* hot_roles[HOT_THREADS] = {&cfg.io_bithumb_core, &cfg.io_bybit_core, &cfg.strategy_core,
+                                   &cfg.execution_core};
+    for (std::size_t i = 0; i < HOT_THREADS; ++i) {
+        hot_order[i]->used = true;
+        *hot_roles[i] = hot_order[i]->pin;
+        if (!hot_order[i]->quiet && !isolated.empty()) {
+            plan.notes.push_back(fmt::format("hot thread on non-isolated CPU {}", hot_order[i]->pin));
+        }
+        if (hot_order[i]->nic) {
+            plan.notes.push_back(fmt::format("hot thread on NIC IRQ CPU {}", hot_order[i]->pin));
+        }
+    }
+
+    // Logger and exporter: spare cores away from the hot ones
+    std::vector<Core*> spare;
+    for (Core* core : cores) {
+        if (!core->used) spare.push_back(core);
+    }
+    std::sort(spare.begin(), spare.end(), [hot_l3](const Core* a, const Core* b) {
+        const int ra = cold_rank(*a, hot_l3);
+        const int rb = cold_rank(*b, hot_l3);
+        return ra != rb ? ra < rb : a->key < b->key;
+    });
+    if (spare.empty()) {
+        plan.notes.push_back("no spare core: logger and exporter unpinned");
+    } else {
+        spare[0]->used = true;
+        cfg.logger_core = spare[0]->pin;
+        if (spare.size() > 1) {
+            spare[1]->used = true;
+            cfg.export_core = spare[1]->pin;
+        } else {
+            cfg.export_core = cfg.logger_core;
+            plan.notes.push_back("one spare core: logger and exporter share it");
+        }
+    }
+
+    // Execution workers: the execution core, then what is left in its L3 domain
+    const Core* execution = hot_order[HOT_THREADS - 1];
+    cfg.execution_cores.push_back(execution->pin);
+    for (Core* core : hot_order) {
+        if (!core->used && core->l3 == execution->l3) {
+            core->used = true;
+            cfg.execution_cores.push_back(core->pin);
+        }
+    }
+    return plan;
+}
+
+std::string ThreadPlan::describe() const {
+    std::string out = "CPU topology: " + topology + "\n";
+    out += fmt::format("Thread plan: io[bithumb]={} io[bybit]={} strategy={} execution={} logger={} export={}",
+                       core_name(config.io_bithumb_core), core_name(config.io_bybit_core),
+                       core_name(config.strategy_core), core_name(config.execution_core),
+                       core_name(config.logger_core), core_name(config.export_core));
+    if (!config.execution_cores.empty()) {
+        out += " execution workers=" + format_cpu_list(config.execution_cores);
+    }
+    for (const auto& note : notes) {
+        out += "\n  " + note;
+    }
+    return out;
+}
+
+const ThreadPlan& host_thread_plan() {
+    static const ThreadPlan plan = plan_threads(CpuTopology::discover());
+    return plan;
+}
+
+ThreadConfig ThreadConfig::optimal() {
+    return host_thread_plan().config;
+}
+
+} // namespace kimp::opt
@@ -0,0 +1,530 @@
+#include "kimp/core/flight_recorder.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <tuple>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace kimp {
+
+namespace {
+
+struct DumpHeader {
+    std::array<char, 8> magic{FLIGHT_DUMP_MAGIC};
+    uint32_t version{1};
+    uint32_t event_size{sizeof(FlightEvent)};
+    int64_t wall_ns{0};
+    uint64_t ticks{0};
+    double ns_per_tick{1.0};
+    uint64_t window_ns{0};
+    uint32_t thread_count{0};
+    uint32_t reserved{0};
+    char reason[32]{};
+};
+
+// Followed by count events, then the ring head after the copy (uint64)
+struct RingHeader {
+    uint32_t tid{0};
+    uint32_t reserved{0};
+    char name[16]{};
+    uint64_t capacity{0};
+    uint64_t first_seq{0};
+    uint64_t count{0};
+};
+
+int64_t clock_ns(clockid_t clock) noexcept {
+    timespec ts{};
+    ::clock_gettime(clock, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+bool write_all(int fd, const void* data, std::size_t size) noexcept {
+    const auto* p = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t n = ::write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+// snprintf is not async-signal-safe
+char* append_str(char* out, const char* end, const char* s) noexcept {
+    while (*s != '\0' && out < end) {
+        *out++ = *s++;
+    }
+    return out;
+}
+
+char* append_u64(char* out, const char* end, uint64_t v) noexcept {
+    char digits[20];
+    int n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    while (n > 0 && out < end) {
+        *out++ = digits[--n];
+    }
+    return out;
+}
+
+uint32_t current_tid() noexcept {
+#if defined(__linux__)
+    return static_cast<uint32_t>(::syscall(SYS_gettid));
+#elif defined(__APPLE__)
+    uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    return static_cast<uint32_t>(tid);
+#else
+    return 0;
+#endif
+}
+
+const char* fatal_signal_name(int sig) noexcept {
+    switch (sig) {
+        case SIGSEGV: return "sigsegv";
+        case SIGBUS: return "sigbus";
+        case SIGFPE: return "sigfpe";
+        case SIGILL: return "sigill";
+        case SIGABRT: return "sigabrt";
+        default: return "signal";
+    }
+}
+
+constexpr int FATAL_SIGNALS[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+constexpr std::size_t ALT_STACK_SIZE = 1 << 16;
+
+std::atomic_flag g_dumping = ATOMIC_FLAG_INIT;
+thread_local bool tls_refused = false;
+
+}  // namespace
+
+std::atomic<bool> FlightRecorder::enabled_{false};
+thread_local FlightRecorder::Ring* FlightRecorder::tls_ring_{nullptr};
+std::atomic<FlightRecorder::Ring*> FlightRecorder::rings_[FlightRecorder::MAX_THREADS]{};
+std::atomic<std::size_t> FlightRecorder::ring_count_{0};
+std::size_t FlightRecorder::capacity_{1U << 15};
+uint64_t FlightRecorder::window_ns_{30ULL * 1'000'000'000};
+uint64_t FlightRecorder::anchor_ticks_{0};
+int64_t FlightRecorder::anchor_mono_ns_{0};
+double FlightRecorder::ns_per_tick_{1.0};
+char FlightRecorder::dir_[384]{"trade_logs/flight"};
+char FlightRecorder::last_path_[512]{};
+
+// Hands the ring back when its thread exits
+struct FlightRingOwner {
+    FlightRecorder::Ring* ring{nullptr};
+    ~FlightRingOwner() {
+        if (ring != nullptr) {
+            FlightRecorder::release_ring(ring);
+        }
+    }
+};
+
+const char* flight_event_type_name(FlightEventType type) noexcept {
+    switch (type) {
+        case FlightEventType::Quote: return "QUOTE";
+        case FlightEventType::EntryDecision: return "ENTRY";
+        case FlightEventType::ExitDecision: return "EXIT";
+        case FlightEventType::LegSubmit: return "SUBMIT";
+        case FlightEventType::LegAck: return "ACK";
+        case FlightEventType::LegFill: return "FILL";
+    }
+    return "UNKNOWN";
+}
+
+uint64_t FlightRecorder::steady_ticks() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void FlightRecorder::configure(const FlightRecorderOptions& options) {
+    std::size_t capacity = 64;
+    while (capacity < options.events_per_thread) {
+        capacity <<= 1;
+    }
+    capacity_ = capacity;
+    window_ns_ = static_cast<uint64_t>(options.window_sec) * 1'000'000'000ULL;
+    const std::size_t len = std::min(options.dir.size(), sizeof(dir_) - 1);
+    std::memcpy(dir_, options.dir.data(), len);
+    dir_[len] = '\0';
+    std::error_code ec;
+    std::filesystem::create_directories(options.dir, ec);
+
+    // Counter rate; dump() refines it over the whole run
+    anchor_ticks_ = now_ticks();
+    anchor_mono_ns_ = clock_ns(CLOCK_MONOTONIC);
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__)
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const uint64_t ticks = now_ticks();
+    const int64_t mono = clock_ns(CLOCK_MONOTONIC);
+    if (ticks > anchor_ticks_) {
+        ns_per_tick_ = static_cast<double>(mono - anchor_mono_ns_) / static_cast<double>(ticks - anchor_ticks_);
+    }
+#else
+    ns_per_tick_ = 1.0;
+#endif
+    enabled_.store(options.enabled, std::memory_order_relaxed);
+}
+
+FlightRecorder::Ring* FlightRecorder::claim_ring() noexcept {
+    if (tls_refused) {
+        return nullptr;
+    }
+    static thread_local FlightRingOwner owner;
+
+    Ring* ring = nullptr;
+    const std::size_t count = std::min(ring_count_.load(std::memory_order_acquire), MAX_THREADS);
+    for (std::size_t i = 0; i < count && ring == nullptr; ++i) {
+        Ring* candidate = rings_[i].load(std::memory_order_acquire);
+        bool expected = false;
+        if (candidate != nullptr && candidate->owned.compare_exchange_strong(expected, true)) {
+            ring = candidate;
+        }
+    }
+
+    if (ring == nullptr) {
+        const std::size_t slot = ring_count_.fetch_add(1, std::memory_order_acq_rel);
+        if (slot >= MAX_THREADS) {
+            tls_refused = true;
+            return nullptr;
+        }
+        ring = new (std::nothrow) Ring;
+        FlightEvent* events = ring ? new (std::nothrow) FlightEvent[capacity_] : nullptr;
+        if (events == nullptr) {
+            delete ring;
+            tls_refused = true;
+            return nullptr;
+        }
+        ring->events = events;
+        ring->mask = capacity_ - 1;
+        ring->alt_stack = new (std::nothrow) char[ALT_STACK_SIZE];
+        ring->owned.store(true, std::memory_order_relaxed);
+        rings_[slot].store(ring, std::memory_order_release);
+    }
+
+    // The previous owner's events stay behind start and are not dumped again
+    ring->start.store(ring->head.load(std::memory_order_relaxed), std::memory_order_release);
+    // Fatal handlers run SA_ONSTACK; a thread without its own alternate
+    // stack could not take the SIGSEGV of a stack overflow
+    stack_t current{};
+    if (ring->alt_stack != nullptr && ::sigaltstack(nullptr, &current) == 0 && (current.ss_flags & SS_DISABLE)) {
+        stack_t ss{};
+        ss.ss_sp = ring->alt_stack;
+        ss.ss_size = ALT_STACK_SIZE;
+        ::sigaltstack(&ss, nullptr);
+    }
+    ring->tid = current_tid();
+    std::memset(ring->name, 0, sizeof(ring->name));
+    pthread_getname_np(pthread_self(), ring->name, sizeof(ring->name));
+    owner.ring = ring;
+    tls_ring_ = ring;
+    return ring;
+}
+
+void FlightRecorder::release_ring(Ring* ring) noexcept {
+    tls_ring_ = nullptr;
+    tls_refused = true;  // Later thread_local destructors must not claim again
+    // The next owner installs the same stack on its own thread
+    stack_t current{};
+    if (::sigaltstack(nullptr, &current) == 0 && current.ss_sp == ring->alt_stack &&
+        !(current.ss_flags & SS_DISABLE)) {
+        stack_t off{};
+        off.ss_flags = SS_DISABLE;
+        ::sigaltstack(&off, nullptr);
+    }
+    ring->owned.store(false, std::memory_order_release);
+}
+
+std::size_t FlightRecorder::thread_ring_capacity() noexcept {
+    return tls_ring_ ? static_cast<std::size_t>(tls_ring_->mask + 1) : 0;
+}
+
+bool FlightRecorder::dump(const char* reason) noexcept {
+    if (g_dumping.test_and_set(std::memory_order_acquire)) {
+        return false;
+    }
+
+    DumpHeader header;
+    header.wall_ns = clock_ns(CLOCK_REALTIME);
+    header.ticks = now_ticks();
+    header.window_ns = window_ns_;
+    header.ns_per_tick = ns_per_tick_;
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__)
+    const int64_t mono = clock_ns(CLOCK_MONOTONIC);
+    if (anchor_mono_ns_ > 0 && mono - anchor_mono_ns_ >= 1'000'000'000 && header.ticks > anchor_ticks_) {
+        header.ns_per_tick = static_cast<double>(mono - anchor_mono_ns_) /
+                             static_cast<double>(header.ticks - anchor_ticks_);
+    }
+#endif
+    std::size_t r = 0;
+    for (const char* p = reason; *p != '\0' && r + 1 < sizeof(header.reason); ++p) {
+        const char c = *p;
+        const bool plain = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-';
+        header.reason[r++] = plain ? c : '_';
+    }
+
+    char* out = last_path_;
+    const char* end = last_path_ + sizeof(last_path_) - 1;
+    out = append_str(out, end, dir_);
+    out = append_str(out, end, "/flight_");
+    out = append_u64(out, end, static_cast<uint64_t>(header.wall_ns / 1'000'000));
+    out = append_str(out, end, "_");
+    out = append_str(out, end, header.reason);
+    out = append_str(out, end, ".bin");
+    *out = '\0';
+
+    const int fd = ::open(last_path_, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        g_dumping.clear(std::memory_order_release);
+        return false;
+    }
+
+    const std::size_t count = std::min(ring_count_.load(std::memory_order_acquire), MAX_THREADS);
+    Ring* rings[MAX_THREADS];
+    for (std::size_t i = 0; i < count; ++i) {
+        rings[i] = rings_[i].load(std::memory_order_acquire);
+        if (rings[i] != nullptr) {
+            ++header.thread_count;
+        }
+    }
+    bool ok = write_all(fd, &header, sizeof(header));
+
+    const auto window_ticks = header.ns_per_tick > 0.0
+        ? static_cast<uint64_t>(static_cast<double>(header.window_ns) / header.ns_per_tick) : header.ticks;
+    const uint64_t cutoff = header.ticks > window_ticks ? header.ticks - window_ticks : 0;
+
+    for (std::size_t i = 0; i < count && ok; ++i) {
+        Ring* ring = rings[i];
+        if (ring == nullptr) {
+            continue;
+        }
+        const uint64_t capacity = ring->mask + 1;
+        const uint64_t head = ring->head.load(std::memory_order_acquire);
+        const uint64_t oldest = std::max(head > capacity ? head - capacity : 0,
+                                         ring->start.load(std::memory_order_acquire));
+        uint64_t first = head;
+        while (first > oldest && ring->events[(first - 1) & ring->mask].ticks >= cutoff) {
+            --first;
+        }
+
+        RingHeader rh;
+        rh.tid = ring->tid;
+        std::memcpy(rh.name, ring->name, sizeof(rh.name));
+        rh.capacity = capacity;
+        rh.first_seq = first;
+        rh.count = head - first;
+        ok = write_all(fd, &rh, sizeof(rh));
+
+        // At most two contiguous runs around the wrap
+        uint64_t seq = first;
+        while (ok && seq < head) {
+            const uint64_t slot = seq & ring->mask;
+            const uint64_t run = std::min(head - seq, capacity - slot);
+            ok = write_all(fd, ring->events + slot, run * sizeof(FlightEvent));
+            seq += run;
+        }
+        const uint64_t head_after = ring->head.load(std::memory_order_acquire);
+        ok = ok && write_all(fd, &head_after, sizeof(head_after));
+    }
+
+    ::close(fd);
+    g_dumping.clear(std::memory_order_release);
+    return ok;
+}
+
+void FlightRecorder::on_signal(int sig) noexcept {
+    const int saved_errno = errno;
+    if (sig == SIGUSR1) {
+        dump("sigusr1");
+        errno = saved_errno;
+        return;
+    }
+    dump(fatal_signal_name(sig));
+    // SA_RESETHAND restored the default action: terminate (and core) as before
+    ::raise(sig);
+}
+
+void FlightRecorder::install_signal_handlers() {
+    // Stack overflows fault on the thread stack; dump from an alternate one.
+    // This covers the calling thread; recording threads get theirs in claim_ring
+    static char alt_stack[ALT_STACK_SIZE];
+    stack_t ss{};
+    ss.ss_sp = alt_stack;
+    ss.ss_size = sizeof(alt_stack);
+    ::sigaltstack(&ss, nullptr);
+
+    struct sigaction usr{};
+    usr.sa_handler = [](int sig) { on_signal(sig); };
+    sigemptyset(&usr.sa_mask);
+    usr.sa_flags = SA_RESTART;
+    ::sigaction(SIGUSR1, &usr, nullptr);
+
+    struct sigaction fatal{};
+    fatal.sa_handler = usr.sa_handler;
+    sigemptyset(&fatal.sa_mask);
+    fatal.sa_flags = SA_RESETHAND | SA_ONSTACK;
+    for (int sig : FATAL_SIGNALS) {
+        ::sigaction(sig, &fatal, nullptr);
+    }
+}
+
+bool read_flight_dump(const std::string& path, FlightDump& out, std::string* error) {
+    auto fail = [&](std::string message) {
+        if (error) {
+            *error = std::move(message);
+        }
+        return false;
+    };
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return fail(fmt::format("cannot open {}", path));
+    }
+    DumpHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != FLIGHT_DUMP_MAGIC ||
+        header.event_size != sizeof(FlightEvent)) {
+        std::fclose(file);
+        return fail(fmt::format("{} is not a flight recorder dump", path));
+    }
+
+    out = FlightDump{};
+    out.reason.assign(header.reason, strnlen(header.reason, sizeof(header.reason)));
+    out.wall_ns = header.wall_ns;
+    out.ticks = header.ticks;
+    out.ns_per_tick = header.ns_per_tick;
+    out.window_ns = header.window_ns;
+
+    for (uint32_t t = 0; t < header.thread_count; ++t) {
+        RingHeader rh;
+        if (std::fread(&rh, sizeof(rh), 1, file) != 1 || rh.count > rh.capacity) {
+            std::fclose(file);
+            return fail(fmt::format("{} is truncated (thread {} of {})", path, t + 1, header.thread_count));
+        }
+        FlightThreadDump thread;
+        thread.tid = rh.tid;
+        thread.name.assign(rh.name, strnlen(rh.name, sizeof(rh.name)));
+        thread.capacity = rh.capacity;
+        thread.events.resize(rh.count);
+        uint64_t head_after = 0;
+        if (std::fread(thread.events.data(), sizeof(FlightEvent), rh.count, file) != rh.count ||
+            std::fread(&head_after, sizeof(head_after), 1, file) != 1) {
+            std::fclose(file);
+            return fail(fmt::format("{} is truncated (thread {} of {})", path, t + 1, header.thread_count));
+        }
+
+        // The writer's next slot aliases head_after - capacity: anything at or
+        // below it may have been overwritten while the dump copied the ring
+        const uint64_t valid_from = head_after >= rh.capacity ? head_after - rh.capacity + 1 : 0;
+        if (valid_from > rh.first_seq) {
+            const uint64_t drop = std::min<uint64_t>(valid_from - rh.first_seq, thread.events.size());
+            thread.events.erase(thread.events.begin(), thread.events.begin() + static_cast<std::ptrdiff_t>(drop));
+            thread.overwritten = drop;
+        }
+        out.threads.push_back(std::move(thread));
+    }
+    std::fclose(file);
+    return true;
+}
+
+std::string format_flight_dump(const FlightDump& dump) {
+    auto venue = [](uint8_t ex) {
+        return ex < static_cast<uint8_t>(Exchange::Count) ? exchange_name(static_cast<Exchange>(ex)) : "-";
+    };
+    auto wall_text = [](int64_t ns) {
+        const std::time_t secs = static_cast<std::time_t>(ns / 1'000'000'000);
+        std::tm tm{};
+        localtime_r(&secs, &tm);
+        char buf[32];
+        std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+        return fmt::format("{}.{:09d}", buf, ns % 1'000'000'000);
+    };
+    auto status = [](uint8_t value) {
+        static constexpr const char* NAMES[] = {"New", "PartiallyFilled", "Filled", "Cancelled", "Rejected", "Expired",
+                                                "Unknown"};
+        return value < std::size(NAMES) ? NAMES[value] : "?";
+    };
+
+    std::size_t total = 0;
+    uint64_t overwritten = 0;
+    std::vector<std::tuple<int64_t, std::size_t, const FlightEvent*>> merged;
+    for (std::size_t t = 0; t < dump.threads.size(); ++t) {
+        total += dump.threads[t].events.size();
+        overwritten += dump.threads[t].overwritten;
+        for (const auto& e : dump.threads[t].events) {
+            merged.emplace_back(dump.event_wall_ns(e), t, &e);
+        }
+    }
+    std::stable_sort(merged.begin(), merged.end(), [](const auto& a, const auto& b) {
+        return std::get<0>(a) < std::get<0>(b);
+    });
+
+    std::string out = fmt::format("Flight dump: reason={} at {} window={}s threads={} events={}",
+                                  dump.reason, wall_text(dump.wall_ns), dump.window_ns / 1'000'000'000,
+                                  dump.threads.size(), total);
+    if (overwritten > 0) {
+        out += fmt::format(" (dropped {} overwritten during the dump)", overwritten);
+    }
+    out += '\n';
+
+    for (const auto& [ns, t, e] : merged) {
+        const auto& thread = dump.threads[t];
+        const std::string symbol(e->symbol.data(), strnlen(e->symbol.data(), e->symbol.size()));
+        const char* side = e->side == static_cast<uint8_t>(Side::Buy) ? "Buy" : "Sell";
+        out += fmt::format("{} {:>7} {:<15} {:<6} {:<8} {:<10} ", wall_text(ns), thread.tid, thread.name,
+                           flight_event_type_name(e->type), venue(e->exchange), symbol);
+        switch (e->type) {
+            case FlightEventType::Quote:
+                out += fmt::format("bid {:.8g} x {:.8g}  ask {:.8g} x {:.8g}", e->v[0], e->v[2], e->v[1], e->v[3]);
+                break;
+            case FlightEventType::EntryDecision:
+                out += fmt::format("trace {} vs {} premium {:.4f}% edge {:.4f}% ask {:.8g} bid {:.8g}",
+                                   e->id, venue(e->counter_exchange), e->v[0], e->v[1], e->v[2], e->v[3]);
+                break;
+            case FlightEventType::ExitDecision:
+                out += fmt::format("trace {} vs {} premium {:.4f}% threshold {:.4f}% bid {:.8g} ask {:.8g}",
+                                   e->id, venue(e->counter_exchange), e->v[0], e->v[1], e->v[2], e->v[3]);
+                break;
+            case FlightEventType::LegSubmit:
+                out += fmt::format("{} qty {:.8g} limit {:.8g} krw {:.0f}", side, e->v[0], e->v[1], e->v[2]);
+                break;
+            case FlightEventType::LegAck:
+                out += fmt::format("{} order {} qty {:.8g} price {:.8g} ack {:.0f}us {}",
+                                   side, e->id, e->v[0], e->v[1], e->v[2], status(e->flags));
+                break;
+            case FlightEventType::LegFill:
+                out += fmt::format("{} order {} filled {:.8g} avg {:.8g} {}",
+                                   side, e->id, e->v[0], e->v[1], status(e->flags));
+                break;
+        }
+        out += '\n';
+    }
+    return out;
+}
+
+}  // namespace kimp
@@ -263,25 +263,8 @@ bool BithumbExchange::connect() {
     }
     Logger::info("[Bithumb] REST connection pool initialized (4 persistent connections)");
 
-    ws_client_ = std::make_shared<network::WebSocketClient>(io_context_, "Bithumb-WS");
-
-    ws_client_->set_message_callback([this](std::string_view msg, network::MessageType /*type*/) {
-        on_ws_message(msg);
-    });
-
-    ws_client_->set_connect_callback([this](bool success, const std::string& error) {
-        if (success) {
-            on_ws_connected();
-        } else {
-            Logger::error("[Bithumb] Connection failed: {}", error);
-        }
-    });
-
-    ws_client_->set_disconnect_callback([this](const std::string& /*reason*/) {
-        on_ws_disconnected();
-    });
-
-    ws_client_->connect(credentials_.ws_endpoint);
+    start_public_ws("Bithumb-WS", credentials_.ws_endpoint, PUBLIC_WS_STALL_BUDGET);
+    start_redundant_feed(credentials_.ws_endpoint);
 
     const std::string private_ws_endpoint = resolve_private_ws_endpoint();
     if (!private_ws_endpoint.empty() &&
@@ -334,9 +317,7 @@ void BithumbExchange::disconnect() {
     // Shutdown REST connection pool
     shutdown_rest();
 
-    if (ws_client_) {
-        ws_client_->disconnect();
-    }
+    stop_public_ws();
     connected_ = false;
     Logger::info("[Bithumb] Disconnected");
 }
@@ -348,7 +329,7 @@ void BithumbExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         subscribed_tickers_ = symbols;
     }
 
-    if (!ws_client_ || !ws_client_->is_connected()) {
+    if (!public_ws_connected()) {
         Logger::error("[Bithumb] Cannot subscribe, not connected");
         return;
     }
@@ -369,7 +350,7 @@ void BithumbExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         }
 
         ss << R"(],"tickTypes":["MID"]})";
-        ws_client_->send(ss.str());
+        send_public(ss.str());
 
         if (end < symbols.size()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
@@ -387,7 +368,7 @@ void BithumbExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols)
         subscribed_orderbooks_ = symbols;
     }
 
-    if (!ws_client_ || !ws_client_->is_connected()) {
+    if (!public_ws_connected()) {
         Logger::error("[Bithumb] Cannot subscribe orderbook, not connected");
         return;
     }
@@ -408,20 +389,20 @@ void BithumbExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols)
         }
 
         ss << R"(]})";
-        ws_client_->send(ss.str());
+        send_public(ss.str());
 
         if (end < symbols.size()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
         }
     }
 
-    // Pre-populate orderbook_bbo_ map for all subscribed symbols.
-    // This guarantees the map structure is immutable after this point,
-    // allowing lock-free atomic reads from the ticker hot path.
+    // Pre-populate orderbook_bbo_ for all subscribed symbols. Entries are
+    // published fully built and never move, so the ticker hot path reads
+    // them lock-free.
     {
         std::lock_guard lock(orderbook_mutex_);
         for (const auto& sym : symbols) {
-            orderbook_bbo_[sym];  // default-construct BBO entry
+            orderbook_bbo_.get_or_add(sym);  // default-construct BBO entry
         }
     }
 
@@ -431,6 +412,44 @@ void BithumbExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols)
     start_orderbook_resync_loop();
 }
 
+void BithumbExchange::add_market_subscriptions(const std::vector<SymbolId>& symbols) {
+    std::vector<SymbolId> fresh;
+    {
+        std::lock_guard lock(subscription_mutex_);
+        for (const auto& sym : symbols) {
+            if (std::find(subscribed_tickers_.begin(), subscribed_tickers_.end(), sym) ==
+                subscribed_tickers_.end()) {
+                subscribed_tickers_.push_back(sym);
+                subscribed_orderbooks_.push_back(sym);  // Resync loop snapshots it within one interval
+                fresh.push_back(sym);
+            }
+        }
+    }
+    if (fresh.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(orderbook_mutex_);
+        for (const auto& sym : fresh) {
+            orderbook_bbo_.get_or_add(sym);
+        }
+    }
+
+    // Reconnects resubscribe the stored lists; a live stream takes additive filters
+    if (!public_ws_connected()) {
+        return;
+    }
+    std::string codes;
+    for (const auto& sym : fresh) {
+        if (!codes.empty()) codes += ",";
+        codes += "\"" + sym.to_bithumb_format() + "\"";
+    }
+    send_public(R"({"type":"ticker","symbols":[)" + codes + R"(],"tickTypes":["MID"]})");
+    send_public(R"({"type":"orderbookdepth","symbols":[)" + codes + R"(]})");
+    Logger::info("[Bithumb] Added {} symbols to live ticker/orderbook streams", fresh.size());
+}
+
 void BithumbExchange::start_orderbook_resync_loop() {
     if (orderbook_resync_running_.exchange(true, std::memory_order_acq_rel)) {
         return;
@@ -542,12 +561,12 @@ std::vector<Ticker> BithumbExchange::fetch_all_tickers() {
                 if (orderbook_ready_.load(std::memory_order_acquire)) {
                     {
                         std::lock_guard lock(orderbook_mutex_);
-                        auto bbo_it = orderbook_bbo_.find(ticker.symbol);
-                        if (bbo_it != orderbook_bbo_.end()) {
-                            double real_bid = bbo_it->second.best_bid.load(std::memory_order_acquire);
-                            double real_ask = bbo_it->second.best_ask.load(std::memory_order_acquire);
-                            double real_bid_qty = bbo_it->second.best_bid_qty.load(std::memory_order_acquire);
-                            double real_ask_qty = bbo_it->second.best_ask_qty.load(std::memory_order_acquire);
+                        auto* bbo_entry = orderbook_bbo_.find(ticker.symbol);
+                        if (bbo_entry != nullptr) {
+                            double real_bid = bbo_entry->best_bid.load(std::memory_order_acquire);
+                            double real_ask = bbo_entry->best_ask.load(std::memory_order_acquire);
+                            double real_bid_qty = bbo_entry->best_bid_qty.load(std::memory_order_acquire);
+                            double real_ask_qty = bbo_entry->best_ask_qty.load(std::memory_order_acquire);
                             if (real_bid > 0.0) ticker.bid = real_bid;
                             if (real_ask > 0.0) ticker.ask = real_ask;
                             if (real_bid_qty > 0.0) ticker.bid_qty = real_bid_qty;
@@ -979,6 +998,26 @@ std::vector<AccountBalance> BithumbExchange::get_all_balances() {
 void BithumbExchange::on_ws_message(std::string_view message) {
     // Fast message type routing via string search (avoids double JSON parse)
     if (message.find("orderbookdepth") != std::string_view::npos) {
+        // Depth levels are applied in place, so the redundant-feed gate must run
+        // on the raw frame (keyed by its first symbol) before the book mutates.
+        if (redundant_feed_enabled()) {
+            static constexpr std::string_view symbol_marker = R"("symbol":")";
+            std::string_view frame_symbol;
+            const size_t sym_pos = message.find(symbol_marker);
+            if (sym_pos != std::string_view::npos) {
+                const size_t sym_start = sym_pos + symbol_marker.size();
+                const size_t sym_end = message.find('"', sym_start);
+                if (sym_end != std::string_view::npos) {
+                    frame_symbol = message.substr(sym_start, sym_end - sym_start);
+                }
+            }
+            const uint64_t version = network::FeedArbiter::parse_version(message, R"("datetime":)");
+            if (!accept_feed_update(network::FeedArbiter::make_key(network::FeedArbiter::fingerprint(frame_symbol), 1),
+                                    version, message)) {
+                return;
+            }
+        }
+
         auto updated_symbols = parse_orderbookdepth_message(message);
 
         // Dispatch synthetic tickers for BBO-changed symbols (0ms propagation)
@@ -991,24 +1030,42 @@ void BithumbExchange::on_ws_message(std::string_view message) {
                 }
                 dispatch_ticker(*ticker);
             }
+            if (orderbook_callback_) {
+                OrderBook book;
+                for (const auto& sym : updated_symbols) {
+                    if (make_depth_book(sym, book)) {
+                        dispatch_orderbook(book);
+                    }
+                }
+            }
         }
         return;
     }
 
     Ticker ticker;
     if (parse_ticker_message(message, ticker)) {
+        if (redundant_feed_enabled()) {
+            // Ticker pushes only carry second-resolution "date"/"time"; the frame
+            // fingerprint separates updates within the same second.
+            ticker.sequence = network::FeedArbiter::parse_version(message, R"("date":)") * 1000000ULL +
+                              network::FeedArbiter::parse_version(message, R"("time":)");
+            if (!accept_feed_update(network::FeedArbiter::make_key(ticker.symbol.hash(), 0),
+                                    ticker.sequence, message)) {
+                return;
+            }
+        }
         if (ticker.symbol.get_base() == "USDT") {
             usdt_krw_price_.store(ticker.last);
         }
 
         // Overlay real bid/ask from orderbook BBO (lock-free — map structure is immutable)
         if (orderbook_ready_.load(std::memory_order_acquire)) {
-            auto bbo_it = orderbook_bbo_.find(ticker.symbol);
-            if (bbo_it != orderbook_bbo_.end()) {
-                double real_bid = bbo_it->second.best_bid.load(std::memory_order_acquire);
-                double real_ask = bbo_it->second.best_ask.load(std::memory_order_acquire);
-                double real_bid_qty = bbo_it->second.best_bid_qty.load(std::memory_order_acquire);
-                double real_ask_qty = bbo_it->second.best_ask_qty.load(std::memory_order_acquire);
+            auto* bbo_entry = orderbook_bbo_.find(ticker.symbol);
+            if (bbo_entry != nullptr) {
+                double real_bid = bbo_entry->best_bid.load(std::memory_order_acquire);
+                double real_ask = bbo_entry->best_ask.load(std::memory_order_acquire);
+                double real_bid_qty = bbo_entry->best_bid_qty.load(std::memory_order_acquire);
+                double real_ask_qty = bbo_entry->best_ask_qty.load(std::memory_order_acquire);
                 if (real_bid > 0.0) ticker.bid = real_bid;
                 if (real_ask > 0.0) ticker.ask = real_ask;
                 if (real_bid_qty > 0.0) ticker.bid_qty = real_bid_qty;
@@ -1020,6 +1077,35 @@ void BithumbExchange::on_ws_message(std::string_view message) {
     }
 }
 
+int64_t BithumbExchange::venue_event_time_ms(std::string_view message) const {
+    // Only depth frames carry an event time (microseconds); ticker pushes
+    // have second-resolution local date/time fields.
+    if (message.find("orderbookdepth") == std::string_view::npos) {
+        return 0;
+    }
+    return static_cast<int64_t>(network::FeedArbiter::parse_version(message, R"("datetime":)") / 1000);
+}
+
+bool BithumbExchange::fetch_server_time_ns(int64_t& server_ns) {
+    auto response = rest_client_->get("/public/ticker/BTC_KRW");
+    if (!response.success) {
+        return false;
+    }
+    try {
+        simdjson::ondemand::parser local_parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = local_parser.iterate(padded);
+        std::string_view date_str = doc["data"]["date"].get_string().value();
+        int64_t value = 0;
+        std::from_chars(date_str.data(), date_str.data() + date_str.size(), value);
+        server_ns = value * 1'000'000 + 500'000;
+        return server_ns > 500'000;
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::warn("[Bithumb] Failed to parse server time: {}", e.what());
+    }
+    return false;
+}
+
 void BithumbExchange::on_ws_connected() {
     connected_ = true;
     Logger::info("[Bithumb] WebSocket connected");
@@ -1239,9 +1325,9 @@ void BithumbExchange::subscribe_private_myorder() {
 bool BithumbExchange::parse_ticker_message(std::string_view message, Ticker& ticker) {
     if (parse_ticker_fast(message, ticker)) {
         // Update last_price in lock-free BBO cache (map structure immutable)
-        auto bbo_it = orderbook_bbo_.find(ticker.symbol);
-        if (bbo_it != orderbook_bbo_.end()) {
-            bbo_it->second.last_price.store(ticker.last, std::memory_order_release);
+        auto* bbo_entry = orderbook_bbo_.find(ticker.symbol);
+        if (bbo_entry != nullptr) {
+            bbo_entry->last_price.store(ticker.last, std::memory_order_release);
         }
         return true;
     }
@@ -1274,9 +1360,9 @@ bool BithumbExchange::parse_ticker_message(std::string_view message, Ticker& tic
         ticker.ask = 0.0;
 
         // Cache last price in lock-free BBO (map structure immutable)
-        auto bbo_it = orderbook_bbo_.find(ticker.symbol);
-        if (bbo_it != orderbook_bbo_.end()) {
-            bbo_it->second.last_price.store(ticker.last, std::memory_order_release);
+        auto* bbo_entry = orderbook_bbo_.find(ticker.symbol);
+        if (bbo_entry != nullptr) {
+            bbo_entry->last_price.store(ticker.last, std::memory_order_release);
         }
 
         return true;
@@ -1288,20 +1374,20 @@ bool BithumbExchange::parse_ticker_message(std::string_view message, Ticker& tic
 
 std::optional<Ticker> BithumbExchange::make_bbo_ticker(const SymbolId& symbol) {
     // Lock-free: map structure is immutable after subscribe, only atomics are read
-    auto bbo_it = orderbook_bbo_.find(symbol);
-    if (bbo_it == orderbook_bbo_.end()) {
+    auto* bbo_entry = orderbook_bbo_.find(symbol);
+    if (bbo_entry == nullptr) {
         return std::nullopt;
     }
 
-    const double bid = bbo_it->second.best_bid.load(std::memory_order_acquire);
-    const double ask = bbo_it->second.best_ask.load(std::memory_order_acquire);
-    const double bid_qty = bbo_it->second.best_bid_qty.load(std::memory_order_acquire);
-    const double ask_qty = bbo_it->second.best_ask_qty.load(std::memory_order_acquire);
+    const double bid = bbo_entry->best_bid.load(std::memory_order_acquire);
+    const double ask = bbo_entry->best_ask.load(std::memory_order_acquire);
+    const double bid_qty = bbo_entry->best_bid_qty.load(std::memory_order_acquire);
+    const double ask_qty = bbo_entry->best_ask_qty.load(std::memory_order_acquire);
     if (bid <= 0.0 || ask <= 0.0) {
         return std::nullopt;
     }
 
-    double last = bbo_it->second.last_price.load(std::memory_order_acquire);
+    double last = bbo_entry->last_price.load(std::memory_order_acquire);
     if (last <= 0.0) {
         last = (bid + ask) * 0.5;
     }
@@ -1318,6 +1404,28 @@ std::optional<Ticker> BithumbExchange::make_bbo_ticker(const SymbolId& symbol) {
     return ticker;
 }
 
+bool BithumbExchange::make_depth_book(const SymbolId& symbol, OrderBook& out) {
+    std::lock_guard lock(orderbook_mutex_);
+    auto state_it = orderbook_state_.find(symbol);
+    if (state_it == orderbook_state_.end() || !state_it->second.initialized) {
+        return false;
+    }
+
+    const auto& state = state_it->second;
+    out.exchange = Exchange::Bithumb;
+    out.symbol = symbol;
+    out.timestamp = std::chrono::steady_clock::now();
+    out.bid_count = 0;
+    out.ask_count = 0;
+    for (auto it = state.bids.begin(); it != state.bids.end() && out.bid_count < OrderBook::MAX_LEVELS; ++it) {
+        out.bids[out.bid_count++] = {it->first, it->second};
+    }
+    for (auto it = state.asks.begin(); it != state.asks.end() && out.ask_count < OrderBook::MAX_LEVELS; ++it) {
+        out.asks[out.ask_count++] = {it->first, it->second};
+    }
+    return out.bid_count > 0 || out.ask_count > 0;
+}
+
 std::vector<SymbolId> BithumbExchange::parse_orderbookdepth_message(std::string_view message) {
     std::vector<SymbolId> updated_symbols;
     std::vector<FastBithumbDepthUpdate> fast_updates;
@@ -1440,11 +1548,11 @@ void BithumbExchange::update_bbo(const SymbolId& symbol) {
     auto state_it = orderbook_state_.find(symbol);
     if (state_it == orderbook_state_.end() || !state_it->second.initialized) return;
 
-    auto bbo_it = orderbook_bbo_.find(symbol);
-    if (bbo_it == orderbook_bbo_.end()) return;  // not pre-populated — skip
+    auto* bbo_entry = orderbook_bbo_.find(symbol);
+    if (bbo_entry == nullptr) return;  // not pre-populated — skip
 
     const auto& state = state_it->second;
-    auto& bbo = bbo_it->second;
+    auto& bbo = *bbo_entry;
 
     if (!state.bids.empty()) {
         bbo.best_bid.store(state.bids.begin()->first, std::memory_order_release);
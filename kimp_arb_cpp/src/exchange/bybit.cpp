@@ -2,7 +2,9 @@
 #include "kimp/exchange/bybit/bybit_trade_ws.hpp"
 #include "kimp/core/logger.hpp"
 #include "kimp/core/optimization.hpp"
+#include "kimp/core/price_format.hpp"
 
+#include <charconv>
 #include <sstream>
 #include <iomanip>
 #include <cstdlib>
@@ -14,6 +16,16 @@ namespace kimp::exchange::bybit {
 
 namespace {
 
+// Order type fields of a spot order body: market by base quantity, or an
+// IOC limit when limit_price is set
+std::string spot_order_type_fields(double limit_price) {
+    if (limit_price > 0.0) {
+        return "\"orderType\":\"Limit\",\"timeInForce\":\"IOC\",\"price\":\"" +
+               kimp::format::format_decimal_trimmed(limit_price, 10) + "\",";
+    }
+    return "\"orderType\":\"Market\",\"marketUnit\":\"baseCoin\",";
+}
+
 bool parse_quoted_double_pair(std::string_view message,
                               std::string_view marker,
                               double& first,
@@ -122,25 +134,8 @@ bool BybitExchange::connect() {
     }
     Logger::info("[Bybit] REST connection pool initialized (4 persistent connections)");
 
-    ws_client_ = std::make_shared<network::WebSocketClient>(io_context_, "Bybit-WS");
-
-    ws_client_->set_message_callback([this](std::string_view msg, network::MessageType /*type*/) {
-        on_ws_message(msg);
-    });
-
-    ws_client_->set_connect_callback([this](bool success, const std::string& error) {
-        if (success) {
-            on_ws_connected();
-        } else {
-            Logger::error("[Bybit] Connection failed: {}", error);
-        }
-    });
-
-    ws_client_->set_disconnect_callback([this](const std::string& /*reason*/) {
-        on_ws_disconnected();
-    });
-
-    ws_client_->connect(resolve_public_ws_endpoint());
+    start_public_ws("Bybit-WS", resolve_public_ws_endpoint(), PUBLIC_WS_STALL_BUDGET);
+    start_redundant_feed(resolve_public_ws_endpoint());
 
     // Initialize WebSocket Trade API for low-latency order placement
     if (!credentials_.ws_trade_endpoint.empty()) {
@@ -191,9 +186,7 @@ void BybitExchange::disconnect() {
     // Shutdown REST connection pool
     shutdown_rest();
 
-    if (ws_client_) {
-        ws_client_->disconnect();
-    }
+    stop_public_ws();
     connected_ = false;
     Logger::info("[Bybit] Disconnected");
 }
@@ -205,7 +198,7 @@ void BybitExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         subscribed_tickers_ = symbols;
     }
 
-    if (!ws_client_ || !ws_client_->is_connected()) {
+    if (!public_ws_connected()) {
         Logger::error("[Bybit] Cannot subscribe, not connected");
         return;
     }
@@ -227,7 +220,7 @@ void BybitExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         }
 
         ss << "]}";
-        ws_client_->send(ss.str());
+        send_public(ss.str());
 
         // Tiny pacing keeps startup fast without overwhelming the socket.
         if (end < symbols.size()) {
@@ -245,8 +238,30 @@ void BybitExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols) {
         subscribed_orderbooks_ = symbols;
     }
 
-    if (!ws_client_ || !ws_client_->is_connected()) return;
+    if (!public_ws_connected()) return;
+
+    send_orderbook_subscribe(symbols);
+}
+
+void BybitExchange::add_market_subscriptions(const std::vector<SymbolId>& symbols) {
+    std::vector<SymbolId> fresh;
+    {
+        std::lock_guard lock(subscription_mutex_);
+        for (const auto& sym : symbols) {
+            if (std::find(subscribed_orderbooks_.begin(), subscribed_orderbooks_.end(), sym) ==
+                subscribed_orderbooks_.end()) {
+                subscribed_orderbooks_.push_back(sym);
+                fresh.push_back(sym);
+            }
+        }
+    }
+
+    // Subscribes are additive: only the new topics go out on the live stream
+    if (fresh.empty() || !public_ws_connected()) return;
+    send_orderbook_subscribe(fresh);
+}
 
+void BybitExchange::send_orderbook_subscribe(const std::vector<SymbolId>& symbols) {
     // Bybit WS allows max 10 args per subscribe request — batch to avoid silent drops
     constexpr size_t BATCH_SIZE = 10;
 
@@ -264,7 +279,7 @@ void BybitExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols) {
         }
 
         ss << "]}";
-        ws_client_->send(ss.str());
+        send_public(ss.str());
 
         if (end < symbols.size()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
@@ -331,6 +346,10 @@ std::vector<SymbolId> BybitExchange::get_available_symbols() {
                         info.min_notional = std::max(info.min_notional,
                                                      opt::fast_stod(min_notional.get_string().value()));
                     }
+                    auto tick = item["priceFilter"]["tickSize"];
+                    if (!tick.error()) {
+                        info.tick_size = opt::fast_stod(tick.get_string().value());
+                    }
                     std::unique_lock lock(metadata_mutex_);
                     lot_size_cache_[std::string(symbol_str)] = info;
                 }
@@ -406,49 +425,70 @@ std::vector<Ticker> BybitExchange::fetch_all_tickers() {
 }
 
 Order BybitExchange::place_market_order(const SymbolId& symbol, Side side, Quantity quantity) {
+    return place_spot_order(symbol, side, quantity, 0.0);
+}
+
+Order BybitExchange::place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
+    const double price = normalize_limit_price(symbol, limit_price, side == Side::Buy);
+    if (price <= 0.0) {
+        Order order;
+        order.exchange = Exchange::Bybit;
+        order.status = OrderStatus::Rejected;
+        return order;
+    }
+    return place_spot_order(symbol, side, quantity, price);
+}
+
+Order BybitExchange::place_spot_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
     Order order;
     order.exchange = Exchange::Bybit;
     order.symbol = symbol;
     order.side = side;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     order.quantity = quantity;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     char body_buf[512];
     int body_len = std::snprintf(body_buf, sizeof(body_buf),
         "{\"category\":\"spot\",\"symbol\":\"%s\",\"side\":\"%s\","
-        "\"orderType\":\"Market\",\"qty\":\"%.8f\","
-        "\"orderFilter\":\"Order\",\"marketUnit\":\"baseCoin\"}",
+        "%s\"qty\":\"%.8f\",\"orderLinkId\":\"%s\",\"orderFilter\":\"Order\"}",
         symbol_to_bybit(symbol).c_str(),
         side == Side::Buy ? "Buy" : "Sell",
-        quantity);
+        spot_order_type_fields(limit_price).c_str(),
+        quantity, order.client_id.c_str());
     if (body_len <= 0 || static_cast<size_t>(body_len) >= sizeof(body_buf)) {
         order.status = OrderStatus::Rejected;
         Logger::error("[Bybit] Order body buffer overflow");
         return order;
     }
-    std::string body_str(body_buf, static_cast<size_t>(body_len));
-    auto headers = build_auth_headers(body_str);
-    headers["Content-Type"] = "application/json";
+    submit_order(std::string(body_buf, static_cast<size_t>(body_len)), order, "Order");
+    return order;
+}
 
-    auto response = rest_client_->post("/v5/order/create", body_str, headers);
-    if (!response.success) {
+Order BybitExchange::open_short(const SymbolId& symbol, Quantity quantity) {
+    return open_short_at(symbol, quantity, 0.0);
+}
+
+Order BybitExchange::open_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) {
+    const double price = normalize_limit_price(symbol, limit_price, false);
+    if (price <= 0.0) {
+        Order order;
+        order.exchange = Exchange::Bybit;
         order.status = OrderStatus::Rejected;
-        Logger::error("[Bybit] Order failed: {}", response.body);
         return order;
     }
-
-    parse_order_response(response.body, order, &order.order_id_str);
-    return order;
+    return open_short_at(symbol, quantity, price);
 }
 
-Order BybitExchange::open_short(const SymbolId& symbol, Quantity quantity) {
+Order BybitExchange::open_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price) {
     Order order;
     order.exchange = Exchange::Bybit;
     order.symbol = symbol;
     order.side = Side::Sell;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     double adj_qty = normalize_order_qty(symbol, quantity, true);
     if (adj_qty <= 0.0) {
         order.status = OrderStatus::Rejected;
@@ -456,7 +496,7 @@ Order BybitExchange::open_short(const SymbolId& symbol, Quantity quantity) {
         return order;
     }
     order.quantity = adj_qty;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     if (!ensure_spot_margin_mode()) {
@@ -468,42 +508,35 @@ Order BybitExchange::open_short(const SymbolId& symbol, Quantity quantity) {
     // Try WebSocket Trade API first (~5-20ms vs ~150-300ms REST)
     if (trade_ws_ && trade_ws_->is_connected()) {
         Order ws_order = trade_ws_->place_order_sync(
-            symbol_to_bybit(symbol), Side::Sell, adj_qty, true);
+            symbol_to_bybit(symbol), Side::Sell, adj_qty, true, limit_price, order.client_id);
         if (ws_order.status != OrderStatus::Rejected) {
             ws_order.symbol = symbol;
             ws_order.quantity = adj_qty;
             ws_order.client_order_id = order.client_order_id;
+            ws_order.client_id = order.client_id;
             Logger::info("[Bybit-WS] Opened spot-margin short {} {} - orderId: {}",
                          symbol.to_string(), adj_qty, ws_order.order_id_str);
             return ws_order;
         }
-        Logger::warn("[Bybit] WS order failed, falling back to REST");
+        Logger::warn("[Bybit] WS order failed, falling back to REST under the same orderLinkId");
     }
 
     // REST fallback
     char body_buf[512];
     int body_len = std::snprintf(body_buf, sizeof(body_buf),
         "{\"category\":\"spot\",\"symbol\":\"%s\",\"side\":\"Sell\","
-        "\"orderType\":\"Market\",\"qty\":\"%.8f\",\"isLeverage\":1,"
-        "\"orderFilter\":\"Order\",\"marketUnit\":\"baseCoin\"}",
-        symbol_to_bybit(symbol).c_str(), adj_qty);
+        "%s\"qty\":\"%.8f\",\"orderLinkId\":\"%s\",\"isLeverage\":1,\"orderFilter\":\"Order\"}",
+        symbol_to_bybit(symbol).c_str(), spot_order_type_fields(limit_price).c_str(), adj_qty,
+        order.client_id.c_str());
     if (body_len <= 0 || static_cast<size_t>(body_len) >= sizeof(body_buf)) {
         order.status = OrderStatus::Rejected;
         Logger::error("[Bybit] Short open body buffer overflow");
         return order;
     }
-    std::string body_str(body_buf, static_cast<size_t>(body_len));
-    auto headers = build_auth_headers(body_str);
-    headers["Content-Type"] = "application/json";
-
-    auto response = rest_client_->post("/v5/order/create", body_str, headers);
-    if (!response.success) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[Bybit] Spot-margin short open failed: {}", response.body);
+    submit_order(std::string(body_buf, static_cast<size_t>(body_len)), order, "Spot-margin short open");
+    if (order.status == OrderStatus::Rejected || order.status == OrderStatus::Unknown) {
         return order;
     }
-
-    parse_order_response(response.body, order, &order.order_id_str);
     Logger::info("[Bybit-REST] Opened spot-margin short {} {} - Status: {}, orderId: {}",
                  symbol.to_string(), adj_qty, static_cast<int>(order.status),
                  order.order_id_str);
@@ -511,11 +544,27 @@ Order BybitExchange::open_short(const SymbolId& symbol, Quantity quantity) {
 }
 
 Order BybitExchange::close_short(const SymbolId& symbol, Quantity quantity) {
+    return close_short_at(symbol, quantity, 0.0);
+}
+
+Order BybitExchange::close_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) {
+    const double price = normalize_limit_price(symbol, limit_price, true);
+    if (price <= 0.0) {
+        Order order;
+        order.exchange = Exchange::Bybit;
+        order.status = OrderStatus::Rejected;
+        return order;
+    }
+    return close_short_at(symbol, quantity, price);
+}
+
+Order BybitExchange::close_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price) {
     Order order;
     order.exchange = Exchange::Bybit;
     order.symbol = symbol;
     order.side = Side::Buy;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     double adj_qty = normalize_close_qty(symbol, quantity);
     if (adj_qty <= 0.0) {
         order.status = OrderStatus::Rejected;
@@ -523,7 +572,7 @@ Order BybitExchange::close_short(const SymbolId& symbol, Quantity quantity) {
         return order;
     }
     order.quantity = adj_qty;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     if (!ensure_spot_margin_mode()) {
@@ -536,44 +585,42 @@ Order BybitExchange::close_short(const SymbolId& symbol, Quantity quantity) {
     // Try WebSocket Trade API first (~5-20ms vs ~150-300ms REST)
     if (trade_ws_ && trade_ws_->is_connected()) {
         Order ws_order = trade_ws_->place_order_sync(
-            symbol_to_bybit(symbol), Side::Buy, adj_qty, true);
+            symbol_to_bybit(symbol), Side::Buy, adj_qty, true, limit_price, order.client_id);
         if (ws_order.status != OrderStatus::Rejected) {
             ws_order.symbol = symbol;
             ws_order.quantity = adj_qty;
             ws_order.client_order_id = order.client_order_id;
+            ws_order.client_id = order.client_id;
             Logger::info("[Bybit-WS] Closed spot-margin short {} {} - orderId: {}",
                          symbol.to_string(), adj_qty, ws_order.order_id_str);
             // Step 2: Repay the margin borrow (UTA does not auto-repay on buy).
             repay_margin_borrow(std::string(symbol.get_base()));
             return ws_order;
         }
-        Logger::warn("[Bybit] WS close failed, falling back to REST");
+        Logger::warn("[Bybit] WS close failed, falling back to REST under the same orderLinkId");
     }
 
     // REST fallback
     char body_buf[512];
     int body_len = std::snprintf(body_buf, sizeof(body_buf),
         "{\"category\":\"spot\",\"symbol\":\"%s\",\"side\":\"Buy\","
-        "\"orderType\":\"Market\",\"qty\":\"%.8f\",\"isLeverage\":1,"
-        "\"orderFilter\":\"Order\",\"marketUnit\":\"baseCoin\"}",
-        symbol_to_bybit(symbol).c_str(), adj_qty);
+        "%s\"qty\":\"%.8f\",\"orderLinkId\":\"%s\",\"isLeverage\":1,\"orderFilter\":\"Order\"}",
+        symbol_to_bybit(symbol).c_str(), spot_order_type_fields(limit_price).c_str(), adj_qty,
+        order.client_id.c_str());
     if (body_len <= 0 || static_cast<size_t>(body_len) >= sizeof(body_buf)) {
         order.status = OrderStatus::Rejected;
         Logger::error("[Bybit] Short close body buffer overflow");
         return order;
     }
-    std::string body_str(body_buf, static_cast<size_t>(body_len));
-    auto headers = build_auth_headers(body_str);
-    headers["Content-Type"] = "application/json";
-
-    auto response = rest_client_->post("/v5/order/create", body_str, headers);
-    if (!response.success) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[Bybit] Spot-margin short close failed: {}", response.body);
+    submit_order(std::string(body_buf, static_cast<size_t>(body_len)), order, "Spot-margin short close");
+    if (order.status == OrderStatus::Unknown) {
+        std::lock_guard lock(unrepaid_closes_mutex_);
+        unrepaid_closes_.insert(order.client_id);  // Repaid by lookup_client_order once found
+        return order;
+    }
+    if (order.status == OrderStatus::Rejected) {
         return order;
     }
-
-    parse_order_response(response.body, order, &order.order_id_str);
     Logger::info("[Bybit-REST] Closed spot-margin short {} {} - Status: {}, orderId: {}",
                  symbol.to_string(), adj_qty, static_cast<int>(order.status),
                  order.order_id_str);
@@ -651,6 +698,18 @@ double BybitExchange::normalize_close_qty(const SymbolId& symbol, double qty) co
     return qty;
 }
 
+double BybitExchange::normalize_limit_price(const SymbolId& symbol, double price, bool buy) const {
+    double tick = 0.0;
+    {
+        std::shared_lock lock(metadata_mutex_);
+        auto it = lot_size_cache_.find(symbol_to_bybit(symbol));
+        if (it != lot_size_cache_.end()) {
+            tick = it->second.tick_size;
+        }
+    }
+    return format::round_limit_to_tick(price, tick, buy);
+}
+
 bool BybitExchange::cancel_order(uint64_t /*order_id*/) {
     // TODO: Implement if needed
     return false;
@@ -924,6 +983,18 @@ std::vector<AccountBalance> BybitExchange::get_all_balances() {
 void BybitExchange::on_ws_message(std::string_view message) {
     Ticker ticker;
     if (parse_ticker_message(message, ticker)) {
+        if (redundant_feed_enabled()) {
+            // orderbook.1 carries a cross sequence ("seq"); tickers only the push ts
+            const bool is_book = message.find(R"("topic":"orderbook.1.)") != std::string_view::npos;
+            ticker.sequence = is_book ? network::FeedArbiter::parse_version(message, R"("seq":)") : 0;
+            if (ticker.sequence == 0) {
+                ticker.sequence = network::FeedArbiter::parse_version(message, R"("ts":)");
+            }
+            if (!accept_feed_update(network::FeedArbiter::make_key(ticker.symbol.hash(), is_book ? 1 : 0),
+                                    ticker.sequence, message)) {
+                return;
+            }
+        }
         dispatch_ticker(ticker);
     } else if (!public_ws_parse_warned_.exchange(true, std::memory_order_relaxed) &&
                message.find("orderbook.1.") != std::string_view::npos) {
@@ -932,6 +1003,31 @@ void BybitExchange::on_ws_message(std::string_view message) {
     }
 }
 
+int64_t BybitExchange::venue_event_time_ms(std::string_view message) const {
+    // Push generation time; "cts" (matching-engine time) is only on orderbook frames
+    return static_cast<int64_t>(network::FeedArbiter::parse_version(message, R"("ts":)"));
+}
+
+bool BybitExchange::fetch_server_time_ns(int64_t& server_ns) {
+    auto response = rest_client_->get("/v5/market/time");
+    if (!response.success) {
+        return false;
+    }
+    try {
+        simdjson::ondemand::parser local_parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = local_parser.iterate(padded);
+        std::string_view nano_str = doc["result"]["timeNano"].get_string().value();
+        int64_t value = 0;
+        std::from_chars(nano_str.data(), nano_str.data() + nano_str.size(), value);
+        server_ns = value;
+        return server_ns > 0;
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::warn("[Bybit] Failed to parse server time: {}", e.what());
+    }
+    return false;
+}
+
 void BybitExchange::on_ws_connected() {
     connected_ = true;
     Logger::info("[Bybit] WebSocket connected");
@@ -1123,7 +1219,8 @@ bool BybitExchange::parse_ticker_message(std::string_view message, Ticker& ticke
     }
 }
 
-bool BybitExchange::parse_order_response(const std::string& response, Order& order, std::string* order_id_out) {
+bool BybitExchange::parse_order_response(const std::string& response, Order& order, std::string* order_id_out,
+                                         bool* duplicate_id) {
     Logger::debug("[Bybit] Order raw response: {}", response);
 
     try {
@@ -1145,7 +1242,12 @@ bool BybitExchange::parse_order_response(const std::string& response, Order& ord
         } else {
             order.status = OrderStatus::Rejected;
             std::string_view msg = doc["retMsg"].get_string().value();
-            Logger::error("[Bybit] Order rejected: {}", msg);
+            if (ret_code == 110072 && duplicate_id) {
+                *duplicate_id = true;  // orderLinkId taken: an earlier attempt landed
+                Logger::warn("[Bybit] Order {} already exists: {}", order.client_id, msg);
+            } else {
+                Logger::error("[Bybit] Order rejected: {}", msg);
+            }
         }
 
         return true;
@@ -1156,6 +1258,93 @@ bool BybitExchange::parse_order_response(const std::string& response, Order& ord
     }
 }
 
+void BybitExchange::submit_order(const std::string& body, Order& order, const char* what) {
+    const OrderSubmitPolicy& policy = order_submit_policy();
+    auto submit = [&](Order& o) {
+        // Fresh timestamp per attempt; the orderLinkId in the body stays
+        auto headers = build_auth_headers(body);
+        headers["Content-Type"] = "application/json";
+        auto response = rest_client_->post("/v5/order/create", body, headers, policy.timeout);
+        if (outcome_unknown(response)) {
+            Logger::warn("[Bybit] {} {} unanswered ({}), checking orderLinkId", what, o.client_id,
+                         response.error.empty() ? response.body : response.error);
+            return SubmitReply::Unknown;
+        }
+        if (!response.success) {
+            o.status = OrderStatus::Rejected;
+            Logger::error("[Bybit] {} failed: {}", what, response.body);
+            return SubmitReply::Rejected;
+        }
+        bool duplicate = false;
+        if (!parse_order_response(response.body, o, &o.order_id_str, &duplicate)) {
+            return SubmitReply::Unknown;
+        }
+        if (duplicate) {
+            return SubmitReply::Duplicate;
+        }
+        return o.status == OrderStatus::Rejected ? SubmitReply::Rejected : SubmitReply::Accepted;
+    };
+    auto lookup = [&](Order& o) { return lookup_order_link(o); };
+
+    const SubmitOutcome outcome = submit_idempotent(policy, order, submit, lookup);
+    if (outcome.reconciled) {
+        Logger::warn("[Bybit] {} {} reconciled by orderLinkId after {} submit(s): orderId {}",
+                     what, order.client_id, outcome.submits, order.order_id_str);
+    } else if (outcome.reply == SubmitReply::Unknown) {
+        Logger::error("[Bybit] {} {} unresolved after {} submit(s) and {} lookup(s)",
+                      what, order.client_id, outcome.submits, outcome.lookups);
+    }
+}
+
+LookupReply BybitExchange::lookup_client_order(Order& order) {
+    const LookupReply reply = lookup_order_link(order);
+    if (reply == LookupReply::Unknown) {
+        return reply;
+    }
+    bool close = false;
+    {
+        std::lock_guard lock(unrepaid_closes_mutex_);
+        close = unrepaid_closes_.erase(order.client_id) > 0;
+    }
+    if (close && reply == LookupReply::Found && order.status != OrderStatus::Rejected) {
+        repay_margin_borrow(std::string(order.symbol.get_base()));
+    }
+    return reply;
+}
+
+LookupReply BybitExchange::lookup_order_link(Order& order) {
+    const std::string query = "category=spot&orderLinkId=" + order.client_id;
+    auto headers = build_auth_headers(query);
+    auto response = rest_client_->get("/v5/order/realtime?" + query, headers, order_submit_policy().timeout);
+    if (!response.success) {
+        return LookupReply::Unknown;
+    }
+
+    try {
+        simdjson::ondemand::parser local_parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = local_parser.iterate(padded);
+        if (doc["retCode"].get_int64().value() != 0) {
+            return LookupReply::Unknown;
+        }
+        for (auto item : doc["result"]["list"].get_array()) {
+            std::string_view order_id = item["orderId"].get_string().value();
+            auto status_field = item["orderStatus"];
+            const std::string_view status = status_field.error() ? std::string_view{}
+                                                                 : status_field.get_string().value();
+            order.order_id_str = std::string(order_id);
+            order.exchange_order_id = std::hash<std::string_view>{}(order_id);
+            // Same as the create ack: accepted, fill pending
+            order.status = status == "Rejected" ? OrderStatus::Rejected : OrderStatus::Filled;
+            return LookupReply::Found;
+        }
+        return LookupReply::NotFound;
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::warn("[Bybit] Failed to parse orderLinkId lookup: {}", e.what());
+        return LookupReply::Unknown;
+    }
+}
+
 bool BybitExchange::query_order_fill(const std::string& order_id, Order& order) {
     // Try WS fill cache first (~50-200ms vs ~300ms+ REST)
     if (private_ws_authenticated_.load()) {
@@ -1228,6 +1417,9 @@ bool BybitExchange::query_order_fill(const std::string& order_id, Order& order)
 
             auto list = doc["result"]["list"].get_array();
             for (auto item : list) {
+                auto status_field = item["orderStatus"];
+                const std::string_view status = status_field.error() ? std::string_view{}
+                                                                     : status_field.get_string().value();
                 auto avg_price = item["avgPrice"];
                 if (!avg_price.error()) {
                     std::string_view p = avg_price.get_string().value();
@@ -1246,6 +1438,11 @@ bool BybitExchange::query_order_fill(const std::string& order_id, Order& order)
                                  order_id, order.average_price, order.filled_quantity);
                     return true;
                 }
+                if (status == "Cancelled" || status == "PartiallyFilledCanceled") {
+                    // Terminal IOC without an execution: nothing more will fill
+                    Logger::info("[Bybit-REST] Order {} {} with no fill", order_id, status);
+                    return true;
+                }
                 break;
             }
 
@@ -1306,7 +1503,10 @@ void BybitExchange::on_private_ws_message(std::string_view message) {
                     if (status_field.error()) continue;
                     std::string_view status = status_field.get_string().value();
 
-                    if (status == "Filled") {
+                    // IOC limits end Cancelled / PartiallyFilledCanceled with
+                    // whatever crossed, possibly nothing
+                    const bool ioc_done = status == "PartiallyFilledCanceled" || status == "Cancelled";
+                    if (status == "Filled" || ioc_done) {
                         auto id_field = item["orderId"];
                         if (id_field.error()) continue;
                         std::string order_id(id_field.get_string().value());
@@ -1317,7 +1517,7 @@ void BybitExchange::on_private_ws_message(std::string_view message) {
                         auto qty = item["cumExecQty"];
                         if (!qty.error()) fill.filled_qty = opt::fast_stod(qty.get_string().value());
 
-                        if (fill.avg_price > 0 && fill.filled_qty > 0) {
+                        if ((fill.avg_price > 0 && fill.filled_qty > 0) || ioc_done) {
                             {
                                 std::lock_guard lock(fill_cache_mutex_);
                                 fill_cache_[order_id] = fill;
@@ -1424,4 +1624,50 @@ BybitExchange::fetch_deposit_networks() {
     return result;
 }
 
+std::unordered_map<std::string, double> BybitExchange::fetch_borrow_rates() {
+    std::unordered_map<std::string, double> result;
+
+    if (credentials_.api_key.empty() || credentials_.secret_key.empty()) {
+        Logger::warn("[Bybit] No API credentials — cannot fetch borrow rates");
+        return result;
+    }
+
+    auto headers = build_auth_headers("");
+    auto response = rest_client_->get("/v5/account/collateral-info", headers);
+    if (!response.success) {
+        Logger::error("[Bybit] Failed to fetch collateral info: {}", response.error);
+        return result;
+    }
+
+    try {
+        simdjson::ondemand::parser parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = parser.iterate(padded);
+
+        auto ret_code = doc["retCode"].get_int64();
+        if (ret_code.error() || ret_code.value() != 0) {
+            Logger::error("[Bybit] collateral-info returned non-zero retCode");
+            return result;
+        }
+
+        // Response: {"result":{"list":[{"currency":"BTC","hourlyBorrowRate":"0.0000015",...}]}}
+        // Coins that cannot be borrowed carry an empty rate.
+        auto list = doc["result"]["list"].get_array();
+        if (list.error()) return result;
+
+        for (auto item : list.value()) {
+            auto currency = item["currency"].get_string();
+            if (currency.error()) continue;
+            auto rate = item["hourlyBorrowRate"].get_string();
+            if (rate.error() || rate.value().empty()) continue;
+            result[std::string(currency.value())] = opt::fast_stod(rate.value());
+        }
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::error("[Bybit] Failed to parse collateral info: {}", e.what());
+    }
+
+    Logger::info("[Bybit] Loaded borrow rates for {} coins", result.size());
+    return result;
+}
+
 } // namespace kimp::exchange::bybit
@@ -1,4 +1,5 @@
 #include "kimp/exchange/bybit/bybit_trade_ws.hpp"
+#include "kimp/core/price_format.hpp"
 
 #include <cstdio>
 
@@ -75,11 +76,13 @@ void BybitTradeWS::authenticate() {
 }
 
 Order BybitTradeWS::place_order_sync(const std::string& symbol, Side side, double qty,
-                                      bool is_leverage) {
+                                      bool is_leverage, double limit_price,
+                                      const std::string& client_id) {
     Order order;
     order.exchange = Exchange::Bybit;
     order.side = side;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     order.quantity = qty;
     order.create_time = std::chrono::system_clock::now();
 
@@ -100,17 +103,24 @@ Order BybitTradeWS::place_order_sync(const std::string& symbol, Side side, doubl
     }
 
     // Build WS order message — snprintf avoids ostringstream heap allocs on hot path
+    const std::string type_fields = limit_price > 0.0
+        ? "\"orderType\":\"Limit\",\"timeInForce\":\"IOC\",\"price\":\"" +
+              format::format_decimal_trimmed(limit_price, 10) + "\","
+        : std::string("\"orderType\":\"Market\",\"marketUnit\":\"baseCoin\",");
+    const std::string link_field = client_id.empty() ? std::string{}
+                                                     : "\"orderLinkId\":\"" + client_id + "\",";
     char buf[512];
     int len = std::snprintf(buf, sizeof(buf),
         "{\"reqId\":\"%s\",\"header\":{\"X-BAPI-TIMESTAMP\":\"%lld\"},\"op\":\"order.create\","
         "\"args\":[{\"category\":\"spot\",\"symbol\":\"%s\",\"side\":\"%s\","
-        "\"orderType\":\"Market\",\"qty\":\"%.8f\",%s"
-        "\"orderFilter\":\"Order\",\"marketUnit\":\"baseCoin\"}]}",
+        "%s\"qty\":\"%.8f\",%s%s\"orderFilter\":\"Order\"}]}",
         req_id.c_str(),
         static_cast<long long>(utils::Crypto::timestamp_ms()),
         symbol.c_str(),
         side == Side::Buy ? "Buy" : "Sell",
+        type_fields.c_str(),
         qty,
+        link_field.c_str(),
         is_leverage ? "\"isLeverage\":1," : "");
     if (len <= 0 || static_cast<size_t>(len) >= sizeof(buf)) {
         order.status = OrderStatus::Rejected;
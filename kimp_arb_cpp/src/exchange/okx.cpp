@@ -2,7 +2,9 @@
 #include "kimp/exchange/okx/okx_trade_ws.hpp"
 #include "kimp/core/logger.hpp"
 #include "kimp/core/optimization.hpp"
+#include "kimp/core/price_format.hpp"
 
+#include <charconv>
 #include <sstream>
 #include <iomanip>
 #include <cstdlib>
@@ -16,6 +18,14 @@ namespace kimp::exchange::okx {
 
 namespace {
 
+// Order type fields of an order body: market, or IOC limit when limit_price is set
+std::string order_type_fields(double limit_price) {
+    if (limit_price > 0.0) {
+        return "\"ordType\":\"ioc\",\"px\":\"" + kimp::format::format_decimal_trimmed(limit_price, 10) + "\",";
+    }
+    return "\"ordType\":\"market\",";
+}
+
 // Fast OKX BBO message parser (bbo-tbt channel)
 // Format: {"arg":{"channel":"bbo-tbt","instId":"BTC-USDT"},"data":[{"asks":[["price","size","","1"]],"bids":[["price","size","","1"]],"ts":"1597026383085"}]}
 bool parse_bbo_fast(std::string_view message, Ticker& ticker) {
@@ -150,25 +160,8 @@ bool OkxExchange::connect() {
     }
     Logger::info("[OKX] REST connection pool initialized (4 persistent connections)");
 
-    ws_client_ = std::make_shared<network::WebSocketClient>(io_context_, "OKX-WS");
-
-    ws_client_->set_message_callback([this](std::string_view msg, network::MessageType /*type*/) {
-        on_ws_message(msg);
-    });
-
-    ws_client_->set_connect_callback([this](bool success, const std::string& error) {
-        if (success) {
-            on_ws_connected();
-        } else {
-            Logger::error("[OKX] Connection failed: {}", error);
-        }
-    });
-
-    ws_client_->set_disconnect_callback([this](const std::string& /*reason*/) {
-        on_ws_disconnected();
-    });
-
-    ws_client_->connect(resolve_public_ws_endpoint());
+    start_public_ws("OKX-WS", resolve_public_ws_endpoint(), PUBLIC_WS_STALL_BUDGET);
+    start_redundant_feed(resolve_public_ws_endpoint());
 
     // Initialize WebSocket Trade API for low-latency order placement
     if (!credentials_.ws_private_endpoint.empty() && !credentials_.api_key.empty()) {
@@ -219,9 +212,7 @@ void OkxExchange::disconnect() {
     // Shutdown REST connection pool
     shutdown_rest();
 
-    if (ws_client_) {
-        ws_client_->disconnect();
-    }
+    stop_public_ws();
     connected_ = false;
     Logger::info("[OKX] Disconnected");
 }
@@ -233,7 +224,7 @@ void OkxExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         subscribed_tickers_ = symbols;
     }
 
-    if (!ws_client_ || !ws_client_->is_connected()) {
+    if (!public_ws_connected()) {
         Logger::error("[OKX] Cannot subscribe, not connected");
         return;
     }
@@ -255,7 +246,7 @@ void OkxExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         }
 
         ss << "]}";
-        ws_client_->send(ss.str());
+        send_public(ss.str());
 
         // Tiny pacing keeps startup fast without overwhelming the socket.
         if (end < symbols.size()) {
@@ -273,8 +264,30 @@ void OkxExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols) {
         subscribed_orderbooks_ = symbols;
     }
 
-    if (!ws_client_ || !ws_client_->is_connected()) return;
+    if (!public_ws_connected()) return;
+
+    send_orderbook_subscribe(symbols);
+}
+
+void OkxExchange::add_market_subscriptions(const std::vector<SymbolId>& symbols) {
+    std::vector<SymbolId> fresh;
+    {
+        std::lock_guard lock(subscription_mutex_);
+        for (const auto& sym : symbols) {
+            if (std::find(subscribed_orderbooks_.begin(), subscribed_orderbooks_.end(), sym) ==
+                subscribed_orderbooks_.end()) {
+                subscribed_orderbooks_.push_back(sym);
+                fresh.push_back(sym);
+            }
+        }
+    }
+
+    // Subscribes are additive: only the new topics go out on the live stream
+    if (fresh.empty() || !public_ws_connected()) return;
+    send_orderbook_subscribe(fresh);
+}
 
+void OkxExchange::send_orderbook_subscribe(const std::vector<SymbolId>& symbols) {
     // OKX WS allows max 25 args per subscribe request
     constexpr size_t BATCH_SIZE = 25;
 
@@ -292,7 +305,7 @@ void OkxExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols) {
         }
 
         ss << "]}";
-        ws_client_->send(ss.str());
+        send_public(ss.str());
 
         if (end < symbols.size()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
@@ -382,6 +395,10 @@ std::vector<SymbolId> OkxExchange::get_available_symbols() {
             if (!min_sz.error()) {
                 info.min_qty = opt::fast_stod(min_sz.get_string().value());
             }
+            auto tick_sz = item["tickSz"];
+            if (!tick_sz.error()) {
+                info.tick_size = opt::fast_stod(tick_sz.get_string().value());
+            }
 
             {
                 std::unique_lock lock(metadata_mutex_);
@@ -474,49 +491,72 @@ std::vector<Ticker> OkxExchange::fetch_all_tickers() {
 }
 
 Order OkxExchange::place_market_order(const SymbolId& symbol, Side side, Quantity quantity) {
+    return place_spot_order(symbol, side, quantity, 0.0);
+}
+
+Order OkxExchange::place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
+    const double price = normalize_limit_price(symbol, limit_price, side == Side::Buy);
+    if (price <= 0.0) {
+        Order order;
+        order.exchange = Exchange::OKX;
+        order.status = OrderStatus::Rejected;
+        return order;
+    }
+    return place_spot_order(symbol, side, quantity, price);
+}
+
+Order OkxExchange::place_spot_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
     Order order;
     order.exchange = Exchange::OKX;
     order.symbol = symbol;
     order.side = side;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     order.quantity = quantity;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     // POST /api/v5/trade/order
     char body_buf[512];
     int body_len = std::snprintf(body_buf, sizeof(body_buf),
         "{\"instId\":\"%s\",\"tdMode\":\"cross\",\"side\":\"%s\","
-        "\"ordType\":\"market\",\"sz\":\"%.8f\"}",
+        "%s\"clOrdId\":\"%s\",\"sz\":\"%.8f\"}",
         symbol_to_okx(symbol).c_str(),
         side == Side::Buy ? "buy" : "sell",
+        order_type_fields(limit_price).c_str(),
+        order.client_id.c_str(),
         quantity);
     if (body_len <= 0 || static_cast<size_t>(body_len) >= sizeof(body_buf)) {
         order.status = OrderStatus::Rejected;
         Logger::error("[OKX] Order body buffer overflow");
         return order;
     }
-    std::string body_str(body_buf, static_cast<size_t>(body_len));
-    auto headers = build_auth_headers("POST", "/api/v5/trade/order", body_str);
-    headers["Content-Type"] = "application/json";
+    submit_order(std::string(body_buf, static_cast<size_t>(body_len)), order, "Order");
+    return order;
+}
 
-    auto response = rest_client_->post("/api/v5/trade/order", body_str, headers);
-    if (!response.success) {
+Order OkxExchange::open_short(const SymbolId& symbol, Quantity quantity) {
+    return open_short_at(symbol, quantity, 0.0);
+}
+
+Order OkxExchange::open_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) {
+    const double price = normalize_limit_price(symbol, limit_price, false);
+    if (price <= 0.0) {
+        Order order;
+        order.exchange = Exchange::OKX;
         order.status = OrderStatus::Rejected;
-        Logger::error("[OKX] Order failed: {}", response.body);
         return order;
     }
-
-    parse_order_response(response.body, order, &order.order_id_str);
-    return order;
+    return open_short_at(symbol, quantity, price);
 }
 
-Order OkxExchange::open_short(const SymbolId& symbol, Quantity quantity) {
+Order OkxExchange::open_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price) {
     Order order;
     order.exchange = Exchange::OKX;
     order.symbol = symbol;
     order.side = Side::Sell;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     double adj_qty = normalize_order_qty(symbol, quantity, true);
     if (adj_qty <= 0.0) {
         order.status = OrderStatus::Rejected;
@@ -524,7 +564,7 @@ Order OkxExchange::open_short(const SymbolId& symbol, Quantity quantity) {
         return order;
     }
     order.quantity = adj_qty;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     if (!ensure_margin_mode()) {
@@ -536,41 +576,35 @@ Order OkxExchange::open_short(const SymbolId& symbol, Quantity quantity) {
     // Try WebSocket Trade API first (~5-20ms vs ~150-300ms REST)
     if (trade_ws_ && trade_ws_->is_connected()) {
         Order ws_order = trade_ws_->place_order_sync(
-            symbol_to_okx(symbol), Side::Sell, adj_qty, "cross");
+            symbol_to_okx(symbol), Side::Sell, adj_qty, "cross", limit_price, order.client_id);
         if (ws_order.status != OrderStatus::Rejected) {
             ws_order.symbol = symbol;
             ws_order.quantity = adj_qty;
             ws_order.client_order_id = order.client_order_id;
+            ws_order.client_id = order.client_id;
             Logger::info("[OKX-WS] Opened cross-margin short {} {} - orderId: {}",
                          symbol.to_string(), adj_qty, ws_order.order_id_str);
             return ws_order;
         }
-        Logger::warn("[OKX] WS order failed, falling back to REST");
+        Logger::warn("[OKX] WS order failed, falling back to REST under the same clOrdId");
     }
 
     // REST fallback
     char body_buf[512];
     int body_len = std::snprintf(body_buf, sizeof(body_buf),
         "{\"instId\":\"%s\",\"tdMode\":\"cross\",\"side\":\"sell\","
-        "\"ordType\":\"market\",\"sz\":\"%.8f\"}",
-        symbol_to_okx(symbol).c_str(), adj_qty);
+        "%s\"clOrdId\":\"%s\",\"sz\":\"%.8f\"}",
+        symbol_to_okx(symbol).c_str(), order_type_fields(limit_price).c_str(), order.client_id.c_str(),
+        adj_qty);
     if (body_len <= 0 || static_cast<size_t>(body_len) >= sizeof(body_buf)) {
         order.status = OrderStatus::Rejected;
         Logger::error("[OKX] Short open body buffer overflow");
         return order;
     }
-    std::string body_str(body_buf, static_cast<size_t>(body_len));
-    auto headers = build_auth_headers("POST", "/api/v5/trade/order", body_str);
-    headers["Content-Type"] = "application/json";
-
-    auto response = rest_client_->post("/api/v5/trade/order", body_str, headers);
-    if (!response.success) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[OKX] Cross-margin short open failed: {}", response.body);
+    submit_order(std::string(body_buf, static_cast<size_t>(body_len)), order, "Cross-margin short open");
+    if (order.status == OrderStatus::Rejected || order.status == OrderStatus::Unknown) {
         return order;
     }
-
-    parse_order_response(response.body, order, &order.order_id_str);
     Logger::info("[OKX-REST] Opened cross-margin short {} {} - Status: {}, orderId: {}",
                  symbol.to_string(), adj_qty, static_cast<int>(order.status),
                  order.order_id_str);
@@ -578,11 +612,27 @@ Order OkxExchange::open_short(const SymbolId& symbol, Quantity quantity) {
 }
 
 Order OkxExchange::close_short(const SymbolId& symbol, Quantity quantity) {
+    return close_short_at(symbol, quantity, 0.0);
+}
+
+Order OkxExchange::close_short_ioc(const SymbolId& symbol, Quantity quantity, Price limit_price) {
+    const double price = normalize_limit_price(symbol, limit_price, true);
+    if (price <= 0.0) {
+        Order order;
+        order.exchange = Exchange::OKX;
+        order.status = OrderStatus::Rejected;
+        return order;
+    }
+    return close_short_at(symbol, quantity, price);
+}
+
+Order OkxExchange::close_short_at(const SymbolId& symbol, Quantity quantity, Price limit_price) {
     Order order;
     order.exchange = Exchange::OKX;
     order.symbol = symbol;
     order.side = Side::Buy;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     double adj_qty = normalize_order_qty(symbol, quantity, false);
     if (adj_qty <= 0.0) {
         order.status = OrderStatus::Rejected;
@@ -590,7 +640,7 @@ Order OkxExchange::close_short(const SymbolId& symbol, Quantity quantity) {
         return order;
     }
     order.quantity = adj_qty;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     if (!ensure_margin_mode()) {
@@ -602,47 +652,53 @@ Order OkxExchange::close_short(const SymbolId& symbol, Quantity quantity) {
     // Try WebSocket Trade API first (~5-20ms vs ~150-300ms REST)
     if (trade_ws_ && trade_ws_->is_connected()) {
         Order ws_order = trade_ws_->place_order_sync(
-            symbol_to_okx(symbol), Side::Buy, adj_qty, "cross");
+            symbol_to_okx(symbol), Side::Buy, adj_qty, "cross", limit_price, order.client_id);
         if (ws_order.status != OrderStatus::Rejected) {
             ws_order.symbol = symbol;
             ws_order.quantity = adj_qty;
             ws_order.client_order_id = order.client_order_id;
+            ws_order.client_id = order.client_id;
             Logger::info("[OKX-WS] Closed cross-margin short {} {} - orderId: {}",
                          symbol.to_string(), adj_qty, ws_order.order_id_str);
             return ws_order;
         }
-        Logger::warn("[OKX] WS close failed, falling back to REST");
+        Logger::warn("[OKX] WS close failed, falling back to REST under the same clOrdId");
     }
 
     // REST fallback
     char body_buf[512];
     int body_len = std::snprintf(body_buf, sizeof(body_buf),
         "{\"instId\":\"%s\",\"tdMode\":\"cross\",\"side\":\"buy\","
-        "\"ordType\":\"market\",\"sz\":\"%.8f\"}",
-        symbol_to_okx(symbol).c_str(), adj_qty);
+        "%s\"clOrdId\":\"%s\",\"sz\":\"%.8f\"}",
+        symbol_to_okx(symbol).c_str(), order_type_fields(limit_price).c_str(), order.client_id.c_str(),
+        adj_qty);
     if (body_len <= 0 || static_cast<size_t>(body_len) >= sizeof(body_buf)) {
         order.status = OrderStatus::Rejected;
         Logger::error("[OKX] Short close body buffer overflow");
         return order;
     }
-    std::string body_str(body_buf, static_cast<size_t>(body_len));
-    auto headers = build_auth_headers("POST", "/api/v5/trade/order", body_str);
-    headers["Content-Type"] = "application/json";
-
-    auto response = rest_client_->post("/api/v5/trade/order", body_str, headers);
-    if (!response.success) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[OKX] Cross-margin short close failed: {}", response.body);
+    submit_order(std::string(body_buf, static_cast<size_t>(body_len)), order, "Cross-margin short close");
+    if (order.status == OrderStatus::Rejected || order.status == OrderStatus::Unknown) {
         return order;
     }
-
-    parse_order_response(response.body, order, &order.order_id_str);
     Logger::info("[OKX-REST] Closed cross-margin short {} {} - Status: {}, orderId: {}",
                  symbol.to_string(), adj_qty, static_cast<int>(order.status),
                  order.order_id_str);
     return order;
 }
 
+double OkxExchange::normalize_limit_price(const SymbolId& symbol, double price, bool buy) const {
+    double tick = 0.0;
+    {
+        std::shared_lock lock(metadata_mutex_);
+        auto it = lot_size_cache_.find(symbol_to_okx(symbol));
+        if (it != lot_size_cache_.end()) {
+            tick = it->second.tick_size;
+        }
+    }
+    return format::round_limit_to_tick(price, tick, buy);
+}
+
 double OkxExchange::normalize_order_qty(const SymbolId& symbol, double qty, bool is_open) const {
     if (qty <= 0.0) return 0.0;
     const std::string key = symbol_to_okx(symbol);
@@ -967,6 +1023,17 @@ void OkxExchange::on_ws_message(std::string_view message) {
 
     Ticker ticker;
     if (parse_ticker_message(message, ticker)) {
+        if (redundant_feed_enabled()) {
+            // bbo-tbt carries a per-instrument seqId; fall back to the push ts
+            ticker.sequence = network::FeedArbiter::parse_version(message, R"("seqId":)");
+            if (ticker.sequence == 0) {
+                ticker.sequence = network::FeedArbiter::parse_version(message, R"("ts":)");
+            }
+            if (!accept_feed_update(network::FeedArbiter::make_key(ticker.symbol.hash(), 0),
+                                    ticker.sequence, message)) {
+                return;
+            }
+        }
         dispatch_ticker(ticker);
     } else if (!public_ws_parse_warned_.exchange(true, std::memory_order_relaxed) &&
                message.find("bbo-tbt") != std::string_view::npos) {
@@ -975,6 +1042,34 @@ void OkxExchange::on_ws_message(std::string_view message) {
     }
 }
 
+int64_t OkxExchange::venue_event_time_ms(std::string_view message) const {
+    return static_cast<int64_t>(network::FeedArbiter::parse_version(message, R"("ts":)"));
+}
+
+bool OkxExchange::fetch_server_time_ns(int64_t& server_ns) {
+    auto response = rest_client_->get("/api/v5/public/time");
+    if (!response.success) {
+        return false;
+    }
+    try {
+        simdjson::ondemand::parser local_parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = local_parser.iterate(padded);
+        auto data = doc["data"].get_array();
+        for (auto item : data) {
+            std::string_view ts_str = item["ts"].get_string().value();
+            // Millisecond clock: report the middle of the tick
+            int64_t value = 0;
+            std::from_chars(ts_str.data(), ts_str.data() + ts_str.size(), value);
+            server_ns = value * 1'000'000 + 500'000;
+            return server_ns > 500'000;
+        }
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::warn("[OKX] Failed to parse server time: {}", e.what());
+    }
+    return false;
+}
+
 void OkxExchange::on_ws_connected() {
     connected_ = true;
     Logger::info("[OKX] WebSocket connected");
@@ -1194,9 +1289,20 @@ bool OkxExchange::parse_ticker_message(std::string_view message, Ticker& ticker)
     }
 }
 
-bool OkxExchange::parse_order_response(const std::string& response, Order& order, std::string* order_id_out) {
+bool OkxExchange::parse_order_response(const std::string& response, Order& order, std::string* order_id_out,
+                                       bool* duplicate_id) {
     Logger::debug("[OKX] Order raw response: {}", response);
 
+    auto note_rejection = [&](std::string_view s_code, auto s_msg) {
+        const std::string_view msg = s_msg.error() ? std::string_view{} : s_msg.get_string().value();
+        if (s_code == "51016" && duplicate_id) {
+            *duplicate_id = true;  // clOrdId taken: an earlier attempt landed
+            Logger::warn("[OKX] Order {} already exists: {}", order.client_id, msg);
+        } else {
+            Logger::error("[OKX] Order rejected: {} ({})", msg, s_code);
+        }
+    };
+
     try {
         simdjson::ondemand::parser local_parser;
         simdjson::padded_string padded_response(response);
@@ -1212,10 +1318,7 @@ bool OkxExchange::parse_order_response(const std::string& response, Order& order
                     std::string_view sc = s_code.get_string().value();
                     if (sc != "0") {
                         order.status = OrderStatus::Rejected;
-                        auto s_msg = item["sMsg"];
-                        if (!s_msg.error()) {
-                            Logger::error("[OKX] Order rejected: {}", s_msg.get_string().value());
-                        }
+                        note_rejection(sc, item["sMsg"]);
                         return true;
                     }
                 }
@@ -1233,7 +1336,19 @@ bool OkxExchange::parse_order_response(const std::string& response, Order& order
                 break;  // Only first element
             }
         } else {
+            // Single-order failures carry the reason in data[0].sCode / sMsg
             order.status = OrderStatus::Rejected;
+            auto data = doc["data"].get_array();
+            if (!data.error()) {
+                for (auto item : data.value()) {
+                    auto s_code = item["sCode"];
+                    if (!s_code.error()) {
+                        note_rejection(s_code.get_string().value(), item["sMsg"]);
+                        return true;
+                    }
+                    break;
+                }
+            }
             auto msg = doc["msg"];
             if (!msg.error()) {
                 Logger::error("[OKX] Order rejected: {}", msg.get_string().value());
@@ -1248,6 +1363,80 @@ bool OkxExchange::parse_order_response(const std::string& response, Order& order
     }
 }
 
+void OkxExchange::submit_order(const std::string& body, Order& order, const char* what) {
+    const OrderSubmitPolicy& policy = order_submit_policy();
+    auto submit = [&](Order& o) {
+        // Fresh timestamp per attempt; the clOrdId in the body stays
+        auto headers = build_auth_headers("POST", "/api/v5/trade/order", body);
+        headers["Content-Type"] = "application/json";
+        auto response = rest_client_->post("/api/v5/trade/order", body, headers, policy.timeout);
+        if (outcome_unknown(response)) {
+            Logger::warn("[OKX] {} {} unanswered ({}), checking clOrdId", what, o.client_id,
+                         response.error.empty() ? response.body : response.error);
+            return SubmitReply::Unknown;
+        }
+        bool duplicate = false;
+        const bool parsed = parse_order_response(response.body, o, &o.order_id_str, &duplicate);
+        if (duplicate) {
+            return SubmitReply::Duplicate;
+        }
+        if (!response.success) {
+            o.status = OrderStatus::Rejected;
+            Logger::error("[OKX] {} failed: {}", what, response.body);
+            return SubmitReply::Rejected;
+        }
+        if (!parsed) {
+            return SubmitReply::Unknown;
+        }
+        return o.status == OrderStatus::Rejected ? SubmitReply::Rejected : SubmitReply::Accepted;
+    };
+    auto lookup = [&](Order& o) { return lookup_cl_ord(o); };
+
+    const SubmitOutcome outcome = submit_idempotent(policy, order, submit, lookup);
+    if (outcome.reconciled) {
+        Logger::warn("[OKX] {} {} reconciled by clOrdId after {} submit(s): ordId {}",
+                     what, order.client_id, outcome.submits, order.order_id_str);
+    } else if (outcome.reply == SubmitReply::Unknown) {
+        Logger::error("[OKX] {} {} unresolved after {} submit(s) and {} lookup(s)",
+                      what, order.client_id, outcome.submits, outcome.lookups);
+    }
+}
+
+LookupReply OkxExchange::lookup_cl_ord(Order& order) {
+    const std::string path = "/api/v5/trade/order?instId=" + symbol_to_okx(order.symbol) +
+                             "&clOrdId=" + order.client_id;
+    auto headers = build_auth_headers("GET", path, "");
+    auto response = rest_client_->get(path, headers, order_submit_policy().timeout);
+    if (outcome_unknown(response)) {
+        return LookupReply::Unknown;
+    }
+
+    try {
+        simdjson::ondemand::parser local_parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = local_parser.iterate(padded);
+        std::string_view code = doc["code"].get_string().value();
+        if (code == "51603") {
+            return LookupReply::NotFound;  // Order does not exist
+        }
+        if (code != "0") {
+            return LookupReply::Unknown;
+        }
+        for (auto item : doc["data"].get_array()) {
+            std::string_view order_id = item["ordId"].get_string().value();
+            order.order_id_str = std::string(order_id);
+            order.exchange_order_id = std::hash<std::string_view>{}(order_id);
+            // Same as the create ack: accepted, fill pending
+            order.status = OrderStatus::Filled;
+            return LookupReply::Found;
+        }
+        return LookupReply::NotFound;
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::warn("[OKX] Failed to parse clOrdId lookup: {}", e.what());
+        return LookupReply::Unknown;
+    }
+}
+
 bool OkxExchange::query_order_fill(const std::string& order_id, const SymbolId& symbol, Order& order) {
     // Try WS fill cache first (~50-200ms vs ~300ms+ REST)
     if (private_ws_authenticated_.load()) {
@@ -1321,6 +1510,9 @@ bool OkxExchange::query_order_fill(const std::string& order_id, const SymbolId&
             auto data = doc["data"].get_array();
             for (auto item : data) {
                 // OKX fields: avgPx, accFillSz, state
+                auto state_field = item["state"];
+                const std::string_view state = state_field.error() ? std::string_view{}
+                                                                   : state_field.get_string().value();
                 auto avg_px = item["avgPx"];
                 if (!avg_px.error()) {
                     std::string_view p = avg_px.get_string().value();
@@ -1339,6 +1531,11 @@ bool OkxExchange::query_order_fill(const std::string& order_id, const SymbolId&
                                  order_id, order.average_price, order.filled_quantity);
                     return true;
                 }
+                if (state == "canceled") {
+                    // Terminal IOC without an execution: nothing more will fill
+                    Logger::info("[OKX-REST] Order {} canceled with no fill", order_id);
+                    return true;
+                }
                 break;
             }
 
@@ -1421,7 +1618,9 @@ void OkxExchange::on_private_ws_message(std::string_view message) {
                         if (state_field.error()) continue;
                         std::string_view state = state_field.get_string().value();
 
-                        if (state == "filled") {
+                        // IOC limits end "canceled" with whatever crossed, possibly nothing
+                        const bool ioc_done = state == "canceled";
+                        if (state == "filled" || ioc_done) {
                             auto id_field = item["ordId"];
                             if (id_field.error()) continue;
                             std::string order_id(id_field.get_string().value());
@@ -1432,7 +1631,7 @@ void OkxExchange::on_private_ws_message(std::string_view message) {
                             auto qty = item["accFillSz"];
                             if (!qty.error()) fill.filled_qty = opt::fast_stod(qty.get_string().value());
 
-                            if (fill.avg_price > 0 && fill.filled_qty > 0) {
+                            if ((fill.avg_price > 0 && fill.filled_qty > 0) || ioc_done) {
                                 {
                                     std::lock_guard lock(fill_cache_mutex_);
                                     fill_cache_[order_id] = fill;
@@ -1537,4 +1736,49 @@ OkxExchange::fetch_deposit_networks() {
     return result;
 }
 
+std::unordered_map<std::string, double> OkxExchange::fetch_borrow_rates() {
+    std::unordered_map<std::string, double> result;
+
+    if (credentials_.api_key.empty() || credentials_.secret_key.empty()) {
+        Logger::warn("[OKX] No API credentials — cannot fetch borrow rates");
+        return result;
+    }
+
+    auto headers = build_auth_headers("GET", "/api/v5/account/interest-rate");
+    auto response = rest_client_->get("/api/v5/account/interest-rate", headers);
+    if (!response.success) {
+        Logger::error("[OKX] Failed to fetch interest rates: {}", response.error);
+        return result;
+    }
+
+    try {
+        simdjson::ondemand::parser parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = parser.iterate(padded);
+
+        auto code = doc["code"].get_string();
+        if (code.error() || code.value() != "0") {
+            Logger::error("[OKX] interest-rate returned non-zero code");
+            return result;
+        }
+
+        // Response: {"code":"0","data":[{"ccy":"BTC","interestRate":"0.00000833"}]} (hourly)
+        auto data = doc["data"].get_array();
+        if (data.error()) return result;
+
+        for (auto item : data.value()) {
+            auto ccy = item["ccy"].get_string();
+            if (ccy.error()) continue;
+            auto rate = item["interestRate"].get_string();
+            if (rate.error() || rate.value().empty()) continue;
+            result[std::string(ccy.value())] = opt::fast_stod(rate.value());
+        }
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::error("[OKX] Failed to parse interest rates: {}", e.what());
+    }
+
+    Logger::info("[OKX] Loaded borrow rates for {} coins", result.size());
+    return result;
+}
+
 } // namespace kimp::exchange::okx
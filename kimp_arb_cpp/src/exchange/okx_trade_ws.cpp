@@ -1,4 +1,5 @@
 #include "kimp/exchange/okx/okx_trade_ws.hpp"
+#include "kimp/core/price_format.hpp"
 
 #include <cstdio>
 
@@ -82,11 +83,13 @@ void OkxTradeWS::authenticate() {
 }
 
 Order OkxTradeWS::place_order_sync(const std::string& inst_id, Side side, double qty,
-                                    const std::string& td_mode) {
+                                    const std::string& td_mode, double limit_price,
+                                    const std::string& client_id) {
     Order order;
     order.exchange = Exchange::OKX;
     order.side = side;
-    order.type = OrderType::Market;
+    order.type = limit_price > 0.0 ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
     order.quantity = qty;
     order.create_time = std::chrono::system_clock::now();
 
@@ -109,15 +112,22 @@ Order OkxTradeWS::place_order_sync(const std::string& inst_id, Side side, double
     // Build WS order message — snprintf avoids ostringstream heap allocs on hot path
     // OKX format: {"id":"msgId","op":"order","args":[{"instId":"BTC-USDT","tdMode":"cross",
     //              "side":"sell","ordType":"market","sz":"0.001"}]}
+    const std::string type_fields = limit_price > 0.0
+        ? "\"ordType\":\"ioc\",\"px\":\"" + format::format_decimal_trimmed(limit_price, 10) + "\","
+        : std::string("\"ordType\":\"market\",");
+    const std::string cl_field = client_id.empty() ? std::string{}
+                                                   : "\"clOrdId\":\"" + client_id + "\",";
     char buf[512];
     int len = std::snprintf(buf, sizeof(buf),
         "{\"id\":\"%s\",\"op\":\"order\",\"args\":[{"
         "\"instId\":\"%s\",\"tdMode\":\"%s\",\"side\":\"%s\","
-        "\"ordType\":\"market\",\"sz\":\"%.8f\"}]}",
+        "%s%s\"sz\":\"%.8f\"}]}",
         msg_id.c_str(),
         inst_id.c_str(),
         td_mode.c_str(),
         side == Side::Buy ? "buy" : "sell",
+        type_fields.c_str(),
+        cl_field.c_str(),
         qty);
     if (len <= 0 || static_cast<size_t>(len) >= sizeof(buf)) {
         order.status = OrderStatus::Rejected;
@@ -1,24 +1,27 @@
 #include "kimp/exchange/exchange_base.hpp"
 #include "kimp/core/logger.hpp"
+#include "kimp/network/socket_deadline.hpp"
 
 #include <boost/asio/ssl/error.hpp>
 
 namespace kimp::exchange {
 
 HttpResponse RestClient::get(const std::string& target,
-                              const std::unordered_map<std::string, std::string>& headers) {
-    return do_request(http::verb::get, target, "", headers);
+                              const std::unordered_map<std::string, std::string>& headers,
+                              std::chrono::milliseconds timeout) {
+    return do_request(http::verb::get, target, "", headers, timeout);
 }
 
 HttpResponse RestClient::post(const std::string& target,
                                const std::string& body,
-                               const std::unordered_map<std::string, std::string>& headers) {
-    return do_request(http::verb::post, target, body, headers);
+                               const std::unordered_map<std::string, std::string>& headers,
+                               std::chrono::milliseconds timeout) {
+    return do_request(http::verb::post, target, body, headers, timeout);
 }
 
 HttpResponse RestClient::del(const std::string& target,
                               const std::unordered_map<std::string, std::string>& headers) {
-    return do_request(http::verb::delete_, target, "", headers);
+    return do_request(http::verb::delete_, target, "", headers, DEFAULT_TIMEOUT);
 }
 
 std::future<HttpResponse> RestClient::get_async(const std::string& target,
@@ -39,10 +42,15 @@ std::future<HttpResponse> RestClient::post_async(const std::string& target,
 HttpResponse RestClient::do_request(http::verb method,
                                      const std::string& target,
                                      const std::string& body,
-                                     const std::unordered_map<std::string, std::string>& headers) {
+                                     const std::unordered_map<std::string, std::string>& headers,
+                                     std::chrono::milliseconds timeout) {
     static constexpr int MAX_RETRIES = 3;  // 1 initial + 2 retries
     HttpResponse response;
 
+    if (transport_) {
+        return transport_(method, target, body, timeout);
+    }
+
     for (int attempt = 0; attempt < MAX_RETRIES; ++attempt) {
         response = {};
 
@@ -69,6 +77,10 @@ HttpResponse RestClient::do_request(http::verb method,
             return response;
         }
 
+        // Beast has no timeout for blocking calls: the watchdog shuts the
+        // socket down at the deadline, failing the write or read in flight
+        network::SocketDeadline::Guard deadline(stream->tcp().socket().native_handle(), timeout);
+
         try {
             // Build request with keep-alive
             http::request<http::string_body> req{method, target, 11};
@@ -88,12 +100,14 @@ HttpResponse RestClient::do_request(http::verb method,
                 }
             }
 
-            beast::get_lowest_layer(*stream).expires_after(std::chrono::seconds(10));
             http::write(*stream, req);
 
             beast::flat_buffer buffer;
             http::response<http::string_body> res;
             http::read(*stream, buffer, res);
+            if (deadline.release()) {
+                conn_guard.mark_failed();  // Answered at the deadline, but the socket is shut
+            }
 
             response.status_code = res.result_int();
             response.body = res.body();
@@ -119,10 +133,16 @@ HttpResponse RestClient::do_request(http::verb method,
             return response;  // Success — no retry needed
 
         } catch (const boost::system::system_error& e) {
-            response.error = e.what();
+            // Disarm before mark_failed closes the descriptor
+            const bool timed_out = deadline.release();
+            response.error = timed_out ? "Request timed out after " + std::to_string(timeout.count()) + "ms"
+                                       : std::string(e.what());
             conn_guard.mark_failed();
 
-            bool retriable = (e.code() == boost::asio::error::connection_reset ||
+            // A sent POST may have been processed: the caller reconciles it
+            // (order submits look their client id up) instead of a blind resend
+            bool retriable = !timed_out && method != http::verb::post &&
+                             (e.code() == boost::asio::error::connection_reset ||
                               e.code() == boost::asio::error::broken_pipe ||
                               e.code() == boost::asio::error::eof ||
                               e.code() == boost::beast::http::error::end_of_stream ||
@@ -133,12 +153,15 @@ HttpResponse RestClient::do_request(http::verb method,
                 continue;  // mark_failed already replaced connection synchronously
             }
 
-            Logger::error("HTTP request failed: {}", e.what());
+            Logger::error("HTTP request failed: {}", response.error);
+            return response;
 
         } catch (const std::exception& e) {
+            deadline.release();
             response.error = e.what();
             conn_guard.mark_failed();
             Logger::error("HTTP request failed: {}", e.what());
+            return response;
         }
     }
 
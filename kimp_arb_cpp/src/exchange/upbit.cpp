@@ -1,6 +1,7 @@
 #include "kimp/exchange/upbit/upbit.hpp"
 #include "kimp/core/logger.hpp"
 #include "kimp/core/optimization.hpp"
+#include "kimp/core/price_format.hpp"
 #include "kimp/utils/crypto.hpp"
 
 #include <zlib.h>
@@ -132,7 +133,7 @@ OrderStatus parse_upbit_order_status(std::string_view state,
     return OrderStatus::Rejected;
 }
 
-bool populate_upbit_order_from_body(const std::string& body, Order& order) {
+bool populate_upbit_order_from_body(const std::string& body, Order& order, std::string* state_out = nullptr) {
     try {
         simdjson::dom::parser parser;
         auto doc = parser.parse(body);
@@ -169,6 +170,9 @@ bool populate_upbit_order_from_body(const std::string& body, Order& order) {
 
         const std::string state = parse_dom_string(doc["state"]);
         order.status = parse_upbit_order_status(state, executed_volume, remaining_volume);
+        if (state_out) {
+            *state_out = state;
+        }
 
         const std::string side = parse_dom_string(doc["side"]);
         if (side == "bid") {
@@ -199,34 +203,54 @@ bool populate_upbit_order_from_body(const std::string& body, Order& order) {
     }
 }
 
-} // namespace
-
-bool UpbitExchange::decompress_gzip(const char* data, size_t len, std::string& output) {
-    z_stream strm{};
-    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
-    strm.avail_in = static_cast<uInt>(len);
-
-    // 15 + 16 = gzip decoding
-    if (inflateInit2(&strm, 15 + 16) != Z_OK) {
-        return false;
+// One zlib inflate state per io thread, reset between frames instead of
+// inflateInit2/inflateEnd (and their allocations) on every message. Thread
+// local because line A and line B deliver on different threads.
+class GzipInflater {
+public:
+    GzipInflater() : ready_(inflateInit2(&strm_, 15 + 16) == Z_OK), buf_(65536) {}  // 15 + 16 = gzip decoding
+    ~GzipInflater() {
+        if (ready_) inflateEnd(&strm_);
     }
+    GzipInflater(const GzipInflater&) = delete;
+    GzipInflater& operator=(const GzipInflater&) = delete;
 
-    output.clear();
-    int ret;
-    do {
-        strm.next_out = reinterpret_cast<Bytef*>(decompress_buf_.data());
-        strm.avail_out = static_cast<uInt>(decompress_buf_.size());
-        ret = inflate(&strm, Z_NO_FLUSH);
-        if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) {
-            inflateEnd(&strm);
+    bool inflate_all(const char* data, size_t len, std::string& output) {
+        if (!ready_ || inflateReset(&strm_) != Z_OK) {
             return false;
         }
-        size_t produced = decompress_buf_.size() - strm.avail_out;
-        output.append(decompress_buf_.data(), produced);
-    } while (ret != Z_STREAM_END);
+        strm_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        strm_.avail_in = static_cast<uInt>(len);
+
+        output.clear();
+        int ret;
+        do {
+            strm_.next_out = reinterpret_cast<Bytef*>(buf_.data());
+            strm_.avail_out = static_cast<uInt>(buf_.size());
+            ret = inflate(&strm_, Z_NO_FLUSH);
+            if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR || ret == Z_NEED_DICT) {
+                return false;
+            }
+            const size_t produced = buf_.size() - strm_.avail_out;
+            if (ret == Z_BUF_ERROR && produced == 0) {
+                return false;  // Truncated input
+            }
+            output.append(buf_.data(), produced);
+        } while (ret != Z_STREAM_END);
+        return true;
+    }
 
-    inflateEnd(&strm);
-    return true;
+private:
+    z_stream strm_{};
+    bool ready_;
+    std::vector<char> buf_;
+};
+
+} // namespace
+
+bool UpbitExchange::decompress_gzip(const char* data, size_t len, std::string& output) {
+    static thread_local GzipInflater inflater;
+    return inflater.inflate_all(data, len, output);
 }
 
 bool UpbitExchange::connect() {
@@ -237,40 +261,85 @@ bool UpbitExchange::connect() {
         return false;
     }
 
-    // Create WebSocket client
-    ws_client_ = std::make_shared<network::WebSocketClient>(io_context_, "Upbit-WS");
-
-    ws_client_->set_message_callback([this](std::string_view msg, network::MessageType /*type*/) {
-        on_ws_message(msg);
-    });
-
-    ws_client_->set_connect_callback([this](bool success, const std::string& error) {
-        if (success) {
-            on_ws_connected();
-        } else {
-            Logger::error("[Upbit] WebSocket connect failed: {}", error);
-        }
-    });
-
-    ws_client_->set_disconnect_callback([this](const std::string& /*reason*/) {
-        on_ws_disconnected();
-    });
-
     const std::string ws_url = credentials_.ws_endpoint.empty() ? endpoints::UPBIT_WS : credentials_.ws_endpoint;
-    ws_client_->connect(ws_url);
+    start_public_ws("Upbit-WS", ws_url, PUBLIC_WS_STALL_BUDGET);
+    start_redundant_feed(ws_url);
+
+    if (!credentials_.api_key.empty() && !credentials_.secret_key.empty()) {
+        private_ws_ = std::make_shared<network::WebSocketClient>(io_context_, "Upbit-Private-WS");
+        private_ws_->set_handshake_headers_callback([this]() {
+            return std::unordered_map<std::string, std::string>{
+                {"Authorization", "Bearer " + generate_jwt_token()}
+            };
+        });
+        private_ws_->set_message_callback([this](std::string_view msg, network::MessageType) {
+            on_private_ws_message(msg);
+        });
+        private_ws_->set_connect_callback([this](bool success, const std::string& error) {
+            if (success) {
+                private_ws_authenticated_ = true;
+                Logger::info("[Upbit-PrivateWS] Connected, subscribing to myOrder");
+                subscribe_private_myorder();
+            } else {
+                Logger::error("[Upbit-PrivateWS] Connection failed: {}", error);
+            }
+        });
+        private_ws_->set_disconnect_callback([this](const std::string& reason) {
+            private_ws_authenticated_ = false;
+            // Frames missed while down would leave entries stale: REST takes over
+            {
+                std::lock_guard lock(order_updates_mutex_);
+                order_updates_.clear();
+            }
+            Logger::warn("[Upbit-PrivateWS] Disconnected: {}", reason);
+        });
+        private_ws_->connect(credentials_.ws_private_endpoint.empty() ? endpoints::UPBIT_WS_PRIVATE
+                                                                      : credentials_.ws_private_endpoint);
+    } else {
+        Logger::info("[Upbit-PrivateWS] Disabled (missing API credentials)");
+    }
     return true;
 }
 
 void UpbitExchange::disconnect() {
     Logger::info("[Upbit] Disconnecting...");
     stop_orderbook_resync_loop();
-    if (ws_client_) {
-        ws_client_->disconnect();
+    if (private_ws_) {
+        private_ws_->disconnect();
+        private_ws_authenticated_ = false;
     }
+    stop_public_ws();
     shutdown_rest();
     connected_.store(false);
 }
 
+int64_t UpbitExchange::venue_event_time_ms(std::string_view message) const {
+    // Gzip frames are stamped again after decompression in on_ws_message
+    return static_cast<int64_t>(network::FeedArbiter::parse_version(message, R"("timestamp":)"));
+}
+
+bool UpbitExchange::fetch_server_time_ns(int64_t& server_ns) {
+    // Upbit has no time endpoint. The BTC book timestamp is the closest
+    // server clock reading; it trails response time by the book's update
+    // interval, so this venue's offset reads slightly early.
+    auto response = rest_client_->get("/v1/orderbook?markets=KRW-BTC");
+    if (!response.success) {
+        return false;
+    }
+    try {
+        simdjson::ondemand::parser local_parser;
+        simdjson::padded_string padded(response.body);
+        auto doc = local_parser.iterate(padded);
+        for (auto item : doc.get_array()) {
+            server_ns = item["timestamp"].get_int64().value() * 1'000'000 + 500'000;
+            return server_ns > 500'000;
+        }
+    } catch (const simdjson::simdjson_error& e) {
+        Logger::warn("[Upbit] Failed to parse server time: {}", e.what());
+    }
+    return false;
+}
+
 void UpbitExchange::on_ws_connected() {
     Logger::info("[Upbit] WebSocket connected");
     connected_.store(true);
@@ -294,12 +363,12 @@ void UpbitExchange::on_ws_disconnected() {
     Logger::warn("[Upbit] WebSocket disconnected");
     connected_.store(false);
     stop_orderbook_resync_loop();
-    for (auto& [_, bbo] : orderbook_bbo_) {
+    orderbook_bbo_.for_each([](const SymbolId&, BBO& bbo) {
         bbo.best_bid.store(0.0, std::memory_order_relaxed);
         bbo.best_ask.store(0.0, std::memory_order_relaxed);
         bbo.best_bid_qty.store(0.0, std::memory_order_relaxed);
         bbo.best_ask_qty.store(0.0, std::memory_order_relaxed);
-    }
+    });
 }
 
 void UpbitExchange::on_ws_message(std::string_view message) {
@@ -317,6 +386,10 @@ void UpbitExchange::on_ws_message(std::string_view message) {
     } else {
         json_view = message;
     }
+    std::optional<VenueEventScope> venue_event;
+    if (!decompressed.empty()) {
+        venue_event.emplace(stamp_venue_event(json_view));
+    }
 
     // Route based on message type
     if (json_view.find(R"("type":"orderbook")") != std::string_view::npos) {
@@ -342,6 +415,15 @@ bool UpbitExchange::parse_orderbook_message(std::string_view message) {
 
     SymbolId symbol(base_sv, "KRW");
 
+    // Redundant-feed gate before the BBO cache is touched
+    uint64_t sequence = 0;
+    if (redundant_feed_enabled()) {
+        sequence = network::FeedArbiter::parse_version(message, R"("timestamp":)");
+        if (!accept_feed_update(network::FeedArbiter::make_key(symbol.hash(), 1), sequence, message)) {
+            return true;
+        }
+    }
+
     // Extract first orderbook unit's bid/ask prices and sizes
     // "orderbook_units":[{"ask_price":137002000,"bid_price":137001000,"ask_size":0.106,"bid_size":0.036},...]
     static constexpr std::string_view ask_price_marker = R"("ask_price":)";
@@ -360,12 +442,11 @@ bool UpbitExchange::parse_orderbook_message(std::string_view message) {
     if (ask_price <= 0 || bid_price <= 0) return false;
 
     // Update BBO cache (lock-free)
-    auto it = orderbook_bbo_.find(symbol);
-    if (it != orderbook_bbo_.end()) {
-        it->second.best_bid.store(bid_price, std::memory_order_relaxed);
-        it->second.best_ask.store(ask_price, std::memory_order_relaxed);
-        it->second.best_bid_qty.store(bid_size, std::memory_order_relaxed);
-        it->second.best_ask_qty.store(ask_size, std::memory_order_relaxed);
+    if (auto* bbo = orderbook_bbo_.find(symbol)) {
+        bbo->best_bid.store(bid_price, std::memory_order_relaxed);
+        bbo->best_ask.store(ask_price, std::memory_order_relaxed);
+        bbo->best_bid_qty.store(bid_size, std::memory_order_relaxed);
+        bbo->best_ask_qty.store(ask_size, std::memory_order_relaxed);
     }
 
     // Check if this is USDT/KRW
@@ -389,6 +470,7 @@ bool UpbitExchange::parse_orderbook_message(std::string_view message) {
     ticker.exchange = Exchange::Upbit;
     ticker.symbol = symbol;
     ticker.timestamp = std::chrono::steady_clock::now();
+    ticker.sequence = sequence;
     ticker.bid = bid_price;
     ticker.ask = ask_price;
     ticker.bid_qty = bid_size;
@@ -396,6 +478,30 @@ bool UpbitExchange::parse_orderbook_message(std::string_view message) {
     ticker.last = last > 0.0 ? last : (bid_price + ask_price) * 0.5;
     dispatch_ticker(ticker);
 
+    // Full depth only when someone consumes it (paper execution)
+    if (orderbook_callback_) {
+        OrderBook book;
+        book.exchange = Exchange::Upbit;
+        book.symbol = symbol;
+        book.timestamp = ticker.timestamp;
+        book.sequence = sequence;
+        size_t from = pos;
+        while (book.ask_count < OrderBook::MAX_LEVELS) {
+            double unit_ask = 0.0, unit_bid = 0.0, unit_ask_size = 0.0, unit_bid_size = 0.0;
+            size_t unit_end = 0;
+            if (!extract_number(message, ask_price_marker, from, unit_ask, unit_end) ||
+                !extract_number(message, bid_price_marker, unit_end, unit_bid, unit_end) ||
+                !extract_number(message, ask_size_marker, unit_end, unit_ask_size, unit_end) ||
+                !extract_number(message, bid_size_marker, unit_end, unit_bid_size, unit_end)) {
+                break;
+            }
+            book.asks[book.ask_count++] = {unit_ask, unit_ask_size};
+            book.bids[book.bid_count++] = {unit_bid, unit_bid_size};
+            from = unit_end;
+        }
+        dispatch_orderbook(book);
+    }
+
     return true;
 }
 
@@ -420,6 +526,14 @@ bool UpbitExchange::parse_ticker_message(std::string_view message) {
 
     SymbolId symbol(base_sv, "KRW");
 
+    uint64_t sequence = 0;
+    if (redundant_feed_enabled()) {
+        sequence = network::FeedArbiter::parse_version(message, R"("timestamp":)");
+        if (!accept_feed_update(network::FeedArbiter::make_key(symbol.hash(), 0), sequence, message)) {
+            return true;
+        }
+    }
+
     // Cache last trade price
     {
         std::lock_guard lk(last_price_mutex_);
@@ -432,19 +546,19 @@ bool UpbitExchange::parse_ticker_message(std::string_view message) {
     }
 
     // Only dispatch full ticker if we have BBO data
-    auto it = orderbook_bbo_.find(symbol);
-    if (it != orderbook_bbo_.end()) {
-        double bid = it->second.best_bid.load(std::memory_order_relaxed);
-        double ask = it->second.best_ask.load(std::memory_order_relaxed);
+    if (const auto* bbo = orderbook_bbo_.find(symbol)) {
+        double bid = bbo->best_bid.load(std::memory_order_relaxed);
+        double ask = bbo->best_ask.load(std::memory_order_relaxed);
         if (bid > 0 && ask > 0) {
             Ticker ticker;
             ticker.exchange = Exchange::Upbit;
             ticker.symbol = symbol;
             ticker.timestamp = std::chrono::steady_clock::now();
+            ticker.sequence = sequence;
             ticker.bid = bid;
             ticker.ask = ask;
-            ticker.bid_qty = it->second.best_bid_qty.load(std::memory_order_relaxed);
-            ticker.ask_qty = it->second.best_ask_qty.load(std::memory_order_relaxed);
+            ticker.bid_qty = bbo->best_bid_qty.load(std::memory_order_relaxed);
+            ticker.ask_qty = bbo->best_ask_qty.load(std::memory_order_relaxed);
             ticker.last = trade_price;
             dispatch_ticker(ticker);
         }
@@ -497,7 +611,7 @@ void UpbitExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
         subscribed_tickers_ = symbols;
     }
 
-    if (!ws_client_ || !connected_.load()) return;
+    if (!public_ws_connected() || !connected_.load()) return;
 
     // Build Upbit subscription JSON array
     // [{"ticket":"uuid"},{"type":"ticker","codes":["KRW-BTC","KRW-ETH"],"isOnlyRealtime":true}]
@@ -510,7 +624,7 @@ void UpbitExchange::subscribe_ticker(const std::vector<SymbolId>& symbols) {
     std::string sub_msg = R"([{"ticket":"kimp-upbit-ticker"},)"
         R"({"type":"ticker","codes":[)" + codes + R"(],"isOnlyRealtime":true}])";
 
-    ws_client_->send(sub_msg);
+    send_public(sub_msg);
     Logger::info("[Upbit] Subscribed to {} ticker symbols", symbols.size());
 }
 
@@ -522,10 +636,10 @@ void UpbitExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols) {
 
     // Pre-allocate BBO entries
     for (const auto& s : symbols) {
-        orderbook_bbo_[s];
+        orderbook_bbo_.get_or_add(s);
     }
 
-    if (!ws_client_ || !connected_.load()) return;
+    if (!public_ws_connected() || !connected_.load()) return;
 
     // Build Upbit subscription: orderbook for real bid/ask
     // [{"ticket":"uuid"},{"type":"orderbook","codes":["KRW-BTC","KRW-ETH"],"isOnlyRealtime":true}]
@@ -538,12 +652,50 @@ void UpbitExchange::subscribe_orderbook(const std::vector<SymbolId>& symbols) {
     std::string sub_msg = R"([{"ticket":"kimp-upbit-ob"},)"
         R"({"type":"orderbook","codes":[)" + codes + R"(],"isOnlyRealtime":true}])";
 
-    ws_client_->send(sub_msg);
+    send_public(sub_msg);
     Logger::info("[Upbit] Subscribed to {} orderbook symbols", symbols.size());
     fetch_orderbook_snapshots(symbols);
     start_orderbook_resync_loop();
 }
 
+void UpbitExchange::add_market_subscriptions(const std::vector<SymbolId>& symbols) {
+    std::vector<SymbolId> fresh;
+    std::vector<SymbolId> merged;
+    {
+        std::lock_guard lock(subscription_mutex_);
+        for (const auto& s : symbols) {
+            if (std::find(subscribed_orderbooks_.begin(), subscribed_orderbooks_.end(), s) ==
+                subscribed_orderbooks_.end()) {
+                subscribed_orderbooks_.push_back(s);
+                fresh.push_back(s);
+            }
+        }
+        merged = subscribed_orderbooks_;
+    }
+    if (fresh.empty()) {
+        return;
+    }
+
+    for (const auto& s : fresh) {
+        orderbook_bbo_.get_or_add(s);
+    }
+    fetch_orderbook_snapshots(fresh);
+
+    if (!public_ws_connected() || !connected_.load()) return;
+
+    // A request replaces the connection's subscription, so send the merged list;
+    // streams of the existing codes continue without a reconnect
+    std::string codes;
+    for (const auto& s : merged) {
+        if (!codes.empty()) codes += ",";
+        codes += "\"" + symbol_to_upbit(s) + "\"";
+    }
+    send_public(R"([{"ticket":"kimp-upbit-ob"},)"
+        R"({"type":"orderbook","codes":[)" + codes + R"(],"isOnlyRealtime":true}])");
+    Logger::info("[Upbit] Added {} symbols to the live orderbook stream ({} total)",
+                 fresh.size(), merged.size());
+}
+
 void UpbitExchange::fetch_orderbook_snapshots(const std::vector<SymbolId>& symbols) {
     if (symbols.empty() || !rest_client_) {
         return;
@@ -595,11 +747,14 @@ void UpbitExchange::fetch_orderbook_snapshots(const std::vector<SymbolId>& symbo
                     continue;
                 }
 
-                auto& bbo = orderbook_bbo_[symbol];
-                bbo.best_bid.store(bid_price, std::memory_order_relaxed);
-                bbo.best_ask.store(ask_price, std::memory_order_relaxed);
-                bbo.best_bid_qty.store(bid_size, std::memory_order_relaxed);
-                bbo.best_ask_qty.store(ask_size, std::memory_order_relaxed);
+                auto* bbo = orderbook_bbo_.get_or_add(symbol);
+                if (bbo == nullptr) {
+                    continue;
+                }
+                bbo->best_bid.store(bid_price, std::memory_order_relaxed);
+                bbo->best_ask.store(ask_price, std::memory_order_relaxed);
+                bbo->best_bid_qty.store(bid_size, std::memory_order_relaxed);
+                bbo->best_ask_qty.store(ask_size, std::memory_order_relaxed);
 
                 double last = 0.0;
                 {
@@ -697,31 +852,17 @@ Order UpbitExchange::place_market_order(const SymbolId& symbol, Side side, Quant
     order.side = side;
     order.type = OrderType::Market;
     order.quantity = quantity;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     const std::string market = symbol_to_upbit(symbol);
     const std::string query = "market=" + symbol_to_upbit(symbol) +
-                              "&side=ask&ord_type=market&volume=" + format_upbit_number(quantity);
+                              "&side=ask&ord_type=market&volume=" + format_upbit_number(quantity) +
+                              "&identifier=" + order.client_id;
     const std::string body = std::string("{\"market\":\"") + market +
                              "\",\"side\":\"ask\",\"ord_type\":\"market\",\"volume\":\"" +
-                             format_upbit_number(quantity) + "\"}";
-    const std::string token = generate_jwt_token_with_query(query);
-    std::unordered_map<std::string, std::string> headers = {
-        {"Authorization", "Bearer " + token},
-        {"accept", "application/json"},
-        {"Content-Type", "application/json; charset=utf-8"}
-    };
-
-    auto response = rest_client_->post("/v1/orders", body, headers);
-    if (!response.success) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[Upbit] Market sell failed: {}", response.body);
-        return order;
-    }
-    if (!populate_upbit_order_from_body(response.body, order)) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[Upbit] Failed to parse market sell response: {}", response.body);
+                             format_upbit_number(quantity) + "\",\"identifier\":\"" + order.client_id + "\"}";
+    if (!submit_order(query, body, order, "Market sell")) {
         return order;
     }
     if (order.status != OrderStatus::Cancelled &&
@@ -734,6 +875,110 @@ Order UpbitExchange::place_market_order(const SymbolId& symbol, Side side, Quant
     return order;
 }
 
+Order UpbitExchange::place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
+    const double price = format::round_limit_to_tick(limit_price, format::krw_tick_size(limit_price),
+                                                     side == Side::Buy);
+    if (quantity <= 0.0 || price <= 0.0 || quantity * price < MIN_ORDER_KRW) {
+        Order order;
+        order.status = OrderStatus::Rejected;
+        order.exchange = Exchange::Upbit;
+        Logger::error("[Upbit] IOC {} {} @ {} invalid", side == Side::Buy ? "buy" : "sell", quantity, price);
+        return order;
+    }
+    if (credentials_.api_key.empty() || credentials_.secret_key.empty()) {
+        Order order;
+        order.status = OrderStatus::Rejected;
+        order.exchange = Exchange::Upbit;
+        Logger::error("[Upbit] API credentials missing");
+        return order;
+    }
+
+    Order order;
+    order.exchange = Exchange::Upbit;
+    order.symbol = symbol;
+    order.side = side;
+    order.type = OrderType::Limit;
+    order.price = price;
+    order.quantity = quantity;
+    assign_client_order_id(order);
+    order.create_time = std::chrono::system_clock::now();
+
+    const std::string market = symbol_to_upbit(symbol);
+    const char* upbit_side = side == Side::Buy ? "bid" : "ask";
+    const std::string volume = format_upbit_number(quantity);
+    const std::string price_str = format_upbit_number(price);
+    const std::string query = "market=" + market + "&side=" + upbit_side + "&volume=" + volume +
+                              "&price=" + price_str + "&ord_type=limit&time_in_force=ioc" +
+                              "&identifier=" + order.client_id;
+    const std::string body = std::string("{\"market\":\"") + market + "\",\"side\":\"" + upbit_side +
+                             "\",\"volume\":\"" + volume + "\",\"price\":\"" + price_str +
+                             "\",\"ord_type\":\"limit\",\"time_in_force\":\"ioc\",\"identifier\":\"" +
+                             order.client_id + "\"}";
+    if (!submit_order(query, body, order, "IOC order")) {
+        return order;
+    }
+    if (order.status != OrderStatus::Rejected && order.status != OrderStatus::Expired) {
+        // Accepted, including an immediate cancel: the detail query reports what crossed
+        order.status = OrderStatus::Filled;
+    }
+    return order;
+}
+
+Order UpbitExchange::place_post_only_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) {
+    // Round away from the book so the rounding itself never crosses
+    const double price = format::round_limit_to_tick(limit_price, format::krw_tick_size(limit_price),
+                                                     side != Side::Buy);
+    if (quantity <= 0.0 || price <= 0.0 || quantity * price < MIN_ORDER_KRW) {
+        Order order;
+        order.status = OrderStatus::Rejected;
+        order.exchange = Exchange::Upbit;
+        Logger::error("[Upbit] Post-only {} {} @ {} invalid", side == Side::Buy ? "buy" : "sell", quantity, price);
+        return order;
+    }
+    if (credentials_.api_key.empty() || credentials_.secret_key.empty()) {
+        Order order;
+        order.status = OrderStatus::Rejected;
+        order.exchange = Exchange::Upbit;
+        Logger::error("[Upbit] API credentials missing");
+        return order;
+    }
+
+    Order order;
+    order.exchange = Exchange::Upbit;
+    order.symbol = symbol;
+    order.side = side;
+    order.type = OrderType::Limit;
+    order.price = price;
+    order.quantity = quantity;
+    assign_client_order_id(order);
+    order.create_time = std::chrono::system_clock::now();
+
+    const std::string market = symbol_to_upbit(symbol);
+    const char* upbit_side = side == Side::Buy ? "bid" : "ask";
+    const std::string volume = format_upbit_number(quantity);
+    const std::string price_str = format_upbit_number(price);
+    const std::string query = "market=" + market + "&side=" + upbit_side + "&volume=" + volume +
+                              "&price=" + price_str + "&ord_type=limit&time_in_force=post_only" +
+                              "&identifier=" + order.client_id;
+    const std::string body = std::string("{\"market\":\"") + market + "\",\"side\":\"" + upbit_side +
+                             "\",\"volume\":\"" + volume + "\",\"price\":\"" + price_str +
+                             "\",\"ord_type\":\"limit\",\"time_in_force\":\"post_only\",\"identifier\":\"" +
+                             order.client_id + "\"}";
+    if (!submit_order(query, body, order, "Post-only order")) {
+        return order;
+    }
+    if (order.status == OrderStatus::Cancelled || order.status == OrderStatus::Expired) {
+        // Would have crossed: the venue cancelled it instead of taking
+        order.status = OrderStatus::Rejected;
+    } else if (order.status != OrderStatus::Rejected && order.status != OrderStatus::PartiallyFilled) {
+        order.status = OrderStatus::New;
+    }
+    if (order.status != OrderStatus::Rejected) {
+        watch_order_update(order.order_id_str);
+    }
+    return order;
+}
+
 Order UpbitExchange::place_market_buy_cost(const SymbolId& symbol, Price cost) {
     const double normalized_cost = std::floor(cost);
     if (normalized_cost < MIN_ORDER_KRW) {
@@ -757,31 +1002,18 @@ Order UpbitExchange::place_market_buy_cost(const SymbolId& symbol, Price cost) {
     order.side = Side::Buy;
     order.type = OrderType::Market;
     order.price = normalized_cost;
-    order.client_order_id = generate_order_id();
+    assign_client_order_id(order);
     order.create_time = std::chrono::system_clock::now();
 
     const std::string market = symbol_to_upbit(symbol);
     const std::string query = "market=" + symbol_to_upbit(symbol) +
-                              "&side=bid&ord_type=price&price=" + format_upbit_number(normalized_cost, 0);
+                              "&side=bid&ord_type=price&price=" + format_upbit_number(normalized_cost, 0) +
+                              "&identifier=" + order.client_id;
     const std::string body = std::string("{\"market\":\"") + market +
                              "\",\"side\":\"bid\",\"ord_type\":\"price\",\"price\":\"" +
-                             format_upbit_number(normalized_cost, 0) + "\"}";
-    const std::string token = generate_jwt_token_with_query(query);
-    std::unordered_map<std::string, std::string> headers = {
-        {"Authorization", "Bearer " + token},
-        {"accept", "application/json"},
-        {"Content-Type", "application/json; charset=utf-8"}
-    };
-
-    auto response = rest_client_->post("/v1/orders", body, headers);
-    if (!response.success) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[Upbit] Market buy failed: {}", response.body);
-        return order;
-    }
-    if (!populate_upbit_order_from_body(response.body, order)) {
-        order.status = OrderStatus::Rejected;
-        Logger::error("[Upbit] Failed to parse market buy response: {}", response.body);
+                             format_upbit_number(normalized_cost, 0) + "\",\"identifier\":\"" +
+                             order.client_id + "\"}";
+    if (!submit_order(query, body, order, "Market buy")) {
         return order;
     }
     if (order.status != OrderStatus::Cancelled &&
@@ -877,6 +1109,72 @@ std::vector<AccountBalance> UpbitExchange::get_all_balances() {
     return balances;
 }
 
+bool UpbitExchange::submit_order(const std::string& query, const std::string& body, Order& order,
+                                 const char* what) {
+    const OrderSubmitPolicy& policy = order_submit_policy();
+    auto submit = [&](Order& o) {
+        // Fresh JWT nonce per attempt; the identifier in query and body stays
+        std::unordered_map<std::string, std::string> headers = {
+            {"Authorization", "Bearer " + generate_jwt_token_with_query(query)},
+            {"accept", "application/json"},
+            {"Content-Type", "application/json; charset=utf-8"}
+        };
+        auto response = rest_client_->post("/v1/orders", body, headers, policy.timeout);
+        if (outcome_unknown(response)) {
+            Logger::warn("[Upbit] {} {} unanswered ({}), checking identifier", what, o.client_id,
+                         response.error.empty() ? response.body : response.error);
+            return SubmitReply::Unknown;
+        }
+        if (!response.success) {
+            if (response.body.find("identifier") != std::string::npos) {
+                Logger::warn("[Upbit] {} {} already exists: {}", what, o.client_id, response.body);
+                return SubmitReply::Duplicate;
+            }
+            o.status = OrderStatus::Rejected;
+            Logger::error("[Upbit] {} failed: {}", what, response.body);
+            return SubmitReply::Rejected;
+        }
+        if (!populate_upbit_order_from_body(response.body, o)) {
+            Logger::warn("[Upbit] Failed to parse {} response: {}", what, response.body);
+            return SubmitReply::Unknown;  // Taken, unreadable: the lookup reads it back
+        }
+        return SubmitReply::Accepted;
+    };
+    auto lookup = [&](Order& o) { return lookup_identifier(o); };
+
+    const SubmitOutcome outcome = submit_idempotent(policy, order, submit, lookup);
+    if (outcome.reconciled) {
+        Logger::warn("[Upbit] {} {} reconciled by identifier after {} submit(s): uuid {}",
+                     what, order.client_id, outcome.submits, order.order_id_str);
+    } else if (outcome.reply == SubmitReply::Unknown) {
+        Logger::error("[Upbit] {} {} unresolved after {} submit(s) and {} lookup(s)",
+                      what, order.client_id, outcome.submits, outcome.lookups);
+    }
+    return outcome.reply == SubmitReply::Accepted;
+}
+
+LookupReply UpbitExchange::lookup_identifier(Order& order) {
+    const std::string query = "identifier=" + order.client_id;
+    std::unordered_map<std::string, std::string> headers = {
+        {"Authorization", "Bearer " + generate_jwt_token_with_query(query)},
+        {"accept", "application/json"}
+    };
+    auto response = rest_client_->get("/v1/order?" + query, headers, order_submit_policy().timeout);
+    if (response.status_code == 404) {
+        return LookupReply::NotFound;
+    }
+    if (!response.success) {
+        return LookupReply::Unknown;
+    }
+    Order found = order;
+    if (!populate_upbit_order_from_body(response.body, found)) {
+        return LookupReply::Unknown;
+    }
+    found.symbol = order.symbol;
+    order = std::move(found);
+    return LookupReply::Found;
+}
+
 bool UpbitExchange::query_order_detail(const std::string& order_id, Order& order) {
     if (order_id.empty()) {
         return false;
@@ -900,7 +1198,8 @@ bool UpbitExchange::query_order_detail(const std::string& order_id, Order& order
         }
 
         Order updated = order;
-        if (!populate_upbit_order_from_body(response.body, updated)) {
+        std::string state;
+        if (!populate_upbit_order_from_body(response.body, updated, &state)) {
             Logger::warn("[Upbit] Failed to parse order detail {}: {}", order_id, response.body);
             return false;
         }
@@ -912,6 +1211,10 @@ bool UpbitExchange::query_order_detail(const std::string& order_id, Order& order
         if (order.status == OrderStatus::Filled) {
             return true;
         }
+        if (state == "cancel" && order.type == OrderType::Limit) {
+            // IOC remainder cancelled: executed_volume is final, possibly zero
+            return true;
+        }
         if (order.status == OrderStatus::Cancelled ||
             order.status == OrderStatus::Rejected ||
             order.status == OrderStatus::Expired) {
@@ -924,6 +1227,175 @@ bool UpbitExchange::query_order_detail(const std::string& order_id, Order& order
     return order.status == OrderStatus::Filled;
 }
 
+bool UpbitExchange::refresh_order(const std::string& order_id, Order& order, std::string* state) {
+    if (order_id.empty() || credentials_.api_key.empty() || credentials_.secret_key.empty()) {
+        return false;
+    }
+
+    const std::string query = "uuid=" + order_id;
+    std::unordered_map<std::string, std::string> headers = {
+        {"Authorization", "Bearer " + generate_jwt_token_with_query(query)},
+        {"accept", "application/json"}
+    };
+    auto response = rest_client_->get("/v1/order?" + query, headers);
+    if (!response.success) {
+        Logger::warn("[Upbit] Failed to refresh order {}: {}", order_id, response.body);
+        return false;
+    }
+
+    Order updated = order;
+    if (!populate_upbit_order_from_body(response.body, updated, state)) {
+        Logger::warn("[Upbit] Failed to parse order {}: {}", order_id, response.body);
+        return false;
+    }
+    updated.symbol = order.symbol;
+    order = std::move(updated);
+    return true;
+}
+
+bool UpbitExchange::cancel_order_uuid(const std::string& order_id) {
+    if (order_id.empty() || credentials_.api_key.empty() || credentials_.secret_key.empty()) {
+        return false;
+    }
+
+    const std::string query = "uuid=" + order_id;
+    std::unordered_map<std::string, std::string> headers = {
+        {"Authorization", "Bearer " + generate_jwt_token_with_query(query)},
+        {"accept", "application/json"}
+    };
+    auto response = rest_client_->del("/v1/order?" + query, headers);
+    if (!response.success) {
+        // done/cancelled already: the caller's refresh sees the final state
+        Logger::warn("[Upbit] Cancel {} refused: {}", order_id, response.body);
+        return false;
+    }
+    return true;
+}
+
+void UpbitExchange::subscribe_private_myorder() {
+    if (!private_ws_ || !private_ws_->is_connected()) {
+        Logger::warn("[Upbit-PrivateWS] Cannot subscribe to myOrder, not connected");
+        return;
+    }
+    private_ws_->send(std::string(R"([{"ticket":"kimp-upbit-private"},{"type":"myOrder"}])"));
+}
+
+void UpbitExchange::on_private_ws_message(std::string_view message) {
+    std::string decompressed;
+    if (!message.empty() && static_cast<uint8_t>(message[0]) == 0x1f) {
+        if (!decompress_gzip(message.data(), message.size(), decompressed)) {
+            return;
+        }
+        message = decompressed;
+    }
+    if (message.find("myOrder") == std::string_view::npos) {
+        return;
+    }
+
+    try {
+        simdjson::ondemand::parser parser;
+        simdjson::padded_string padded(message);
+        auto doc = parser.iterate(padded);
+        simdjson::ondemand::object obj = doc.get_object();
+
+        auto parse_number = [](simdjson::ondemand::value value) -> double {
+            auto string_value = value.get_string();
+            if (!string_value.error()) {
+                return opt::fast_stod(string_value.value());
+            }
+            auto double_value = value.get_double();
+            if (!double_value.error()) {
+                return double_value.value();
+            }
+            return 0.0;
+        };
+
+        std::string_view type;
+        std::string_view order_id;
+        std::string_view state;
+        double executed_volume = 0.0;
+        double executed_funds = 0.0;
+        double avg_price = 0.0;
+        for (auto field : obj) {
+            std::string_view key = field.unescaped_key().value();
+            simdjson::ondemand::value value = field.value();
+            if (key == "ty" || key == "type") {
+                auto sv = value.get_string();
+                if (!sv.error()) type = sv.value();
+            } else if (key == "uid" || key == "uuid") {
+                auto sv = value.get_string();
+                if (!sv.error()) order_id = sv.value();
+            } else if (key == "s" || key == "state") {
+                auto sv = value.get_string();
+                if (!sv.error()) state = sv.value();
+            } else if (key == "ev" || key == "executed_volume") {
+                executed_volume = parse_number(value);
+            } else if (key == "ef" || key == "executed_funds") {
+                executed_funds = parse_number(value);
+            } else if (key == "ap" || key == "avg_price") {
+                avg_price = parse_number(value);
+            }
+        }
+        if (type != "myOrder" || order_id.empty() || state.empty()) {
+            return;
+        }
+
+        OrderUpdate update;
+        update.state = std::string(state);
+        update.filled_qty = executed_volume;
+        update.avg_price = avg_price > 0.0 ? avg_price
+                         : executed_volume > 0.0 ? executed_funds / executed_volume : 0.0;
+        update.seen = std::chrono::steady_clock::now();
+        const std::string uuid(order_id);
+        std::lock_guard lock(order_updates_mutex_);
+        if (update.seen - order_updates_swept_ >= ORDER_UPDATE_TTL) {
+            order_updates_swept_ = update.seen;
+            for (auto it = order_updates_.begin(); it != order_updates_.end();) {
+                const bool expired = update.seen - it->second.seen >= ORDER_UPDATE_TTL;
+                it = expired && watched_orders_.count(it->first) == 0 ? order_updates_.erase(it) : std::next(it);
+            }
+        }
+        if (watched_orders_.count(uuid) == 0 && (state == "done" || state == "cancel")) {
+            order_updates_.erase(uuid);  // Market / IOC order finished: nobody reads it
+            return;
+        }
+        auto& slot = order_updates_[uuid];
+        // Frames of one order may arrive out of order: cumulative volume only grows
+        if (update.filled_qty >= slot.filled_qty) {
+            slot = std::move(update);
+        }
+    } catch (const simdjson::simdjson_error&) {
+        // Ignore non-order/private control messages
+    }
+}
+
+bool UpbitExchange::stream_order_update(const std::string& order_id, Order& order, std::string* state) {
+    std::lock_guard lock(order_updates_mutex_);
+    auto it = order_updates_.find(order_id);
+    if (it == order_updates_.end()) {
+        return false;
+    }
+    order.filled_quantity = it->second.filled_qty;
+    if (it->second.avg_price > 0.0) {
+        order.average_price = it->second.avg_price;
+    }
+    if (state) {
+        *state = it->second.state;
+    }
+    return true;
+}
+
+void UpbitExchange::watch_order_update(const std::string& order_id) {
+    std::lock_guard lock(order_updates_mutex_);
+    watched_orders_.insert(order_id);
+}
+
+void UpbitExchange::forget_order_update(const std::string& order_id) {
+    std::lock_guard lock(order_updates_mutex_);
+    order_updates_.erase(order_id);
+    watched_orders_.erase(order_id);
+}
+
 // ── JWT Authentication ──────────────────────────────────────────────────
 
 namespace {
@@ -987,24 +1459,6 @@ std::string UpbitExchange::generate_jwt_token_with_query(const std::string& quer
 
 // ── Withdrawal Fee Fetcher ─────────────────────────────────────────────
 
-namespace {
-
-// Try to extract withdraw_fee from a /v1/withdraws/chance JSON response.
-// Returns true and sets `fee` on success, false on parse failure.
-bool parse_upbit_withdraw_fee(const std::string& body, double& fee) {
-    try {
-        simdjson::dom::parser parser;
-        auto doc = parser.parse(body);
-        auto currency_obj = doc["currency"];
-        fee = parse_dom_double(currency_obj["withdraw_fee"], -1.0);
-        return std::isfinite(fee) && fee >= 0.0;
-    } catch (...) {
-        return false;
-    }
-}
-
-} // namespace
-
 std::unordered_map<std::string, std::vector<UpbitExchange::NetworkFee>>
 UpbitExchange::fetch_withdrawal_fees(const std::vector<std::string>& coins) {
     std::unordered_map<std::string, std::vector<NetworkFee>> fees;
@@ -1014,16 +1468,6 @@ UpbitExchange::fetch_withdrawal_fees(const std::vector<std::string>& coins) {
         return fees;
     }
 
-    auto normalize = [](std::string_view raw) -> std::string {
-        std::string out;
-        out.reserve(raw.size());
-        for (char c : raw) {
-            if (std::isalnum(static_cast<unsigned char>(c)))
-                out.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
-        }
-        return out;
-    };
-
     std::vector<std::string> unique_coins;
     unique_coins.reserve(coins.size());
     {
@@ -1039,12 +1483,14 @@ UpbitExchange::fetch_withdrawal_fees(const std::vector<std::string>& coins) {
     // ── Step 1: Fetch /v1/status/wallet to discover net_type for every coin ──
     std::unordered_map<std::string, std::unordered_set<std::string>> coin_net_types;
     {
+        fee_collector_.bucket().acquire();
         std::string token = generate_jwt_token();
         std::unordered_map<std::string, std::string> headers = {
             {"Authorization", "Bearer " + token},
             {"accept", "application/json"}
         };
         auto response = rest_client_->get("/v1/status/wallet", headers);
+        fee_collector_.observe_response(response);
         if (!response.success) {
             Logger::warn("[Upbit] Failed to fetch wallet status: {} — falling back to guessing net_type",
                          response.error);
@@ -1073,68 +1519,53 @@ UpbitExchange::fetch_withdrawal_fees(const std::vector<std::string>& coins) {
                 Logger::warn("[Upbit] Failed to parse wallet status: {}", e.what());
             }
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(120));
     }
 
-    // ── Step 2: For each coin, query /v1/withdraws/chance per net_type ──
-    std::vector<std::string> failed_coins;
-
+    // ── Step 2: /v1/withdraws/chance per (coin, net_type), concurrently ──
+    std::vector<WithdrawFeeCollector::CoinNetworks> targets;
+    targets.reserve(unique_coins.size());
     for (const auto& coin : unique_coins) {
-        std::vector<std::string> net_types_to_try;
+        WithdrawFeeCollector::CoinNetworks target{coin, {}};
         auto it = coin_net_types.find(coin);
-        if (it != coin_net_types.end() && !it->second.empty()) {
-            net_types_to_try.assign(it->second.begin(), it->second.end());
-        } else {
-            // Don't guess net_type from the coin symbol; use the default
-            // endpoint only when wallet status metadata is unavailable.
-            net_types_to_try = {""};
-        }
-
-        std::vector<NetworkFee> coin_fees;
-        std::unordered_set<std::string> seen_networks;
-
-        for (const auto& nt : net_types_to_try) {
-            std::string query = "currency=" + url_encode_component(coin);
-            if (!nt.empty()) {
-                query += "&net_type=" + url_encode_component(nt);
-            }
-
-            std::string token = generate_jwt_token_with_query(query);
-            std::unordered_map<std::string, std::string> headers = {
-                {"Authorization", "Bearer " + token},
-                {"accept", "application/json"}
-            };
-
-            auto response = rest_client_->get("/v1/withdraws/chance?" + query, headers);
-
-            double fee = 0.0;
-            if (response.success && parse_upbit_withdraw_fee(response.body, fee)) {
-                std::string net_name = nt.empty() ? coin : normalize(nt);
-                if (seen_networks.insert(net_name).second) {
-                    coin_fees.push_back({std::move(net_name), fee});
-                }
-            }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(120));
+        if (it != coin_net_types.end()) {
+            target.net_types.assign(it->second.begin(), it->second.end());
         }
+        // Empty net_types: don't guess net_type from the coin symbol; use the
+        // default endpoint only when wallet status metadata is unavailable.
+        targets.push_back(std::move(target));
+    }
 
-        if (!coin_fees.empty()) {
-            fees[coin] = std::move(coin_fees);
-        } else {
-            failed_coins.push_back(coin);
+    fees = fee_collector_.collect(targets, [this](const std::string& coin, const std::string& net_type) {
+        std::string query = "currency=" + url_encode_component(coin);
+        if (!net_type.empty()) {
+            query += "&net_type=" + url_encode_component(net_type);
         }
-    }
+        std::string token = generate_jwt_token_with_query(query);
+        std::unordered_map<std::string, std::string> headers = {
+            {"Authorization", "Bearer " + token},
+            {"accept", "application/json"}
+        };
+        return rest_client_->get("/v1/withdraws/chance?" + query, headers);
+    });
 
-    if (!failed_coins.empty()) {
+    const auto stats = fee_collector_.last_stats();
+    if (!stats.failed_coins.empty()) {
         std::string missed;
-        for (const auto& c : failed_coins) {
+        for (const auto& c : stats.failed_coins) {
             if (!missed.empty()) missed += ", ";
             missed += c;
         }
         Logger::warn("[Upbit] Failed to fetch withdrawal fees for {} coins: {}",
-                     failed_coins.size(), missed);
+                     stats.failed_coins.size(), missed);
+    }
+    if (stats.banned) {
+        Logger::warn("[Upbit] Withdrawal-fee collection stopped early: API returned 418");
     }
-    Logger::info("[Upbit] Loaded withdrawal fees for {} / {} coins", fees.size(), unique_coins.size());
+    Logger::info("[Upbit] Loaded withdrawal fees for {} / {} coins in {}ms "
+                 "(fetched={} cached={} stale={} requests={} throttled={})",
+                 fees.size(), unique_coins.size(), stats.elapsed_ms,
+                 stats.fetched, stats.cache_hits, stats.stale_served,
+                 stats.requests, stats.throttled);
     return fees;
 }
 
@@ -0,0 +1,231 @@
+#include "kimp/exchange/upbit/upbit_fee_collector.hpp"
+
+#include <simdjson.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <unordered_set>
+
+namespace kimp::exchange::upbit {
+
+namespace {
+
+std::string net_type_signature(std::vector<std::string> net_types) {
+    std::sort(net_types.begin(), net_types.end());
+    std::string out;
+    for (const auto& nt : net_types) {
+        out += nt;
+        out += ',';
+    }
+    return out;
+}
+
+} // namespace
+
+WithdrawFeeCollector::WithdrawFeeCollector(Options options)
+    : options_(options)
+    , bucket_(options.requests_per_sec, options.burst) {}
+
+std::optional<int> WithdrawFeeCollector::remaining_req_sec(const HttpResponse& response) {
+    for (const auto& [name, value] : response.headers) {
+        if (name.size() != 13) continue;
+        std::string lower(name);
+        std::transform(lower.begin(), lower.end(), lower.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (lower != "remaining-req") continue;
+
+        const auto pos = value.find("sec=");
+        if (pos == std::string::npos) return std::nullopt;
+        int sec = 0;
+        const char* first = value.data() + pos + 4;
+        const char* last = value.data() + value.size();
+        auto [ptr, ec] = std::from_chars(first, last, sec);
+        if (ec != std::errc{} || ptr == first) return std::nullopt;
+        return sec;
+    }
+    return std::nullopt;
+}
+
+bool WithdrawFeeCollector::parse_withdraw_fee(const std::string& body, double& fee) {
+    simdjson::dom::parser parser;
+    simdjson::dom::element doc;
+    if (parser.parse(body).get(doc)) return false;
+    simdjson::dom::element elem;
+    if (doc["currency"]["withdraw_fee"].get(elem)) return false;
+
+    // Upbit sends decimals as strings ("0.0005")
+    std::string_view text;
+    if (!elem.get_string().get(text)) {
+        std::string owned(text);
+        char* end = nullptr;
+        fee = std::strtod(owned.c_str(), &end);
+        if (end == owned.c_str()) return false;
+    } else if (elem.get_double().get(fee)) {
+        int64_t whole = 0;
+        if (elem.get_int64().get(whole)) return false;
+        fee = static_cast<double>(whole);
+    }
+    return std::isfinite(fee) && fee >= 0.0;
+}
+
+std::string WithdrawFeeCollector::normalize_network(std::string_view raw) {
+    std::string out;
+    out.reserve(raw.size());
+    for (char c : raw) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            out.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+        }
+    }
+    return out;
+}
+
+void WithdrawFeeCollector::observe_response(const HttpResponse& response) {
+    if (auto sec = remaining_req_sec(response)) {
+        bucket_.clamp(static_cast<double>(*sec));
+    }
+    if (response.status_code == 429) {
+        bucket_.pause_until(network::TokenBucket::Clock::now() + options_.throttle_pause);
+    }
+}
+
+WithdrawFeeCollector::FeeMap WithdrawFeeCollector::collect(const std::vector<CoinNetworks>& coins,
+                                                           const RequestFn& request) {
+    std::lock_guard collect_guard(collect_mutex_);
+    const auto started = std::chrono::steady_clock::now();
+
+    Stats stats;
+    FeeMap fees;
+
+    struct Job {
+        std::size_t coin;
+        std::string net_type;
+        std::optional<double> fee;
+    };
+    std::vector<Job> jobs;
+    std::vector<std::string> signatures(coins.size());
+    std::vector<bool> pending(coins.size(), false);
+
+    {
+        std::unordered_set<std::string> seen;
+        std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < coins.size(); ++i) {
+            const auto& c = coins[i];
+            if (c.coin.empty() || !seen.insert(c.coin).second) continue;
+            ++stats.coins;
+            signatures[i] = net_type_signature(c.net_types);
+
+            auto it = cache_.find(c.coin);
+            if (it != cache_.end() && it->second.signature == signatures[i] &&
+                started - it->second.fetched_at < options_.ttl) {
+                fees[c.coin] = it->second.fees;
+                ++stats.cache_hits;
+                continue;
+            }
+            pending[i] = true;
+            if (c.net_types.empty()) {
+                jobs.push_back({i, std::string{}, std::nullopt});
+            } else {
+                for (const auto& nt : c.net_types) {
+                    jobs.push_back({i, nt, std::nullopt});
+                }
+            }
+        }
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> throttled{0};
+    std::atomic<bool> banned{false};
+
+    auto worker = [&]() {
+        for (std::size_t j = next.fetch_add(1); j < jobs.size(); j = next.fetch_add(1)) {
+            Job& job = jobs[j];
+
+            for (int attempt = 0; attempt < options_.max_attempts; ++attempt) {
+                if (banned.load(std::memory_order_relaxed)) return;
+                bucket_.acquire();
+                const HttpResponse response = request(coins[job.coin].coin, job.net_type);
+                requests.fetch_add(1, std::memory_order_relaxed);
+                observe_response(response);
+
+                if (response.status_code == 429) {
+                    throttled.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                if (response.status_code == 418) {
+                    banned.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                double fee = 0.0;
+                if (response.success && parse_withdraw_fee(response.body, fee)) {
+                    job.fee = fee;
+                }
+                break;  // Other errors (e.g. unknown net_type) are not retried
+            }
+        }
+    };
+
+    const std::size_t worker_count = std::min(std::max<std::size_t>(options_.workers, 1), jobs.size());
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    // Assemble per coin in job order so network order is deterministic
+    std::vector<std::vector<NetworkFee>> fresh(coins.size());
+    std::vector<std::unordered_set<std::string>> seen_networks(coins.size());
+    for (const auto& job : jobs) {
+        if (!job.fee) continue;
+        std::string net_name = job.net_type.empty()
+            ? coins[job.coin].coin
+            : normalize_network(job.net_type);
+        if (seen_networks[job.coin].insert(net_name).second) {
+            fresh[job.coin].push_back({std::move(net_name), *job.fee});
+        }
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < coins.size(); ++i) {
+            if (!pending[i]) continue;
+            const auto& coin = coins[i].coin;
+            if (!fresh[i].empty()) {
+                cache_[coin] = CacheEntry{signatures[i], fresh[i], started};
+                fees[coin] = std::move(fresh[i]);
+                ++stats.fetched;
+                continue;
+            }
+            auto it = cache_.find(coin);
+            if (it != cache_.end()) {
+                fees[coin] = it->second.fees;
+                ++stats.stale_served;
+            } else {
+                stats.failed_coins.push_back(coin);
+            }
+        }
+
+        stats.requests = requests.load();
+        stats.throttled = throttled.load();
+        stats.banned = banned.load();
+        stats.elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - started).count();
+        stats_ = stats;
+    }
+    return fees;
+}
+
+WithdrawFeeCollector::Stats WithdrawFeeCollector::last_stats() const {
+    std::lock_guard lock(mutex_);
+    return stats_;
+}
+
+} // namespace kimp::exchange::upbit
@@ -0,0 +1,175 @@
+#include "kimp/execution/account_pool.hpp"
+
+#include "kimp/core/logger.hpp"
+
+#include <algorithm>
+
+namespace kimp::execution {
+
+void AccountPool::set_primary(Exchange ex, ExchangePtr exchange, const Options& options) {
+    const auto venue = static_cast<std::size_t>(ex);
+    if (venue >= venues_.size()) {
+        return;
+    }
+    auto primary = std::make_shared<Account>(std::move(exchange), options);
+    std::lock_guard lock(mutex_);
+    if (const auto& previous = venues_[venue][0]) {
+        primary->balance = previous->balance;
+        primary->reserved = previous->reserved;
+        primary->lifecycles = previous->lifecycles;
+    }
+    venues_[venue][0] = std::move(primary);
+    if (counts_[venue].load(std::memory_order_relaxed) == 0) {
+        counts_[venue].store(1, std::memory_order_release);
+    }
+}
+
+int AccountPool::add(Exchange ex, ExchangePtr exchange, const Options& options) {
+    const auto venue = static_cast<std::size_t>(ex);
+    if (venue >= venues_.size() || !exchange) {
+        return -1;
+    }
+    std::lock_guard lock(mutex_);
+    const std::size_t n = counts_[venue].load(std::memory_order_relaxed);
+    if (n == 0 || n >= MAX_ACCOUNTS) {
+        return -1;
+    }
+    venues_[venue][n] = std::make_shared<Account>(std::move(exchange), options);
+    counts_[venue].store(n + 1, std::memory_order_release);
+    return static_cast<int>(n);
+}
+
+std::size_t AccountPool::count(Exchange ex) const noexcept {
+    const auto venue = static_cast<std::size_t>(ex);
+    return venue < counts_.size() ? counts_[venue].load(std::memory_order_acquire) : 0;
+}
+
+std::shared_ptr<AccountPool::Account> AccountPool::account(Exchange ex, uint8_t index) const noexcept {
+    if (index >= count(ex)) {
+        return nullptr;
+    }
+    return venues_[static_cast<std::size_t>(ex)][index];
+}
+
+AccountPool::ExchangePtr AccountPool::exchange(Exchange ex, uint8_t account_index) const noexcept {
+    auto acc = account(ex, account_index);
+    return acc ? acc->exchange : nullptr;
+}
+
+void AccountPool::set_balance(Exchange ex, uint8_t account_index, double balance) {
+    if (auto acc = account(ex, account_index)) {
+        std::lock_guard lock(mutex_);
+        acc->balance = std::max(balance, 0.0);
+    }
+}
+
+void AccountPool::refresh_balances() {
+    for (std::size_t venue = 0; venue < venues_.size(); ++venue) {
+        const auto ex = static_cast<Exchange>(venue);
+        const std::string quote = is_korean_exchange(ex) ? "KRW" : "USDT";
+        const std::size_t n = count(ex);
+        for (std::size_t i = 0; i < n; ++i) {
+            auto acc = account(ex, static_cast<uint8_t>(i));
+            if (!acc || !acc->exchange) {
+                continue;
+            }
+            try {
+                set_balance(ex, static_cast<uint8_t>(i), acc->exchange->get_balance(quote));
+            } catch (const std::exception& e) {
+                Logger::warn("[ACCOUNTS] {} account {} balance refresh failed: {}",
+                             exchange_name(ex), i, e.what());
+            }
+        }
+    }
+}
+
+uint8_t AccountPool::assign(Exchange ex, double notional) {
+    const std::size_t n = count(ex);
+    if (n <= 1) {
+        if (n == 1) {
+            reserve(ex, 0, notional);
+        }
+        return 0;
+    }
+
+    const auto now = network::TokenBucket::Clock::now();
+    std::lock_guard lock(mutex_);
+    const Venue& venue = venues_[static_cast<std::size_t>(ex)];
+    // Free balance first; fewer open lifecycles, then the lower index, break ties
+    auto better = [&venue](std::size_t a, std::size_t b) {
+        const double free_a = venue[a]->balance - venue[a]->reserved;
+        const double free_b = venue[b]->balance - venue[b]->reserved;
+        if (free_a != free_b) {
+            return free_a > free_b;
+        }
+        return venue[a]->lifecycles < venue[b]->lifecycles;
+    };
+    std::size_t best = n;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (venue[i]->budget.available(now) < 1.0) {
+            continue;  // Out of order budget: its legs would wait on the venue limit
+        }
+        if (best == n || better(i, best)) {
+            best = i;
+        }
+    }
+    if (best == n) {
+        // Every account is throttled: the one refilling first
+        best = 0;
+        for (std::size_t i = 1; i < n; ++i) {
+            if (venue[i]->budget.available(now) > venue[best]->budget.available(now)) {
+                best = i;
+            }
+        }
+    }
+    venue[best]->reserved += std::max(notional, 0.0);
+    ++venue[best]->lifecycles;
+    return static_cast<uint8_t>(best);
+}
+
+void AccountPool::reserve(Exchange ex, uint8_t account_index, double notional) {
+    if (auto acc = account(ex, account_index)) {
+        std::lock_guard lock(mutex_);
+        acc->reserved += std::max(notional, 0.0);
+        ++acc->lifecycles;
+    }
+}
+
+void AccountPool::release(Exchange ex, uint8_t account_index, double notional) {
+    if (auto acc = account(ex, account_index)) {
+        std::lock_guard lock(mutex_);
+        acc->reserved = std::max(0.0, acc->reserved - std::max(notional, 0.0));
+        acc->lifecycles = std::max(0, acc->lifecycles - 1);
+    }
+}
+
+bool AccountPool::consume_order(Exchange ex, uint8_t account_index) {
+    auto acc = account(ex, account_index);
+    if (!acc) {
+        return false;
+    }
+    acc->orders.fetch_add(1, std::memory_order_relaxed);
+    network::TokenBucket::Clock::duration wait{};
+    return acc->budget.try_acquire(network::TokenBucket::Clock::now(), wait);
+}
+
+std::vector<AccountPool::AccountStats> AccountPool::stats(Exchange ex) const {
+    std::vector<AccountStats> out;
+    const auto now = network::TokenBucket::Clock::now();
+    const std::size_t n = count(ex);
+    std::lock_guard lock(mutex_);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& acc = venues_[static_cast<std::size_t>(ex)][i];
+        AccountStats s;
+        s.account = static_cast<uint8_t>(i);
+        s.balance = acc->balance;
+        s.reserved = acc->reserved;
+        s.lifecycles = acc->lifecycles;
+        s.order_budget = acc->budget.available(now);
+        s.orders = acc->orders.load(std::memory_order_relaxed);
+        out.push_back(s);
+    }
+    return out;
+}
+
+} // namespace kimp::execution
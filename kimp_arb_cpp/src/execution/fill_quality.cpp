@@ -0,0 +1,218 @@
+#include "kimp/execution/fill_quality.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <map>
+
+namespace kimp::execution {
+
+namespace {
+
+struct FileHeader {
+    std::array<char, 8> magic{FILL_QUALITY_MAGIC};
+    uint32_t record_size{sizeof(FillQualityRecord)};
+    uint32_t reserved{0};
+};
+static_assert(sizeof(FileHeader) == 16);
+
+const char* action_name(FillAction action) noexcept {
+    switch (action) {
+        case FillAction::Entry: return "entry";
+        case FillAction::Exit: return "exit";
+        case FillAction::Reentry: return "reentry";
+    }
+    return "?";
+}
+
+std::string group_key(const FillQualityRecord& r, FillGroup group) {
+    switch (group) {
+        case FillGroup::Venue:
+            return fmt::format("{} {}", exchange_name(r.venue), r.leg == FillLeg::Korean ? "(KR)" : "(FR)");
+        case FillGroup::Pair: {
+            const Exchange korean = r.leg == FillLeg::Korean ? r.venue : r.counter_venue;
+            const Exchange foreign = r.leg == FillLeg::Korean ? r.counter_venue : r.venue;
+            return fmt::format("{}/{}", exchange_name(korean), exchange_name(foreign));
+        }
+        case FillGroup::Symbol:
+            return std::string(r.symbol.data(), strnlen(r.symbol.data(), r.symbol.size()));
+    }
+    return {};
+}
+
+struct Accumulator {
+    std::size_t legs{0};
+    double notional_usd{0.0};
+    double slippage_usd{0.0};
+    double drift_usd{0.0};
+    double ack_ms_sum{0.0};
+    std::size_t ack_count{0};
+    double decision_to_fill_ms_sum{0.0};
+    std::size_t fill_count{0};
+};
+
+void append_table(std::string& out, const char* title, const std::vector<FillQualityRow>& rows) {
+    fmt::format_to(std::back_inserter(out), "\n{}\n", title);
+    fmt::format_to(std::back_inserter(out), "{:<20} {:>6} {:>12} {:>9} {:>9} {:>9} {:>10} {:>10} {:>8} {:>9}\n",
+                   "key", "legs", "notional$", "slip_bp", "drift_bp", "impact_bp",
+                   "slip$", "drift$", "ack_ms", "fill_ms");
+    for (const auto& row : rows) {
+        fmt::format_to(std::back_inserter(out),
+                       "{:<20} {:>6} {:>12.2f} {:>9.2f} {:>9.2f} {:>9.2f} {:>10.4f} {:>10.4f} {:>8.1f} {:>9.1f}\n",
+                       row.key, row.legs, row.notional_usd, row.slippage_bps, row.drift_bps, row.impact_bps,
+                       row.slippage_usd, row.drift_usd, row.avg_ack_ms, row.avg_decision_to_fill_ms);
+    }
+}
+
+} // namespace
+
+double FillQualityRecord::slippage_bps() const noexcept {
+    if (decision_price <= 0.0 || fill_price <= 0.0) {
+        return 0.0;
+    }
+    const double sign = side == Side::Buy ? 1.0 : -1.0;
+    return sign * (fill_price - decision_price) / decision_price * 1e4;
+}
+
+double FillQualityRecord::drift_bps() const noexcept {
+    if (decision_price <= 0.0 || fill_quote_price <= 0.0) {
+        return 0.0;
+    }
+    const double sign = side == Side::Buy ? 1.0 : -1.0;
+    return sign * (fill_quote_price - decision_price) / decision_price * 1e4;
+}
+
+double FillQualityRecord::notional_usd() const noexcept {
+    const double notional = fill_price * fill_qty;
+    if (leg == FillLeg::Korean) {
+        return usdt_krw > 0.0 ? notional / usdt_krw : 0.0;
+    }
+    return notional;
+}
+
+bool append_fill_quality(const std::string& path, const std::vector<FillQualityRecord>& records) {
+    if (records.empty()) {
+        return true;
+    }
+    std::error_code ec;
+    if (const auto parent = std::filesystem::path(path).parent_path(); !parent.empty()) {
+        std::filesystem::create_directories(parent, ec);
+    }
+    const bool need_header = !std::filesystem::exists(path, ec) || std::filesystem::file_size(path, ec) == 0;
+
+    std::FILE* file = std::fopen(path.c_str(), "ab");
+    if (!file) {
+        return false;
+    }
+    bool ok = true;
+    if (need_header) {
+        const FileHeader header;
+        ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    }
+    if (ok) {
+        ok = std::fwrite(records.data(), sizeof(FillQualityRecord), records.size(), file) == records.size();
+    }
+    return std::fclose(file) == 0 && ok;
+}
+
+bool read_fill_quality(const std::string& path, std::vector<FillQualityRecord>& out, std::string* error) {
+    auto fail = [&](std::string message) {
+        if (error) {
+            *error = std::move(message);
+        }
+        return false;
+    };
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return fail(fmt::format("cannot open {}", path));
+    }
+    FileHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != FILL_QUALITY_MAGIC ||
+        header.record_size != sizeof(FillQualityRecord)) {
+        std::fclose(file);
+        return fail(fmt::format("{} is not a fill quality log", path));
+    }
+
+    out.clear();
+    FillQualityRecord record;
+    while (std::fread(&record, sizeof(record), 1, file) == 1) {
+        out.push_back(record);
+    }
+    std::fclose(file);
+    return true;
+}
+
+std::vector<FillQualityRow> summarize_fill_quality(const std::vector<FillQualityRecord>& records,
+                                                   FillGroup group) {
+    std::map<std::string, Accumulator> groups;
+    for (const auto& r : records) {
+        const double notional = r.notional_usd();
+        if (notional <= 0.0) {
+            continue;
+        }
+        auto& acc = groups[group_key(r, group)];
+        ++acc.legs;
+        acc.notional_usd += notional;
+        acc.slippage_usd += r.slippage_bps() * notional / 1e4;
+        acc.drift_usd += r.drift_bps() * notional / 1e4;
+        if (r.ack_ns > r.send_ns && r.send_ns != 0) {
+            acc.ack_ms_sum += static_cast<double>(r.ack_ns - r.send_ns) / 1e6;
+            ++acc.ack_count;
+        }
+        if (r.fill_ns > r.decision_ns && r.decision_ns != 0) {
+            acc.decision_to_fill_ms_sum += static_cast<double>(r.fill_ns - r.decision_ns) / 1e6;
+            ++acc.fill_count;
+        }
+    }
+
+    std::vector<FillQualityRow> rows;
+    rows.reserve(groups.size());
+    for (const auto& [key, acc] : groups) {
+        FillQualityRow row;
+        row.key = key;
+        row.legs = acc.legs;
+        row.notional_usd = acc.notional_usd;
+        row.slippage_usd = acc.slippage_usd;
+        row.drift_usd = acc.drift_usd;
+        row.slippage_bps = acc.slippage_usd / acc.notional_usd * 1e4;
+        row.drift_bps = acc.drift_usd / acc.notional_usd * 1e4;
+        row.impact_bps = row.slippage_bps - row.drift_bps;
+        row.avg_ack_ms = acc.ack_count > 0 ? acc.ack_ms_sum / static_cast<double>(acc.ack_count) : 0.0;
+        row.avg_decision_to_fill_ms = acc.fill_count > 0
+            ? acc.decision_to_fill_ms_sum / static_cast<double>(acc.fill_count) : 0.0;
+        rows.push_back(std::move(row));
+    }
+    std::sort(rows.begin(), rows.end(), [](const FillQualityRow& a, const FillQualityRow& b) {
+        return a.slippage_usd > b.slippage_usd;
+    });
+    return rows;
+}
+
+std::string format_fill_quality_report(const std::vector<FillQualityRecord>& records) {
+    std::map<std::string, std::size_t> by_action;
+    std::map<uint64_t, bool> traces;
+    for (const auto& r : records) {
+        ++by_action[action_name(r.action)];
+        traces[r.trace_id] = true;
+    }
+
+    std::string out;
+    fmt::format_to(std::back_inserter(out), "Fill quality: {} legs across {} traces", records.size(), traces.size());
+    for (const auto& [action, count] : by_action) {
+        fmt::format_to(std::back_inserter(out), ", {} {}", count, action);
+    }
+    out += "\nbp: positive = worse than the decision quote; drift = touch moved before the fill, "
+           "impact = remainder (book walk)\n";
+    append_table(out, "By venue", summarize_fill_quality(records, FillGroup::Venue));
+    append_table(out, "By pair (Korean/foreign)", summarize_fill_quality(records, FillGroup::Pair));
+    append_table(out, "By symbol", summarize_fill_quality(records, FillGroup::Symbol));
+    return out;
+}
+
+} // namespace kimp::execution
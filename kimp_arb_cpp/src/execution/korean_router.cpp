@@ -0,0 +1,226 @@
+#include "kimp/execution/korean_router.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace kimp::execution {
+
+namespace {
+
+constexpr double EPS_QTY = 1e-12;
+
+double effective_price(double price, double fee_rate, bool buy) noexcept {
+    return buy ? price * (1.0 + fee_rate) : price * (1.0 - fee_rate);
+}
+
+// Best-first merge of both books under the per-venue caps
+KoreanRoute walk(const KoreanLegRouter::VenueBook& primary, const KoreanLegRouter::VenueBook& secondary,
+                 double quantity, bool buy) {
+    const KoreanLegRouter::VenueBook* venues[2] = {&primary, &secondary};
+    KoreanRoute route;
+    route.buy = buy;
+    route.legs[0].exchange = primary.exchange;
+    route.legs[1].exchange = secondary.exchange;
+
+    std::size_t index[2] = {0, 0};
+    double level_left[2] = {0.0, 0.0};
+    double cap_left[2] = {primary.max_quantity, secondary.max_quantity};
+    double last_price[2] = {0.0, 0.0};
+
+    // Next usable level of venue v, or false when its book is exhausted
+    auto current = [&](int v) {
+        const auto& book = *venues[v];
+        while (level_left[v] <= EPS_QTY) {
+            if (index[v] >= book.count) {
+                return false;
+            }
+            const auto& level = book.levels[index[v]++];
+            if (level.price > 0.0 && level.quantity > 0.0) {
+                level_left[v] = level.quantity;
+                last_price[v] = level.price;
+            }
+        }
+        return true;
+    };
+
+    double remaining = quantity;
+    while (remaining > EPS_QTY) {
+        const bool has[2] = {cap_left[0] > EPS_QTY && current(0), cap_left[1] > EPS_QTY && current(1)};
+        if (!has[0] && !has[1]) {
+            break;
+        }
+        int v = has[0] ? 0 : 1;
+        if (has[0] && has[1]) {
+            const double p0 = effective_price(last_price[0], primary.fee_rate, buy);
+            const double p1 = effective_price(last_price[1], secondary.fee_rate, buy);
+            v = (buy ? p1 < p0 : p1 > p0) ? 1 : 0;  // Ties stay on the primary
+        }
+        const double take = std::min({remaining, level_left[v], cap_left[v]});
+        auto& leg = route.legs[v];
+        leg.quantity += take;
+        leg.notional_krw += take * last_price[v];
+        leg.worst_price = last_price[v];
+        level_left[v] -= take;
+        cap_left[v] -= take;
+        remaining -= take;
+    }
+
+    if (remaining > EPS_QTY) {
+        // Past both visible books: the venue with room takes it at its last level
+        const int v = cap_left[0] >= remaining ? 0 : (cap_left[1] >= remaining ? 1 : -1);
+        const double price = v >= 0 ? (last_price[v] > 0.0 ? last_price[v] : last_price[1 - v]) : 0.0;
+        if (v >= 0 && price > 0.0) {
+            auto& leg = route.legs[v];
+            leg.quantity += remaining;
+            leg.notional_krw += remaining * price;
+            leg.worst_price = price;
+            route.beyond_depth = remaining;
+        }
+    }
+
+    for (int v = 0; v < 2; ++v) {
+        auto& leg = route.legs[v];
+        leg.fee_krw = leg.notional_krw * venues[v]->fee_rate;
+        route.total_krw += buy ? leg.notional_krw + leg.fee_krw : leg.notional_krw - leg.fee_krw;
+    }
+    return route;
+}
+
+bool covers(const KoreanRoute& route, double quantity) noexcept {
+    return route.quantity() >= quantity * (1.0 - 1e-9);
+}
+
+} // namespace
+
+KoreanRoute KoreanLegRouter::plan(const VenueBook& primary, const VenueBook& secondary, double quantity, bool buy,
+                                  double min_child_krw) {
+    KoreanRoute route = walk(primary, secondary, quantity, buy);
+
+    // A child under the venue minimum would be rejected: give its share to
+    // the other venue when that one can take the whole quantity
+    for (int v = 0; v < 2 && route.split(); ++v) {
+        if (route.legs[v].notional_krw >= min_child_krw) {
+            continue;
+        }
+        VenueBook only[2] = {primary, secondary};
+        only[v].max_quantity = 0.0;
+        KoreanRoute folded = walk(only[0], only[1], quantity, buy);
+        if (covers(folded, quantity)) {
+            route = folded;
+        }
+        break;
+    }
+
+    VenueBook none = secondary;
+    none.max_quantity = 0.0;
+    const KoreanRoute single = walk(primary, none, quantity, buy);
+    route.single_venue_krw = covers(single, quantity) ? single.total_krw : 0.0;
+    return route;
+}
+
+KoreanRoute KoreanLegRouter::inventory_split(Exchange primary, Exchange secondary, double quantity,
+                                             double primary_cap, double secondary_cap) {
+    KoreanRoute route;
+    route.buy = false;
+    route.legs[0].exchange = primary;
+    route.legs[1].exchange = secondary;
+    route.legs[1].quantity = std::clamp(secondary_cap, 0.0, quantity);
+    route.legs[0].quantity = std::min(quantity - route.legs[1].quantity, std::max(primary_cap, 0.0));
+    return route;
+}
+
+KoreanRoute KoreanLegRouter::proportional_split(Exchange primary, Exchange secondary, double quantity,
+                                                double primary_held, double secondary_held, double min_child_qty) {
+    KoreanRoute route;
+    route.buy = false;
+    route.legs[0].exchange = primary;
+    route.legs[1].exchange = secondary;
+    primary_held = std::max(primary_held, 0.0);
+    secondary_held = std::max(secondary_held, 0.0);
+    const double held = primary_held + secondary_held;
+    double secondary_qty = held > 0.0 ? std::min(quantity * secondary_held / held, secondary_held) : 0.0;
+    double primary_qty = quantity - secondary_qty;
+    if (secondary_qty > 0.0 && secondary_qty < min_child_qty && quantity <= primary_held) {
+        primary_qty = quantity;
+        secondary_qty = 0.0;
+    } else if (primary_qty > 0.0 && primary_qty < min_child_qty && quantity <= secondary_held) {
+        primary_qty = 0.0;
+        secondary_qty = quantity;
+    }
+    route.legs[0].quantity = primary_qty;
+    route.legs[1].quantity = secondary_qty;
+    return route;
+}
+
+void KoreanLegRouter::on_orderbook(const OrderBook& book) {
+    if (!is_korean_exchange(book.exchange)) {
+        return;
+    }
+    std::lock_guard lock(books_mutex_);
+    books_[static_cast<std::size_t>(book.exchange)][book.symbol] = book;
+}
+
+bool KoreanLegRouter::book(Exchange ex, const SymbolId& symbol, OrderBook& out) const {
+    const auto v = static_cast<std::size_t>(ex);
+    if (v >= VENUES) {
+        return false;
+    }
+    {
+        std::lock_guard lock(books_mutex_);
+        const auto& venue_books = books_[v];
+        auto it = venue_books.find(symbol);
+        if (it == venue_books.end()) {
+            return false;
+        }
+        out = it->second;
+    }
+    const auto age = std::chrono::steady_clock::now() - out.timestamp;
+    return age <= std::chrono::milliseconds(options_.max_book_age_ms);
+}
+
+std::optional<KoreanRoute> KoreanLegRouter::route(Exchange primary, const SymbolId& symbol, double quantity,
+                                                  bool buy, double primary_cap, double secondary_cap) const {
+    const Exchange secondary = other_venue(primary);
+    OrderBook primary_book;
+    OrderBook secondary_book;
+    if (quantity <= 0.0 || !book(primary, symbol, primary_book) || !book(secondary, symbol, secondary_book)) {
+        return std::nullopt;
+    }
+    auto venue = [buy](const OrderBook& book, double cap) {
+        return VenueBook{book.exchange,
+                         buy ? book.asks.data() : book.bids.data(),
+                         buy ? book.ask_count : book.bid_count,
+                         TradingConfig::get_korean_fee_rate(book.exchange),
+                         cap};
+    };
+    KoreanRoute route = plan(venue(primary_book, primary_cap), venue(secondary_book, secondary_cap), quantity, buy,
+                             options_.min_child_krw);
+    if (!covers(route, quantity)) {
+        return std::nullopt;
+    }
+    return route;
+}
+
+double KoreanLegRouter::secondary_top_ask_qty(Exchange primary, const SymbolId& symbol, double primary_ask) const {
+    OrderBook other;
+    if (primary_ask <= 0.0 || !book(other_venue(primary), symbol, other) || other.ask_count == 0) {
+        return 0.0;
+    }
+    const double limit = effective_price(primary_ask, TradingConfig::get_korean_fee_rate(primary), true) *
+                         (1.0 + options_.max_price_gap_bps / 10000.0);
+    double qty = 0.0;
+    for (std::size_t i = 0; i < other.ask_count; ++i) {
+        const auto& level = other.asks[i];
+        if (level.price <= 0.0 || level.quantity <= 0.0) {
+            continue;
+        }
+        if (effective_price(level.price, TradingConfig::get_korean_fee_rate(other.exchange), true) > limit) {
+            break;
+        }
+        qty += level.quantity;
+    }
+    return qty;
+}
+
+} // namespace kimp::execution
@@ -1,8 +1,10 @@
 #include "kimp/execution/order_manager.hpp"
+#include "kimp/core/flight_recorder.hpp"
 #include "kimp/core/logger.hpp"
 #include "kimp/core/optimization.hpp"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <filesystem>
@@ -20,6 +22,7 @@ namespace {
 // ============================================================================
 // Async CSV Trade Logger — zero-copy queue, background file I/O
 // Hot path only: lock → push struct → notify (~1μs vs 10-15ms sync I/O)
+// Also carries the binary fill-quality records (fill_quality.bin)
 // ============================================================================
 class AsyncCsvWriter {
 public:
@@ -53,6 +56,12 @@ public:
         bool final_split;
     };
 
+    // Directory for the split CSVs; takes effect for the next flush
+    void set_dir(std::string dir) {
+        std::lock_guard lock(mutex_);
+        dir_ = std::move(dir);
+    }
+
     void push_entry(EntryLog&& log) {
         {
             std::lock_guard lock(mutex_);
@@ -69,6 +78,14 @@ public:
         cv_.notify_one();
     }
 
+    void push_fill(const kimp::execution::FillQualityRecord& record) {
+        {
+            std::lock_guard lock(mutex_);
+            fill_queue_.push_back(record);
+        }
+        cv_.notify_one();
+    }
+
     ~AsyncCsvWriter() {
         {
             std::lock_guard lock(mutex_);
@@ -85,7 +102,10 @@ private:
     std::condition_variable cv_;
     std::deque<EntryLog> entry_queue_;
     std::deque<ExitLog> exit_queue_;
+    std::vector<kimp::execution::FillQualityRecord> fill_queue_;
     bool stop_{false};
+    std::string dir_{"trade_logs"};
+    std::string active_dir_;
     bool dirs_created_{false};
     bool entry_header_written_{false};
     bool exit_header_written_{false};
@@ -111,7 +131,7 @@ private:
 
     void ensure_dirs() {
         if (!dirs_created_) {
-            std::filesystem::create_directories("trade_logs");
+            std::filesystem::create_directories(active_dir_);
             dirs_created_ = true;
         }
     }
@@ -119,7 +139,7 @@ private:
     void flush_entries(std::deque<EntryLog>& batch) {
         if (batch.empty()) return;
         ensure_dirs();
-        const std::string path = "trade_logs/entry_splits.csv";
+        const std::string path = active_dir_ + "/entry_splits.csv";
 
         if (!entry_header_written_) {
             bool need = !std::filesystem::exists(path) ||
@@ -154,7 +174,7 @@ private:
     void flush_exits(std::deque<ExitLog>& batch) {
         if (batch.empty()) return;
         ensure_dirs();
-        const std::string path = "trade_logs/exit_splits.csv";
+        const std::string path = active_dir_ + "/exit_splits.csv";
 
         if (!exit_header_written_) {
             bool need = !std::filesystem::exists(path) ||
@@ -189,21 +209,40 @@ private:
         batch.clear();
     }
 
+    void flush_fills(std::vector<kimp::execution::FillQualityRecord>& batch) {
+        if (batch.empty()) return;
+        ensure_dirs();
+        const std::string path = active_dir_ + "/fill_quality.bin";
+        if (!kimp::execution::append_fill_quality(path, batch)) {
+            kimp::Logger::warn("[FILL-QUALITY] Failed to append {} records to {}", batch.size(), path);
+        }
+        batch.clear();
+    }
+
     void run() {
         std::deque<EntryLog> entry_batch;
         std::deque<ExitLog> exit_batch;
+        std::vector<kimp::execution::FillQualityRecord> fill_batch;
         while (true) {
             {
                 std::unique_lock lock(mutex_);
                 cv_.wait(lock, [this] {
-                    return stop_ || !entry_queue_.empty() || !exit_queue_.empty();
+                    return stop_ || !entry_queue_.empty() || !exit_queue_.empty() || !fill_queue_.empty();
                 });
                 entry_batch.swap(entry_queue_);
                 exit_batch.swap(exit_queue_);
-                if (stop_ && entry_batch.empty() && exit_batch.empty()) return;
+                fill_batch.swap(fill_queue_);
+                if (stop_ && entry_batch.empty() && exit_batch.empty() && fill_batch.empty()) return;
+                if (dir_ != active_dir_) {
+                    active_dir_ = dir_;
+                    dirs_created_ = false;
+                    entry_header_written_ = false;
+                    exit_header_written_ = false;
+                }
             }
             flush_entries(entry_batch);
             flush_exits(exit_batch);
+            flush_fills(fill_batch);
         }
     }
 };
@@ -267,6 +306,33 @@ double resolved_fill_price(const kimp::Order& order, double fallback) {
     return order.average_price > 0.0 ? order.average_price : fallback;
 }
 
+// An IOC ack only means accepted: once its fill is known the order is
+// Filled for what crossed the limit, or Cancelled when nothing did
+void settle_ioc_fill(kimp::Order& order) {
+    if (order.type != kimp::OrderType::Limit) {
+        return;
+    }
+    order.quantity = order.filled_quantity;
+    order.status = order.filled_quantity > 0.0 ? kimp::OrderStatus::Filled : kimp::OrderStatus::Cancelled;
+}
+
+// Volume-weighted merge of a follow-up child into a filled leg
+void merge_fill(kimp::Order& into, const kimp::Order& child, double into_qty, double child_fallback_price) {
+    const double child_qty = resolved_fill_quantity(child);
+    const double total = into_qty + child_qty;
+    if (child_qty <= 0.0 || total <= 0.0) {
+        return;
+    }
+    const double notional = into_qty * resolved_fill_price(into, into.price) +
+                            child_qty * resolved_fill_price(child, child_fallback_price);
+    into.status = kimp::OrderStatus::Filled;
+    into.quantity = total;
+    into.filled_quantity = total;
+    into.average_price = notional / total;
+    into.order_id_str += (into.order_id_str.empty() ? "" : "+") + child.order_id_str;
+    into.update_time = std::max(into.update_time, child.update_time);
+}
+
 bool quantities_match(double lhs, double rhs) {
     const double scale = std::max({1.0, std::fabs(lhs), std::fabs(rhs)});
     return std::fabs(lhs - rhs) <= (scale * 1e-6);
@@ -303,17 +369,78 @@ bool quote_pair_is_usable(const kimp::strategy::PriceCache::PriceData& korean_pr
     uint64_t now_ms = steady_now_ms();
     if (!korean_price.valid || korean_price.timestamp == 0 ||
         !foreign_price.valid || foreign_price.timestamp == 0) return false;
-    if ((now_ms - korean_price.timestamp) > max_age || (now_ms - foreign_price.timestamp) > max_age) return false;
+    // Venue event time when the venue clock is synced, else local receive time
+    const uint64_t korean_ts = korean_price.quote_ts();
+    const uint64_t foreign_ts = foreign_price.quote_ts();
+    if ((now_ms - korean_ts) > max_age || (now_ms - foreign_ts) > max_age) return false;
 
-    uint64_t ts_diff = korean_price.timestamp >= foreign_price.timestamp
-                           ? korean_price.timestamp - foreign_price.timestamp
-                           : foreign_price.timestamp - korean_price.timestamp;
+    uint64_t ts_diff = korean_ts >= foreign_ts ? korean_ts - foreign_ts : foreign_ts - korean_ts;
     if (ts_diff > max_desync) return false;
     if (spread_pct(korean_price.bid, korean_price.ask) > max_kr_sp) return false;
     if (spread_pct(foreign_price.bid, foreign_price.ask) > max_fr_sp) return false;
     return true;
 }
 
+// Events leading up to a hedge break, for the post-mortem
+void dump_flight_recorder() {
+    if (kimp::FlightRecorder::enabled() && kimp::FlightRecorder::dump("hedge_mismatch")) {
+        kimp::Logger::error("[RISK-STOP] Flight recorder dumped to {}", kimp::FlightRecorder::last_dump_path());
+    }
+}
+
+// Submit acknowledged (or refused) by the venue
+void record_leg_ack(kimp::Exchange ex, std::chrono::steady_clock::time_point submit_start,
+                    const kimp::Order& order) {
+    const double ack_us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - submit_start).count();
+    kimp::FlightRecorder::record(kimp::FlightEventType::LegAck, ex, order.symbol, order.client_order_id,
+                                 order.quantity, order.price, ack_us, 0.0,
+                                 static_cast<uint8_t>(order.side), static_cast<uint8_t>(order.status));
+}
+
+void record_leg_fill(kimp::Exchange ex, const kimp::Order& order) {
+    kimp::FlightRecorder::record(kimp::FlightEventType::LegFill, ex, order.symbol, order.client_order_id,
+                                 order.filled_quantity, order.average_price, 0.0, 0.0,
+                                 static_cast<uint8_t>(order.side), static_cast<uint8_t>(order.status));
+}
+
+// Account per venue the calling thread's orders go to (0 = main connector)
+thread_local std::array<uint8_t, static_cast<std::size_t>(kimp::Exchange::Count)> t_accounts{};
+
+// Sets the thread's accounts for a scope and restores the previous ones
+class AccountScope {
+public:
+    AccountScope() : saved_(t_accounts) {}
+    ~AccountScope() { t_accounts = saved_; }
+    AccountScope(const AccountScope&) = delete;
+    AccountScope& operator=(const AccountScope&) = delete;
+
+    void set(kimp::Exchange ex, uint8_t account) noexcept {
+        t_accounts[static_cast<std::size_t>(ex)] = account;
+    }
+
+private:
+    std::array<uint8_t, static_cast<std::size_t>(kimp::Exchange::Count)> saved_;
+};
+
+// A lifecycle's reservation on an account, released when the lifecycle ends
+class AccountLease {
+public:
+    AccountLease(kimp::execution::AccountPool& pool, kimp::Exchange ex, uint8_t account, double notional)
+        : pool_(pool), ex_(ex), account_(account), notional_(notional) {}
+    ~AccountLease() { pool_.release(ex_, account_, notional_); }
+    AccountLease(const AccountLease&) = delete;
+    AccountLease& operator=(const AccountLease&) = delete;
+
+    uint8_t account() const noexcept { return account_; }
+
+private:
+    kimp::execution::AccountPool& pool_;
+    kimp::Exchange ex_;
+    uint8_t account_;
+    double notional_;
+};
+
 } // namespace
 
 namespace kimp::execution {
@@ -323,13 +450,18 @@ OrderManager::OrderManager()
           handle_fill_query(std::move(task), worker_index);
       }) {}
 
+void OrderManager::set_trade_log_dir(std::string dir) {
+    AsyncCsvWriter::instance().set_dir(std::move(dir));
+}
+
 OrderManager::~OrderManager() {
     running_.store(false, std::memory_order_release);
     fill_query_executor_.stop();
 }
 
-void OrderManager::set_exchange(Exchange ex, ExchangePtr exchange) {
+void OrderManager::set_exchange(Exchange ex, ExchangePtr exchange, const AccountPool::Options& account_options) {
     exchanges_[static_cast<size_t>(ex)] = exchange;
+    accounts_.set_primary(ex, exchange, account_options);
     if (ex == Exchange::Bithumb) {
         bithumb_exchange_ = std::dynamic_pointer_cast<exchange::bithumb::BithumbExchange>(exchange);
     } else if (ex == Exchange::Upbit) {
@@ -341,27 +473,58 @@ void OrderManager::set_exchange(Exchange ex, ExchangePtr exchange) {
     }
 }
 
+void OrderManager::set_position_update_callback(PositionUpdateCallback cb) {
+    if (!cb) {
+        on_position_update_ = nullptr;
+        return;
+    }
+    // Snapshots are built on the lifecycle's thread: tag them with its accounts
+    on_position_update_ = [cb = std::move(cb)](const Position* pos) {
+        if (!pos) {
+            cb(nullptr);
+            return;
+        }
+        Position tagged = *pos;
+        tagged.korean_account = current_account(pos->korean_exchange);
+        tagged.foreign_account = current_account(pos->foreign_exchange);
+        cb(&tagged);
+    };
+}
+
+uint8_t OrderManager::current_account(Exchange ex) noexcept {
+    const auto venue = static_cast<std::size_t>(ex);
+    return venue < t_accounts.size() ? t_accounts[venue] : 0;
+}
+
 OrderManager::KoreanExchangePtr OrderManager::get_korean_exchange(Exchange ex) {
     if (ex == Exchange::Bithumb) {
-        return bithumb_exchange_;
+        return get_bithumb_exchange();
     }
     if (ex == Exchange::Upbit) {
-        return upbit_exchange_;
+        return get_upbit_exchange();
     }
     return nullptr;
 }
 
+std::shared_ptr<exchange::bithumb::BithumbExchange> OrderManager::get_bithumb_exchange() {
+    return account_connector(Exchange::Bithumb, bithumb_exchange_);
+}
+
+std::shared_ptr<exchange::upbit::UpbitExchange> OrderManager::get_upbit_exchange() {
+    return account_connector(Exchange::Upbit, upbit_exchange_);
+}
+
 OrderManager::BybitExchangePtr OrderManager::get_bybit_exchange() {
-    return bybit_exchange_;
+    return account_connector(Exchange::Bybit, bybit_exchange_);
 }
 
 OrderManager::OkxExchangePtr OrderManager::get_okx_exchange() {
-    return okx_exchange_;
+    return account_connector(Exchange::OKX, okx_exchange_);
 }
 
 std::shared_ptr<exchange::ForeignShortExchangeBase> OrderManager::get_foreign_exchange(Exchange ex) {
-    if (ex == Exchange::OKX) return okx_exchange_;
-    return bybit_exchange_;  // Default to Bybit
+    if (ex == Exchange::OKX) return get_okx_exchange();
+    return get_bybit_exchange();  // Default to Bybit
 }
 
 ExecutionResult OrderManager::execute_spot_relay_entry(
@@ -380,6 +543,46 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
     double position_size_usd = engine_ ? engine_->get_position_size_usd() : TradingConfig::POSITION_SIZE_USD;
     result.position.position_size_usd = position_size_usd;
 
+    // Accounts for the whole lifecycle: a resumed position stays on the
+    // accounts holding its legs, a new one goes where balance is free
+    AccountScope account_scope;
+    std::optional<AccountLease> korean_lease;
+    std::optional<AccountLease> foreign_lease;
+    {
+        const double korean_notional = position_size_usd * std::max(signal.usdt_krw_rate, 0.0);
+        if (initial_position) {
+            if (initial_position->korean_account >= accounts_.count(signal.korean_exchange) ||
+                initial_position->foreign_account >= accounts_.count(signal.foreign_exchange)) {
+                result.error_message = fmt::format("Position held on unconfigured account ({} #{}, {} #{})",
+                                                   exchange_name(signal.korean_exchange),
+                                                   initial_position->korean_account,
+                                                   exchange_name(signal.foreign_exchange),
+                                                   initial_position->foreign_account);
+                Logger::error("[TOPUP] {}", result.error_message);
+                return result;
+            }
+            accounts_.reserve(signal.korean_exchange, initial_position->korean_account, korean_notional);
+            accounts_.reserve(signal.foreign_exchange, initial_position->foreign_account, position_size_usd);
+            korean_lease.emplace(accounts_, signal.korean_exchange, initial_position->korean_account, korean_notional);
+            foreign_lease.emplace(accounts_, signal.foreign_exchange, initial_position->foreign_account,
+                                  position_size_usd);
+        } else {
+            korean_lease.emplace(accounts_, signal.korean_exchange,
+                                 accounts_.assign(signal.korean_exchange, korean_notional), korean_notional);
+            foreign_lease.emplace(accounts_, signal.foreign_exchange,
+                                  accounts_.assign(signal.foreign_exchange, position_size_usd), position_size_usd);
+        }
+        account_scope.set(signal.korean_exchange, korean_lease->account());
+        account_scope.set(signal.foreign_exchange, foreign_lease->account());
+        result.position.korean_account = korean_lease->account();
+        result.position.foreign_account = foreign_lease->account();
+        if (accounts_.count(signal.korean_exchange) > 1 || accounts_.count(signal.foreign_exchange) > 1) {
+            Logger::info("[ACCOUNTS] {} on {} #{} / {} #{}", signal.symbol.to_string(),
+                         exchange_name(signal.korean_exchange), korean_lease->account(),
+                         exchange_name(signal.foreign_exchange), foreign_lease->account());
+        }
+    }
+
     auto korean_ex = get_korean_exchange(signal.korean_exchange);
     auto foreign_ex = get_foreign_exchange(signal.foreign_exchange);
 
@@ -419,12 +622,20 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
     // - between: wait for the next fresh market update
     // =========================================================================
     double held_amount = initial_position ? initial_position->korean_amount : 0.0;
+    // Coins of held_amount bought on the other Korean venue by split routing
+    double held_split_amount = initial_position
+        ? std::min(initial_position->korean_split_amount, initial_position->korean_amount) : 0.0;
+    const Exchange split_exchange = KoreanLegRouter::other_venue(signal.korean_exchange);
     double total_korean_cost = initial_position
         ? initial_position->korean_entry_price * initial_position->korean_amount : 0.0;
     double total_foreign_value = initial_position
         ? initial_position->foreign_entry_price * initial_position->foreign_amount : 0.0;
     double realized_pnl_krw = initial_position ? initial_position->realized_pnl_krw : 0.0;
     double last_usdt_rate = signal.usdt_krw_rate;
+    // Borrow interest on the short (coins), settled every pass at the current rate
+    double borrow_interest_coins = initial_position ? initial_position->borrow_interest_coins : 0.0;
+    SystemTimestamp borrow_accrued_at = initial_position
+        ? strategy::BorrowCostModel::accrued_since(*initial_position) : result.position.entry_time;
 
     if (initial_position &&
         !quantities_match(initial_position->korean_amount, initial_position->foreign_amount)) {
@@ -483,6 +694,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
 
     auto trigger_critical_stop = [&](const std::string& reason, const Position& snap) {
         Logger::error("[RISK-STOP] {}", reason);
+        dump_flight_recorder();
         running_.store(false, std::memory_order_release);
         if (engine_) {
             engine_->set_entry_suppressed(true);
@@ -494,14 +706,22 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
         result.error_message = reason;
     };
 
+    ChunkSizer chunk_sizer = make_chunk_sizer(signal.korean_exchange, signal.foreign_exchange);
+    const bool maker_mode = maker_entry_.enabled && engine_ && supports_post_only(signal.korean_exchange);
+    const MakerQuoter maker_quoter({maker_entry_.edge_buffer_pct, maker_entry_.reprice_bps},
+                                   TradingConfig::get_korean_maker_fee_rate(signal.korean_exchange),
+                                   TradingConfig::get_foreign_fee_rate(signal.foreign_exchange));
+
     while (running_.load(std::memory_order_acquire)) {
         // Get fresh prices from cache
         double current_foreign_bid = signal.foreign_bid;
         double current_foreign_ask = 0.0;
         double current_foreign_bid_qty = signal.foreign_bid_qty;
+        double current_foreign_ask_qty = 0.0;
         double current_korean_ask = signal.korean_ask;
         double current_korean_bid = 0.0;
         double current_korean_ask_qty = signal.korean_ask_qty;
+        double current_korean_bid_qty = 0.0;
         double usdt_rate = signal.usdt_krw_rate;  // From signal (guaranteed real)
         bool quote_pair_ok = !engine_;
         if (engine_) {
@@ -519,9 +739,11 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     current_foreign_bid = foreign_price.bid;
                     current_foreign_ask = foreign_price.ask;
                     current_foreign_bid_qty = foreign_price.bid_qty;
+                    current_foreign_ask_qty = foreign_price.ask_qty;
                     current_korean_ask = korean_price.ask;
                     current_korean_bid = korean_price.bid;
                     current_korean_ask_qty = korean_price.ask_qty;
+                    current_korean_bid_qty = korean_price.bid_qty;
                     quote_pair_ok = true;
                 }
             } else {
@@ -530,9 +752,11 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     current_foreign_bid = foreign_price.bid;
                     current_foreign_ask = foreign_price.ask;
                     current_foreign_bid_qty = foreign_price.bid_qty;
+                    current_foreign_ask_qty = foreign_price.ask_qty;
                     current_korean_ask = korean_price.ask;
                     current_korean_bid = korean_price.bid;
                     current_korean_ask_qty = korean_price.ask_qty;
+                    current_korean_bid_qty = korean_price.bid_qty;
                     quote_pair_ok = true;
                 }
             }
@@ -564,41 +788,169 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
             double foreign_krw = current_foreign_ask * usdt_rate;
             exit_premium = ((current_korean_bid - foreign_krw) / foreign_krw) * 100.0;
         }
+        if (entry_premium != 0.0 && exit_premium != 0.0) {
+            chunk_sizer.observe_premium((entry_premium + exit_premium) * 0.5,
+                                        std::chrono::steady_clock::now().time_since_epoch().count());
+        }
+
+        // With split routing the other Korean venue's asks at about the same
+        // price count as depth for the entry leg
+        double routable_korean_ask_qty = current_korean_ask_qty;
+        if (korean_router_ && exchanges_[static_cast<size_t>(split_exchange)]) {
+            routable_korean_ask_qty += korean_router_->secondary_top_ask_qty(
+                signal.korean_exchange, signal.symbol, current_korean_ask);
+        }
+        auto relay_metrics = strategy::PremiumCalculator::calculate_relay_metrics(
+            current_korean_ask,
+            routable_korean_ask_qty,
+            current_foreign_bid,
+            current_foreign_bid_qty,
+            usdt_rate);
+        // Borrow interest: expected hold charged on the entry edge, and the
+        // held short's interest since the last pass settled at the current rate
+        const double borrow_rate = engine_ ? engine_->get_borrow_rate(signal.foreign_exchange, signal.symbol) : 0.0;
+        if (engine_) {
+            strategy::PremiumCalculator::apply_borrow_cost(
+                relay_metrics, borrow_rate * engine_->get_borrow_cost().expected_hold_hours());
+        }
+        {
+            const auto now = std::chrono::system_clock::now();
+            borrow_interest_coins += strategy::BorrowCostModel::interest_coins(
+                held_amount, borrow_rate, strategy::BorrowCostModel::hours_between(borrow_accrued_at, now));
+            borrow_accrued_at = std::max(borrow_accrued_at, now);
+        }
+        const double borrow_cost_pct = held_amount > 0.0 ? borrow_interest_coins / held_amount * 100.0 : 0.0;
+        double current_korean_top_usdt = usdt_rate > 0.0
+            ? ((current_korean_ask * routable_korean_ask_qty) / usdt_rate)
+            : 0.0;
+        double current_foreign_top_usdt = current_foreign_bid * current_foreign_bid_qty;
+        double min_split_usd = min_executable_usd(current_foreign_bid, current_korean_ask);
 
+        // Chunk from visible depth, split round trip and premium noise
         const double open_entry_notional_usd = total_foreign_value;
         double remaining_position_usd = std::max(0.0, position_size_usd - open_entry_notional_usd);
-        const double next_order_usd = std::min(TradingConfig::ORDER_SIZE_USD, remaining_position_usd);
+        const auto entry_chunk = chunk_sizer.size({
+            remaining_position_usd,
+            current_korean_top_usdt,
+            current_foreign_top_usdt,
+            relay_metrics.net_edge_pct - TradingConfig::MIN_NET_EDGE_PCT,
+        });
+        const double next_order_usd = remaining_position_usd >= min_split_usd
+            ? std::max(entry_chunk.usd, min_split_usd)
+            : entry_chunk.usd;
         double next_order_coin_amount = current_foreign_bid > 0.0
             ? (next_order_usd / current_foreign_bid)
             : 0.0;
-        double current_korean_top_usdt = usdt_rate > 0.0
-            ? ((current_korean_ask * current_korean_ask_qty) / usdt_rate)
-            : 0.0;
-        double current_foreign_top_usdt = current_foreign_bid * current_foreign_bid_qty;
         bool korean_can_fill_required = next_order_usd > 0.0 &&
                                         current_korean_top_usdt >= next_order_usd;
         bool foreign_can_fill_required = next_order_usd > 0.0 &&
                                          current_foreign_top_usdt >= next_order_usd;
-        auto relay_metrics = strategy::PremiumCalculator::calculate_relay_metrics(
-            current_korean_ask,
-            current_korean_ask_qty,
-            current_foreign_bid,
-            current_foreign_bid_qty,
-            usdt_rate);
 
-        // Dynamic exit threshold with a hard floor (+0.10% by default)
+        // Dynamic exit threshold with a hard floor, raised by accrued borrow interest
         double dynamic_exit_threshold = TradingConfig::EXIT_PREMIUM_THRESHOLD;
         if (held_amount > 0 && total_foreign_value > 0 && usdt_rate > 0) {
             double effective_entry_pm = calculate_effective_entry_pm(usdt_rate);
-            dynamic_exit_threshold = std::max(
-                effective_entry_pm + TradingConfig::DYNAMIC_EXIT_SPREAD,
-                TradingConfig::EXIT_PREMIUM_THRESHOLD);
+            dynamic_exit_threshold = TradingConfig::dynamic_exit_threshold(effective_entry_pm, borrow_cost_pct);
         }
 
-        double min_split_usd = min_executable_usd(current_foreign_bid, current_korean_ask);
-
         const uint64_t update_seq_before_trade = engine_ ? engine_->get_update_seq() : 0;
         auto split_start = std::chrono::steady_clock::now();
+        const auto split_decided = std::chrono::system_clock::now();
+
+        // Post-only bid where the premium at our own bid clears the gate
+        double maker_price = 0.0;
+        if (maker_mode && foreign_can_fill_required && next_order_usd >= min_split_usd &&
+            !(exit_premium >= dynamic_exit_threshold && held_amount > 0)) {
+            maker_price = MakerQuoter::quote(
+                current_korean_bid, current_korean_ask,
+                maker_quoter.ceiling(current_foreign_bid, usdt_rate, next_order_coin_amount));
+        }
+
+        if (maker_price > 0.0) {
+            // ==================== MAKER ENTRY ====================
+            const MakerChunk chunk = execute_maker_chunk(signal, foreign_symbol, next_order_coin_amount,
+                                                         maker_price, current_korean_ask, chunk_sizer);
+            // Decided on the premium at our own bid
+            const double maker_premium = current_foreign_bid > 0.0 && usdt_rate > 0.0
+                ? (maker_price / (current_foreign_bid * usdt_rate) - 1.0) * 100.0 : entry_premium;
+            record_fill_quality({FillAction::Entry, trace_id, trace_symbol,
+                                 signal.korean_exchange, signal.foreign_exchange,
+                                 signal.symbol, foreign_symbol, split_decided,
+                                 maker_premium, usdt_rate, current_foreign_bid, maker_price},
+                                chunk.foreign_order, chunk.korean_order);
+            const double buy_price = chunk.korean_quantity > 0.0
+                ? chunk.korean_cost / chunk.korean_quantity : maker_price;
+            const double short_price = chunk.foreign_quantity > 0.0
+                ? chunk.foreign_value / chunk.foreign_quantity : current_foreign_bid;
+            if (chunk.hedge_failed) {
+                Position mismatch;
+                mismatch.symbol = signal.symbol;
+                mismatch.korean_exchange = signal.korean_exchange;
+                mismatch.foreign_exchange = signal.foreign_exchange;
+                mismatch.entry_time = result.position.entry_time;
+                mismatch.entry_premium = result.position.entry_premium;
+                mismatch.position_size_usd = position_size_usd;
+                mismatch.korean_amount = held_amount + chunk.korean_quantity;
+                mismatch.korean_split_amount = held_split_amount;
+                mismatch.foreign_amount = held_amount + chunk.foreign_quantity;
+                mismatch.korean_entry_price = mismatch.korean_amount > 0.0
+                    ? (total_korean_cost + chunk.korean_cost) / mismatch.korean_amount : 0.0;
+                mismatch.foreign_entry_price = mismatch.foreign_amount > 0.0
+                    ? (total_foreign_value + chunk.foreign_value) / mismatch.foreign_amount : 0.0;
+                mismatch.realized_pnl_krw = realized_pnl_krw + chunk.adjustment_pnl_krw;
+                mismatch.is_active = mismatch.korean_amount > 0.0 || mismatch.foreign_amount > 0.0;
+
+                trigger_critical_stop(
+                    "[MAKER-ENTRY] Foreign hedge of the resting Korean bid failed (manual intervention required)",
+                    mismatch
+                );
+                return result;
+            }
+
+            const double actual_filled = std::min(chunk.korean_quantity, chunk.foreign_quantity);
+            if (actual_filled > 0.0) {
+                log_hedge_audit("ENTRY", signal.symbol, chunk.korean_quantity, chunk.foreign_quantity,
+                                buy_price, short_price, chunk.adjustment_pnl_krw);
+
+                held_amount += actual_filled;
+                total_korean_cost += actual_filled * buy_price;
+                total_foreign_value += actual_filled * short_price;
+                realized_pnl_krw += chunk.adjustment_pnl_krw;
+                result.korean_filled_amount = actual_filled;
+                result.foreign_filled_amount = actual_filled;
+
+                const double new_open_notional_usd = total_foreign_value;
+                const double effective_entry_pm = calculate_effective_entry_pm(usdt_rate);
+                Logger::info("[MAKER-ENTRY] {} +{:.8f} coins @ {:.2f} (ask {:.2f}), held: ${:.2f}/${:.2f}, "
+                             "eff_entry_pm: {:.4f}%",
+                             signal.symbol.to_string(), actual_filled, buy_price, current_korean_ask,
+                             new_open_notional_usd, position_size_usd, effective_entry_pm);
+                append_entry_split_log(signal.symbol, actual_filled, buy_price,
+                                       short_price, usdt_rate, new_open_notional_usd,
+                                       position_size_usd, effective_entry_pm);
+
+                Position snap;
+                snap.symbol = signal.symbol;
+                snap.korean_exchange = signal.korean_exchange;
+                snap.foreign_exchange = signal.foreign_exchange;
+                snap.entry_time = result.position.entry_time;
+                snap.entry_premium = effective_entry_pm;
+                snap.position_size_usd = position_size_usd;
+                snap.korean_amount = held_amount;
+                snap.korean_split_amount = held_split_amount;
+                snap.foreign_amount = held_amount;
+                snap.korean_entry_price = total_korean_cost / held_amount;
+                snap.foreign_entry_price = total_foreign_value / held_amount;
+                snap.realized_pnl_krw = realized_pnl_krw;
+                snap.borrow_interest_coins = borrow_interest_coins;
+                snap.borrow_accrued_at = borrow_accrued_at;
+                snap.is_active = true;
+                persist_snapshot(snap);
+                record_latency(LatencyStage::EntryCompleted, 0, 0, actual_filled, new_open_notional_usd);
+            }
+            wait_for_next_market_update(update_seq_before_trade);
+            continue;
+        }
 
         if (relay_metrics.net_edge_pct > TradingConfig::MIN_NET_EDGE_PCT &&
             relay_metrics.net_profit_krw >= TradingConfig::MIN_ENTRY_NET_PROFIT_KRW &&
@@ -611,7 +963,8 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
 
             // Open Bybit spot-margin short first (no fill query — deferred to parallel)
             record_latency(LatencyStage::EntryForeignSubmitStart, 0, 0, coin_amount, order_size_usd);
-            Order foreign_order = execute_foreign_short(signal.foreign_exchange, foreign_symbol, coin_amount);
+            Order foreign_order = execute_foreign_short(signal.foreign_exchange, foreign_symbol, coin_amount,
+                                                        protected_limit(current_foreign_bid, Side::Sell));
             record_latency(LatencyStage::EntryForeignSubmitAck,
                            static_cast<int64_t>(foreign_order.status),
                            0,
@@ -625,6 +978,18 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                 continue;
             }
 
+            // An IOC leg fills only what crossed its limit: resolve it first so
+            // the Korean leg matches the actual fill
+            const bool foreign_ioc = foreign_order.type == OrderType::Limit;
+            if (foreign_ioc) {
+                query_foreign_fill(signal.foreign_exchange, foreign_order);
+                if (foreign_order.status != OrderStatus::Filled) {
+                    Logger::warn("[RELAY-ENTRY] IOC short crossed nothing inside the band, re-pricing on the next update");
+                    wait_for_next_market_update(update_seq_before_trade);
+                    continue;
+                }
+            }
+
             // Use lot-size normalized quantity (known pre-fill-query)
             double actual_filled = foreign_order.quantity;
             double krw_amount = actual_filled * current_korean_ask;
@@ -641,6 +1006,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     mismatch.entry_premium = result.position.entry_premium;
                     mismatch.position_size_usd = position_size_usd;
                     mismatch.korean_amount = held_amount;
+                    mismatch.korean_split_amount = held_split_amount;
                     mismatch.foreign_amount = held_amount + actual_filled;
                     mismatch.korean_entry_price = held_amount > 0 ? (total_korean_cost / held_amount) : 0.0;
                     double short_price = foreign_order.average_price > 0 ? foreign_order.average_price : current_foreign_bid;
@@ -661,41 +1027,72 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
 
             // Reuse dedicated fill workers instead of spawning per-order async threads.
             std::latch fill_done(2);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Foreign,
-                signal.foreign_exchange,
-                SymbolId{},
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::EntryForeignFillQueryStart,
-                LatencyStage::EntryForeignFillWorkerStart,
-                LatencyStage::EntryForeignFillDone,
-                &foreign_order,
-                &fill_done,
-            });
+            if (foreign_ioc) {
+                fill_done.count_down();  // Fill resolved before sizing the Korean leg
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Foreign,
+                    signal.foreign_exchange,
+                    SymbolId{},
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::EntryForeignFillQueryStart,
+                    LatencyStage::EntryForeignFillWorkerStart,
+                    LatencyStage::EntryForeignFillDone,
+                    &foreign_order,
+                    &fill_done,
+                });
+            }
 
             record_latency(LatencyStage::EntryKoreanSubmitStart, 0, 0, actual_filled, krw_amount);
-            Order korean_order = execute_korean_buy(signal.korean_exchange, signal.symbol, actual_filled, krw_amount);
+            const double korean_limit = protected_limit(current_korean_ask, Side::Buy);
+            const auto korean_route = plan_korean_buy(signal.korean_exchange, signal.symbol, actual_filled);
+            Order korean_order;
+            double korean_split_qty = 0.0;
+            if (korean_route) {
+                // Children on both venues, fills already resolved
+                auto routed = execute_korean_route(*korean_route, signal.symbol, korean_limit);
+                korean_order = std::move(routed.order);
+                korean_split_qty = routed.split_quantity;
+            } else {
+                korean_order = execute_korean_buy(signal.korean_exchange, signal.symbol, actual_filled, krw_amount,
+                                                  korean_limit);
+            }
             record_latency(LatencyStage::EntryKoreanSubmitAck,
                            static_cast<int64_t>(korean_order.status),
                            0,
                            korean_order.quantity,
                            korean_order.average_price);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Korean,
-                signal.korean_exchange,
-                signal.symbol,
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::EntryKoreanFillQueryStart,
-                LatencyStage::EntryKoreanFillWorkerStart,
-                LatencyStage::EntryKoreanFillDone,
-                &korean_order,
-                &fill_done,
-            });
+            if (korean_route) {
+                fill_done.count_down();
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Korean,
+                    signal.korean_exchange,
+                    signal.symbol,
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::EntryKoreanFillQueryStart,
+                    LatencyStage::EntryKoreanFillWorkerStart,
+                    LatencyStage::EntryKoreanFillDone,
+                    &korean_order,
+                    &fill_done,
+                });
+            }
             fill_done.wait();
+            if (korean_order.type == OrderType::Limit) {
+                // Korean IOC short of the foreign fill: the rest is re-priced at the
+                // latest ask, what still misses is unwound by the correction below
+                reprice_korean_ioc(signal.korean_exchange, signal.symbol, Side::Buy,
+                                   resolved_fill_quantity(foreign_order), korean_order);
+            }
+            record_fill_quality({FillAction::Entry, trace_id, trace_symbol,
+                                 signal.korean_exchange, signal.foreign_exchange,
+                                 signal.symbol, foreign_symbol, split_decided,
+                                 entry_premium, usdt_rate, current_foreign_bid, current_korean_ask},
+                                foreign_order, korean_order);
 
             if (korean_order.status == OrderStatus::Filled) {
                 double short_price = resolved_fill_price(foreign_order, current_foreign_bid);
@@ -725,6 +1122,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                             mismatch.entry_premium = result.position.entry_premium;
                             mismatch.position_size_usd = position_size_usd;
                             mismatch.korean_amount = held_amount + korean_open_qty;
+                            mismatch.korean_split_amount = held_split_amount + korean_split_qty;
                             mismatch.foreign_amount = held_amount + foreign_open_qty;
                             mismatch.korean_entry_price = (held_amount + korean_open_qty) > 0.0
                                 ? (total_korean_cost + (korean_open_qty * buy_price)) / (held_amount + korean_open_qty)
@@ -747,9 +1145,18 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                         entry_adjustment_pnl_krw += (short_price - correction_price) * correction_qty * usdt_rate;
                     } else {
                         const double delta = korean_open_qty - foreign_open_qty;
-                        Order correction;
                         Logger::warn("[HEDGE] Entry Korean fill exceeds foreign fill by {:.8f}; selling delta", delta);
-                        if (!flatten_extra_korean_long(signal.korean_exchange, signal.symbol, delta, correction)) {
+                        // Sell back from both venues in proportion to where this split's coins landed
+                        auto flatten_route = KoreanLegRouter::proportional_split(
+                            signal.korean_exchange, split_exchange, delta, korean_open_qty - korean_split_qty,
+                            korean_split_qty,
+                            current_korean_bid > 0.0 ? TradingConfig::MIN_ORDER_KRW / current_korean_bid : 0.0);
+                        for (auto& leg : flatten_route.legs) {
+                            leg.notional_krw = leg.quantity * current_korean_bid;
+                        }
+                        const auto flattened = execute_korean_route(flatten_route, signal.symbol);
+                        const Order& correction = flattened.order;
+                        if (correction.status != OrderStatus::Filled || resolved_fill_quantity(correction) <= 0.0) {
                             Position mismatch;
                             mismatch.symbol = signal.symbol;
                             mismatch.korean_exchange = signal.korean_exchange;
@@ -758,6 +1165,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                             mismatch.entry_premium = result.position.entry_premium;
                             mismatch.position_size_usd = position_size_usd;
                             mismatch.korean_amount = held_amount + korean_open_qty;
+                            mismatch.korean_split_amount = held_split_amount + korean_split_qty;
                             mismatch.foreign_amount = held_amount + foreign_open_qty;
                             mismatch.korean_entry_price = (held_amount + korean_open_qty) > 0.0
                                 ? (total_korean_cost + (korean_open_qty * buy_price)) / (held_amount + korean_open_qty)
@@ -777,6 +1185,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                         const double correction_qty = resolved_fill_quantity(correction);
                         const double correction_price = resolved_fill_price(correction, current_korean_bid);
                         korean_open_qty -= correction_qty;
+                        korean_split_qty = std::max(0.0, korean_split_qty - flattened.split_quantity);
                         entry_adjustment_pnl_krw += (correction_price - buy_price) * correction_qty;
                     }
                 }
@@ -790,6 +1199,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     mismatch.entry_premium = result.position.entry_premium;
                     mismatch.position_size_usd = position_size_usd;
                     mismatch.korean_amount = held_amount + korean_open_qty;
+                    mismatch.korean_split_amount = held_split_amount + korean_split_qty;
                     mismatch.foreign_amount = held_amount + foreign_open_qty;
                     mismatch.korean_entry_price = (held_amount + korean_open_qty) > 0.0
                         ? (total_korean_cost + (korean_open_qty * buy_price)) / (held_amount + korean_open_qty)
@@ -819,6 +1229,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                 double actual_korean_cost = actual_filled * buy_price;
 
                 held_amount += actual_filled;
+                held_split_amount = std::min(held_split_amount + korean_split_qty, held_amount);
                 total_korean_cost += actual_korean_cost;
                 total_foreign_value += actual_filled * short_price;
                 realized_pnl_krw += entry_adjustment_pnl_krw;
@@ -827,18 +1238,19 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
 
                 double new_open_notional_usd = total_foreign_value;
                 double effective_entry_pm = calculate_effective_entry_pm(usdt_rate);
-                double target_exit_pm = std::max(
-                    effective_entry_pm + TradingConfig::DYNAMIC_EXIT_SPREAD,
-                    TradingConfig::EXIT_PREMIUM_THRESHOLD);
+                double target_exit_pm = TradingConfig::dynamic_exit_threshold(
+                    effective_entry_pm, borrow_interest_coins / held_amount * 100.0);
 
                 auto split_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                     std::chrono::steady_clock::now() - split_start).count();
                 Logger::info("[RELAY-ENTRY] {} +{:.8f} coins (${:.2f}), held: ${:.2f}/${:.2f}, "
                              "net_edge_now: {:.4f}%, entry_pm_now: {:.4f}%, eff_entry_pm: {:.4f}%, "
-                             "target_exit_pm: {:.4f}%, buy_price: {:.2f}, exec_ms: {}",
+                             "target_exit_pm: {:.4f}%, buy_price: {:.2f}, exec_ms: {}, "
+                             "chunk_scale: {:.2f}, drift: {:.4f}%, rtt_ms: {:.0f}",
                              signal.symbol.to_string(), actual_filled, order_size_usd,
                              new_open_notional_usd, position_size_usd, relay_metrics.net_edge_pct,
-                             entry_premium, effective_entry_pm, target_exit_pm, buy_price, split_elapsed);
+                             entry_premium, effective_entry_pm, target_exit_pm, buy_price, split_elapsed,
+                             entry_chunk.scale, entry_chunk.drift_pct, chunk_sizer.round_trip_ms());
 
                 // Log entry split to CSV (actual fill price)
                 append_entry_split_log(signal.symbol, actual_filled, buy_price,
@@ -854,10 +1266,13 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                 snap.entry_premium = effective_entry_pm;
                 snap.position_size_usd = position_size_usd;
                 snap.korean_amount = held_amount;
+                snap.korean_split_amount = held_split_amount;
                 snap.foreign_amount = held_amount;
                 snap.korean_entry_price = held_amount > 0 ? total_korean_cost / held_amount : 0.0;
                 snap.foreign_entry_price = held_amount > 0 ? total_foreign_value / held_amount : 0.0;
                 snap.realized_pnl_krw = realized_pnl_krw;
+                snap.borrow_interest_coins = borrow_interest_coins;
+                snap.borrow_accrued_at = borrow_accrued_at;
                 snap.is_active = true;
                 persist_snapshot(snap);
 
@@ -880,6 +1295,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     mismatch.entry_premium = result.position.entry_premium;
                     mismatch.position_size_usd = position_size_usd;
                     mismatch.korean_amount = held_amount;
+                    mismatch.korean_split_amount = held_split_amount;
                     mismatch.foreign_amount = held_amount + actual_filled;
                     mismatch.korean_entry_price = held_amount > 0 ? (total_korean_cost / held_amount) : 0.0;
                     double short_price = foreign_order.average_price > 0 ? foreign_order.average_price : current_foreign_bid;
@@ -905,7 +1321,13 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
             if (remaining_value_usd < 50.0) {
                 exit_coin_amount = held_amount;
             } else {
-                exit_coin_amount = TradingConfig::ORDER_SIZE_USD / current_foreign_ask;
+                const auto exit_chunk = chunk_sizer.size({
+                    remaining_value_usd,
+                    usdt_rate > 0.0 ? current_korean_bid * current_korean_bid_qty / usdt_rate : 0.0,
+                    current_foreign_ask * current_foreign_ask_qty,
+                    exit_premium - dynamic_exit_threshold,
+                });
+                exit_coin_amount = exit_chunk.usd / current_foreign_ask;
                 exit_coin_amount = std::min(exit_coin_amount, held_amount);
             }
 
@@ -914,7 +1336,8 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
 
             // Cover Bybit spot-margin short first (no fill query — deferred to parallel)
             record_latency(LatencyStage::ExitForeignSubmitStart, 0, 0, exit_coin_amount, remaining_value_usd);
-            Order foreign_order = execute_foreign_cover(signal.foreign_exchange, foreign_symbol, exit_coin_amount);
+            Order foreign_order = execute_foreign_cover(signal.foreign_exchange, foreign_symbol, exit_coin_amount,
+                                                        protected_limit(current_foreign_ask, Side::Buy));
             record_latency(LatencyStage::ExitForeignSubmitAck,
                            static_cast<int64_t>(foreign_order.status),
                            0,
@@ -928,44 +1351,92 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                 continue;
             }
 
+            // An IOC leg fills only what crossed its limit: resolve it first so
+            // the Korean leg matches the actual fill
+            const bool foreign_ioc = foreign_order.type == OrderType::Limit;
+            if (foreign_ioc) {
+                query_foreign_fill(signal.foreign_exchange, foreign_order);
+                if (foreign_order.status != OrderStatus::Filled) {
+                    Logger::warn("[ADAPTIVE-EXIT] IOC cover crossed nothing inside the band, re-pricing on the next update");
+                    wait_for_next_market_update(update_seq_before_trade);
+                    continue;
+                }
+            }
+
             double actual_covered = foreign_order.quantity;
 
             std::latch fill_done(2);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Foreign,
-                signal.foreign_exchange,
-                SymbolId{},
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::ExitForeignFillQueryStart,
-                LatencyStage::ExitForeignFillWorkerStart,
-                LatencyStage::ExitForeignFillDone,
-                &foreign_order,
-                &fill_done,
-            });
+            if (foreign_ioc) {
+                fill_done.count_down();  // Fill resolved before sizing the Korean leg
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Foreign,
+                    signal.foreign_exchange,
+                    SymbolId{},
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::ExitForeignFillQueryStart,
+                    LatencyStage::ExitForeignFillWorkerStart,
+                    LatencyStage::ExitForeignFillDone,
+                    &foreign_order,
+                    &fill_done,
+                });
+            }
 
             record_latency(LatencyStage::ExitKoreanSubmitStart, 0, 0, actual_covered, current_korean_bid);
-            Order korean_order = execute_korean_sell(signal.korean_exchange, signal.symbol, actual_covered);
+            const double korean_limit = protected_limit(current_korean_bid, Side::Sell);
+            Order korean_order;
+            double split_sold = 0.0;
+            const bool sell_split = held_split_amount > 0.0;
+            if (sell_split) {
+                auto routed = sell_korean_inventory(signal.korean_exchange, signal.symbol, actual_covered,
+                                                    held_amount - held_split_amount, held_split_amount, korean_limit);
+                korean_order = std::move(routed.order);
+                split_sold = routed.split_quantity;
+            } else {
+                korean_order = execute_korean_sell(signal.korean_exchange, signal.symbol, actual_covered, korean_limit);
+            }
             record_latency(LatencyStage::ExitKoreanSubmitAck,
                            static_cast<int64_t>(korean_order.status),
                            0,
                            korean_order.quantity,
                            korean_order.average_price);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Korean,
-                signal.korean_exchange,
-                signal.symbol,
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::ExitKoreanFillQueryStart,
-                LatencyStage::ExitKoreanFillWorkerStart,
-                LatencyStage::ExitKoreanFillDone,
-                &korean_order,
-                &fill_done,
-            });
+            if (sell_split) {
+                fill_done.count_down();
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Korean,
+                    signal.korean_exchange,
+                    signal.symbol,
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::ExitKoreanFillQueryStart,
+                    LatencyStage::ExitKoreanFillWorkerStart,
+                    LatencyStage::ExitKoreanFillDone,
+                    &korean_order,
+                    &fill_done,
+                });
+            }
             fill_done.wait();
+            if (korean_order.type == OrderType::Limit) {
+                // Re-price the unsold rest on the venue still holding the coins
+                const double target = resolved_fill_quantity(foreign_order);
+                const double sold = korean_order.status == OrderStatus::Filled ? resolved_fill_quantity(korean_order) : 0.0;
+                const double primary_left = (held_amount - held_split_amount) - (sold - split_sold);
+                const bool from_split = primary_left < target - sold;
+                const double added = reprice_korean_ioc(from_split ? split_exchange : signal.korean_exchange,
+                                                        signal.symbol, Side::Sell, target, korean_order);
+                if (from_split) {
+                    split_sold += added;
+                }
+            }
+            record_fill_quality({FillAction::Exit, trace_id, trace_symbol,
+                                 signal.korean_exchange, signal.foreign_exchange,
+                                 signal.symbol, foreign_symbol, split_decided,
+                                 exit_premium, usdt_rate, current_foreign_ask, current_korean_bid},
+                                foreign_order, korean_order);
 
             if (korean_order.status == OrderStatus::Filled) {
                 double avg_korean_entry = held_amount > 0 ? total_korean_cost / held_amount : 0.0;
@@ -991,7 +1462,11 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                         const double delta = foreign_closed_qty - korean_closed_qty;
                         Order correction;
                         Logger::warn("[HEDGE] Exit foreign cover exceeds Korean sell by {:.8f}; selling delta", delta);
-                        if (!flatten_extra_korean_long(signal.korean_exchange, signal.symbol, delta, correction)) {
+                        // Sell from whichever venue still holds the coins
+                        const double primary_left = (held_amount - held_split_amount) - (korean_closed_qty - split_sold);
+                        const bool from_split = primary_left < delta && held_split_amount - split_sold >= delta;
+                        const Exchange flatten_ex = from_split ? split_exchange : signal.korean_exchange;
+                        if (!flatten_extra_korean_long(flatten_ex, signal.symbol, delta, correction)) {
                             Position mismatch;
                             mismatch.symbol = signal.symbol;
                             mismatch.korean_exchange = signal.korean_exchange;
@@ -1000,6 +1475,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                             mismatch.entry_premium = result.position.entry_premium;
                             mismatch.position_size_usd = position_size_usd;
                             mismatch.korean_amount = std::max(0.0, held_amount - korean_closed_qty);
+                            mismatch.korean_split_amount = std::clamp(held_split_amount - split_sold, 0.0, mismatch.korean_amount);
                             mismatch.foreign_amount = std::max(0.0, held_amount - foreign_closed_qty);
                             mismatch.korean_entry_price = avg_korean_entry;
                             mismatch.foreign_entry_price = avg_foreign_entry;
@@ -1015,6 +1491,9 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                         const double correction_qty = resolved_fill_quantity(correction);
                         const double correction_price = resolved_fill_price(correction, current_korean_bid);
                         korean_closed_qty += correction_qty;
+                        if (from_split) {
+                            split_sold += correction_qty;
+                        }
                         split_pnl_krw += (correction_price - avg_korean_entry) * correction_qty;
                     } else {
                         const double delta = korean_closed_qty - foreign_closed_qty;
@@ -1029,6 +1508,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                             mismatch.entry_premium = result.position.entry_premium;
                             mismatch.position_size_usd = position_size_usd;
                             mismatch.korean_amount = std::max(0.0, held_amount - korean_closed_qty);
+                            mismatch.korean_split_amount = std::clamp(held_split_amount - split_sold, 0.0, mismatch.korean_amount);
                             mismatch.foreign_amount = std::max(0.0, held_amount - foreign_closed_qty);
                             mismatch.korean_entry_price = avg_korean_entry;
                             mismatch.foreign_entry_price = avg_foreign_entry;
@@ -1057,6 +1537,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     mismatch.entry_premium = result.position.entry_premium;
                     mismatch.position_size_usd = position_size_usd;
                     mismatch.korean_amount = std::max(0.0, held_amount - korean_closed_qty);
+                    mismatch.korean_split_amount = std::clamp(held_split_amount - split_sold, 0.0, mismatch.korean_amount);
                     mismatch.foreign_amount = std::max(0.0, held_amount - foreign_closed_qty);
                     mismatch.korean_entry_price = avg_korean_entry;
                     mismatch.foreign_entry_price = avg_foreign_entry;
@@ -1085,7 +1566,9 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                 double exit_ratio = held_amount > 0 ? actual_covered / held_amount : 1.0;
                 total_korean_cost *= (1.0 - exit_ratio);
                 total_foreign_value *= (1.0 - exit_ratio);
+                borrow_interest_coins *= (1.0 - exit_ratio);
                 held_amount -= actual_covered;
+                held_split_amount = std::clamp(held_split_amount - split_sold, 0.0, std::max(held_amount, 0.0));
 
                 // Log exit split
                 Position temp_pos = result.position;
@@ -1111,10 +1594,13 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                         snap.entry_premium = calculate_effective_entry_pm(usdt_rate);
                         snap.position_size_usd = position_size_usd;
                         snap.korean_amount = held_amount;
+                        snap.korean_split_amount = held_split_amount;
                         snap.foreign_amount = held_amount;
                         snap.korean_entry_price = held_amount > 0 ? total_korean_cost / held_amount : 0.0;
                         snap.foreign_entry_price = held_amount > 0 ? total_foreign_value / held_amount : 0.0;
                         snap.realized_pnl_krw = realized_pnl_krw;
+                        snap.borrow_interest_coins = borrow_interest_coins;
+                        snap.borrow_accrued_at = borrow_accrued_at;
                         snap.is_active = true;
                         on_position_update_(&snap);
                     } else {
@@ -1153,8 +1639,10 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     total_korean_cost = 0.0;
                     total_foreign_value = 0.0;
                     realized_pnl_krw = 0.0;
+                    borrow_interest_coins = 0.0;
                     result.position.entry_time = std::chrono::system_clock::now();
                     result.position.entry_premium = 0.0;
+                    borrow_accrued_at = result.position.entry_time;
                 }
             } else {
                 // SELL failed after COVER — retry to avoid unhedged state
@@ -1167,9 +1655,19 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                 for (int retry = 1; retry <= 5; ++retry) {
                     std::this_thread::sleep_for(std::chrono::milliseconds(300 * retry));
                     Logger::warn("[ADAPTIVE-EXIT] SELL retry {}/5 for {:.8f} coins", retry, actual_covered);
-                    korean_order = execute_korean_sell(signal.korean_exchange, signal.symbol, actual_covered);
+                    split_sold = 0.0;
+                    if (held_split_amount > 0.0) {
+                        auto routed = sell_korean_inventory(signal.korean_exchange, signal.symbol, actual_covered,
+                                                            held_amount - held_split_amount, held_split_amount);
+                        korean_order = std::move(routed.order);
+                        split_sold = routed.split_quantity;
+                    } else {
+                        korean_order = execute_korean_sell(signal.korean_exchange, signal.symbol, actual_covered);
+                        if (korean_order.status == OrderStatus::Filled) {
+                            query_korean_fill(signal.korean_exchange, signal.symbol, korean_order);
+                        }
+                    }
                     if (korean_order.status == OrderStatus::Filled) {
-                        query_korean_fill(signal.korean_exchange, signal.symbol, korean_order);
                         double sell_price = korean_order.average_price;
                         if (sell_price <= 0) sell_price = current_korean_bid;
 
@@ -1184,7 +1682,9 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                         double exit_ratio = held_amount > 0 ? actual_covered / held_amount : 1.0;
                         total_korean_cost *= (1.0 - exit_ratio);
                         total_foreign_value *= (1.0 - exit_ratio);
+                        borrow_interest_coins *= (1.0 - exit_ratio);
                         held_amount -= actual_covered;
+                        held_split_amount = std::clamp(held_split_amount - split_sold, 0.0, std::max(held_amount, 0.0));
                         if (held_amount <= 0) {
                             record_latency(LatencyStage::ExitCompleted, 0, 0, actual_covered, realized_pnl_krw);
                         }
@@ -1205,6 +1705,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                     mismatch.entry_premium = result.position.entry_premium;
                     mismatch.position_size_usd = position_size_usd;
                     mismatch.korean_amount = held_amount;
+                    mismatch.korean_split_amount = held_split_amount;
                     mismatch.foreign_amount = std::max(0.0, held_amount - actual_covered);
                     mismatch.korean_entry_price = held_amount > 0 ? (total_korean_cost / held_amount) : 0.0;
                     mismatch.foreign_entry_price = held_amount > 0 ? (total_foreign_value / held_amount) : 0.0;
@@ -1230,6 +1731,8 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
             continue;
         }
 
+        record_split_round_trip(chunk_sizer, signal.korean_exchange, signal.foreign_exchange, split_start);
+
         // Event-driven post-trade wait: continue immediately on the next WS update.
         wait_for_next_market_update(update_seq_before_trade);
     }
@@ -1241,6 +1744,7 @@ ExecutionResult OrderManager::execute_spot_relay_entry(
                      signal.symbol.to_string(), held_amount);
         result.success = true;
         result.position.korean_amount = held_amount;
+        result.position.korean_split_amount = held_split_amount;
         result.position.foreign_amount = held_amount;
         result.position.korean_entry_price = held_amount > 0 ? total_korean_cost / held_amount : 0.0;
         result.position.foreign_entry_price = held_amount > 0 ? total_foreign_value / held_amount : 0.0;
@@ -1258,6 +1762,11 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
     ExecutionResult result;
     result.position = position;
 
+    // Exit legs go to the accounts holding the position
+    AccountScope account_scope;
+    account_scope.set(signal.korean_exchange, position.korean_account);
+    account_scope.set(signal.foreign_exchange, position.foreign_account);
+
     auto korean_ex = get_korean_exchange(signal.korean_exchange);
     auto foreign_ex = get_foreign_exchange(signal.foreign_exchange);
 
@@ -1297,6 +1806,9 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
     // =========================================================================
     double remaining_amount = position.foreign_amount;
     double original_amount = position.foreign_amount;
+    // Coins held on the other Korean venue from split-routed entries; sold
+    // there first. Re-entry buys stay on the signal's venue.
+    double split_remaining = std::clamp(position.korean_split_amount, 0.0, std::max(position.korean_amount, 0.0));
     double total_korean_cost = position.korean_entry_price * position.korean_amount;
     double total_foreign_value = position.foreign_entry_price * position.foreign_amount;
     double realized_pnl_krw = 0.0;
@@ -1304,6 +1816,9 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
     double total_foreign_cost = 0.0;
     double total_exited_amount = 0.0;
     double last_usdt_rate = signal.usdt_krw_rate;
+    // Borrow interest on the remaining short (coins), settled every pass
+    double borrow_interest_coins = position.borrow_interest_coins;
+    SystemTimestamp borrow_accrued_at = strategy::BorrowCostModel::accrued_since(position);
 
     auto calculate_effective_entry_pm = [&](double usdt_rate) {
         if (remaining_amount <= 0.0 || total_foreign_value <= 0.0 || usdt_rate <= 0.0) {
@@ -1339,6 +1854,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
 
     auto trigger_critical_stop = [&](const std::string& reason, const Position& snap) {
         Logger::error("[RISK-STOP] {}", reason);
+        dump_flight_recorder();
         running_.store(false, std::memory_order_release);
         if (engine_) {
             engine_->set_entry_suppressed(true);
@@ -1350,12 +1866,18 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
         result.error_message = reason;
     };
 
+    ChunkSizer chunk_sizer = make_chunk_sizer(signal.korean_exchange, signal.foreign_exchange);
+
     while (remaining_amount > 0 && running_.load(std::memory_order_acquire)) {
         // Get fresh prices from cache
         double current_foreign_bid = 0.0;
         double current_foreign_ask = signal.foreign_ask;
+        double current_foreign_bid_qty = 0.0;
+        double current_foreign_ask_qty = 0.0;
         double current_korean_ask = 0.0;
         double current_korean_bid = signal.korean_bid;
+        double current_korean_ask_qty = 0.0;
+        double current_korean_bid_qty = 0.0;
         double usdt_rate = signal.usdt_krw_rate;  // From signal (guaranteed real)
         bool quote_pair_ok = !engine_;
         if (engine_) {
@@ -1365,8 +1887,12 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
             if (quote_pair_is_usable(korean_price, foreign_price, /*is_exit=*/true)) {
                 current_foreign_bid = foreign_price.bid;
                 current_foreign_ask = foreign_price.ask;
+                current_foreign_bid_qty = foreign_price.bid_qty;
+                current_foreign_ask_qty = foreign_price.ask_qty;
                 current_korean_ask = korean_price.ask;
                 current_korean_bid = korean_price.bid;
+                current_korean_ask_qty = korean_price.ask_qty;
+                current_korean_bid_qty = korean_price.bid_qty;
                 quote_pair_ok = true;
             }
             double bithumb_usdt = cache.get_usdt_krw(Exchange::Bithumb);
@@ -1397,17 +1923,31 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
             double foreign_krw = current_foreign_bid * usdt_rate;
             entry_premium = ((current_korean_ask - foreign_krw) / foreign_krw) * 100.0;
         }
+        if (entry_premium != 0.0 && exit_premium != 0.0) {
+            chunk_sizer.observe_premium((entry_premium + exit_premium) * 0.5,
+                                        std::chrono::steady_clock::now().time_since_epoch().count());
+        }
+
+        // Borrow interest since the last pass at the venue's current rate
+        {
+            const auto now = std::chrono::system_clock::now();
+            const double borrow_rate = engine_ ? engine_->get_borrow_rate(position.foreign_exchange, position.symbol) : 0.0;
+            borrow_interest_coins += strategy::BorrowCostModel::interest_coins(
+                remaining_amount, borrow_rate, strategy::BorrowCostModel::hours_between(borrow_accrued_at, now));
+            borrow_accrued_at = std::max(borrow_accrued_at, now);
+        }
 
-        // Dynamic exit threshold with a hard floor (+0.10% by default)
+        // Dynamic exit threshold with a hard floor, raised by accrued borrow interest
         double dynamic_exit_threshold = TradingConfig::EXIT_PREMIUM_THRESHOLD;
         if (remaining_amount > 0 && total_foreign_value > 0 && usdt_rate > 0) {
             double effective_entry_pm = calculate_effective_entry_pm(usdt_rate);
-            dynamic_exit_threshold = std::max(
-                effective_entry_pm + TradingConfig::DYNAMIC_EXIT_SPREAD,
-                TradingConfig::EXIT_PREMIUM_THRESHOLD);
+            dynamic_exit_threshold = TradingConfig::dynamic_exit_threshold(
+                effective_entry_pm, borrow_interest_coins / remaining_amount * 100.0);
         }
 
         const uint64_t update_seq_before_trade = engine_ ? engine_->get_update_seq() : 0;
+        const auto split_start = std::chrono::steady_clock::now();
+        const auto split_decided = std::chrono::system_clock::now();
 
         if (exit_premium >= dynamic_exit_threshold) {
             // ==================== EXIT SPLIT ====================
@@ -1421,13 +1961,20 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
             if (remaining_value_usd < 50.0) {
                 exit_coin_amount = remaining_amount;
             } else {
-                exit_coin_amount = TradingConfig::ORDER_SIZE_USD / current_foreign_ask;
+                const auto exit_chunk = chunk_sizer.size({
+                    remaining_value_usd,
+                    usdt_rate > 0.0 ? current_korean_bid * current_korean_bid_qty / usdt_rate : 0.0,
+                    current_foreign_ask * current_foreign_ask_qty,
+                    exit_premium - dynamic_exit_threshold,
+                });
+                exit_coin_amount = exit_chunk.usd / current_foreign_ask;
                 exit_coin_amount = std::min(exit_coin_amount, remaining_amount);
             }
 
             // Cover Bybit spot-margin short first (no fill query — deferred to parallel)
             record_latency(LatencyStage::ExitForeignSubmitStart, 0, 0, exit_coin_amount, remaining_value_usd);
-            Order foreign_order = execute_foreign_cover(signal.foreign_exchange, foreign_symbol, exit_coin_amount);
+            Order foreign_order = execute_foreign_cover(signal.foreign_exchange, foreign_symbol, exit_coin_amount,
+                                                        protected_limit(current_foreign_ask, Side::Buy));
             record_latency(LatencyStage::ExitForeignSubmitAck,
                            static_cast<int64_t>(foreign_order.status),
                            0,
@@ -1441,44 +1988,109 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 continue;
             }
 
+            // An IOC leg fills only what crossed its limit: resolve it first so
+            // the Korean leg matches the actual fill
+            const bool foreign_ioc = foreign_order.type == OrderType::Limit;
+            if (foreign_ioc) {
+                query_foreign_fill(signal.foreign_exchange, foreign_order);
+                if (foreign_order.status != OrderStatus::Filled) {
+                    Logger::warn("[ADAPTIVE-EXIT] IOC cover crossed nothing inside the band, re-pricing on the next update");
+                    wait_for_next_market_update(update_seq_before_trade);
+                    continue;
+                }
+            }
+
             double actual_covered = foreign_order.quantity;
 
             std::latch fill_done(2);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Foreign,
-                signal.foreign_exchange,
-                SymbolId{},
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::ExitForeignFillQueryStart,
-                LatencyStage::ExitForeignFillWorkerStart,
-                LatencyStage::ExitForeignFillDone,
-                &foreign_order,
-                &fill_done,
-            });
+            if (foreign_ioc) {
+                fill_done.count_down();  // Fill resolved before sizing the Korean leg
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Foreign,
+                    signal.foreign_exchange,
+                    SymbolId{},
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::ExitForeignFillQueryStart,
+                    LatencyStage::ExitForeignFillWorkerStart,
+                    LatencyStage::ExitForeignFillDone,
+                    &foreign_order,
+                    &fill_done,
+                });
+            }
 
             record_latency(LatencyStage::ExitKoreanSubmitStart, 0, 0, actual_covered, current_korean_bid);
-            Order korean_order = execute_korean_sell(signal.korean_exchange, position.symbol, actual_covered);
+            const double korean_limit = protected_limit(current_korean_bid, Side::Sell);
+            Order korean_order;
+            double split_sold = 0.0;
+            const bool sell_split = split_remaining > 0.0;
+            if (sell_split) {
+                auto routed = sell_korean_inventory(signal.korean_exchange, position.symbol, actual_covered,
+                                                    remaining_amount - split_remaining, split_remaining, korean_limit);
+                korean_order = std::move(routed.order);
+                split_sold = routed.split_quantity;
+            } else {
+                korean_order = execute_korean_sell(signal.korean_exchange, position.symbol, actual_covered, korean_limit);
+            }
             record_latency(LatencyStage::ExitKoreanSubmitAck,
                            static_cast<int64_t>(korean_order.status),
                            0,
                            korean_order.quantity,
                            korean_order.average_price);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Korean,
-                signal.korean_exchange,
-                position.symbol,
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::ExitKoreanFillQueryStart,
-                LatencyStage::ExitKoreanFillWorkerStart,
-                LatencyStage::ExitKoreanFillDone,
-                &korean_order,
-                &fill_done,
-            });
+            if (sell_split) {
+                fill_done.count_down();
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Korean,
+                    signal.korean_exchange,
+                    position.symbol,
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::ExitKoreanFillQueryStart,
+                    LatencyStage::ExitKoreanFillWorkerStart,
+                    LatencyStage::ExitKoreanFillDone,
+                    &korean_order,
+                    &fill_done,
+                });
+            }
             fill_done.wait();
+            if (korean_order.type == OrderType::Limit) {
+                // This loop has no exit delta hedge: re-price the unsold rest, then
+                // sell what still misses at market so both legs close the same size
+                const double target = resolved_fill_quantity(foreign_order);
+                const Exchange split_exchange = KoreanLegRouter::other_venue(signal.korean_exchange);
+                auto sell_venue = [&](double sold_now) {
+                    const double primary_left = (remaining_amount - split_remaining) - (sold_now - split_sold);
+                    return primary_left < target - sold_now ? split_exchange : signal.korean_exchange;
+                };
+                auto sold = [&]() {
+                    return korean_order.status == OrderStatus::Filled ? resolved_fill_quantity(korean_order) : 0.0;
+                };
+                Exchange venue = sell_venue(sold());
+                const double repriced = reprice_korean_ioc(venue, position.symbol, Side::Sell, target, korean_order);
+                if (venue == split_exchange) {
+                    split_sold += repriced;
+                }
+                const double before = sold();
+                if (before < target && !quantities_match(before, target)) {
+                    venue = sell_venue(before);
+                    Order rest;
+                    if (flatten_extra_korean_long(venue, position.symbol, target - before, rest)) {
+                        merge_fill(korean_order, rest, before, current_korean_bid);
+                        if (venue == split_exchange) {
+                            split_sold += resolved_fill_quantity(rest);
+                        }
+                    }
+                }
+            }
+            record_fill_quality({FillAction::Exit, trace_id, trace_symbol,
+                                 signal.korean_exchange, signal.foreign_exchange,
+                                 position.symbol, foreign_symbol, split_decided,
+                                 exit_premium, usdt_rate, current_foreign_ask, current_korean_bid},
+                                foreign_order, korean_order);
 
             if (korean_order.status == OrderStatus::Filled) {
                 if (foreign_order.filled_quantity > 0) actual_covered = foreign_order.filled_quantity;
@@ -1512,7 +2124,9 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 double exit_ratio = actual_covered / remaining_amount;
                 total_korean_cost *= (1.0 - exit_ratio);
                 total_foreign_value *= (1.0 - exit_ratio);
+                borrow_interest_coins *= (1.0 - exit_ratio);
                 remaining_amount -= actual_covered;
+                split_remaining = std::clamp(split_remaining - split_sold, 0.0, std::max(remaining_amount, 0.0));
 
                 bool final_split = remaining_amount <= 0;
                 Position log_pos = position;
@@ -1532,11 +2146,14 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                     if (remaining_amount > 0) {
                         Position snap = position;
                         snap.korean_amount = remaining_amount;
+                        snap.korean_split_amount = std::min(split_remaining, snap.korean_amount);
                         snap.foreign_amount = remaining_amount;
                         snap.korean_entry_price = total_korean_cost / remaining_amount;
                         snap.foreign_entry_price = total_foreign_value / remaining_amount;
                         snap.entry_premium = calculate_effective_entry_pm(usdt_rate);
                         snap.realized_pnl_krw = realized_pnl_krw;
+                        snap.borrow_interest_coins = borrow_interest_coins;
+                        snap.borrow_accrued_at = borrow_accrued_at;
                         on_position_update_(&snap);
                     } else {
                         on_position_update_(nullptr);
@@ -1552,9 +2169,19 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 for (int retry = 1; retry <= 5; ++retry) {
                     std::this_thread::sleep_for(std::chrono::milliseconds(300 * retry));
                     Logger::warn("[EXIT] SELL retry {}/5 for {:.8f} coins", retry, actual_covered);
-                    korean_order = execute_korean_sell(signal.korean_exchange, position.symbol, actual_covered);
+                    split_sold = 0.0;
+                    if (split_remaining > 0.0) {
+                        auto routed = sell_korean_inventory(signal.korean_exchange, position.symbol, actual_covered,
+                                                            remaining_amount - split_remaining, split_remaining);
+                        korean_order = std::move(routed.order);
+                        split_sold = routed.split_quantity;
+                    } else {
+                        korean_order = execute_korean_sell(signal.korean_exchange, position.symbol, actual_covered);
+                        if (korean_order.status == OrderStatus::Filled) {
+                            query_korean_fill(signal.korean_exchange, position.symbol, korean_order);
+                        }
+                    }
                     if (korean_order.status == OrderStatus::Filled) {
-                        query_korean_fill(signal.korean_exchange, position.symbol, korean_order);
                         double sell_price = korean_order.average_price;
                         if (sell_price <= 0) sell_price = current_korean_bid;
 
@@ -1573,7 +2200,9 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                         double exit_ratio = actual_covered / remaining_amount;
                         total_korean_cost *= (1.0 - exit_ratio);
                         total_foreign_value *= (1.0 - exit_ratio);
+                        borrow_interest_coins *= (1.0 - exit_ratio);
                         remaining_amount -= actual_covered;
+                        split_remaining = std::clamp(split_remaining - split_sold, 0.0, std::max(remaining_amount, 0.0));
                         if (remaining_amount <= 0) {
                             record_latency(LatencyStage::ExitCompleted, 0, 0, actual_covered, realized_pnl_krw);
                         }
@@ -1588,6 +2217,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                                   "UNHEDGED {:.8f} coins — MANUAL INTERVENTION REQUIRED", actual_covered);
                     Position mismatch = position;
                     mismatch.korean_amount = remaining_amount;
+                    mismatch.korean_split_amount = std::min(split_remaining, mismatch.korean_amount);
                     mismatch.foreign_amount = std::max(0.0, remaining_amount - actual_covered);
                     mismatch.korean_entry_price = remaining_amount > 0 ? (total_korean_cost / remaining_amount) : 0.0;
                     mismatch.foreign_entry_price = remaining_amount > 0 ? (total_foreign_value / remaining_amount) : 0.0;
@@ -1607,12 +2237,19 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
             // ==================== RE-ENTRY SPLIT ====================
             record_latency(LatencyStage::ReentryLoopStart, 0, 0, entry_premium, remaining_amount);
             double max_reentry_coins = original_amount - remaining_amount;
-            double reentry_usd = std::min(TradingConfig::ORDER_SIZE_USD, max_reentry_coins * current_foreign_bid);
+            const auto reentry_chunk = chunk_sizer.size({
+                max_reentry_coins * current_foreign_bid,
+                usdt_rate > 0.0 ? current_korean_ask * current_korean_ask_qty / usdt_rate : 0.0,
+                current_foreign_bid * current_foreign_bid_qty,
+                TradingConfig::ENTRY_PREMIUM_THRESHOLD - entry_premium,
+            });
+            double reentry_usd = reentry_chunk.usd;
             double coin_amount = reentry_usd / current_foreign_bid;
 
             // Open Bybit spot-margin short first (no fill query — deferred to parallel)
             record_latency(LatencyStage::ReentryForeignSubmitStart, 0, 0, coin_amount, reentry_usd);
-            Order foreign_order = execute_foreign_short(signal.foreign_exchange, foreign_symbol, coin_amount);
+            Order foreign_order = execute_foreign_short(signal.foreign_exchange, foreign_symbol, coin_amount,
+                                                        protected_limit(current_foreign_bid, Side::Sell));
             record_latency(LatencyStage::ReentryForeignSubmitAck,
                            static_cast<int64_t>(foreign_order.status),
                            0,
@@ -1626,6 +2263,18 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 continue;
             }
 
+            // An IOC leg fills only what crossed its limit: resolve it first so
+            // the Korean leg matches the actual fill
+            const bool foreign_ioc = foreign_order.type == OrderType::Limit;
+            if (foreign_ioc) {
+                query_foreign_fill(signal.foreign_exchange, foreign_order);
+                if (foreign_order.status != OrderStatus::Filled) {
+                    Logger::warn("[ADAPTIVE-REENTRY] IOC short crossed nothing inside the band, re-pricing on the next update");
+                    wait_for_next_market_update(update_seq_before_trade);
+                    continue;
+                }
+            }
+
             double actual_filled = foreign_order.quantity;
             double krw_amount = actual_filled * current_korean_ask;
 
@@ -1635,6 +2284,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 if (rollback.status != OrderStatus::Filled) {
                     Position mismatch = position;
                     mismatch.korean_amount = remaining_amount;
+                    mismatch.korean_split_amount = std::min(split_remaining, mismatch.korean_amount);
                     mismatch.foreign_amount = remaining_amount + actual_filled;
                     mismatch.korean_entry_price = remaining_amount > 0 ? (total_korean_cost / remaining_amount) : 0.0;
                     double short_price = foreign_order.average_price > 0 ? foreign_order.average_price : current_foreign_bid;
@@ -1655,22 +2305,27 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
             }
 
             std::latch fill_done(2);
-            dispatch_fill_query(FillQueryTask{
-                FillQueryTask::Kind::Foreign,
-                signal.foreign_exchange,
-                SymbolId{},
-                trace_id,
-                trace_start_ns,
-                trace_symbol,
-                LatencyStage::ReentryForeignFillQueryStart,
-                LatencyStage::ReentryForeignFillWorkerStart,
-                LatencyStage::ReentryForeignFillDone,
-                &foreign_order,
-                &fill_done,
-            });
+            if (foreign_ioc) {
+                fill_done.count_down();  // Fill resolved before sizing the Korean leg
+            } else {
+                dispatch_fill_query(FillQueryTask{
+                    FillQueryTask::Kind::Foreign,
+                    signal.foreign_exchange,
+                    SymbolId{},
+                    trace_id,
+                    trace_start_ns,
+                    trace_symbol,
+                    LatencyStage::ReentryForeignFillQueryStart,
+                    LatencyStage::ReentryForeignFillWorkerStart,
+                    LatencyStage::ReentryForeignFillDone,
+                    &foreign_order,
+                    &fill_done,
+                });
+            }
 
             record_latency(LatencyStage::ReentryKoreanSubmitStart, 0, 0, actual_filled, krw_amount);
-            Order korean_order = execute_korean_buy(signal.korean_exchange, position.symbol, actual_filled, krw_amount);
+            Order korean_order = execute_korean_buy(signal.korean_exchange, position.symbol, actual_filled, krw_amount,
+                                                    protected_limit(current_korean_ask, Side::Buy));
             record_latency(LatencyStage::ReentryKoreanSubmitAck,
                            static_cast<int64_t>(korean_order.status),
                            0,
@@ -1690,6 +2345,15 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 &fill_done,
             });
             fill_done.wait();
+            if (korean_order.type == OrderType::Limit) {
+                reprice_korean_ioc(signal.korean_exchange, position.symbol, Side::Buy,
+                                   resolved_fill_quantity(foreign_order), korean_order);
+            }
+            record_fill_quality({FillAction::Reentry, trace_id, trace_symbol,
+                                 signal.korean_exchange, signal.foreign_exchange,
+                                 position.symbol, foreign_symbol, split_decided,
+                                 entry_premium, usdt_rate, current_foreign_bid, current_korean_ask},
+                                foreign_order, korean_order);
 
             if (korean_order.status == OrderStatus::Filled) {
                 double short_price = resolved_fill_price(foreign_order, current_foreign_bid);
@@ -1713,6 +2377,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                         if (!flatten_extra_foreign_short(signal.foreign_exchange, foreign_symbol, delta, correction)) {
                             Position mismatch = position;
                             mismatch.korean_amount = remaining_amount + korean_open_qty;
+                            mismatch.korean_split_amount = std::min(split_remaining, mismatch.korean_amount);
                             mismatch.foreign_amount = remaining_amount + foreign_open_qty;
                             mismatch.korean_entry_price = (remaining_amount + korean_open_qty) > 0.0
                                 ? (total_korean_cost + (korean_open_qty * buy_price)) / (remaining_amount + korean_open_qty)
@@ -1741,6 +2406,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                         if (!flatten_extra_korean_long(signal.korean_exchange, position.symbol, delta, correction)) {
                             Position mismatch = position;
                             mismatch.korean_amount = remaining_amount + korean_open_qty;
+                            mismatch.korean_split_amount = std::min(split_remaining, mismatch.korean_amount);
                             mismatch.foreign_amount = remaining_amount + foreign_open_qty;
                             mismatch.korean_entry_price = (remaining_amount + korean_open_qty) > 0.0
                                 ? (total_korean_cost + (korean_open_qty * buy_price)) / (remaining_amount + korean_open_qty)
@@ -1768,6 +2434,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 if (!quantities_match(foreign_open_qty, korean_open_qty)) {
                     Position mismatch = position;
                     mismatch.korean_amount = remaining_amount + korean_open_qty;
+                    mismatch.korean_split_amount = std::min(split_remaining, mismatch.korean_amount);
                     mismatch.foreign_amount = remaining_amount + foreign_open_qty;
                     mismatch.korean_entry_price = (remaining_amount + korean_open_qty) > 0.0
                         ? (total_korean_cost + (korean_open_qty * buy_price)) / (remaining_amount + korean_open_qty)
@@ -1816,11 +2483,14 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 if (on_position_update_) {
                     Position snap = position;
                     snap.korean_amount = remaining_amount;
+                    snap.korean_split_amount = std::min(split_remaining, snap.korean_amount);
                     snap.foreign_amount = remaining_amount;
                     snap.korean_entry_price = total_korean_cost / remaining_amount;
                     snap.foreign_entry_price = total_foreign_value / remaining_amount;
                     snap.entry_premium = calculate_effective_entry_pm(usdt_rate);
                     snap.realized_pnl_krw = realized_pnl_krw;
+                    snap.borrow_interest_coins = borrow_interest_coins;
+                    snap.borrow_accrued_at = borrow_accrued_at;
                     on_position_update_(&snap);
                 }
             } else {
@@ -1831,6 +2501,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
                 if (rollback.status != OrderStatus::Filled) {
                     Position mismatch = position;
                     mismatch.korean_amount = remaining_amount;
+                    mismatch.korean_split_amount = std::min(split_remaining, mismatch.korean_amount);
                     mismatch.foreign_amount = remaining_amount + actual_filled;
                     mismatch.korean_entry_price = remaining_amount > 0 ? (total_korean_cost / remaining_amount) : 0.0;
                     double short_price = foreign_order.average_price > 0 ? foreign_order.average_price : current_foreign_bid;
@@ -1859,6 +2530,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
             continue;
         }
 
+        record_split_round_trip(chunk_sizer, signal.korean_exchange, signal.foreign_exchange, split_start);
         wait_for_next_market_update(update_seq_before_trade);
     }
 
@@ -1867,6 +2539,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
         Logger::warn("[ADAPTIVE-EXIT] Shutdown during exit, remaining: {:.8f} coins", remaining_amount);
         result.success = false;
         result.position.korean_amount = remaining_amount;
+        result.position.korean_split_amount = std::min(split_remaining, remaining_amount);
         result.position.foreign_amount = remaining_amount;
         if (remaining_amount > 0) {
             result.position.korean_entry_price = total_korean_cost / remaining_amount;
@@ -1897,8 +2570,7 @@ ExecutionResult OrderManager::execute_spot_relay_exit(const ExitSignal& signal,
 }
 
 bool OrderManager::prepare_bybit_shorting(const std::vector<SymbolId>& symbols) {
-    auto bybit = get_bybit_exchange();
-    if (!bybit) {
+    if (!get_bybit_exchange()) {
         Logger::warn("Bybit preparation skipped: exchange not available");
         return false;
     }
@@ -1916,11 +2588,23 @@ bool OrderManager::prepare_bybit_shorting(const std::vector<SymbolId>& symbols)
         unique_symbols.emplace_back("BTC", "USDT");
     }
 
-    for (const auto& symbol : unique_symbols) {
-        if (!bybit->prepare_shorting(symbol)) {
-            Logger::error("Failed to prepare Bybit spot-margin shorting for {}", symbol.to_string());
+    // Every account: a lifecycle may short on any of them
+    const std::size_t accounts = std::max<std::size_t>(accounts_.count(Exchange::Bybit), 1);
+    for (std::size_t account = 0; account < accounts; ++account) {
+        AccountScope account_scope;
+        account_scope.set(Exchange::Bybit, static_cast<uint8_t>(account));
+        auto bybit = get_bybit_exchange();
+        if (!bybit) {
+            Logger::error("Bybit account {} not available for shorting", account);
             return false;
         }
+        for (const auto& symbol : unique_symbols) {
+            if (!bybit->prepare_shorting(symbol)) {
+                Logger::error("Failed to prepare Bybit spot-margin shorting for {} (account {})",
+                              symbol.to_string(), account);
+                return false;
+            }
+        }
     }
 
     Logger::info("Prepared Bybit spot-margin shorting for {} symbols", unique_symbols.size());
@@ -1928,8 +2612,7 @@ bool OrderManager::prepare_bybit_shorting(const std::vector<SymbolId>& symbols)
 }
 
 bool OrderManager::prepare_okx_shorting(const std::vector<SymbolId>& symbols) {
-    auto okx = get_okx_exchange();
-    if (!okx) {
+    if (!get_okx_exchange()) {
         Logger::warn("OKX preparation skipped: exchange not available");
         return false;
     }
@@ -1947,65 +2630,641 @@ bool OrderManager::prepare_okx_shorting(const std::vector<SymbolId>& symbols) {
         unique_symbols.emplace_back("BTC", "USDT");
     }
 
-    for (const auto& symbol : unique_symbols) {
-        if (!okx->prepare_shorting(symbol)) {
-            Logger::error("Failed to prepare OKX spot-margin shorting for {}", symbol.to_string());
+    // Every account: a lifecycle may short on any of them
+    const std::size_t accounts = std::max<std::size_t>(accounts_.count(Exchange::OKX), 1);
+    for (std::size_t account = 0; account < accounts; ++account) {
+        AccountScope account_scope;
+        account_scope.set(Exchange::OKX, static_cast<uint8_t>(account));
+        auto okx = get_okx_exchange();
+        if (!okx) {
+            Logger::error("OKX account {} not available for shorting", account);
             return false;
         }
+        for (const auto& symbol : unique_symbols) {
+            if (!okx->prepare_shorting(symbol)) {
+                Logger::error("Failed to prepare OKX spot-margin shorting for {} (account {})",
+                              symbol.to_string(), account);
+                return false;
+            }
+        }
     }
 
     Logger::info("Prepared OKX spot-margin shorting for {} symbols", unique_symbols.size());
     return true;
 }
 
-Order OrderManager::execute_korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount) {
-    auto korean_ex = get_korean_exchange(ex);
-    if (!korean_ex) {
-        Order order;
+Order OrderManager::execute_korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount,
+                                       double limit_price) {
+    FlightRecorder::record(FlightEventType::LegSubmit, ex, symbol, 0, quantity, limit_price, krw_amount, 0.0,
+                           static_cast<uint8_t>(Side::Buy));
+    const auto submit_start = std::chrono::steady_clock::now();
+    const auto sent = std::chrono::system_clock::now();
+    const bool ioc = limit_price > 0.0 && supports_ioc(ex);
+    Order order;
+    if (backend_) {
+        order = ioc ? backend_->korean_buy_ioc(ex, symbol, quantity, limit_price)
+                    : backend_->korean_buy(ex, symbol, quantity, krw_amount);
+    } else if (auto korean_ex = get_korean_exchange(ex)) {
+        consume_order_budget(ex);
+        if (ioc) {
+            order = korean_ex->place_ioc_order(symbol, Side::Buy, quantity, limit_price);
+        } else if (auto bithumb = ex == Exchange::Bithumb ? get_bithumb_exchange() : nullptr) {
+            order = bithumb->place_market_buy_quantity(symbol, quantity);
+        } else {
+            order = korean_ex->place_market_buy_cost(symbol, krw_amount);
+        }
+        if (order.status == OrderStatus::Unknown) {
+            reconcile_unknown_submit(*korean_ex, order, false);
+        }
+    } else {
         order.status = OrderStatus::Rejected;
-        return order;
     }
+    order.create_time = sent;
+    order.update_time = std::chrono::system_clock::now();  // Ack; fill queries keep it
+    record_leg_latency(ex, submit_start, order);
+    return order;
+}
 
-    if (ex == Exchange::Bithumb) {
-        if (bithumb_exchange_) {
-            return bithumb_exchange_->place_market_buy_quantity(symbol, quantity);
+Order OrderManager::execute_foreign_short(Exchange ex, const SymbolId& symbol, double quantity,
+                                          double limit_price) {
+    FlightRecorder::record(FlightEventType::LegSubmit, ex, symbol, 0, quantity, limit_price, 0.0, 0.0,
+                           static_cast<uint8_t>(Side::Sell));
+    const auto submit_start = std::chrono::steady_clock::now();
+    const auto sent = std::chrono::system_clock::now();
+    const bool ioc = limit_price > 0.0 && supports_ioc(ex);
+    Order order;
+    if (backend_) {
+        order = ioc ? backend_->foreign_short_ioc(ex, symbol, quantity, limit_price)
+                    : backend_->foreign_short(ex, symbol, quantity);
+    } else if (auto short_ex = get_foreign_exchange(ex)) {
+        consume_order_budget(ex);
+        order = ioc ? short_ex->open_short_ioc(symbol, quantity, limit_price)
+                    : short_ex->open_short(symbol, quantity);
+        if (order.status == OrderStatus::Unknown) {
+            reconcile_unknown_submit(*short_ex, order, false);
         }
+    } else {
+        order.status = OrderStatus::Rejected;
     }
+    order.create_time = sent;
+    order.update_time = std::chrono::system_clock::now();  // Ack; fill queries keep it
+    record_leg_latency(ex, submit_start, order);
+    return order;
+}
 
-    return korean_ex->place_market_buy_cost(symbol, krw_amount);
+Order OrderManager::execute_korean_sell(Exchange ex, const SymbolId& symbol, double quantity,
+                                        double limit_price) {
+    FlightRecorder::record(FlightEventType::LegSubmit, ex, symbol, 0, quantity, limit_price, 0.0, 0.0,
+                           static_cast<uint8_t>(Side::Sell));
+    const auto submit_start = std::chrono::steady_clock::now();
+    const auto sent = std::chrono::system_clock::now();
+    const bool ioc = limit_price > 0.0 && supports_ioc(ex);
+    Order order;
+    if (backend_) {
+        order = ioc ? backend_->korean_sell_ioc(ex, symbol, quantity, limit_price)
+                    : backend_->korean_sell(ex, symbol, quantity);
+    } else if (auto korean_ex = get_korean_exchange(ex)) {
+        consume_order_budget(ex);
+        order = ioc ? korean_ex->place_ioc_order(symbol, Side::Sell, quantity, limit_price)
+                    : korean_ex->place_market_order(symbol, Side::Sell, quantity);
+        if (order.status == OrderStatus::Unknown) {
+            reconcile_unknown_submit(*korean_ex, order, false);
+        }
+    } else {
+        order.status = OrderStatus::Rejected;
+    }
+    order.create_time = sent;
+    order.update_time = std::chrono::system_clock::now();  // Ack; fill queries keep it
+    record_leg_latency(ex, submit_start, order);
+    return order;
 }
 
-Order OrderManager::execute_foreign_short(Exchange ex, const SymbolId& symbol, double quantity) {
-    auto short_ex = get_foreign_exchange(ex);
-    if (!short_ex) {
-        Order order;
+Order OrderManager::execute_foreign_cover(Exchange ex, const SymbolId& symbol, double quantity,
+                                          double limit_price) {
+    FlightRecorder::record(FlightEventType::LegSubmit, ex, symbol, 0, quantity, limit_price, 0.0, 0.0,
+                           static_cast<uint8_t>(Side::Buy));
+    const auto submit_start = std::chrono::steady_clock::now();
+    const auto sent = std::chrono::system_clock::now();
+    const bool ioc = limit_price > 0.0 && supports_ioc(ex);
+    Order order;
+    if (backend_) {
+        order = ioc ? backend_->foreign_cover_ioc(ex, symbol, quantity, limit_price)
+                    : backend_->foreign_cover(ex, symbol, quantity);
+    } else if (auto short_ex = get_foreign_exchange(ex)) {
+        consume_order_budget(ex);
+        order = ioc ? short_ex->close_short_ioc(symbol, quantity, limit_price)
+                    : short_ex->close_short(symbol, quantity);
+        if (order.status == OrderStatus::Unknown) {
+            reconcile_unknown_submit(*short_ex, order, false);
+        }
+    } else {
         order.status = OrderStatus::Rejected;
-        return order;
     }
+    order.create_time = sent;
+    order.update_time = std::chrono::system_clock::now();  // Ack; fill queries keep it
+    record_leg_latency(ex, submit_start, order);
+    return order;
+}
 
-    return short_ex->open_short(symbol, quantity);
+void OrderManager::reconcile_unknown_submit(exchange::IExchange& venue, Order& order, bool resting) {
+    static constexpr auto MAX_BACKOFF = std::chrono::milliseconds(2000);
+    auto backoff = std::chrono::milliseconds(100);
+    const char* venue_name = exchange_name(order.exchange);
+    for (int lookups = 1;; ++lookups) {
+        const auto reply = venue.lookup_client_order(order);
+        if (reply == exchange::LookupReply::NotFound) {
+            order.status = OrderStatus::Rejected;
+            Logger::warn("[SUBMIT] {} {} not at the venue after {} lookup(s): leg may be sent again",
+                         venue_name, order.client_id, lookups);
+            return;
+        }
+        if (reply == exchange::LookupReply::Found) {
+            if (resting) {
+                if (order.status == OrderStatus::Cancelled || order.status == OrderStatus::Expired) {
+                    order.status = OrderStatus::Rejected;  // Would have crossed
+                } else if (order.status != OrderStatus::Rejected && order.status != OrderStatus::PartiallyFilled) {
+                    order.status = OrderStatus::New;
+                }
+            } else if (order.status != OrderStatus::Rejected) {
+                order.status = OrderStatus::Filled;  // Accepted; the fill query tells what traded
+            }
+            Logger::warn("[SUBMIT] {} {} reconciled by client id after {} lookup(s): order {}",
+                         venue_name, order.client_id, lookups, order.order_id_str);
+            return;
+        }
+        if (!running_.load(std::memory_order_acquire)) {
+            Logger::error("[SUBMIT] {} {} still unknown at shutdown: check the venue for this client id",
+                          venue_name, order.client_id);
+            return;
+        }
+        if (lookups % 10 == 0) {
+            Logger::error("[SUBMIT] {} {} still unknown after {} lookups, holding the leg",
+                          venue_name, order.client_id, lookups);
+        }
+        std::this_thread::sleep_for(backoff);
+        backoff = std::min(backoff * 2, MAX_BACKOFF);
+    }
 }
 
-Order OrderManager::execute_korean_sell(Exchange ex, const SymbolId& symbol, double quantity) {
-    auto korean_ex = get_korean_exchange(ex);
-    if (!korean_ex) {
-        Order order;
-        order.status = OrderStatus::Rejected;
-        return order;
+bool OrderManager::supports_ioc(Exchange ex) const {
+    if (backend_) {
+        return backend_->supports_ioc(ex);
     }
+    const auto& exchange = exchanges_[static_cast<size_t>(ex)];
+    return exchange && exchange->supports_ioc();
+}
 
-    return korean_ex->place_market_order(symbol, Side::Sell, quantity);
+double OrderManager::protected_limit(double quote, Side side) const noexcept {
+    if (!price_protection_.enabled || quote <= 0.0) {
+        return 0.0;
+    }
+    return price_protection_.limit(quote, side);
 }
 
-Order OrderManager::execute_foreign_cover(Exchange ex, const SymbolId& symbol, double quantity) {
-    auto short_ex = get_foreign_exchange(ex);
-    if (!short_ex) {
-        Order order;
+double OrderManager::reprice_korean_ioc(Exchange ex, const SymbolId& symbol, Side side, double target,
+                                        Order& order) {
+    const bool buy = side == Side::Buy;
+    double added = 0.0;
+    for (int attempt = 0; attempt < price_protection_.reprice_attempts && engine_; ++attempt) {
+        const double filled = order.status == OrderStatus::Filled ? resolved_fill_quantity(order) : 0.0;
+        const double remaining = target - filled;
+        if (remaining <= 0.0 || quantities_match(filled, target)) {
+            break;
+        }
+        const auto quote = engine_->get_price_cache().get_price(ex, symbol);
+        const double limit = protected_limit(buy ? quote.ask : quote.bid, side);
+        if (limit <= 0.0 || remaining * limit < TradingConfig::MIN_ORDER_KRW) {
+            break;
+        }
+        Order child = buy ? execute_korean_buy(ex, symbol, remaining, remaining * limit, limit)
+                          : execute_korean_sell(ex, symbol, remaining, limit);
+        if (child.status != OrderStatus::Filled) {
+            break;
+        }
+        query_korean_fill(ex, symbol, child);
+        const double qty = child.status == OrderStatus::Filled ? resolved_fill_quantity(child) : 0.0;
+        Logger::info("[PRICE-GUARD] {} {} re-price {}/{}: {:.8f}/{:.8f} @ limit {:.2f}",
+                     buy ? "BUY" : "SELL", symbol.to_string(), attempt + 1, price_protection_.reprice_attempts,
+                     qty, remaining, limit);
+        if (qty > 0.0) {
+            merge_fill(order, child, filled, limit);
+            added += qty;
+        }
+    }
+    return added;
+}
+
+Order OrderManager::execute_korean_post_only(Exchange ex, const SymbolId& symbol, Side side, double quantity,
+                                             double price) {
+    FlightRecorder::record(FlightEventType::LegSubmit, ex, symbol, 0, quantity, price, 0.0, 0.0,
+                           static_cast<uint8_t>(side));
+    const auto submit_start = std::chrono::steady_clock::now();
+    const auto sent = std::chrono::system_clock::now();
+    Order order;
+    if (backend_) {
+        order = backend_->korean_post_only(ex, symbol, side, quantity, price);
+    } else if (auto korean_ex = get_korean_exchange(ex)) {
+        consume_order_budget(ex);
+        order = korean_ex->place_post_only_order(symbol, side, quantity, price);
+        if (order.status == OrderStatus::Unknown) {
+            reconcile_unknown_submit(*korean_ex, order, true);
+        }
+    } else {
         order.status = OrderStatus::Rejected;
-        return order;
     }
+    order.create_time = sent;
+    order.update_time = std::chrono::system_clock::now();  // Ack; fills move it forward
+    record_leg_latency(ex, submit_start, order);
+    return order;
+}
 
-    return short_ex->close_short(symbol, quantity);
+bool OrderManager::poll_resting(Exchange ex, Order& order) {
+    if (backend_) {
+        return backend_->poll_resting(ex, order);
+    }
+    auto upbit = ex == Exchange::Upbit ? get_upbit_exchange() : nullptr;
+    if (!upbit) {
+        return false;
+    }
+    // myOrder stream first; REST only while the stream has nothing on it
+    const double before = order.filled_quantity;
+    std::string state;
+    if (!upbit->stream_order_update(order.order_id_str, order, &state) &&
+        !upbit->refresh_order(order.order_id_str, order, &state)) {
+        return true;  // Unknown this round: still resting as far as we know
+    }
+    if (order.filled_quantity > before) {
+        order.update_time = std::chrono::system_clock::now();
+    }
+    const bool resting = state == "wait" || state == "watch" || state == "trade";
+    if (!resting) {
+        upbit->forget_order_update(order.order_id_str);
+    }
+    return resting;
+}
+
+bool OrderManager::cancel_resting(Exchange ex, Order& order) {
+    if (backend_) {
+        return backend_->cancel_resting(ex, order);
+    }
+    auto upbit = ex == Exchange::Upbit ? get_upbit_exchange() : nullptr;
+    if (!upbit) {
+        return false;
+    }
+    // A refused cancel usually means it completed meanwhile; the state decides
+    upbit->cancel_order_uuid(order.order_id_str);
+    for (int attempt = 0; attempt < 10; ++attempt) {
+        std::string state;
+        if (upbit->refresh_order(order.order_id_str, order, &state) &&
+            state != "wait" && state != "watch") {
+            upbit->forget_order_update(order.order_id_str);
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return false;
+}
+
+bool OrderManager::supports_post_only(Exchange ex) const {
+    if (backend_) {
+        return backend_->supports_post_only(ex);
+    }
+    const auto& exchange = exchanges_[static_cast<size_t>(ex)];
+    return exchange && exchange->supports_post_only();
+}
+
+OrderManager::MakerStats OrderManager::maker_stats() const {
+    MakerStats out;
+    out.chunks = maker_chunks_.load(std::memory_order_relaxed);
+    out.post_only_rejects = maker_rejects_.load(std::memory_order_relaxed);
+    out.reprices = maker_reprices_.load(std::memory_order_relaxed);
+    out.cancels = maker_cancels_.load(std::memory_order_relaxed);
+    out.filled_coins = maker_filled_coins_.load(std::memory_order_relaxed);
+    out.saved_krw = maker_saved_krw_.load(std::memory_order_relaxed);
+    out.hedge_delay = maker_hedge_delay_.summary();
+    return out;
+}
+
+OrderManager::MakerChunk OrderManager::execute_maker_chunk(const ArbitrageSignal& signal,
+                                                           const SymbolId& foreign_symbol, double quantity,
+                                                           double price, double taker_ask, ChunkSizer& sizer) {
+    const Exchange korean_venue = signal.korean_exchange;
+    const Exchange foreign_venue = signal.foreign_exchange;
+    const double maker_fee = TradingConfig::get_korean_maker_fee_rate(korean_venue);
+    const MakerQuoter quoter({maker_entry_.edge_buffer_pct, maker_entry_.reprice_bps}, maker_fee,
+                             TradingConfig::get_foreign_fee_rate(foreign_venue));
+    MakerChunk chunk;
+
+    Order order = execute_korean_post_only(korean_venue, signal.symbol, Side::Buy, quantity, price);
+    if (order.status == OrderStatus::Rejected) {
+        maker_rejects_.fetch_add(1, std::memory_order_relaxed);
+        return chunk;
+    }
+    chunk.rested = true;
+    maker_chunks_.fetch_add(1, std::memory_order_relaxed);
+    const auto first_sent = order.create_time;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(maker_entry_.max_rest_ms);
+
+    // Coins and KRW of orders already cancelled for a re-quote
+    double banked_qty = 0.0;
+    double banked_cost = 0.0;
+    double hedge_bid = signal.foreign_bid;
+    auto filled_total = [&]() { return banked_qty + order.filled_quantity; };
+
+    // Short what the Korean side bought since the last hedge
+    auto hedge = [&](bool final) {
+        const double unhedged = filled_total() - chunk.foreign_quantity;
+        if (unhedged <= 0.0 || quantities_match(filled_total(), chunk.foreign_quantity)) {
+            return true;
+        }
+        if (!final && unhedged * hedge_bid < maker_entry_.min_hedge_usdt) {
+            return true;
+        }
+        const auto hedge_start = std::chrono::steady_clock::now();
+        Order short_order = execute_foreign_short(foreign_venue, foreign_symbol, unhedged);
+        if (short_order.status != OrderStatus::Filled) {
+            Logger::error("[MAKER-ENTRY] {} hedge short of {:.8f} failed", signal.symbol.to_string(), unhedged);
+            return false;
+        }
+        query_foreign_fill(foreign_venue, short_order);
+        record_split_round_trip(sizer, korean_venue, foreign_venue, hedge_start);
+        const double qty = resolved_fill_quantity(short_order);
+        maker_hedge_delay_.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now() - order.update_time).count());
+        if (chunk.foreign_quantity <= 0.0) {
+            chunk.foreign_order = short_order;
+        } else {
+            merge_fill(chunk.foreign_order, short_order, chunk.foreign_quantity, hedge_bid);
+        }
+        chunk.foreign_quantity += qty;
+        chunk.foreign_value += qty * resolved_fill_price(short_order, hedge_bid);
+        return true;
+    };
+    auto finish = [&]() {
+        chunk.korean_quantity = filled_total();
+        chunk.korean_cost = banked_cost + order.filled_quantity * resolved_fill_price(order, order.price);
+        if (chunk.korean_quantity > 0.0) {
+            const double maker_price = chunk.korean_cost / chunk.korean_quantity;
+            const double saved = MakerQuoter::saving_per_coin(taker_ask, TradingConfig::get_korean_fee_rate(korean_venue),
+                                                              maker_price, maker_fee) * chunk.korean_quantity;
+            maker_filled_coins_.fetch_add(chunk.korean_quantity, std::memory_order_relaxed);
+            maker_saved_krw_.fetch_add(saved, std::memory_order_relaxed);
+
+            // Every re-quote as one leg: sent with the first bid, last fill on the latest
+            Order& merged = chunk.korean_order;
+            merged = order;
+            merged.create_time = first_sent;
+            merged.status = OrderStatus::Filled;
+            merged.quantity = chunk.korean_quantity;
+            merged.filled_quantity = chunk.korean_quantity;
+            merged.average_price = maker_price;
+        }
+    };
+
+    bool resting = true;
+    while (true) {
+        const uint64_t seq = engine_->get_update_seq();
+        resting = poll_resting(korean_venue, order);
+        if (!hedge(!resting)) {
+            if (resting) {
+                cancel_resting(korean_venue, order);
+            }
+            chunk.hedge_failed = true;
+            break;
+        }
+        if (!resting) {
+            break;
+        }
+
+        const bool expired = std::chrono::steady_clock::now() >= deadline ||
+                             !running_.load(std::memory_order_acquire);
+        auto& cache = engine_->get_price_cache();
+        const auto korean_quote = cache.get_price(korean_venue, signal.symbol);
+        const auto foreign_quote = cache.get_price(foreign_venue, foreign_symbol);
+        const double usdt_rate = cache.get_usdt_krw(Exchange::Bithumb) > 0.0
+            ? cache.get_usdt_krw(Exchange::Bithumb) : signal.usdt_krw_rate;
+        if (foreign_quote.bid > 0.0) {
+            hedge_bid = foreign_quote.bid;
+        }
+        // The profit floor is per chunk: price it on the whole chunk, not the remainder
+        const double ceiling = quoter.ceiling(hedge_bid, usdt_rate, quantity);
+        const double target = MakerQuoter::quote(korean_quote.bid, korean_quote.ask, ceiling);
+        const auto action = expired ? MakerQuoter::Action::Cancel : quoter.decide(order.price, target, ceiling);
+        if (action == MakerQuoter::Action::Keep) {
+            wait_for_next_market_update(seq);
+            continue;
+        }
+
+        // Cancel (and maybe re-quote): the remainder's final fill is hedged first
+        const bool cancelled = cancel_resting(korean_venue, order);
+        if (!cancelled || !hedge(true)) {
+            Logger::error("[MAKER-ENTRY] {} resting bid {} unresolved after cancel",
+                          signal.symbol.to_string(), order.order_id_str);
+            chunk.hedge_failed = true;
+            break;
+        }
+        const double left = quantity - filled_total();
+        if (action == MakerQuoter::Action::Cancel || left * target < TradingConfig::MIN_ORDER_KRW) {
+            maker_cancels_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        banked_qty += order.filled_quantity;
+        banked_cost += order.filled_quantity * resolved_fill_price(order, order.price);
+        Order next = execute_korean_post_only(korean_venue, signal.symbol, Side::Buy, left, target);
+        if (next.status == OrderStatus::Rejected) {
+            maker_rejects_.fetch_add(1, std::memory_order_relaxed);
+            order.filled_quantity = 0.0;
+            order.average_price = 0.0;
+            break;
+        }
+        maker_reprices_.fetch_add(1, std::memory_order_relaxed);
+        Logger::info("[MAKER-ENTRY] {} re-quote {:.2f} -> {:.2f} for {:.8f}",
+                     signal.symbol.to_string(), order.price, target, left);
+        order = std::move(next);
+    }
+
+    finish();
+    if (chunk.hedge_failed) {
+        return chunk;
+    }
+    // Lot rounding can leave the short a hair under the Korean fill
+    if (!quantities_match(chunk.korean_quantity, chunk.foreign_quantity) &&
+        chunk.korean_quantity > chunk.foreign_quantity) {
+        const double delta = chunk.korean_quantity - chunk.foreign_quantity;
+        Order correction;
+        if (!flatten_extra_korean_long(korean_venue, signal.symbol, delta, correction)) {
+            chunk.hedge_failed = true;
+            return chunk;
+        }
+        const double correction_qty = resolved_fill_quantity(correction);
+        const double buy_price = chunk.korean_cost / chunk.korean_quantity;
+        chunk.adjustment_pnl_krw += (resolved_fill_price(correction, buy_price) - buy_price) * correction_qty;
+        chunk.korean_cost -= buy_price * correction_qty;
+        chunk.korean_quantity -= correction_qty;
+    }
+    return chunk;
+}
+
+std::optional<KoreanRoute> OrderManager::plan_korean_buy(Exchange primary, const SymbolId& symbol,
+                                                         double quantity) const {
+    const Exchange secondary = KoreanLegRouter::other_venue(primary);
+    if (!korean_router_ || !exchanges_[static_cast<size_t>(secondary)]) {
+        return std::nullopt;
+    }
+    auto route = korean_router_->route(primary, symbol, quantity, true);
+    if (!route || !route->split() || route->gain_krw() <= korean_router_->options().min_gain_krw) {
+        return std::nullopt;
+    }
+    return route;
+}
+
+OrderManager::KoreanLegFill OrderManager::execute_korean_route(const KoreanRoute& route, const SymbolId& symbol,
+                                                               double limit_price) {
+    const auto& primary = route.legs[0];
+    const auto& secondary = route.legs[1];
+    auto submit = [&](const KoreanRouteLeg& leg) {
+        return route.buy ? execute_korean_buy(leg.exchange, symbol, leg.quantity, leg.notional_krw, limit_price)
+                         : execute_korean_sell(leg.exchange, symbol, leg.quantity, limit_price);
+    };
+
+    Order primary_order;
+    Order secondary_order;
+    std::latch secondary_done(1);
+    const bool concurrent = primary.quantity > 0.0 && secondary.quantity > 0.0;
+    if (concurrent) {
+        FillQueryTask task;
+        task.kind = route.buy ? FillQueryTask::Kind::KoreanBuySubmit : FillQueryTask::Kind::KoreanSellSubmit;
+        task.ex = secondary.exchange;
+        task.symbol = symbol;
+        task.order = &secondary_order;
+        task.done = &secondary_done;
+        task.quantity = secondary.quantity;
+        task.krw_amount = secondary.notional_krw;
+        task.limit_price = limit_price;
+        dispatch_fill_query(task);
+    } else if (secondary.quantity > 0.0) {
+        secondary_order = submit(secondary);
+        query_korean_fill(secondary.exchange, symbol, secondary_order);
+    }
+    if (primary.quantity > 0.0) {
+        primary_order = submit(primary);
+        query_korean_fill(primary.exchange, symbol, primary_order);
+    }
+    if (concurrent) {
+        secondary_done.wait();
+    }
+
+    // One leg for the lifecycle: quantities summed, price volume-weighted
+    KoreanLegFill out;
+    Order& merged = out.order;
+    merged = primary.quantity > 0.0 ? primary_order : secondary_order;
+    merged.exchange = primary.exchange;
+    merged.symbol = symbol;
+    merged.side = route.buy ? Side::Buy : Side::Sell;
+    double filled = 0.0;
+    double notional = 0.0;
+    std::string ids;
+    auto absorb = [&](const Order& child, const KoreanRouteLeg& leg) {
+        if (leg.quantity <= 0.0 || child.status != OrderStatus::Filled) {
+            return 0.0;
+        }
+        const double qty = resolved_fill_quantity(child);
+        filled += qty;
+        notional += qty * resolved_fill_price(child, leg.notional_krw / leg.quantity);
+        ids += (ids.empty() ? "" : "+") + child.order_id_str;
+        merged.create_time = std::min(merged.create_time, child.create_time);
+        merged.update_time = std::max(merged.update_time, child.update_time);
+        return qty;
+    };
+    const double primary_filled = absorb(primary_order, primary);
+    out.split_quantity = absorb(secondary_order, secondary);
+    if (filled > 0.0) {
+        merged.status = OrderStatus::Filled;
+        merged.quantity = filled;
+        merged.filled_quantity = filled;
+        merged.average_price = notional / filled;
+        merged.order_id_str = ids;
+    }
+
+    // filled/planned per venue
+    Logger::info("[KOREAN-SOR] {} {}: {} {:.8f}/{:.8f} + {} {:.8f}/{:.8f}, avg {:.2f}, planned gain {:.0f} KRW",
+                 route.buy ? "BUY" : "SELL", symbol.to_string(),
+                 exchange_name(primary.exchange), primary_filled, primary.quantity,
+                 exchange_name(secondary.exchange), out.split_quantity, secondary.quantity,
+                 merged.average_price, route.gain_krw());
+    return out;
+}
+
+OrderManager::KoreanLegFill OrderManager::sell_korean_inventory(Exchange primary, const SymbolId& symbol,
+                                                                double quantity, double primary_held,
+                                                                double split_held, double limit_price) {
+    const Exchange secondary = KoreanLegRouter::other_venue(primary);
+    std::optional<KoreanRoute> route;
+    if (korean_router_) {
+        route = korean_router_->route(primary, symbol, quantity, false, primary_held, split_held);
+    }
+    if (!route) {
+        route = KoreanLegRouter::inventory_split(primary, secondary, quantity, primary_held, split_held);
+    }
+    return execute_korean_route(*route, symbol, limit_price);
+}
+
+void OrderManager::record_leg_latency(Exchange ex, std::chrono::steady_clock::time_point submit_start,
+                                      const Order& order) {
+    record_leg_ack(ex, submit_start, order);
+    // Only matched orders measure how long the book had to move
+    if (!engine_ || order.status != OrderStatus::Filled) {
+        return;
+    }
+    const double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - submit_start).count();
+    engine_->get_fill_risk().record_leg_latency(ex, ms);
+}
+
+void OrderManager::record_fill_quality(const FillQualitySplit& split, const Order& foreign_order,
+                                       const Order& korean_order) {
+    const bool opening = split.action != FillAction::Exit;
+    const auto now = std::chrono::system_clock::now();
+    auto to_ns = [](SystemTimestamp t) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            t.time_since_epoch()).count());
+    };
+
+    auto make_leg = [&](FillLeg leg, const Order& order) {
+        const bool korean = leg == FillLeg::Korean;
+        FillQualityRecord record;
+        record.trace_id = split.trace_id;
+        record.decision_ns = to_ns(split.decision_time);
+        record.send_ns = to_ns(order.create_time);
+        record.ack_ns = to_ns(order.update_time);
+        record.fill_ns = to_ns(now);
+        record.decision_premium_pct = split.premium_pct;
+        record.decision_price = korean ? split.korean_price : split.foreign_price;
+        record.fill_price = order.average_price;
+        record.fill_qty = resolved_fill_quantity(order);
+        record.usdt_krw = split.usdt_krw;
+        record.symbol = split.trace_symbol;
+        record.action = split.action;
+        record.leg = leg;
+        record.venue = korean ? split.korean_ex : split.foreign_ex;
+        record.counter_venue = korean ? split.foreign_ex : split.korean_ex;
+        // Opening buys Korean / shorts foreign; exit does the reverse
+        record.side = (korean == opening) ? Side::Buy : Side::Sell;
+        if (engine_) {
+            const auto quote = engine_->get_price_cache().get_price(
+                record.venue, korean ? split.korean_symbol : split.foreign_symbol);
+            record.fill_quote_price = record.side == Side::Buy ? quote.ask : quote.bid;
+        }
+        return record;
+    };
+
+    // Legs without a reported fill price would only measure the cache fallback
+    if (foreign_order.status == OrderStatus::Filled && foreign_order.average_price > 0.0) {
+        AsyncCsvWriter::instance().push_fill(make_leg(FillLeg::Foreign, foreign_order));
+    }
+    if (korean_order.status == OrderStatus::Filled && korean_order.average_price > 0.0) {
+        AsyncCsvWriter::instance().push_fill(make_leg(FillLeg::Korean, korean_order));
+    }
 }
 
 bool OrderManager::flatten_extra_korean_long(Exchange ex,
@@ -2034,22 +3293,77 @@ bool OrderManager::flatten_extra_foreign_short(Exchange ex,
 
 void OrderManager::query_foreign_fill(Exchange ex, Order& order) {
     if (order.order_id_str.empty() || order.status != OrderStatus::Filled) return;
-    if (ex == Exchange::Bybit && bybit_exchange_) {
-        bybit_exchange_->query_order_fill(order.order_id_str, order);
-    } else if (ex == Exchange::OKX && okx_exchange_) {
-        okx_exchange_->query_order_fill(order.order_id_str, order.symbol, order);
+    const auto acked = order.update_time;
+    bool known = false;
+    if (backend_) {
+        backend_->query_foreign_fill(ex, order);
+        known = true;
+    } else if (auto bybit = ex == Exchange::Bybit ? get_bybit_exchange() : nullptr) {
+        known = await_fill(ex, order, [&]() { return bybit->query_order_fill(order.order_id_str, order); });
+    } else if (auto okx = ex == Exchange::OKX ? get_okx_exchange() : nullptr) {
+        known = await_fill(ex, order, [&]() {
+            return okx->query_order_fill(order.order_id_str, order.symbol, order);
+        });
     }
+    if (known) {
+        settle_ioc_fill(order);
+        record_leg_fill(ex, order);
+    }
+    order.update_time = acked;
 }
 
 void OrderManager::query_korean_fill(Exchange ex, const SymbolId& symbol, Order& order) {
     if (order.order_id_str.empty() || order.status != OrderStatus::Filled) return;
-    if (ex == Exchange::Bithumb) {
-        if (bithumb_exchange_) {
-            bithumb_exchange_->query_order_detail(order.order_id_str, symbol, order);
+    const auto acked = order.update_time;
+    bool known = false;
+    if (backend_) {
+        backend_->query_korean_fill(ex, symbol, order);
+        known = true;
+    } else if (ex == Exchange::Bithumb) {
+        if (auto bithumb = get_bithumb_exchange()) {
+            known = await_fill(ex, order, [&]() {
+                return bithumb->query_order_detail(order.order_id_str, symbol, order);
+            });
         }
     } else if (ex == Exchange::Upbit) {
-        if (upbit_exchange_) {
-            upbit_exchange_->query_order_detail(order.order_id_str, order);
+        if (auto upbit = get_upbit_exchange()) {
+            known = await_fill(ex, order, [&]() { return upbit->query_order_detail(order.order_id_str, order); });
+        }
+    }
+    if (known) {
+        settle_ioc_fill(order);
+        record_leg_fill(ex, order);
+    }
+    order.update_time = acked;
+}
+
+bool OrderManager::await_fill(Exchange ex, Order& order, const std::function<bool()>& query) {
+    if (query()) {
+        return true;
+    }
+    if (order.type != OrderType::Limit) {
+        return false;  // Market order: the ack's full quantity stands
+    }
+    static constexpr auto MAX_BACKOFF = std::chrono::milliseconds(2000);
+    auto backoff = std::chrono::milliseconds(100);
+    for (int queries = 2;; ++queries) {
+        if (!running_.load(std::memory_order_acquire)) {
+            // Neither a full fill nor none: callers must not size the other leg on it
+            order.status = OrderStatus::Unknown;
+            Logger::error("[FILL] {} IOC {} fill still unknown at shutdown: check the venue",
+                          exchange_name(ex), order.order_id_str);
+            return false;
+        }
+        std::this_thread::sleep_for(backoff);
+        backoff = std::min(backoff * 2, MAX_BACKOFF);
+        if (query()) {
+            Logger::warn("[FILL] {} IOC {} fill known after {} queries", exchange_name(ex), order.order_id_str,
+                         queries);
+            return true;
+        }
+        if (queries % 5 == 0) {
+            Logger::error("[FILL] {} IOC {} fill unknown after {} queries, holding the other leg",
+                          exchange_name(ex), order.order_id_str, queries);
         }
     }
 }
@@ -2063,12 +3377,9 @@ void OrderManager::ensure_fill_query_executor_started() {
         options.empty_spin_count = 1024;
         options.idle_wait = std::chrono::microseconds(100);
         fill_query_executor_.start(options, [thread_config](std::size_t worker_index) {
-            const int total_cores = static_cast<int>(std::thread::hardware_concurrency());
-            int core_id = thread_config.execution_core;
-            if (core_id >= 0 && total_cores > 0) {
-                core_id = std::min(core_id + static_cast<int>(TradingConfig::MAX_POSITIONS) +
-                                       static_cast<int>(worker_index),
-                                   total_cores - 1);
+            const int core_id = thread_config.execution_worker_core(
+                static_cast<std::size_t>(TradingConfig::MAX_POSITIONS) + worker_index);
+            if (core_id >= 0) {
                 if (opt::pin_to_core(core_id)) {
                     Logger::info("Fill query worker {} pinned to core {}", worker_index, core_id);
                 }
@@ -2114,9 +3425,17 @@ void OrderManager::handle_fill_query(FillQueryTask&& task, std::size_t worker_in
         worker_index == static_cast<std::size_t>(-1) ? -1 : static_cast<int64_t>(worker_index);
     record_stage(task.worker_stage, worker_aux, static_cast<int64_t>(task.kind));
 
+    AccountScope account_scope;
+    account_scope.set(task.ex, task.account);
+
     if (task.kind == FillQueryTask::Kind::Foreign) {
         query_foreign_fill(task.ex, *task.order);
     } else {
+        if (task.kind == FillQueryTask::Kind::KoreanBuySubmit) {
+            *task.order = execute_korean_buy(task.ex, task.symbol, task.quantity, task.krw_amount, task.limit_price);
+        } else if (task.kind == FillQueryTask::Kind::KoreanSellSubmit) {
+            *task.order = execute_korean_sell(task.ex, task.symbol, task.quantity, task.limit_price);
+        }
         query_korean_fill(task.ex, task.symbol, *task.order);
     }
     record_stage(task.done_stage,
@@ -2129,6 +3448,7 @@ void OrderManager::handle_fill_query(FillQueryTask&& task, std::size_t worker_in
 
 void OrderManager::dispatch_fill_query(FillQueryTask task) {
     ensure_fill_query_executor_started();
+    task.account = current_account(task.ex);
     if (task.trace_id != 0) {
         LatencyProbe::instance().record(
             task.trace_id,
@@ -2154,6 +3474,26 @@ void OrderManager::wait_for_next_market_update(uint64_t update_seq_before_trade)
     }
 }
 
+ChunkSizer OrderManager::make_chunk_sizer(Exchange korean_ex, Exchange foreign_ex) const {
+    const std::size_t pair = static_cast<std::size_t>(korean_ex) * static_cast<std::size_t>(Exchange::Count) +
+                             static_cast<std::size_t>(foreign_ex);
+    const double round_trip_ms = pair < PAIR_COUNT
+        ? pair_round_trip_ms_[pair].load(std::memory_order_relaxed) : 0.0;
+    return ChunkSizer(ChunkSizerConfig{}, round_trip_ms);
+}
+
+void OrderManager::record_split_round_trip(ChunkSizer& sizer, Exchange korean_ex, Exchange foreign_ex,
+                                           std::chrono::steady_clock::time_point split_start) {
+    const double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - split_start).count();
+    sizer.observe_round_trip(ms);
+    const std::size_t pair = static_cast<std::size_t>(korean_ex) * static_cast<std::size_t>(Exchange::Count) +
+                             static_cast<std::size_t>(foreign_ex);
+    if (pair < PAIR_COUNT) {
+        pair_round_trip_ms_[pair].store(sizer.round_trip_ms(), std::memory_order_relaxed);
+    }
+}
+
 void OrderManager::refresh_external_positions(const std::vector<SymbolId>& symbols,
                                                const std::unordered_set<SymbolId>& bot_managed) {
     Logger::info("Building external position blacklist ({} symbols, {} bot-managed)...",
@@ -2161,23 +3501,36 @@ void OrderManager::refresh_external_positions(const std::vector<SymbolId>& symbo
 
     std::unordered_set<SymbolId> new_blacklist;
 
+    // Holdings on any account of a venue block the coin
+    auto each_account = [this](Exchange ex, auto&& fn) {
+        const std::size_t accounts = std::max<std::size_t>(accounts_.count(ex), 1);
+        for (std::size_t account = 0; account < accounts; ++account) {
+            AccountScope account_scope;
+            account_scope.set(ex, static_cast<uint8_t>(account));
+            fn();
+        }
+    };
+
     for (Exchange ex : {Exchange::Bithumb, Exchange::Upbit}) {
-        auto korean = get_korean_exchange(ex);
-        if (!korean) continue;
-        for (const auto& sym : symbols) {
-            if (bot_managed.count(sym)) continue;  // Skip bot's own positions
-            double balance = korean->get_balance(std::string(sym.get_base()));
-            if (balance > 0.0001) {  // Ignore dust
-                new_blacklist.insert(sym);
-                Logger::warn("[BLACKLIST] {} - {} spot balance: {:.6f}",
-                             sym.to_string(), exchange_name(ex), balance);
+        each_account(ex, [&] {
+            auto korean = get_korean_exchange(ex);
+            if (!korean) return;
+            for (const auto& sym : symbols) {
+                if (bot_managed.count(sym)) continue;  // Skip bot's own positions
+                double balance = korean->get_balance(std::string(sym.get_base()));
+                if (balance > 0.0001) {  // Ignore dust
+                    new_blacklist.insert(sym);
+                    Logger::warn("[BLACKLIST] {} - {} spot balance: {:.6f}",
+                                 sym.to_string(), exchange_name(ex), balance);
+                }
             }
-        }
+        });
     }
 
     // Check Bybit spot-margin short liabilities
-    auto bybit = get_bybit_exchange();
-    if (bybit) {
+    each_account(Exchange::Bybit, [&] {
+        auto bybit = get_bybit_exchange();
+        if (!bybit) return;
         auto positions = bybit->get_short_positions();
         for (const auto& pos : positions) {
             if (pos.foreign_amount > 0.0001) {  // Ignore dust
@@ -2188,10 +3541,11 @@ void OrderManager::refresh_external_positions(const std::vector<SymbolId>& symbo
                              krw_symbol.to_string(), pos.foreign_amount);
             }
         }
-    }
+    });
 
-    auto okx = get_okx_exchange();
-    if (okx) {
+    each_account(Exchange::OKX, [&] {
+        auto okx = get_okx_exchange();
+        if (!okx) return;
         auto positions = okx->get_short_positions();
         for (const auto& pos : positions) {
             if (pos.foreign_amount > 0.0001) {
@@ -2202,7 +3556,7 @@ void OrderManager::refresh_external_positions(const std::vector<SymbolId>& symbo
                              krw_symbol.to_string(), pos.foreign_amount);
             }
         }
-    }
+    });
 
     // Update blacklist atomically
     {
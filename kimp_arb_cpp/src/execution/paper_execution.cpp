@@ -0,0 +1,620 @@
+#include "kimp/execution/paper_execution.hpp"
+#include "kimp/core/logger.hpp"
+#include "kimp/execution/korean_router.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace kimp::execution {
+
+namespace {
+
+int64_t steady_now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t steady_now_ms() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+constexpr std::size_t venue_index(Exchange ex) noexcept {
+    return static_cast<std::size_t>(ex);
+}
+
+// Base coins of the paired markets share one balance per venue
+std::string base_currency(const SymbolId& symbol) {
+    return std::string(symbol.get_base());
+}
+
+LatencyDistribution make_latency(double p50, double p90, double p99) {
+    return LatencyDistribution({{0.0, p50 * 0.6}, {0.5, p50}, {0.9, p90}, {0.99, p99}, {1.0, p99 * 1.5}});
+}
+
+} // namespace
+
+// ============================================================================
+// LatencyDistribution
+// ============================================================================
+
+LatencyDistribution::LatencyDistribution(std::vector<Knot> knots)
+    : knots_(std::move(knots)) {
+    std::sort(knots_.begin(), knots_.end(), [](const Knot& a, const Knot& b) {
+        return a.quantile < b.quantile;
+    });
+}
+
+double LatencyDistribution::quantile_ms(double u) const noexcept {
+    if (knots_.empty()) {
+        return 0.0;
+    }
+    if (u <= knots_.front().quantile) {
+        return knots_.front().ms;
+    }
+    for (std::size_t i = 1; i < knots_.size(); ++i) {
+        const auto& hi = knots_[i];
+        if (u <= hi.quantile) {
+            const auto& lo = knots_[i - 1];
+            const double span = hi.quantile - lo.quantile;
+            if (span <= 0.0) {
+                return hi.ms;
+            }
+            return lo.ms + (hi.ms - lo.ms) * (u - lo.quantile) / span;
+        }
+    }
+    return knots_.back().ms;
+}
+
+// ============================================================================
+// PaperExecution
+// ============================================================================
+
+PaperExecution::Options PaperExecution::Options::with_default_latencies() {
+    Options options;
+    options.venues[venue_index(Exchange::Bithumb)] = {make_latency(25.0, 45.0, 120.0), make_latency(10.0, 25.0, 80.0)};
+    options.venues[venue_index(Exchange::Upbit)] = {make_latency(20.0, 35.0, 90.0), make_latency(10.0, 20.0, 60.0)};
+    options.venues[venue_index(Exchange::Bybit)] = {make_latency(35.0, 50.0, 120.0), make_latency(8.0, 15.0, 40.0)};
+    options.venues[venue_index(Exchange::OKX)] = {make_latency(40.0, 60.0, 150.0), make_latency(10.0, 20.0, 50.0)};
+    return options;
+}
+
+PaperExecution::PaperExecution(const strategy::PriceCache* prices, Options options)
+    : prices_(prices)
+    , options_(std::move(options))
+    , rng_(options_.seed != 0 ? options_.seed : std::random_device{}()) {
+    for (Exchange ex : {Exchange::Bithumb, Exchange::Upbit}) {
+        balances_[venue_index(ex)]["KRW"] = options_.initial_krw;
+    }
+    for (Exchange ex : {Exchange::Bybit, Exchange::OKX}) {
+        balances_[venue_index(ex)]["USDT"] = options_.initial_usdt;
+    }
+}
+
+void PaperExecution::on_orderbook(const OrderBook& book) {
+    if (venue_index(book.exchange) >= books_.size()) {
+        return;
+    }
+    {
+        std::lock_guard lock(books_mutex_);
+        books_[venue_index(book.exchange)][book.symbol] = book;
+    }
+    if (is_korean_exchange(book.exchange)) {
+        match_resting(book);
+    }
+}
+
+void PaperExecution::seed_position(const Position& position) {
+    const std::string coin = base_currency(position.symbol);
+    std::lock_guard lock(balances_mutex_);
+    const double split = std::clamp(position.korean_split_amount, 0.0, position.korean_amount);
+    balances_[venue_index(position.korean_exchange)][coin] += position.korean_amount - split;
+    if (split > 0.0) {
+        balances_[venue_index(KoreanLegRouter::other_venue(position.korean_exchange))][coin] += split;
+    }
+    balances_[venue_index(position.foreign_exchange)][coin] -= position.foreign_amount;
+}
+
+PaperExecution::Fill PaperExecution::walk_quantity(const OrderBookLevel* levels, std::size_t count,
+                                                   double quantity, double beyond_bps, bool buy) noexcept {
+    Fill fill;
+    double remaining = quantity;
+    double last_price = 0.0;
+    for (std::size_t i = 0; i < count && remaining > 0.0; ++i) {
+        if (levels[i].price <= 0.0 || levels[i].quantity <= 0.0) {
+            continue;
+        }
+        const double take = std::min(remaining, levels[i].quantity);
+        fill.notional += take * levels[i].price;
+        fill.quantity += take;
+        remaining -= take;
+        last_price = levels[i].price;
+    }
+    if (last_price <= 0.0) {
+        return {};
+    }
+    if (remaining > 0.0) {
+        const double sign = buy ? 1.0 : -1.0;
+        const double price = last_price * (1.0 + sign * beyond_bps / 10000.0);
+        fill.notional += remaining * price;
+        fill.quantity += remaining;
+        fill.beyond_depth = true;
+    }
+    fill.average_price = fill.notional / fill.quantity;
+    return fill;
+}
+
+PaperExecution::Fill PaperExecution::walk_cost(const OrderBookLevel* levels, std::size_t count,
+                                               double cost, double beyond_bps) noexcept {
+    Fill fill;
+    double remaining = cost;
+    double last_price = 0.0;
+    for (std::size_t i = 0; i < count && remaining > 0.0; ++i) {
+        if (levels[i].price <= 0.0 || levels[i].quantity <= 0.0) {
+            continue;
+        }
+        const double take = std::min(remaining / levels[i].price, levels[i].quantity);
+        fill.notional += take * levels[i].price;
+        fill.quantity += take;
+        remaining = cost - fill.notional;
+        last_price = levels[i].price;
+    }
+    if (last_price <= 0.0) {
+        return {};
+    }
+    if (remaining > 0.0) {
+        const double price = last_price * (1.0 + beyond_bps / 10000.0);
+        fill.quantity += remaining / price;
+        fill.notional = cost;
+        fill.beyond_depth = true;
+    }
+    fill.average_price = fill.notional / fill.quantity;
+    return fill;
+}
+
+PaperExecution::Fill PaperExecution::walk_limit(const OrderBookLevel* levels, std::size_t count,
+                                                double quantity, double limit, bool buy) noexcept {
+    Fill fill;
+    double remaining = quantity;
+    for (std::size_t i = 0; i < count && remaining > 0.0; ++i) {
+        if (levels[i].price <= 0.0 || levels[i].quantity <= 0.0) {
+            continue;
+        }
+        if (buy ? levels[i].price > limit : levels[i].price < limit) {
+            break;
+        }
+        const double take = std::min(remaining, levels[i].quantity);
+        fill.notional += take * levels[i].price;
+        fill.quantity += take;
+        remaining -= take;
+    }
+    if (fill.quantity > 0.0) {
+        fill.average_price = fill.notional / fill.quantity;
+    }
+    return fill;
+}
+
+Order PaperExecution::korean_buy(Exchange ex, const SymbolId& symbol, double quantity, double krw_amount) {
+    // Upbit market buys are cost-based (price = KRW to spend), Bithumb buys by quantity
+    return submit(Leg::KoreanBuy, ex, symbol, ex == Exchange::Upbit ? 0.0 : quantity, krw_amount);
+}
+
+Order PaperExecution::korean_sell(Exchange ex, const SymbolId& symbol, double quantity) {
+    return submit(Leg::KoreanSell, ex, symbol, quantity, 0.0);
+}
+
+Order PaperExecution::foreign_short(Exchange ex, const SymbolId& symbol, double quantity) {
+    return submit(Leg::ForeignShort, ex, symbol, quantity, 0.0);
+}
+
+Order PaperExecution::foreign_cover(Exchange ex, const SymbolId& symbol, double quantity) {
+    return submit(Leg::ForeignCover, ex, symbol, quantity, 0.0);
+}
+
+Order PaperExecution::korean_buy_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) {
+    return submit(Leg::KoreanBuy, ex, symbol, quantity, 0.0, limit_price);
+}
+
+Order PaperExecution::korean_sell_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) {
+    return submit(Leg::KoreanSell, ex, symbol, quantity, 0.0, limit_price);
+}
+
+Order PaperExecution::foreign_short_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) {
+    return submit(Leg::ForeignShort, ex, symbol, quantity, 0.0, limit_price);
+}
+
+Order PaperExecution::foreign_cover_ioc(Exchange ex, const SymbolId& symbol, double quantity, double limit_price) {
+    return submit(Leg::ForeignCover, ex, symbol, quantity, 0.0, limit_price);
+}
+
+Order PaperExecution::korean_post_only(Exchange ex, const SymbolId& symbol, Side side, double quantity,
+                                       double limit_price) {
+    const bool buy = side == Side::Buy;
+    Order order;
+    order.exchange = ex;
+    order.symbol = symbol;
+    order.side = side;
+    order.type = OrderType::Limit;
+    order.price = limit_price;
+    order.status = OrderStatus::Rejected;
+    order.quantity = quantity;
+    order.create_time = std::chrono::system_clock::now();
+    orders_.fetch_add(1, std::memory_order_relaxed);
+
+    if (!supports_post_only(ex) || quantity <= 0.0 || limit_price <= 0.0) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return order;
+    }
+
+    const double submit_ms = sample_ms(options_.venues[venue_index(ex)].submit);
+    if (submit_ms > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(submit_ms));
+    }
+    submit_hist_.record(static_cast<int64_t>(submit_ms * 1e6));
+
+    OrderBook book;
+    if (!load_book(ex, symbol, book)) {
+        Logger::warn("[Paper] {} {} post-only rejected: no book", exchange_name(ex), symbol.to_string());
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return order;
+    }
+    const bool crosses = buy ? book.ask_count > 0 && book.asks[0].price <= limit_price
+                             : book.bid_count > 0 && book.bids[0].price >= limit_price;
+    if (crosses) {
+        post_only_rejects_.fetch_add(1, std::memory_order_relaxed);
+        return order;
+    }
+
+    const uint64_t id = next_order_id_.fetch_add(1, std::memory_order_relaxed);
+    order.exchange_order_id = id;
+    order.order_id_str = "paper-" + std::to_string(id);
+    order.status = OrderStatus::New;
+    order.update_time = std::chrono::system_clock::now();
+
+    RestingOrder resting;
+    resting.leg = buy ? Leg::KoreanBuy : Leg::KoreanSell;
+    resting.exchange = ex;
+    resting.symbol = symbol;
+    resting.quantity = quantity;
+    resting.price = limit_price;
+    std::lock_guard lock(resting_mutex_);
+    resting_.emplace(order.order_id_str, std::move(resting));
+    return order;
+}
+
+bool PaperExecution::poll_resting(Exchange /*ex*/, Order& order) {
+    std::lock_guard lock(resting_mutex_);
+    auto it = resting_.find(order.order_id_str);
+    if (it == resting_.end()) {
+        return false;
+    }
+    const RestingOrder& resting = it->second;
+    const bool matched_all = resting.filled >= resting.quantity * (1.0 - 1e-9);
+    copy_resting(resting, order, steady_now_ns(), false);
+    if (!matched_all || order.filled_quantity < resting.filled) {
+        order.status = order.filled_quantity > 0.0 ? OrderStatus::PartiallyFilled : OrderStatus::New;
+        return true;
+    }
+    order.status = OrderStatus::Filled;
+    resting_.erase(it);
+    return false;
+}
+
+bool PaperExecution::cancel_resting(Exchange ex, Order& order) {
+    // A cancel is a REST round trip: the book may still fill it meanwhile
+    const double cancel_ms = sample_ms(options_.venues[venue_index(ex)].submit);
+    if (cancel_ms > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(cancel_ms));
+    }
+    std::lock_guard lock(resting_mutex_);
+    auto it = resting_.find(order.order_id_str);
+    if (it == resting_.end()) {
+        return false;
+    }
+    copy_resting(it->second, order, 0, true);
+    order.status = order.filled_quantity >= order.quantity * (1.0 - 1e-9) ? OrderStatus::Filled
+                                                                          : OrderStatus::Cancelled;
+    resting_.erase(it);
+    return true;
+}
+
+void PaperExecution::match_resting(const OrderBook& book) {
+    std::lock_guard lock(resting_mutex_);
+    for (auto& [id, resting] : resting_) {
+        const double open = resting.quantity - resting.filled;
+        if (resting.exchange != book.exchange || !(resting.symbol == book.symbol) || open <= 0.0) {
+            continue;
+        }
+        // Whatever the new book shows through the resting price traded against it
+        const bool buy = resting.leg == Leg::KoreanBuy;
+        Fill fill = walk_limit(buy ? book.asks.data() : book.bids.data(),
+                               buy ? book.ask_count : book.bid_count, open, resting.price, buy);
+        if (fill.quantity <= 0.0) {
+            continue;
+        }
+        fill.average_price = resting.price;
+        fill.notional = fill.quantity * resting.price;
+        if (!settle(resting.leg, resting.exchange, resting.symbol, fill, true)) {
+            // The venue would have refused the order up front: nothing more rests
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            resting.quantity = resting.filled;
+            continue;
+        }
+        resting.filled += fill.quantity;
+        const double report_ms = sample_ms(options_.venues[venue_index(resting.exchange)].fill_report);
+        fill_hist_.record(static_cast<int64_t>(report_ms * 1e6));
+        resting.fills.push_back({fill.quantity, steady_now_ns() + static_cast<int64_t>(report_ms * 1e6),
+                                 std::chrono::system_clock::now()});
+        maker_fills_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void PaperExecution::copy_resting(const RestingOrder& resting, Order& order, int64_t now_ns, bool final) {
+    double filled = 0.0;
+    for (const auto& fill : resting.fills) {
+        if (final || fill.ready_ns <= now_ns) {
+            filled += fill.quantity;
+            order.update_time = std::max(order.update_time, fill.matched);
+        }
+    }
+    order.filled_quantity = filled;
+    order.average_price = filled > 0.0 ? resting.price : 0.0;
+}
+
+void PaperExecution::query_korean_fill(Exchange /*ex*/, const SymbolId& /*symbol*/, Order& order) {
+    resolve(order);
+}
+
+void PaperExecution::query_foreign_fill(Exchange /*ex*/, Order& order) {
+    resolve(order);
+}
+
+Order PaperExecution::submit(Leg leg, Exchange ex, const SymbolId& symbol, double quantity, double cost,
+                             double limit_price) {
+    const bool buy = leg == Leg::KoreanBuy || leg == Leg::ForeignCover;
+    const bool ioc = limit_price > 0.0;
+
+    Order order;
+    order.exchange = ex;
+    order.symbol = symbol;
+    order.side = buy ? Side::Buy : Side::Sell;
+    order.type = ioc ? OrderType::Limit : OrderType::Market;
+    order.price = limit_price;
+    order.status = OrderStatus::Rejected;
+    order.quantity = quantity;
+    order.create_time = std::chrono::system_clock::now();
+    orders_.fetch_add(1, std::memory_order_relaxed);
+
+    if (venue_index(ex) >= options_.venues.size() || (quantity <= 0.0 && cost <= 0.0)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return order;
+    }
+
+    const auto& venue = options_.venues[venue_index(ex)];
+    const double submit_ms = sample_ms(venue.submit);
+    if (submit_ms > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(submit_ms));
+    }
+    submit_hist_.record(static_cast<int64_t>(submit_ms * 1e6));
+
+    OrderBook book;
+    if (!load_book(ex, symbol, book)) {
+        Logger::warn("[Paper] {} {} rejected: no book", exchange_name(ex), symbol.to_string());
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return order;
+    }
+
+    const OrderBookLevel* levels = buy ? book.asks.data() : book.bids.data();
+    const std::size_t count = buy ? book.ask_count : book.bid_count;
+    Fill fill;
+    if (ioc) {
+        fill = walk_limit(levels, count, quantity, limit_price, buy);
+    } else if (quantity > 0.0) {
+        fill = walk_quantity(levels, count, quantity, options_.beyond_depth_slippage_bps, buy);
+    } else {
+        fill = walk_cost(levels, count, cost, options_.beyond_depth_slippage_bps);
+    }
+    if (ioc && fill.quantity <= 0.0) {
+        // Accepted and cancelled in full: nothing to settle
+        ioc_zero_fills_.fetch_add(1, std::memory_order_relaxed);
+    } else if (fill.quantity <= 0.0 || !settle(leg, ex, symbol, fill)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return order;
+    }
+    if (fill.beyond_depth) {
+        beyond_depth_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const uint64_t id = next_order_id_.fetch_add(1, std::memory_order_relaxed);
+    order.exchange_order_id = id;
+    order.order_id_str = "paper-" + std::to_string(id);
+    order.status = OrderStatus::Filled;
+    if (!ioc) {
+        order.quantity = fill.quantity;
+    }
+    order.update_time = std::chrono::system_clock::now();
+
+    const double report_ms = sample_ms(venue.fill_report);
+    fill_hist_.record(static_cast<int64_t>(report_ms * 1e6));
+    const int64_t now_ns = steady_now_ns();
+    {
+        std::lock_guard lock(pending_mutex_);
+        // Fills nobody queried (e.g. rollbacks) must not accumulate
+        if (pending_.size() >= MAX_PENDING_FILLS) {
+            std::erase_if(pending_, [now_ns](const auto& entry) {
+                return now_ns - entry.second.ready_ns > STALE_PENDING_NS;
+            });
+        }
+        pending_[order.order_id_str] = {fill, now_ns + static_cast<int64_t>(report_ms * 1e6)};
+    }
+    return order;
+}
+
+bool PaperExecution::load_book(Exchange ex, const SymbolId& symbol, OrderBook& out) {
+    {
+        std::lock_guard lock(books_mutex_);
+        const auto& venue_books = books_[venue_index(ex)];
+        auto it = venue_books.find(symbol);
+        if (it != venue_books.end()) {
+            const auto age = std::chrono::steady_clock::now() - it->second.timestamp;
+            if (age <= std::chrono::milliseconds(options_.max_book_age_ms)) {
+                out = it->second;
+                return out.bid_count > 0 || out.ask_count > 0;
+            }
+        }
+    }
+
+    if (!prices_) {
+        return false;
+    }
+    const auto price = prices_->get_price(ex, symbol);
+    if (!price.valid || price.bid <= 0.0 || price.ask <= 0.0 ||
+        steady_now_ms() - price.timestamp > options_.max_book_age_ms) {
+        return false;
+    }
+    // One-level book; an unknown top size is treated as unlimited
+    constexpr double unknown = std::numeric_limits<double>::max();
+    out = OrderBook{};
+    out.exchange = ex;
+    out.symbol = symbol;
+    out.bids[0] = {price.bid, price.bid_qty > 0.0 ? price.bid_qty : unknown};
+    out.asks[0] = {price.ask, price.ask_qty > 0.0 ? price.ask_qty : unknown};
+    out.bid_count = 1;
+    out.ask_count = 1;
+    bbo_fallbacks_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool PaperExecution::settle(Leg leg, Exchange ex, const SymbolId& symbol, const Fill& fill, bool maker) {
+    const bool korean = leg == Leg::KoreanBuy || leg == Leg::KoreanSell;
+    const double fee_rate = !korean ? TradingConfig::get_foreign_fee_rate(ex)
+                          : maker ? TradingConfig::get_korean_maker_fee_rate(ex)
+                                  : TradingConfig::get_korean_fee_rate(ex);
+    const double fee = fill.notional * fee_rate;
+    const std::string coin = base_currency(symbol);
+    constexpr double tolerance = 1e-9;
+
+    std::lock_guard lock(balances_mutex_);
+    auto& venue = balances_[venue_index(ex)];
+    double& cash = venue[korean ? "KRW" : "USDT"];
+    double& coins = venue[coin];
+
+    switch (leg) {
+        case Leg::KoreanBuy:
+        case Leg::ForeignCover:
+            if (cash + tolerance < fill.notional + fee) {
+                Logger::warn("[Paper] {} {} buy rejected: insufficient {} ({:.2f} < {:.2f})",
+                             exchange_name(ex), symbol.to_string(), korean ? "KRW" : "USDT",
+                             cash, fill.notional + fee);
+                return false;
+            }
+            cash -= fill.notional + fee;
+            coins += fill.quantity;
+            break;
+        case Leg::KoreanSell:
+            if (coins + tolerance * std::max(1.0, fill.quantity) < fill.quantity) {
+                Logger::warn("[Paper] {} {} sell rejected: insufficient {} ({:.8f} < {:.8f})",
+                             exchange_name(ex), symbol.to_string(), coin, coins, fill.quantity);
+                return false;
+            }
+            cash += fill.notional - fee;
+            coins -= fill.quantity;
+            break;
+        case Leg::ForeignShort:
+            // Borrow and sell; the proceeds stay on the margin account
+            cash += fill.notional - fee;
+            coins -= fill.quantity;
+            break;
+    }
+    (korean ? fees_krw_ : fees_usdt_) += fee;
+    return true;
+}
+
+void PaperExecution::resolve(Order& order) {
+    if (order.order_id_str.empty() || order.status != OrderStatus::Filled) {
+        return;
+    }
+    PendingFill pending;
+    {
+        std::lock_guard lock(pending_mutex_);
+        auto it = pending_.find(order.order_id_str);
+        if (it == pending_.end()) {
+            return;
+        }
+        pending = it->second;
+        pending_.erase(it);
+    }
+
+    const int64_t wait_ns = pending.ready_ns - steady_now_ns();
+    if (wait_ns > 0) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+    }
+    order.filled_quantity = pending.fill.quantity;
+    order.average_price = pending.fill.average_price;
+    order.update_time = std::chrono::system_clock::now();
+}
+
+double PaperExecution::sample_ms(const LatencyDistribution& dist) {
+    if (dist.empty()) {
+        return 0.0;
+    }
+    double u = 0.0;
+    {
+        std::lock_guard lock(rng_mutex_);
+        u = std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+    }
+    return std::max(0.0, dist.quantile_ms(u));
+}
+
+double PaperExecution::balance(Exchange ex, std::string_view currency) const {
+    if (venue_index(ex) >= balances_.size()) {
+        return 0.0;
+    }
+    std::lock_guard lock(balances_mutex_);
+    const auto& venue = balances_[venue_index(ex)];
+    auto it = venue.find(std::string(currency));
+    return it != venue.end() ? it->second : 0.0;
+}
+
+std::vector<PaperExecution::Balance> PaperExecution::balances() const {
+    std::vector<Balance> out;
+    {
+        std::lock_guard lock(balances_mutex_);
+        for (std::size_t i = 0; i < balances_.size(); ++i) {
+            for (const auto& [currency, amount] : balances_[i]) {
+                if (std::fabs(amount) > 1e-12) {
+                    out.push_back({static_cast<Exchange>(i), currency, amount});
+                }
+            }
+        }
+    }
+    std::sort(out.begin(), out.end(), [](const Balance& a, const Balance& b) {
+        return a.exchange != b.exchange ? a.exchange < b.exchange : a.currency < b.currency;
+    });
+    return out;
+}
+
+PaperExecution::Stats PaperExecution::stats() const {
+    Stats out;
+    out.orders = orders_.load(std::memory_order_relaxed);
+    out.rejected = rejected_.load(std::memory_order_relaxed);
+    out.ioc_zero_fills = ioc_zero_fills_.load(std::memory_order_relaxed);
+    out.post_only_rejects = post_only_rejects_.load(std::memory_order_relaxed);
+    out.maker_fills = maker_fills_.load(std::memory_order_relaxed);
+    out.beyond_depth = beyond_depth_.load(std::memory_order_relaxed);
+    out.bbo_fallbacks = bbo_fallbacks_.load(std::memory_order_relaxed);
+    {
+        std::lock_guard lock(balances_mutex_);
+        out.fees_krw = fees_krw_;
+        out.fees_usdt = fees_usdt_;
+    }
+    out.submit_latency = submit_hist_.summary();
+    out.fill_latency = fill_hist_.summary();
+    return out;
+}
+
+} // namespace kimp::execution
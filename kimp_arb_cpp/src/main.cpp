@@ -1,7 +1,9 @@
 #include "kimp/core/types.hpp"
 #include "kimp/core/config.hpp"
+#include "kimp/core/cpu_topology.hpp"
 #include "kimp/core/dotenv.hpp"
 #include "kimp/core/logger.hpp"
+#include "kimp/core/flight_recorder.hpp"
 #include "kimp/core/latency_probe.hpp"
 #include "kimp/core/optimization.hpp"
 #include "kimp/core/price_format.hpp"
@@ -11,9 +13,16 @@
 #include "kimp/exchange/okx/okx.hpp"
 #include "kimp/exchange/upbit/upbit.hpp"
 #include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/strategy/listing_watcher.hpp"
 #include "kimp/strategy/spot_relay_scanner.hpp"
+#include "kimp/execution/fill_quality.hpp"
+#include "kimp/execution/korean_router.hpp"
 #include "kimp/execution/lifecycle_executor.hpp"
 #include "kimp/execution/order_manager.hpp"
+#include "kimp/execution/paper_execution.hpp"
+#include "kimp/network/busy_poll_reactor.hpp"
+#include "kimp/network/ktls.hpp"
+#include "kimp/network/market_data_shm.hpp"
 #include "kimp/network/ws_broadcast_server.hpp"
 
 #include <boost/asio.hpp>
@@ -26,6 +35,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <unordered_set>
+#include <map>
 #include <future>
 #include <fstream>
 #include <iomanip>
@@ -43,6 +53,10 @@ namespace net = boost::asio;
 
 std::atomic<bool> g_shutdown{false};
 
+// Trade logs and the persisted position; paper sessions use their own
+// directory so they can run next to production. Set once before startup.
+std::string g_trade_log_dir = "trade_logs";
+
 // Non-blocking stdin read that respects g_shutdown (Ctrl+C)
 bool read_stdin_line(std::string& line) {
     struct pollfd pfd{};
@@ -162,6 +176,20 @@ void print_balance_section(const std::string& exchange_name,
     }
 }
 
+// Venue clock offset/drift and the offset-corrected venue event -> kernel RX latency
+template<typename ExchangePtr>
+void log_clock_sync(const ExchangePtr& exchange_ptr) {
+    if (!exchange_ptr) return;
+    const auto stats = exchange_ptr->get_clock_sync_stats();
+    if (!stats.clock.synced) return;
+    const auto& feed = stats.feed_latency;
+    spdlog::info("[ClockSync] {} offset {:+.3f}ms ±{:.3f}ms drift {:+.1f}ppm rtt {:.3f}ms samples={} steps={} | "
+                 "feed latency n={} avg {:.1f}us p50 <{:.0f}us p99 <{:.0f}us max {:.1f}us negative={}",
+                 exchange_ptr->get_name(), stats.clock.offset_ns / 1e6, stats.clock.error_ns / 1e6,
+                 stats.clock.drift_ppm, stats.clock.rtt_ns / 1e6, stats.clock.samples, stats.clock_steps,
+                 feed.count, feed.avg_us, feed.p50_us, feed.p99_us, feed.max_us, feed.negative);
+}
+
 void append_trade_log(const kimp::Position& pos,
                       double pnl_usd,
                       double usdt_rate,
@@ -170,8 +198,8 @@ void append_trade_log(const kimp::Position& pos,
     static std::mutex log_mutex;
     std::lock_guard<std::mutex> lock(log_mutex);
 
-    std::filesystem::create_directories("trade_logs");
-    const std::string path = "trade_logs/trades.csv";
+    std::filesystem::create_directories(g_trade_log_dir);
+    const std::string path = g_trade_log_dir + "/trades.csv";
 
     bool need_header = !std::filesystem::exists(path) ||
                        std::filesystem::file_size(path) == 0;
@@ -217,18 +245,22 @@ void append_trade_log(const kimp::Position& pos,
 // =========================================================================
 // Position persistence for crash recovery
 // =========================================================================
-const std::string ACTIVE_POSITION_PATH = "trade_logs/active_position.json";
+std::string active_position_path() {
+    return g_trade_log_dir + "/active_position.json";
+}
 
 void save_active_position(const kimp::Position& pos) {
     std::error_code ec;
-    std::filesystem::create_directories("trade_logs", ec);
+    std::filesystem::create_directories(g_trade_log_dir, ec);
     if (ec) {
-        spdlog::error("[PERSIST] Failed to create trade_logs dir: {}", ec.message());
+        spdlog::error("[PERSIST] Failed to create {} dir: {}", g_trade_log_dir, ec.message());
         return;
     }
 
     auto entry_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         pos.entry_time.time_since_epoch()).count();
+    auto borrow_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        pos.borrow_accrued_at.time_since_epoch()).count();
 
     std::string json = fmt::format(
         "{{\n"
@@ -240,22 +272,29 @@ void save_active_position(const kimp::Position& pos) {
         "  \"entry_premium\": {:.6f},\n"
         "  \"position_size_usd\": {:.2f},\n"
         "  \"korean_amount\": {:.8f},\n"
+        "  \"korean_split_amount\": {:.8f},\n"
         "  \"foreign_amount\": {:.8f},\n"
+        "  \"korean_account\": {},\n"
+        "  \"foreign_account\": {},\n"
         "  \"korean_entry_price\": {},\n"
         "  \"foreign_entry_price\": {:.8f},\n"
         "  \"realized_pnl_krw\": {:.2f},\n"
+        "  \"borrow_interest_coins\": {:.10f},\n"
+        "  \"borrow_accrued_at_ms\": {},\n"
         "  \"is_active\": true\n"
         "}}",
         pos.symbol.get_base(), pos.symbol.get_quote(),
         static_cast<int>(pos.korean_exchange), static_cast<int>(pos.foreign_exchange),
         entry_ms, pos.entry_premium, pos.position_size_usd,
-        pos.korean_amount, pos.foreign_amount,
+        pos.korean_amount, pos.korean_split_amount, pos.foreign_amount,
+        static_cast<int>(pos.korean_account), static_cast<int>(pos.foreign_account),
         kimp::format::format_decimal_trimmed(pos.korean_entry_price), pos.foreign_entry_price,
-        pos.realized_pnl_krw
+        pos.realized_pnl_krw, pos.borrow_interest_coins, borrow_ms
     );
 
     // Atomic write: temp file → rename
-    const std::string tmp_path = ACTIVE_POSITION_PATH + ".tmp";
+    const std::string path = active_position_path();
+    const std::string tmp_path = path + ".tmp";
     std::ofstream out(tmp_path, std::ios::trunc);
     if (!out) {
         spdlog::error("[PERSIST] Failed to open temp file: {}", tmp_path);
@@ -275,7 +314,7 @@ void save_active_position(const kimp::Position& pos) {
         ::close(fd);
     }
 
-    std::filesystem::rename(tmp_path, ACTIVE_POSITION_PATH, ec);
+    std::filesystem::rename(tmp_path, path, ec);
     if (ec) {
         spdlog::error("[PERSIST] Failed to rename temp file: {}", ec.message());
         return;
@@ -285,11 +324,12 @@ void save_active_position(const kimp::Position& pos) {
 }
 
 std::optional<kimp::Position> load_active_position() {
-    if (!std::filesystem::exists(ACTIVE_POSITION_PATH)) return std::nullopt;
+    const std::string path = active_position_path();
+    if (!std::filesystem::exists(path)) return std::nullopt;
 
     try {
         simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.load(ACTIVE_POSITION_PATH);
+        simdjson::dom::element doc = parser.load(path);
 
         kimp::Position pos;
         std::string_view base = doc["symbol_base"];
@@ -312,6 +352,30 @@ std::optional<kimp::Position> load_active_position() {
         if (!pnl_field.error()) {
             pos.realized_pnl_krw = double(pnl_field.value());
         }
+        // Coins on the other Korean venue (absent before split routing)
+        auto split_field = doc.at_key("korean_split_amount");
+        if (!split_field.error()) {
+            pos.korean_split_amount = double(split_field.value());
+        }
+        // Borrow interest settled so far (absent before borrow accrual: accrues from entry)
+        auto borrow_field = doc.at_key("borrow_interest_coins");
+        if (!borrow_field.error()) {
+            pos.borrow_interest_coins = double(borrow_field.value());
+        }
+        // Accounts holding the legs (absent before account sharding: the main accounts)
+        auto korean_account_field = doc.at_key("korean_account");
+        if (!korean_account_field.error()) {
+            pos.korean_account = static_cast<uint8_t>(int64_t(korean_account_field.value()));
+        }
+        auto foreign_account_field = doc.at_key("foreign_account");
+        if (!foreign_account_field.error()) {
+            pos.foreign_account = static_cast<uint8_t>(int64_t(foreign_account_field.value()));
+        }
+        auto borrow_at_field = doc.at_key("borrow_accrued_at_ms");
+        if (!borrow_at_field.error()) {
+            pos.borrow_accrued_at = kimp::SystemTimestamp(
+                std::chrono::milliseconds(int64_t(borrow_at_field.value())));
+        }
         pos.is_active = true;
 
         return pos;
@@ -323,7 +387,7 @@ std::optional<kimp::Position> load_active_position() {
 
 void delete_active_position() {
     std::error_code ec;
-    bool removed = std::filesystem::remove(ACTIVE_POSITION_PATH, ec);
+    bool removed = std::filesystem::remove(active_position_path(), ec);
     if (ec) {
         spdlog::warn("[PERSIST] Failed to delete position file: {}", ec.message());
     } else if (removed) {
@@ -375,6 +439,75 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
         if (yaml["threading"]) {
             auto t = yaml["threading"];
             if (t["io_threads"]) config.io_threads = t["io_threads"].as<int>();
+            if (auto bp = t["busy_poll"]) {
+                if (bp["enabled"]) config.io_busy_poll = bp["enabled"].as<bool>();
+                if (bp["spin_idle_us"]) config.io_spin_idle_us = bp["spin_idle_us"].as<int>();
+                if (bp["max_idle_sleep_us"]) config.io_max_idle_sleep_us = bp["max_idle_sleep_us"].as<int>();
+                if (bp["socket_busy_poll_us"]) config.socket_busy_poll_us = bp["socket_busy_poll_us"].as<int>();
+                if (bp["socket_rcvbuf_bytes"]) config.socket_rcvbuf_bytes = bp["socket_rcvbuf_bytes"].as<int>();
+            }
+        }
+
+        if (yaml["performance"]) {
+            auto p = yaml["performance"];
+            if (p["ktls"]) config.ktls_offload = p["ktls"].as<bool>();
+        }
+
+        if (yaml["fx"]) {
+            auto f = yaml["fx"];
+            if (f["epsilon_bps"]) config.fx_epsilon_bps = f["epsilon_bps"].as<double>();
+            if (f["max_deviation_bps"]) config.fx_max_deviation_bps = f["max_deviation_bps"].as<double>();
+            if (f["stale_ms"]) config.fx_stale_ms = f["stale_ms"].as<int>();
+            if (f["reseed_after"]) config.fx_reseed_after = f["reseed_after"].as<int>();
+        }
+
+        if (yaml["routing"]) {
+            auto r = yaml["routing"];
+            if (r["korean_split"]) config.korean_split_routing = r["korean_split"].as<bool>();
+            if (r["max_book_age_ms"]) config.routing_max_book_age_ms = r["max_book_age_ms"].as<int>();
+            if (r["min_gain_krw"]) config.routing_min_gain_krw = r["min_gain_krw"].as<double>();
+            if (r["max_price_gap_bps"]) config.routing_max_price_gap_bps = r["max_price_gap_bps"].as<double>();
+        }
+
+        if (yaml["execution"] && yaml["execution"]["price_protection"]) {
+            auto pp = yaml["execution"]["price_protection"];
+            if (pp["enabled"]) config.price_protection = pp["enabled"].as<bool>();
+            if (pp["band_bps"]) config.price_protection_band_bps = pp["band_bps"].as<double>();
+            if (pp["reprice_attempts"]) config.price_protection_reprice_attempts = pp["reprice_attempts"].as<int>();
+        }
+        if (yaml["execution"] && yaml["execution"]["maker_entry"]) {
+            auto mk = yaml["execution"]["maker_entry"];
+            if (mk["enabled"]) config.maker_entry = mk["enabled"].as<bool>();
+            if (mk["edge_buffer_pct"]) config.maker_edge_buffer_pct = mk["edge_buffer_pct"].as<double>();
+            if (mk["reprice_bps"]) config.maker_reprice_bps = mk["reprice_bps"].as<double>();
+            if (mk["max_rest_ms"]) config.maker_max_rest_ms = mk["max_rest_ms"].as<int>();
+            if (mk["min_hedge_usdt"]) config.maker_min_hedge_usdt = mk["min_hedge_usdt"].as<double>();
+        }
+        if (yaml["execution"] && yaml["execution"]["order_submit"]) {
+            auto os = yaml["execution"]["order_submit"];
+            if (os["timeout_ms"]) config.order_submit_timeout_ms = os["timeout_ms"].as<int>();
+            if (os["attempts"]) config.order_submit_attempts = os["attempts"].as<int>();
+            if (os["lookup_delay_ms"]) config.order_submit_lookup_delay_ms = os["lookup_delay_ms"].as<int>();
+        }
+
+        if (yaml["borrow"]) {
+            auto b = yaml["borrow"];
+            if (b["enabled"]) config.borrow_cost = b["enabled"].as<bool>();
+            if (b["refresh_sec"]) config.borrow_refresh_sec = b["refresh_sec"].as<int>();
+            if (b["expected_hold_hours"]) config.borrow_expected_hold_hours = b["expected_hold_hours"].as<double>();
+        }
+
+        if (yaml["flight_recorder"]) {
+            auto fr = yaml["flight_recorder"];
+            if (fr["enabled"]) config.flight_recorder = fr["enabled"].as<bool>();
+            if (fr["window_sec"]) config.flight_window_sec = fr["window_sec"].as<int>();
+            if (fr["events_per_thread"]) config.flight_events_per_thread = fr["events_per_thread"].as<int>();
+        }
+
+        if (yaml["listing"]) {
+            auto l = yaml["listing"];
+            if (l["enabled"]) config.listing_watch = l["enabled"].as<bool>();
+            if (l["poll_sec"]) config.listing_poll_sec = l["poll_sec"].as<int>();
         }
 
         // Exchanges
@@ -383,6 +516,14 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
             return std::nullopt;
         }
 
+        auto load_ws_deflate = [](const YAML::Node& e, kimp::ExchangeCredentials& creds) {
+            if (e["ws_deflate"]) creds.ws_deflate = e["ws_deflate"].as<bool>();
+            if (e["ws_deflate_context_takeover"]) {
+                creds.ws_deflate_context_takeover = e["ws_deflate_context_takeover"].as<bool>();
+            }
+            if (e["ws_deflate_window_bits"]) creds.ws_deflate_window_bits = e["ws_deflate_window_bits"].as<int>();
+        };
+
         auto load_exchange = [&](const std::string& name, kimp::Exchange ex) -> bool {
             if (!yaml["exchanges"][name]) {
                 std::cerr << "Exchange '" << name << "' not found in config" << std::endl;
@@ -402,6 +543,9 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
             if (e["ws_private_endpoint"]) creds.ws_private_endpoint = e["ws_private_endpoint"].as<std::string>();
             if (e["ws_trade_endpoint"]) creds.ws_trade_endpoint = e["ws_trade_endpoint"].as<std::string>();
             if (e["rest_endpoint"]) creds.rest_endpoint = e["rest_endpoint"].as<std::string>();
+            if (e["redundant_feed"]) creds.redundant_feed = e["redundant_feed"].as<bool>();
+            if (e["ws_rotate_minutes"]) creds.ws_rotate_minutes = e["ws_rotate_minutes"].as<int>();
+            load_ws_deflate(e, creds);
             if (e["api_key"]) {
                 std::string raw = e["api_key"].as<std::string>();
                 creds.api_key = require_private_keys ? expand_env(raw) : expand_env(raw);
@@ -457,6 +601,9 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
                 if (okx_node["ws_private_endpoint"]) okx_creds.ws_private_endpoint = okx_node["ws_private_endpoint"].as<std::string>();
                 if (okx_node["ws_trade_endpoint"]) okx_creds.ws_trade_endpoint = okx_node["ws_trade_endpoint"].as<std::string>();
                 if (okx_node["rest_endpoint"]) okx_creds.rest_endpoint = okx_node["rest_endpoint"].as<std::string>();
+                if (okx_node["redundant_feed"]) okx_creds.redundant_feed = okx_node["redundant_feed"].as<bool>();
+                if (okx_node["ws_rotate_minutes"]) okx_creds.ws_rotate_minutes = okx_node["ws_rotate_minutes"].as<int>();
+                load_ws_deflate(okx_node, okx_creds);
                 if (okx_node["api_key"]) okx_creds.api_key = expand_env(okx_node["api_key"].as<std::string>());
                 if (okx_node["secret_key"]) okx_creds.secret_key = expand_env(okx_node["secret_key"].as<std::string>());
                 if (okx_node["passphrase"]) okx_creds.passphrase = expand_env(okx_node["passphrase"].as<std::string>());
@@ -483,6 +630,9 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
             if (upbit_creds.enabled) {
                 if (upbit_node["ws_endpoint"]) upbit_creds.ws_endpoint = upbit_node["ws_endpoint"].as<std::string>();
                 if (upbit_node["rest_endpoint"]) upbit_creds.rest_endpoint = upbit_node["rest_endpoint"].as<std::string>();
+                if (upbit_node["redundant_feed"]) upbit_creds.redundant_feed = upbit_node["redundant_feed"].as<bool>();
+                if (upbit_node["ws_rotate_minutes"]) upbit_creds.ws_rotate_minutes = upbit_node["ws_rotate_minutes"].as<int>();
+                load_ws_deflate(upbit_node, upbit_creds);
                 if (upbit_node["api_key"]) upbit_creds.api_key = expand_env(upbit_node["api_key"].as<std::string>());
                 if (upbit_node["secret_key"]) upbit_creds.secret_key = expand_env(upbit_node["secret_key"].as<std::string>());
                 // Upbit doesn't need credentials for public data (monitor-only)
@@ -492,6 +642,46 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
             }
         }
 
+        // Extra accounts: the venue's endpoints with another key pair
+        if (yaml["accounts"]) {
+            auto a = yaml["accounts"];
+            if (a["order_rate_per_sec"]) config.account_order_rate_per_sec = a["order_rate_per_sec"].as<double>();
+            if (a["order_burst"]) config.account_order_burst = a["order_burst"].as<double>();
+            if (a["balance_refresh_sec"]) config.account_balance_refresh_sec = a["balance_refresh_sec"].as<int>();
+
+            const std::pair<const char*, kimp::Exchange> venues[] = {
+                {"bithumb", kimp::Exchange::Bithumb},
+                {"upbit", kimp::Exchange::Upbit},
+                {"bybit", kimp::Exchange::Bybit},
+                {"okx", kimp::Exchange::OKX},
+            };
+            for (const auto& [name, ex] : venues) {
+                if (!a[name]) continue;
+                auto main_it = config.exchanges.find(ex);
+                if (main_it == config.exchanges.end() || !main_it->second.enabled) {
+                    std::cerr << "accounts." << name << ": exchange not enabled, ignored" << std::endl;
+                    continue;
+                }
+                std::size_t index = 0;
+                for (const auto& node : a[name]) {
+                    ++index;
+                    kimp::ExchangeCredentials creds = main_it->second;
+                    creds.api_key = node["api_key"] ? expand_env(node["api_key"].as<std::string>()) : "";
+                    creds.secret_key = node["secret_key"] ? expand_env(node["secret_key"].as<std::string>()) : "";
+                    creds.passphrase = node["passphrase"] ? expand_env(node["passphrase"].as<std::string>()) : "";
+                    creds.redundant_feed = false;  // Trading only: no market data of its own
+                    creds.ws_rotate_minutes = 0;
+                    if (creds.api_key.empty() || creds.secret_key.empty() ||
+                        (ex == kimp::Exchange::OKX && creds.passphrase.empty())) {
+                        std::cerr << "accounts." << name << " #" << index
+                                  << ": credentials missing, account skipped" << std::endl;
+                        continue;
+                    }
+                    config.extra_accounts[ex].push_back(std::move(creds));
+                }
+            }
+        }
+
     } catch (const YAML::Exception& e) {
         std::cerr << "Failed to parse config '" << path << "': "
                   << e.what() << std::endl;
@@ -501,6 +691,64 @@ std::optional<kimp::RuntimeConfig> load_config(const std::string& path,
     return config;
 }
 
+// Measured latency quantiles: {p50: 12, p99: 40, max: 90} (ms); min/max = q0/q1
+kimp::execution::LatencyDistribution parse_latency_quantiles(const YAML::Node& node) {
+    std::vector<kimp::execution::LatencyDistribution::Knot> knots;
+    for (const auto& kv : node) {
+        const auto key = kv.first.as<std::string>();
+        double q = -1.0;
+        if (key == "min") {
+            q = 0.0;
+        } else if (key == "max") {
+            q = 1.0;
+        } else if (key.size() > 1 && key[0] == 'p') {
+            q = std::stod(key.substr(1)) / 100.0;
+        }
+        if (q < 0.0 || q > 1.0) {
+            throw YAML::Exception(kv.first.Mark(), "latency quantile keys are min, max or pNN");
+        }
+        knots.push_back({q, kv.second.as<double>()});
+    }
+    return kimp::execution::LatencyDistribution(std::move(knots));
+}
+
+// Paper trading model (paper: section). Venues without measured latencies
+// keep the built-in defaults.
+std::optional<kimp::execution::PaperExecution::Options> load_paper_options(const std::string& path) {
+    auto options = kimp::execution::PaperExecution::Options::with_default_latencies();
+    try {
+        YAML::Node yaml = YAML::LoadFile(path);
+        auto p = yaml["paper"];
+        if (!p) {
+            return options;
+        }
+        if (p["beyond_depth_slippage_bps"]) options.beyond_depth_slippage_bps = p["beyond_depth_slippage_bps"].as<double>();
+        if (p["max_book_age_ms"]) options.max_book_age_ms = p["max_book_age_ms"].as<uint64_t>();
+        if (p["initial_krw"]) options.initial_krw = p["initial_krw"].as<double>();
+        if (p["initial_usdt"]) options.initial_usdt = p["initial_usdt"].as<double>();
+        if (p["seed"]) options.seed = p["seed"].as<uint64_t>();
+        if (auto latency = p["latency"]) {
+            const std::pair<const char*, kimp::Exchange> venues[] = {
+                {"bithumb", kimp::Exchange::Bithumb},
+                {"upbit", kimp::Exchange::Upbit},
+                {"bybit", kimp::Exchange::Bybit},
+                {"okx", kimp::Exchange::OKX},
+            };
+            for (const auto& [name, ex] : venues) {
+                auto v = latency[name];
+                if (!v) continue;
+                auto& model = options.venues[static_cast<size_t>(ex)];
+                if (v["submit_ms"]) model.submit = parse_latency_quantiles(v["submit_ms"]);
+                if (v["fill_ms"]) model.fill_report = parse_latency_quantiles(v["fill_ms"]);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to parse paper section of '" << path << "': " << e.what() << std::endl;
+        return std::nullopt;
+    }
+    return options;
+}
+
 int main(int argc, char* argv[]) {
     kimp::load_dotenv_if_present(nullptr, &std::cerr);
 
@@ -515,6 +763,15 @@ int main(int argc, char* argv[]) {
     std::optional<bool> latency_summary_override;
     kimp::LatencyOutputMode latency_output_mode = kimp::LatencyOutputMode::MmapBinary;
     int monitor_interval_sec = 1;
+    bool redundant_feeds = false;
+    int ws_rotate_minutes = 0;
+    bool busy_poll = false;
+    bool ktls_offload = false;
+    bool paper_trading = false;
+    std::optional<std::string> fill_report_path;
+    std::string flight_decode_path;
+    std::string md_gateway_name;
+    std::string md_attach_name;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -571,6 +828,44 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Error: --latency-probe-output must be csv, binary, or mmap\n";
                 return 1;
             }
+        } else if (arg == "--redundant-feeds") {
+            redundant_feeds = true;
+        } else if (arg == "--ws-rotate-min") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --ws-rotate-min requires a numeric argument\n";
+                return 1;
+            }
+            ws_rotate_minutes = std::stoi(argv[++i]);
+            if (ws_rotate_minutes <= 0) {
+                std::cerr << "Error: --ws-rotate-min must be > 0\n";
+                return 1;
+            }
+        } else if (arg == "--busy-poll") {
+            busy_poll = true;
+        } else if (arg == "--ktls") {
+            ktls_offload = true;
+        } else if (arg == "--paper") {
+            paper_trading = true;
+            monitor_only = false;
+        } else if (arg == "--md-gateway" || arg == "--md-attach") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a shared-memory name\n";
+                return 1;
+            }
+            (arg == "--md-gateway" ? md_gateway_name : md_attach_name) = argv[++i];
+            if (arg == "--md-gateway") {
+                monitor_only = true;
+                monitor_mode = false;
+            }
+        } else if (arg == "--fill-report") {
+            // Optional path; default is the run's trade log dir
+            fill_report_path = (i + 1 < argc && argv[i + 1][0] != '-') ? std::string(argv[++i]) : std::string();
+        } else if (arg == "--flight-decode") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --flight-decode requires a dump path\n";
+                return 1;
+            }
+            flight_decode_path = argv[++i];
         } else if (arg == "--monitor-interval-sec") {
             if (i + 1 >= argc) {
                 std::cerr << "Error: --monitor-interval-sec requires a numeric argument\n";
@@ -600,6 +895,15 @@ int main(int argc, char* argv[]) {
                       << "      --show-balances  Print non-zero balances on all configured exchanges\n"
                       << "      --manual-confirm-once  Wait for one live candidate, prompt, and trade only after manual confirmation\n"
                       << "      --monitor-interval-sec <n>  Monitor refresh interval (default: 2)\n"
+                      << "      --redundant-feeds  Subscribe every public stream on two connections (A/B) and forward first arrival\n"
+                      << "      --ws-rotate-min <n>  Rotate public streams make-before-break every n minutes (default: off)\n"
+                      << "      --busy-poll      Spin-poll io threads instead of sleeping in epoll (isolated cores only)\n"
+                      << "      --ktls           Kernel TLS offload for venue WS/REST (Linux, TLS 1.3; falls back per connection)\n"
+                      << "      --paper          Live feeds, simulated execution (no API keys; logs under trade_logs/paper)\n"
+                      << "      --fill-report [path]  Summarize fill_quality.bin (slippage / latency loss) and exit\n"
+                      << "      --flight-decode <path>  Print a flight recorder dump (trade_logs/flight) and exit\n"
+                      << "      --md-gateway <name>  Market-data gateway: own the public feeds, publish to shared memory <name>\n"
+                      << "      --md-attach <name>  Take public market data from a running --md-gateway instead of own feeds\n"
                       << "  -h, --help           Show this help\n";
             return 0;
         } else {
@@ -611,6 +915,47 @@ int main(int argc, char* argv[]) {
     std::signal(SIGINT, signal_handler);
     std::signal(SIGTERM, signal_handler);
 
+    if (fill_report_path) {
+        if (paper_trading) {
+            g_trade_log_dir = "trade_logs/paper";
+        }
+        const std::string path = fill_report_path->empty()
+            ? g_trade_log_dir + "/fill_quality.bin" : *fill_report_path;
+        std::vector<kimp::execution::FillQualityRecord> records;
+        std::string error;
+        if (!kimp::execution::read_fill_quality(path, records, &error)) {
+            std::cerr << "Error: " << error << "\n";
+            return 1;
+        }
+        std::cout << kimp::execution::format_fill_quality_report(records);
+        return 0;
+    }
+
+    if (!flight_decode_path.empty()) {
+        kimp::FlightDump dump;
+        std::string error;
+        if (!kimp::read_flight_dump(flight_decode_path, dump, &error)) {
+            std::cerr << "Error: " << error << "\n";
+            return 1;
+        }
+        std::cout << kimp::format_flight_dump(dump);
+        return 0;
+    }
+
+    if (!md_gateway_name.empty() && !md_attach_name.empty()) {
+        std::cerr << "Error: --md-gateway and --md-attach are mutually exclusive\n";
+        return 1;
+    }
+
+    if (paper_trading) {
+        if (monitor_only) {
+            std::cerr << "Error: --paper cannot be combined with monitor-only modes\n";
+            return 1;
+        }
+        g_trade_log_dir = "trade_logs/paper";
+        kimp::execution::OrderManager::set_trade_log_dir(g_trade_log_dir);
+    }
+
     const bool latency_probe_enabled = latency_probe_override.value_or(!monitor_only && !scan_spot_relay);
     const bool latency_summary_enabled = latency_summary_override.value_or(false);
     kimp::LatencyProbeStartOptions latency_probe_options;
@@ -619,16 +964,16 @@ int main(int argc, char* argv[]) {
     latency_probe_options.summary_enabled = latency_summary_enabled;
     switch (latency_output_mode) {
         case kimp::LatencyOutputMode::CsvText:
-            latency_probe_options.events_path = "trade_logs/latency_events.csv";
+            latency_probe_options.events_path = g_trade_log_dir + "/latency_events.csv";
             break;
         case kimp::LatencyOutputMode::Binary:
-            latency_probe_options.events_path = "trade_logs/latency_events.bin";
+            latency_probe_options.events_path = g_trade_log_dir + "/latency_events.bin";
             break;
         case kimp::LatencyOutputMode::MmapBinary:
-            latency_probe_options.events_path = "trade_logs/latency_events.mmapbin";
+            latency_probe_options.events_path = g_trade_log_dir + "/latency_events.mmapbin";
             break;
     }
-    latency_probe_options.summary_path = "trade_logs/latency_summary.csv";
+    latency_probe_options.summary_path = g_trade_log_dir + "/latency_summary.csv";
     kimp::LatencyProbe::instance().start(std::move(latency_probe_options));
     struct LatencyProbeGuard {
         ~LatencyProbeGuard() {
@@ -636,13 +981,48 @@ int main(int argc, char* argv[]) {
         }
     } latency_probe_guard;
 
-    auto config_opt = load_config(config_path, !(monitor_only || scan_spot_relay));
+    auto config_opt = load_config(config_path, !(monitor_only || scan_spot_relay || paper_trading));
     if (!config_opt) {
         return 1;
     }
     auto config = std::move(*config_opt);
+    if (config.flight_recorder) {
+        kimp::FlightRecorderOptions flight_options;
+        flight_options.dir = g_trade_log_dir + "/flight";
+        flight_options.window_sec = static_cast<uint32_t>(std::max(1, config.flight_window_sec));
+        flight_options.events_per_thread = static_cast<std::size_t>(std::max(64, config.flight_events_per_thread));
+        kimp::FlightRecorder::configure(flight_options);
+        kimp::FlightRecorder::install_signal_handlers();
+    }
+    std::optional<kimp::execution::PaperExecution::Options> paper_options;
+    if (paper_trading) {
+        paper_options = load_paper_options(config_path);
+        if (!paper_options) {
+            return 1;
+        }
+        // Own log file so a paper session can run next to production
+        const std::filesystem::path log_path(config.log_file);
+        config.log_file = (log_path.parent_path() /
+                           (log_path.stem().string() + "_paper" + log_path.extension().string())).string();
+    }
+    if (redundant_feeds) {
+        for (auto& entry : config.exchanges) {
+            entry.second.redundant_feed = true;
+        }
+    }
+    if (ws_rotate_minutes > 0) {
+        for (auto& entry : config.exchanges) {
+            entry.second.ws_rotate_minutes = ws_rotate_minutes;
+        }
+    }
+    if (busy_poll) {
+        config.io_busy_poll = true;
+    }
+    if (ktls_offload) {
+        config.ktls_offload = true;
+    }
     const bool dashboard_stream_enabled =
-        dashboard_stream_override.value_or(monitor_only);
+        dashboard_stream_override.value_or(monitor_only && md_gateway_name.empty());
 
     std::error_code ec;
     std::filesystem::create_directories("logs", ec);
@@ -659,7 +1039,8 @@ int main(int argc, char* argv[]) {
     // In monitor mode, logs go to file only (no console spam)
     if (!kimp::Logger::init(config.log_file, config.log_level,
                             config.log_max_size_mb, config.log_max_files,
-                            8192, !monitor_mode)) {
+                            8192, !monitor_mode,
+                            kimp::opt::ThreadConfig::optimal().logger_core)) {
         std::cerr << "Failed to initialize logger" << std::endl;
         return 1;
     }
@@ -688,6 +1069,21 @@ int main(int argc, char* argv[]) {
 
     net::io_context io_context;
     auto work_guard = net::make_work_guard(io_context);
+    kimp::exchange::ExchangeBase::set_market_data_socket_tuning(
+        {config.socket_busy_poll_us, config.socket_rcvbuf_bytes});
+    kimp::network::ktls::set_enabled(config.ktls_offload);
+    {
+        kimp::exchange::OrderSubmitPolicy submit_policy;
+        submit_policy.timeout = std::chrono::milliseconds(std::max(100, config.order_submit_timeout_ms));
+        submit_policy.attempts = std::max(1, config.order_submit_attempts);
+        submit_policy.lookup_delay = std::chrono::milliseconds(std::max(0, config.order_submit_lookup_delay_ms));
+        kimp::exchange::ExchangeBase::set_order_submit_policy(submit_policy);
+        spdlog::info("[ORDER-SUBMIT] {} ms submit timeout, {} attempt(s) per client order id",
+                     submit_policy.timeout.count(), submit_policy.attempts);
+    }
+    if (config.ktls_offload && !kimp::network::ktls::kernel_available()) {
+        spdlog::warn("[kTLS] tls ULP not loaded (modprobe tls); connections will try it and fall back to user-space TLS");
+    }
 
     // Create exchanges (Bithumb: Korean spot, Bybit + OKX: spot margin short venues)
     // load_config guarantees Bithumb + Bybit entries exist; check enabled flag only
@@ -739,6 +1135,9 @@ int main(int argc, char* argv[]) {
             spdlog::info("Upbit exchange not configured or disabled — running with Bithumb only");
         }
     }
+    if (paper_trading && upbit_enabled) {
+        upbit_trade_enabled = true;  // Simulated fills need no API keys
+    }
 
     if (show_balances) {
         auto fetch_balances = [](const std::string& name, auto& exchange_ptr) {
@@ -770,6 +1169,15 @@ int main(int argc, char* argv[]) {
 
     // Strategy engine
     kimp::strategy::ArbitrageEngine engine;
+    {
+        kimp::strategy::UsdtKrwEstimator::Options fx;
+        fx.epsilon_bps = config.fx_epsilon_bps;
+        fx.max_deviation_bps = config.fx_max_deviation_bps;
+        fx.stale_ms = config.fx_stale_ms;
+        fx.reseed_after = static_cast<uint32_t>(std::max(1, config.fx_reseed_after));
+        engine.set_usdt_estimator_options(fx);
+        engine.get_borrow_cost().set_expected_hold_hours(config.borrow_expected_hold_hours);
+    }
     engine.set_exchange(kimp::Exchange::Bithumb, bithumb);
     engine.set_exchange(kimp::Exchange::Bybit, bybit);
     engine.add_exchange_pair(kimp::Exchange::Bithumb, kimp::Exchange::Bybit);
@@ -793,14 +1201,98 @@ int main(int argc, char* argv[]) {
 
     // Order manager for auto-trading
     kimp::execution::OrderManager order_manager;
+    kimp::execution::AccountPool::Options account_options;
+    account_options.order_rate_per_sec = std::max(0.1, config.account_order_rate_per_sec);
+    account_options.order_burst = std::max(1.0, config.account_order_burst);
     order_manager.set_engine(&engine);
-    order_manager.set_exchange(kimp::Exchange::Bithumb, bithumb);
-    order_manager.set_exchange(kimp::Exchange::Bybit, bybit);
+    order_manager.set_exchange(kimp::Exchange::Bithumb, bithumb, account_options);
+    order_manager.set_exchange(kimp::Exchange::Bybit, bybit, account_options);
     if (upbit_trade_enabled) {
-        order_manager.set_exchange(kimp::Exchange::Upbit, upbit);
+        order_manager.set_exchange(kimp::Exchange::Upbit, upbit, account_options);
     }
     if (okx_enabled) {
-        order_manager.set_exchange(kimp::Exchange::OKX, okx);
+        order_manager.set_exchange(kimp::Exchange::OKX, okx, account_options);
+    }
+
+    // Extra accounts: own connector each (REST client, signer, trade and
+    // private streams) with no market data; lifecycles are sharded across them
+    std::vector<std::shared_ptr<kimp::exchange::IExchange>> account_connectors;
+    if (!monitor_only && !paper_trading) {
+        for (auto& [ex, accounts] : config.extra_accounts) {
+            for (auto& creds : accounts) {
+                std::shared_ptr<kimp::exchange::IExchange> connector;
+                if (ex == kimp::Exchange::Bithumb) {
+                    connector = std::make_shared<kimp::exchange::bithumb::BithumbExchange>(io_context, std::move(creds));
+                } else if (ex == kimp::Exchange::Upbit && upbit_trade_enabled) {
+                    connector = std::make_shared<kimp::exchange::upbit::UpbitExchange>(io_context, std::move(creds));
+                } else if (ex == kimp::Exchange::Bybit) {
+                    connector = std::make_shared<kimp::exchange::bybit::BybitExchange>(io_context, std::move(creds));
+                } else if (ex == kimp::Exchange::OKX && okx_enabled) {
+                    connector = std::make_shared<kimp::exchange::okx::OkxExchange>(io_context, std::move(creds));
+                }
+                if (!connector) {
+                    spdlog::warn("[ACCOUNTS] {} is not trading; extra account ignored", kimp::exchange_name(ex));
+                    continue;
+                }
+                const int index = order_manager.add_account(ex, connector, account_options);
+                if (index < 0) {
+                    spdlog::warn("[ACCOUNTS] {} account limit ({}) reached; extra account ignored",
+                                 kimp::exchange_name(ex), kimp::execution::AccountPool::MAX_ACCOUNTS);
+                    continue;
+                }
+                account_connectors.push_back(std::move(connector));
+                spdlog::info("[ACCOUNTS] {} account #{} added", kimp::exchange_name(ex), index);
+            }
+        }
+    } else if (!config.extra_accounts.empty()) {
+        spdlog::info("[ACCOUNTS] Extra accounts unused in monitor/paper mode");
+    }
+
+    // Paper trading: orders are simulated against the live books
+    std::shared_ptr<kimp::execution::PaperExecution> paper_execution;
+    if (paper_trading) {
+        paper_execution = std::make_shared<kimp::execution::PaperExecution>(
+            &engine.get_price_cache(), std::move(*paper_options));
+        order_manager.set_execution_backend(paper_execution);
+        spdlog::info("[Paper] Simulated execution enabled; trade logs under {}/", g_trade_log_dir);
+    }
+
+    // Split routing of the Korean leg across Bithumb and Upbit
+    std::shared_ptr<kimp::execution::KoreanLegRouter> korean_router;
+    if (config.korean_split_routing) {
+        if (upbit_trade_enabled) {
+            kimp::execution::KoreanLegRouter::Options routing;
+            routing.max_book_age_ms = static_cast<uint64_t>(std::max(1, config.routing_max_book_age_ms));
+            routing.min_gain_krw = config.routing_min_gain_krw;
+            routing.max_price_gap_bps = config.routing_max_price_gap_bps;
+            korean_router = std::make_shared<kimp::execution::KoreanLegRouter>(routing);
+            order_manager.set_korean_router(korean_router);
+            spdlog::info("[SOR] Korean leg split across Bithumb and Upbit by depth");
+        } else {
+            spdlog::warn("[SOR] routing.korean_split needs Upbit trading; Korean leg stays on one venue");
+        }
+    }
+
+    if (config.price_protection) {
+        kimp::execution::OrderManager::PriceProtection protection;
+        protection.enabled = true;
+        protection.band_bps = std::max(0.1, config.price_protection_band_bps);
+        protection.reprice_attempts = std::max(0, config.price_protection_reprice_attempts);
+        order_manager.set_price_protection(protection);
+        spdlog::info("[PRICE-GUARD] IOC limit legs within {:.1f} bps of the signal quote",
+                     protection.band_bps);
+    }
+
+    if (config.maker_entry) {
+        kimp::execution::OrderManager::MakerEntry maker;
+        maker.enabled = true;
+        maker.edge_buffer_pct = std::max(0.0, config.maker_edge_buffer_pct);
+        maker.reprice_bps = std::max(0.1, config.maker_reprice_bps);
+        maker.max_rest_ms = std::max(100, config.maker_max_rest_ms);
+        maker.min_hedge_usdt = std::max(1.0, config.maker_min_hedge_usdt);
+        order_manager.set_maker_entry(maker);
+        spdlog::info("[MAKER-ENTRY] Post-only Korean bid on Upbit, hedged per fill (rest <= {} ms)",
+                     maker.max_rest_ms);
     }
 
     // Position persistence callback (crash recovery)
@@ -889,11 +1381,15 @@ int main(int argc, char* argv[]) {
             [&](const kimp::Position& closed_pos, double pnl_krw, double usdt_rate) {
                 double pnl_usd = usdt_rate > 0 ? pnl_krw / usdt_rate : 0.0;
                 double capital_before = engine.get_current_capital();
-                engine.add_realized_pnl(pnl_usd);
+                engine.add_realized_pnl(pnl_usd, closed_pos.symbol,
+                                        closed_pos.korean_exchange, closed_pos.foreign_exchange);
                 double capital_after = engine.get_current_capital();
                 append_trade_log(closed_pos, pnl_usd, usdt_rate, capital_before, capital_after);
-                spdlog::info("[TRADE COMPLETE] {} P&L: {:.0f} KRW ({:.2f} USD), capital: ${:.2f}",
-                             closed_pos.symbol.to_string(), pnl_krw, pnl_usd, capital_after);
+                const auto perf = engine.get_capital_tracker().stats().summary();
+                spdlog::info("[TRADE COMPLETE] {} P&L: {:.0f} KRW ({:.2f} USD), capital: ${:.2f} | "
+                             "rolling Sharpe {:.2f} ({} trades), drawdown ${:.2f}",
+                             closed_pos.symbol.to_string(), pnl_krw, pnl_usd, capital_after,
+                             perf.rolling_sharpe(), perf.rolling_trades, perf.drawdown_usd);
                 if (manual_confirm_once) {
                     spdlog::info("[MANUAL-TEST] One full trade cycle completed. Shutting down.");
                     g_shutdown.store(true, std::memory_order_release);
@@ -1027,14 +1523,41 @@ int main(int argc, char* argv[]) {
     // - each claimed symbol runs inside a dedicated lifecycle worker
     // - exits are handled inside the lifecycle loop, not by a separate dispatcher
 
-    // Get optimal thread configuration based on hardware
+    // Thread placement planned from the CPU topology (SMT siblings, L3
+    // domains, isolated and NIC IRQ CPUs)
     auto thread_config = kimp::opt::ThreadConfig::optimal();
-    spdlog::info("CPU cores detected: {}", std::thread::hardware_concurrency());
+    {
+        std::istringstream plan(kimp::opt::host_thread_plan().describe());
+        std::string line;
+        while (std::getline(plan, line)) {
+            spdlog::info("[CPU] {}", line);
+        }
+    }
+
+    // Busy-poll mode trades whole cores for wakeup latency; the epoll
+    // baseline is measured first so the shutdown report can show both.
+    kimp::network::BusyPollOptions busy_poll_options;
+    busy_poll_options.enabled = config.io_busy_poll;
+    busy_poll_options.spin_idle = std::chrono::microseconds(config.io_spin_idle_us);
+    busy_poll_options.max_idle_sleep = std::chrono::microseconds(config.io_max_idle_sleep_us);
+    kimp::network::BusyPollReactor io_reactor(io_context, busy_poll_options,
+                                              static_cast<std::size_t>(std::max(config.io_threads, 1)));
+    kimp::LatencyHistogram::Summary epoll_wakeup_baseline;
+    if (busy_poll_options.enabled) {
+        epoll_wakeup_baseline = kimp::network::BusyPollReactor::measure_blocking_wakeup(200);
+        spdlog::info("[Reactor] Busy-poll io threads (spin {}us, max idle sleep {}us); epoll wakeup baseline p50 <{:.0f}us p99 <{:.0f}us",
+                     config.io_spin_idle_us, config.io_max_idle_sleep_us,
+                     epoll_wakeup_baseline.p50_us, epoll_wakeup_baseline.p99_us);
+        if (config.io_threads > 2) {
+            spdlog::warn("[Reactor] io_threads={} but only 2 io cores are reserved; extra spinners share core {}",
+                         config.io_threads, thread_config.io_bybit_core);
+        }
+    }
 
     // Start IO threads with CPU pinning and RT priority
     std::vector<std::thread> io_threads;
     for (int i = 0; i < config.io_threads; ++i) {
-        io_threads.emplace_back([&io_context, i, &thread_config]() {
+        io_threads.emplace_back([&io_reactor, i, &thread_config]() {
             // Apply CPU core pinning based on thread index
             int core_id = -1;
             if (i == 0) core_id = thread_config.io_bithumb_core;
@@ -1052,7 +1575,7 @@ int main(int argc, char* argv[]) {
                 spdlog::info("IO thread {} set to realtime priority", i);
             }
 
-            io_context.run();
+            io_reactor.run(static_cast<std::size_t>(i));
         });
     }
     spdlog::info("Started {} IO threads with CPU pinning", config.io_threads);
@@ -1067,21 +1590,78 @@ int main(int argc, char* argv[]) {
         }
     };
 
-    bithumb->set_ticker_callback([&engine](const kimp::Ticker& ticker) {
-        engine.on_ticker_update(ticker);
-    });
-    bybit->set_ticker_callback([&engine](const kimp::Ticker& ticker) {
-        engine.on_ticker_update(ticker);
-    });
-    if (okx_enabled) {
-        okx->set_ticker_callback([&engine](const kimp::Ticker& ticker) {
+    // Market-data gateway: this process owns the public feeds and mirrors
+    // every normalized ticker/book into shared memory for attached bots
+    std::unique_ptr<kimp::network::MarketDataPublisher> md_publisher;
+    if (!md_gateway_name.empty()) {
+        std::string error;
+        md_publisher = kimp::network::MarketDataPublisher::create(
+            md_gateway_name, kimp::network::MarketDataPublisher::DEFAULT_CAPACITY, &error);
+        if (!md_publisher) {
+            spdlog::error("[MarketDataShm] Cannot create {}: {}", md_gateway_name, error);
+            stop_io_threads();
+            kimp::Logger::shutdown();
+            return 1;
+        }
+        spdlog::info("[MarketDataShm] Gateway publishing to {}", md_publisher->name());
+    }
+
+    // Attached bot: public market data arrives from the gateway; the
+    // exchange clients here keep only their private (order/fill) paths
+    std::unique_ptr<kimp::network::MarketDataSubscriber> md_subscriber;
+    if (!md_attach_name.empty()) {
+        std::string error;
+        md_subscriber = kimp::network::MarketDataSubscriber::attach(md_attach_name, &error);
+        if (!md_subscriber) {
+            spdlog::error("[MarketDataShm] Cannot attach to {} (is the --md-gateway running?): {}",
+                          md_attach_name, error);
+            stop_io_threads();
+            kimp::Logger::shutdown();
+            return 1;
+        }
+        md_subscriber->set_ticker_callback([&engine](const kimp::Ticker& ticker) {
             engine.on_ticker_update(ticker);
         });
+        spdlog::info("[MarketDataShm] Attached to {} (epoch {})", md_attach_name, md_subscriber->epoch());
+    }
+
+    // Korean depth fans out to every consumer: simulated fills, the split
+    // router and the gateway mirror (one callback slot per source)
+    if (paper_execution || korean_router || md_publisher) {
+        auto on_depth = [paper = paper_execution.get(), router = korean_router.get(),
+                         publisher = md_publisher.get()](const kimp::OrderBook& book) {
+            if (paper) {
+                paper->on_orderbook(book);
+            }
+            if (router) {
+                router->on_orderbook(book);
+            }
+            if (publisher) {
+                publisher->publish(book);
+            }
+        };
+        if (md_subscriber) {
+            md_subscriber->set_orderbook_callback(on_depth);
+        }
+        bithumb->set_orderbook_callback(on_depth);
+        if (upbit_enabled) {
+            upbit->set_orderbook_callback(on_depth);
+        }
+    }
+
+    auto on_ticker = [&engine, publisher = md_publisher.get()](const kimp::Ticker& ticker) {
+        engine.on_ticker_update(ticker);
+        if (publisher) {
+            publisher->publish(ticker);
+        }
+    };
+    bithumb->set_ticker_callback(on_ticker);
+    bybit->set_ticker_callback(on_ticker);
+    if (okx_enabled) {
+        okx->set_ticker_callback(on_ticker);
     }
     if (upbit_enabled) {
-        upbit->set_ticker_callback([&engine](const kimp::Ticker& ticker) {
-            engine.on_ticker_update(ticker);
-        });
+        upbit->set_ticker_callback(on_ticker);
     }
 
     // Connect
@@ -1094,6 +1674,9 @@ int main(int argc, char* argv[]) {
     if (upbit_enabled) {
         upbit->connect();
     }
+    for (const auto& connector : account_connectors) {
+        connector->connect();
+    }
 
     // Wait for connections (poll instead of fixed sleep, max 10 seconds)
     spdlog::info("Waiting for connections...");
@@ -1116,6 +1699,7 @@ int main(int argc, char* argv[]) {
         bybit->disconnect();
         if (okx_enabled) okx->disconnect();
         if (upbit_enabled) upbit->disconnect();
+        for (const auto& connector : account_connectors) connector->disconnect();
         stop_io_threads();
         kimp::Logger::shutdown();
         return 1;
@@ -1176,6 +1760,15 @@ int main(int argc, char* argv[]) {
         bybit_bases.insert(std::string(s.get_base()));
     }
 
+    // Extra accounts round orders on their own connector: load the same
+    // instrument rules (qty step, tick, minimum) there
+    for (const auto& connector : account_connectors) {
+        const auto ex = connector->get_exchange_id();
+        if (ex == kimp::Exchange::Bybit || (ex == kimp::Exchange::OKX && okx_enabled)) {
+            connector->get_available_symbols();
+        }
+    }
+
     // Common = (Bithumb ∪ Upbit) ∩ (Bybit ∪ OKX)
     std::vector<kimp::SymbolId> common_symbols;
     for (const auto& base : korean_bases) {
@@ -1216,6 +1809,7 @@ int main(int argc, char* argv[]) {
         bybit->disconnect();
         if (okx_enabled) okx->disconnect();
         if (upbit_enabled) upbit->disconnect();
+        for (const auto& connector : account_connectors) connector->disconnect();
         stop_io_threads();
         kimp::Logger::shutdown();
         return 1;
@@ -1227,13 +1821,16 @@ int main(int argc, char* argv[]) {
         common_bases.insert(std::string(s.get_base()));
     }
 
-    if (!monitor_only) {
+    if (paper_trading) {
+        spdlog::info("Paper mode: skipping spot-margin setup and external position blacklist");
+    } else if (!monitor_only) {
         // Prepare Bybit spot margin account once at startup (avoid first-trade setup latency)
         if (!order_manager.prepare_bybit_shorting(common_symbols)) {
             spdlog::error("Bybit spot margin setup failed");
             bithumb->disconnect();
             bybit->disconnect();
             if (okx_enabled) okx->disconnect();
+            for (const auto& connector : account_connectors) connector->disconnect();
             stop_io_threads();
             kimp::Logger::shutdown();
             return 1;
@@ -1259,6 +1856,20 @@ int main(int argc, char* argv[]) {
             }
         }
         order_manager.refresh_external_positions(common_symbols, bot_managed_symbols);
+
+        if (!account_connectors.empty()) {
+            order_manager.accounts().refresh_balances();
+            for (const auto ex : {kimp::Exchange::Bithumb, kimp::Exchange::Upbit,
+                                  kimp::Exchange::Bybit, kimp::Exchange::OKX}) {
+                const auto accounts = order_manager.accounts().stats(ex);
+                for (const auto& a : accounts) {
+                    if (accounts.size() > 1) {
+                        spdlog::info("[ACCOUNTS] {} #{}: {:.2f} {} available", kimp::exchange_name(ex), a.account,
+                                     a.balance, kimp::is_korean_exchange(ex) ? "KRW" : "USDT");
+                    }
+                }
+            }
+        }
     } else {
         spdlog::info("Monitor-only mode: skipping spot-margin setup and external position blacklist");
     }
@@ -1347,6 +1958,10 @@ int main(int argc, char* argv[]) {
     // STEP 12: WebSocket Subscriptions (real-time streaming)
     // =========================================================================
 
+    // With --md-attach the gateway owns the public streams; symbol lists are
+    // still built here so both processes agree on the universe
+    const bool own_public_feeds = !md_subscriber;
+
     // Bithumb: subscribe only symbols that exist on Bithumb
     std::vector<kimp::SymbolId> bithumb_subs;
     for (const auto& s : common_symbols) {
@@ -1355,13 +1970,15 @@ int main(int argc, char* argv[]) {
         }
     }
     bithumb_subs.emplace_back("USDT", "KRW");  // For exchange rate
-    bithumb->subscribe_ticker(bithumb_subs);
-    spdlog::info("Subscribed to {} Bithumb tickers (including USDT/KRW)", bithumb_subs.size());
+    if (own_public_feeds) {
+        bithumb->subscribe_ticker(bithumb_subs);
+        spdlog::info("Subscribed to {} Bithumb tickers (including USDT/KRW)", bithumb_subs.size());
 
-    // Fetch orderbook snapshots and subscribe to orderbookdepth for real bid/ask
-    bithumb->fetch_all_orderbook_snapshots(bithumb_subs);
-    bithumb->subscribe_orderbook(bithumb_subs);
-    spdlog::info("Bithumb orderbook snapshots primed; live cache will be driven by WebSocket only");
+        // Fetch orderbook snapshots and subscribe to orderbookdepth for real bid/ask
+        bithumb->fetch_all_orderbook_snapshots(bithumb_subs);
+        bithumb->subscribe_orderbook(bithumb_subs);
+        spdlog::info("Bithumb orderbook snapshots primed; live cache will be driven by WebSocket only");
+    }
 
     // Fetch per-coin per-network withdrawal fees from Bithumb (public API, no auth)
     {
@@ -1391,9 +2008,11 @@ int main(int argc, char* argv[]) {
             }
         }
         upbit_subs.emplace_back("USDT", "KRW");  // For Upbit's own USDT/KRW rate
-        upbit->subscribe_ticker(upbit_subs);
-        upbit->subscribe_orderbook(upbit_subs);
-        spdlog::info("Subscribed to {} Upbit symbols (orderbook + ticker)", upbit_subs.size());
+        if (own_public_feeds) {
+            upbit->subscribe_ticker(upbit_subs);
+            upbit->subscribe_orderbook(upbit_subs);
+            spdlog::info("Subscribed to {} Upbit symbols (orderbook + ticker)", upbit_subs.size());
+        }
     }
 
     std::vector<kimp::SymbolId> bybit_subs;
@@ -1403,8 +2022,10 @@ int main(int argc, char* argv[]) {
             bybit_subs.emplace_back(base, "USDT");
         }
     }
-    bybit->subscribe_orderbook(bybit_subs);
-    spdlog::info("Subscribed to {} Bybit spot symbols (orderbook-only BBO path)", bybit_subs.size());
+    if (own_public_feeds) {
+        bybit->subscribe_orderbook(bybit_subs);
+        spdlog::info("Subscribed to {} Bybit spot symbols (orderbook-only BBO path)", bybit_subs.size());
+    }
 
     if (okx_enabled) {
         std::vector<kimp::SymbolId> okx_subs;
@@ -1414,103 +2035,258 @@ int main(int argc, char* argv[]) {
                 okx_subs.emplace_back(base, "USDT");
             }
         }
-        okx->subscribe_orderbook(okx_subs);
-        spdlog::info("Subscribed to {} OKX spot symbols (bbo-tbt 10ms path)", okx_subs.size());
+        if (own_public_feeds) {
+            okx->subscribe_orderbook(okx_subs);
+            spdlog::info("Subscribed to {} OKX spot symbols (bbo-tbt 10ms path)", okx_subs.size());
+        }
     }
 
+    if (md_subscriber) {
+        md_subscriber->start();
+        spdlog::info("[MarketDataShm] Public market data from gateway {} ({} Bithumb, {} Bybit symbols expected)",
+                     md_attach_name, bithumb_subs.size(), bybit_subs.size());
+    }
+
+    // Transfer routes: every venue is fetched concurrently into a staged
+    // update, then published to the PriceCache in one transaction. Only
+    // symbols whose routes changed are re-evaluated for entry.
     std::mutex transfer_refresh_mutex;
     auto refresh_transfer_routes = [&](std::string_view reason) {
         std::lock_guard guard(transfer_refresh_mutex);
-        auto& pc = engine.get_price_cache();
-        bool updated_any = false;
-
-        auto bithumb_fees = bithumb->fetch_withdrawal_fees();
-        if (!bithumb_fees.empty()) {
-            pc.clear_withdraw_network_fees(kimp::Exchange::Bithumb);
-            for (auto& [coin, net_fees] : bithumb_fees) {
-                std::vector<kimp::strategy::PriceCache::NetworkFee> converted;
+        using NetworkFee = kimp::strategy::PriceCache::NetworkFee;
+        const auto started = std::chrono::steady_clock::now();
+
+        auto convert_fees = [](auto&& venue_fees) {
+            std::unordered_map<std::string, std::vector<NetworkFee>> out;
+            out.reserve(venue_fees.size());
+            for (auto& [coin, net_fees] : venue_fees) {
+                auto& converted = out[coin];
                 converted.reserve(net_fees.size());
                 for (auto& nf : net_fees) {
                     converted.push_back({std::move(nf.network), nf.fee_coins});
                 }
-                pc.set_withdraw_network_fees(kimp::Exchange::Bithumb, coin, std::move(converted));
             }
-            updated_any = true;
+            return out;
+        };
+
+        std::vector<std::string> upbit_coin_list;
+        if (upbit_enabled) {
+            upbit_coin_list.reserve(upbit_subs.size());
+            for (const auto& s : upbit_subs) {
+                std::string base(s.get_base());
+                if (base != "USDT") upbit_coin_list.push_back(base);
+            }
+        }
+
+        auto bithumb_fees_f = std::async(std::launch::async, [&] { return bithumb->fetch_withdrawal_fees(); });
+        auto bithumb_status_f = std::async(std::launch::async, [&] { return bithumb->fetch_asset_statuses(); });
+        auto bybit_nets_f = std::async(std::launch::async, [&] { return bybit->fetch_deposit_networks(); });
+        std::future<decltype(upbit->fetch_withdrawal_fees(upbit_coin_list))> upbit_fees_f;
+        if (upbit_enabled) {
+            upbit_fees_f = std::async(std::launch::async, [&] { return upbit->fetch_withdrawal_fees(upbit_coin_list); });
+        }
+        std::future<decltype(okx->fetch_deposit_networks())> okx_nets_f;
+        if (okx_enabled) {
+            okx_nets_f = std::async(std::launch::async, [&] { return okx->fetch_deposit_networks(); });
+        }
+
+        // A venue whose fetch fails keeps its last published data
+        kimp::strategy::PriceCache::TransferRouteUpdate staged;
+        auto bithumb_fees = bithumb_fees_f.get();
+        if (!bithumb_fees.empty()) {
+            staged.withdraw_fees[kimp::Exchange::Bithumb] = convert_fees(bithumb_fees);
         } else {
             spdlog::warn("[TransferRoutes:{}] Failed to refresh Bithumb withdrawal fees", reason);
         }
 
-        auto bithumb_statuses = bithumb->fetch_asset_statuses();
+        auto bithumb_statuses = bithumb_status_f.get();
         if (!bithumb_statuses.empty()) {
-            pc.clear_korean_withdraw_status(kimp::Exchange::Bithumb);
+            auto& enabled = staged.withdraw_enabled[kimp::Exchange::Bithumb];
             for (const auto& [coin, status] : bithumb_statuses) {
-                pc.set_korean_withdraw_enabled(kimp::Exchange::Bithumb, coin, status.withdraw_enabled);
+                enabled[coin] = status.withdraw_enabled;
             }
-            updated_any = true;
         } else {
             spdlog::warn("[TransferRoutes:{}] Failed to refresh Bithumb asset statuses", reason);
         }
 
-        if (upbit_enabled) {
-            std::vector<std::string> upbit_coin_list;
-            upbit_coin_list.reserve(upbit_subs.size());
-            for (const auto& s : upbit_subs) {
-                std::string base(s.get_base());
-                if (base != "USDT") upbit_coin_list.push_back(base);
-            }
-            auto upbit_fees = upbit->fetch_withdrawal_fees(upbit_coin_list);
+        if (upbit_fees_f.valid()) {
+            auto upbit_fees = upbit_fees_f.get();
             if (!upbit_fees.empty()) {
-                pc.clear_withdraw_network_fees(kimp::Exchange::Upbit);
-                for (auto& [coin, net_fees] : upbit_fees) {
-                    std::vector<kimp::strategy::PriceCache::NetworkFee> converted;
-                    converted.reserve(net_fees.size());
-                    for (auto& nf : net_fees) {
-                        converted.push_back({std::move(nf.network), nf.fee_coins});
-                    }
-                    pc.set_withdraw_network_fees(kimp::Exchange::Upbit, coin, std::move(converted));
-                }
-                updated_any = true;
+                staged.withdraw_fees[kimp::Exchange::Upbit] = convert_fees(upbit_fees);
             } else {
                 spdlog::warn("[TransferRoutes:{}] Failed to refresh Upbit withdrawal fees", reason);
             }
         }
 
-        auto bybit_nets = bybit->fetch_deposit_networks();
+        auto bybit_nets = bybit_nets_f.get();
         if (!bybit_nets.empty()) {
-            pc.clear_foreign_deposit_networks(kimp::Exchange::Bybit);
-            for (auto& [coin, nets] : bybit_nets) {
-                pc.set_foreign_deposit_networks(kimp::Exchange::Bybit, coin, std::move(nets));
-            }
-            updated_any = true;
+            staged.deposit_nets[kimp::Exchange::Bybit] = std::move(bybit_nets);
         } else {
             spdlog::warn("[TransferRoutes:{}] Failed to refresh Bybit deposit networks", reason);
         }
 
-        if (okx_enabled) {
-            auto okx_nets = okx->fetch_deposit_networks();
+        if (okx_nets_f.valid()) {
+            auto okx_nets = okx_nets_f.get();
             if (!okx_nets.empty()) {
-                pc.clear_foreign_deposit_networks(kimp::Exchange::OKX);
-                for (auto& [coin, nets] : okx_nets) {
-                    pc.set_foreign_deposit_networks(kimp::Exchange::OKX, coin, std::move(nets));
-                }
-                updated_any = true;
+                staged.deposit_nets[kimp::Exchange::OKX] = std::move(okx_nets);
             } else {
                 spdlog::warn("[TransferRoutes:{}] Failed to refresh OKX deposit networks", reason);
             }
         }
 
-        if (updated_any) {
-            pc.finalize_withdraw_fees();
-            engine.refresh_entry_filters();
-            spdlog::info("[TransferRoutes:{}] available routes={} fee entries={}",
-                         reason,
-                         pc.available_transfer_route_count(),
-                         pc.precomputed_fee_count());
+        if (staged.empty()) {
+            return;
         }
+
+        auto& pc = engine.get_price_cache();
+        const auto diff = pc.apply_transfer_routes(std::move(staged));
+        engine.refresh_entry_filters(diff.changed_coins);
+        const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - started).count();
+        spdlog::info("[TransferRoutes:{}] available routes={} fee entries={} | changed coins={} "
+                     "(opened={} closed={} fee changes={}) in {}ms",
+                     reason,
+                     pc.available_transfer_route_count(),
+                     pc.precomputed_fee_count(),
+                     diff.changed_coins.size(),
+                     diff.routes_opened,
+                     diff.routes_closed,
+                     diff.fees_changed,
+                     elapsed_ms);
     };
 
     refresh_transfer_routes("startup");
 
+    // Borrow rates of the foreign shorts: each venue is published on its
+    // own, a failed fetch keeps the venue's last rates.
+    auto refresh_borrow_rates = [&](std::string_view reason) {
+        std::vector<std::string> changed;
+        size_t venues = 0;
+        auto publish = [&](kimp::Exchange ex, const std::unordered_map<std::string, double>& rates) {
+            if (rates.empty()) {
+                spdlog::warn("[BorrowRates:{}] Failed to refresh {} borrow rates", reason, kimp::exchange_name(ex));
+                return;
+            }
+            ++venues;
+            auto bases = engine.apply_borrow_rates(ex, rates);
+            changed.insert(changed.end(), bases.begin(), bases.end());
+        };
+        publish(kimp::Exchange::Bybit, bybit->fetch_borrow_rates());
+        if (okx_enabled) {
+            publish(kimp::Exchange::OKX, okx->fetch_borrow_rates());
+        }
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+        engine.refresh_entry_filters(changed);
+        spdlog::info("[BorrowRates:{}] venues={} changed coins={} (hold {:.1f}h charged on entry)",
+                     reason, venues, changed.size(), config.borrow_expected_hold_hours);
+    };
+    if (config.borrow_cost) {
+        refresh_borrow_rates("startup");
+    }
+
+    // New listings: venue market lists are diffed every poll. A coin carried
+    // by a Korean and a foreign venue is added live (engine slot, margin
+    // setup, public streams on the open connections, then its transfer
+    // routes and borrow rate) while every other symbol keeps trading.
+    // Bybit/OKX market fetches also reload their instrument rules.
+    kimp::strategy::ListingWatcher listing_watcher;
+    {
+        auto markets_of = [](const std::unordered_set<std::string>& bases, const char* quote) {
+            std::vector<kimp::SymbolId> markets;
+            markets.reserve(bases.size());
+            for (const auto& base : bases) {
+                markets.emplace_back(base, quote);
+            }
+            return markets;
+        };
+        listing_watcher.add_venue(kimp::Exchange::Bithumb, [&] { return bithumb->get_available_symbols(); });
+        listing_watcher.seed(kimp::Exchange::Bithumb, bithumb_symbols);
+        listing_watcher.add_venue(kimp::Exchange::Bybit, [&] { return bybit->get_available_symbols(); });
+        listing_watcher.seed(kimp::Exchange::Bybit, bybit_symbols);
+        if (upbit_enabled) {
+            listing_watcher.add_venue(kimp::Exchange::Upbit, [&] { return upbit->get_available_symbols(); });
+            listing_watcher.seed(kimp::Exchange::Upbit, markets_of(upbit_bases, "KRW"));
+        }
+        if (okx_enabled) {
+            listing_watcher.add_venue(kimp::Exchange::OKX, [&] { return okx->get_available_symbols(); });
+            listing_watcher.seed(kimp::Exchange::OKX, markets_of(okx_bases, "USDT"));
+        }
+    }
+
+    auto add_listing = [&](const kimp::strategy::NewListing& listing) {
+        const std::string base(listing.symbol.get_base());
+        const kimp::SymbolId foreign_symbol(base, "USDT");
+        const auto started = std::chrono::steady_clock::now();
+
+        // The main connectors learned the coin's instrument rules in the poll;
+        // extra accounts round their orders with their own copy
+        for (const auto& connector : account_connectors) {
+            const auto ex = connector->get_exchange_id();
+            if (std::find(listing.foreign_venues.begin(), listing.foreign_venues.end(), ex) !=
+                listing.foreign_venues.end()) {
+                connector->get_available_symbols();
+            }
+        }
+
+        // Margin first: a coin that cannot be shorted is never made eligible
+        if (!paper_trading && !monitor_only) {
+            for (const auto ex : listing.foreign_venues) {
+                const bool prepared = ex == kimp::Exchange::Bybit
+                    ? order_manager.prepare_bybit_shorting({listing.symbol})
+                    : order_manager.prepare_okx_shorting({listing.symbol});
+                if (!prepared) {
+                    spdlog::error("[Listing] {} not added: {} spot-margin setup failed, retrying next poll",
+                                  base, kimp::exchange_name(ex));
+                    listing_watcher.retry(listing);
+                    return;
+                }
+            }
+        }
+        if (listing.new_symbol && !engine.add_symbol(listing.symbol)) {
+            spdlog::warn("[Listing] {} not added: symbol capacity reached", base);
+            return;
+        }
+
+        // With --md-attach the gateway's own watcher streams the coin
+        if (own_public_feeds) {
+            for (const auto ex : listing.korean_venues) {
+                if (ex == kimp::Exchange::Bithumb) {
+                    bithumb->add_market_subscriptions({listing.symbol});
+                } else if (ex == kimp::Exchange::Upbit && upbit) {
+                    upbit->add_market_subscriptions({listing.symbol});
+                }
+            }
+            for (const auto ex : listing.foreign_venues) {
+                if (ex == kimp::Exchange::Bybit) {
+                    bybit->add_market_subscriptions({foreign_symbol});
+                } else if (ex == kimp::Exchange::OKX && okx) {
+                    okx->add_market_subscriptions({foreign_symbol});
+                }
+            }
+        }
+
+        // Upbit fees are fetched per coin from upbit_subs; the other venues'
+        // fee and network APIs are bulk, and the route diff re-evaluates
+        // only the coins whose routes changed
+        if (std::find(listing.korean_venues.begin(), listing.korean_venues.end(),
+                      kimp::Exchange::Upbit) != listing.korean_venues.end()) {
+            std::lock_guard guard(transfer_refresh_mutex);
+            upbit_subs.push_back(listing.symbol);
+        }
+        refresh_transfer_routes("listing");
+        if (config.borrow_cost) {
+            refresh_borrow_rates("listing");
+        }
+        engine.refresh_entry_filters({base});
+
+        spdlog::info("[Listing] {} {} (Korean: {} venue(s), foreign: {} venue(s)) live in {}ms",
+                     base, listing.new_symbol ? "added" : "extended to new venues",
+                     listing.korean_venues.size(), listing.foreign_venues.size(),
+                     std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - started).count());
+    };
+
     // =========================================================================
     // STEP 13: Warm-up
     // Market data updates are WebSocket-only after subscriptions.
@@ -1587,16 +2363,23 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        const auto& usdt_fx = engine.get_usdt_estimator();
+        const int64_t fx_now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        const auto fx_bi = usdt_fx.venue(kimp::Exchange::Bithumb, fx_now_ns);
+        const auto fx_up = usdt_fx.venue(kimp::Exchange::Upbit, fx_now_ns);
         const double usdt_bi = engine.get_price_cache().get_usdt_krw(kimp::Exchange::Bithumb);
-        const double usdt_up = upbit_enabled ? engine.get_price_cache().get_usdt_krw(kimp::Exchange::Upbit) : 0.0;
-        spdlog::info("[MarketData] 5s snapshot: bi {}/{} | up {}/{} | by {}/{} | ok {}/{} | korean {}/{} | foreign {}/{} | usdt bi:{:.2f} up:{:.2f} | cache {}",
+        spdlog::info("[MarketData] 5s snapshot: bi {}/{} | up {}/{} | by {}/{} | ok {}/{} | korean {}/{} | foreign {}/{} | usdt {:.2f} (bi:{:.2f}{} up:{:.2f}{} rejected {}) | cache {}",
                      bithumb_ready, common_symbols.size(),
                      upbit_ready, common_symbols.size(),
                      bybit_ready, common_symbols.size(),
                      okx_ready, common_symbols.size(),
                      any_korean_ready, common_symbols.size(),
                      any_foreign_ready, common_symbols.size(),
-                     usdt_bi, usdt_up,
+                     usdt_bi,
+                     fx_bi.price, fx_bi.fresh ? "" : " stale",
+                     fx_up.price, fx_up.fresh ? "" : " stale",
+                     usdt_fx.stats().rejected,
                      engine.get_price_cache().size());
 
         if (any_korean_ready != common_symbols.size() || any_foreign_ready != common_symbols.size() || usdt_bi <= 0.0) {
@@ -1610,7 +2393,16 @@ int main(int argc, char* argv[]) {
     // STARTUP RECOVERY: Check for existing positions (trade mode only)
     // =========================================================================
     std::optional<kimp::Position> recovered_position;  // For launching lifecycle loop after engine.start()
-    if (!monitor_only && !manual_confirm_once) {
+    if (paper_trading) {
+        // Paper positions live only in the paper position file; real balances are never scanned
+        if (auto saved = load_active_position()) {
+            paper_execution->seed_position(*saved);
+            engine.open_position(*saved);
+            recovered_position = *saved;
+            spdlog::info("[RECOVERY] Restored paper position: {} ({:.8f} coins)",
+                         saved->symbol.to_string(), saved->korean_amount);
+        }
+    } else if (!monitor_only && !manual_confirm_once) {
         bool resumed_position = false;
 
         if (!g_shutdown && !resumed_position) {
@@ -1629,34 +2421,59 @@ int main(int argc, char* argv[]) {
                 };
 
                 std::vector<RecoveryCandidate> candidates;
-                std::unordered_map<std::string, kimp::Position> bybit_short_by_coin;
-
-                // Query Bybit short positions once, then scan all candidates from that set.
-                auto bybit_positions = bybit->get_short_positions();
-                for (const auto& p : bybit_positions) {
-                    std::string coin = std::string(p.symbol.get_base());
-                    if (coin.empty()) continue;
-                    if (!common_bases.count(coin)) continue;
-                    if (p.foreign_amount <= 0.0001) continue;
-
-                    auto it = bybit_short_by_coin.find(coin);
-                    if (it == bybit_short_by_coin.end() || p.foreign_amount > it->second.foreign_amount) {
-                        bybit_short_by_coin[coin] = p;
+                const auto& account_pool = order_manager.accounts();
+
+                // Query each account's short positions once: the largest per coin and account
+                using ShortsByCoin = std::map<std::pair<std::string, uint8_t>, kimp::Position>;
+                auto collect_shorts = [&](kimp::Exchange foreign_ex) {
+                    ShortsByCoin shorts;
+                    for (std::size_t a = 0; a < account_pool.count(foreign_ex); ++a) {
+                        const auto account = static_cast<uint8_t>(a);
+                        auto connector = std::dynamic_pointer_cast<kimp::exchange::ForeignShortExchangeBase>(
+                            account_pool.exchange(foreign_ex, account));
+                        if (!connector) continue;
+                        for (const auto& p : connector->get_short_positions()) {
+                            std::string coin = std::string(p.symbol.get_base());
+                            if (coin.empty()) continue;
+                            if (!common_bases.count(coin)) continue;
+                            if (p.foreign_amount <= 0.0001) continue;
+
+                            auto it = shorts.find({coin, account});
+                            if (it == shorts.end() || p.foreign_amount > it->second.foreign_amount) {
+                                shorts[{coin, account}] = p;
+                            }
+                        }
                     }
-                }
+                    return shorts;
+                };
 
+                // Spot side of a short: the Bithumb account holding the most of the coin
+                auto korean_holding = [&](const std::string& coin) {
+                    std::pair<double, uint8_t> best{0.0, 0};
+                    for (std::size_t a = 0; a < account_pool.count(kimp::Exchange::Bithumb); ++a) {
+                        const auto account = static_cast<uint8_t>(a);
+                        auto connector = account_pool.exchange(kimp::Exchange::Bithumb, account);
+                        const double balance = connector ? connector->get_balance(coin) : 0.0;
+                        if (balance > best.first) {
+                            best = {balance, account};
+                        }
+                    }
+                    return best;
+                };
+
+                const ShortsByCoin bybit_short_by_coin = collect_shorts(kimp::Exchange::Bybit);
                 if (!bybit_short_by_coin.empty()) {
-                    std::cout << fmt::format("\n복구 스캔 시작: Bybit 숏 {}개 코인 확인\n", bybit_short_by_coin.size());
+                    std::cout << fmt::format("\n복구 스캔 시작: Bybit 숏 {}개 확인\n", bybit_short_by_coin.size());
                 }
 
                 // Helper: scan short positions from a foreign exchange and add recovery candidates
-                auto scan_foreign_shorts = [&](const std::unordered_map<std::string, kimp::Position>& short_by_coin,
-                                               kimp::Exchange foreign_ex) {
-                    for (const auto& [coin, short_pos] : short_by_coin) {
+                auto scan_foreign_shorts = [&](const ShortsByCoin& short_by_coin, kimp::Exchange foreign_ex) {
+                    for (const auto& [key, short_pos] : short_by_coin) {
+                        const auto& [coin, foreign_account] = key;
                         kimp::SymbolId krw_symbol(coin, "KRW");
                         kimp::SymbolId usdt_symbol(coin, "USDT");
 
-                        double spot_balance = bithumb->get_balance(coin);
+                        const auto [spot_balance, korean_account] = korean_holding(coin);
                         double short_amount = short_pos.foreign_amount;
                         if (spot_balance <= 0.0001 || short_amount <= 0.0001) continue;
 
@@ -1697,6 +2514,8 @@ int main(int argc, char* argv[]) {
                         pos.foreign_amount = amount;
                         pos.korean_entry_price = korean_entry;
                         pos.foreign_entry_price = effective_foreign_entry;
+                        pos.korean_account = korean_account;
+                        pos.foreign_account = foreign_account;
                         pos.is_active = true;
 
                         RecoveryCandidate c;
@@ -1716,20 +2535,9 @@ int main(int argc, char* argv[]) {
 
                 // Also scan OKX short positions
                 if (okx_enabled) {
-                    std::unordered_map<std::string, kimp::Position> okx_short_by_coin;
-                    auto okx_positions = okx->get_short_positions();
-                    for (const auto& p : okx_positions) {
-                        std::string coin = std::string(p.symbol.get_base());
-                        if (coin.empty()) continue;
-                        if (!common_bases.count(coin)) continue;
-                        if (p.foreign_amount <= 0.0001) continue;
-                        auto it = okx_short_by_coin.find(coin);
-                        if (it == okx_short_by_coin.end() || p.foreign_amount > it->second.foreign_amount) {
-                            okx_short_by_coin[coin] = p;
-                        }
-                    }
+                    const ShortsByCoin okx_short_by_coin = collect_shorts(kimp::Exchange::OKX);
                     if (!okx_short_by_coin.empty()) {
-                        std::cout << fmt::format("OKX 숏 {}개 코인 확인\n", okx_short_by_coin.size());
+                        std::cout << fmt::format("OKX 숏 {}개 확인\n", okx_short_by_coin.size());
                     }
                     scan_foreign_shorts(okx_short_by_coin, kimp::Exchange::OKX);
                 }
@@ -1739,7 +2547,10 @@ int main(int argc, char* argv[]) {
                 if (loaded_pos) {
                     bool already_present = std::any_of(
                         candidates.begin(), candidates.end(),
-                        [&](const RecoveryCandidate& c) { return c.pos.symbol == loaded_pos->symbol; });
+                        [&](const RecoveryCandidate& c) {
+                            return c.pos.symbol == loaded_pos->symbol &&
+                                   c.pos.foreign_account == loaded_pos->foreign_account;
+                        });
 
                     if (!already_present) {
                         RecoveryCandidate c;
@@ -1763,7 +2574,8 @@ int main(int argc, char* argv[]) {
 
                     // Mark candidates that match the saved position and restore original entry data
                     for (auto& c : candidates) {
-                        if (!saved_symbol.empty() && c.pos.symbol.to_string() == saved_symbol) {
+                        if (!saved_symbol.empty() && c.pos.symbol.to_string() == saved_symbol &&
+                            c.pos.foreign_account == loaded_pos->foreign_account) {
                             c.from_saved_file = true;
                             // Preserve original entry prices/premium from saved file
                             // (live scan recalculates with current prices which corrupts dynamic exit threshold)
@@ -1773,6 +2585,10 @@ int main(int argc, char* argv[]) {
                             c.pos.entry_time = loaded_pos->entry_time;
                             c.pos.position_size_usd = loaded_pos->position_size_usd;
                             c.pos.realized_pnl_krw = loaded_pos->realized_pnl_krw;
+                            c.pos.korean_account = loaded_pos->korean_account;
+                            c.pos.foreign_account = loaded_pos->foreign_account;
+                            c.pos.borrow_interest_coins = loaded_pos->borrow_interest_coins;
+                            c.pos.borrow_accrued_at = loaded_pos->borrow_accrued_at;
                         }
                     }
 
@@ -1790,12 +2606,14 @@ int main(int argc, char* argv[]) {
                     std::cout << "=========================================\n";
                     for (size_t i = 0; i < candidates.size(); ++i) {
                         const auto& c = candidates[i];
-                        std::cout << fmt::format("  [{}] {} — {:.8f} coins (${:.2f}) pm:{:.2f}%{}\n",
+                        std::cout << fmt::format("  [{}] {} — {:.8f} coins (${:.2f}) pm:{:.2f}% 계정 {}/{}{}\n",
                                                   i + 1,
                                                   c.pos.symbol.to_string(),
                                                   c.matched_amount,
                                                   c.matched_usd,
                                                   c.pos.entry_premium,
+                                                  c.pos.korean_account,
+                                                  c.pos.foreign_account,
                                                   c.from_saved_file ? " ★봇포지션" : "");
                     }
                     std::cout << "=========================================\n";
@@ -1873,6 +2691,10 @@ int main(int argc, char* argv[]) {
     }
 
     std::thread transfer_refresh_thread;
+    std::thread borrow_refresh_thread;
+    std::thread listing_thread;
+    std::thread account_refresh_thread;
+    std::thread clock_sync_thread;
     if (!g_shutdown) {
         if (!monitor_only) {
             kimp::execution::LifecycleExecutorOptions executor_options;
@@ -1883,10 +2705,8 @@ int main(int argc, char* argv[]) {
             executor_options.idle_wait = std::chrono::microseconds(150);
 
             lifecycle_executor.start(executor_options, [thread_config](std::size_t worker_index) {
-                int core_id = thread_config.execution_core;
-                const int total_cores = static_cast<int>(std::thread::hardware_concurrency());
-                if (core_id >= 0 && total_cores > 0) {
-                    core_id = std::min(core_id + static_cast<int>(worker_index), total_cores - 1);
+                const int core_id = thread_config.execution_worker_core(worker_index);
+                if (core_id >= 0) {
                     if (kimp::opt::pin_to_core(core_id)) {
                         spdlog::info("Lifecycle worker {} pinned to core {}", worker_index, core_id);
                     }
@@ -1917,6 +2737,102 @@ int main(int argc, char* argv[]) {
             }
         });
 
+        if (config.borrow_cost) {
+            borrow_refresh_thread = std::thread([&]() {
+                const auto refresh_interval = std::chrono::seconds(std::max(60, config.borrow_refresh_sec));
+                while (!g_shutdown) {
+                    const auto started = std::chrono::steady_clock::now();
+                    while (!g_shutdown &&
+                           (std::chrono::steady_clock::now() - started) < refresh_interval) {
+                        std::this_thread::sleep_for(std::chrono::seconds(1));
+                    }
+                    if (g_shutdown) {
+                        break;
+                    }
+                    refresh_borrow_rates("periodic");
+                }
+            });
+        }
+
+        if (config.listing_watch) {
+            listing_thread = std::thread([&]() {
+                const auto poll_interval = std::chrono::seconds(std::max(5, config.listing_poll_sec));
+                while (!g_shutdown) {
+                    const auto started = std::chrono::steady_clock::now();
+                    while (!g_shutdown &&
+                           (std::chrono::steady_clock::now() - started) < poll_interval) {
+                        std::this_thread::sleep_for(std::chrono::seconds(1));
+                    }
+                    if (g_shutdown) {
+                        break;
+                    }
+                    for (const auto& listing : listing_watcher.poll()) {
+                        add_listing(listing);
+                    }
+                }
+            });
+        }
+
+        // Account balances steer lifecycle assignment; kept off the order path
+        if (!account_connectors.empty()) {
+            account_refresh_thread = std::thread([&]() {
+                const auto refresh_interval = std::chrono::seconds(std::max(5, config.account_balance_refresh_sec));
+                while (!g_shutdown) {
+                    const auto started = std::chrono::steady_clock::now();
+                    while (!g_shutdown &&
+                           (std::chrono::steady_clock::now() - started) < refresh_interval) {
+                        std::this_thread::sleep_for(std::chrono::seconds(1));
+                    }
+                    if (g_shutdown) {
+                        break;
+                    }
+                    order_manager.accounts().refresh_balances();
+                }
+            });
+        }
+
+        // Venue clock offsets: a quick burst so quote aging can use venue
+        // event times within seconds of startup, then one sample per venue
+        // every 30s to follow drift. Summaries every 10 minutes.
+        clock_sync_thread = std::thread([&]() {
+            constexpr int burst_samples = 4;
+            constexpr auto sample_interval = std::chrono::seconds(30);
+            constexpr int report_every = 20;
+            auto sample_all = [&]() {
+                bithumb->sample_clock();
+                bybit->sample_clock();
+                if (okx) okx->sample_clock();
+                if (upbit) upbit->sample_clock();
+            };
+            for (int i = 0; i < burst_samples && !g_shutdown; ++i) {
+                sample_all();
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            }
+            log_clock_sync(bithumb);
+            log_clock_sync(bybit);
+            log_clock_sync(okx);
+            log_clock_sync(upbit);
+
+            int rounds = 0;
+            while (!g_shutdown) {
+                const auto started = std::chrono::steady_clock::now();
+                while (!g_shutdown &&
+                       (std::chrono::steady_clock::now() - started) < sample_interval) {
+                    std::this_thread::sleep_for(std::chrono::seconds(1));
+                }
+                if (g_shutdown) {
+                    break;
+                }
+                sample_all();
+                if (++rounds % report_every == 0) {
+                    log_clock_sync(bithumb);
+                    log_clock_sync(bybit);
+                    log_clock_sync(okx);
+                    log_clock_sync(upbit);
+                }
+            }
+        });
+
         if (monitor_only) {
             spdlog::info("=== Bot Running (MONITOR-ONLY, Auto-Trading DISABLED) ===");
             spdlog::info("Monitor interval: {}s", monitor_interval_sec);
@@ -1950,8 +2866,10 @@ int main(int argc, char* argv[]) {
         if (!monitor_only && recovered_position.has_value()) {
             const auto& rpos = *recovered_position;
             double actual_usd = rpos.foreign_amount * rpos.foreign_entry_price;
-            spdlog::info("[RECOVERY] Launching lifecycle loop for {} (${:.2f}/${:.2f} filled)",
-                         rpos.symbol.to_string(), actual_usd, rpos.position_size_usd);
+            spdlog::info("[RECOVERY] Launching lifecycle loop for {} (${:.2f}/${:.2f} filled) on {} #{} / {} #{}",
+                         rpos.symbol.to_string(), actual_usd, rpos.position_size_usd,
+                         kimp::exchange_name(rpos.korean_exchange), rpos.korean_account,
+                         kimp::exchange_name(rpos.foreign_exchange), rpos.foreign_account);
 
             if (!try_claim_lifecycle_slot()) {
                 spdlog::error("[RECOVERY] No lifecycle slot available for {}", rpos.symbol.to_string());
@@ -1993,6 +2911,7 @@ int main(int argc, char* argv[]) {
         auto next_monitor_due = std::chrono::steady_clock::now();
         while (!g_shutdown) {
             std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            io_reactor.probe_wakeup();
 
             // Full monitor: all symbols + both-side prices + entry/exit premiums
             const auto now = std::chrono::steady_clock::now();
@@ -2018,13 +2937,19 @@ int main(int argc, char* argv[]) {
                     } else if (::isatty(STDOUT_FILENO) == 1) {
                         std::cout << "\033[2J\033[H";
                     }
-                    double bi_rate = engine.get_price_cache().get_usdt_krw(kimp::Exchange::Bithumb);
-                    double up_rate = engine.get_price_cache().get_usdt_krw(kimp::Exchange::Upbit);
+                    // Composite rate every premium uses, with the venue quotes behind it
+                    const double fx_rate = engine.get_price_cache().get_usdt_krw(kimp::Exchange::Bithumb);
+                    const int64_t fx_now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+                    const auto bi_fx = engine.get_usdt_estimator().venue(kimp::Exchange::Bithumb, fx_now_ns);
+                    const auto up_fx = engine.get_usdt_estimator().venue(kimp::Exchange::Upbit, fx_now_ns);
                     std::string rate_str;
-                    if (up_rate > 0.0) {
-                        rate_str = fmt::format("Bi:{:.2f} Up:{:.2f}", bi_rate, up_rate);
+                    if (up_fx.price > 0.0) {
+                        rate_str = fmt::format("{:.2f} (Bi:{:.2f}{} Up:{:.2f}{})", fx_rate,
+                                               bi_fx.price, bi_fx.fresh ? "" : "*",
+                                               up_fx.price, up_fx.fresh ? "" : "*");
                     } else {
-                        rate_str = fmt::format("{:.2f}", bi_rate);
+                        rate_str = fmt::format("{:.2f}", fx_rate);
                     }
                     const size_t universe_count = common_symbols.size();
                     size_t bithumb_quote_ready = 0, upbit_quote_ready = 0;
@@ -2306,17 +3231,154 @@ int main(int argc, char* argv[]) {
         if (transfer_refresh_thread.joinable()) {
             transfer_refresh_thread.join();
         }
+        if (borrow_refresh_thread.joinable()) {
+            borrow_refresh_thread.join();
+        }
+        if (listing_thread.joinable()) {
+            listing_thread.join();
+        }
+        if (account_refresh_thread.joinable()) {
+            account_refresh_thread.join();
+        }
+        if (clock_sync_thread.joinable()) {
+            clock_sync_thread.join();
+        }
         order_manager.request_shutdown();  // Break adaptive loops before stopping engine
         lifecycle_executor.stop();
         engine.stop_async_exporter();
     engine.stop();
+
+    // Redundant feed report: per-line first-arrival rate and how far the losing copy trailed
+    auto log_feed_arbiter = [](const auto& exchange_ptr) {
+        if (!exchange_ptr) return;
+        auto stats = exchange_ptr->get_feed_arbiter_stats();
+        if (!stats) return;
+        const auto& a = stats->lines[0];
+        const auto& b = stats->lines[1];
+        spdlog::info("[FeedArb] {} forwarded={} | A win {:.1f}% late={} lag avg {:.1f}us max {:.1f}us stale={} | "
+                     "B win {:.1f}% late={} lag avg {:.1f}us max {:.1f}us stale={} | overflow={}",
+                     exchange_ptr->get_name(), stats->forwarded,
+                     stats->win_rate(0) * 100.0, a.late, a.avg_lag_us(), a.lag_ns_max / 1000.0, a.stale,
+                     stats->win_rate(1) * 100.0, b.late, b.avg_lag_us(), b.lag_ns_max / 1000.0, b.stale,
+                     stats->table_overflow);
+    };
+    log_feed_arbiter(bithumb);
+    log_feed_arbiter(bybit);
+    log_feed_arbiter(okx);
+    log_feed_arbiter(upbit);
+
+    // Public stream failover report: how long each venue was blind across session changes
+    auto log_public_stream = [](const auto& exchange_ptr) {
+        if (!exchange_ptr) return;
+        const auto stats = exchange_ptr->get_public_stream_stats();
+        if (stats.rotations == 0 && stats.stalls == 0) return;
+        spdlog::info("[PublicWS] {} rotations={} stalls={} aborts={} | blind last {:.1f}ms max {:.1f}ms",
+                     exchange_ptr->get_name(), stats.rotations, stats.stalls, stats.rotation_aborts,
+                     stats.last_blind_ms, stats.max_blind_ms);
+    };
+    log_public_stream(bithumb);
+    log_public_stream(bybit);
+    log_public_stream(okx);
+    log_public_stream(upbit);
+
+    // Socket-to-handler queueing per venue (kernel RX timestamp -> WS read handler)
+    auto log_rx_queue = [](const auto& exchange_ptr) {
+        if (!exchange_ptr) return;
+        const auto stats = exchange_ptr->get_rx_queue_stats();
+        if (stats.frames == 0) return;
+        spdlog::info("[RxQueue] {} frames={} avg {:.1f}us p50 <{:.0f}us p99 <{:.0f}us max {:.1f}us",
+                     exchange_ptr->get_name(), stats.frames, stats.avg_us, stats.p50_us,
+                     stats.p99_us, stats.max_us);
+    };
+    log_rx_queue(bithumb);
+    log_rx_queue(bybit);
+    log_rx_queue(okx);
+    log_rx_queue(upbit);
+
+    // Venue clock model and the one-way feed latency it exposes
+    log_clock_sync(bithumb);
+    log_clock_sync(bybit);
+    log_clock_sync(okx);
+    log_clock_sync(upbit);
+
+    // Session trade statistics (streaming; the full history is trade_logs/trades.csv)
+    const auto& trade_stats = engine.get_capital_tracker().stats();
+    const auto perf = trade_stats.summary();
+    if (perf.all.trades > 0) {
+        spdlog::info("[TradeStats] trades={} win {:.1f}% P&L ${:.2f} mean ${:.4f} sd ${:.4f} | Sharpe {:.2f} "
+                     "rolling {:.2f} | PF {:.2f} | max DD ${:.2f} ({:.2f}%) | best ${:.2f} worst ${:.2f}",
+                     perf.all.trades, perf.all.win_rate_pct(), perf.all.total_pnl, perf.all.mean,
+                     perf.all.stddev(), perf.all.sharpe(), perf.rolling_sharpe(), perf.all.profit_factor(),
+                     perf.max_drawdown_usd, perf.max_drawdown_pct, perf.all.best, perf.all.worst);
+        for (const auto& pair : trade_stats.pair_breakdowns()) {
+            spdlog::info("[TradeStats] {}->{} trades={} win {:.1f}% P&L ${:.2f} PF {:.2f}",
+                         kimp::exchange_name(pair.korean), kimp::exchange_name(pair.foreign),
+                         pair.stats.trades, pair.stats.win_rate_pct(), pair.stats.total_pnl,
+                         pair.stats.profit_factor());
+        }
+        for (const auto& sym : trade_stats.symbol_breakdowns()) {
+            spdlog::info("[TradeStats] {} trades={} win {:.1f}% P&L ${:.2f} mean ${:.4f}",
+                         sym.symbol.to_string(), sym.stats.trades, sym.stats.win_rate_pct(),
+                         sym.stats.total_pnl, sym.stats.mean);
+        }
+    }
+
+    // Simulated venues: how the paper fills were produced and what is left
+    if (paper_execution) {
+        const auto paper = paper_execution->stats();
+        spdlog::info("[Paper] orders={} rejected={} beyond_depth={} bbo_fallbacks={} | fees {:.0f} KRW + {:.4f} USDT | "
+                     "submit avg {:.1f}ms p99 <{:.1f}ms | fill report avg {:.1f}ms p99 <{:.1f}ms",
+                     paper.orders, paper.rejected, paper.beyond_depth, paper.bbo_fallbacks,
+                     paper.fees_krw, paper.fees_usdt,
+                     paper.submit_latency.avg_us / 1000.0, paper.submit_latency.p99_us / 1000.0,
+                     paper.fill_latency.avg_us / 1000.0, paper.fill_latency.p99_us / 1000.0);
+        for (const auto& bal : paper_execution->balances()) {
+            spdlog::info("[Paper] {} {} {:.8f}", kimp::exchange_name(bal.exchange), bal.currency, bal.amount);
+        }
+    }
+
+    if (md_subscriber) {
+        md_subscriber->stop();
+        const auto md = md_subscriber->stats();
+        spdlog::info("[MarketDataShm] delivered={} lost={} gaps={} reattaches={} worst lag {:.1f}us",
+                     md.delivered, md.lost, md.gaps, md.reattaches, md.lag_ns_max / 1000.0);
+    }
+    if (md_publisher) {
+        spdlog::info("[MarketDataShm] Gateway published {} updates to {}", md_publisher->published(),
+                     md_publisher->name());
+    }
+
+    if (config.ktls_offload) {
+        const auto ktls_counters = kimp::network::ktls::counters();
+        spdlog::info("[kTLS] offloaded={} fallback={}{}{}", ktls_counters.offloaded, ktls_counters.fallback,
+                     ktls_counters.fallback > 0 ? " last reason: " : "", ktls_counters.last_reason);
+    }
+
     bithumb->disconnect();
     bybit->disconnect();
     if (okx) okx->disconnect();
     if (upbit) upbit->disconnect();
+    for (const auto& connector : account_connectors) {
+        connector->disconnect();
+    }
 
     stop_io_threads();
 
+    // io thread wakeup latency against the CPU it cost
+    const auto reactor_report = io_reactor.report();
+    if (reactor_report.busy_poll) {
+        spdlog::info("[Reactor] busy-poll threads={} handlers={} empty polls {:.1f}% sleeps={} | CPU {:.2f} cores | "
+                     "wakeup p50 <{:.0f}us p99 <{:.0f}us avg {:.1f}us vs epoll avg {:.1f}us | saved ~{:.1f}us/wakeup",
+                     reactor_report.threads, reactor_report.handlers, reactor_report.empty_poll_pct(),
+                     reactor_report.sleeps, reactor_report.cpu_cores,
+                     reactor_report.wakeup.p50_us, reactor_report.wakeup.p99_us, reactor_report.wakeup.avg_us,
+                     epoll_wakeup_baseline.avg_us, epoll_wakeup_baseline.avg_us - reactor_report.wakeup.avg_us);
+    } else if (reactor_report.wakeup.count > 0) {
+        spdlog::info("[Reactor] epoll threads={} handlers={} | CPU {:.2f} cores | wakeup p50 <{:.0f}us p99 <{:.0f}us avg {:.1f}us",
+                     reactor_report.threads, reactor_report.handlers, reactor_report.cpu_cores,
+                     reactor_report.wakeup.p50_us, reactor_report.wakeup.p99_us, reactor_report.wakeup.avg_us);
+    }
+
     spdlog::info("=== Bot Stopped ===");
     kimp::Logger::shutdown();
 
@@ -0,0 +1,86 @@
+#include "kimp/memory/shm_region.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace kimp::memory {
+
+namespace {
+
+void set_error(std::string* error, const std::string& what) {
+    if (error) {
+        *error = what + ": " + std::strerror(errno);
+    }
+}
+
+} // namespace
+
+std::string SharedMemoryRegion::normalize_name(const std::string& name) {
+    return (!name.empty() && name.front() == '/') ? name : "/" + name;
+}
+
+std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::create(const std::string& name, std::size_t bytes,
+                                                               std::string* error) {
+    const std::string shm_name = normalize_name(name);
+    ::shm_unlink(shm_name.c_str());  // A crashed owner leaves its object behind
+
+    const int fd = ::shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        set_error(error, "shm_open " + shm_name);
+        return nullptr;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        set_error(error, "ftruncate " + shm_name);
+        ::close(fd);
+        ::shm_unlink(shm_name.c_str());
+        return nullptr;
+    }
+    void* data = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        set_error(error, "mmap " + shm_name);
+        ::shm_unlink(shm_name.c_str());
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryRegion>(new SharedMemoryRegion(shm_name, data, bytes, true));
+}
+
+std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::attach(const std::string& name, std::string* error) {
+    const std::string shm_name = normalize_name(name);
+    const int fd = ::shm_open(shm_name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        set_error(error, "shm_open " + shm_name);
+        return nullptr;
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        set_error(error, "fstat " + shm_name);
+        ::close(fd);
+        return nullptr;
+    }
+    const auto bytes = static_cast<std::size_t>(st.st_size);
+    // Read/write: readers load slot sequence words with atomics
+    void* data = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        set_error(error, "mmap " + shm_name);
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryRegion>(new SharedMemoryRegion(shm_name, data, bytes, false));
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    if (data_) {
+        ::munmap(data_, size_);
+    }
+    if (owner_) {
+        ::shm_unlink(name_.c_str());
+    }
+}
+
+} // namespace kimp::memory
@@ -0,0 +1,180 @@
+#include "kimp/network/busy_poll_reactor.hpp"
+#include "kimp/core/optimization.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <time.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace kimp::network {
+
+namespace {
+
+int64_t steady_now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t thread_cpu_ns() noexcept {
+    timespec ts{};
+    if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000LL + ts.tv_nsec;
+}
+
+// Counters are published every FLUSH_POLLS polls so the loop touches only
+// thread-local state in between.
+constexpr uint64_t FLUSH_POLLS = 4096;
+
+} // namespace
+
+bool SocketTuning::apply(int fd) const noexcept {
+    bool ok = true;
+#if defined(__linux__)
+    if (rcvbuf_bytes > 0) {
+        ok = ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf_bytes, sizeof(rcvbuf_bytes)) == 0 && ok;
+    }
+    if (busy_poll_us > 0) {
+        ok = ::setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us, sizeof(busy_poll_us)) == 0 && ok;
+    }
+#else
+    (void)fd;
+    ok = empty();
+#endif
+    return ok;
+}
+
+BusyPollReactor::BusyPollReactor(net::io_context& io_context, BusyPollOptions options, std::size_t threads)
+    : io_context_(io_context)
+    , options_(options)
+    , thread_count_(threads)
+    , slots_(std::make_unique<ThreadSlot[]>(std::max<std::size_t>(threads, 1))) {}
+
+void BusyPollReactor::run(std::size_t index) {
+    ThreadSlot& slot = slots_[std::min(index, std::max<std::size_t>(thread_count_, 1) - 1)];
+    if (options_.enabled) {
+        run_busy_poll(slot);
+        return;
+    }
+
+    const int64_t wall_start = steady_now_ns();
+    const int64_t cpu_start = thread_cpu_ns();
+    const std::size_t handlers = io_context_.run();
+    slot.handlers.fetch_add(handlers, std::memory_order_relaxed);
+    slot.cpu_ns.store(thread_cpu_ns() - cpu_start, std::memory_order_relaxed);
+    slot.wall_ns.store(steady_now_ns() - wall_start, std::memory_order_relaxed);
+}
+
+void BusyPollReactor::run_busy_poll(ThreadSlot& slot) {
+    const int64_t spin_idle_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(options_.spin_idle).count();
+    const int64_t max_sleep_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(options_.max_idle_sleep).count();
+
+    const int64_t wall_start = steady_now_ns();
+    const int64_t cpu_start = thread_cpu_ns();
+    uint64_t handlers = 0;
+    uint64_t polls = 0;
+    uint64_t empty_polls = 0;
+    uint64_t sleeps = 0;
+    int64_t idle_since_ns = 0;
+    int64_t sleep_ns = 0;
+
+    auto flush = [&]() {
+        slot.handlers.store(handlers, std::memory_order_relaxed);
+        slot.polls.store(polls, std::memory_order_relaxed);
+        slot.empty_polls.store(empty_polls, std::memory_order_relaxed);
+        slot.sleeps.store(sleeps, std::memory_order_relaxed);
+        slot.cpu_ns.store(thread_cpu_ns() - cpu_start, std::memory_order_relaxed);
+        slot.wall_ns.store(steady_now_ns() - wall_start, std::memory_order_relaxed);
+    };
+
+    while (!io_context_.stopped()) {
+        const std::size_t ran = io_context_.poll();
+        if (++polls % FLUSH_POLLS == 0) {
+            flush();
+        }
+        if (ran > 0) {
+            handlers += ran;
+            idle_since_ns = 0;
+            sleep_ns = 0;
+            continue;
+        }
+
+        ++empty_polls;
+        const int64_t now_ns = steady_now_ns();
+        if (idle_since_ns == 0) {
+            idle_since_ns = now_ns;
+        }
+        if (now_ns - idle_since_ns < spin_idle_ns) {
+            opt::cpu_pause();
+        } else if (max_sleep_ns <= 0) {
+            std::this_thread::yield();
+        } else {
+            sleep_ns = sleep_ns == 0 ? 1'000 : std::min(sleep_ns * 2, max_sleep_ns);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_ns));
+            ++sleeps;
+        }
+    }
+    flush();
+}
+
+void BusyPollReactor::probe_wakeup() {
+    const int64_t posted_ns = steady_now_ns();
+    net::post(io_context_, [this, posted_ns] {
+        wakeup_hist_.record(steady_now_ns() - posted_ns);
+    });
+}
+
+BusyPollReactor::Report BusyPollReactor::report() const {
+    Report out;
+    out.busy_poll = options_.enabled;
+    out.threads = thread_count_;
+    int64_t cpu_ns = 0;
+    int64_t wall_ns = 0;
+    for (std::size_t i = 0; i < thread_count_; ++i) {
+        const ThreadSlot& slot = slots_[i];
+        out.handlers += slot.handlers.load(std::memory_order_relaxed);
+        out.polls += slot.polls.load(std::memory_order_relaxed);
+        out.empty_polls += slot.empty_polls.load(std::memory_order_relaxed);
+        out.sleeps += slot.sleeps.load(std::memory_order_relaxed);
+        cpu_ns += slot.cpu_ns.load(std::memory_order_relaxed);
+        wall_ns = std::max(wall_ns, slot.wall_ns.load(std::memory_order_relaxed));
+    }
+    out.cpu_cores = wall_ns > 0 ? static_cast<double>(cpu_ns) / static_cast<double>(wall_ns) : 0.0;
+    out.wakeup = wakeup_hist_.summary();
+    return out;
+}
+
+LatencyHistogram::Summary BusyPollReactor::measure_blocking_wakeup(int samples) {
+    net::io_context io_context;
+    auto work_guard = net::make_work_guard(io_context);
+    std::thread runner([&io_context] { io_context.run(); });
+
+    LatencyHistogram hist;
+    for (int i = 0; i < samples; ++i) {
+        // Long enough for the runner to park in epoll_wait again
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::atomic<bool> done{false};
+        const int64_t posted_ns = steady_now_ns();
+        net::post(io_context, [&hist, &done, posted_ns] {
+            hist.record(steady_now_ns() - posted_ns);
+            done.store(true, std::memory_order_release);
+        });
+        while (!done.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    work_guard.reset();
+    io_context.stop();
+    runner.join();
+    return hist.summary();
+}
+
+} // namespace kimp::network
@@ -0,0 +1,352 @@
+#include "kimp/network/ktls.hpp"
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/tls1.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#if defined(__linux__)
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+namespace kimp::network::ktls {
+
+namespace {
+
+std::atomic<bool> g_enabled{false};
+std::atomic<uint64_t> g_offloaded{0};
+std::atomic<uint64_t> g_fallback{0};
+std::atomic<const char*> g_last_reason{""};
+
+constexpr std::size_t MAX_SECRET = 48;  // SHA-384
+
+// Traffic secrets captured from the keylog hook, attached to the SSL
+struct CapturedSecrets {
+    std::array<uint8_t, MAX_SECRET> client{};
+    std::array<uint8_t, MAX_SECRET> server{};
+    std::size_t client_len{0};
+    std::size_t server_len{0};
+};
+
+void free_secrets(void*, void* ptr, CRYPTO_EX_DATA*, int, long, void*) {
+    if (ptr) {
+        OPENSSL_cleanse(ptr, sizeof(CapturedSecrets));
+        delete static_cast<CapturedSecrets*>(ptr);
+    }
+}
+
+int secrets_index() {
+    static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, free_secrets);
+    return index;
+}
+
+int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool parse_hex(std::string_view hex, uint8_t* out, std::size_t capacity, std::size_t& len) {
+    if (hex.size() % 2 != 0 || hex.size() / 2 > capacity) {
+        return false;
+    }
+    for (std::size_t i = 0; i < hex.size(); i += 2) {
+        const int hi = hex_value(hex[i]);
+        const int lo = hex_value(hex[i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out[i / 2] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    len = hex.size() / 2;
+    return true;
+}
+
+// NSS key log line: "<LABEL> <client_random hex> <secret hex>"
+void keylog_callback(const SSL* ssl, const char* line) {
+    std::string_view sv(line);
+    const auto sp1 = sv.find(' ');
+    const auto sp2 = sp1 == std::string_view::npos ? sp1 : sv.find(' ', sp1 + 1);
+    if (sp2 == std::string_view::npos) {
+        return;
+    }
+    const std::string_view label = sv.substr(0, sp1);
+    const bool client = label == "CLIENT_TRAFFIC_SECRET_0";
+    if (!client && label != "SERVER_TRAFFIC_SECRET_0") {
+        return;  // Handshake secrets / later generations are not needed
+    }
+
+    auto* mutable_ssl = const_cast<SSL*>(ssl);
+    auto* secrets = static_cast<CapturedSecrets*>(SSL_get_ex_data(ssl, secrets_index()));
+    if (!secrets) {
+        secrets = new CapturedSecrets{};
+        if (!SSL_set_ex_data(mutable_ssl, secrets_index(), secrets)) {
+            delete secrets;
+            return;
+        }
+    }
+    const std::string_view hex = sv.substr(sp2 + 1);
+    if (client) {
+        parse_hex(hex, secrets->client.data(), MAX_SECRET, secrets->client_len);
+    } else {
+        parse_hex(hex, secrets->server.data(), MAX_SECRET, secrets->server_len);
+    }
+}
+
+void forget_secrets(SSL* ssl) {
+    if (auto* secrets = static_cast<CapturedSecrets*>(SSL_get_ex_data(ssl, secrets_index()))) {
+        OPENSSL_cleanse(secrets, sizeof(*secrets));
+    }
+}
+
+// RFC 8446 7.1 HKDF-Expand-Label with an empty context
+bool hkdf_expand_label(const EVP_MD* md, const uint8_t* secret, std::size_t secret_len,
+                       std::string_view label, uint8_t* out, std::size_t out_len) {
+    uint8_t info[2 + 1 + 255 + 1];
+    std::size_t info_len = 0;
+    const std::string full_label = "tls13 " + std::string(label);
+    info[info_len++] = static_cast<uint8_t>(out_len >> 8);
+    info[info_len++] = static_cast<uint8_t>(out_len & 0xff);
+    info[info_len++] = static_cast<uint8_t>(full_label.size());
+    std::memcpy(info + info_len, full_label.data(), full_label.size());
+    info_len += full_label.size();
+    info[info_len++] = 0;  // Context length
+
+    uint8_t block[EVP_MAX_MD_SIZE];
+    unsigned int block_len = 0;
+    uint8_t input[EVP_MAX_MD_SIZE + sizeof(info) + 1];
+    std::size_t produced = 0;
+    for (uint8_t counter = 1; produced < out_len; ++counter) {
+        std::size_t input_len = 0;
+        if (counter > 1) {
+            std::memcpy(input, block, block_len);
+            input_len = block_len;
+        }
+        std::memcpy(input + input_len, info, info_len);
+        input_len += info_len;
+        input[input_len++] = counter;
+        if (!HMAC(md, secret, static_cast<int>(secret_len), input, input_len, block, &block_len)) {
+            return false;
+        }
+        const std::size_t take = std::min<std::size_t>(block_len, out_len - produced);
+        std::memcpy(out + produced, block, take);
+        produced += take;
+    }
+    OPENSSL_cleanse(block, sizeof(block));
+    OPENSSL_cleanse(input, sizeof(input));
+    return true;
+}
+
+Status fallback(const char* reason, Status status = {}) {
+    status.reason = reason;
+    g_fallback.fetch_add(1, std::memory_order_relaxed);
+    g_last_reason.store(reason, std::memory_order_relaxed);
+    return status;
+}
+
+#if defined(__linux__)
+template <typename Info>
+void fill_common(Info& info, const TrafficKeys& keys) {
+    info.info.version = TLS_1_3_VERSION;
+    info.info.cipher_type = keys.cipher_type;
+    std::memcpy(info.key, keys.key.data(), sizeof(info.key));
+    for (int i = 0; i < 8; ++i) {
+        info.rec_seq[i] = static_cast<unsigned char>(keys.sequence >> (56 - 8 * i));
+    }
+}
+
+bool install_keys(int fd, int direction, const TrafficKeys& keys) {
+    int rc = -1;
+    switch (keys.cipher_type) {
+        case TLS_CIPHER_AES_GCM_128: {
+            tls12_crypto_info_aes_gcm_128 info{};
+            fill_common(info, keys);
+            std::memcpy(info.salt, keys.iv.data(), sizeof(info.salt));
+            std::memcpy(info.iv, keys.iv.data() + sizeof(info.salt), sizeof(info.iv));
+            rc = ::setsockopt(fd, SOL_TLS, direction, &info, sizeof(info));
+            OPENSSL_cleanse(&info, sizeof(info));
+            break;
+        }
+        case TLS_CIPHER_AES_GCM_256: {
+            tls12_crypto_info_aes_gcm_256 info{};
+            fill_common(info, keys);
+            std::memcpy(info.salt, keys.iv.data(), sizeof(info.salt));
+            std::memcpy(info.iv, keys.iv.data() + sizeof(info.salt), sizeof(info.iv));
+            rc = ::setsockopt(fd, SOL_TLS, direction, &info, sizeof(info));
+            OPENSSL_cleanse(&info, sizeof(info));
+            break;
+        }
+        case TLS_CIPHER_CHACHA20_POLY1305: {
+            tls12_crypto_info_chacha20_poly1305 info{};
+            fill_common(info, keys);
+            std::memcpy(info.iv, keys.iv.data(), sizeof(info.iv));
+            rc = ::setsockopt(fd, SOL_TLS, direction, &info, sizeof(info));
+            OPENSSL_cleanse(&info, sizeof(info));
+            break;
+        }
+        default:
+            break;
+    }
+    return rc == 0;
+}
+#endif
+
+} // namespace
+
+void set_enabled(bool enabled) noexcept {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool enabled() noexcept {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+bool kernel_available() noexcept {
+#if defined(__linux__)
+    std::ifstream in("/proc/sys/net/ipv4/tcp_available_ulp");
+    std::string ulp;
+    while (in >> ulp) {
+        if (ulp == "tls") return true;
+    }
+#endif
+    return false;
+}
+
+void prepare(SSL_CTX* ctx) noexcept {
+    if (ctx && SSL_CTX_get_keylog_callback(ctx) == nullptr) {
+        SSL_CTX_set_keylog_callback(ctx, keylog_callback);
+    }
+}
+
+bool derive_keys(SSL* ssl, bool write_direction, TrafficKeys& out, const char** reason) noexcept {
+    auto fail = [reason](const char* why) {
+        if (reason) *reason = why;
+        return false;
+    };
+    if (SSL_version(ssl) != TLS1_3_VERSION) {
+        return fail("TLS 1.2 or older session");
+    }
+    const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+    if (!cipher) {
+        return fail("no negotiated cipher");
+    }
+    out = {};
+    switch (SSL_CIPHER_get_protocol_id(cipher)) {
+#if defined(__linux__)
+        case 0x1301: out.cipher_type = TLS_CIPHER_AES_GCM_128; out.key_len = 16; break;
+        case 0x1302: out.cipher_type = TLS_CIPHER_AES_GCM_256; out.key_len = 32; break;
+        case 0x1303: out.cipher_type = TLS_CIPHER_CHACHA20_POLY1305; out.key_len = 32; break;
+#endif
+        default: return fail("cipher not supported by kTLS");
+    }
+
+    const auto* secrets = static_cast<const CapturedSecrets*>(SSL_get_ex_data(ssl, secrets_index()));
+    // Our write key is the client secret when we are the client
+    const bool use_client = write_direction != (SSL_is_server(ssl) == 1);
+    const uint8_t* secret = secrets ? (use_client ? secrets->client.data() : secrets->server.data()) : nullptr;
+    const std::size_t secret_len = secrets ? (use_client ? secrets->client_len : secrets->server_len) : 0;
+    if (!secret || secret_len == 0) {
+        return fail("traffic secret not captured (context not prepared)");
+    }
+
+    const EVP_MD* md = SSL_CIPHER_get_handshake_digest(cipher);
+    if (!md || !hkdf_expand_label(md, secret, secret_len, "key", out.key.data(), out.key_len) ||
+        !hkdf_expand_label(md, secret, secret_len, "iv", out.iv.data(), out.iv.size())) {
+        OPENSSL_cleanse(&out, sizeof(out));
+        return fail("key derivation failed");
+    }
+    out.sequence = 0;  // First application record after the handshake
+    return true;
+}
+
+Status offload(SSL* ssl, int fd) noexcept {
+    if (!enabled()) {
+        return {false, false, "disabled"};
+    }
+#if !defined(__linux__)
+    (void)ssl;
+    (void)fd;
+    return fallback("kTLS requires Linux");
+#else
+    // Records OpenSSL already pulled off the socket would never reach the
+    // kernel's record stream; anything queued for sending must go first
+    if (SSL_has_pending(ssl) || BIO_ctrl_pending(SSL_get_rbio(ssl)) > 0) {
+        forget_secrets(ssl);
+        return fallback("records buffered in user space");
+    }
+    if (BIO_ctrl_pending(SSL_get_wbio(ssl)) > 0) {
+        forget_secrets(ssl);
+        return fallback("unsent records in user space");
+    }
+
+    TrafficKeys tx;
+    TrafficKeys rx;
+    const char* reason = "";
+    const bool derived = derive_keys(ssl, true, tx, &reason) && derive_keys(ssl, false, rx, &reason);
+    forget_secrets(ssl);
+    if (!derived) {
+        return fallback(reason);
+    }
+
+    Status status;
+    if (::setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+        status.reason = "tls ULP unavailable (modprobe tls)";
+    } else if (!install_keys(fd, TLS_RX, rx)) {
+        status.reason = "kernel rejected RX keys";
+    } else {
+        status.rx = true;
+        if (!install_keys(fd, TLS_TX, tx)) {
+            status.reason = "kernel rejected TX keys";
+        } else {
+            status.tx = true;
+        }
+    }
+    OPENSSL_cleanse(&tx, sizeof(tx));
+    OPENSSL_cleanse(&rx, sizeof(rx));
+
+    if (!status.offloaded()) {
+        return fallback(status.reason, status);
+    }
+    g_offloaded.fetch_add(1, std::memory_order_relaxed);
+    return status;
+#endif
+}
+
+bool send_close_notify(int fd) noexcept {
+#if defined(__linux__)
+    unsigned char alert[2] = {1, 0};  // warning, close_notify
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(unsigned char))]{};
+    iovec iov{alert, sizeof(alert)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+    *CMSG_DATA(cmsg) = 21;  // Alert record
+    return ::sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(alert));
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+Counters counters() noexcept {
+    return {g_offloaded.load(std::memory_order_relaxed), g_fallback.load(std::memory_order_relaxed),
+            g_last_reason.load(std::memory_order_relaxed)};
+}
+
+} // namespace kimp::network::ktls
@@ -0,0 +1,184 @@
+#include "kimp/network/market_data_shm.hpp"
+#include "kimp/core/logger.hpp"
+#include "kimp/core/optimization.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace kimp::network {
+
+namespace {
+
+int64_t steady_now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+constexpr int SPIN_ROUNDS = 2000;                         // ~tens of µs of cpu_pause
+constexpr int YIELD_ROUNDS = 200;
+constexpr auto IDLE_NAP = std::chrono::microseconds(50);
+constexpr int64_t RESTART_CHECK_NS = 1'000'000'000;       // Quiet this long → look for a new ring
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// MarketDataPublisher
+// ---------------------------------------------------------------------------
+
+std::unique_ptr<MarketDataPublisher> MarketDataPublisher::create(const std::string& name, std::size_t capacity,
+                                                                 std::string* error) {
+    auto ring = Ring::create(name, capacity, error);
+    if (!ring) {
+        return nullptr;
+    }
+    return std::unique_ptr<MarketDataPublisher>(new MarketDataPublisher(std::move(ring)));
+}
+
+void MarketDataPublisher::publish(const Ticker& ticker) noexcept {
+    publish_message(MarketDataMessage::Kind::Ticker, &ticker, sizeof(ticker));
+}
+
+void MarketDataPublisher::publish(const OrderBook& book) noexcept {
+    publish_message(MarketDataMessage::Kind::OrderBook, &book, sizeof(book));
+}
+
+void MarketDataPublisher::publish_message(MarketDataMessage::Kind kind, const void* data,
+                                          std::size_t size) noexcept {
+    MarketDataMessage msg;
+    msg.kind = kind;
+    std::memcpy(msg.payload.data(), data, size);
+
+    while (lock_.test_and_set(std::memory_order_acquire)) {
+        opt::cpu_pause();
+    }
+    msg.publish_ns = steady_now_ns();
+    ring_->publish(msg);
+    lock_.clear(std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+// MarketDataSubscriber
+// ---------------------------------------------------------------------------
+
+std::unique_ptr<MarketDataSubscriber> MarketDataSubscriber::attach(const std::string& name, std::string* error) {
+    auto ring = Ring::attach(name, error);
+    if (!ring) {
+        return nullptr;
+    }
+    return std::unique_ptr<MarketDataSubscriber>(new MarketDataSubscriber(name, std::move(ring)));
+}
+
+MarketDataSubscriber::MarketDataSubscriber(std::string name, std::unique_ptr<Ring> ring)
+    : name_(std::move(name))
+    , ring_(std::move(ring))
+    , reader_(std::make_unique<Ring::Reader>(*ring_)) {}
+
+MarketDataSubscriber::~MarketDataSubscriber() {
+    stop();
+}
+
+std::size_t MarketDataSubscriber::poll(std::size_t max_messages) {
+    MarketDataMessage msg;
+    std::size_t count = 0;
+    while (count < max_messages && reader_->poll(msg)) {
+        deliver(msg);
+        ++count;
+    }
+    lost_.store(retired_lost_ + reader_->lost(), std::memory_order_relaxed);
+    gaps_.store(retired_gaps_ + reader_->gaps(), std::memory_order_relaxed);
+    return count;
+}
+
+void MarketDataSubscriber::deliver(const MarketDataMessage& msg) {
+    const int64_t lag = steady_now_ns() - msg.publish_ns;
+    if (lag > 0 && static_cast<uint64_t>(lag) > lag_ns_max_.load(std::memory_order_relaxed)) {
+        lag_ns_max_.store(static_cast<uint64_t>(lag), std::memory_order_relaxed);
+    }
+
+    if (msg.kind == MarketDataMessage::Kind::Ticker) {
+        Ticker ticker;
+        std::memcpy(static_cast<void*>(&ticker), msg.payload.data(), sizeof(ticker));
+        if (on_ticker_) on_ticker_(ticker);
+    } else if (msg.kind == MarketDataMessage::Kind::OrderBook) {
+        OrderBook book;
+        std::memcpy(static_cast<void*>(&book), msg.payload.data(), sizeof(book));
+        if (on_orderbook_) on_orderbook_(book);
+    }
+    delivered_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MarketDataSubscriber::reattach_if_restarted() {
+    auto fresh = Ring::attach(name_);
+    if (!fresh || fresh->epoch() == ring_->epoch()) {
+        return false;
+    }
+    // Drain what the old ring still holds before switching over
+    poll();
+    retired_lost_ += reader_->lost();
+    retired_gaps_ += reader_->gaps();
+
+    ring_ = std::move(fresh);
+    // The new gateway may have published while we were idle; replay from
+    // the oldest message it still holds rather than from its tail
+    reader_ = std::make_unique<Ring::Reader>(*ring_, ring_->oldest_available());
+    reattaches_.fetch_add(1, std::memory_order_relaxed);
+    Logger::info("[MarketDataShm] Re-attached to {} (gateway restarted)", ring_->name());
+    return true;
+}
+
+void MarketDataSubscriber::start(int cpu_core) {
+    if (running_.exchange(true)) {
+        return;
+    }
+    thread_ = std::thread([this, cpu_core] { run(cpu_core); });
+}
+
+void MarketDataSubscriber::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void MarketDataSubscriber::run(int cpu_core) {
+    if (cpu_core >= 0 && opt::pin_to_core(cpu_core)) {
+        Logger::info("[MarketDataShm] Subscriber pinned to core {}", cpu_core);
+    }
+
+    int idle_rounds = 0;
+    int64_t last_msg_ns = steady_now_ns();
+    while (running_.load(std::memory_order_relaxed)) {
+        if (poll() > 0) {
+            idle_rounds = 0;
+            last_msg_ns = steady_now_ns();
+            continue;
+        }
+        ++idle_rounds;
+        if (idle_rounds < SPIN_ROUNDS) {
+            opt::cpu_pause();
+        } else if (idle_rounds < SPIN_ROUNDS + YIELD_ROUNDS) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(IDLE_NAP);
+            const int64_t now = steady_now_ns();
+            if (now - last_msg_ns > RESTART_CHECK_NS) {
+                last_msg_ns = now;
+                reattach_if_restarted();
+            }
+        }
+    }
+}
+
+MarketDataSubscriber::Stats MarketDataSubscriber::stats() const noexcept {
+    Stats s;
+    s.delivered = delivered_.load(std::memory_order_relaxed);
+    s.lost = lost_.load(std::memory_order_relaxed);
+    s.gaps = gaps_.load(std::memory_order_relaxed);
+    s.reattaches = reattaches_.load(std::memory_order_relaxed);
+    s.lag_ns_max = lag_ns_max_.load(std::memory_order_relaxed);
+    return s;
+}
+
+} // namespace kimp::network
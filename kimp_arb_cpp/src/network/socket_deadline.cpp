@@ -0,0 +1,77 @@
+#include "kimp/network/socket_deadline.hpp"
+
+#include <sys/socket.h>
+
+namespace kimp::network {
+
+SocketDeadline& SocketDeadline::instance() {
+    static SocketDeadline watchdog;
+    return watchdog;
+}
+
+SocketDeadline::SocketDeadline() : thread_([this]() { run(); }) {}
+
+SocketDeadline::~SocketDeadline() {
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+uint64_t SocketDeadline::arm(int fd, Clock::time_point deadline) {
+    std::lock_guard lock(mutex_);
+    const uint64_t token = next_token_++;
+    armed_.emplace(token, Entry{fd, deadline});
+    const bool earliest = queue_.empty() || deadline < queue_.begin()->first;
+    queue_.emplace(deadline, token);
+    if (earliest) {
+        cv_.notify_one();
+    }
+    return token;
+}
+
+bool SocketDeadline::disarm(uint64_t token) {
+    std::lock_guard lock(mutex_);
+    auto it = armed_.find(token);
+    if (it != armed_.end()) {
+        queue_.erase({it->second.deadline, token});
+        armed_.erase(it);
+        return false;
+    }
+    return expired_.erase(token) > 0;
+}
+
+uint64_t SocketDeadline::fired() const {
+    std::lock_guard lock(mutex_);
+    return fired_;
+}
+
+void SocketDeadline::run() {
+    std::unique_lock lock(mutex_);
+    while (!stop_) {
+        if (queue_.empty()) {
+            cv_.wait(lock);
+            continue;
+        }
+        const auto [deadline, token] = *queue_.begin();
+        if (Clock::now() < deadline) {
+            cv_.wait_until(lock, deadline);
+            continue;
+        }
+        // Under the lock: the owner cannot disarm and close the descriptor meanwhile
+        queue_.erase(queue_.begin());
+        auto it = armed_.find(token);
+        if (it != armed_.end()) {
+            ::shutdown(it->second.fd, SHUT_RDWR);
+            armed_.erase(it);
+            expired_.insert(token);
+            ++fired_;
+        }
+    }
+}
+
+} // namespace kimp::network
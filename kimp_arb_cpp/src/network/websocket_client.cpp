@@ -1,5 +1,8 @@
 #include "kimp/network/websocket_client.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <regex>
 #include <sstream>
 
@@ -80,6 +83,7 @@ void WebSocketClient::disconnect() {
     should_reconnect_ = false;
     reconnect_timer_.cancel();
     ping_timer_.cancel();
+    stall_timer_.cancel();
 
     if (state_.load() == ConnectionState::Disconnected) {
         return;
@@ -102,6 +106,34 @@ void WebSocketClient::reconnect() {
     schedule_reconnect();
 }
 
+void WebSocketClient::force_reconnect(const std::string& reason) {
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+    net::post(strand_, [self = std::move(self), reason] {
+        if (!self->should_reconnect_ || self->state_.load() != ConnectionState::Connected) {
+            return;
+        }
+        Logger::warn("[{}] Dropping session: {}", self->name_, reason);
+
+        // Tear the socket down without a close handshake: a stalled peer
+        // would not answer it. The reconnect is scheduled from on_read once
+        // the pending read has released the old stream.
+        self->state_ = ConnectionState::Reconnecting;
+        self->forced_reconnect_.store(true, std::memory_order_relaxed);
+        self->ping_timer_.cancel();
+        self->stall_timer_.cancel();
+        if (self->ws_) {
+            beast::error_code ignored;
+            beast::get_lowest_layer(*self->ws_).socket().close(ignored);
+        }
+        if (self->on_disconnect_) {
+            self->on_disconnect_(reason);
+        }
+    });
+}
+
 void WebSocketClient::send(std::string message) {
     if (state_.load() != ConnectionState::Connected) {
         Logger::warn("[{}] Cannot send, not connected", name_);
@@ -156,6 +188,22 @@ void WebSocketClient::on_resolve(beast::error_code ec, tcp::resolver::results_ty
     if (!self) {
         return;
     }
+
+    if (endpoint_preference_ > 0 && results.size() > 1) {
+        std::vector<tcp::endpoint> endpoints;
+        endpoints.reserve(results.size());
+        for (const auto& entry : results) {
+            endpoints.push_back(entry.endpoint());
+        }
+        std::rotate(endpoints.begin(),
+                    endpoints.begin() + static_cast<std::ptrdiff_t>(endpoint_preference_ % endpoints.size()),
+                    endpoints.end());
+        beast::get_lowest_layer(*ws_).async_connect(
+            endpoints,
+            beast::bind_front_handler(&WebSocketClient::on_connect, std::move(self)));
+        return;
+    }
+
     beast::get_lowest_layer(*ws_).async_connect(
         results,
         beast::bind_front_handler(&WebSocketClient::on_connect, std::move(self)));
@@ -167,10 +215,15 @@ void WebSocketClient::on_connect(beast::error_code ec, tcp::resolver::results_ty
         return;
     }
 
-    Logger::debug("[{}] TCP connected to {}:{}", name_, host_, ep.port());
+    Logger::debug("[{}] TCP connected to {} ({}:{})", name_, host_, ep.address().to_string(), ep.port());
 
     // Disable Nagle's algorithm for minimum latency
     beast::get_lowest_layer(*ws_).socket().set_option(tcp::no_delay(true));
+    if (!socket_tuning_.empty() &&
+        !socket_tuning_.apply(beast::get_lowest_layer(*ws_).socket().native_handle())) {
+        Logger::warn("[{}] Socket tuning rejected (busy_poll={}us rcvbuf={}): {}", name_,
+                     socket_tuning_.busy_poll_us, socket_tuning_.rcvbuf_bytes, std::strerror(errno));
+    }
 
     // Set SNI hostname for SSL
     if (!SSL_set_tlsext_host_name(ws_->next_layer().native_handle(), host_.c_str())) {
@@ -181,6 +234,9 @@ void WebSocketClient::on_connect(beast::error_code ec, tcp::resolver::results_ty
     }
 
     // SSL handshake
+    if (ktls::enabled()) {
+        ktls::prepare(ssl_context_.native_handle());
+    }
     beast::get_lowest_layer(*ws_).expires_after(std::chrono::seconds(30));
     auto self = weak_from_this().lock();
     if (!self) {
@@ -199,11 +255,26 @@ void WebSocketClient::on_ssl_handshake(beast::error_code ec) {
 
     Logger::debug("[{}] SSL handshake complete", name_);
 
+    // Kernel TLS: must happen before the first application record
+    if (ktls::enabled()) {
+        const auto offload = ws_->next_layer().try_ktls_offload();
+        if (offload.offloaded()) {
+            Logger::info("[{}] kTLS offload active (kernel record crypto)", name_);
+        } else {
+            Logger::info("[{}] kTLS not used ({}){}", name_, offload.reason,
+                         offload.rx ? ", RX offloaded only" : "");
+        }
+    }
+
     // Turn off timeout on TCP stream (WebSocket has its own)
     beast::get_lowest_layer(*ws_).expires_never();
+    if (rx_timestamping_ && !beast::get_lowest_layer(*ws_).enable_rx_timestamps()) {
+        Logger::warn("[{}] Kernel RX timestamps unavailable", name_);
+    }
 
     // Set WebSocket options
     ws_->set_option(websocket::stream_base::timeout::suggested(beast::role_type::client));
+    ws_->set_option(deflate_option(deflate_));
     ws_->set_option(websocket::stream_base::decorator([this](websocket::request_type& req) {
         req.set(beast::http::field::user_agent, "KIMP-Bot/1.0");
         req.set(beast::http::field::host, host_);
@@ -222,7 +293,8 @@ void WebSocketClient::on_ssl_handshake(beast::error_code ec) {
     if (!self) {
         return;
     }
-    ws_->async_handshake(host_, path_,
+    handshake_response_ = {};
+    ws_->async_handshake(handshake_response_, host_, path_,
         beast::bind_front_handler(&WebSocketClient::on_handshake, std::move(self)));
 }
 
@@ -234,9 +306,21 @@ void WebSocketClient::on_handshake(beast::error_code ec) {
 
     state_ = ConnectionState::Connected;
     reconnect_attempts_ = 0;
+    last_message_ns_.store(steady_now_ns(), std::memory_order_relaxed);
 
     Logger::info("[{}] WebSocket connected to {}:{}{}", name_, host_, port_, path_);
 
+    if (deflate_.enabled) {
+        const auto extensions = handshake_response_[beast::http::field::sec_websocket_extensions];
+        const bool negotiated = extensions.find("permessage-deflate") != beast::string_view::npos;
+        deflate_negotiated_.store(negotiated, std::memory_order_relaxed);
+        if (negotiated) {
+            Logger::info("[{}] permessage-deflate negotiated ({})", name_, std::string(extensions));
+        } else {
+            Logger::info("[{}] permessage-deflate declined by server, running uncompressed", name_);
+        }
+    }
+
     if (on_connect_) {
         on_connect_(true, "");
     }
@@ -246,6 +330,7 @@ void WebSocketClient::on_handshake(beast::error_code ec) {
 
     // Start ping timer
     schedule_ping();
+    schedule_stall_check();
 }
 
 void WebSocketClient::do_read() {
@@ -260,6 +345,15 @@ void WebSocketClient::do_read() {
 
 void WebSocketClient::on_read(beast::error_code ec, std::size_t bytes_transferred) {
     (void)bytes_transferred;
+    if (state_.load() != ConnectionState::Connected) {
+        // Session was torn down (disconnect or forced reconnect) while the
+        // read was in flight
+        if (forced_reconnect_.exchange(false, std::memory_order_relaxed) && should_reconnect_) {
+            reconnect_attempts_ = 0;
+            schedule_reconnect();
+        }
+        return;
+    }
     if (ec) {
         if (ec == websocket::error::closed) {
             Logger::info("[{}] WebSocket closed by server", name_);
@@ -274,6 +368,8 @@ void WebSocketClient::on_read(beast::error_code ec, std::size_t bytes_transferre
         return;
     }
 
+    last_message_ns_.store(steady_now_ns(), std::memory_order_relaxed);
+
     // Process message
     if (on_message_) {
         const auto buffers = read_buffer_.data();
@@ -281,6 +377,8 @@ void WebSocketClient::on_read(beast::error_code ec, std::size_t bytes_transferre
             net::buffer_cast<const char*>(buffers),
             net::buffer_size(buffers));
         auto type = ws_->got_text() ? MessageType::Text : MessageType::Binary;
+        const int64_t kernel_rx_ns = beast::get_lowest_layer(*ws_).last_rx_realtime_ns();
+        FrameRxScope rx_scope(kernel_rx_ns != 0 ? FrameRxInfo{kernel_rx_ns, realtime_now_ns()} : FrameRxInfo{});
         on_message_(data, type);
     }
     read_buffer_.consume(read_buffer_.size());
@@ -371,8 +469,8 @@ void WebSocketClient::schedule_reconnect() {
         return;
     }
 
-    // Exponential backoff with cap at RECONNECT_MAX_DELAY_MS
-    int delay = std::min(RECONNECT_DELAY_MS * attempts, RECONNECT_MAX_DELAY_MS);
+    // Immediate first retry, then exponential backoff capped at RECONNECT_MAX_DELAY_MS
+    int delay = reconnect_delay_ms(attempts);
     Logger::info("[{}] Reconnecting in {}ms (attempt {})",
                  name_, delay, attempts);
 
@@ -434,6 +532,51 @@ void WebSocketClient::on_ping_timer(beast::error_code ec) {
     schedule_ping();
 }
 
+void WebSocketClient::schedule_stall_check() {
+    const int64_t timeout_ms = stall_timeout_ms_.load(std::memory_order_relaxed);
+    if (timeout_ms <= 0) {
+        return;
+    }
+    stall_timer_.expires_after(std::chrono::milliseconds(
+        std::max<int64_t>(timeout_ms / 4, STALL_MIN_CHECK_MS)));
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+    stall_timer_.async_wait(
+        beast::bind_front_handler(&WebSocketClient::on_stall_timer, std::move(self)));
+}
+
+void WebSocketClient::on_stall_timer(beast::error_code ec) {
+    if (ec == net::error::operation_aborted) {
+        return;
+    }
+
+    if (ec || state_.load() != ConnectionState::Connected) {
+        return;
+    }
+
+    const int64_t timeout_ms = stall_timeout_ms_.load(std::memory_order_relaxed);
+    if (timeout_ms <= 0) {
+        return;
+    }
+
+    const int64_t now_ns = steady_now_ns();
+    const int64_t silent_ms = (now_ns - last_message_ns_.load(std::memory_order_relaxed)) / 1'000'000;
+    if (silent_ms >= timeout_ms) {
+        Logger::warn("[{}] Stalled: no frames for {}ms (budget {}ms)", name_, silent_ms, timeout_ms);
+        // Re-arm the window so the owner hears about a stall once per budget
+        last_message_ns_.store(now_ns, std::memory_order_relaxed);
+        if (!on_stall_) {
+            force_reconnect("stall");
+            return;
+        }
+        on_stall_(silent_ms);
+    }
+
+    schedule_stall_check();
+}
+
 void WebSocketClient::handle_error(const std::string& operation, beast::error_code ec) {
     if (ec == net::error::operation_aborted) {
         return;
@@ -1,4 +1,5 @@
 #include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/core/flight_recorder.hpp"
 #include "kimp/core/latency_probe.hpp"
 #include "kimp/strategy/entry_selection_bitmap.hpp"
 #include "kimp/core/logger.hpp"
@@ -22,6 +23,28 @@ uint64_t steady_now_ms() {
         std::chrono::steady_clock::now().time_since_epoch()).count());
 }
 
+int64_t steady_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Kernel receive timing of the ticker being handled on this thread, so a
+// signal detected synchronously from it can report feed-side latency.
+struct TriggerRx {
+    int64_t kernel_rx_ns{0};
+    int64_t rx_queue_ns{0};
+};
+thread_local TriggerRx current_trigger_rx{};
+
+struct TriggerRxScope {
+    explicit TriggerRxScope(const Ticker& ticker) noexcept {
+        current_trigger_rx = TriggerRx{ticker.kernel_rx_ns, ticker.rx_queue_ns};
+    }
+    ~TriggerRxScope() { current_trigger_rx = TriggerRx{}; }
+    TriggerRxScope(const TriggerRxScope&) = delete;
+    TriggerRxScope& operator=(const TriggerRxScope&) = delete;
+};
+
 double spread_pct(double bid, double ask) {
     if (bid <= 0.0 || ask <= 0.0 || ask < bid) {
         return std::numeric_limits<double>::infinity();
@@ -33,11 +56,14 @@ double spread_pct(double bid, double ask) {
     return ((ask - bid) / mid) * 100.0;
 }
 
+// Ages use the venue event time when the venue clock is synced, so a quote
+// that sat in a slow feed is not mistaken for a fresh one.
 bool quote_is_fresh_with_limit(const PriceCache::PriceData& price, uint64_t now_ms,
                                uint64_t max_age_ms) {
     if (!price.valid || price.timestamp == 0) return false;
-    if (now_ms < price.timestamp) return false;
-    return (now_ms - price.timestamp) <= max_age_ms;
+    const uint64_t quote_ts = price.quote_ts();
+    if (now_ms < quote_ts) return false;
+    return (now_ms - quote_ts) <= max_age_ms;
 }
 
 bool quote_pair_is_usable(Exchange korean_ex,
@@ -59,9 +85,9 @@ bool quote_pair_is_usable(Exchange korean_ex,
         return false;
     }
 
-    const uint64_t ts_diff = korean_price.timestamp >= foreign_price.timestamp
-                                 ? korean_price.timestamp - foreign_price.timestamp
-                                 : foreign_price.timestamp - korean_price.timestamp;
+    const uint64_t korean_ts = korean_price.quote_ts();
+    const uint64_t foreign_ts = foreign_price.quote_ts();
+    const uint64_t ts_diff = korean_ts >= foreign_ts ? korean_ts - foreign_ts : foreign_ts - korean_ts;
     if (ts_diff > max_desync) {
         return false;
     }
@@ -81,7 +107,8 @@ bool quote_pair_is_usable(Exchange korean_ex,
 void write_premiums_json_file(
     const std::string& path,
     bool connected,
-    const std::vector<kimp::strategy::ArbitrageEngine::PremiumInfo>& premiums) {
+    const std::vector<kimp::strategy::ArbitrageEngine::PremiumInfo>& premiums,
+    const kimp::strategy::TradeStats::Summary& perf) {
     const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
 
@@ -97,10 +124,28 @@ void write_premiums_json_file(
         "    \"symbolCount\": {},\n"
         "    \"lastUpdate\": {}\n"
         "  }},\n"
+        "  \"performance\": {{\n"
+        "    \"trades\": {},\n"
+        "    \"winRate\": {:.2f},\n"
+        "    \"totalPnlUsd\": {:.4f},\n"
+        "    \"meanPnlUsd\": {:.4f},\n"
+        "    \"stddevPnlUsd\": {:.4f},\n"
+        "    \"sharpe\": {:.4f},\n"
+        "    \"rollingSharpe\": {:.4f},\n"
+        "    \"rollingTrades\": {},\n"
+        "    \"profitFactor\": {:.4f},\n"
+        "    \"drawdownUsd\": {:.4f},\n"
+        "    \"maxDrawdownUsd\": {:.4f},\n"
+        "    \"maxDrawdownPct\": {:.4f}\n"
+        "  }},\n"
         "  \"premiums\": [\n",
         connected ? "true" : "false",
         premiums.size(),
-        now_ms);
+        now_ms,
+        perf.all.trades, perf.all.win_rate_pct(), perf.all.total_pnl,
+        perf.all.mean, perf.all.stddev(), perf.all.sharpe(),
+        perf.rolling_sharpe(), perf.rolling_trades, perf.all.profit_factor(),
+        perf.drawdown_usd, perf.max_drawdown_usd, perf.max_drawdown_pct);
 
     for (size_t i = 0; i < premiums.size(); ++i) {
         const auto& p = premiums[i];
@@ -141,6 +186,7 @@ void write_premiums_json_file(
             "      \"bybitTotalFeeKrw\": {:.2f},\n"
             "      \"totalFeeKrw\": {:.2f},\n"
             "      \"netProfitKrw\": {:.2f},\n"
+            "      \"adverseMovePct\": {:.6f},\n"
             "      \"bothCanFillTarget\": {},\n"
             "      \"signal\": {},\n"
             "      \"ageMs\": {},\n"
@@ -157,7 +203,7 @@ void write_premiums_json_file(
             p.bithumb_top_krw, p.bithumb_top_usdt, p.bybit_top_usdt, p.bybit_top_krw,
             p.gross_edge_pct, p.net_edge_pct,
             p.bithumb_total_fee_krw, p.bybit_total_fee_usdt, p.bybit_total_fee_krw, p.total_fee_krw,
-            p.net_profit_krw,
+            p.net_profit_krw, p.adverse_move_pct,
             p.both_can_fill_target ? "true" : "false",
             signal_str, p.age_ms, now_ms);
 
@@ -193,10 +239,11 @@ void ArbitrageEngine::set_exchange(Exchange ex, ExchangePtr exchange) {
     exchanges_[static_cast<size_t>(ex)] = std::move(exchange);
 }
 
-void ArbitrageEngine::add_symbol(const SymbolId& symbol) {
+bool ArbitrageEngine::add_symbol(const SymbolId& symbol) {
+    std::lock_guard lock(symbols_mutex_);
     // Check if already exists using O(1) lookup (collision-safe)
-    if (korean_symbol_index_.count(symbol)) {
-        return;  // Already added
+    if (korean_symbol_index_.contains(symbol)) {
+        return false;  // Already added
     }
 
     if (monitored_symbols_.size() >= MAX_CACHED_SYMBOLS) {
@@ -209,21 +256,22 @@ void ArbitrageEngine::add_symbol(const SymbolId& symbol) {
                 MAX_CACHED_SYMBOLS
             );
         }
-        return;
+        return false;
     }
 
-    // Add to vectors
-    size_t idx = monitored_symbols_.size();
-    monitored_symbols_.push_back(symbol);
-
     // Pre-compute foreign symbol (BTC/KRW -> BTC/USDT)
+    size_t idx = monitored_symbols_.size();
     SymbolId foreign_symbol(symbol.get_base(), "USDT");
+
+    // Foreign side first: readers bound loops by monitored_symbols_.size()
     foreign_symbols_.push_back(foreign_symbol);
+    monitored_symbols_.push_back(symbol);
 
-    // Populate O(1) lookup maps (SymbolId key — no hash collision risk)
-    korean_symbol_index_[symbol] = idx;
-    foreign_symbol_index_[foreign_symbol] = idx;
+    // Populate O(1) lookup maps last, so a ticker only resolves to a built index
+    foreign_symbol_index_.get_or_add(foreign_symbol, idx);
+    korean_symbol_index_.get_or_add(symbol, idx);
     // entry_cache_[idx] is pre-initialized (fixed array, default values)
+    return true;
 }
 
 void ArbitrageEngine::add_exchange_pair(Exchange korean, Exchange foreign) {
@@ -265,19 +313,23 @@ void ArbitrageEngine::stop() {
 }
 
 void ArbitrageEngine::on_ticker_update(const Ticker& ticker) {
+    TriggerRxScope trigger_rx(ticker);
     const uint64_t ticker_ts_ms = static_cast<uint64_t>(
         std::chrono::duration_cast<std::chrono::milliseconds>(
             ticker.timestamp.time_since_epoch()).count());
+    const uint64_t venue_age_ms = static_cast<uint64_t>(ticker.venue_age_ns / 1'000'000);
+    const uint64_t event_ts_ms = ticker.venue_age_ns > 0 && ticker_ts_ms > venue_age_ms
+                                     ? ticker_ts_ms - venue_age_ms : 0;
     price_cache_.update(ticker.exchange, ticker.symbol, ticker.bid, ticker.ask, ticker.last,
-                        ticker_ts_ms, ticker.bid_qty, ticker.ask_qty);
+                        ticker_ts_ms, ticker.bid_qty, ticker.ask_qty, event_ts_ms);
 
     // Update USDT price if this is USDT/KRW (fast char-based check)
     if (ticker.symbol.is_usdt_krw()) {
-        double usdt_price = ticker.last;
-        if (ticker.bid > 0.0 && ticker.ask > 0.0 && ticker.ask >= ticker.bid) {
-            usdt_price = (ticker.bid + ticker.ask) * 0.5;  // Prefer executable mid over last trade
+        const int64_t ts_ns = ticker.timestamp.time_since_epoch().count();
+        if (!apply_usdt_quote(ticker.exchange, ticker.bid, ticker.ask, ticker.bid_qty, ticker.ask_qty,
+                              ticker.last, ts_ns > 0 ? ts_ns : steady_now_ns())) {
+            return;  // Rejected or below the republish epsilon: premiums are unchanged
         }
-        on_usdt_update(ticker.exchange, usdt_price);
 
         // USDT rate affects ALL premiums → recompute everything
         update_all_entries();
@@ -302,14 +354,19 @@ void ArbitrageEngine::on_ticker_update(const Ticker& ticker) {
     size_t idx = SIZE_MAX;
 
     if (is_korean) {
-        auto it = korean_symbol_index_.find(ticker.symbol);
-        if (it != korean_symbol_index_.end()) idx = it->second;
+        if (const size_t* found = korean_symbol_index_.find(ticker.symbol)) idx = *found;
     } else {
-        auto it = foreign_symbol_index_.find(ticker.symbol);
-        if (it != foreign_symbol_index_.end()) idx = it->second;
+        if (const size_t* found = foreign_symbol_index_.find(ticker.symbol)) idx = *found;
     }
 
     if (idx != SIZE_MAX) {
+        fill_risk_.on_quote(ticker.exchange, idx, ticker.bid, ticker.ask,
+                            ticker.timestamp.time_since_epoch().count());
+        if (entry_candidate_bits_.test(idx) || position_tracker_.has_position(monitored_symbols_[idx])) {
+            FlightRecorder::record(FlightEventType::Quote, ticker.exchange, ticker.symbol, 0,
+                                   ticker.bid, ticker.ask, ticker.bid_qty, ticker.ask_qty);
+        }
+
         // O(1) premium recompute for this symbol
         update_symbol_entry(idx);
 
@@ -342,29 +399,35 @@ void ArbitrageEngine::on_ticker_update(const Ticker& ticker) {
     update_cv_.notify_all();
 }
 
-void ArbitrageEngine::on_usdt_update(Exchange ex, double price) {
-    if (price <= 0.0) {
-        return;
-    }
+bool ArbitrageEngine::on_usdt_update(Exchange ex, double price) {
+    return apply_usdt_quote(ex, price, price, 0.0, 0.0, price, steady_now_ns());
+}
 
-    double prev = price_cache_.get_usdt_krw(ex);
-    if (prev > 0.0) {
-        double jump_pct = std::fabs(price - prev) / prev * 100.0;
-        if (jump_pct > TradingConfig::MAX_USDT_JUMP_PCT) {
-            Logger::warn("USDT/KRW outlier filtered from {}: prev={:.2f}, new={:.2f}, jump={:.2f}%",
-                         exchange_name(ex),
-                         prev, price, jump_pct);
-            return;
+bool ArbitrageEngine::apply_usdt_quote(Exchange ex, double bid, double ask, double bid_qty, double ask_qty,
+                                       double last, int64_t now_ns) {
+    const auto result = usdt_fx_.on_quote(ex, bid, ask, bid_qty, ask_qty, last, now_ns);
+    if (!result.accepted) {
+        if ((bid > 0.0 || last > 0.0) && !usdt_rejecting_.exchange(true, std::memory_order_relaxed)) {
+            const auto venue = usdt_fx_.venue(ex, now_ns);
+            Logger::warn("USDT/KRW outlier filtered from {}: bid={:.2f}, ask={:.2f}, composite={:.2f} "
+                         "(rejected {} from this venue)",
+                         exchange_name(ex), bid, ask, result.rate, venue.rejected);
         }
+        return false;
+    }
+    usdt_rejecting_.store(false, std::memory_order_relaxed);
+    if (!result.published) {
+        return false;
     }
 
-    const auto idx = static_cast<size_t>(ex);
-    const double last_logged = last_usdt_log_[idx].load(std::memory_order_relaxed);
-    if (std::fabs(price - last_logged) >= 1.0) {
-        Logger::debug("USDT/KRW update from {}: {:.2f}", exchange_name(ex), price);
-        last_usdt_log_[idx].store(price, std::memory_order_relaxed);
+    if (std::fabs(result.rate - last_usdt_log_.load(std::memory_order_relaxed)) >= 1.0) {
+        Logger::debug("USDT/KRW composite {:.2f} (from {})", result.rate, exchange_name(ex));
+        last_usdt_log_.store(result.rate, std::memory_order_relaxed);
     }
-    price_cache_.update_usdt_krw(ex, price);
+    // Every Korean venue converts at the composite, so cross-venue premiums compare like for like
+    price_cache_.update_usdt_krw(Exchange::Bithumb, result.rate);
+    price_cache_.update_usdt_krw(Exchange::Upbit, result.rate);
+    return true;
 }
 
 bool ArbitrageEngine::close_position(const SymbolId& symbol, Position& closed) {
@@ -412,9 +475,10 @@ double ArbitrageEngine::calculate_premium(const SymbolId& symbol,
     // Get foreign price (need BID for entry calculation)
     // O(1) hash map lookup instead of linear search
     SymbolId foreign_symbol;
-    auto it = korean_symbol_index_.find(symbol);
-    if (it != korean_symbol_index_.end()) {
-        foreign_symbol = foreign_symbols_[it->second];
+    size_t symbol_idx = MAX_CACHED_SYMBOLS;  // Out of range: no borrow rate
+    if (const size_t* found = korean_symbol_index_.find(symbol)) {
+        symbol_idx = *found;
+        foreign_symbol = foreign_symbols_[*found];
     } else {
         foreign_symbol = SymbolId(symbol.get_base(), "USDT");
     }
@@ -443,6 +507,7 @@ double ArbitrageEngine::calculate_premium(const SymbolId& symbol,
             TradingConfig::get_korean_fee_rate(pair.korean),
             TradingConfig::get_foreign_fee_rate(pair.foreign),
             withdraw_fee);
+        PremiumCalculator::apply_borrow_cost(relay_metrics, borrow_cost_.hold_cost_rate(pair.foreign, symbol_idx));
         if (relay_metrics.net_profit_krw > best_net_profit ||
             (relay_metrics.net_profit_krw == best_net_profit &&
              relay_metrics.net_edge_pct > best_net_edge)) {
@@ -476,6 +541,45 @@ void ArbitrageEngine::refresh_entry_filters() {
     update_cv_.notify_all();
 }
 
+void ArbitrageEngine::refresh_entry_filters(const std::vector<std::string>& bases) {
+    if (bases.empty()) return;
+    size_t refreshed = 0;
+    for (size_t i = 0; i < monitored_symbols_.size(); ++i) {
+        const auto base = monitored_symbols_[i].get_base();
+        if (std::binary_search(bases.begin(), bases.end(), base,
+                               [](const auto& a, const auto& b) {
+                                   return std::string_view(a) < std::string_view(b);
+                               })) {
+            update_symbol_entry(i);
+            ++refreshed;
+        }
+    }
+    if (refreshed == 0) return;
+    update_seq_.fetch_add(1, std::memory_order_release);
+    update_cv_.notify_all();
+}
+
+std::vector<std::string> ArbitrageEngine::apply_borrow_rates(
+        Exchange foreign, const std::unordered_map<std::string, double>& hourly_rates) {
+    std::vector<std::string> changed;
+    for (size_t i = 0; i < monitored_symbols_.size(); ++i) {
+        const std::string base(monitored_symbols_[i].get_base());
+        auto it = hourly_rates.find(base);
+        if (it == hourly_rates.end()) continue;
+        if (borrow_cost_.hourly_rate(foreign, i) == it->second) continue;
+        borrow_cost_.set_rate(foreign, i, it->second);
+        changed.push_back(base);
+    }
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    return changed;
+}
+
+double ArbitrageEngine::get_borrow_rate(Exchange foreign, const SymbolId& korean_symbol) const {
+    const size_t* found = korean_symbol_index_.find(korean_symbol);
+    return found ? borrow_cost_.hourly_rate(foreign, *found) : 0.0;
+}
+
 void ArbitrageEngine::monitor_loop() {
     // Apply CPU pinning and RT priority for strategy thread
     auto thread_config = opt::ThreadConfig::optimal();
@@ -551,7 +655,9 @@ void ArbitrageEngine::update_symbol_entry(size_t idx) {
     const auto& foreign_symbol = foreign_symbols_[idx];
     const std::string base(symbol.get_base());
 
-    // Pick the pair with the best projected net profit after fees and transfer cost.
+    // Pick the pair with the best expected net profit: after fees, transfer
+    // cost and the premium the books are expected to give up while the legs
+    // are in flight.
     Exchange best_korean_ex = exchange_pairs_[0].korean;
     Exchange best_foreign_ex = exchange_pairs_[0].foreign;
     PriceCache::PriceData best_korean_price{};
@@ -585,11 +691,15 @@ void ArbitrageEngine::update_symbol_entry(size_t idx) {
             TradingConfig::get_korean_fee_rate(pair.korean),
             TradingConfig::get_foreign_fee_rate(pair.foreign),
             withdraw_fee);
-        if (relay_metrics.net_profit_krw > best_net_profit ||
-            (relay_metrics.net_profit_krw == best_net_profit &&
-             relay_metrics.net_edge_pct > best_net_edge)) {
-            best_net_profit = relay_metrics.net_profit_krw;
-            best_net_edge = relay_metrics.net_edge_pct;
+        PremiumCalculator::apply_borrow_cost(relay_metrics, borrow_cost_.hold_cost_rate(pair.foreign, idx));
+        const double adverse_pct = fill_risk_.adverse_move_pct(pair.korean, pair.foreign, idx);
+        const double expected_profit = FillRiskModel::expected_profit_krw(
+            relay_metrics.net_profit_krw, relay_metrics.match_buy_krw, adverse_pct);
+        const double expected_edge = relay_metrics.net_edge_pct - adverse_pct;
+        if (expected_profit > best_net_profit ||
+            (expected_profit == best_net_profit && expected_edge > best_net_edge)) {
+            best_net_profit = expected_profit;
+            best_net_edge = expected_edge;
             best_korean_ex = pair.korean;
             best_foreign_ex = pair.foreign;
             best_korean_price = korean_price;
@@ -617,6 +727,7 @@ void ArbitrageEngine::update_symbol_entry(size_t idx) {
         TradingConfig::get_korean_fee_rate(best_korean_ex),
         TradingConfig::get_foreign_fee_rate(best_foreign_ex),
         withdraw_fee);
+    PremiumCalculator::apply_borrow_cost(relay_metrics, borrow_cost_.hold_cost_rate(best_foreign_ex, idx));
 
     bool qualifies = TradingConfig::entry_gate_passes(
         relay_metrics.both_can_fill_target,
@@ -670,9 +781,9 @@ void ArbitrageEngine::fire_entry_from_cache() {
     int active_positions = 0;
     position_tracker_.for_each_active_position([&](const Position& pos) {
         ++active_positions;
-        auto it = korean_symbol_index_.find(pos.symbol);
-        if (it == korean_symbol_index_.end()) return;
-        const size_t idx = it->second;
+        const size_t* found = korean_symbol_index_.find(pos.symbol);
+        if (found == nullptr) return;
+        const size_t idx = *found;
         if (idx >= symbol_count || idx >= MAX_CACHED_SYMBOLS) return;
 
         const double actual_usd = pos.foreign_amount * pos.foreign_entry_price;
@@ -708,16 +819,25 @@ void ArbitrageEngine::fire_entry_from_cache() {
         signal.net_profit_krw = c.net_profit_krw.load(std::memory_order_relaxed);
         signal.both_can_fill_target = c.both_can_fill_target.load(std::memory_order_relaxed);
         signal.usdt_krw_rate = c.usdt_rate.load(std::memory_order_relaxed);
+        // aux0: triggering frame's socket-to-handler delay; aux1: kernel RX -> signal
+        int64_t rx_to_signal_ns = 0;
+        if (current_trigger_rx.kernel_rx_ns != 0) {
+            rx_to_signal_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count() - current_trigger_rx.kernel_rx_ns;
+        }
         LatencyProbe::instance().record_at_ns(
             signal.trace_id,
             signal.trace_symbol,
             LatencyStage::SignalDetected,
             signal.trace_start_ns,
             signal.trace_start_ns,
-            0,
-            0,
+            current_trigger_rx.rx_queue_ns,
+            rx_to_signal_ns,
             signal.net_edge_pct,
             signal.max_tradable_usdt_at_best);
+        FlightRecorder::record(FlightEventType::EntryDecision, signal.korean_exchange, signal.symbol, signal.trace_id,
+                               signal.premium, signal.net_edge_pct, signal.korean_ask, signal.foreign_bid,
+                               0, 0, signal.foreign_exchange);
         if (on_entry_signal_) on_entry_signal_(signal);
         entry_signals_.try_push(signal);
     };
@@ -758,9 +878,8 @@ void ArbitrageEngine::check_exit_conditions() {
         const SymbolId* foreign_symbol_ptr = nullptr;
         SymbolId fallback_symbol;
 
-        auto it = korean_symbol_index_.find(pos.symbol);
-        if (it != korean_symbol_index_.end()) {
-            foreign_symbol_ptr = &foreign_symbols_[it->second];
+        if (const size_t* found = korean_symbol_index_.find(pos.symbol)) {
+            foreign_symbol_ptr = &foreign_symbols_[*found];
         } else {
             fallback_symbol = SymbolId(pos.symbol.get_base(), "USDT");
             foreign_symbol_ptr = &fallback_symbol;
@@ -781,10 +900,9 @@ void ArbitrageEngine::check_exit_conditions() {
         double premium = PremiumCalculator::calculate_exit_premium(
             korean_price.bid, foreign_price.ask, usdt_rate);
 
-        // Dynamic exit threshold with a hard floor (+0.10% by default)
-        double dynamic_exit = std::max(
-            pos.entry_premium + TradingConfig::DYNAMIC_EXIT_SPREAD,
-            TradingConfig::EXIT_PREMIUM_THRESHOLD);
+        // Dynamic exit threshold with a hard floor, raised by accrued borrow interest
+        double dynamic_exit = TradingConfig::dynamic_exit_threshold(
+            pos.entry_premium, get_borrow_cost_pct(pos));
         if (premium < dynamic_exit) return;
 
         // Generate signal
@@ -799,6 +917,9 @@ void ArbitrageEngine::check_exit_conditions() {
         signal.korean_bid = korean_price.bid;
         signal.foreign_ask = foreign_price.ask;
         signal.usdt_krw_rate = usdt_rate;
+        FlightRecorder::record(FlightEventType::ExitDecision, signal.korean_exchange, signal.symbol, signal.trace_id,
+                               premium, dynamic_exit, signal.korean_bid, signal.foreign_ask,
+                               0, 0, signal.foreign_exchange);
 
         if (on_exit_signal_) {
             on_exit_signal_(signal);
@@ -830,10 +951,11 @@ void ArbitrageEngine::check_symbol_exit(size_t idx) {
     double premium = PremiumCalculator::calculate_exit_premium(
         korean_price.bid, foreign_price.ask, usdt_rate);
 
-    // Dynamic exit threshold with a hard floor
-    double dynamic_exit = std::max(
-        pos.entry_premium + TradingConfig::DYNAMIC_EXIT_SPREAD,
-        TradingConfig::EXIT_PREMIUM_THRESHOLD);
+    // Dynamic exit threshold with a hard floor, raised by accrued borrow interest
+    double dynamic_exit = TradingConfig::dynamic_exit_threshold(
+        pos.entry_premium,
+        BorrowCostModel::accrued_pct(pos, borrow_cost_.hourly_rate(pos.foreign_exchange, idx),
+                                     std::chrono::system_clock::now()));
     if (premium < dynamic_exit) return;
 
     ExitSignal signal;
@@ -847,6 +969,9 @@ void ArbitrageEngine::check_symbol_exit(size_t idx) {
     signal.korean_bid = korean_price.bid;
     signal.foreign_ask = foreign_price.ask;
     signal.usdt_krw_rate = usdt_rate;
+    FlightRecorder::record(FlightEventType::ExitDecision, signal.korean_exchange, signal.symbol, signal.trace_id,
+                           premium, dynamic_exit, signal.korean_bid, signal.foreign_ask,
+                           0, 0, signal.foreign_exchange);
 
     if (on_exit_signal_) {
         on_exit_signal_(signal);
@@ -898,7 +1023,7 @@ std::vector<ArbitrageEngine::PremiumInfo> ArbitrageEngine::get_all_premiums() co
     best_korean_exchanges.reserve(n);
 
     // Phase 1: Collect valid prices directly into SoA arrays (single pass)
-    // For each symbol, pick the pair with the best projected net profit across exchange pairs.
+    // For each symbol, pick the pair with the best expected net profit across exchange pairs.
     for (size_t i = 0; i < n; ++i) {
         const auto& symbol = monitored_symbols_[i];
         const auto& foreign_symbol = foreign_symbols_[i];
@@ -933,11 +1058,15 @@ std::vector<ArbitrageEngine::PremiumInfo> ArbitrageEngine::get_all_premiums() co
                 TradingConfig::get_korean_fee_rate(pair.korean),
                 TradingConfig::get_foreign_fee_rate(pair.foreign),
                 withdraw_fee);
-            if (relay_metrics.net_profit_krw > best_net_profit ||
-                (relay_metrics.net_profit_krw == best_net_profit &&
-                 relay_metrics.net_edge_pct > best_net_edge)) {
-                best_net_profit = relay_metrics.net_profit_krw;
-                best_net_edge = relay_metrics.net_edge_pct;
+            PremiumCalculator::apply_borrow_cost(relay_metrics, borrow_cost_.hold_cost_rate(pair.foreign, i));
+            const double adverse_pct = fill_risk_.adverse_move_pct(pair.korean, pair.foreign, i);
+            const double expected_profit = FillRiskModel::expected_profit_krw(
+                relay_metrics.net_profit_krw, relay_metrics.match_buy_krw, adverse_pct);
+            const double expected_edge = relay_metrics.net_edge_pct - adverse_pct;
+            if (expected_profit > best_net_profit ||
+                (expected_profit == best_net_profit && expected_edge > best_net_edge)) {
+                best_net_profit = expected_profit;
+                best_net_edge = expected_edge;
                 best_kr = korean_price;
                 best_fr = foreign_price;
                 best_rate = usdt_rate;
@@ -956,8 +1085,8 @@ std::vector<ArbitrageEngine::PremiumInfo> ArbitrageEngine::get_all_premiums() co
             foreign_asks.push_back(best_fr.ask);
             foreign_ask_qtys.push_back(best_fr.ask_qty);
             usdt_rates.push_back(best_rate);
-            korean_timestamps.push_back(best_kr.timestamp);
-            foreign_timestamps.push_back(best_fr.timestamp);
+            korean_timestamps.push_back(best_kr.quote_ts());
+            foreign_timestamps.push_back(best_fr.quote_ts());
             symbol_indices.push_back(i);
             best_korean_exchanges.push_back(best_k_ex);
             best_foreign_exchanges.push_back(best_f_ex);
@@ -1020,6 +1149,8 @@ std::vector<ArbitrageEngine::PremiumInfo> ArbitrageEngine::get_all_premiums() co
             TradingConfig::get_korean_fee_rate(best_korean_exchanges[i]),
             TradingConfig::get_foreign_fee_rate(best_foreign_exchanges[i]),
             withdraw_fee);
+        PremiumCalculator::apply_borrow_cost(
+            relay_metrics, borrow_cost_.hold_cost_rate(best_foreign_exchanges[i], symbol_indices[i]));
         info.match_qty = relay_metrics.match_qty;
         info.target_coin_qty = relay_metrics.target_coin_qty;
         info.max_tradable_usdt_at_best = relay_metrics.max_tradable_usdt_at_best;
@@ -1036,6 +1167,8 @@ std::vector<ArbitrageEngine::PremiumInfo> ArbitrageEngine::get_all_premiums() co
         info.withdraw_fee_krw = relay_metrics.withdraw_fee_krw;
         info.total_fee_krw = relay_metrics.total_fee_krw;
         info.net_profit_krw = relay_metrics.net_profit_krw;
+        info.adverse_move_pct = fill_risk_.adverse_move_pct(
+            best_korean_exchanges[i], best_foreign_exchanges[i], symbol_indices[i]);
         info.both_can_fill_target = relay_metrics.both_can_fill_target;
         const uint64_t newest_ts = std::max(korean_timestamps[i], foreign_timestamps[i]);
         info.age_ms = newest_ts > 0 && now_ms > newest_ts ? (now_ms - newest_ts) : 0;
@@ -1169,7 +1302,7 @@ std::vector<ArbitrageEngine::TransferBlockInfo> ArbitrageEngine::get_transfer_bl
 
 void ArbitrageEngine::export_to_json(const std::string& path) const {
     auto premiums = get_all_premiums();
-    write_premiums_json_file(path, running_.load(), premiums);
+    write_premiums_json_file(path, running_.load(), premiums, capital_tracker_.stats().summary());
 }
 
 // Async JSON Export Implementation
@@ -1178,8 +1311,9 @@ void ArbitrageEngine::export_to_json_async(const std::string& path) {
     // after ArbitrageEngine lifetime ends.
     auto premiums = get_all_premiums();
     const bool connected = running_.load();
-    std::thread([path, connected, premiums = std::move(premiums)]() mutable {
-        write_premiums_json_file(path, connected, premiums);
+    const auto perf = capital_tracker_.stats().summary();
+    std::thread([path, connected, premiums = std::move(premiums), perf]() mutable {
+        write_premiums_json_file(path, connected, premiums, perf);
     }).detach();
 }
 
@@ -1192,10 +1326,10 @@ void ArbitrageEngine::start_async_exporter(const std::string& path, std::chrono:
     export_interval_ = interval;
 
     exporter_thread_ = std::thread([this]() {
-        // Exporter thread: lower priority (execution_core) since it's not latency-critical
+        // Exporter thread: its own spare core, off the latency-critical ones
         auto thread_config = opt::ThreadConfig::optimal();
-        if (thread_config.execution_core >= 0) {
-            opt::pin_to_core(thread_config.execution_core);
+        if (thread_config.export_core >= 0) {
+            opt::pin_to_core(thread_config.export_core);
         }
         // Note: Not setting RT priority for exporter (it's I/O bound, not latency-critical)
 
@@ -0,0 +1,133 @@
+#include "kimp/strategy/listing_watcher.hpp"
+
+#include "kimp/core/logger.hpp"
+
+#include <algorithm>
+
+namespace kimp::strategy {
+
+void ListingWatcher::add_venue(Exchange ex, MarketFetcher fetch) {
+    if (Venue* venue = find_venue(ex)) {
+        venue->fetch = std::move(fetch);
+        return;
+    }
+    Venue venue;
+    venue.exchange = ex;
+    venue.fetch = std::move(fetch);
+    venues_.push_back(std::move(venue));
+}
+
+void ListingWatcher::seed(Exchange ex, const std::vector<SymbolId>& markets) {
+    Venue* venue = find_venue(ex);
+    if (venue == nullptr) {
+        add_venue(ex, nullptr);
+        venue = find_venue(ex);
+    }
+    for (const auto& market : markets) {
+        venue->bases.emplace(market.get_base());
+    }
+    venue->seeded = venue->seeded || !markets.empty();
+
+    std::vector<Exchange> korean;
+    std::vector<Exchange> foreign;
+    for (const auto& base : venue->bases) {
+        carriers(base, korean, foreign);
+        if (!korean.empty() && !foreign.empty()) {
+            monitored_.insert(base);
+        }
+    }
+}
+
+std::vector<NewListing> ListingWatcher::poll() {
+    // base -> venues that carry it for the first time
+    std::map<std::string, std::vector<Exchange>> appeared = std::move(retries_);
+    retries_.clear();
+    for (auto& venue : venues_) {
+        if (!venue.fetch) {
+            continue;
+        }
+        const auto markets = venue.fetch();
+        if (markets.empty()) {
+            Logger::debug("[Listing] {} market list unavailable, keeping the last one",
+                          exchange_name(venue.exchange));
+            continue;
+        }
+        const bool baseline = !venue.seeded;
+        for (const auto& market : markets) {
+            std::string base(market.get_base());
+            if (venue.bases.insert(base).second && !baseline) {
+                appeared[base].push_back(venue.exchange);
+            }
+        }
+        venue.seeded = true;
+    }
+
+    std::vector<NewListing> listings;
+    for (const auto& [base, venues] : appeared) {
+        NewListing listing;
+        listing.symbol = SymbolId(base, "KRW");
+        carriers(base, listing.korean_venues, listing.foreign_venues);
+        if (listing.korean_venues.empty() || listing.foreign_venues.empty()) {
+            continue;  // One side only: reported when the other side lists it
+        }
+        if (monitored_.insert(base).second) {
+            listing.new_symbol = true;
+        } else {
+            auto keep_new = [&venues](std::vector<Exchange>& list) {
+                list.erase(std::remove_if(list.begin(), list.end(), [&venues](Exchange ex) {
+                    return std::find(venues.begin(), venues.end(), ex) == venues.end();
+                }), list.end());
+            };
+            keep_new(listing.korean_venues);
+            keep_new(listing.foreign_venues);
+        }
+        listings.push_back(std::move(listing));
+    }
+    return listings;
+}
+
+void ListingWatcher::retry(const NewListing& listing) {
+    const std::string base(listing.symbol.get_base());
+    if (listing.new_symbol) {
+        monitored_.erase(base);
+    }
+    auto& venues = retries_[base];
+    venues.insert(venues.end(), listing.korean_venues.begin(), listing.korean_venues.end());
+    venues.insert(venues.end(), listing.foreign_venues.begin(), listing.foreign_venues.end());
+}
+
+std::size_t ListingWatcher::venue_market_count(Exchange ex) const {
+    const Venue* venue = find_venue(ex);
+    return venue ? venue->bases.size() : 0;
+}
+
+ListingWatcher::Venue* ListingWatcher::find_venue(Exchange ex) {
+    for (auto& venue : venues_) {
+        if (venue.exchange == ex) {
+            return &venue;
+        }
+    }
+    return nullptr;
+}
+
+const ListingWatcher::Venue* ListingWatcher::find_venue(Exchange ex) const {
+    for (const auto& venue : venues_) {
+        if (venue.exchange == ex) {
+            return &venue;
+        }
+    }
+    return nullptr;
+}
+
+void ListingWatcher::carriers(const std::string& base, std::vector<Exchange>& korean,
+                              std::vector<Exchange>& foreign) const {
+    korean.clear();
+    foreign.clear();
+    for (const auto& venue : venues_) {
+        if (carries(venue, base)) {
+            (is_korean_exchange(venue.exchange) ? korean : foreign).push_back(venue.exchange);
+        }
+    }
+}
+
+} // namespace kimp::strategy
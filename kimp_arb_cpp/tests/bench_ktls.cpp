@@ -0,0 +1,140 @@
+#include "kimp/network/ktls.hpp"
+#include "kimp/network/tls_stream.hpp"
+#include "test_tls_loopback_common.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Client-side CPU cost per message over a loopback TLS 1.3 connection,
+// user-space OpenSSL vs kernel TLS. Only the client thread's CPU time is
+// counted (CLOCK_THREAD_CPUTIME_ID), so the local server's crypto and the
+// kernel's work on behalf of the server side do not pollute the numbers.
+// With kTLS the record crypto runs in the client's syscalls and is
+// therefore included.
+
+namespace {
+
+constexpr uint32_t MESSAGES = 20000;
+constexpr std::size_t MESSAGE_SIZE = 512;  // Typical depth/ticker frame
+
+int64_t thread_cpu_ns() {
+    timespec ts{};
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+// Command: 'R' n -> server streams n messages; 'W' n -> server sinks n then acks
+void bench_session(SSL* ssl) {
+    std::vector<char> message(MESSAGE_SIZE, 'm');
+    for (;;) {
+        char cmd = 0;
+        uint32_t count = 0;
+        if (!tls_loopback::read_exact(ssl, &cmd, 1) || !tls_loopback::read_exact(ssl, &count, sizeof(count))) {
+            return;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            const bool ok = cmd == 'R' ? tls_loopback::write_all(ssl, message.data(), message.size())
+                                       : tls_loopback::read_exact(ssl, message.data(), message.size());
+            if (!ok) return;
+        }
+        if (cmd == 'W' && !tls_loopback::write_all(ssl, "k", 1)) return;
+    }
+}
+
+struct Result {
+    const char* status{""};
+    double read_ns{0.0};
+    double write_ns{0.0};
+};
+
+void send_command(kimp::network::TlsStream& stream, char cmd, uint32_t count) {
+    char header[1 + sizeof(count)];
+    header[0] = cmd;
+    std::memcpy(header + 1, &count, sizeof(count));
+    boost::asio::write(stream, boost::asio::buffer(header, sizeof(header)));
+}
+
+Result run(bool request_ktls) {
+    kimp::network::ktls::set_enabled(request_ktls);
+    tls_loopback::Server server(tls_loopback::make_server_context("TLS_AES_128_GCM_SHA256"), bench_session);
+
+    boost::asio::io_context ioc;
+    boost::asio::ssl::context ctx(boost::asio::ssl::context::tls_client);
+    ctx.set_verify_mode(boost::asio::ssl::verify_none);
+    if (request_ktls) {
+        kimp::network::ktls::prepare(ctx.native_handle());
+    }
+    kimp::network::TlsStream stream(ioc, ctx);
+    stream.tcp().connect({boost::asio::ip::make_address("127.0.0.1"), server.port()});
+    stream.tcp().socket().set_option(boost::asio::ip::tcp::no_delay(true));
+    stream.handshake(boost::asio::ssl::stream_base::client);
+
+    Result r;
+    const auto status = stream.try_ktls_offload();
+    r.status = !request_ktls ? "user-space TLS" : status.offloaded() ? "kTLS" : status.reason;
+
+    std::vector<char> message(MESSAGE_SIZE);
+
+    // Inbound: one read per message, as a market-data feed would
+    send_command(stream, 'R', MESSAGES);
+    int64_t start = thread_cpu_ns();
+    for (uint32_t i = 0; i < MESSAGES; ++i) {
+        boost::asio::read(stream, boost::asio::buffer(message));
+    }
+    r.read_ns = static_cast<double>(thread_cpu_ns() - start) / MESSAGES;
+
+    // Outbound: one write per message, as order requests are sent
+    send_command(stream, 'W', MESSAGES);
+    start = thread_cpu_ns();
+    for (uint32_t i = 0; i < MESSAGES; ++i) {
+        boost::asio::write(stream, boost::asio::buffer(message));
+    }
+    r.write_ns = static_cast<double>(thread_cpu_ns() - start) / MESSAGES;
+    char ack = 0;
+    boost::asio::read(stream, boost::asio::buffer(&ack, 1));
+
+    boost::beast::error_code ec;
+    stream.shutdown(ec);
+    stream.tcp().close();
+    kimp::network::ktls::set_enabled(false);
+    return r;
+}
+
+void print(const char* label, const Result& r) {
+    std::cout << std::left << std::setw(18) << label
+              << std::setw(16) << std::fixed << std::setprecision(0) << r.read_ns
+              << std::setw(16) << r.write_ns
+              << r.status << '\n';
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Client CPU per " << MESSAGE_SIZE << "B message over loopback TLS 1.3 ("
+              << MESSAGES << " messages each way, AES-128-GCM)\n";
+    if (!kimp::network::ktls::kernel_available()) {
+        std::cout << "note: tls ULP not loaded (modprobe tls) — the kTLS row measures the fallback\n";
+    }
+    if (std::thread::hardware_concurrency() < 2) {
+        std::cout << "note: single CPU — server and client share the core\n";
+    }
+    std::cout << std::left << std::setw(18) << "mode"
+              << std::setw(16) << "read_cpu_ns"
+              << std::setw(16) << "write_cpu_ns"
+              << "session\n";
+
+    print("ktls off", run(false));
+    print("ktls requested", run(true));
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include "kimp/core/optimization.hpp"
+#include "kimp/memory/ring_buffer.hpp"
+#include "kimp/network/market_data_shm.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// One-way ticker delivery latency: producer stamps Ticker::timestamp
+// (steady clock, valid across processes), consumer measures on receipt.
+// Messages are paced so this is latency, not queueing under load.
+
+namespace {
+
+constexpr std::size_t SAMPLES = 100000;
+constexpr auto PACE = std::chrono::microseconds(3);
+
+int64_t steady_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t lag_ns(const kimp::Ticker& t) {
+    return steady_ns() - std::chrono::duration_cast<std::chrono::nanoseconds>(
+        t.timestamp.time_since_epoch()).count();
+}
+
+void pace() {
+    const auto until = std::chrono::steady_clock::now() + PACE;
+    while (std::chrono::steady_clock::now() < until) {
+        kimp::opt::cpu_pause();
+    }
+}
+
+kimp::Ticker make_ticker(uint64_t seq) {
+    kimp::Ticker t;
+    t.exchange = kimp::Exchange::Bybit;
+    t.symbol = kimp::SymbolId("BTC", "USDT");
+    t.sequence = seq;
+    t.bid = 65000.0;
+    t.ask = 65000.5;
+    t.timestamp = std::chrono::steady_clock::now();
+    return t;
+}
+
+struct Result {
+    double p50_ns{0.0};
+    double p99_ns{0.0};
+    double p999_ns{0.0};
+    std::size_t samples{0};
+};
+
+Result summarize(std::vector<int64_t>& lags) {
+    Result r;
+    r.samples = lags.size();
+    if (lags.empty()) return r;
+    std::sort(lags.begin(), lags.end());
+    auto at = [&](double q) { return static_cast<double>(lags[static_cast<std::size_t>(q * (lags.size() - 1))]); };
+    r.p50_ns = at(0.50);
+    r.p99_ns = at(0.99);
+    r.p999_ns = at(0.999);
+    return r;
+}
+
+Result bench_direct_callback() {
+    std::vector<int64_t> lags;
+    lags.reserve(SAMPLES);
+    std::function<void(const kimp::Ticker&)> on_ticker = [&](const kimp::Ticker& t) {
+        lags.push_back(lag_ns(t));
+    };
+    for (std::size_t i = 0; i < SAMPLES; ++i) {
+        on_ticker(make_ticker(i));
+        pace();
+    }
+    return summarize(lags);
+}
+
+Result bench_cross_thread() {
+    auto ring = std::make_unique<kimp::memory::SPSCRingBuffer<kimp::Ticker, 4096>>();
+    std::vector<int64_t> lags;
+    lags.reserve(SAMPLES);
+    std::thread consumer([&] {
+        kimp::Ticker t;
+        while (lags.size() < SAMPLES) {
+            if (ring->try_pop_into(t)) {
+                lags.push_back(lag_ns(t));
+            } else {
+                kimp::opt::cpu_pause();
+            }
+        }
+    });
+    for (std::size_t i = 0; i < SAMPLES; ++i) {
+        while (!ring->try_push(make_ticker(i))) kimp::opt::cpu_pause();
+        pace();
+    }
+    consumer.join();
+    return summarize(lags);
+}
+
+Result bench_shm_process() {
+    const std::string name = "/kimp_bench_md_" + std::to_string(::getpid());
+    auto publisher = kimp::network::MarketDataPublisher::create(name, 1 << 14);
+    if (!publisher) return {};
+
+    int ready[2];
+    int results[2];
+    if (::pipe(ready) != 0 || ::pipe(results) != 0) return {};
+
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        auto subscriber = kimp::network::MarketDataSubscriber::attach(name);
+        if (!subscriber) ::_exit(1);
+        std::vector<int64_t> lags;
+        lags.reserve(SAMPLES);
+        subscriber->set_ticker_callback([&](const kimp::Ticker& t) { lags.push_back(lag_ns(t)); });
+        const char byte = 1;
+        if (::write(ready[1], &byte, 1) != 1) ::_exit(1);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (lags.size() < SAMPLES && std::chrono::steady_clock::now() < deadline) {
+            if (subscriber->poll() == 0) kimp::opt::cpu_pause();
+        }
+        Result r = summarize(lags);
+        r.samples = lags.size();
+        if (::write(results[1], &r, sizeof(r)) != static_cast<ssize_t>(sizeof(r))) ::_exit(1);
+        ::_exit(0);
+    }
+
+    char byte = 0;
+    if (::read(ready[0], &byte, 1) != 1) return {};
+    for (std::size_t i = 0; i < SAMPLES; ++i) {
+        publisher->publish(make_ticker(i));
+        pace();
+    }
+    Result r;
+    if (::read(results[0], &r, sizeof(r)) != static_cast<ssize_t>(sizeof(r))) r = {};
+    ::waitpid(pid, nullptr, 0);
+    for (int fd : {ready[0], ready[1], results[0], results[1]}) ::close(fd);
+    return r;
+}
+
+void print(const char* label, const Result& r) {
+    std::cout << std::left << std::setw(28) << label
+              << std::setw(10) << r.samples
+              << std::setw(12) << std::fixed << std::setprecision(0) << r.p50_ns
+              << std::setw(12) << r.p99_ns
+              << r.p999_ns << '\n';
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Ticker delivery latency (" << SAMPLES << " paced samples, "
+              << PACE.count() << "us apart, " << sizeof(kimp::network::MarketDataMessage)
+              << "B shm message)\n";
+    if (std::thread::hardware_concurrency() < 2) {
+        std::cout << "note: single CPU — cross-thread/process numbers measure scheduler time slices\n";
+    }
+    std::cout << std::left << std::setw(28) << "path"
+              << std::setw(10) << "samples"
+              << std::setw(12) << "p50_ns"
+              << std::setw(12) << "p99_ns"
+              << "p99.9_ns\n";
+
+    print("in-process callback", bench_direct_callback());
+    print("cross-thread SPSC ring", bench_cross_thread());
+    print("shm ring -> other process", bench_shm_process());
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "kimp/network/websocket_client.hpp"
+#include "test_ws_deflate_common.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// permessage-deflate trade-off per venue: a local wss server replays frames
+// (recorded ones from a file, one per line, or synthetic orderbook deltas)
+// to WebSocketClient at a paced rate. Reports bytes on the wire per message,
+// client CPU per message (TLS + framing + inflate + copy; the deflate rows
+// minus the "off" row is the inflate cost) and send-to-callback delay.
+//
+// The replay server is Beast, which ends every compressed message with a
+// full flush and so never references earlier messages: the takeover rows
+// show the inflate-state cost, not the extra ratio a venue using sync flush
+// would give.
+//
+//   kimp_bench_ws_deflate [frames.txt]
+
+namespace {
+
+constexpr std::size_t DEFAULT_FRAMES = 5000;
+constexpr auto PACE = std::chrono::microseconds(200);
+
+int64_t thread_cpu_ns() {
+    timespec ts{};
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+struct Result {
+    bool negotiated{false};
+    std::size_t received{0};
+    double payload_per_msg{0.0};
+    double wire_per_msg{0.0};
+    double cpu_ns_per_msg{0.0};
+    double delay_p50_us{0.0};
+    double delay_p99_us{0.0};
+};
+
+Result run(const std::vector<std::string>& frames, const kimp::network::DeflateOptions& options) {
+    const std::string cert = "/tmp/kimp_bench_ws_deflate_" + std::to_string(::getpid()) + ".pem";
+    ws_replay::Server server(cert, true, frames, PACE);
+    ::setenv("SSL_CERT_FILE", cert.c_str(), 1);
+
+    Result r;
+    std::vector<int64_t> delays;
+    delays.reserve(frames.size());
+    int64_t cpu_start = 0;
+
+    boost::asio::io_context ioc;
+    auto client = std::make_shared<kimp::network::WebSocketClient>(ioc, "deflate-bench");
+    client->set_deflate(options);
+    client->set_connect_callback([&](bool, const std::string&) { cpu_start = thread_cpu_ns(); });
+    client->set_message_callback([&](std::string_view message, kimp::network::MessageType) {
+        const std::size_t index = delays.size();
+        delays.push_back(ws_replay::steady_ns() - server.sent_ns(index));
+        volatile char sink = message.empty() ? 0 : message.back();  // Touch the inflated payload
+        (void)sink;
+        if (delays.size() == frames.size()) {
+            r.cpu_ns_per_msg = static_cast<double>(thread_cpu_ns() - cpu_start) / static_cast<double>(frames.size());
+            r.negotiated = client->deflate_negotiated();
+            client->disconnect();
+        }
+    });
+    client->connect(server.url());
+    ioc.run_for(std::chrono::seconds(120));
+    client->disconnect();
+    server.join();
+    std::remove(cert.c_str());
+
+    r.received = delays.size();
+    const auto& wire = server.result();
+    if (!frames.empty()) {
+        r.payload_per_msg = static_cast<double>(wire.payload_bytes) / static_cast<double>(frames.size());
+        r.wire_per_msg = static_cast<double>(wire.wire_bytes) / static_cast<double>(frames.size());
+    }
+    if (!delays.empty()) {
+        std::sort(delays.begin(), delays.end());
+        r.delay_p50_us = static_cast<double>(delays[delays.size() / 2]) / 1000.0;
+        r.delay_p99_us = static_cast<double>(delays[(delays.size() - 1) * 99 / 100]) / 1000.0;
+    }
+    return r;
+}
+
+void print(const char* label, const Result& r) {
+    std::cout << std::left << std::setw(24) << label
+              << std::setw(11) << (r.negotiated ? "yes" : "no")
+              << std::setw(12) << std::fixed << std::setprecision(0) << r.payload_per_msg
+              << std::setw(10) << r.wire_per_msg
+              << std::setw(8) << std::setprecision(2) << (r.wire_per_msg > 0 ? r.payload_per_msg / r.wire_per_msg : 0.0)
+              << std::setw(12) << std::setprecision(0) << r.cpu_ns_per_msg
+              << std::setw(10) << std::setprecision(1) << r.delay_p50_us
+              << r.delay_p99_us << '\n';
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    spdlog::set_level(spdlog::level::warn);
+
+    std::vector<std::string> frames;
+    if (argc > 1) {
+        frames = ws_replay::load_frames(argv[1]);
+        if (frames.empty()) {
+            std::cerr << "no frames in " << argv[1] << "\n";
+            return 1;
+        }
+    } else {
+        frames = ws_replay::synthetic_frames(DEFAULT_FRAMES);
+    }
+
+    std::cout << "permessage-deflate over loopback wss (" << frames.size() << " "
+              << (argc > 1 ? "recorded" : "synthetic orderbook") << " frames, " << PACE.count()
+              << "us apart)\n";
+    if (std::thread::hardware_concurrency() < 2) {
+        std::cout << "note: single CPU — server and client share the core, delays include its time slices\n";
+    }
+    std::cout << std::left << std::setw(24) << "mode"
+              << std::setw(11) << "negotiated"
+              << std::setw(12) << "payload_B"
+              << std::setw(10) << "wire_B"
+              << std::setw(8) << "ratio"
+              << std::setw(12) << "cpu_ns/msg"
+              << std::setw(10) << "p50_us"
+              << "p99_us\n";
+
+    print("off", run(frames, {}));
+    print("deflate", run(frames, {true, true, 15}));
+    print("deflate no-takeover", run(frames, {true, false, 15}));
+    print("deflate window 10", run(frames, {true, true, 10}));
+    return 0;
+}
@@ -0,0 +1,320 @@
+#include "kimp/core/logger.hpp"
+#include "kimp/execution/account_pool.hpp"
+#include "kimp/execution/order_manager.hpp"
+#include "kimp/exchange/bithumb/bithumb.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+
+#include <boost/asio.hpp>
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+
+namespace {
+
+namespace net = boost::asio;
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+struct FillSpec {
+    double quantity{0.0};
+    double price{0.0};
+};
+
+Order filled(Exchange ex, const SymbolId& symbol, Side side, double quantity, const FillSpec& fill) {
+    Order order;
+    order.exchange = ex;
+    order.symbol = symbol;
+    order.side = side;
+    order.type = OrderType::Market;
+    order.status = OrderStatus::Filled;
+    order.quantity = quantity;
+    order.filled_quantity = fill.quantity;
+    order.average_price = fill.price;
+    return order;
+}
+
+// Stand-in accounts: a balance sheet and the orders each key received
+class AccountBybit final : public exchange::bybit::BybitExchange {
+public:
+    AccountBybit(net::io_context& ioc, double usdt, std::vector<FillSpec> covers = {})
+        : exchange::bybit::BybitExchange(ioc, {}), usdt_(usdt), covers_(std::move(covers)) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    Order place_market_order(const SymbolId&, Side, Quantity) override { return {}; }
+    bool cancel_order(uint64_t) override { return false; }
+    bool close_short_position(const SymbolId&) override { return true; }
+    Order open_short(const SymbolId&, Quantity) override { ++orders; return {}; }
+    double get_balance(const std::string& currency) override { return currency == "USDT" ? usdt_ : 0.0; }
+
+    bool prepare_shorting(const SymbolId&) override {
+        ++prepared;
+        return true;
+    }
+    std::vector<Position> get_short_positions() override { return shorts; }
+
+    Order close_short(const SymbolId& symbol, Quantity quantity) override {
+        ++orders;
+        if (next_ >= covers_.size()) {
+            return {};
+        }
+        return filled(Exchange::Bybit, symbol, Side::Buy, quantity, covers_[next_++]);
+    }
+
+    int orders{0};
+    int prepared{0};
+    std::vector<Position> shorts;
+
+private:
+    double usdt_;
+    std::vector<FillSpec> covers_;
+    std::size_t next_{0};
+};
+
+class AccountBithumb final : public exchange::bithumb::BithumbExchange {
+public:
+    AccountBithumb(net::io_context& ioc, double krw, std::vector<FillSpec> sells = {})
+        : exchange::bithumb::BithumbExchange(ioc, {}), sells_(std::move(sells)) {
+        balances["KRW"] = krw;
+    }
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    double get_usdt_krw_price() override { return 1300.0; }
+    bool cancel_order(uint64_t) override { return false; }
+    Order place_market_buy_cost(const SymbolId&, Price) override { ++orders; return {}; }
+
+    double get_balance(const std::string& currency) override {
+        auto it = balances.find(currency);
+        return it != balances.end() ? it->second : 0.0;
+    }
+
+    Order place_market_order(const SymbolId& symbol, Side side, Quantity quantity) override {
+        ++orders;
+        if (side != Side::Sell || next_ >= sells_.size()) {
+            return {};
+        }
+        return filled(Exchange::Bithumb, symbol, side, quantity, sells_[next_++]);
+    }
+
+    int orders{0};
+    std::map<std::string, double> balances;
+
+private:
+    std::vector<FillSpec> sells_;
+    std::size_t next_{0};
+};
+
+void test_assignment() {
+    net::io_context ioc;
+    auto main_account = std::make_shared<AccountBithumb>(ioc, 1'000'000.0);
+    auto second = std::make_shared<AccountBithumb>(ioc, 5'000'000.0);
+    auto third = std::make_shared<AccountBithumb>(ioc, 3'000'000.0);
+
+    AccountPool pool;
+    expect(pool.add(Exchange::Bithumb, second) == -1, "no extra account before the main one");
+    pool.set_primary(Exchange::Bithumb, main_account);
+    expect(pool.add(Exchange::Bithumb, second) == 1 && pool.add(Exchange::Bithumb, third) == 2,
+           "extra accounts numbered after the main one");
+    expect(pool.count(Exchange::Bithumb) == 3 && pool.count(Exchange::Bybit) == 0, "accounts per venue");
+    expect(pool.exchange(Exchange::Bithumb, 2) == third && pool.exchange(Exchange::Bithumb, 3) == nullptr,
+           "connector per account");
+
+    // Nothing known yet: lifecycles spread by what is already reserved
+    expect(pool.assign(Exchange::Bithumb, 100'000.0) == 0, "unknown balances: first account");
+    expect(pool.assign(Exchange::Bithumb, 100'000.0) == 1, "unknown balances: least reserved next");
+    pool.release(Exchange::Bithumb, 0, 100'000.0);
+    pool.release(Exchange::Bithumb, 1, 100'000.0);
+
+    pool.refresh_balances();
+    expect(pool.assign(Exchange::Bithumb, 2'500'000.0) == 1, "most free balance wins");
+    expect(pool.assign(Exchange::Bithumb, 1'000'000.0) == 2, "reservation moves the next lifecycle");
+    expect(pool.assign(Exchange::Bithumb, 1'000'000.0) == 1, "free balance net of reservations");
+
+    auto stats = pool.stats(Exchange::Bithumb);
+    expect(stats.size() == 3 && stats[1].lifecycles == 2 && stats[2].lifecycles == 1 &&
+           stats[1].reserved == 3'500'000.0, "open lifecycles and reservations tracked");
+    pool.release(Exchange::Bithumb, 1, 2'500'000.0);
+    pool.release(Exchange::Bithumb, 1, 1'000'000.0);
+    pool.release(Exchange::Bithumb, 2, 1'000'000.0);
+    stats = pool.stats(Exchange::Bithumb);
+    expect(stats[1].reserved == 0.0 && stats[1].lifecycles == 0 && stats[2].lifecycles == 0,
+           "released when lifecycles end");
+
+    // A venue with a single account never needs a choice
+    AccountPool single;
+    single.set_primary(Exchange::Bybit, std::make_shared<AccountBybit>(ioc, 10.0));
+    expect(single.assign(Exchange::Bybit, 1e9) == 0, "single account always chosen");
+}
+
+void test_order_budget() {
+    net::io_context ioc;
+    AccountPool pool;
+    AccountPool::Options slow;
+    slow.order_rate_per_sec = 0.001;  // Practically no refill within the test
+    slow.order_burst = 2.0;
+    pool.set_primary(Exchange::Bybit, std::make_shared<AccountBybit>(ioc, 9'000.0), slow);
+    pool.add(Exchange::Bybit, std::make_shared<AccountBybit>(ioc, 1'000.0), slow);
+    pool.refresh_balances();
+
+    expect(pool.consume_order(Exchange::Bybit, 0) && pool.consume_order(Exchange::Bybit, 0),
+           "orders within the burst");
+    expect(!pool.consume_order(Exchange::Bybit, 0), "past the budget");
+    expect(pool.assign(Exchange::Bybit, 100.0) == 1, "throttled account skipped despite its balance");
+    pool.consume_order(Exchange::Bybit, 1);
+    pool.consume_order(Exchange::Bybit, 1);
+    const auto stats = pool.stats(Exchange::Bybit);
+    expect(stats[0].orders == 3 && stats[1].orders == 2 && stats[0].order_budget < 1.0,
+           "orders and budget per account");
+    expect(pool.assign(Exchange::Bybit, 100.0) <= 1, "all throttled still assigns");
+}
+
+// Exit legs and per-split snapshots follow the position's account tags
+void test_exit_routing() {
+    net::io_context ioc;
+    auto bithumb_main = std::make_shared<AccountBithumb>(ioc, 1'000'000.0);
+    auto bithumb_second = std::make_shared<AccountBithumb>(
+        ioc, 9'000'000.0, std::vector<FillSpec>{{7.0, 13100.0}, {3.0, 12900.0}});
+    auto bybit_main = std::make_shared<AccountBybit>(
+        ioc, 5'000.0, std::vector<FillSpec>{{7.0, 9.5}, {3.0, 9.8}});
+    auto bybit_second = std::make_shared<AccountBybit>(ioc, 100.0);
+
+    OrderManager manager;
+    manager.set_exchange(Exchange::Bithumb, bithumb_main);
+    manager.set_exchange(Exchange::Bybit, bybit_main);
+    expect(manager.add_account(Exchange::Bithumb, bithumb_second) == 1, "Bithumb account #1");
+    expect(manager.add_account(Exchange::Bybit, bybit_second) == 1, "Bybit account #1");
+
+    std::vector<Position> snapshots;
+    manager.set_position_update_callback([&](const Position* pos) {
+        if (pos) {
+            snapshots.push_back(*pos);
+        }
+    });
+
+    Position position;
+    position.symbol = SymbolId("BTC", "KRW");
+    position.korean_exchange = Exchange::Bithumb;
+    position.foreign_exchange = Exchange::Bybit;
+    position.korean_amount = 10.0;
+    position.foreign_amount = 10.0;
+    position.korean_entry_price = 10000.0;
+    position.foreign_entry_price = 10.0;
+    position.position_size_usd = 100.0;
+    position.korean_account = 1;
+    position.foreign_account = 0;
+    position.is_active = true;
+
+    ExitSignal signal;
+    signal.symbol = position.symbol;
+    signal.korean_exchange = position.korean_exchange;
+    signal.foreign_exchange = position.foreign_exchange;
+    signal.premium = 0.77;
+    signal.korean_bid = 13100.0;
+    signal.foreign_ask = 10.0;
+    signal.usdt_krw_rate = 1300.0;
+
+    const auto result = manager.execute_spot_relay_exit(signal, position);
+    expect(result.success && !result.position.is_active, "exit completes on the tagged accounts");
+    expect(bithumb_second->orders == 2 && bithumb_main->orders == 0, "Korean sells on account #1 only");
+    expect(bybit_main->orders == 2 && bybit_second->orders == 0, "covers on account #0 only");
+    expect(!snapshots.empty(), "partial exit persisted");
+    for (const auto& snap : snapshots) {
+        expect(snap.korean_account == 1 && snap.foreign_account == 0, "snapshots carry the account tags");
+    }
+
+    // A recovered position on an account that is no longer configured is not traded
+    ArbitrageSignal entry;
+    entry.symbol = position.symbol;
+    entry.korean_exchange = Exchange::Bithumb;
+    entry.foreign_exchange = Exchange::Bybit;
+    entry.usdt_krw_rate = 1300.0;
+    Position stray = position;
+    stray.korean_account = 4;
+    const auto refused = manager.execute_spot_relay_entry(entry, stray);
+    expect(!refused.success && refused.error_message.find("unconfigured account") != std::string::npos,
+           "unknown account refused");
+    expect(bithumb_main->orders == 0 && bybit_main->orders == 2, "no order for the refused position");
+    const auto stats = manager.accounts().stats(Exchange::Bithumb);
+    expect(stats[0].lifecycles == 0 && stats[1].lifecycles == 0, "refused lifecycle holds no account");
+}
+
+// Margin setup and the external-position check cover every account
+void test_every_account_checked() {
+    net::io_context ioc;
+    auto bithumb_main = std::make_shared<AccountBithumb>(ioc, 0.0);
+    auto bithumb_second = std::make_shared<AccountBithumb>(ioc, 0.0);
+    bithumb_second->balances["XRP"] = 50.0;
+    auto bybit_main = std::make_shared<AccountBybit>(ioc, 0.0);
+    auto bybit_second = std::make_shared<AccountBybit>(ioc, 0.0);
+    Position liability;
+    liability.symbol = SymbolId("DOGE", "USDT");
+    liability.foreign_amount = 100.0;
+    bybit_second->shorts.push_back(liability);
+
+    OrderManager manager;
+    manager.set_exchange(Exchange::Bithumb, bithumb_main);
+    manager.set_exchange(Exchange::Bybit, bybit_main);
+    manager.add_account(Exchange::Bithumb, bithumb_second);
+    manager.add_account(Exchange::Bybit, bybit_second);
+
+    const std::vector<SymbolId> symbols{SymbolId("BTC", "KRW"), SymbolId("XRP", "KRW"), SymbolId("DOGE", "KRW")};
+    expect(manager.prepare_bybit_shorting(symbols), "shorting prepared");
+    expect(bybit_main->prepared == 3 && bybit_second->prepared == 3, "every Bybit account prepared");
+
+    manager.refresh_external_positions(symbols);
+    expect(!manager.is_safe_to_trade(SymbolId("XRP", "KRW"), Exchange::Bithumb, Exchange::Bybit),
+           "holding on account #1 blocks the coin");
+    expect(!manager.is_safe_to_trade(SymbolId("DOGE", "KRW"), Exchange::Bithumb, Exchange::Bybit),
+           "liability on account #1 blocks the coin");
+
+    OrderManager tidy;
+    tidy.set_exchange(Exchange::Bithumb, bithumb_main);
+    tidy.set_exchange(Exchange::Bybit, bybit_main);
+    tidy.refresh_external_positions(symbols);
+    expect(tidy.is_safe_to_trade(SymbolId("XRP", "KRW"), Exchange::Bithumb, Exchange::Bybit),
+           "main accounts alone see nothing");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Account Sharding Regression Test ===\n";
+    Logger::init("test_account_sharding", "warn");
+
+    test_assignment();
+    test_order_budget();
+    test_exit_routing();
+    test_every_account_checked();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: account assignment by balance and budget, tagged exits, all-account checks ***\n";
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include "kimp/core/logger.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/strategy/borrow_cost.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+using namespace kimp;
+using namespace kimp::strategy;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+bool near(double a, double b, double tol = 1e-9) { return std::fabs(a - b) <= tol; }
+
+constexpr double RATE = 0.00001;  // 0.001% per hour
+
+SystemTimestamp at_hours(double hours) {
+    return SystemTimestamp(std::chrono::duration_cast<SystemTimestamp::duration>(
+        std::chrono::duration<double, std::ratio<3600>>(1000.0 + hours)));
+}
+
+Position open_short(double coins, SystemTimestamp entry) {
+    Position pos;
+    pos.symbol = SymbolId("BTC", "KRW");
+    pos.korean_exchange = Exchange::Bithumb;
+    pos.foreign_exchange = Exchange::Bybit;
+    pos.entry_time = entry;
+    pos.korean_amount = coins;
+    pos.foreign_amount = coins;
+    pos.is_active = true;
+    return pos;
+}
+
+void test_interest_math() {
+    expect(near(BorrowCostModel::hours_between(at_hours(0.0), at_hours(2.5)), 2.5, 1e-6), "hours between timestamps");
+    expect(BorrowCostModel::hours_between(at_hours(3.0), at_hours(1.0)) == 0.0, "no negative holding time");
+    expect(near(BorrowCostModel::interest_coins(2.0, RATE, 10.0), 2.0 * RATE * 10.0), "coins x rate x hours");
+    expect(BorrowCostModel::interest_coins(2.0, 0.0, 10.0) == 0.0, "no rate, no interest");
+    expect(BorrowCostModel::interest_coins(0.0, RATE, 10.0) == 0.0, "no short, no interest");
+}
+
+void test_accrual_on_position() {
+    Position pos = open_short(2.0, at_hours(0.0));
+    expect(BorrowCostModel::accrued_since(pos) == at_hours(0.0), "unsettled position accrues from entry");
+
+    // Before the first settlement interest runs from entry
+    expect(near(BorrowCostModel::accrued_pct(pos, RATE, at_hours(24.0)), RATE * 24.0 * 100.0),
+           "pending interest from entry, pct of the short");
+
+    // Settled at 10h (as the lifecycle loop does): the total is unchanged
+    pos.borrow_interest_coins = BorrowCostModel::interest_coins(pos.foreign_amount, RATE, 10.0);
+    pos.borrow_accrued_at = at_hours(10.0);
+    expect(BorrowCostModel::accrued_since(pos) == at_hours(10.0), "accrual resumes at the settlement");
+    expect(near(BorrowCostModel::accrued_pct(pos, RATE, at_hours(24.0)), RATE * 24.0 * 100.0),
+           "settled plus pending equals uninterrupted accrual");
+
+    // A new rate only applies past the settlement point
+    expect(near(BorrowCostModel::accrued_pct(pos, RATE * 3.0, at_hours(20.0)),
+                (RATE * 10.0 + RATE * 3.0 * 10.0) * 100.0),
+           "piecewise rates");
+
+    // Interest is a share of the short: proportional cover keeps the pct
+    const double pct_before = BorrowCostModel::accrued_pct(pos, 0.0, at_hours(20.0));
+    pos.borrow_interest_coins *= 0.25;
+    pos.foreign_amount *= 0.25;
+    expect(near(BorrowCostModel::accrued_pct(pos, 0.0, at_hours(20.0)), pct_before), "pct stable across partial cover");
+
+    pos.foreign_amount = 0.0;
+    expect(BorrowCostModel::accrued_pct(pos, RATE, at_hours(30.0)) == 0.0, "flat position carries no cost");
+}
+
+void test_exit_threshold() {
+    const double entry_pm = 0.10;  // entry + fees clears the floor
+    const double fee_only = std::max(entry_pm + TradingConfig::DYNAMIC_EXIT_SPREAD,
+                                     TradingConfig::EXIT_PREMIUM_THRESHOLD);
+    expect(near(TradingConfig::dynamic_exit_threshold(entry_pm), fee_only), "no borrow: fee-only threshold");
+
+    // 0.001%/h for three days adds 0.072 premium points
+    Position pos = open_short(1.0, at_hours(0.0));
+    const double borrow_pct = BorrowCostModel::accrued_pct(pos, RATE, at_hours(72.0));
+    expect(near(borrow_pct, 0.072), "three days of interest in premium points");
+    const double threshold = TradingConfig::dynamic_exit_threshold(entry_pm, borrow_pct);
+    expect(near(threshold, entry_pm + TradingConfig::DYNAMIC_EXIT_SPREAD + 0.072), "interest raises the exit bar");
+
+    // Below the floor the floor still decides
+    expect(near(TradingConfig::dynamic_exit_threshold(-2.0, 0.05), TradingConfig::EXIT_PREMIUM_THRESHOLD),
+           "floor kept when entry + fees + interest is below it");
+    expect(TradingConfig::dynamic_exit_threshold(0.5, 0.1) > TradingConfig::dynamic_exit_threshold(0.5),
+           "interest raises a threshold above the floor");
+}
+
+void test_entry_edge() {
+    const double usdt_krw = 1400.0;
+    auto base = PremiumCalculator::calculate_relay_metrics(
+        100'000.0, 1.0, 72.0, 1.0, usdt_krw,
+        TradingConfig::BITHUMB_FEE_RATE, TradingConfig::BYBIT_FEE_RATE);
+    auto charged = base;
+    PremiumCalculator::apply_borrow_cost(charged, 0.0);
+    expect(charged.net_edge_pct == base.net_edge_pct && charged.borrow_cost_krw == 0.0, "zero hold cost is a no-op");
+
+    const double hold_cost_rate = RATE * 24.0;
+    PremiumCalculator::apply_borrow_cost(charged, hold_cost_rate);
+    const double borrow_krw = base.match_sell_krw * hold_cost_rate;
+    expect(near(charged.borrow_cost_krw, borrow_krw), "interest priced on the short notional");
+    expect(near(charged.total_fee_krw, base.total_fee_krw + borrow_krw), "interest counted as a fee");
+    expect(near(charged.net_profit_krw, base.net_profit_krw - borrow_krw), "net profit reduced by the interest");
+    expect(near(charged.net_edge_pct,
+                charged.net_profit_krw / (base.match_buy_krw + charged.total_fee_krw) * 100.0),
+           "net edge recomputed on the larger basis");
+    expect(charged.net_edge_pct < base.net_edge_pct, "holding cost lowers the entry edge");
+}
+
+void test_rate_table() {
+    BorrowCostModel model(4);
+    model.set_rate(Exchange::Bybit, 1, RATE);
+    model.set_rate(Exchange::OKX, 1, RATE * 2.0);
+    model.set_rate(Exchange::Bybit, 9, RATE);  // Out of range: ignored
+    model.set_rate(Exchange::Bybit, 2, -RATE);
+    expect(near(model.hourly_rate(Exchange::Bybit, 1), RATE), "per venue rate");
+    expect(near(model.hourly_rate(Exchange::OKX, 1), RATE * 2.0), "venues kept apart");
+    expect(model.hourly_rate(Exchange::Bybit, 0) == 0.0, "unpublished symbol costs nothing");
+    expect(model.hourly_rate(Exchange::Bybit, 9) == 0.0, "out of range reads zero");
+    expect(model.hourly_rate(Exchange::Bybit, 2) == 0.0, "negative rates clamp to zero");
+
+    model.set_expected_hold_hours(12.0);
+    expect(near(model.hold_cost_rate(Exchange::OKX, 1), RATE * 2.0 * 12.0), "hold cost over the expected hold");
+}
+
+void test_engine_rates() {
+    ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Bithumb, Exchange::Bybit);
+    engine.add_symbol(SymbolId("BTC", "KRW"));
+    engine.add_symbol(SymbolId("ETH", "KRW"));
+
+    const std::unordered_map<std::string, double> rates{{"BTC", RATE}, {"ETH", RATE * 2.0}, {"XRP", RATE}};
+    auto changed = engine.apply_borrow_rates(Exchange::Bybit, rates);
+    expect(changed.size() == 2 && changed[0] == "BTC" && changed[1] == "ETH", "monitored coins published, sorted");
+    expect(engine.apply_borrow_rates(Exchange::Bybit, rates).empty(), "unchanged rates report nothing");
+    expect(near(engine.get_borrow_rate(Exchange::Bybit, SymbolId("ETH", "KRW")), RATE * 2.0), "rate by Korean symbol");
+    expect(engine.get_borrow_rate(Exchange::OKX, SymbolId("ETH", "KRW")) == 0.0, "other venue unaffected");
+
+    auto partial = engine.apply_borrow_rates(Exchange::Bybit, {{"BTC", RATE * 4.0}});
+    expect(partial.size() == 1 && partial[0] == "BTC", "only the changed coin reported");
+    expect(near(engine.get_borrow_rate(Exchange::Bybit, SymbolId("ETH", "KRW")), RATE * 2.0),
+           "coins absent from a refresh keep their rate");
+
+    const auto now = std::chrono::system_clock::now();
+    Position pos = open_short(1.0, now - std::chrono::hours(10));
+    pos.symbol = SymbolId("ETH", "KRW");
+    expect(near(engine.get_borrow_cost_pct(pos), RATE * 2.0 * 10.0 * 100.0, 1e-6), "engine accrues at the live rate");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Borrow Cost Accrual Regression Test ===\n";
+    Logger::init("test_borrow_cost", "warn");
+
+    test_interest_math();
+    test_accrual_on_position();
+    test_exit_threshold();
+    test_entry_edge();
+    test_rate_table();
+    test_engine_rates();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: interest accrual, exit threshold, entry edge, rate table ***\n";
+    return 0;
+}
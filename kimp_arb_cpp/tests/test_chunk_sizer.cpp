@@ -0,0 +1,220 @@
+#include "kimp/execution/chunk_sizer.hpp"
+#include "kimp/execution/paper_execution.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+constexpr int64_t MS = 1'000'000;
+
+// Premium random walk sampled every 50ms with quiet noise
+ChunkSizer warmed_sizer(double noise_pct, double round_trip_ms = 100.0) {
+    ChunkSizer sizer({}, round_trip_ms);
+    double premium = 1.0;
+    for (int i = 0; i < 32; ++i) {
+        premium += (i % 2 == 0 ? noise_pct : -noise_pct);
+        sizer.observe_premium(premium, (i + 1) * 50 * MS);
+    }
+    return sizer;
+}
+
+void test_cold_start_is_fixed_policy() {
+    ChunkSizer sizer;
+    const auto d = sizer.size({3000.0, 10'000.0, 10'000.0, 0.5});
+    expect(d.usd == TradingConfig::TARGET_ENTRY_USDT, "cold sizer keeps the fixed chunk");
+    expect(d.drift_pct == 0.0, "no drift before warmup");
+
+    const auto tail = sizer.size({12.0, 10'000.0, 10'000.0, 0.5});
+    expect(tail.usd == 12.0, "chunk never exceeds the remainder");
+}
+
+void test_edge_scales_chunk() {
+    auto sizer = warmed_sizer(0.01);
+    expect(sizer.warm(), "sizer warm after samples");
+    const double drift = sizer.drift_pct();
+    expect(drift > 0.0, "drift measured");
+
+    const auto wide = sizer.size({3000.0, 50'000.0, 50'000.0, drift * 30.0});
+    expect(wide.usd > TradingConfig::TARGET_ENTRY_USDT * 4.0, "wide edge on a deep book grows the chunk");
+    expect(wide.usd <= TradingConfig::TARGET_ENTRY_USDT * 8.0 + 1e-9, "growth capped at max_usd");
+
+    const auto thin = sizer.size({3000.0, 50'000.0, 50'000.0, drift * 0.5});
+    expect(thin.usd < TradingConfig::TARGET_ENTRY_USDT, "edge inside the noise shrinks the chunk");
+    expect(thin.usd >= TradingConfig::TARGET_ENTRY_USDT * 0.5 - 1e-9, "shrink floored at min_scale");
+
+    auto noisy = warmed_sizer(0.2);
+    const auto same_edge = noisy.size({3000.0, 50'000.0, 50'000.0, drift * 30.0});
+    expect(same_edge.usd < wide.usd, "higher premium volatility shrinks the same edge");
+
+    auto slow = warmed_sizer(0.01, 100.0);
+    for (int i = 0; i < 40; ++i) slow.observe_round_trip(1600.0);
+    expect(slow.round_trip_ms() > 1000.0, "round trip EWMA tracks measured splits");
+    expect(slow.drift_pct() > drift * 3.0, "longer round trips widen the drift");
+}
+
+void test_depth_caps_chunk() {
+    auto sizer = warmed_sizer(0.01);
+    const double edge = sizer.drift_pct() * 30.0;
+
+    const auto shallow = sizer.size({3000.0, 120.0, 50'000.0, edge});
+    expect(std::fabs(shallow.usd - 60.0) < 1e-9, "chunk takes at most half of the thinner top level");
+
+    const auto base_covered = sizer.size({3000.0, 50.0, 50'000.0, edge});
+    expect(std::fabs(base_covered.usd - TradingConfig::TARGET_ENTRY_USDT) < 1e-9,
+           "top level covering the base chunk still gets the base chunk");
+
+    const auto unknown = sizer.size({3000.0, 0.0, 50'000.0, edge});
+    expect(unknown.usd <= TradingConfig::TARGET_ENTRY_USDT, "no growth without depth on both legs");
+}
+
+// ---------------------------------------------------------------------------
+// Replay: fill a 3000 USD short leg against a tape of foreign bid books and
+// compare the adaptive policy against fixed 35 USD chunks.
+// ---------------------------------------------------------------------------
+
+struct TapeFrame {
+    std::vector<OrderBookLevel> bids;
+    double premium_pct{0.0};
+    double edge_pct{0.0};
+};
+
+struct ReplayResult {
+    double elapsed_ms{0.0};
+    double filled_usd{0.0};
+    double slippage_bps{0.0};  // Notional-weighted vs the best bid
+    int chunks{0};
+};
+
+std::vector<TapeFrame> record_tape() {
+    // Deterministic LCG so the tape is identical on every run
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    auto next = [&]() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(state >> 11) / static_cast<double>(1ULL << 53);
+    };
+
+    std::vector<TapeFrame> tape;
+    double premium = 1.0;
+    for (int i = 0; i < 4000; ++i) {
+        premium += (next() - 0.5) * 0.02;
+        TapeFrame frame;
+        frame.premium_pct = premium;
+        // Mostly a clear edge, with thin stretches
+        frame.edge_pct = (i / 200) % 4 == 3 ? 0.01 : 0.25;
+        const double price = 20.0;
+        const double top_usd = 150.0 + next() * 1500.0;
+        frame.bids = {
+            {price, top_usd / price},
+            {price * 0.9995, 2000.0 / price},
+            {price * 0.9990, 5000.0 / price},
+        };
+        tape.push_back(std::move(frame));
+    }
+    return tape;
+}
+
+template <typename Policy>
+ReplayResult replay(const std::vector<TapeFrame>& tape, double target_usd, Policy&& policy,
+                    ChunkSizer* sizer) {
+    constexpr double FRAME_MS = 50.0;
+    constexpr double ROUND_TRIP_MS = 120.0;
+
+    ReplayResult out;
+    double slip_weighted = 0.0;
+    double t_ms = 0.0;
+    std::size_t last_observed = static_cast<std::size_t>(-1);
+    while (out.filled_usd < target_usd - 1e-6) {
+        const auto idx = static_cast<std::size_t>(t_ms / FRAME_MS);
+        if (idx >= tape.size()) {
+            break;
+        }
+        const auto& frame = tape[idx];
+        if (sizer && idx != last_observed) {
+            sizer->observe_premium(frame.premium_pct, static_cast<int64_t>(t_ms * MS));
+            last_observed = idx;
+        }
+
+        const double best = frame.bids.front().price;
+        const double top_usd = best * frame.bids.front().quantity;
+        const double remaining = target_usd - out.filled_usd;
+        const double chunk_usd = policy(remaining, top_usd, frame.edge_pct);
+        // Same entry gate as the live loop: the top level must cover the chunk
+        if (frame.edge_pct <= 0.0 || chunk_usd <= 0.0 || top_usd < chunk_usd) {
+            t_ms = (static_cast<double>(idx) + 1.0) * FRAME_MS;  // Wait for the next update
+            continue;
+        }
+
+        const auto fill = PaperExecution::walk_quantity(frame.bids.data(), frame.bids.size(),
+                                                        chunk_usd / best, 10.0, false);
+        out.filled_usd += fill.notional;
+        slip_weighted += (best - fill.average_price) / best * 1e4 * fill.notional;
+        ++out.chunks;
+        if (sizer) {
+            sizer->observe_round_trip(ROUND_TRIP_MS);
+        }
+        // Legs, then the next market update
+        t_ms = (std::floor((t_ms + ROUND_TRIP_MS) / FRAME_MS) + 1.0) * FRAME_MS;
+    }
+    out.elapsed_ms = t_ms;
+    out.slippage_bps = out.filled_usd > 0.0 ? slip_weighted / out.filled_usd : 0.0;
+    return out;
+}
+
+void test_replay_against_fixed_chunks() {
+    const auto tape = record_tape();
+    constexpr double TARGET_USD = 3000.0;
+
+    const auto fixed = replay(tape, TARGET_USD, [](double remaining, double, double) {
+        return std::min(TradingConfig::TARGET_ENTRY_USDT, remaining);
+    }, nullptr);
+
+    ChunkSizer sizer;
+    const auto adaptive = replay(tape, TARGET_USD, [&](double remaining, double top_usd, double edge) {
+        // Korean leg modeled as deep; the foreign top level binds
+        return sizer.size({remaining, 1e9, top_usd, edge}).usd;
+    }, &sizer);
+
+    std::cout << "fixed:    " << fixed.chunks << " chunks, " << fixed.elapsed_ms << " ms, "
+              << fixed.slippage_bps << " bps\n";
+    std::cout << "adaptive: " << adaptive.chunks << " chunks, " << adaptive.elapsed_ms << " ms, "
+              << adaptive.slippage_bps << " bps\n";
+
+    expect(fixed.filled_usd >= TARGET_USD - 1e-6 && adaptive.filled_usd >= TARGET_USD - 1e-6,
+           "both policies fill the position on the tape");
+    expect(adaptive.chunks * 3 < fixed.chunks, "adaptive policy needs far fewer splits");
+    expect(adaptive.elapsed_ms * 2.0 < fixed.elapsed_ms, "adaptive policy at least halves fill time");
+    expect(adaptive.slippage_bps <= fixed.slippage_bps + 0.5, "growth does not walk the book");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Chunk Sizer Regression Test ===\n";
+
+    test_cold_start_is_fixed_policy();
+    test_edge_scales_chunk();
+    test_depth_caps_chunk();
+    test_replay_against_fixed_chunks();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: depth-adaptive chunks fill faster than fixed chunks without extra slippage ***\n";
+    return 0;
+}
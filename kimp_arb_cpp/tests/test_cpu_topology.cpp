@@ -0,0 +1,200 @@
+#include "kimp/core/cpu_topology.hpp"
+#include "kimp/core/logger.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::opt;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+const fs::path ROOT = fs::temp_directory_path() / "kimp_cpu_topology_test";
+
+struct CpuSpec {
+    int cpu;
+    std::string siblings;
+    std::string l3;
+};
+
+void write(const fs::path& path, const std::string& text) {
+    fs::create_directories(path.parent_path());
+    std::ofstream(path) << text << "\n";
+}
+
+// Canned /sys/devices/system/cpu and /proc/interrupts for one host
+CpuTopology canned(const std::string& name, const std::string& online, const std::vector<CpuSpec>& cpus,
+                   const std::string& isolated, const std::string& interrupts) {
+    const fs::path root = ROOT / name;
+    fs::remove_all(root);
+    write(root / "online", online);
+    write(root / "isolated", isolated);
+    write(root / "nohz_full", isolated.empty() ? "(null)" : isolated);
+    for (const auto& spec : cpus) {
+        const fs::path dir = root / ("cpu" + std::to_string(spec.cpu));
+        write(dir / "topology" / "physical_package_id", "0");
+        write(dir / "topology" / "thread_siblings_list", spec.siblings);
+        write(dir / "cache" / "index0" / "level", "1");
+        write(dir / "cache" / "index2" / "level", "2");
+        write(dir / "cache" / "index3" / "level", "3");
+        write(dir / "cache" / "index3" / "shared_cpu_list", spec.l3);
+    }
+    write(root / "interrupts", interrupts);
+    return CpuTopology::discover((root).string(), (root / "interrupts").string());
+}
+
+std::string smt_siblings(int cpu, int cores) {
+    const int first = cpu % cores;
+    return std::to_string(first) + "," + std::to_string(first + cores);
+}
+
+std::vector<int> hot(const ThreadConfig& cfg) {
+    return {cfg.io_bithumb_core, cfg.io_bybit_core, cfg.strategy_core, cfg.execution_core};
+}
+
+bool distinct_physical(const CpuTopology& topology, const std::vector<int>& cpus) {
+    std::set<int> cores;
+    for (int cpu : cpus) {
+        for (const auto& info : topology.cpus) {
+            if (info.cpu == cpu) cores.insert(info.core);
+        }
+    }
+    return cores.size() == cpus.size();
+}
+
+void test_cpu_lists() {
+    const auto cpus = parse_cpu_list("0-3,8,10-11\n");
+    expect(cpus == std::vector<int>({0, 1, 2, 3, 8, 10, 11}), "range list parsed");
+    expect(parse_cpu_list("(null)\n").empty(), "nohz_full off parses empty");
+    expect(parse_cpu_list("\n").empty(), "empty list");
+    expect(format_cpu_list({11, 0, 1, 2, 3, 8, 10}) == "0-3,8,10-11", "list formatted back");
+}
+
+void test_smt_avoided() {
+    // 4 cores x 2 threads, siblings n / n+4; eth0 queues land on CPU 0
+    std::vector<CpuSpec> cpus;
+    for (int cpu = 0; cpu < 8; ++cpu) cpus.push_back({cpu, smt_siblings(cpu, 4), "0-7"});
+    const std::string interrupts =
+        "           CPU0       CPU1       CPU2       CPU3       CPU4       CPU5       CPU6       CPU7\n"
+        "  0:         40          0          0          0          0          0          0          0  IR-IO-APIC    2-edge      timer\n"
+        " 45:    9000000          3          0          0          0          0          0          0  IR-PCI-MSI 524288-edge      eth0-TxRx-0\n"
+        " 46:          0          0    7000000          0          0          0          0          0  IR-PCI-MSI 1048576-edge      nvme0q1\n"
+        "NMI:          1          1          1          1          1          1          1          1   Non-maskable interrupts\n";
+    const auto topology = canned("smt", "0-7", cpus, "", interrupts);
+
+    expect(topology.cpus.size() == 8, "8 online CPUs");
+    expect(topology.physical_cores() == 4, "SMT siblings fold into 4 cores");
+    expect(topology.l3_domains() == 1, "one L3 domain");
+    expect(topology.cpus[0].nic_irq, "CPU 0 takes the eth0 queue");
+    expect(!topology.cpus[1].nic_irq, "3 stray interrupts are not a NIC CPU");
+    expect(!topology.cpus[2].nic_irq, "nvme queue is not a NIC");
+
+    const auto plan = plan_threads(topology);
+    expect(distinct_physical(topology, hot(plan.config)), "hot threads on distinct physical cores");
+    for (int cpu : hot(plan.config)) {
+        expect(cpu >= 0 && cpu != 0, "hot threads pinned, off the NIC IRQ CPU");
+    }
+    expect(plan.config.execution_core == 4, "CPU 0's core serves execution through its sibling");
+    expect(plan.config.logger_core == -1 && plan.config.export_core == -1,
+           "no spare core: logger and exporter unpinned");
+    expect(plan.config.execution_worker_core(3) == 4, "workers stay on the execution core");
+}
+
+void test_isolated_preferred() {
+    // 8 cores x 2 threads, siblings n / n+8; isolcpus=4-7,12-15; NIC on CPU 1
+    std::vector<CpuSpec> cpus;
+    for (int cpu = 0; cpu < 16; ++cpu) cpus.push_back({cpu, smt_siblings(cpu, 8), "0-15"});
+    const std::string interrupts =
+        "           CPU0       CPU1       CPU2       CPU3       CPU4       CPU5       CPU6       CPU7"
+        "       CPU8       CPU9      CPU10      CPU11      CPU12      CPU13      CPU14      CPU15\n"
+        " 60:          0     500000          0          0          0          0          0          0"
+        "          0          0          0          0          0          0          0          0  PCI-MSI-edge  mlx5_comp0@pci:0000:3b:00.0\n";
+    const auto topology = canned("isolated", "0-15", cpus, "4-7,12-15", interrupts);
+    expect(topology.cpus[4].isolated && topology.cpus[4].nohz_full, "isolated and nohz_full read");
+
+    const auto plan = plan_threads(topology);
+    const auto& cfg = plan.config;
+    expect(cfg.io_bithumb_core == 4 && cfg.io_bybit_core == 5, "io threads on isolated cores");
+    expect(cfg.strategy_core == 6 && cfg.execution_core == 7, "strategy and execution on isolated cores");
+    expect(distinct_physical(topology, hot(cfg)), "no two hot threads on SMT siblings");
+    expect(cfg.logger_core == 0, "logger on a housekeeping core");
+    expect(cfg.export_core == 9, "exporter on the quiet sibling of the NIC core");
+    expect(cfg.execution_cores == std::vector<int>({7, 2, 3}), "execution workers fill the spare cores");
+    expect(plan.describe().find("isolated 4-7,12-15") != std::string::npos, "plan names the isolated CPUs");
+    expect(plan.describe().find("NIC IRQ on 1") != std::string::npos, "plan names the NIC IRQ CPUs");
+}
+
+void test_one_l3_domain() {
+    // 8 cores without SMT, two L3 domains (0-3, 4-7); virtio NIC on CPU 4
+    std::vector<CpuSpec> cpus;
+    for (int cpu = 0; cpu < 8; ++cpu) cpus.push_back({cpu, std::to_string(cpu), cpu < 4 ? "0-3" : "4-7"});
+    const std::string interrupts =
+        "           CPU0       CPU1       CPU2       CPU3       CPU4       CPU5       CPU6       CPU7\n"
+        " 30:          0          0          0          0     800000          0          0          0  PCI-MSI 49153-edge      virtio1-input.0\n"
+        " 31:          0          0          0          0     600000          0          0          0  PCI-MSI 49154-edge      virtio1-output.0\n";
+    const auto topology = canned("ccx", "0-7", cpus, "", interrupts);
+    expect(topology.l3_domains() == 2, "two L3 domains");
+
+    const auto plan = plan_threads(topology);
+    const auto& cfg = plan.config;
+    for (int cpu : hot(cfg)) {
+        expect(cpu >= 0 && cpu < 4, "hot threads share one L3 domain");
+    }
+    expect(cfg.io_bithumb_core == 1 && cfg.execution_core == 0, "CPU 0 taken last within the domain");
+    expect(cfg.logger_core == 4 && cfg.export_core == 5, "logger and exporter in the other domain");
+    expect(cfg.execution_cores == std::vector<int>({0}), "no spare core left in the hot domain");
+}
+
+void test_small_and_missing() {
+    std::vector<CpuSpec> cpus{{0, "0", "0-1"}, {1, "1", "0-1"}};
+    const auto small = plan_threads(canned("small", "0-1", cpus, "", "           CPU0       CPU1\n"));
+    expect(small.config.io_bithumb_core == -1 && small.config.execution_core == -1 &&
+           small.config.logger_core == -1, "fewer than 4 cores: nothing pinned");
+    expect(small.config.execution_worker_core(0) == -1, "workers unpinned");
+    expect(!small.notes.empty(), "plan says why");
+
+    const auto missing = CpuTopology::discover((ROOT / "absent").string(), (ROOT / "absent" / "interrupts").string());
+    expect(missing.empty(), "no sysfs: empty topology");
+    const auto fallback = plan_threads(missing);
+    const auto expected = ThreadConfig::fallback();
+    expect(fallback.config.strategy_core == expected.strategy_core &&
+           fallback.config.execution_core == expected.execution_core, "no sysfs: count-based layout");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== CPU Topology Regression Test ===\n";
+    Logger::init("test_cpu_topology", "warn");
+
+    test_cpu_lists();
+    test_smt_avoided();
+    test_isolated_preferred();
+    test_one_l3_domain();
+    test_small_and_missing();
+
+    std::error_code ec;
+    fs::remove_all(ROOT, ec);
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: SMT-aware, isolated-first, single-L3 thread placement from canned sysfs ***\n";
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include "kimp/network/feed_arbiter.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+#include "kimp/core/config.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using kimp::network::FeedArbiter;
+using kimp::network::FeedVerdict;
+
+class TestBybitExchange : public kimp::exchange::bybit::BybitExchange {
+public:
+    using kimp::exchange::bybit::BybitExchange::BybitExchange;
+    using kimp::exchange::bybit::BybitExchange::on_ws_message;
+
+    void on_ws_message_line_b(std::string_view message) {
+        FeedLineScope scope(FEED_LINE_B);
+        on_ws_message(message);
+    }
+};
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+std::string bybit_book(uint64_t seq, const char* bid) {
+    return std::string(R"({"topic":"orderbook.1.BTCUSDT","ts":1773342407942,"type":"delta","data":{"s":"BTCUSDT","b":[[")") +
+           bid + R"(","0.5"]],"a":[["69904.4","0.4"]],"u":1,"seq":)" + std::to_string(seq) + R"(},"cts":1773342407934})";
+}
+
+void test_first_arrival_and_dedup() {
+    FeedArbiter arbiter;
+    const uint64_t key = FeedArbiter::make_key(42, 0);
+
+    // A wins v1, B's copy is late by 300us
+    expect(arbiter.offer(key, 1, "u1", 0, 1'000'000) == FeedVerdict::First, "A first copy forwarded");
+    expect(arbiter.offer(key, 1, "u1", 1, 1'300'000) == FeedVerdict::Duplicate, "B late copy dropped");
+
+    // B wins v2, A's copy is late by 100us
+    expect(arbiter.offer(key, 2, "u2", 1, 2'000'000) == FeedVerdict::First, "B first copy forwarded");
+    expect(arbiter.offer(key, 2, "u2", 0, 2'100'000) == FeedVerdict::Duplicate, "A late copy dropped");
+
+    // Same venue version, different payload (two updates in one ms) is new data
+    expect(arbiter.offer(key, 2, "u2b", 0, 2'200'000) == FeedVerdict::First, "same-version distinct update forwarded");
+
+    // A jumps to v4; B's v3 (never seen) is out of order and must not roll state back
+    expect(arbiter.offer(key, 4, "u4", 0, 4'000'000) == FeedVerdict::First, "A v4 forwarded");
+    expect(arbiter.offer(key, 3, "u3", 1, 4'050'000) == FeedVerdict::Stale, "B v3 after v4 is stale");
+
+    // Independent keys do not interfere
+    expect(arbiter.offer(FeedArbiter::make_key(42, 1), 1, "u1", 1, 5'000'000) == FeedVerdict::First,
+           "other channel has its own version");
+
+    const auto stats = arbiter.stats();
+    expect(stats.lines[0].wins == 3, "A win count");
+    expect(stats.lines[1].wins == 2, "B win count");
+    expect(stats.lines[0].late == 1 && stats.lines[1].late == 1, "late counts");
+    expect(stats.lines[1].stale == 1, "B stale count");
+    expect(stats.lines[1].lag_ns_max == 300'000, "B max lag");
+    expect(stats.lines[0].lag_ns_max == 100'000, "A max lag");
+    expect(stats.forwarded == 5, "forwarded count");
+    expect(stats.win_rate(0) > 0.59 && stats.win_rate(0) < 0.61, "A win rate");
+}
+
+void test_sequence_reset() {
+    FeedArbiter arbiter;
+    const uint64_t key = FeedArbiter::make_key(7, 0);
+
+    expect(arbiter.offer(key, 1000, "a", 0, 1) == FeedVerdict::First, "pre-reset update");
+    expect(arbiter.offer(key, 1000, "a", 1, 2) == FeedVerdict::Duplicate, "pre-reset copy");
+
+    // Venue restarted: line A itself goes backwards → re-base instead of stalling forever
+    expect(arbiter.offer(key, 5, "b", 0, 3) == FeedVerdict::First, "line reset accepted");
+    expect(arbiter.offer(key, 5, "b", 1, 4) == FeedVerdict::Duplicate, "post-reset copy dropped");
+    expect(arbiter.offer(key, 6, "c", 1, 5) == FeedVerdict::First, "post-reset progress");
+}
+
+void test_parse_version() {
+    expect(FeedArbiter::parse_version(R"({"ts":1773342407942,"x":1})", R"("ts":)") == 1773342407942ULL,
+           "numeric version");
+    expect(FeedArbiter::parse_version(R"({"seqId":"123456"})", R"("seqId":)") == 123456ULL, "quoted version");
+    expect(FeedArbiter::parse_version(R"({"date":"20240102"})", R"("time":)") == 0, "missing marker");
+}
+
+void test_exchange_gate() {
+    boost::asio::io_context io_context;
+    kimp::ExchangeCredentials creds;
+    creds.redundant_feed = true;
+    TestBybitExchange exchange(io_context, creds);
+
+    std::vector<double> forwarded_bids;
+    exchange.set_ticker_callback([&](const kimp::Ticker& ticker) {
+        forwarded_bids.push_back(ticker.bid);
+    });
+
+    const auto v1 = bybit_book(100, "69904.3");
+    const auto v2 = bybit_book(101, "69904.2");
+
+    exchange.on_ws_message(v1);          // A first
+    exchange.on_ws_message_line_b(v1);   // B late copy
+    exchange.on_ws_message_line_b(v2);   // B first
+    exchange.on_ws_message(v2);          // A late copy
+    exchange.on_ws_message(bybit_book(103, "69904.5"));       // A first
+    exchange.on_ws_message_line_b(bybit_book(102, "69900.0"));  // B behind forwarded state
+
+    expect(forwarded_bids.size() == 3, "exchange forwards each update exactly once");
+    expect(forwarded_bids.size() == 3 && forwarded_bids[2] == 69904.5, "exchange forwards newest BBO last");
+
+    const auto stats = exchange.get_feed_arbiter_stats();
+    expect(stats.has_value(), "redundant feed stats available");
+    if (stats) {
+        expect(stats->lines[0].wins == 2 && stats->lines[1].wins == 1, "exchange per-line wins");
+        expect(stats->lines[1].stale == 1, "exchange stale drop");
+    }
+
+    kimp::ExchangeCredentials single_creds;
+    TestBybitExchange single(io_context, single_creds);
+    expect(!single.get_feed_arbiter_stats().has_value(), "single-line venue has no arbiter");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Feed Arbiter Regression Test ===\n";
+
+    test_first_arrival_and_dedup();
+    test_sequence_reset();
+    test_parse_version();
+    test_exchange_gate();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: A/B feeds forward first arrival once, drop late/stale copies ***\n";
+    return 0;
+}
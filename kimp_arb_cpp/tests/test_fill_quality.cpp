@@ -0,0 +1,263 @@
+#include "kimp/execution/fill_quality.hpp"
+#include "kimp/execution/order_manager.hpp"
+#include "kimp/execution/paper_execution.hpp"
+#include "kimp/exchange/bithumb/bithumb.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+
+#include <boost/asio.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+
+namespace {
+
+namespace net = boost::asio;
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+bool near(double a, double b, double eps = 1e-6) { return std::fabs(a - b) <= eps; }
+
+constexpr uint64_t MS = 1'000'000;
+
+FillQualityRecord make_leg(uint64_t trace, FillLeg leg, Exchange venue, Exchange counter, Side side,
+                           double decision, double fill_quote, double fill, double qty) {
+    FillQualityRecord r;
+    r.trace_id = trace;
+    r.decision_ns = 1'000 * MS;
+    r.send_ns = 1'002 * MS;
+    r.ack_ns = 1'042 * MS;
+    r.fill_ns = 1'100 * MS;
+    r.decision_price = decision;
+    r.fill_quote_price = fill_quote;
+    r.fill_price = fill;
+    r.fill_qty = qty;
+    r.usdt_krw = 1'000.0;
+    r.symbol = {'X', 'R', 'P', '/', 'K', 'R', 'W'};
+    r.leg = leg;
+    r.venue = venue;
+    r.counter_venue = counter;
+    r.side = side;
+    return r;
+}
+
+void test_record_metrics() {
+    // Short at 9.99 after deciding on a 10.00 bid that moved to 9.995
+    const auto sell = make_leg(1, FillLeg::Foreign, Exchange::Bybit, Exchange::Bithumb, Side::Sell,
+                               10.0, 9.995, 9.99, 10.0);
+    expect(near(sell.slippage_bps(), 10.0), "sell below the decision bid costs bps");
+    expect(near(sell.drift_bps(), 5.0), "half of it is the bid moving before the fill");
+    expect(near(sell.notional_usd(), 99.9), "foreign notional in USDT");
+
+    // Bought below the decision ask: negative slippage (price improvement)
+    const auto buy = make_leg(1, FillLeg::Korean, Exchange::Bithumb, Exchange::Bybit, Side::Buy,
+                              10'000.0, 0.0, 9'990.0, 10.0);
+    expect(near(buy.slippage_bps(), -10.0), "buy below the decision ask is improvement");
+    expect(buy.drift_bps() == 0.0, "unknown fill-time quote attributes nothing to latency");
+    expect(near(buy.notional_usd(), 99.9), "Korean notional converted at usdt_krw");
+}
+
+void test_log_round_trip_and_summary() {
+    const auto path = (std::filesystem::temp_directory_path() / "kimp_test_fill_quality.bin").string();
+    std::filesystem::remove(path);
+
+    std::vector<FillQualityRecord> batch = {
+        make_leg(7, FillLeg::Foreign, Exchange::Bybit, Exchange::Bithumb, Side::Sell, 10.0, 9.995, 9.99, 10.0),
+        make_leg(7, FillLeg::Korean, Exchange::Bithumb, Exchange::Bybit, Side::Buy, 10'000.0, 10'000.0, 10'010.0, 10.0),
+    };
+    expect(append_fill_quality(path, batch), "first append");
+    batch[0].trace_id = batch[1].trace_id = 8;
+    batch[0].venue = batch[1].counter_venue = Exchange::OKX;
+    expect(append_fill_quality(path, batch), "second append reuses the header");
+
+    std::vector<FillQualityRecord> read;
+    std::string error;
+    expect(read_fill_quality(path, read, &error), "log reads back");
+    expect(read.size() == 4 && read[2].trace_id == 8 && read[3].venue == Exchange::Bithumb,
+           "records round-trip in order");
+    expect(std::filesystem::file_size(path) == 16 + 4 * sizeof(FillQualityRecord), "one header per file");
+
+    const auto venues = summarize_fill_quality(read, FillGroup::Venue);
+    expect(venues.size() == 3, "Bithumb, Bybit and OKX rows");
+    const auto& kr = venues.front();
+    expect(kr.key == "Bithumb (KR)" && kr.legs == 2, "worst venue first");
+    expect(near(kr.slippage_bps, 10.0) && near(kr.drift_bps, 0.0) && near(kr.impact_bps, 10.0),
+           "Korean loss is all impact");
+    expect(near(kr.avg_ack_ms, 40.0) && near(kr.avg_decision_to_fill_ms, 100.0), "latency averages");
+
+    const auto pairs = summarize_fill_quality(read, FillGroup::Pair);
+    expect(pairs.size() == 2 && pairs[0].legs == 2, "one row per Korean/foreign pair");
+    const auto symbols = summarize_fill_quality(read, FillGroup::Symbol);
+    expect(symbols.size() == 1 && symbols[0].key == "XRP/KRW" && symbols[0].legs == 4, "symbol row");
+
+    const auto report = format_fill_quality_report(read);
+    expect(report.find("4 legs across 2 traces") != std::string::npos, "report header");
+    expect(report.find("Bithumb/OKX") != std::string::npos, "report lists pairs");
+
+    std::FILE* junk = std::fopen(path.c_str(), "wb");
+    std::fputs("not a log at all, just text", junk);
+    std::fclose(junk);
+    expect(!read_fill_quality(path, read, &error) && !error.empty(), "foreign files are rejected");
+    std::filesystem::remove(path);
+}
+
+// ---------------------------------------------------------------------------
+// OrderManager writes one record per filled leg under the trade log dir
+// ---------------------------------------------------------------------------
+
+class GuardBybitExchange final : public exchange::bybit::BybitExchange {
+public:
+    explicit GuardBybitExchange(net::io_context& ioc) : exchange::bybit::BybitExchange(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    bool cancel_order(uint64_t) override { return false; }
+    bool prepare_shorting(const SymbolId&) override { return true; }
+    std::vector<Position> get_short_positions() override { return {}; }
+    bool close_short_position(const SymbolId&) override { return true; }
+    double get_balance(const std::string&) override { return 0.0; }
+    Order place_market_order(const SymbolId&, Side, Quantity) override { return {}; }
+    Order open_short(const SymbolId&, Quantity) override { return {}; }
+    Order close_short(const SymbolId&, Quantity) override { return {}; }
+};
+
+class GuardBithumbExchange final : public exchange::bithumb::BithumbExchange {
+public:
+    explicit GuardBithumbExchange(net::io_context& ioc) : exchange::bithumb::BithumbExchange(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    double get_usdt_krw_price() override { return 1300.0; }
+    bool cancel_order(uint64_t) override { return false; }
+    double get_balance(const std::string&) override { return 0.0; }
+    Order place_market_order(const SymbolId&, Side, Quantity) override { return {}; }
+    Order place_market_buy_cost(const SymbolId&, Price) override { return {}; }
+};
+
+OrderBook make_book(Exchange ex, const SymbolId& symbol, OrderBookLevel bid, OrderBookLevel ask) {
+    OrderBook book;
+    book.exchange = ex;
+    book.symbol = symbol;
+    book.timestamp = std::chrono::steady_clock::now();
+    book.bids[book.bid_count++] = bid;
+    book.asks[book.ask_count++] = ask;
+    return book;
+}
+
+void test_order_manager_records_legs() {
+    const auto dir = std::filesystem::temp_directory_path() / "kimp_test_fill_quality_logs";
+    std::filesystem::remove_all(dir);
+    OrderManager::set_trade_log_dir(dir.string());
+
+    net::io_context ioc;
+    const SymbolId symbol("BTC", "KRW");
+    PaperExecution::Options options;
+    options.seed = 11;
+    auto paper = std::make_shared<PaperExecution>(nullptr, options);
+    paper->on_orderbook(make_book(Exchange::Bithumb, symbol, {13100.0, 100.0}, {13110.0, 100.0}));
+    paper->on_orderbook(make_book(Exchange::Bybit, SymbolId("BTC", "USDT"), {9.4, 100.0}, {9.5, 100.0}));
+
+    OrderManager manager;
+    manager.set_exchange(Exchange::Bithumb, std::make_shared<GuardBithumbExchange>(ioc));
+    manager.set_exchange(Exchange::Bybit, std::make_shared<GuardBybitExchange>(ioc));
+    manager.set_execution_backend(paper);
+
+    Position position;
+    position.symbol = symbol;
+    position.korean_exchange = Exchange::Bithumb;
+    position.foreign_exchange = Exchange::Bybit;
+    position.korean_amount = 10.0;
+    position.foreign_amount = 10.0;
+    position.korean_entry_price = 10000.0;
+    position.foreign_entry_price = 10.0;
+    position.position_size_usd = 100.0;
+    position.is_active = true;
+    paper->seed_position(position);
+
+    ExitSignal signal;
+    signal.trace_id = 4242;
+    signal.symbol = symbol;
+    signal.korean_exchange = position.korean_exchange;
+    signal.foreign_exchange = position.foreign_exchange;
+    signal.premium = 0.7692307692;
+    signal.korean_bid = 13100.0;
+    signal.foreign_ask = 9.49;  // Decided on a cover ask one tick better than the fill
+    signal.usdt_krw_rate = 1300.0;
+
+    const auto result = manager.execute_spot_relay_exit(signal, position);
+    expect(result.success, "paper exit completes");
+
+    // Written by the background trade-log writer; the sizer exits in three splits
+    const auto path = (dir / "fill_quality.bin").string();
+    std::vector<FillQualityRecord> records;
+    for (int i = 0; i < 200 && records.size() < 6; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        read_fill_quality(path, records);
+    }
+    expect(records.size() == 6, "one record per filled leg of every split");
+    double foreign_qty = 0.0;
+    double korean_qty = 0.0;
+    for (std::size_t i = 0; i + 1 < records.size(); i += 2) {
+        const auto& foreign = records[i].leg == FillLeg::Foreign ? records[i] : records[i + 1];
+        const auto& korean = records[i].leg == FillLeg::Korean ? records[i] : records[i + 1];
+        foreign_qty += foreign.fill_qty;
+        korean_qty += korean.fill_qty;
+        expect(foreign.trace_id == 4242 && korean.trace_id == 4242, "legs keyed by the signal trace id");
+        expect(foreign.decision_ns == korean.decision_ns, "both legs share the split decision");
+        expect(foreign.action == FillAction::Exit && foreign.side == Side::Buy && korean.side == Side::Sell,
+               "exit covers foreign and sells Korean");
+        expect(foreign.venue == Exchange::Bybit && foreign.counter_venue == Exchange::Bithumb, "pair recorded");
+        expect(near(foreign.decision_price, 9.49) && near(foreign.fill_price, 9.5), "foreign decision and fill");
+        expect(near(foreign.slippage_bps(), (9.5 - 9.49) / 9.49 * 1e4), "cover slippage vs decision ask");
+        expect(near(korean.decision_price, 13100.0) && near(korean.slippage_bps(), 0.0), "Korean sold at the bid");
+        expect(foreign.decision_ns > 0 && foreign.send_ns >= foreign.decision_ns &&
+               foreign.ack_ns >= foreign.send_ns && foreign.fill_ns >= foreign.ack_ns,
+               "decision -> send -> ack -> fill timeline");
+        expect(korean.send_ns >= foreign.ack_ns, "Korean leg sent after the foreign ack");
+    }
+    expect(near(foreign_qty, 10.0) && near(korean_qty, 10.0), "records cover the whole position");
+
+    OrderManager::set_trade_log_dir("trade_logs");
+    std::filesystem::remove_all(dir);
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Fill Quality Regression Test ===\n";
+
+    test_record_metrics();
+    test_log_round_trip_and_summary();
+    test_order_manager_records_legs();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: fill quality log ties decision, legs and fills by trace id ***\n";
+    return 0;
+}
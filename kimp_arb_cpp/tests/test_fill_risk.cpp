@@ -0,0 +1,159 @@
+#include "kimp/core/logger.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/strategy/fill_risk.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+using namespace kimp;
+using namespace kimp::strategy;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+constexpr int64_t MS = 1'000'000;
+
+void test_variance_and_latency_estimates() {
+    FillRiskModel model(4);
+    // Mid alternates by 0.1% every 2ms: r^2 = (log 1.001)^2 per 2ms
+    for (int i = 0; i < 400; ++i) {
+        const double mid = (i % 2 == 0) ? 100.0 : 100.1;
+        model.on_quote(Exchange::Bybit, 1, mid - 0.01, mid + 0.01, (i + 1) * 2 * MS);
+    }
+    const double r = std::log(100.1 / 100.0);
+    expect(std::fabs(model.variance_per_ms(Exchange::Bybit, 1) - r * r / 2.0) < 1e-12,
+           "variance per ms from tick returns and gaps");
+    expect(model.variance_per_ms(Exchange::Bybit, 2) == 0.0, "other symbols untouched");
+    expect(model.variance_per_ms(Exchange::OKX, 1) == 0.0, "other venues untouched");
+
+    model.on_quote(Exchange::Bybit, 99, 1.0, 1.1, MS);  // Out of capacity: ignored
+
+    const double before = model.leg_latency_ms(Exchange::Bybit);
+    for (int i = 0; i < 60; ++i) model.record_leg_latency(Exchange::Bybit, 400.0);
+    expect(before < 100.0 && std::fabs(model.leg_latency_ms(Exchange::Bybit) - 400.0) < 1.0,
+           "leg latency EWMA converges to measurements");
+
+    const double adverse = model.adverse_move_pct(Exchange::Bithumb, Exchange::Bybit, 1);
+    const double expected = FillRiskModel::ADVERSE_SIGMAS *
+                            std::sqrt(model.variance_per_ms(Exchange::Bybit, 1) *
+                                      model.leg_latency_ms(Exchange::Bybit)) * 100.0;
+    expect(std::fabs(adverse - expected) < 1e-9, "quiet Korean book adds nothing; foreign leg over its latency");
+
+    expect(FillRiskModel::expected_profit_krw(500.0, 100'000.0, 0.2) == 300.0,
+           "adverse move charged on the priced notional");
+}
+
+void test_update_cost() {
+    FillRiskModel model(1024);
+    constexpr int N = 1'000'000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < N; ++i) {
+        const double mid = 100.0 + (i % 7) * 0.01;
+        model.on_quote(Exchange::Bybit, static_cast<std::size_t>(i) & 1023, mid, mid + 0.01, (i + 1) * MS);
+    }
+    const double ns_per_update = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - t0).count() / N;
+    std::cout << "on_quote: " << ns_per_update << " ns/update\n";
+    expect(ns_per_update < 2'000.0, "per-tick update stays cheap");
+}
+
+Ticker make_ticker(Exchange ex, const SymbolId& symbol, double bid, double ask,
+                   std::chrono::steady_clock::time_point ts) {
+    Ticker t;
+    t.exchange = ex;
+    t.symbol = symbol;
+    t.timestamp = ts;
+    t.bid = bid;
+    t.ask = ask;
+    t.last = (bid + ask) * 0.5;
+    t.bid_qty = 10'000.0;
+    t.ask_qty = 10'000.0;
+    return t;
+}
+
+Exchange best_foreign(const ArbitrageEngine& engine) {
+    const auto premiums = engine.get_all_premiums();
+    return premiums.size() == 1 ? premiums.front().best_foreign_exchange : Exchange::Count;
+}
+
+void test_ranking_flips_with_leg_latency() {
+    ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Bithumb, Exchange::Bybit);
+    engine.add_exchange_pair(Exchange::Bithumb, Exchange::OKX);
+    const SymbolId krw("RSK", "KRW");
+    const SymbolId usdt("RSK", "USDT");
+    engine.add_symbol(krw);
+
+    auto& cache = engine.get_price_cache();
+    for (Exchange foreign : {Exchange::Bybit, Exchange::OKX}) {
+        cache.set_withdraw_network_fees(Exchange::Bithumb, "RSK", {PriceCache::NetworkFee{"ETH", 0.0}});
+        cache.set_foreign_deposit_networks(foreign, "RSK", {"ETH"});
+    }
+    cache.set_korean_withdraw_enabled(Exchange::Bithumb, "RSK", true);
+    cache.finalize_withdraw_fees();
+
+    const auto now = std::chrono::steady_clock::now();
+    Ticker usdt_tick = make_ticker(Exchange::Bithumb, SymbolId("USDT", "KRW"), 1000.0, 1000.0, now);
+    engine.on_ticker_update(usdt_tick);
+
+    // Same noisy feeds on both foreign venues; Bybit quotes a better bid
+    constexpr int TICKS = 200;
+    for (int i = 0; i < TICKS; ++i) {
+        const auto ts = now - std::chrono::milliseconds(TICKS - i);
+        const double wobble = (i % 2 == 0) ? 1.0 : 1.002;
+        engine.on_ticker_update(make_ticker(Exchange::Bithumb, krw, 1995.0, 2000.0, ts));
+        engine.on_ticker_update(make_ticker(Exchange::Bybit, usdt, 2.030 * wobble, 2.031 * wobble, ts));
+        engine.on_ticker_update(make_ticker(Exchange::OKX, usdt, 2.025 * wobble, 2.026 * wobble, ts));
+    }
+    engine.on_ticker_update(make_ticker(Exchange::Bybit, usdt, 2.030, 2.031, now));
+    engine.on_ticker_update(make_ticker(Exchange::OKX, usdt, 2.025, 2.026, now));
+    engine.on_ticker_update(make_ticker(Exchange::Bithumb, krw, 1995.0, 2000.0, now));
+
+    const auto& risk = engine.get_fill_risk();
+    expect(risk.variance_per_ms(Exchange::Bybit, 0) > 0.0, "engine feeds per-tick volatility");
+    expect(best_foreign(engine) == Exchange::Bybit, "better quote wins at comparable latency");
+
+    // Bybit orders start taking seconds to match
+    for (int i = 0; i < 40; ++i) {
+        engine.get_fill_risk().record_leg_latency(Exchange::Bybit, 3'000.0);
+    }
+    expect(best_foreign(engine) == Exchange::OKX, "slow venue loses the route despite the better quote");
+
+    const auto premiums = engine.get_all_premiums();
+    expect(!premiums.empty() && premiums.front().adverse_move_pct > 0.0, "route exposes its adverse move");
+
+    // Latency recovers
+    for (int i = 0; i < 80; ++i) {
+        engine.get_fill_risk().record_leg_latency(Exchange::Bybit, 40.0);
+    }
+    expect(best_foreign(engine) == Exchange::Bybit, "route returns once the venue is fast again");
+}
+
+}  // namespace
+
+int main() {
+    Logger::init("test_fill_risk", "warn");
+    std::cout << "=== Fill Risk Regression Test ===\n";
+
+    test_variance_and_latency_estimates();
+    test_update_cost();
+    test_ranking_flips_with_leg_latency();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: routes are ranked by premium net of the expected adverse move ***\n";
+    return 0;
+}
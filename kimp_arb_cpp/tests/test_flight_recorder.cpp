@@ -0,0 +1,317 @@
+#include "kimp/core/flight_recorder.hpp"
+#include "kimp/core/logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace kimp;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+const std::string DIR = (std::filesystem::temp_directory_path() / "kimp_flight_test").string();
+const SymbolId BTC("BTC", "KRW");
+
+void configure(uint32_t window_sec, std::size_t events) {
+    FlightRecorderOptions options;
+    options.dir = DIR;
+    options.window_sec = window_sec;
+    options.events_per_thread = events;
+    FlightRecorder::configure(options);
+}
+
+// Events of the calling thread's ring in the latest dump
+const FlightThreadDump* own_thread(const FlightDump& dump) {
+    const auto tid = static_cast<uint32_t>(::syscall(SYS_gettid));
+    for (const auto& t : dump.threads) {
+        if (t.tid == tid) {
+            return &t;
+        }
+    }
+    return nullptr;
+}
+
+bool dump_and_read(const char* reason, FlightDump& dump) {
+    if (!FlightRecorder::dump(reason)) {
+        return false;
+    }
+    std::string error;
+    return read_flight_dump(FlightRecorder::last_dump_path(), dump, &error);
+}
+
+void test_roundtrip() {
+    FlightRecorder::record(FlightEventType::Quote, Exchange::Bithumb, BTC, 0, 100'000.0, 100'100.0, 1.5, 2.5);
+    FlightRecorder::record(FlightEventType::EntryDecision, Exchange::Bithumb, BTC, 42, 0.8, 0.35, 100'100.0, 71.2,
+                           0, 0, Exchange::Bybit);
+    FlightRecorder::record(FlightEventType::LegAck, Exchange::Bybit, BTC, 7, 0.01, 71.2, 850.0, 0.0,
+                           static_cast<uint8_t>(Side::Sell), static_cast<uint8_t>(OrderStatus::Filled));
+    expect(FlightRecorder::thread_ring_capacity() == 1024, "ring rounded up to a power of two");
+
+    const auto before = std::chrono::system_clock::now();
+    FlightDump dump;
+    expect(dump_and_read("hedge mismatch", dump), "dump written and read back");
+    expect(std::string(FlightRecorder::last_dump_path()).find("_hedge_mismatch.bin") != std::string::npos,
+           "reason in the file name");
+    expect(dump.reason == "hedge_mismatch", "reason in the header");
+
+    const auto* own = own_thread(dump);
+    expect(own != nullptr && own->events.size() == 3, "calling thread's events dumped");
+    if (own == nullptr || own->events.size() != 3) {
+        return;
+    }
+    const auto& quote = own->events[0];
+    expect(quote.type == FlightEventType::Quote && quote.v[0] == 100'000.0 && quote.v[3] == 2.5 &&
+           std::strcmp(quote.symbol.data(), "BTC") == 0, "quote fields kept");
+    const auto& entry = own->events[1];
+    expect(entry.id == 42 && entry.counter_exchange == static_cast<uint8_t>(Exchange::Bybit), "entry pair kept");
+    const auto& ack = own->events[2];
+    expect(ack.side == static_cast<uint8_t>(Side::Sell) && ack.flags == static_cast<uint8_t>(OrderStatus::Filled),
+           "leg side and status kept");
+    expect(quote.ticks <= entry.ticks && entry.ticks <= ack.ticks, "per thread order");
+
+    const auto wall = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(dump.event_wall_ns(ack))));
+    expect(wall <= before + std::chrono::milliseconds(50) && wall > before - std::chrono::seconds(2),
+           "ticks converted to wall time");
+
+    const std::string text = format_flight_dump(dump);
+    expect(text.find("reason=hedge_mismatch") != std::string::npos, "decoder header");
+    expect(text.find("ENTRY") != std::string::npos && text.find("vs Bybit") != std::string::npos,
+           "decoder prints decisions");
+    expect(text.find("ack 850us Filled") != std::string::npos, "decoder prints acks");
+}
+
+void test_wrap() {
+    for (uint64_t i = 0; i < 5000; ++i) {
+        FlightRecorder::record(FlightEventType::Quote, Exchange::Upbit, BTC, i, static_cast<double>(i));
+    }
+    FlightDump dump;
+    expect(dump_and_read("wrap", dump), "wrap dump");
+    // The oldest slot is the writer's next one: the reader cannot vouch for it
+    const auto* own = own_thread(dump);
+    expect(own != nullptr && own->events.size() == 1023 && own->overwritten == 1, "full ring dumped after a wrap");
+    if (own == nullptr || own->events.empty()) {
+        return;
+    }
+    bool contiguous = own->events.front().id == 5000 - 1023 && own->events.back().id == 4999;
+    for (std::size_t i = 1; i < own->events.size(); ++i) {
+        contiguous = contiguous && own->events[i].id == own->events[i - 1].id + 1;
+    }
+    expect(contiguous, "newest events kept in order");
+}
+
+void test_window() {
+    configure(1, 1000);  // Reused ring keeps its size; one second window
+    FlightRecorder::record(FlightEventType::Quote, Exchange::Bithumb, BTC, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1200));
+    FlightRecorder::record(FlightEventType::Quote, Exchange::Bithumb, BTC, 2);
+
+    FlightDump dump;
+    expect(dump_and_read("window", dump), "window dump");
+    const auto* own = own_thread(dump);
+    expect(own != nullptr && own->events.size() == 1 && own->events[0].id == 2, "events past the window left out");
+    expect(dump.window_ns == 1'000'000'000ULL, "window in the header");
+    configure(60, 1000);
+}
+
+void test_threads() {
+    std::vector<std::thread> workers;
+    std::atomic<int> recorded{0};
+    for (uint64_t t = 0; t < 4; ++t) {
+        workers.emplace_back([t, &recorded] {
+            pthread_setname_np(pthread_self(), ("flight-" + std::to_string(t)).c_str());
+            for (uint64_t i = 0; i < 100; ++i) {
+                FlightRecorder::record(FlightEventType::LegSubmit, Exchange::OKX, BTC, t * 1000 + i);
+            }
+            // Stay alive until every worker holds a ring, so none is reused mid-test
+            recorded.fetch_add(1);
+            while (recorded.load() < 4) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    FlightDump dump;
+    expect(dump_and_read("threads", dump), "threads dump");
+    int named = 0;
+    for (const auto& t : dump.threads) {
+        if (t.name.rfind("flight-", 0) != 0) {
+            continue;
+        }
+        ++named;
+        const uint64_t base = static_cast<uint64_t>(t.name.back() - '0') * 1000;
+        expect(t.events.size() == 100 && t.events.front().id == base && t.events.back().id == base + 99,
+               "one ring per thread, no interleaving");
+    }
+    expect(named == 4, "exited threads keep their rings until reused");
+
+    // A new thread reuses a released ring instead of growing the registry
+    const std::size_t rings_before = dump.threads.size();
+    std::thread([] {
+        pthread_setname_np(pthread_self(), "flight-reuse");
+        FlightRecorder::record(FlightEventType::Quote, Exchange::OKX, BTC, 1);
+    }).join();
+    expect(dump_and_read("reuse", dump) && dump.threads.size() == rings_before, "released rings reused");
+    int reused = 0;
+    int previous = 0;
+    for (const auto& t : dump.threads) {
+        if (t.name == "flight-reuse") {
+            ++reused;
+            expect(t.events.size() == 1 && t.events.front().id == 1, "reused ring dumps only its new owner's events");
+        } else if (t.name.rfind("flight-", 0) == 0) {
+            ++previous;
+        }
+    }
+    expect(reused == 1 && previous == 3, "the previous owner's events are not shown under the new thread");
+
+    FlightRecorder::set_enabled(false);
+    std::size_t disabled_capacity = 1;
+    std::thread([&] {
+        FlightRecorder::record(FlightEventType::Quote, Exchange::OKX, BTC, 1);
+        disabled_capacity = FlightRecorder::thread_ring_capacity();
+    }).join();
+    FlightRecorder::set_enabled(true);
+    expect(disabled_capacity == 0, "disabled recorder claims nothing");
+}
+
+// Unbounded recursion the optimizer cannot turn into a loop
+[[gnu::noinline]] uint64_t recurse(volatile uint64_t* caller) {
+    volatile uint64_t frame[512];
+    frame[0] = caller != nullptr ? caller[0] + 1 : 1;
+    if (frame[0] == 0) {
+        return 0;  // Never: the depth only grows
+    }
+    return recurse(frame) + frame[0];
+}
+
+void test_signals() {
+    FlightRecorder::install_signal_handlers();
+    FlightRecorder::record(FlightEventType::Quote, Exchange::Bithumb, BTC, 9);
+    std::raise(SIGUSR1);
+    expect(std::string(FlightRecorder::last_dump_path()).find("_sigusr1.bin") != std::string::npos,
+           "SIGUSR1 dumps and the process continues");
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        FlightRecorder::record(FlightEventType::LegFill, Exchange::Bybit, BTC, 77);
+        std::abort();
+    }
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    expect(WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT, "fatal signal still terminates");
+
+    bool found = false;
+    for (const auto& entry : std::filesystem::directory_iterator(DIR)) {
+        FlightDump dump;
+        if (entry.path().filename().string().find("_sigabrt.bin") == std::string::npos ||
+            !read_flight_dump(entry.path().string(), dump)) {
+            continue;
+        }
+        for (const auto& t : dump.threads) {
+            for (const auto& e : t.events) {
+                found = found || (e.type == FlightEventType::LegFill && e.id == 77);
+            }
+        }
+    }
+    expect(found, "fatal signal dump holds the last events");
+
+    // A stack overflow on a worker thread is dumped from its ring's alternate stack
+    const pid_t overflow_child = ::fork();
+    if (overflow_child == 0) {
+        std::thread([] {
+            FlightRecorder::record(FlightEventType::LegAck, Exchange::Upbit, BTC, 88);
+            recurse(nullptr);
+        }).join();
+        std::_Exit(0);
+    }
+    ::waitpid(overflow_child, &status, 0);
+    expect(WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV, "stack overflow still terminates");
+
+    found = false;
+    for (const auto& entry : std::filesystem::directory_iterator(DIR)) {
+        FlightDump dump;
+        if (entry.path().filename().string().find("_sigsegv.bin") == std::string::npos ||
+            !read_flight_dump(entry.path().string(), dump)) {
+            continue;
+        }
+        for (const auto& t : dump.threads) {
+            for (const auto& e : t.events) {
+                found = found || (e.type == FlightEventType::LegAck && e.id == 88);
+            }
+        }
+    }
+    expect(found, "worker thread stack overflow dumps");
+}
+
+void test_reader_errors() {
+    FlightDump dump;
+    std::string error;
+    expect(!read_flight_dump(DIR + "/missing.bin", dump, &error) && !error.empty(), "missing file reported");
+
+    const std::string junk = DIR + "/junk.bin";
+    std::FILE* f = std::fopen(junk.c_str(), "wb");
+    std::fputs("not a flight dump, just some text long enough for a header read", f);
+    std::fclose(f);
+    expect(!read_flight_dump(junk, dump, &error), "bad magic rejected");
+}
+
+void test_cost() {
+    constexpr int N = 2'000'000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < N; ++i) {
+        FlightRecorder::record(FlightEventType::Quote, Exchange::Bithumb, BTC, static_cast<uint64_t>(i),
+                               100.0, 101.0, 1.0, 1.0);
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / N;
+    std::cout << "record(): " << ns << " ns/event\n";
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Flight Recorder Regression Test ===\n";
+    Logger::init("test_flight_recorder", "warn");
+    std::filesystem::remove_all(DIR);
+    configure(60, 1000);
+
+    test_roundtrip();
+    test_wrap();
+    test_window();
+    test_threads();
+    test_signals();
+    test_reader_errors();
+    test_cost();
+
+    std::filesystem::remove_all(DIR);
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: ring wrap, dump/decode round trip, window, per-thread rings, signals ***\n";
+    return 0;
+}
@@ -0,0 +1,246 @@
+#include "kimp/core/logger.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/strategy/fx_estimator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace kimp;
+using namespace kimp::strategy;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+constexpr int64_t MS = 1'000'000;
+
+bool near(double a, double b, double tol = 1e-9) { return std::fabs(a - b) <= tol; }
+
+// Symmetric book around mid with equal sizes on both sides
+UsdtKrwEstimator::Result quote(UsdtKrwEstimator& fx, Exchange ex, double mid, int64_t ts_ns, double qty = 100.0) {
+    return fx.on_quote(ex, mid - 0.5, mid + 0.5, qty, qty, mid, ts_ns);
+}
+
+void test_quote_price() {
+    double weight = 0.0;
+    // Thin ask: microprice leans toward it
+    const double micro = UsdtKrwEstimator::quote_price(1399.0, 1400.0, 300.0, 100.0, 0.0, weight);
+    expect(near(micro, 1399.75) && near(weight, 400.0), "microprice weighted by opposite-side size");
+    expect(near(UsdtKrwEstimator::quote_price(1399.0, 1400.0, 0.0, 0.0, 0.0, weight), 1399.5) && weight == 0.0,
+           "mid without sizes");
+    expect(near(UsdtKrwEstimator::quote_price(0.0, 0.0, 0.0, 0.0, 1398.0, weight), 1398.0),
+           "last trade without a book");
+    expect(UsdtKrwEstimator::quote_price(1400.0, 1399.0, 1.0, 1.0, 0.0, weight) == 0.0,
+           "crossed book without last is unusable");
+}
+
+void test_spike_rejected() {
+    UsdtKrwEstimator fx;
+    for (int i = 0; i < 6; ++i) {
+        quote(fx, i % 2 ? Exchange::Upbit : Exchange::Bithumb, 1400.0, (i + 1) * MS);
+    }
+    expect(near(fx.rate(), 1400.0), "composite seeded");
+
+    // Fat-finger print 3% away from the median
+    const auto spike = quote(fx, Exchange::Upbit, 1442.0, 10 * MS);
+    expect(!spike.accepted && !spike.published, "spike rejected");
+    expect(near(fx.rate(), 1400.0), "published rate unaffected by the spike");
+    expect(fx.venue(Exchange::Upbit, 10 * MS).rejected == 1, "rejection counted on the venue");
+    expect(near(fx.venue(Exchange::Upbit, 10 * MS).price, 1400.0), "venue keeps its last good price");
+
+    // Ordinary move inside the band is accepted
+    const auto move = quote(fx, Exchange::Upbit, 1401.0, 11 * MS);
+    expect(move.accepted && move.published, "in-band move accepted");
+    expect(near(fx.rate(), 1400.5), "equal sizes: composite is the plain average");
+}
+
+void test_level_shift_reseeds() {
+    UsdtKrwEstimator fx;
+    for (int i = 0; i < 8; ++i) {
+        quote(fx, i % 2 ? Exchange::Upbit : Exchange::Bithumb, 1400.0, (i + 1) * MS);
+    }
+    // Both venues agree on a new level 2% higher: accepted once one venue
+    // has reseed_after rejections of its own (Bithumb, quoting first)
+    const uint32_t needed = fx.options().reseed_after;
+    UsdtKrwEstimator::Result r;
+    for (uint32_t i = 0; i + 1 < 2 * needed; ++i) {
+        r = quote(fx, i % 2 ? Exchange::Upbit : Exchange::Bithumb, 1428.0, (20 + i) * MS);
+        expect(i + 2 == 2 * needed ? r.accepted : !r.accepted, "rejected until the streak reseeds");
+    }
+    expect(fx.stats().reseeds == 1, "one reseed");
+    quote(fx, Exchange::Upbit, 1428.0, 40 * MS);
+    quote(fx, Exchange::Bithumb, 1428.2, 41 * MS);
+    expect(near(fx.rate(), 1428.1), "composite follows the new level");
+
+    // An isolated spike between good quotes never builds a streak
+    UsdtKrwEstimator noisy;
+    for (int i = 0; i < 40; ++i) {
+        const double px = i > 3 && i % 3 == 2 ? 1500.0 : 1400.0;
+        quote(noisy, Exchange::Bithumb, px, (i + 1) * MS);
+    }
+    expect(noisy.stats().reseeds == 0 && near(noisy.rate(), 1400.0), "interleaved spikes stay rejected");
+}
+
+void test_one_bad_venue_never_reseeds() {
+    UsdtKrwEstimator fx;
+    for (int i = 0; i < 8; ++i) {
+        quote(fx, i % 2 ? Exchange::Upbit : Exchange::Bithumb, 1400.0, (i + 1) * MS);
+    }
+    // Bithumb's feed sticks 3% high for reseed_after quotes at a time while
+    // Upbit, quoting less often, stays on the real level
+    const uint32_t needed = fx.options().reseed_after;
+    int64_t ts = 10 * MS;
+    for (int round = 0; round < 3; ++round) {
+        for (uint32_t i = 0; i < needed; ++i) {
+            expect(!quote(fx, Exchange::Bithumb, 1442.0, ts += MS).accepted, "bad venue rejected");
+        }
+        expect(quote(fx, Exchange::Upbit, 1400.0, ts += MS).accepted, "good venue accepted");
+    }
+    expect(fx.stats().reseeds == 0, "one venue's streak alone never reseeds");
+    expect(near(fx.rate(), 1400.0), "composite stays on the real level");
+
+    // Once Upbit goes stale, Bithumb is the only fresh venue and its streak reseeds
+    UsdtKrwEstimator::Options options;
+    options.stale_ms = 1000;
+    UsdtKrwEstimator lone(options);
+    for (int i = 0; i < 8; ++i) {
+        quote(lone, i % 2 ? Exchange::Upbit : Exchange::Bithumb, 1400.0, (i + 1) * MS);
+    }
+    UsdtKrwEstimator::Result r;
+    for (uint32_t i = 0; i < needed; ++i) {
+        r = quote(lone, Exchange::Bithumb, 1442.0, (2000 + i) * MS);
+    }
+    expect(r.accepted && lone.stats().reseeds == 1, "sole fresh venue reseeds after its streak");
+}
+
+void test_stale_venue_dropped() {
+    UsdtKrwEstimator::Options options;
+    options.stale_ms = 1000;
+    UsdtKrwEstimator fx(options);
+    quote(fx, Exchange::Bithumb, 1400.0, 1 * MS);
+    quote(fx, Exchange::Upbit, 1402.0, 1 * MS);
+    quote(fx, Exchange::Bithumb, 1400.0, 2 * MS);
+    expect(near(fx.rate(), 1401.0), "both venues fresh");
+
+    // Upbit goes quiet; Bithumb keeps quoting past the stale window
+    quote(fx, Exchange::Bithumb, 1400.2, 900 * MS);
+    expect(near(fx.rate(), 1401.1), "Upbit still inside the window");
+    quote(fx, Exchange::Bithumb, 1400.4, 1500 * MS);
+    expect(!fx.venue(Exchange::Upbit, 1500 * MS).fresh, "Upbit marked stale");
+    expect(near(fx.rate(), 1400.4), "stale venue leaves the composite");
+
+    quote(fx, Exchange::Upbit, 1402.4, 1600 * MS);
+    expect(fx.venue(Exchange::Upbit, 1600 * MS).fresh && near(fx.rate(), 1401.4), "venue rejoins on its next quote");
+}
+
+void test_epsilon_suppression() {
+    UsdtKrwEstimator::Options options;
+    options.epsilon_bps = 1.0;  // 0.14 KRW at 1400
+    UsdtKrwEstimator fx(options);
+    expect(quote(fx, Exchange::Bithumb, 1400.0, MS).published, "first quote publishes");
+
+    const auto small = quote(fx, Exchange::Bithumb, 1400.1, 2 * MS);
+    expect(small.accepted && !small.published && near(fx.rate(), 1400.0), "sub-epsilon move suppressed");
+    const auto big = quote(fx, Exchange::Bithumb, 1400.2, 3 * MS);
+    expect(big.published && near(fx.rate(), 1400.2), "move past epsilon republished");
+    expect(fx.stats().published == 2 && fx.stats().suppressed == 1, "publish/suppress counters");
+}
+
+void test_size_weighting() {
+    UsdtKrwEstimator fx;
+    fx.on_quote(Exchange::Bithumb, 1399.5, 1400.5, 300.0, 300.0, 0.0, MS);  // 600 resting
+    fx.on_quote(Exchange::Upbit, 1401.5, 1402.5, 100.0, 100.0, 0.0, MS);    // 200 resting
+    expect(near(fx.rate(), (1400.0 * 600.0 + 1402.0 * 200.0) / 800.0), "deeper book weighs more");
+
+    // A venue without sizes switches the composite to equal weights
+    fx.on_quote(Exchange::Upbit, 1401.5, 1402.5, 0.0, 0.0, 0.0, 2 * MS);
+    expect(near(fx.rate(), 1401.0), "equal weights when a venue lacks sizes");
+}
+
+void test_update_cost() {
+    UsdtKrwEstimator::Options options;
+    options.epsilon_bps = 0.0;  // Publish every time: the expensive path
+    UsdtKrwEstimator fx(options);
+    constexpr int N = 1'000'000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < N; ++i) {
+        const double mid = 1400.0 + (i % 7) * 0.1;
+        fx.on_quote(i & 1 ? Exchange::Upbit : Exchange::Bithumb, mid - 0.5, mid + 0.5, 50.0 + (i % 5), 60.0, mid,
+                    (i + 1) * MS);
+    }
+    const double ns_per_update = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - t0).count() / N;
+    std::cout << "on_quote: " << ns_per_update << " ns/update\n";
+}
+
+Ticker usdt_ticker(Exchange ex, double mid, std::chrono::steady_clock::time_point ts) {
+    Ticker t;
+    t.exchange = ex;
+    t.symbol = SymbolId("USDT", "KRW");
+    t.timestamp = ts;
+    t.bid = mid - 0.5;
+    t.ask = mid + 0.5;
+    t.last = mid;
+    t.bid_qty = 1'000.0;
+    t.ask_qty = 1'000.0;
+    return t;
+}
+
+void test_engine_publishes_composite() {
+    ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Bithumb, Exchange::Bybit);
+    engine.add_exchange_pair(Exchange::Upbit, Exchange::Bybit);
+    const auto now = std::chrono::steady_clock::now();
+
+    engine.on_ticker_update(usdt_ticker(Exchange::Bithumb, 1400.0, now));
+    engine.on_ticker_update(usdt_ticker(Exchange::Upbit, 1402.0, now));
+    const auto& cache = engine.get_price_cache();
+    expect(near(cache.get_usdt_krw(Exchange::Bithumb), 1401.0) && near(cache.get_usdt_krw(Exchange::Upbit), 1401.0),
+           "both Korean venues convert at the composite");
+
+    for (int i = 0; i < 4; ++i) {
+        engine.on_ticker_update(usdt_ticker(i % 2 ? Exchange::Upbit : Exchange::Bithumb, 1401.0,
+                                            now + std::chrono::milliseconds(i + 1)));
+    }
+    const uint64_t seq = engine.get_update_seq();
+    engine.on_ticker_update(usdt_ticker(Exchange::Upbit, 1480.0, now + std::chrono::milliseconds(10)));
+    expect(near(cache.get_usdt_krw(Exchange::Upbit), 1401.0), "spike never reaches the price cache");
+    expect(engine.get_update_seq() == seq, "rejected quote does not trigger a full recompute");
+
+    expect(!engine.on_usdt_update(Exchange::Bithumb, 1401.01), "manual update below epsilon is suppressed");
+    expect(engine.on_usdt_update(Exchange::Bithumb, 1403.0), "manual update past epsilon publishes");
+    expect(engine.get_usdt_estimator().stats().rejected == 1, "engine estimator counted the spike");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== USDT/KRW Composite Estimator Regression Test ===\n";
+    Logger::init("test_fx_estimator", "warn");
+
+    test_quote_price();
+    test_spike_rejected();
+    test_level_shift_reseeds();
+    test_one_bad_venue_never_reseeds();
+    test_stale_venue_dropped();
+    test_epsilon_suppression();
+    test_size_weighting();
+    test_update_cost();
+    test_engine_publishes_composite();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: microprice, median outlier rejection, staleness, epsilon gating, engine wiring ***\n";
+    return 0;
+}
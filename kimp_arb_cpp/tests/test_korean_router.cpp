@@ -0,0 +1,218 @@
+#include "test_paper_common.hpp"
+
+#include "kimp/core/logger.hpp"
+#include "kimp/execution/korean_router.hpp"
+#include "kimp/execution/order_manager.hpp"
+
+#include <boost/asio.hpp>
+
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+using namespace paper_test;
+
+namespace {
+
+namespace net = boost::asio;
+
+constexpr double BITHUMB_FEE = TradingConfig::BITHUMB_FEE_RATE;
+constexpr double UPBIT_FEE = TradingConfig::UPBIT_FEE_RATE;
+
+KoreanLegRouter::VenueBook venue(Exchange ex, const std::vector<OrderBookLevel>& levels,
+                                 double cap = std::numeric_limits<double>::infinity()) {
+    return {ex, levels.data(), levels.size(), TradingConfig::get_korean_fee_rate(ex), cap};
+}
+
+void test_split_beats_single_venue() {
+    // Thin Bithumb top, then a gap; Upbit deep one tick above the Bithumb top
+    const std::vector<OrderBookLevel> bithumb_asks{{10000.0, 1.0}, {10100.0, 50.0}};
+    const std::vector<OrderBookLevel> upbit_asks{{10010.0, 3.0}, {10200.0, 50.0}};
+
+    const auto route = KoreanLegRouter::plan(venue(Exchange::Bithumb, bithumb_asks),
+                                             venue(Exchange::Upbit, upbit_asks), 5.0, true);
+    expect(route.split(), "buy split across both venues");
+    expect(near(route.legs[0].quantity, 2.0) && near(route.legs[1].quantity, 3.0),
+           "each venue takes its cheaper depth");
+    const double expected = (10000.0 + 10100.0) * (1.0 + BITHUMB_FEE) + 3.0 * 10010.0 * (1.0 + UPBIT_FEE);
+    const double single = (10000.0 + 4.0 * 10100.0) * (1.0 + BITHUMB_FEE);
+    expect(near(route.total_krw, expected), "routed cost includes each venue's fee");
+    expect(near(route.single_venue_krw, single), "single-venue cost walks the primary alone");
+    expect(route.gain_krw() > 200.0, "split saves against the primary alone");
+    expect(route.beyond_depth == 0.0 && near(route.legs[1].worst_price, 10010.0), "inside visible depth");
+    std::cout << "  5 coins: single " << single << " KRW, split " << route.total_krw << " KRW, saves "
+              << route.gain_krw() << " KRW\n";
+
+    // Past both books the remainder goes to the primary at its last level
+    const auto deep = KoreanLegRouter::plan(venue(Exchange::Bithumb, bithumb_asks),
+                                            venue(Exchange::Upbit, upbit_asks), 110.0, true);
+    expect(near(deep.quantity(), 110.0) && near(deep.beyond_depth, 6.0), "beyond-depth remainder priced");
+}
+
+void test_fee_aware_ties() {
+    // Same raw price: the lower-fee venue wins, an exact tie stays on the primary
+    const std::vector<OrderBookLevel> asks{{10000.0, 10.0}};
+    const auto route = KoreanLegRouter::plan(venue(Exchange::Upbit, asks), venue(Exchange::Bithumb, asks), 4.0, true);
+    expect(near(route.legs[1].quantity, 4.0) && !route.split(), "cheaper fee venue takes the whole leg");
+    expect(near(route.gain_krw(), 4.0 * 10000.0 * (UPBIT_FEE - BITHUMB_FEE)), "gain is the fee difference");
+
+    auto same = venue(Exchange::Bithumb, asks);
+    const auto tie = KoreanLegRouter::plan(same, same, 4.0, true);
+    expect(near(tie.legs[0].quantity, 4.0) && tie.gain_krw() == 0.0, "exact tie stays on the primary");
+}
+
+void test_min_child_folded() {
+    // Upbit's better price covers a dust amount below the venue minimum
+    const std::vector<OrderBookLevel> bithumb_asks{{10000.0, 10.0}};
+    const std::vector<OrderBookLevel> upbit_asks{{9990.0, 0.2}, {10050.0, 10.0}};
+    const auto route = KoreanLegRouter::plan(venue(Exchange::Bithumb, bithumb_asks),
+                                             venue(Exchange::Upbit, upbit_asks), 3.0, true);
+    expect(!route.split() && near(route.legs[0].quantity, 3.0), "dust child folded into the primary");
+
+    const auto open = KoreanLegRouter::plan(venue(Exchange::Bithumb, bithumb_asks),
+                                            venue(Exchange::Upbit, upbit_asks), 3.0, true, 0.0);
+    expect(open.split() && near(open.legs[1].quantity, 0.2), "no minimum: the dust child is kept");
+}
+
+void test_sell_caps() {
+    // Upbit bids better, but only 3 coins are held there
+    const std::vector<OrderBookLevel> bithumb_bids{{10000.0, 20.0}};
+    const std::vector<OrderBookLevel> upbit_bids{{10050.0, 20.0}};
+    const auto route = KoreanLegRouter::plan(venue(Exchange::Bithumb, bithumb_bids, 6.0),
+                                             venue(Exchange::Upbit, upbit_bids, 3.0), 5.0, false);
+    expect(near(route.legs[1].quantity, 3.0) && near(route.legs[0].quantity, 2.0), "sell bounded by inventory");
+    expect(near(route.total_krw, 2.0 * 10000.0 * (1.0 - BITHUMB_FEE) + 3.0 * 10050.0 * (1.0 - UPBIT_FEE)),
+           "proceeds net of fees");
+    expect(route.gain_krw() > 0.0, "sell gain is proceeds over the primary alone");
+
+    const auto short_inventory = KoreanLegRouter::plan(venue(Exchange::Bithumb, bithumb_bids, 1.0),
+                                                       venue(Exchange::Upbit, upbit_bids, 1.0), 5.0, false);
+    expect(near(short_inventory.quantity(), 2.0), "cannot sell more than held on both venues");
+
+    const auto blind = KoreanLegRouter::inventory_split(Exchange::Bithumb, Exchange::Upbit, 5.0, 6.0, 3.0);
+    expect(near(blind.legs[1].quantity, 3.0) && near(blind.legs[0].quantity, 2.0),
+           "without depth the other venue is drained first");
+
+    // Excess of a 10-coin split (7 primary, 3 other venue) sold back where it landed
+    const auto excess = KoreanLegRouter::proportional_split(Exchange::Bithumb, Exchange::Upbit, 4.0, 7.0, 3.0);
+    expect(near(excess.legs[0].quantity, 2.8) && near(excess.legs[1].quantity, 1.2),
+           "flatten split in proportion to each venue's share");
+    const auto small = KoreanLegRouter::proportional_split(Exchange::Bithumb, Exchange::Upbit, 4.0, 7.0, 3.0, 1.5);
+    expect(near(small.legs[0].quantity, 4.0) && small.legs[1].quantity == 0.0,
+           "sub-minimum child joins the venue that holds enough");
+    const auto lopsided = KoreanLegRouter::proportional_split(Exchange::Bithumb, Exchange::Upbit, 4.0, 1.0, 9.0, 1.5);
+    expect(near(lopsided.legs[1].quantity, 4.0) && lopsided.legs[0].quantity == 0.0,
+           "either venue can take the folded child");
+    const auto neither = KoreanLegRouter::proportional_split(Exchange::Bithumb, Exchange::Upbit, 4.0, 2.0, 2.0, 2.5);
+    expect(near(neither.legs[0].quantity, 2.0) && near(neither.legs[1].quantity, 2.0),
+           "never more than a venue holds");
+}
+
+void test_live_books() {
+    const SymbolId symbol("XRP", "KRW");
+    KoreanLegRouter router;
+    router.on_orderbook(make_book(Exchange::Bithumb, symbol, {{999.0, 10.0}}, {{1000.0, 10.0}}));
+    expect(!router.route(Exchange::Bithumb, symbol, 5.0, true), "one book alone is not routed");
+
+    auto stale = make_book(Exchange::Upbit, symbol, {{999.0, 10.0}}, {{1000.0, 40.0}, {1000.3, 40.0}});
+    stale.timestamp -= std::chrono::seconds(5);
+    router.on_orderbook(stale);
+    expect(!router.route(Exchange::Bithumb, symbol, 5.0, true), "stale book is not routed");
+    expect(router.secondary_top_ask_qty(Exchange::Bithumb, symbol, 1000.0) == 0.0, "stale depth adds nothing");
+
+    router.on_orderbook(make_book(Exchange::Upbit, symbol, {{999.0, 10.0}}, {{1000.0, 40.0}, {1000.3, 40.0}}));
+    router.on_orderbook(make_book(Exchange::Bybit, SymbolId("XRP", "USDT"), {{0.7, 10.0}}, {{0.71, 10.0}}));
+    const auto route = router.route(Exchange::Bithumb, symbol, 15.0, true);
+    expect(route && route->split() && near(route->quantity(), 15.0), "fresh books route the full size");
+    // Upbit's 1000.0 is 1 bp worse after fees, 1000.3 is 4 bps worse: both inside the 5 bp gap
+    expect(near(router.secondary_top_ask_qty(Exchange::Bithumb, symbol, 1000.0), 80.0),
+           "other venue's asks inside the gap count as depth");
+    expect(near(router.secondary_top_ask_qty(Exchange::Upbit, symbol, 1000.0), 10.0), "works from either side");
+}
+
+void test_order_manager_split_exit() {
+    net::io_context ioc;
+    auto bithumb = std::make_shared<GuardBithumbExchange>(ioc);
+    auto upbit = std::make_shared<GuardUpbitExchange>(ioc);
+    auto bybit = std::make_shared<GuardBybitExchange>(ioc);
+
+    const SymbolId symbol("BTC", "KRW");
+    auto bithumb_book = make_book(Exchange::Bithumb, symbol, {{13100.0, 100.0}}, {{13110.0, 100.0}});
+    auto upbit_book = make_book(Exchange::Upbit, symbol, {{13150.0, 100.0}}, {{13160.0, 100.0}});
+    auto paper = std::make_shared<PaperExecution>(nullptr, paper_options(11));
+    auto router = std::make_shared<KoreanLegRouter>();
+    for (const auto& book : {bithumb_book, upbit_book}) {
+        paper->on_orderbook(book);
+        router->on_orderbook(book);
+    }
+    paper->on_orderbook(make_book(Exchange::Bybit, SymbolId("BTC", "USDT"), {{9.4, 100.0}}, {{9.5, 100.0}}));
+
+    OrderManager manager;
+    manager.set_exchange(Exchange::Bithumb, bithumb);
+    manager.set_exchange(Exchange::Upbit, upbit);
+    manager.set_exchange(Exchange::Bybit, bybit);
+    manager.set_execution_backend(paper);
+    manager.set_korean_router(router);
+
+    // 10 coins on the Korean side: 6 on Bithumb, 4 bought on Upbit by a split entry
+    Position position;
+    position.symbol = symbol;
+    position.korean_exchange = Exchange::Bithumb;
+    position.foreign_exchange = Exchange::Bybit;
+    position.korean_amount = 10.0;
+    position.korean_split_amount = 4.0;
+    position.foreign_amount = 10.0;
+    position.korean_entry_price = 10000.0;
+    position.foreign_entry_price = 10.0;
+    position.position_size_usd = 100.0;
+    position.is_active = true;
+    paper->seed_position(position);
+    expect(near(paper->balance(Exchange::Upbit, "BTC"), 4.0) && near(paper->balance(Exchange::Bithumb, "BTC"), 6.0),
+           "seeded holdings follow the split");
+
+    ExitSignal signal;
+    signal.symbol = symbol;
+    signal.korean_exchange = position.korean_exchange;
+    signal.foreign_exchange = position.foreign_exchange;
+    signal.premium = 0.7692307692;
+    signal.korean_bid = 13100.0;
+    signal.foreign_ask = 10.0;
+    signal.usdt_krw_rate = 1300.0;
+
+    const auto result = manager.execute_spot_relay_exit(signal, position);
+    const double korean_proceeds = 6.0 * 13100.0 + 4.0 * 13150.0;
+    const double expected_pnl = korean_proceeds - 10.0 * 10000.0 + (10.0 - 9.5) * 1300.0 * 10.0;
+
+    expect(result.success && !result.position.is_active, "split exit closes the position");
+    expect(near(result.position.realized_pnl_krw, expected_pnl), "one Korean leg at the children's VWAP");
+    expect(near(paper->balance(Exchange::Bithumb, "BTC"), 0.0) && near(paper->balance(Exchange::Upbit, "BTC"), 0.0),
+           "each venue sold what it held");
+    expect(near(paper->balance(Exchange::Bybit, "BTC"), 0.0), "short covered");
+    expect(paper->stats().rejected == 0, "no child oversold its venue");
+    expect(bithumb->calls == 0 && upbit->calls == 0 && bybit->calls == 0, "no real order reached the venues");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Korean Split-Leg Routing Regression Test ===\n";
+    Logger::init("test_korean_router", "warn");
+
+    test_split_beats_single_venue();
+    test_fee_aware_ties();
+    test_min_child_folded();
+    test_sell_caps();
+    test_live_books();
+    test_order_manager_split_exit();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: depth-merged split, fee awareness, dust folding, inventory caps, split exit ***\n";
+    return 0;
+}
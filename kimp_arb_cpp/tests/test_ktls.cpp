@@ -0,0 +1,279 @@
+#include "kimp/network/ktls.hpp"
+#include "kimp/network/tls_stream.hpp"
+#include "test_tls_loopback_common.hpp"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <openssl/bio.h>
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace kimp::network;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Client and server over an in-memory BIO pair, handshake driven to completion
+struct MemorySession {
+    SSL_CTX* client_ctx{nullptr};
+    SSL* client{nullptr};
+    SSL* server{nullptr};
+    BIO* client_bio{nullptr};
+    BIO* server_bio{nullptr};
+    bool established{false};
+
+    MemorySession(SSL_CTX* server_ctx, bool prepare_client) {
+        client_ctx = SSL_CTX_new(TLS_client_method());
+        SSL_CTX_set_verify(client_ctx, SSL_VERIFY_NONE, nullptr);
+        if (prepare_client) {
+            ktls::prepare(client_ctx);
+        }
+        ktls::prepare(server_ctx);
+        client = SSL_new(client_ctx);
+        server = SSL_new(server_ctx);
+        BIO_new_bio_pair(&client_bio, 0, &server_bio, 0);
+        SSL_set_bio(client, client_bio, client_bio);
+        SSL_set_bio(server, server_bio, server_bio);
+        SSL_set_connect_state(client);
+        SSL_set_accept_state(server);
+
+        bool client_done = false;
+        bool server_done = false;
+        for (int round = 0; round < 32 && !(client_done && server_done); ++round) {
+            if (!client_done) client_done = SSL_do_handshake(client) == 1;
+            if (!server_done) server_done = SSL_do_handshake(server) == 1;
+        }
+        established = client_done && server_done;
+    }
+
+    ~MemorySession() {
+        SSL_free(client);
+        SSL_free(server);
+        SSL_CTX_free(client_ctx);
+    }
+};
+
+bool keys_equal(const ktls::TrafficKeys& a, const ktls::TrafficKeys& b) {
+    return a.cipher_type == b.cipher_type && a.key_len == b.key_len && a.key == b.key && a.iv == b.iv &&
+           a.sequence == b.sequence;
+}
+
+// Open one TLS 1.3 application record with the derived keys (seq 0)
+bool decrypt_record(const ktls::TrafficKeys& keys, const EVP_CIPHER* cipher, const std::vector<uint8_t>& record,
+                    std::string& plaintext) {
+    constexpr std::size_t HEADER = 5;
+    constexpr std::size_t TAG = 16;
+    if (record.size() < HEADER + TAG || record[0] != 0x17) {
+        return false;
+    }
+    const std::size_t body = (static_cast<std::size_t>(record[3]) << 8) | record[4];
+    if (record.size() < HEADER + body || body < TAG) {
+        return false;
+    }
+    const std::size_t cipher_len = body - TAG;
+
+    EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+    std::vector<uint8_t> out(cipher_len);
+    int len = 0;
+    int final_len = 0;
+    const bool ok =
+        EVP_DecryptInit_ex(ctx, cipher, nullptr, keys.key.data(), keys.iv.data()) == 1 &&  // iv ^ seq(0)
+        EVP_DecryptUpdate(ctx, nullptr, &len, record.data(), HEADER) == 1 &&
+        EVP_DecryptUpdate(ctx, out.data(), &len, record.data() + HEADER, static_cast<int>(cipher_len)) == 1 &&
+        EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, TAG,
+                            const_cast<uint8_t*>(record.data() + HEADER + cipher_len)) == 1 &&
+        EVP_DecryptFinal_ex(ctx, out.data() + len, &final_len) == 1;
+    EVP_CIPHER_CTX_free(ctx);
+    if (!ok || out.empty() || out.back() != 0x17) {  // Inner content type: application_data
+        return false;
+    }
+    plaintext.assign(out.begin(), out.end() - 1);
+    return true;
+}
+
+void test_key_derivation_matches_openssl() {
+    struct Suite {
+        const char* name;
+        const EVP_CIPHER* cipher;
+        std::size_t key_len;
+    };
+    const std::array<Suite, 3> suites{{
+        {"TLS_AES_128_GCM_SHA256", EVP_aes_128_gcm(), 16},
+        {"TLS_AES_256_GCM_SHA384", EVP_aes_256_gcm(), 32},
+        {"TLS_CHACHA20_POLY1305_SHA256", EVP_chacha20_poly1305(), 32},
+    }};
+
+    for (const Suite& suite : suites) {
+        auto server_ctx = tls_loopback::make_server_context(suite.name);
+        MemorySession session(server_ctx.get(), true);
+        expect(session.established, "in-memory TLS 1.3 handshake");
+        if (!session.established) continue;
+
+        ktls::TrafficKeys client_tx;
+        ktls::TrafficKeys client_rx;
+        ktls::TrafficKeys server_tx;
+        ktls::TrafficKeys server_rx;
+        const char* reason = "";
+        expect(ktls::derive_keys(session.client, true, client_tx, &reason), "client tx keys derived");
+        expect(ktls::derive_keys(session.client, false, client_rx, &reason), "client rx keys derived");
+        expect(ktls::derive_keys(session.server, true, server_tx, &reason), "server tx keys derived");
+        expect(ktls::derive_keys(session.server, false, server_rx, &reason), "server rx keys derived");
+        expect(client_tx.key_len == suite.key_len, "key length follows the suite");
+        expect(keys_equal(client_tx, server_rx), "client write keys are server read keys");
+        expect(keys_equal(client_rx, server_tx), "server write keys are client read keys");
+        expect(!keys_equal(client_tx, client_rx), "directions use distinct keys");
+
+        // Drain tickets the server queued, then seal one record on the client
+        char scratch[4096];
+        while (SSL_read(session.client, scratch, sizeof(scratch)) > 0) {}
+        expect(SSL_write(session.client, "hello", 5) == 5, "client wrote a record");
+        std::vector<uint8_t> record(static_cast<std::size_t>(BIO_ctrl_pending(session.server_bio)));
+        BIO_read(session.server_bio, record.data(), static_cast<int>(record.size()));
+
+        std::string plaintext;
+        expect(decrypt_record(client_tx, suite.cipher, record, plaintext), "derived keys open the record");
+        expect(plaintext == "hello", "record plaintext recovered");
+    }
+}
+
+void test_derivation_refusals() {
+    {
+        auto server_ctx = tls_loopback::make_server_context(nullptr, true);
+        MemorySession session(server_ctx.get(), true);
+        expect(session.established, "in-memory TLS 1.2 handshake");
+        ktls::TrafficKeys keys;
+        const char* reason = "";
+        expect(!ktls::derive_keys(session.client, true, keys, &reason), "TLS 1.2 refused");
+        expect(std::strstr(reason, "TLS 1.2") != nullptr, "TLS 1.2 reason reported");
+
+        ktls::set_enabled(true);
+        const auto before = ktls::counters().fallback;
+        const ktls::Status status = ktls::offload(session.client, -1);
+        expect(!status.tx && !status.rx && status.reason[0] != '\0', "TLS 1.2 offload falls back with a reason");
+        expect(ktls::counters().fallback == before + 1, "fallback counted");
+        ktls::set_enabled(false);
+    }
+    {
+        auto server_ctx = tls_loopback::make_server_context();
+        MemorySession session(server_ctx.get(), false);
+        ktls::TrafficKeys keys;
+        const char* reason = "";
+        expect(!ktls::derive_keys(session.client, true, keys, &reason), "unprepared context refused");
+        expect(std::strstr(reason, "not captured") != nullptr, "missing secret reason reported");
+    }
+    {
+        auto server_ctx = tls_loopback::make_server_context();
+        MemorySession session(server_ctx.get(), true);
+        const ktls::Status status = ktls::offload(session.client, -1);
+        expect(!status.tx && !status.rx && std::strcmp(status.reason, "disabled") == 0, "disabled mode is a no-op");
+    }
+}
+
+// Length-prefixed echo server
+void echo_session(SSL* ssl) {
+    for (;;) {
+        uint32_t len = 0;
+        if (!tls_loopback::read_exact(ssl, &len, sizeof(len))) return;
+        std::string payload(len, '\0');
+        if (!tls_loopback::read_exact(ssl, payload.data(), len)) return;
+        if (!tls_loopback::write_all(ssl, &len, sizeof(len)) ||
+            !tls_loopback::write_all(ssl, payload.data(), len)) return;
+    }
+}
+
+std::string frame(const std::string& payload) {
+    const uint32_t len = static_cast<uint32_t>(payload.size());
+    std::string out(reinterpret_cast<const char*>(&len), sizeof(len));
+    return out + payload;
+}
+
+void test_socket_echo(bool request_ktls) {
+    ktls::set_enabled(request_ktls);
+    tls_loopback::Server server(tls_loopback::make_server_context(), echo_session);
+
+    boost::asio::io_context ioc;
+    boost::asio::ssl::context ctx(boost::asio::ssl::context::tls_client);
+    ctx.set_verify_mode(boost::asio::ssl::verify_none);
+    if (ktls::enabled()) {
+        ktls::prepare(ctx.native_handle());
+    }
+
+    TlsStream stream(ioc, ctx);
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), server.port());
+    stream.tcp().connect(endpoint);
+    stream.handshake(boost::asio::ssl::stream_base::client);
+
+    const ktls::Status status = stream.try_ktls_offload();
+    if (!request_ktls) {
+        expect(!status.tx && !status.rx, "no offload when disabled");
+    } else if (!status.offloaded()) {
+        expect(status.reason[0] != '\0', "fallback carries a reason");
+        std::cout << "  kTLS fell back: " << status.reason << "\n";
+    } else {
+        std::cout << "  kTLS offload active\n";
+    }
+    expect(stream.ktls_tx() == status.tx && stream.ktls_rx() == status.rx, "stream follows offload status");
+
+    // Sync path (REST)
+    const std::string message = "{\"op\":\"ping\",\"seq\":1}";
+    boost::beast::error_code ec;
+    boost::asio::write(stream, boost::asio::buffer(frame(message)), ec);
+    expect(!ec, "sync write");
+    std::string reply(sizeof(uint32_t) + message.size(), '\0');
+    boost::asio::read(stream, boost::asio::buffer(reply), ec);
+    expect(!ec && reply.substr(sizeof(uint32_t)) == message, "sync echo");
+
+    // Async path (WebSocket), large enough to span several records
+    const std::string bulk(40000, 'x');
+    const std::string framed = frame(bulk);
+    std::string bulk_reply(framed.size(), '\0');
+    bool wrote = false;
+    bool read = false;
+    boost::asio::async_write(stream, boost::asio::buffer(framed),
+                             [&](boost::beast::error_code e, std::size_t) { wrote = !e; });
+    boost::asio::async_read(stream, boost::asio::buffer(bulk_reply),
+                            [&](boost::beast::error_code e, std::size_t) { read = !e; });
+    ioc.run();
+    expect(wrote && read, "async write and read complete");
+    expect(bulk_reply == framed, "async echo spans records intact");
+
+    stream.shutdown(ec);
+    stream.tcp().close();
+    ktls::set_enabled(false);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Kernel TLS Offload Regression Test ===\n";
+    std::cout << "kernel tls ULP " << (ktls::kernel_available() ? "available" : "not loaded (fallback path)")
+              << "\n";
+
+    test_key_derivation_matches_openssl();
+    test_derivation_refusals();
+    test_socket_echo(false);
+    test_socket_echo(true);
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: key derivation, refusals, offload/fallback echo over loopback TLS ***\n";
+    return 0;
+}
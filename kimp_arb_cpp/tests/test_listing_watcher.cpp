@@ -0,0 +1,325 @@
+#include "kimp/core/logger.hpp"
+#include "kimp/memory/grow_only_map.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/strategy/listing_watcher.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::strategy;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Stand-in venue: a market list the test edits mid-run
+struct FakeVenue {
+    std::mutex mutex;
+    std::vector<std::string> bases;
+    const char* quote{"KRW"};
+    bool failing{false};
+
+    std::vector<SymbolId> markets() {
+        std::lock_guard lock(mutex);
+        std::vector<SymbolId> out;
+        if (failing) {
+            return out;
+        }
+        for (const auto& base : bases) {
+            out.emplace_back(base, quote);
+        }
+        return out;
+    }
+    void list(const std::string& base) {
+        std::lock_guard lock(mutex);
+        bases.push_back(base);
+    }
+    void delist(const std::string& base) {
+        std::lock_guard lock(mutex);
+        bases.erase(std::remove(bases.begin(), bases.end(), base), bases.end());
+    }
+};
+
+bool has(const std::vector<Exchange>& venues, Exchange ex) {
+    return std::find(venues.begin(), venues.end(), ex) != venues.end();
+}
+
+void test_watcher() {
+    FakeVenue bithumb{{}, {"BTC", "XRP"}, "KRW"};
+    FakeVenue upbit{{}, {"BTC"}, "KRW"};
+    FakeVenue bybit{{}, {"BTC", "XRP"}, "USDT"};
+    FakeVenue okx{{}, {"BTC"}, "USDT"};
+
+    ListingWatcher watcher;
+    watcher.add_venue(Exchange::Bithumb, [&] { return bithumb.markets(); });
+    watcher.add_venue(Exchange::Upbit, [&] { return upbit.markets(); });
+    watcher.add_venue(Exchange::Bybit, [&] { return bybit.markets(); });
+    watcher.add_venue(Exchange::OKX, [&] { return okx.markets(); });
+    watcher.seed(Exchange::Bithumb, bithumb.markets());
+    watcher.seed(Exchange::Upbit, upbit.markets());
+    watcher.seed(Exchange::Bybit, bybit.markets());
+    watcher.seed(Exchange::OKX, okx.markets());
+
+    expect(watcher.is_monitored("BTC") && watcher.is_monitored("XRP"), "startup overlap monitored");
+    expect(watcher.poll().empty(), "nothing new after the startup lists");
+
+    bithumb.list("NEWC");
+    expect(watcher.poll().empty(), "Korean-only listing waits for a hedge venue");
+
+    bybit.failing = true;
+    expect(watcher.poll().empty(), "failed fetch reports nothing");
+    expect(watcher.venue_market_count(Exchange::Bybit) == 2, "failed fetch keeps the last list");
+
+    bybit.failing = false;
+    bybit.list("NEWC");
+    auto listings = watcher.poll();
+    expect(listings.size() == 1, "hedge venue listing completes the pair");
+    if (listings.size() == 1) {
+        const auto& l = listings[0];
+        expect(l.symbol == SymbolId("NEWC", "KRW") && l.new_symbol, "new symbol keyed BASE/KRW");
+        expect(l.korean_venues == std::vector<Exchange>{Exchange::Bithumb} &&
+               l.foreign_venues == std::vector<Exchange>{Exchange::Bybit}, "carriers reported");
+    }
+    expect(watcher.poll().empty(), "reported once");
+
+    // Known coin on another venue, plus a coin listed on both sides in one poll
+    okx.list("NEWC");
+    upbit.list("SAME");
+    okx.list("SAME");
+    listings = watcher.poll();
+    expect(listings.size() == 2, "venue extension and same-poll pair");
+    if (listings.size() == 2) {
+        expect(listings[0].symbol == SymbolId("NEWC", "KRW") && !listings[0].new_symbol &&
+               listings[0].korean_venues.empty() &&
+               listings[0].foreign_venues == std::vector<Exchange>{Exchange::OKX},
+               "only the new venue reported for a monitored coin");
+        expect(listings[1].symbol == SymbolId("SAME", "KRW") && listings[1].new_symbol &&
+               has(listings[1].korean_venues, Exchange::Upbit) && has(listings[1].foreign_venues, Exchange::OKX),
+               "listed on both sides at once");
+    }
+
+    bithumb.delist("XRP");
+    expect(watcher.poll().empty(), "suspension is not a listing");
+    bithumb.list("XRP");
+    expect(watcher.poll().empty(), "relisting after a suspension is not reported again");
+
+    // A venue without a startup list takes its first fetch as the baseline
+    FakeVenue late{{}, {"BTC", "ETH"}, "USDT"};
+    ListingWatcher fresh;
+    fresh.add_venue(Exchange::Bithumb, [&] { return bithumb.markets(); });
+    fresh.add_venue(Exchange::Bybit, [&] { return late.markets(); });
+    expect(fresh.poll().empty(), "first fetch is a baseline");
+    late.list("XRP");
+    listings = fresh.poll();
+    expect(listings.size() == 1 && listings[0].symbol == SymbolId("XRP", "KRW"), "diffed after the baseline");
+}
+
+// A listing whose setup failed is reported again until it is added
+void test_retry() {
+    FakeVenue bithumb{{}, {"BTC"}, "KRW"};
+    FakeVenue upbit{{}, {"BTC"}, "KRW"};
+    FakeVenue bybit{{}, {"BTC"}, "USDT"};
+    FakeVenue okx{{}, {"BTC"}, "USDT"};
+    ListingWatcher watcher;
+    watcher.add_venue(Exchange::Bithumb, [&] { return bithumb.markets(); });
+    watcher.add_venue(Exchange::Upbit, [&] { return upbit.markets(); });
+    watcher.add_venue(Exchange::Bybit, [&] { return bybit.markets(); });
+    watcher.add_venue(Exchange::OKX, [&] { return okx.markets(); });
+    watcher.seed(Exchange::Bithumb, bithumb.markets());
+    watcher.seed(Exchange::Upbit, upbit.markets());
+    watcher.seed(Exchange::Bybit, bybit.markets());
+    watcher.seed(Exchange::OKX, okx.markets());
+
+    bithumb.list("NEWC");
+    bybit.list("NEWC");
+    auto listings = watcher.poll();
+    expect(listings.size() == 1 && listings[0].new_symbol, "new listing reported");
+    if (listings.size() != 1) {
+        return;
+    }
+    watcher.retry(listings[0]);  // Margin setup failed
+    expect(!watcher.is_monitored("NEWC"), "failed symbol not monitored");
+    listings = watcher.poll();
+    expect(listings.size() == 1 && listings[0].new_symbol && listings[0].symbol == SymbolId("NEWC", "KRW") &&
+           listings[0].korean_venues == std::vector<Exchange>{Exchange::Bithumb} &&
+           listings[0].foreign_venues == std::vector<Exchange>{Exchange::Bybit},
+           "retried as the same new symbol");
+    expect(watcher.is_monitored("NEWC") && watcher.poll().empty(), "added once the retry succeeds");
+
+    // Venue extension retried while another venue lists the coin
+    okx.list("NEWC");
+    listings = watcher.poll();
+    expect(listings.size() == 1 && !listings[0].new_symbol, "extension reported");
+    watcher.retry(listings[0]);
+    upbit.list("NEWC");
+    listings = watcher.poll();
+    expect(listings.size() == 1 && !listings[0].new_symbol &&
+           listings[0].korean_venues == std::vector<Exchange>{Exchange::Upbit} &&
+           listings[0].foreign_venues == std::vector<Exchange>{Exchange::OKX},
+           "retried venue merged with the new one");
+}
+
+Ticker make_ticker(Exchange ex, const SymbolId& symbol, double bid, double ask, double qty = 10.0) {
+    Ticker t;
+    t.exchange = ex;
+    t.symbol = symbol;
+    t.timestamp = std::chrono::steady_clock::now();
+    t.bid = bid;
+    t.ask = ask;
+    t.last = (bid + ask) / 2.0;
+    t.bid_qty = qty;
+    t.ask_qty = qty;
+    return t;
+}
+
+PriceCache::TransferRouteUpdate routes(const std::vector<std::string>& coins) {
+    PriceCache::TransferRouteUpdate update;
+    for (const auto& coin : coins) {
+        update.withdraw_fees[Exchange::Bithumb][coin] = {{"ETH", 0.0}};
+        update.withdraw_enabled[Exchange::Bithumb][coin] = true;
+        update.deposit_nets[Exchange::Bybit][coin] = {"ETH"};
+    }
+    return update;
+}
+
+bool drain_signal_for(ArbitrageEngine& engine, const SymbolId& symbol) {
+    bool found = false;
+    while (auto signal = engine.get_entry_signal()) {
+        found = found || signal->symbol == symbol;
+    }
+    return found;
+}
+
+// A listing added to a live engine while another symbol streams
+void test_hot_add() {
+    const SymbolId btc("BTC", "KRW");
+    const SymbolId newc("NEWC", "KRW");
+    const SymbolId usdt("USDT", "KRW");
+
+    ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Bithumb, Exchange::Bybit);
+    expect(engine.add_symbol(btc), "startup symbol added");
+    expect(!engine.add_symbol(btc), "duplicate add is a no-op");
+    engine.refresh_entry_filters(engine.get_price_cache().apply_transfer_routes(routes({"BTC"})).changed_coins);
+    engine.on_ticker_update(make_ticker(Exchange::Bithumb, usdt, 1000.0, 1000.2, 1e6));
+
+    // BTC keeps streaming (premium too high to enter) for the whole test
+    std::atomic<bool> streaming{true};
+    std::atomic<uint64_t> btc_ticks{0};
+    std::thread feed([&] {
+        while (streaming.load(std::memory_order_relaxed)) {
+            engine.on_ticker_update(make_ticker(Exchange::Bybit, SymbolId("BTC", "USDT"), 100.0, 100.1));
+            engine.on_ticker_update(make_ticker(Exchange::Bithumb, btc, 110'000.0, 110'050.0));
+            btc_ticks.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    while (btc_ticks.load() < 100) {
+        std::this_thread::yield();
+    }
+
+    // Quotes of an unknown coin are ignored
+    auto newc_quotes = [&] {
+        engine.on_ticker_update(make_ticker(Exchange::Bybit, SymbolId("NEWC", "USDT"), 100.0, 100.1));
+        engine.on_ticker_update(make_ticker(Exchange::Bithumb, newc, 97'950.0, 98'000.0));
+    };
+    newc_quotes();
+    expect(!drain_signal_for(engine, newc), "unlisted coin never signals");
+
+    // Hot add in the bot's order: engine slot, streams, then routes for the coin
+    const uint64_t ticks_before = btc_ticks.load();
+    expect(engine.add_symbol(newc), "listing added while running");
+    newc_quotes();
+    expect(!drain_signal_for(engine, newc), "no entry before its transfer route is loaded");
+
+    const auto diff = engine.get_price_cache().apply_transfer_routes(routes({"BTC", "NEWC"}));
+    expect(diff.changed_coins == std::vector<std::string>{"NEWC"}, "route refresh diffs only the new coin");
+    engine.refresh_entry_filters(diff.changed_coins);
+    newc_quotes();
+    expect(drain_signal_for(engine, newc), "new coin eligible for entry");
+
+    while (btc_ticks.load() < ticks_before + 100) {
+        std::this_thread::yield();
+    }
+    streaming.store(false);
+    feed.join();
+
+    bool btc_live = false;
+    bool newc_live = false;
+    for (const auto& p : engine.get_all_premiums()) {
+        btc_live = btc_live || (p.symbol == btc && p.entry_premium > 5.0);
+        newc_live = newc_live || (p.symbol == newc && p.entry_premium < 0.0);
+    }
+    expect(btc_live && newc_live, "both symbols priced after the add");
+}
+
+void test_grow_only_map() {
+    constexpr std::size_t N = 512;
+    memory::GrowOnlyMap<uint64_t, uint64_t, N> map;
+    memory::AppendOnlyArray<uint64_t, N> order;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                const std::size_t n = order.size();
+                for (std::size_t i = 0; i < n; ++i) {
+                    const uint64_t key = order[i];
+                    const uint64_t* value = map.find(key);
+                    if (value == nullptr || *value != key * 7) {
+                        torn.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (uint64_t key = 1; key <= N; ++key) {
+        map.get_or_add(key * 1'000'003, key * 1'000'003 * 7);
+        order.push_back(key * 1'000'003);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    expect(torn.load() == 0, "readers only see fully built entries");
+    expect(map.size() == N && order.size() == N, "all keys stored");
+    expect(map.get_or_add(1) == nullptr, "full map refuses new keys");
+    expect(map.get_or_add(1'000'003) != nullptr && *map.find(1'000'003) == 7'000'021, "existing key kept");
+    expect(!order.push_back(1), "full array refuses appends");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Listing Watcher Regression Test ===\n";
+    Logger::init("test_listing_watcher", "warn");
+
+    test_watcher();
+    test_retry();
+    test_hot_add();
+    test_grow_only_map();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: listing diff, hot symbol add under live quotes, grow-only tables ***\n";
+    return 0;
+}
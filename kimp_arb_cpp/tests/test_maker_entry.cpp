@@ -0,0 +1,338 @@
+#include "test_paper_common.hpp"
+
+#include "kimp/core/logger.hpp"
+#include "kimp/execution/fill_quality.hpp"
+#include "kimp/execution/maker_quoter.hpp"
+#include "kimp/execution/order_manager.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+using namespace paper_test;
+
+namespace {
+
+namespace net = boost::asio;
+
+constexpr double UPBIT_FEE = TradingConfig::UPBIT_FEE_RATE;
+constexpr double BYBIT_FEE = TradingConfig::BYBIT_FEE_RATE;
+
+void test_quoter_bounds() {
+    const MakerQuoter quoter({0.02, 3.0}, UPBIT_FEE, BYBIT_FEE);
+
+    // 2.0 USDT x 1400 = 2800 KRW per coin; foreign fees 3 x 0.1% = 8.4 KRW
+    const double by_edge = (2800.0 / (1.0 + 0.0002) - 8.4) / (1.0 + UPBIT_FEE);
+    const double by_profit = (2800.0 - 8.4 - TradingConfig::MIN_ENTRY_NET_PROFIT_KRW / 17.5) / (1.0 + UPBIT_FEE);
+    expect(near(quoter.ceiling(2.0, 1400.0, 17.5), std::min(by_edge, by_profit)), "ceiling is the tighter gate");
+    expect(quoter.ceiling(2.0, 1400.0, 10'000.0) > by_profit, "profit floor binds only small chunks");
+    expect(quoter.ceiling(0.0, 1400.0, 17.5) == 0.0, "no foreign bid, no ceiling");
+
+    // Clears the gate at the resting price: sell - basis - fees >= profit floor
+    const double ceiling = quoter.ceiling(2.0, 1400.0, 17.5);
+    const double net = 17.5 * (2800.0 - 8.4 - ceiling * (1.0 + UPBIT_FEE));
+    expect(net >= TradingConfig::MIN_ENTRY_NET_PROFIT_KRW - 1e-6, "ceiling keeps the entry profit floor");
+
+    expect(near(MakerQuoter::quote(2765.0, 2770.0, 2773.0), 2766.0), "one tick above the bid");
+    expect(near(MakerQuoter::quote(2765.0, 2766.0, 2773.0), 2765.0), "never crosses a one-tick spread");
+    expect(near(MakerQuoter::quote(2765.0, 2770.0, 2765.7), 2765.0), "capped by the ceiling on the tick grid");
+    expect(MakerQuoter::quote(2765.0, 2770.0, 2764.0) == 0.0, "no quote under the bid");
+
+    using Action = MakerQuoter::Action;
+    expect(quoter.decide(2766.0, 2766.0, 2773.0) == Action::Keep, "unchanged target keeps the order");
+    expect(quoter.decide(2766.0, 2767.0, 2773.0) == Action::Reprice, "3.6 bps drift re-quotes");
+    expect(quoter.decide(2766.0, 2765.0, 2765.5) == Action::Reprice, "ceiling under the resting price re-quotes");
+    expect(quoter.decide(2766.0, 0.0, 2760.0) == Action::Cancel, "no target cancels");
+
+    expect(near(MakerQuoter::saving_per_coin(2770.0, UPBIT_FEE, 2766.0, UPBIT_FEE), 4.0 * (1.0 + UPBIT_FEE)),
+           "KRW maker and taker fees match: the saving is the spread");
+}
+
+void test_paper_resting() {
+    const SymbolId symbol("XRP", "KRW");
+    PaperExecution::Options options;  // Empty distributions = no latency
+    options.seed = 5;
+    options.initial_krw = 1'000'000.0;
+    PaperExecution paper(nullptr, options);
+    paper.on_orderbook(make_book(Exchange::Upbit, symbol, {{2765.0, 500.0}}, {{2770.0, 500.0}}));
+
+    expect(!paper.supports_post_only(Exchange::Bithumb) && paper.supports_post_only(Exchange::Upbit),
+           "post-only on Upbit only");
+    Order crossing = paper.korean_post_only(Exchange::Upbit, symbol, Side::Buy, 10.0, 2770.0);
+    expect(crossing.status == OrderStatus::Rejected && paper.stats().post_only_rejects == 1,
+           "crossing post-only rejected");
+
+    Order order = paper.korean_post_only(Exchange::Upbit, symbol, Side::Buy, 10.0, 2766.0);
+    expect(order.status == OrderStatus::New, "post-only acked New");
+    expect(paper.poll_resting(Exchange::Upbit, order) && order.filled_quantity == 0.0, "rests unfilled");
+
+    // A seller sweeps 4 coins through our bid, then the book restores
+    paper.on_orderbook(make_book(Exchange::Upbit, symbol, {{2765.0, 500.0}}, {{2764.0, 4.0}, {2770.0, 500.0}}));
+    paper.on_orderbook(make_book(Exchange::Upbit, symbol, {{2765.0, 500.0}}, {{2770.0, 500.0}}));
+    expect(paper.poll_resting(Exchange::Upbit, order), "partial fill keeps resting");
+    expect(near(order.filled_quantity, 4.0) && near(order.average_price, 2766.0) &&
+           order.status == OrderStatus::PartiallyFilled, "partial fill at the resting price, not the sweep's");
+
+    expect(paper.cancel_resting(Exchange::Upbit, order), "cancel resolves the order");
+    expect(order.status == OrderStatus::Cancelled && near(order.filled_quantity, 4.0), "cancel keeps the final fill");
+    expect(!paper.poll_resting(Exchange::Upbit, order), "nothing rests after cancel");
+    expect(near(paper.balance(Exchange::Upbit, "KRW"), 1'000'000.0 - 4.0 * 2766.0 * (1.0 + UPBIT_FEE)),
+           "maker fill charged at the maker rate");
+
+    Order full = paper.korean_post_only(Exchange::Upbit, symbol, Side::Buy, 3.0, 2766.0);
+    paper.on_orderbook(make_book(Exchange::Upbit, symbol, {{2765.0, 500.0}}, {{2766.0, 50.0}}));
+    expect(!paper.poll_resting(Exchange::Upbit, full) && full.status == OrderStatus::Filled &&
+           near(full.filled_quantity, 3.0), "fully filled order stops resting");
+    expect(paper.stats().maker_fills == 2 && near(paper.balance(Exchange::Upbit, "XRP"), 7.0),
+           "maker fills settled");
+}
+
+void test_upbit_myorder_stream() {
+    net::io_context ioc;
+    GuardUpbitExchange upbit(ioc);
+    Order order;
+    expect(!upbit.stream_order_update("u-1", order), "unknown order not in the stream cache");
+    upbit.watch_order_update("u-1");  // Placed by the maker path
+
+    upbit.feed_private(R"({"type":"myOrder","uuid":"u-1","state":"trade","executed_volume":4.0,"avg_price":2766,"executed_funds":11064})");
+    upbit.feed_private(R"({"ty":"myOrder","uid":"u-1","s":"wait","ev":2.5,"ap":2766})");  // Late frame
+    std::string state;
+    expect(upbit.stream_order_update("u-1", order, &state) && state == "trade" && near(order.filled_quantity, 4.0) &&
+           near(order.average_price, 2766.0), "cumulative fill, late frames ignored");
+
+    upbit.feed_private(R"({"type":"myOrder","uuid":"u-1","state":"done","executed_volume":"10","executed_funds":"27660"})");
+    expect(upbit.stream_order_update("u-1", order, &state) && state == "done" && near(order.filled_quantity, 10.0) &&
+           near(order.average_price, 2766.0), "string fields, price from executed funds");
+    upbit.feed_private(R"({"type":"ticker","code":"KRW-XRP"})");
+    upbit.forget_order_update("u-1");
+    expect(!upbit.stream_order_update("u-1", order), "finished order dropped");
+
+    // Market and IOC orders share the stream: nothing keeps them past their end
+    upbit.feed_private(R"({"type":"myOrder","uuid":"m-1","state":"trade","executed_volume":1.0,"avg_price":2766})");
+    expect(upbit.stream_order_update("m-1", order), "unwatched order readable while live");
+    upbit.feed_private(R"({"type":"myOrder","uuid":"m-1","state":"done","executed_volume":2.0,"avg_price":2766})");
+    expect(!upbit.stream_order_update("m-1", order), "unwatched order evicted on its terminal state");
+    upbit.feed_private(R"({"type":"myOrder","uuid":"m-2","state":"cancel","executed_volume":0.5,"avg_price":2766})");
+    expect(!upbit.stream_order_update("m-2", order), "cancelled IOC never cached");
+}
+
+// Relay entry against a steady book: Upbit 2765/2770, Bybit 2.000/2.001 at
+// 1400 KRW/USDT. Every fifth update a seller sweeps 6 coins down to 2766,
+// the flow a resting bid one tick above the best bid would catch.
+struct EntryRun {
+    double coins{0.0};
+    double short_coins{0.0};
+    double krw_spent{0.0};
+    double fees_krw{0.0};
+    OrderManager::MakerStats maker;
+    std::vector<FillQualityRecord> fills;
+    uint64_t post_only_rejects{0};
+    int real_orders{0};
+    bool timed_out{false};
+};
+
+EntryRun run_entry(bool maker, double target_coins) {
+    const auto log_dir = std::filesystem::temp_directory_path() / "kimp_test_maker_entry_logs";
+    std::filesystem::remove_all(log_dir);
+    OrderManager::set_trade_log_dir(log_dir.string());
+    const SymbolId symbol("XRP", "KRW");
+    const SymbolId foreign("XRP", "USDT");
+    strategy::ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Upbit, Exchange::Bybit);
+    strategy::PriceCache::TransferRouteUpdate routes;  // Entry needs an open withdraw route
+    routes.withdraw_fees[Exchange::Upbit]["XRP"] = {{"XRP", 0.4}};
+    routes.withdraw_enabled[Exchange::Upbit]["XRP"] = true;
+    routes.deposit_nets[Exchange::Bybit]["XRP"] = {"XRP"};
+    engine.get_price_cache().apply_transfer_routes(std::move(routes));
+    auto paper = std::make_shared<PaperExecution>(nullptr, [] {
+        auto options = PaperExecution::Options::with_default_latencies();
+        options.seed = 11;
+        options.initial_krw = 10'000'000.0;
+        options.initial_usdt = 10'000.0;
+        return options;
+    }());
+
+    net::io_context ioc;
+    auto upbit = std::make_shared<GuardUpbitExchange>(ioc);
+    auto bybit = std::make_shared<GuardBybitExchange>(ioc);
+    OrderManager manager;
+    manager.set_exchange(Exchange::Upbit, upbit);
+    manager.set_exchange(Exchange::Bybit, bybit);
+    manager.set_execution_backend(paper);
+    manager.set_engine(&engine);
+    if (maker) {
+        OrderManager::MakerEntry entry;
+        entry.enabled = true;
+        manager.set_maker_entry(entry);
+    }
+
+    auto publish = [&](Exchange ex, const SymbolId& sym, double bid, double ask, double qty) {
+        Ticker ticker;
+        ticker.exchange = ex;
+        ticker.symbol = sym;
+        ticker.timestamp = std::chrono::steady_clock::now();
+        ticker.bid = bid;
+        ticker.ask = ask;
+        ticker.last = bid;
+        ticker.bid_qty = qty;
+        ticker.ask_qty = qty;
+        engine.on_ticker_update(ticker);
+    };
+    auto steady_books = [&] {
+        paper->on_orderbook(make_book(Exchange::Upbit, symbol, {{2765.0, 500.0}}, {{2770.0, 500.0}}));
+        paper->on_orderbook(make_book(Exchange::Bybit, foreign, {{2.0, 100'000.0}}, {{2.001, 100'000.0}}));
+        publish(Exchange::Upbit, symbol, 2765.0, 2770.0, 500.0);
+        publish(Exchange::Bybit, foreign, 2.0, 2.001, 100'000.0);
+    };
+    steady_books();
+
+    ArbitrageSignal signal;
+    signal.symbol = symbol;
+    signal.korean_exchange = Exchange::Upbit;
+    signal.foreign_exchange = Exchange::Bybit;
+    signal.korean_ask = 2770.0;
+    signal.korean_ask_qty = 500.0;
+    signal.foreign_bid = 2.0;
+    signal.foreign_bid_qty = 100'000.0;
+    signal.usdt_krw_rate = 1400.0;
+    signal.premium = (2770.0 - 2800.0) / 2800.0 * 100.0;
+
+    std::atomic<bool> done{false};
+    EntryRun run;
+    std::thread driver([&] {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        for (int tick = 0; !done.load(); ++tick) {
+            if (tick % 5 == 4) {
+                paper->on_orderbook(make_book(Exchange::Upbit, symbol, {{2765.0, 500.0}},
+                                              {{2766.0, 6.0}, {2770.0, 500.0}}));
+            }
+            steady_books();
+            const bool expired = std::chrono::steady_clock::now() >= deadline;
+            if (paper->balance(Exchange::Upbit, "XRP") >= target_coins || expired) {
+                run.timed_out = expired;
+                manager.request_shutdown();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    });
+    const auto result = manager.execute_spot_relay_entry(signal);
+    done.store(true);
+    driver.join();
+
+    run.coins = paper->balance(Exchange::Upbit, "XRP");
+    run.short_coins = -paper->balance(Exchange::Bybit, "XRP");
+    run.krw_spent = 10'000'000.0 - paper->balance(Exchange::Upbit, "KRW");
+    run.fees_krw = paper->stats().fees_krw;
+    run.maker = manager.maker_stats();
+    run.post_only_rejects = paper->stats().post_only_rejects;
+    run.real_orders = upbit->calls + bybit->calls;
+    expect(result.success && near(result.position.korean_amount, run.coins, 1e-6),
+           "entry result carries the held coins");
+
+    // Written by the background trade-log writer: wait until every Korean coin is on record
+    const auto path = (log_dir / "fill_quality.bin").string();
+    for (int i = 0; i < 200; ++i) {
+        run.fills.clear();
+        read_fill_quality(path, run.fills);
+        double logged = 0.0;
+        for (const auto& record : run.fills) {
+            logged += record.leg == FillLeg::Korean ? record.fill_qty : 0.0;
+        }
+        if (near(logged, run.coins, 1e-6)) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    OrderManager::set_trade_log_dir("trade_logs");
+    std::filesystem::remove_all(log_dir);
+    return run;
+}
+
+void test_maker_vs_taker() {
+    constexpr double TARGET_COINS = 50.0;
+    const EntryRun taker = run_entry(false, TARGET_COINS);
+    const EntryRun maker = run_entry(true, TARGET_COINS);
+
+    for (const auto* run : {&taker, &maker}) {
+        expect(!run->timed_out && run->coins >= TARGET_COINS, "entry reached the target size");
+        expect(near(run->coins, run->short_coins, 1e-6), "foreign short matches the Korean fill");
+        expect(run->real_orders == 0, "no real order reached the venues");
+    }
+    expect(taker.maker.chunks == 0 && maker.maker.chunks > 0, "only the maker run rested bids");
+
+    const double taker_per_coin = taker.krw_spent / taker.coins;
+    const double maker_per_coin = maker.krw_spent / maker.coins;
+    // A market buy landing between a sweep and the restore takes the sweep's coins
+    expect(near(taker_per_coin, 2770.0 * (1.0 + UPBIT_FEE), 0.5), "taker buys at the ask");
+    expect(maker_per_coin < taker_per_coin, "maker entry costs less per coin");
+    expect(maker.maker.saved_krw > 0.0 && near(maker.maker.filled_coins, maker.coins, 1e-6),
+           "savings accounted on every maker coin");
+    expect(maker.maker.hedge_delay.count > 0 && maker.maker.hedge_delay.negative == 0, "each increment hedged");
+
+    // Maker chunks log both legs like taker chunks
+    for (const auto* run : {&taker, &maker}) {
+        double korean_qty = 0.0;
+        double foreign_qty = 0.0;
+        for (const auto& record : run->fills) {
+            (record.leg == FillLeg::Korean ? korean_qty : foreign_qty) += record.fill_qty;
+        }
+        expect(near(korean_qty, run->coins, 1e-6) && near(foreign_qty, run->short_coins, 1e-6),
+               "fill-quality log covers every coin of both legs");
+    }
+    bool maker_logged = false;
+    for (const auto& record : maker.fills) {
+        if (record.leg == FillLeg::Korean && record.fill_price < 2770.0) {
+            maker_logged = true;
+            expect(record.action == FillAction::Entry && record.side == Side::Buy && record.venue == Exchange::Upbit,
+                   "maker fill logged as an Upbit entry buy");
+            expect(record.decision_price < 2770.0 && record.send_ns >= record.decision_ns &&
+                   record.fill_ns >= record.ack_ns, "decided on the resting bid, not the ask");
+        }
+    }
+    expect(maker_logged, "resting-bid fills reach the fill-quality log");
+
+    std::printf("  taker: %.2f coins, %.3f KRW/coin, KRW fees %.1f\n",
+                taker.coins, taker_per_coin, taker.fees_krw);
+    std::printf("  maker: %.2f coins, %.3f KRW/coin, KRW fees %.1f, saved %.1f KRW (%.2f bps), "
+                "chunks %llu, reprices %llu, cancels %llu, post-only rejects %llu\n",
+                maker.coins, maker_per_coin, maker.fees_krw, maker.maker.saved_krw,
+                (taker_per_coin - maker_per_coin) / taker_per_coin * 1e4,
+                static_cast<unsigned long long>(maker.maker.chunks),
+                static_cast<unsigned long long>(maker.maker.reprices),
+                static_cast<unsigned long long>(maker.maker.cancels),
+                static_cast<unsigned long long>(maker.post_only_rejects));
+    std::printf("  hedge delay (Korean fill -> short filled): n=%llu avg %.1f ms, p50 %.1f ms, p99 %.1f ms\n",
+                static_cast<unsigned long long>(maker.maker.hedge_delay.count),
+                maker.maker.hedge_delay.avg_us / 1000.0, maker.maker.hedge_delay.p50_us / 1000.0,
+                maker.maker.hedge_delay.p99_us / 1000.0);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Maker Entry Regression Test ===\n";
+    Logger::init("test_maker_entry", "warn");
+
+    test_quoter_bounds();
+    test_paper_resting();
+    test_upbit_myorder_stream();
+    test_maker_vs_taker();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: quote bounds, paper resting fills, myOrder stream, hedge-on-fill vs taker ***\n";
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include "kimp/memory/shm_broadcast_ring.hpp"
+#include "kimp/network/market_data_shm.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace kimp;
+using namespace kimp::network;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+std::string unique_name(const char* tag) {
+    return "/kimp_test_md_" + std::string(tag) + "_" + std::to_string(::getpid());
+}
+
+struct Sample {
+    uint64_t value{0};
+    uint64_t check{0};
+};
+
+void test_ring_in_order_and_gaps() {
+    using Ring = memory::ShmBroadcastRing<Sample>;
+    const std::string name = unique_name("ring");
+
+    std::string error;
+    expect(Ring::create(name, 12, &error) == nullptr && !error.empty(), "capacity must be a power of two");
+
+    auto writer = Ring::create(name, 16, &error);
+    expect(writer != nullptr, "create ring");
+    if (!writer) return;
+    auto attached = Ring::attach(name, &error);
+    expect(attached != nullptr && attached->epoch() == writer->epoch(), "attach sees the writer's epoch");
+    if (!attached) return;
+
+    Ring::Reader reader(*attached);
+    Sample s;
+    expect(!reader.poll(s), "empty ring has nothing to read");
+
+    for (uint64_t i = 0; i < 10; ++i) writer->publish({i, i * 7});
+    std::vector<uint64_t> got;
+    while (reader.poll(s)) {
+        expect(s.check == s.value * 7, "payload intact");
+        got.push_back(s.value);
+    }
+    expect(got.size() == 10 && got.front() == 0 && got.back() == 9, "all messages in order");
+    expect(reader.lost() == 0 && reader.gaps() == 0, "no loss while keeping up");
+
+    // Lap the reader: 40 messages into a 16-slot ring
+    for (uint64_t i = 10; i < 50; ++i) writer->publish({i, i * 7});
+    got.clear();
+    while (reader.poll(s)) got.push_back(s.value);
+    expect(reader.gaps() == 1, "one overrun detected");
+    expect(!got.empty() && got.back() == 49, "resumes and reaches the newest message");
+    expect(reader.lost() + got.size() == 40, "lost + delivered accounts for every message");
+    bool contiguous = true;
+    for (std::size_t i = 1; i < got.size(); ++i) contiguous &= got[i] == got[i - 1] + 1;
+    expect(contiguous, "contiguous after resync");
+
+    // A ring of another payload type is rejected
+    expect(memory::ShmBroadcastRing<MarketDataMessage>::attach(name, &error) == nullptr,
+           "attach rejects mismatched message type");
+
+    writer.reset();  // Owner unlinks; existing mapping stays readable
+    expect(Ring::attach(name, &error) == nullptr && !error.empty(), "attach to a removed ring fails");
+}
+
+void test_publisher_subscriber_roundtrip() {
+    const std::string name = unique_name("roundtrip");
+    std::string error;
+    expect(MarketDataSubscriber::attach(name, &error) == nullptr && !error.empty(),
+           "attach before the gateway exists fails");
+
+    auto publisher = MarketDataPublisher::create(name, 64, &error);
+    expect(publisher != nullptr, "create publisher");
+    if (!publisher) return;
+    auto subscriber = MarketDataSubscriber::attach(name, &error);
+    expect(subscriber != nullptr, "attach subscriber");
+    if (!subscriber) return;
+
+    std::vector<Ticker> tickers;
+    std::vector<OrderBook> books;
+    subscriber->set_ticker_callback([&](const Ticker& t) { tickers.push_back(t); });
+    subscriber->set_orderbook_callback([&](const OrderBook& b) { books.push_back(b); });
+
+    Ticker t;
+    t.exchange = Exchange::Bybit;
+    t.symbol = SymbolId("BTC", "USDT");
+    t.timestamp = std::chrono::steady_clock::now();
+    t.sequence = 42;
+    t.bid = 65000.5;
+    t.ask = 65001.0;
+    t.bid_qty = 1.25;
+    publisher->publish(t);
+
+    OrderBook b;
+    b.exchange = Exchange::Bithumb;
+    b.symbol = SymbolId("ETH", "KRW");
+    b.bid_count = 2;
+    b.ask_count = 1;
+    b.bids[0] = {4'500'000.0, 0.5};
+    b.bids[1] = {4'499'000.0, 1.5};
+    b.asks[0] = {4'501'000.0, 0.7};
+    publisher->publish(b);
+
+    expect(subscriber->poll() == 2, "both updates delivered");
+    expect(tickers.size() == 1 && books.size() == 1, "routed by kind");
+    if (tickers.size() == 1) {
+        expect(tickers[0].exchange == Exchange::Bybit && tickers[0].symbol == t.symbol, "ticker identity");
+        expect(tickers[0].sequence == 42 && tickers[0].bid == 65000.5 && tickers[0].ask == 65001.0 &&
+               tickers[0].bid_qty == 1.25, "ticker prices");
+        expect(tickers[0].timestamp == t.timestamp, "steady timestamp preserved");
+    }
+    if (books.size() == 1) {
+        expect(books[0].bid_count == 2 && books[0].ask_count == 1, "book depth");
+        expect(books[0].bids[1].price == 4'499'000.0 && books[0].asks[0].quantity == 0.7, "book levels");
+    }
+    expect(subscriber->stats().delivered == 2 && subscriber->stats().lost == 0, "stats");
+}
+
+// Gateway restarts under an attached bot: the bot follows the new ring
+void test_reattach_after_gateway_restart() {
+    const std::string name = unique_name("restart");
+    auto publisher = MarketDataPublisher::create(name, 64);
+    auto subscriber = MarketDataSubscriber::attach(name);
+    expect(publisher && subscriber, "gateway + bot");
+    if (!publisher || !subscriber) return;
+
+    std::vector<uint64_t> seqs;
+    subscriber->set_ticker_callback([&](const Ticker& t) { seqs.push_back(t.sequence); });
+
+    Ticker t;
+    t.sequence = 1;
+    publisher->publish(t);
+    expect(!subscriber->reattach_if_restarted(), "same gateway: no reattach");
+
+    const uint64_t old_epoch = subscriber->epoch();
+    publisher.reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));  // Distinct epoch clock
+    publisher = MarketDataPublisher::create(name, 64);
+    expect(publisher != nullptr, "gateway restarted");
+    if (!publisher) return;
+    for (uint64_t i = 100; i < 103; ++i) {
+        t.sequence = i;
+        publisher->publish(t);
+    }
+
+    expect(subscriber->reattach_if_restarted(), "new epoch picked up");
+    expect(subscriber->epoch() != old_epoch, "epoch changed");
+    subscriber->poll();
+    expect(seqs == std::vector<uint64_t>({1, 100, 101, 102}),
+           "old ring drained, then new gateway's backlog replayed");
+    expect(subscriber->stats().reattaches == 1, "reattach counted");
+}
+
+// Separate process attaches and must see every update, in order
+void test_cross_process_loopback() {
+    constexpr uint64_t COUNT = 20000;
+    const std::string name = unique_name("fork");
+    auto publisher = MarketDataPublisher::create(name, 1 << 15);
+    expect(publisher != nullptr, "create publisher for fork");
+    if (!publisher) return;
+
+    int ready[2];
+    if (::pipe(ready) != 0) {
+        expect(false, "pipe");
+        return;
+    }
+
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        ::close(ready[0]);
+        auto subscriber = MarketDataSubscriber::attach(name);
+        if (!subscriber) ::_exit(2);
+        uint64_t expected = 0;
+        bool in_order = true;
+        subscriber->set_ticker_callback([&](const Ticker& t) {
+            in_order &= t.sequence == expected && t.bid == static_cast<double>(expected) * 0.5;
+            ++expected;
+        });
+        const char byte = 1;
+        if (::write(ready[1], &byte, 1) != 1) ::_exit(3);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (expected < COUNT && std::chrono::steady_clock::now() < deadline) {
+            if (subscriber->poll() == 0) std::this_thread::yield();
+        }
+        const auto stats = subscriber->stats();
+        ::_exit(expected == COUNT && in_order && stats.lost == 0 && stats.gaps == 0 ? 0 : 4);
+    }
+
+    ::close(ready[1]);
+    char byte = 0;
+    expect(::read(ready[0], &byte, 1) == 1, "child attached");
+    ::close(ready[0]);
+
+    Ticker t;
+    t.exchange = Exchange::Bithumb;
+    t.symbol = SymbolId("XRP", "KRW");
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        t.sequence = i;
+        t.bid = static_cast<double>(i) * 0.5;
+        publisher->publish(t);
+    }
+
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    expect(WIFEXITED(status) && WEXITSTATUS(status) == 0, "child received every update in order");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Market Data Shared-Memory Regression Test ===\n";
+
+    test_ring_in_order_and_gaps();
+    test_publisher_subscriber_roundtrip();
+    test_reattach_after_gateway_restart();
+    test_cross_process_loopback();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: shm ring delivery, gap detection, reattach, cross-process loopback ***\n";
+    return 0;
+}
@@ -0,0 +1,585 @@
+#include "kimp/core/logger.hpp"
+#include "kimp/exchange/bithumb/bithumb.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+#include "kimp/exchange/okx/okx.hpp"
+#include "kimp/exchange/order_submit.hpp"
+#include "kimp/execution/order_manager.hpp"
+#include "kimp/network/socket_deadline.hpp"
+
+#include <boost/asio.hpp>
+
+#include <cctype>
+#include <cmath>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace kimp;
+using namespace kimp::exchange;
+
+namespace {
+
+namespace net = boost::asio;
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+OrderSubmitPolicy fast_policy(int attempts) {
+    OrderSubmitPolicy policy;
+    policy.timeout = std::chrono::milliseconds(200);
+    policy.attempts = attempts;
+    policy.lookup_delay = std::chrono::milliseconds(0);
+    return policy;
+}
+
+/**
+ * Stand-in venue keyed by client order id, like orderLinkId / clOrdId /
+ * identifier: a second submit under a taken id is refused as a duplicate.
+ * Faults are consumed one per submit / lookup in order.
+ */
+class DroppingVenue {
+public:
+    enum class Fault : uint8_t {
+        None,
+        DropRequest,   // Lost before the venue: nothing placed, no answer
+        DropResponse,  // Placed, answer lost
+        Delay,         // Held in flight: lands just before the next submit
+        Refuse         // Business rejection (insufficient balance)
+    };
+
+    std::deque<Fault> submit_faults;
+    std::deque<LookupReply> lookup_faults;  // Forced answers (Unknown = down, NotFound = index lag)
+    std::unordered_map<std::string, std::string> orders;  // client id -> venue order id
+    std::vector<std::string> submitted_ids;
+    int placed{0};
+
+    SubmitReply submit(Order& order) {
+        land_delayed();
+        submitted_ids.push_back(order.client_id);
+        const Fault fault = next(submit_faults, Fault::None);
+        if (fault == Fault::DropRequest) {
+            return SubmitReply::Unknown;
+        }
+        if (fault == Fault::Refuse) {
+            order.status = OrderStatus::Rejected;
+            return SubmitReply::Rejected;
+        }
+        if (orders.count(order.client_id) != 0) {
+            return SubmitReply::Duplicate;
+        }
+        if (fault == Fault::Delay) {
+            delayed_.push_back(order.client_id);
+            return SubmitReply::Unknown;
+        }
+        place(order.client_id);
+        if (fault == Fault::DropResponse) {
+            return SubmitReply::Unknown;
+        }
+        order.order_id_str = orders[order.client_id];
+        order.status = OrderStatus::Filled;  // Ack: accepted, fill pending
+        return SubmitReply::Accepted;
+    }
+
+    LookupReply lookup(Order& order) {
+        const LookupReply forced = next(lookup_faults, LookupReply::Found);
+        if (forced != LookupReply::Found) {
+            return forced;
+        }
+        auto it = orders.find(order.client_id);
+        if (it == orders.end()) {
+            return LookupReply::NotFound;
+        }
+        order.order_id_str = it->second;
+        order.status = OrderStatus::Filled;
+        return LookupReply::Found;
+    }
+
+    // Copies still in flight when the caller gives up
+    void land_delayed() {
+        for (const auto& id : delayed_) {
+            if (orders.count(id) == 0) {
+                place(id);
+            }
+        }
+        delayed_.clear();
+    }
+
+private:
+    std::vector<std::string> delayed_;
+
+    void place(const std::string& client_id) {
+        orders[client_id] = "venue-" + std::to_string(++placed);
+    }
+
+    template <typename T>
+    static T next(std::deque<T>& queue, T fallback) {
+        if (queue.empty()) {
+            return fallback;
+        }
+        const T value = queue.front();
+        queue.pop_front();
+        return value;
+    }
+};
+
+SubmitOutcome run(DroppingVenue& venue, Order& order, int attempts = 3) {
+    return submit_idempotent(
+        fast_policy(attempts), order,
+        [&](Order& o) { return venue.submit(o); },
+        [&](Order& o) { return venue.lookup(o); });
+}
+
+Order make_order(uint64_t sequence) {
+    Order order;
+    order.client_order_id = sequence;
+    order.client_id = format_client_order_id(sequence);
+    return order;
+}
+
+void test_client_id_format() {
+    std::unordered_set<std::string> seen;
+    bool valid = true;
+    for (uint64_t seq = 1; seq <= 20000; ++seq) {
+        const std::string id = format_client_order_id(seq);
+        valid = valid && id.size() <= 32 && id.rfind("kp", 0) == 0;
+        for (char c : id) {
+            valid = valid && std::isalnum(static_cast<unsigned char>(c)) != 0;
+        }
+        seen.insert(id);
+    }
+    expect(valid, "client ids are 'kp' + alphanumerics within OKX's 32 chars");
+    expect(seen.size() == 20000, "client ids unique per sequence");
+    expect(format_client_order_id(UINT64_MAX).size() <= 32, "largest sequence still fits");
+    expect(format_client_order_id(7) == format_client_order_id(7), "one session stamp per process");
+}
+
+void test_clean_and_refused() {
+    DroppingVenue venue;
+    Order order = make_order(1);
+    auto out = run(venue, order);
+    expect(out.reply == SubmitReply::Accepted && out.submits == 1 && out.lookups == 0,
+           "answered submit: one request, no lookup");
+    expect(!out.reconciled && order.order_id_str == "venue-1", "ack carries the venue id");
+
+    Order refused = make_order(2);
+    venue.submit_faults = {DroppingVenue::Fault::Refuse};
+    out = run(venue, refused);
+    expect(out.reply == SubmitReply::Rejected && out.submits == 1 && out.lookups == 0,
+           "business rejection is final without a lookup");
+    expect(refused.status == OrderStatus::Rejected && venue.placed == 1, "nothing placed on rejection");
+}
+
+void test_dropped_response_reconciled() {
+    DroppingVenue venue;
+    venue.submit_faults = {DroppingVenue::Fault::DropResponse};
+    Order order = make_order(3);
+    const auto out = run(venue, order);
+    expect(out.reply == SubmitReply::Accepted && out.reconciled, "dropped ack resolved by lookup");
+    expect(out.submits == 1 && out.lookups == 1, "found on the first lookup, no resubmit");
+    expect(venue.placed == 1 && order.order_id_str == "venue-1", "order adopted, not duplicated");
+    expect(order.status == OrderStatus::Filled, "adopted order carries ack status");
+}
+
+void test_dropped_request_resubmitted() {
+    DroppingVenue venue;
+    venue.submit_faults = {DroppingVenue::Fault::DropRequest, DroppingVenue::Fault::DropRequest};
+    Order order = make_order(4);
+    const auto out = run(venue, order);
+    expect(out.reply == SubmitReply::Accepted && !out.reconciled, "third submit acked");
+    expect(out.submits == 3 && out.lookups == 2, "one lookup per unanswered submit");
+    expect(venue.placed == 1, "exactly one order placed");
+    bool same_id = venue.submitted_ids.size() == 3;
+    for (const auto& id : venue.submitted_ids) {
+        same_id = same_id && id == order.client_id;
+    }
+    expect(same_id, "every retry reuses the client id");
+}
+
+void test_late_copy_refused_as_duplicate() {
+    // First copy not visible to the lookup, lands before the retry
+    DroppingVenue venue;
+    venue.submit_faults = {DroppingVenue::Fault::Delay};
+    Order order = make_order(5);
+    const auto out = run(venue, order);
+    expect(venue.placed == 1, "late first copy and retry fill once");
+    expect(out.reply == SubmitReply::Accepted && out.reconciled, "retry's duplicate resolved by lookup");
+    expect(out.submits == 2 && out.lookups == 2, "duplicate triggers a second lookup");
+    expect(order.order_id_str == "venue-1", "adopted the late copy");
+}
+
+void test_lookup_lag_and_outage() {
+    // Ack lost, order index lags one lookup
+    DroppingVenue venue;
+    venue.submit_faults = {DroppingVenue::Fault::DropResponse};
+    venue.lookup_faults = {LookupReply::NotFound};
+    Order order = make_order(6);
+    auto out = run(venue, order);
+    expect(out.reply == SubmitReply::Accepted && out.reconciled, "index lag: duplicate then found");
+    expect(venue.placed == 1, "index lag never doubles the order");
+
+    // Venue unreachable for submits and lookups
+    DroppingVenue down;
+    down.submit_faults = {DroppingVenue::Fault::DropRequest, DroppingVenue::Fault::DropRequest,
+                          DroppingVenue::Fault::DropRequest};
+    down.lookup_faults = {LookupReply::Unknown, LookupReply::Unknown, LookupReply::Unknown};
+    Order lost = make_order(7);
+    out = run(down, lost);
+    expect(out.reply == SubmitReply::Unknown, "unreachable venue stays unknown");
+    expect(out.submits == 3 && lost.status == OrderStatus::Unknown, "bounded attempts, caller sees Unknown");
+
+    // Every copy lost, venue answers lookups: definitively nothing there
+    DroppingVenue lossy;
+    lossy.submit_faults = {DroppingVenue::Fault::DropRequest, DroppingVenue::Fault::DropRequest};
+    Order never = make_order(8);
+    out = run(lossy, never, 2);
+    expect(out.reply == SubmitReply::Rejected && lossy.placed == 0, "not found after the last lookup: rejected");
+
+    // The last submit was a duplicate the index cannot see yet: not a rejection
+    DroppingVenue lagging;
+    lagging.submit_faults = {DroppingVenue::Fault::DropResponse};
+    lagging.lookup_faults = {LookupReply::NotFound, LookupReply::NotFound};
+    Order held = make_order(9);
+    out = run(lagging, held, 2);
+    expect(out.reply == SubmitReply::Unknown && lagging.placed == 1,
+           "duplicate with a lagging index stays unknown, never rejected");
+}
+
+void test_aggressive_retries_never_double_fill() {
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> pick(0, 99);
+    DroppingVenue venue;
+    int accepted = 0;
+    int rejected = 0;
+    int unknown = 0;
+    int reconciled = 0;
+    bool accepted_exists = true;
+    bool rejected_absent = true;
+    int orders = 0;
+
+    for (uint64_t seq = 100; seq < 2100; ++seq) {
+        // 30% dropped responses, 15% dropped requests, 10% delayed copies,
+        // 10% lookups down, 5% lagging lookups
+        for (int i = 0; i < 5; ++i) {
+            const int roll = pick(rng);
+            venue.submit_faults.push_back(roll < 30 ? DroppingVenue::Fault::DropResponse
+                                          : roll < 45 ? DroppingVenue::Fault::DropRequest
+                                          : roll < 55 ? DroppingVenue::Fault::Delay
+                                                      : DroppingVenue::Fault::None);
+            const int look = pick(rng);
+            venue.lookup_faults.push_back(look < 10 ? LookupReply::Unknown
+                                          : look < 15 ? LookupReply::NotFound
+                                                      : LookupReply::Found);
+        }
+        Order order = make_order(seq);
+        const auto out = run(venue, order, 5);
+        venue.submit_faults.clear();
+        venue.lookup_faults.clear();
+        ++orders;
+
+        const bool exists = venue.orders.count(order.client_id) != 0;
+        if (out.reply == SubmitReply::Accepted) {
+            ++accepted;
+            reconciled += out.reconciled ? 1 : 0;
+            accepted_exists = accepted_exists && exists && order.order_id_str == venue.orders[order.client_id];
+        } else if (out.reply == SubmitReply::Rejected) {
+            ++rejected;
+            rejected_absent = rejected_absent && !exists;
+        } else {
+            ++unknown;
+        }
+        venue.land_delayed();  // Stragglers arrive after the caller moved on
+    }
+
+    expect(venue.placed == static_cast<int>(venue.orders.size()), "one venue order per client id at most");
+    expect(venue.placed <= orders, "never more orders than intents");
+    expect(accepted_exists, "every accepted result names the one venue order");
+    expect(rejected_absent, "rejected results left nothing at decision time");
+    expect(reconciled > 0 && accepted > orders * 9 / 10, "most intents resolved despite 55% faulty submits");
+    std::cout << "  2000 intents under faults: accepted=" << accepted << " (reconciled=" << reconciled
+              << ") rejected=" << rejected << " unknown=" << unknown << " venue orders=" << venue.placed << "\n";
+}
+
+// Venue REST stand-in: scripted answers per method, the rest time out
+struct ScriptedRest {
+    std::deque<HttpResponse> posts;
+    std::deque<HttpResponse> gets;
+    std::vector<std::string> targets;
+
+    RestClient::Transport transport() {
+        return [this](http::verb method, const std::string& target, const std::string&,
+                      std::chrono::milliseconds timeout) {
+            targets.push_back(target);
+            auto& script = method == http::verb::post ? posts : gets;
+            if (script.empty()) {
+                HttpResponse timed_out;
+                timed_out.error = "Request timed out after " + std::to_string(timeout.count()) + "ms";
+                return timed_out;
+            }
+            HttpResponse next = script.front();
+            script.pop_front();
+            return next;
+        };
+    }
+
+    int count(const std::string& prefix) const {
+        int n = 0;
+        for (const auto& target : targets) {
+            n += target.rfind(prefix, 0) == 0 ? 1 : 0;
+        }
+        return n;
+    }
+};
+
+HttpResponse ok(std::string body) {
+    HttpResponse response;
+    response.status_code = 200;
+    response.success = true;
+    response.body = std::move(body);
+    return response;
+}
+
+ExchangeCredentials keyed() {
+    ExchangeCredentials creds;
+    creds.api_key = "key";
+    creds.secret_key = "secret";
+    creds.passphrase = "pass";
+    return creds;
+}
+
+// Timed-out submits through the venue code: found by client id, or left Unknown
+void test_venue_timeouts() {
+    ExchangeBase::set_order_submit_policy(fast_policy(2));
+    net::io_context ioc;
+    const SymbolId symbol("XRP", "USDT");
+
+    bybit::BybitExchange bybit(ioc, keyed());
+    ScriptedRest bybit_rest;
+    bybit_rest.gets.push_back(ok(R"({"retCode":0,"result":{"list":[]}})"));
+    bybit_rest.gets.push_back(ok(R"({"retCode":0,"result":{"list":[{"orderId":"bb-1","orderStatus":"Filled"}]}})"));
+    bybit.set_rest_transport(bybit_rest.transport());
+    const Order found = bybit.place_market_order(symbol, Side::Sell, 10.0);
+    expect(found.status == OrderStatus::Filled && found.order_id_str == "bb-1",
+           "Bybit: timeout, then found by orderLinkId");
+    expect(bybit_rest.count("/v5/order/create") == 2 && bybit_rest.count("/v5/order/realtime") == 2,
+           "Bybit: one resend after NotFound, never after Found");
+
+    ScriptedRest silent;
+    bybit.set_rest_transport(silent.transport());
+    Order unknown = bybit.place_market_order(symbol, Side::Sell, 10.0);
+    expect(unknown.status == OrderStatus::Unknown, "Bybit: timeouts and failed lookups end Unknown");
+    expect(!unknown.client_id.empty(), "Unknown keeps its client id for reconcile");
+    ScriptedRest back;
+    back.gets.push_back(ok(R"({"retCode":0,"result":{"list":[{"orderId":"bb-2","orderStatus":"New"}]}})"));
+    bybit.set_rest_transport(back.transport());
+    expect(bybit.lookup_client_order(unknown) == LookupReply::Found && unknown.order_id_str == "bb-2",
+           "Bybit: Unknown resolved by lookup_client_order");
+
+    okx::OkxExchange okx(ioc, keyed());
+    ScriptedRest okx_rest;
+    okx_rest.gets.push_back(ok(R"({"code":"0","data":[{"ordId":"ok-1","state":"filled"}]})"));
+    okx.set_rest_transport(okx_rest.transport());
+    const Order okx_found = okx.place_market_order(symbol, Side::Buy, 10.0);
+    expect(okx_found.status == OrderStatus::Filled && okx_found.order_id_str == "ok-1",
+           "OKX: timeout, then found by clOrdId");
+    expect(okx_rest.count("/api/v5/trade/order?") == 1, "OKX: one lookup, no resend");
+
+    ScriptedRest okx_absent;
+    okx_absent.gets.push_back(ok(R"({"code":"51603","msg":"Order does not exist","data":[]})"));
+    okx_absent.gets.push_back(ok(R"({"code":"51603","msg":"Order does not exist","data":[]})"));
+    okx.set_rest_transport(okx_absent.transport());
+    const Order absent = okx.place_market_order(symbol, Side::Buy, 10.0);
+    expect(absent.status == OrderStatus::Rejected, "OKX: NotFound after the last submit settles Rejected");
+
+    ScriptedRest okx_silent;
+    okx.set_rest_transport(okx_silent.transport());
+    expect(okx.place_market_order(symbol, Side::Buy, 10.0).status == OrderStatus::Unknown,
+           "OKX: timeouts and failed lookups end Unknown");
+    ExchangeBase::set_order_submit_policy(OrderSubmitPolicy{});
+}
+
+// Cover leg whose submit goes unanswered, then shows up under its client id
+class UnansweredBybit final : public bybit::BybitExchange {
+public:
+    explicit UnansweredBybit(net::io_context& ioc) : bybit::BybitExchange(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    bool cancel_order(uint64_t) override { return false; }
+    double get_balance(const std::string&) override { return 0.0; }
+
+    Order close_short(const SymbolId& symbol, Quantity quantity) override {
+        ++covers;
+        requested += quantity;
+        Order order;
+        order.exchange = Exchange::Bybit;
+        order.symbol = symbol;
+        order.side = Side::Buy;
+        order.quantity = quantity;
+        order.client_id = "kp-cover-" + std::to_string(covers);
+        order.status = OrderStatus::Unknown;
+        return order;
+    }
+
+    LookupReply lookup_client_order(Order& order) override {
+        if (++lookups < 3) {
+            return LookupReply::Unknown;  // Venue still down
+        }
+        order.status = OrderStatus::Filled;
+        order.filled_quantity = order.quantity;
+        order.average_price = 10.0;
+        return LookupReply::Found;
+    }
+
+    int covers{0};
+    int lookups{0};
+    double requested{0.0};
+};
+
+class FillingBithumb final : public bithumb::BithumbExchange {
+public:
+    explicit FillingBithumb(net::io_context& ioc) : bithumb::BithumbExchange(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    double get_usdt_krw_price() override { return 1300.0; }
+    bool cancel_order(uint64_t) override { return false; }
+    double get_balance(const std::string&) override { return 0.0; }
+
+    Order place_market_order(const SymbolId& symbol, Side side, Quantity quantity) override {
+        Order order;
+        order.exchange = Exchange::Bithumb;
+        order.symbol = symbol;
+        order.side = side;
+        order.type = OrderType::Market;
+        order.status = OrderStatus::Filled;
+        order.quantity = quantity;
+        order.filled_quantity = quantity;
+        order.average_price = 13100.0;
+        return order;
+    }
+};
+
+// OrderManager waits out an Unknown leg by client id instead of resending it
+void test_unknown_leg_reconciled() {
+    net::io_context ioc;
+    auto bithumb_ex = std::make_shared<FillingBithumb>(ioc);
+    auto bybit_ex = std::make_shared<UnansweredBybit>(ioc);
+    execution::OrderManager manager;
+    manager.set_exchange(Exchange::Bithumb, bithumb_ex);
+    manager.set_exchange(Exchange::Bybit, bybit_ex);
+
+    Position position;
+    position.symbol = SymbolId("XRP", "KRW");
+    position.korean_exchange = Exchange::Bithumb;
+    position.foreign_exchange = Exchange::Bybit;
+    position.korean_amount = 10.0;
+    position.foreign_amount = 10.0;
+    position.korean_entry_price = 13000.0;
+    position.foreign_entry_price = 10.0;
+    position.position_size_usd = 100.0;
+    position.is_active = true;
+
+    ExitSignal signal;
+    signal.symbol = position.symbol;
+    signal.korean_exchange = position.korean_exchange;
+    signal.foreign_exchange = position.foreign_exchange;
+    signal.premium = 0.77;
+    signal.korean_bid = 13100.0;
+    signal.foreign_ask = 10.0;
+    signal.usdt_krw_rate = 1300.0;
+
+    const auto result = manager.execute_spot_relay_exit(signal, position);
+    expect(result.success && !result.position.is_active, "exit completes once the cover is found");
+    expect(std::abs(bybit_ex->requested - 10.0) < 1e-9, "Unknown covers never resent: short covered once");
+    expect(bybit_ex->lookups == bybit_ex->covers + 2, "first cover looked up until the venue answered");
+}
+
+// A blocking read on a silent peer returns at the deadline
+void test_socket_deadline() {
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        expect(false, "socketpair");
+        return;
+    }
+    using network::SocketDeadline;
+    const auto start = SocketDeadline::Clock::now();
+    bool expired = false;
+    {
+        SocketDeadline::Guard deadline(fds[0], std::chrono::milliseconds(50));
+        char byte = 0;
+        const ssize_t n = ::recv(fds[0], &byte, 1, 0);  // Peer never writes
+        expired = deadline.release();
+        expect(n == 0, "blocked read fails once the socket is shut down");
+    }
+    const auto waited = SocketDeadline::Clock::now() - start;
+    expect(expired, "deadline reported as fired");
+    expect(waited >= std::chrono::milliseconds(50) && waited < std::chrono::seconds(5),
+           "read held until the deadline, not until TCP gives up");
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    // Disarmed in time: the socket stays usable
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        expect(false, "socketpair");
+        return;
+    }
+    {
+        SocketDeadline::Guard deadline(fds[0], std::chrono::milliseconds(20));
+        expect(!deadline.release(), "answered before the deadline");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    expect(::send(fds[1], "x", 1, MSG_NOSIGNAL) == 1, "disarmed socket untouched past its deadline");
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Idempotent Order Submit Regression Test ===\n";
+    Logger::init("test_order_submit", "warn");
+
+    test_client_id_format();
+    test_clean_and_refused();
+    test_dropped_response_reconciled();
+    test_dropped_request_resubmitted();
+    test_late_copy_refused_as_duplicate();
+    test_lookup_lag_and_outage();
+    test_aggressive_retries_never_double_fill();
+    test_socket_deadline();
+    test_venue_timeouts();
+    test_unknown_leg_reconciled();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: client ids, dropped acks reconciled, same-id retries, no double fills, Unknown legs reconciled ***\n";
+    return 0;
+}
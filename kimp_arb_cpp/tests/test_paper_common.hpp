@@ -0,0 +1,140 @@
+#pragma once
+
+#include "kimp/core/types.hpp"
+#include "kimp/execution/paper_execution.hpp"
+#include "kimp/exchange/bithumb/bithumb.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+#include "kimp/exchange/upbit/upbit.hpp"
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Checks, guard venues and canned books shared by the OrderManager tests that
+// run against a PaperExecution backend.
+namespace paper_test {
+
+using kimp::Exchange;
+using kimp::Order;
+using kimp::OrderBook;
+using kimp::OrderBookLevel;
+using kimp::Position;
+using kimp::Price;
+using kimp::Quantity;
+using kimp::Side;
+using kimp::SymbolId;
+using kimp::Ticker;
+using kimp::execution::PaperExecution;
+
+inline int failures = 0;
+
+inline void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+inline bool near(double a, double b, double eps = 1e-6) { return std::fabs(a - b) <= eps; }
+
+// Real order paths must never be reached while a backend is installed
+class GuardBybitExchange final : public kimp::exchange::bybit::BybitExchange {
+public:
+    explicit GuardBybitExchange(boost::asio::io_context& ioc) : kimp::exchange::bybit::BybitExchange(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    bool cancel_order(uint64_t) override { return false; }
+    bool prepare_shorting(const SymbolId&) override { return true; }
+    std::vector<Position> get_short_positions() override { return {}; }
+    bool close_short_position(const SymbolId&) override { return true; }
+    double get_balance(const std::string&) override { return 0.0; }
+
+    Order place_market_order(const SymbolId&, Side, Quantity) override { return touched(); }
+    Order place_ioc_order(const SymbolId&, Side, Quantity, Price) override { return touched(); }
+    Order open_short(const SymbolId&, Quantity) override { return touched(); }
+    Order close_short(const SymbolId&, Quantity) override { return touched(); }
+    Order open_short_ioc(const SymbolId&, Quantity, Price) override { return touched(); }
+    Order close_short_ioc(const SymbolId&, Quantity, Price) override { return touched(); }
+
+    std::atomic<int> calls{0};
+
+private:
+    Order touched() {
+        ++calls;
+        return {};
+    }
+};
+
+template <typename Base>
+class GuardKoreanExchange final : public Base {
+public:
+    explicit GuardKoreanExchange(boost::asio::io_context& ioc) : Base(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    double get_usdt_krw_price() override { return 1300.0; }
+    bool cancel_order(uint64_t) override { return false; }
+    double get_balance(const std::string&) override { return 0.0; }
+
+    Order place_market_order(const SymbolId&, Side, Quantity) override { return touched(); }
+    Order place_market_buy_cost(const SymbolId&, Price) override { return touched(); }
+    Order place_ioc_order(const SymbolId&, Side, Quantity, Price) override { return touched(); }
+    Order place_post_only_order(const SymbolId&, Side, Quantity, Price) override { return touched(); }
+
+    // Upbit's myOrder stream, fed without a socket
+    void feed_private(std::string_view message)
+        requires std::is_same_v<Base, kimp::exchange::upbit::UpbitExchange>
+    {
+        this->on_private_ws_message(message);
+    }
+
+    std::atomic<int> calls{0};
+
+private:
+    Order touched() {
+        ++calls;
+        return {};
+    }
+};
+
+using GuardBithumbExchange = GuardKoreanExchange<kimp::exchange::bithumb::BithumbExchange>;
+using GuardUpbitExchange = GuardKoreanExchange<kimp::exchange::upbit::UpbitExchange>;
+
+inline OrderBook make_book(Exchange ex, const SymbolId& symbol,
+                           std::vector<OrderBookLevel> bids, std::vector<OrderBookLevel> asks) {
+    OrderBook book;
+    book.exchange = ex;
+    book.symbol = symbol;
+    book.timestamp = std::chrono::steady_clock::now();
+    for (const auto& level : bids) book.bids[book.bid_count++] = level;
+    for (const auto& level : asks) book.asks[book.ask_count++] = level;
+    return book;
+}
+
+// Zero-latency fills with a funded book on both sides
+inline PaperExecution::Options paper_options(uint64_t seed) {
+    PaperExecution::Options options;  // Empty distributions = no latency
+    options.seed = seed;
+    options.initial_krw = 10'000'000.0;
+    options.initial_usdt = 1'000.0;
+    return options;
+}
+
+} // namespace paper_test
@@ -0,0 +1,179 @@
+#include "test_paper_common.hpp"
+
+#include "kimp/execution/order_manager.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+
+#include <boost/asio.hpp>
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+using namespace paper_test;
+
+namespace {
+
+namespace net = boost::asio;
+
+PaperExecution::Options zero_latency_options() {
+    auto options = paper_options(7);
+    options.beyond_depth_slippage_bps = 10.0;
+    return options;
+}
+
+void test_book_walks() {
+    const std::vector<OrderBookLevel> asks{{100.0, 1.0}, {101.0, 0.0}, {102.0, 2.0}};
+
+    auto inside = PaperExecution::walk_quantity(asks.data(), asks.size(), 2.0, 10.0, true);
+    expect(near(inside.quantity, 2.0) && near(inside.average_price, 101.0), "quantity walk averages levels");
+    expect(!inside.beyond_depth, "covered walk is within depth");
+
+    auto beyond = PaperExecution::walk_quantity(asks.data(), asks.size(), 4.0, 10.0, true);
+    expect(beyond.beyond_depth, "walk past the book flags beyond depth");
+    expect(near(beyond.notional, 100.0 + 204.0 + 102.0 * 1.001), "residual priced at last level plus slippage");
+
+    const std::vector<OrderBookLevel> bids{{99.0, 1.0}, {98.0, 1.0}};
+    auto sell = PaperExecution::walk_quantity(bids.data(), bids.size(), 3.0, 10.0, false);
+    expect(near(sell.notional, 99.0 + 98.0 + 98.0 * 0.999), "sell residual slips downward");
+
+    auto cost = PaperExecution::walk_cost(asks.data(), asks.size(), 304.0, 10.0);
+    expect(near(cost.quantity, 3.0) && near(cost.notional, 304.0), "cost walk spends exactly the budget");
+    expect(!cost.beyond_depth, "cost walk within depth");
+
+    auto empty = PaperExecution::walk_quantity(nullptr, 0, 1.0, 10.0, true);
+    expect(empty.quantity == 0.0, "empty book does not fill");
+}
+
+void test_latency_distribution() {
+    LatencyDistribution dist({{0.99, 100.0}, {0.0, 10.0}, {0.5, 20.0}});
+    expect(near(dist.quantile_ms(0.0), 10.0), "lowest knot");
+    expect(near(dist.quantile_ms(0.25), 15.0), "linear between knots");
+    expect(near(dist.quantile_ms(0.5), 20.0), "median knot");
+    expect(near(dist.quantile_ms(1.0), 100.0), "clamped above the last knot");
+    expect(LatencyDistribution{}.quantile_ms(0.7) == 0.0, "empty distribution is zero latency");
+}
+
+void test_fills_and_balances() {
+    const SymbolId krw("XRP", "KRW");
+    const SymbolId usdt("XRP", "USDT");
+    PaperExecution paper(nullptr, zero_latency_options());
+    paper.on_orderbook(make_book(Exchange::Bithumb, krw, {{999.0, 50.0}}, {{1000.0, 30.0}, {1001.0, 100.0}}));
+    paper.on_orderbook(make_book(Exchange::Bybit, usdt, {{0.77, 500.0}}, {{0.78, 500.0}}));
+
+    Order buy = paper.korean_buy(Exchange::Bithumb, krw, 40.0, 0.0);
+    expect(buy.status == OrderStatus::Filled, "korean buy filled");
+    expect(buy.order_id_str.rfind("paper-", 0) == 0, "paper order id");
+    expect(buy.filled_quantity == 0.0 && buy.average_price == 0.0, "fill details withheld until query");
+    paper.query_korean_fill(Exchange::Bithumb, krw, buy);
+    expect(near(buy.filled_quantity, 40.0), "queried fill quantity");
+    expect(near(buy.average_price, (30.0 * 1000.0 + 10.0 * 1001.0) / 40.0), "queried fill walks the asks");
+
+    const double fee = buy.average_price * 40.0 * TradingConfig::get_korean_fee_rate(Exchange::Bithumb);
+    expect(near(paper.balance(Exchange::Bithumb, "KRW"), 10'000'000.0 - 40'010.0 - fee), "KRW charged with fee");
+    expect(near(paper.balance(Exchange::Bithumb, "XRP"), 40.0), "coins credited");
+
+    Order shortsale = paper.foreign_short(Exchange::Bybit, usdt, 40.0);
+    paper.query_foreign_fill(Exchange::Bybit, shortsale);
+    expect(near(shortsale.average_price, 0.77), "short sells into the bid");
+    expect(near(paper.balance(Exchange::Bybit, "XRP"), -40.0), "short is a negative coin balance");
+
+    Order oversell = paper.korean_sell(Exchange::Bithumb, krw, 41.0);
+    expect(oversell.status == OrderStatus::Rejected, "selling more than held is rejected");
+
+    Order overbuy = paper.foreign_cover(Exchange::Bybit, usdt, 5'000.0);
+    expect(overbuy.status == OrderStatus::Rejected, "cover beyond USDT balance is rejected");
+
+    const auto stats = paper.stats();
+    expect(stats.orders == 4 && stats.rejected == 2, "order and reject counters");
+    expect(stats.fees_krw > 0.0 && stats.fees_usdt > 0.0, "fees accounted per currency");
+}
+
+void test_bbo_fallback() {
+    const SymbolId usdt("SOL", "USDT");
+    strategy::PriceCache prices;
+    prices.update(Exchange::OKX, usdt, 150.0, 150.1, 150.05, 0, 2.0, 0.0);
+
+    PaperExecution paper(&prices, zero_latency_options());
+    Order order = paper.foreign_short(Exchange::OKX, usdt, 3.0);
+    paper.query_foreign_fill(Exchange::OKX, order);
+    expect(order.status == OrderStatus::Filled, "BBO fallback fills");
+    expect(near(order.average_price, (2.0 * 150.0 + 150.0 * 0.999) / 3.0), "BBO size limits the top level");
+
+    Order cover = paper.foreign_cover(Exchange::OKX, usdt, 3.0);
+    paper.query_foreign_fill(Exchange::OKX, cover);
+    expect(near(cover.average_price, 150.1), "unknown ask size treated as unlimited");
+
+    const auto stats = paper.stats();
+    expect(stats.bbo_fallbacks == 2 && stats.beyond_depth == 1, "fallback and beyond-depth counters");
+
+    Order missing = paper.foreign_short(Exchange::OKX, SymbolId("ADA", "USDT"), 1.0);
+    expect(missing.status == OrderStatus::Rejected, "no book and no BBO rejects");
+}
+
+void test_order_manager_exit() {
+    net::io_context ioc;
+    auto bithumb = std::make_shared<GuardBithumbExchange>(ioc);
+    auto bybit = std::make_shared<GuardBybitExchange>(ioc);
+
+    const SymbolId symbol("BTC", "KRW");
+    auto paper = std::make_shared<PaperExecution>(nullptr, zero_latency_options());
+    paper->on_orderbook(make_book(Exchange::Bithumb, symbol, {{13100.0, 100.0}}, {{13110.0, 100.0}}));
+    paper->on_orderbook(make_book(Exchange::Bybit, SymbolId("BTC", "USDT"), {{9.4, 100.0}}, {{9.5, 100.0}}));
+
+    OrderManager manager;
+    manager.set_exchange(Exchange::Bithumb, bithumb);
+    manager.set_exchange(Exchange::Bybit, bybit);
+    manager.set_execution_backend(paper);
+    expect(manager.is_paper(), "backend installed");
+
+    Position position;
+    position.symbol = symbol;
+    position.korean_exchange = Exchange::Bithumb;
+    position.foreign_exchange = Exchange::Bybit;
+    position.korean_amount = 10.0;
+    position.foreign_amount = 10.0;
+    position.korean_entry_price = 10000.0;
+    position.foreign_entry_price = 10.0;
+    position.position_size_usd = 100.0;
+    position.is_active = true;
+    paper->seed_position(position);
+
+    ExitSignal signal;
+    signal.symbol = symbol;
+    signal.korean_exchange = position.korean_exchange;
+    signal.foreign_exchange = position.foreign_exchange;
+    signal.premium = 0.7692307692;
+    signal.korean_bid = 13100.0;
+    signal.foreign_ask = 10.0;
+    signal.usdt_krw_rate = 1300.0;
+
+    const auto result = manager.execute_spot_relay_exit(signal, position);
+    const double expected_pnl = (13100.0 - 10000.0) * 10.0 + (10.0 - 9.5) * 1300.0 * 10.0;
+
+    expect(result.success && !result.position.is_active, "paper exit closes the position");
+    expect(near(result.position.realized_pnl_krw, expected_pnl), "exit P&L from simulated fills");
+    expect(bithumb->calls == 0 && bybit->calls == 0, "no real order reached the venues");
+    expect(near(paper->balance(Exchange::Bithumb, "BTC"), 0.0), "Korean coins sold");
+    expect(near(paper->balance(Exchange::Bybit, "BTC"), 0.0), "short covered");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Paper Execution Regression Test ===\n";
+
+    test_book_walks();
+    test_latency_distribution();
+    test_fills_and_balances();
+    test_bbo_fallback();
+    test_order_manager_exit();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: paper execution fills, balances and OrderManager routing ***\n";
+    return 0;
+}
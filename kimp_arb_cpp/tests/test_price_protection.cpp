@@ -0,0 +1,503 @@
+#include "test_paper_common.hpp"
+
+#include "kimp/core/logger.hpp"
+#include "kimp/core/price_format.hpp"
+#include "kimp/execution/order_manager.hpp"
+#include "kimp/exchange/okx/okx.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+
+#include <boost/asio.hpp>
+#include <simdjson.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::execution;
+using namespace paper_test;
+
+namespace {
+
+namespace net = boost::asio;
+
+constexpr double UPBIT_FEE = TradingConfig::UPBIT_FEE_RATE;
+constexpr double BYBIT_FEE = TradingConfig::BYBIT_FEE_RATE;
+
+OrderManager::PriceProtection protection() {
+    OrderManager::PriceProtection guard;
+    guard.enabled = true;
+    guard.band_bps = 15.0;
+    guard.reprice_attempts = 2;
+    return guard;
+}
+
+void test_tick_rounding() {
+    using format::krw_tick_size;
+    using format::round_limit_to_tick;
+    expect(krw_tick_size(13150.0) == 10.0 && krw_tick_size(1500.0) == 1.0 && krw_tick_size(0.5) == 0.001,
+           "KRW tick grid");
+    expect(near(round_limit_to_tick(13169.7, 10.0, true), 13160.0), "buy limit rounds down");
+    expect(near(round_limit_to_tick(13130.3, 10.0, false), 13140.0), "sell limit rounds up");
+    expect(near(round_limit_to_tick(13160.0, 10.0, true), 13160.0), "on-grid price unchanged");
+    expect(near(round_limit_to_tick(0.004, 0.01, true), 0.01), "never rounds to zero");
+    expect(near(round_limit_to_tick(1.2345, 0.0, true), 1.2345), "no tick leaves the price");
+}
+
+void test_walk_limit_never_crosses() {
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> step(0.0, 2.0);
+    std::uniform_real_distribution<double> size(0.0, 5.0);
+    std::uniform_real_distribution<double> want(0.1, 40.0);
+    bool bounded = true;
+    bool complete = true;
+    for (int round = 0; round < 2000; ++round) {
+        const bool buy = round % 2 == 0;
+        std::vector<OrderBookLevel> levels(12);
+        double price = 1000.0;
+        for (auto& level : levels) {
+            price += buy ? step(rng) : -step(rng);
+            level = {price, size(rng)};
+        }
+        const double limit = 1000.0 + (buy ? 1.0 : -1.0) * step(rng) * 6.0;
+        const double qty = want(rng);
+        const auto fill = PaperExecution::walk_limit(levels.data(), levels.size(), qty, limit, buy);
+        if (fill.quantity > 0.0 && (buy ? fill.average_price > limit : fill.average_price < limit)) {
+            bounded = false;
+        }
+        double inside = 0.0;
+        for (const auto& level : levels) {
+            if (buy ? level.price <= limit : level.price >= limit) inside += level.quantity;
+        }
+        if (!near(fill.quantity, std::min(qty, inside), 1e-9)) {
+            complete = false;
+        }
+    }
+    expect(bounded, "IOC fills never average past the limit");
+    expect(complete, "IOC fills take every level inside the limit and nothing more");
+}
+
+void test_paper_ioc_orders() {
+    const SymbolId symbol("BTC", "USDT");
+    PaperExecution paper(nullptr, paper_options(23));
+    paper.on_orderbook(make_book(Exchange::Bybit, symbol, {{9.4, 100.0}}, {{9.5, 2.0}, {9.6, 100.0}}));
+
+    Order partial = paper.foreign_cover_ioc(Exchange::Bybit, symbol, 5.0, 9.55);
+    expect(partial.status == OrderStatus::Filled && partial.type == OrderType::Limit, "IOC acked as accepted");
+    expect(near(partial.quantity, 5.0), "ack keeps the requested quantity");
+    paper.query_foreign_fill(Exchange::Bybit, partial);
+    expect(near(partial.filled_quantity, 2.0) && near(partial.average_price, 9.5), "fill stops at the limit");
+    expect(near(paper.balance(Exchange::Bybit, "BTC"), 2.0), "only the crossed part settles");
+
+    Order none = paper.foreign_short_ioc(Exchange::Bybit, symbol, 1.0, 9.45);
+    expect(none.status == OrderStatus::Filled, "zero-fill IOC is still accepted");
+    paper.query_foreign_fill(Exchange::Bybit, none);
+    expect(none.filled_quantity == 0.0, "zero-fill IOC resolves to nothing");
+    const auto stats = paper.stats();
+    expect(stats.ioc_zero_fills == 1 && stats.rejected == 0, "zero fill counted apart from rejects");
+    expect(paper.supports_ioc(Exchange::Upbit) && !paper.supports_ioc(Exchange::Bithumb),
+           "Bithumb stays market as live");
+}
+
+Position seeded_position(const SymbolId& symbol, double coins) {
+    Position position;
+    position.symbol = symbol;
+    position.korean_exchange = Exchange::Upbit;
+    position.foreign_exchange = Exchange::Bybit;
+    position.korean_amount = coins;
+    position.foreign_amount = coins;
+    position.korean_entry_price = 10000.0;
+    position.foreign_entry_price = 10.0;
+    position.position_size_usd = coins * 10.0;
+    position.is_active = true;
+    return position;
+}
+
+ExitSignal exit_signal(const Position& position) {
+    ExitSignal signal;
+    signal.symbol = position.symbol;
+    signal.korean_exchange = position.korean_exchange;
+    signal.foreign_exchange = position.foreign_exchange;
+    signal.premium = 6.5;
+    signal.korean_bid = 13150.0;
+    signal.foreign_ask = 9.5;
+    signal.usdt_krw_rate = 1300.0;
+    return signal;
+}
+
+struct Venues {
+    net::io_context ioc;
+    std::shared_ptr<GuardUpbitExchange> upbit = std::make_shared<GuardUpbitExchange>(ioc);
+    std::shared_ptr<GuardBybitExchange> bybit = std::make_shared<GuardBybitExchange>(ioc);
+
+    void install(OrderManager& manager, std::shared_ptr<PaperExecution> paper) {
+        manager.set_exchange(Exchange::Upbit, upbit);
+        manager.set_exchange(Exchange::Bybit, bybit);
+        manager.set_execution_backend(std::move(paper));
+        manager.set_price_protection(protection());
+    }
+};
+
+void test_thin_books_unwound() {
+    // Cover: 2.5 coins inside the band, then a wall 5% higher. Sell: 1 coin at
+    // the bid, then a gap 9% lower. No engine: nothing to re-price against.
+    const SymbolId symbol("BTC", "KRW");
+    auto paper = std::make_shared<PaperExecution>(nullptr, paper_options(23));
+    paper->on_orderbook(make_book(Exchange::Upbit, symbol, {{13150.0, 1.0}, {12000.0, 100.0}}, {{13160.0, 100.0}}));
+    paper->on_orderbook(make_book(Exchange::Bybit, SymbolId("BTC", "USDT"), {{9.4, 100.0}},
+                                  {{9.5, 2.5}, {10.0, 100.0}}));
+
+    Venues venues;
+    OrderManager manager;
+    venues.install(manager, paper);
+    const Position position = seeded_position(symbol, 4.0);
+    paper->seed_position(position);
+
+    const auto result = manager.execute_spot_relay_exit(exit_signal(position), position);
+    expect(result.success && !result.position.is_active, "thin-book exit closes the position");
+    expect(near(paper->balance(Exchange::Bybit, "BTC"), 0.0) && near(paper->balance(Exchange::Upbit, "BTC"), 0.0),
+           "both legs closed the same size");
+    // Every cover crossed at 9.5: none reached the 10.0 wall past the band
+    expect(near(paper->balance(Exchange::Bybit, "USDT"), 1000.0 - 4.0 * 9.5 * (1.0 + BYBIT_FEE)),
+           "foreign leg stayed inside the band");
+    // Each IOC sells the 1 coin at the bid; the market unwind walks the
+    // (unconsumed) snapshot again: 1 + 0.5 past the gap, then the last 0.5
+    expect(near(paper->balance(Exchange::Upbit, "KRW"), 10'000'000.0 + (3.5 * 13150.0 + 0.5 * 12000.0) * (1.0 - UPBIT_FEE)),
+           "Korean remainder unwound so the hedge stays flat");
+    expect(paper->stats().beyond_depth == 0 && paper->stats().rejected == 0, "no order walked past visible depth");
+    expect(venues.upbit->calls == 0 && venues.bybit->calls == 0, "no real order reached the venues");
+}
+
+void test_korean_remainder_repriced() {
+    const SymbolId symbol("BTC", "KRW");
+    strategy::ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Upbit, Exchange::Bybit);
+    engine.get_price_cache().update(Exchange::Upbit, symbol, 13150.0, 13160.0, 13155.0, 0, 1.0, 100.0);
+    engine.get_price_cache().update(Exchange::Bybit, SymbolId("BTC", "USDT"), 9.49, 9.5, 9.495, 0, 100.0, 100.0);
+
+    auto paper = std::make_shared<PaperExecution>(nullptr, paper_options(23));
+    paper->on_orderbook(make_book(Exchange::Upbit, symbol, {{13150.0, 1.0}, {12000.0, 100.0}}, {{13160.0, 100.0}}));
+    paper->on_orderbook(make_book(Exchange::Bybit, SymbolId("BTC", "USDT"), {{9.49, 100.0}}, {{9.5, 100.0}}));
+
+    Venues venues;
+    OrderManager manager;
+    venues.install(manager, paper);
+    manager.set_engine(&engine);
+    const Position position = seeded_position(symbol, 2.5);
+    paper->seed_position(position);
+
+    // One coin crosses per IOC: the first sell and two re-prices at the latest bid
+    const auto result = manager.execute_spot_relay_exit(exit_signal(position), position);
+    expect(result.success && !result.position.is_active, "re-priced exit closes the position");
+    expect(near(paper->balance(Exchange::Upbit, "BTC"), 0.0) && near(paper->balance(Exchange::Bybit, "BTC"), 0.0),
+           "re-prices sold the whole leg");
+    expect(near(paper->balance(Exchange::Upbit, "KRW"), 10'000'000.0 + 2.5 * 13150.0 * (1.0 - UPBIT_FEE)),
+           "no coin sold below the band");
+    const double expected_pnl = 2.5 * (13150.0 - 10000.0) + 2.5 * (10.0 - 9.5) * 1300.0;
+    expect(near(result.position.realized_pnl_krw, expected_pnl), "merged Korean leg priced at the children's VWAP");
+}
+
+void test_zero_fill_waits_for_update() {
+    // Nothing inside the band at first: the cover crosses nothing and the
+    // exit retries on the next update instead of sweeping the 10.0 wall
+    const SymbolId symbol("BTC", "KRW");
+    const SymbolId foreign("BTC", "USDT");
+    auto paper = std::make_shared<PaperExecution>(nullptr, paper_options(23));
+    paper->on_orderbook(make_book(Exchange::Upbit, symbol, {{13150.0, 100.0}}, {{13160.0, 100.0}}));
+    paper->on_orderbook(make_book(Exchange::Bybit, foreign, {{9.4, 100.0}}, {{10.0, 100.0}}));
+
+    Venues venues;
+    OrderManager manager;
+    venues.install(manager, paper);
+    const Position position = seeded_position(symbol, 3.0);
+    paper->seed_position(position);
+
+    ExecutionResult result;
+    std::thread exit_thread([&] { result = manager.execute_spot_relay_exit(exit_signal(position), position); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(3 * TradingConfig::ORDER_INTERVAL_MS));
+    expect(paper->stats().ioc_zero_fills >= 1, "out-of-band cover crossed nothing");
+    expect(near(paper->balance(Exchange::Upbit, "BTC"), 3.0), "Korean leg waits for the foreign fill");
+    paper->on_orderbook(make_book(Exchange::Bybit, foreign, {{9.4, 100.0}}, {{9.5, 100.0}}));
+    exit_thread.join();
+
+    expect(result.success && !result.position.is_active, "exit completes once the book comes back");
+    expect(near(paper->balance(Exchange::Bybit, "USDT"), 1000.0 - 3.0 * 9.5 * (1.0 + BYBIT_FEE)),
+           "cover filled at the in-band price");
+    expect(near(paper->balance(Exchange::Upbit, "BTC"), 0.0), "Korean leg sold after the cover");
+}
+
+ExchangeCredentials keyed_credentials() {
+    ExchangeCredentials creds;
+    creds.api_key = "key";
+    creds.secret_key = "secret";
+    return creds;
+}
+
+// Live venues whose IOC acks resolve through the fill query
+class AckingUpbitExchange final : public exchange::upbit::UpbitExchange {
+public:
+    explicit AckingUpbitExchange(net::io_context& ioc) : exchange::upbit::UpbitExchange(ioc, keyed_credentials()) {
+        set_rest_transport([this](exchange::http::verb, const std::string& target, const std::string&,
+                                  std::chrono::milliseconds) { return answer(target); });
+    }
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    double get_usdt_krw_price() override { return 1300.0; }
+    bool cancel_order(uint64_t) override { return false; }
+    double get_balance(const std::string&) override { return 0.0; }
+
+    Order place_ioc_order(const SymbolId& symbol, Side side, Quantity quantity, Price limit_price) override {
+        Order order;
+        order.exchange = Exchange::Upbit;
+        order.symbol = symbol;
+        order.side = side;
+        order.type = OrderType::Limit;
+        order.status = OrderStatus::Filled;  // Accepted; the fill query tells what crossed
+        order.quantity = quantity;
+        order.price = limit_price;
+        order.order_id_str = "up-" + std::to_string(requested_.size());
+        requested_[order.order_id_str] = quantity;
+        return order;
+    }
+
+    Order place_market_order(const SymbolId& symbol, Side side, Quantity quantity) override {
+        market_sold += quantity;
+        Order order;
+        order.exchange = Exchange::Upbit;
+        order.symbol = symbol;
+        order.side = side;
+        order.type = OrderType::Market;
+        order.status = OrderStatus::Filled;
+        order.quantity = quantity;
+        order.filled_quantity = quantity;
+        order.average_price = 13150.0;
+        return order;
+    }
+
+    int failed_queries{0};
+    double ioc_sold{0.0};
+    double market_sold{0.0};
+
+private:
+    // The first query of each IOC goes unanswered; half of each IOC crosses
+    exchange::HttpResponse answer(const std::string& target) {
+        exchange::HttpResponse response;
+        const std::string uuid = target.substr(target.find("uuid=") + 5);
+        if (queried_.insert(uuid).second) {
+            ++failed_queries;
+            response.error = "Request timed out after 3000ms";
+            return response;
+        }
+        const double executed = requested_[uuid] / 2.0;
+        ioc_sold += executed;
+        response.status_code = 200;
+        response.success = true;
+        response.body = "{\"uuid\":\"" + uuid + "\",\"side\":\"ask\",\"ord_type\":\"limit\",\"state\":\"cancel\","
+                        "\"price\":\"13150\",\"volume\":\"" + std::to_string(requested_[uuid]) + "\","
+                        "\"executed_volume\":\"" + std::to_string(executed) + "\",\"remaining_volume\":\"" +
+                        std::to_string(executed) + "\",\"trades\":[{\"price\":\"13150\",\"volume\":\"" +
+                        std::to_string(executed) + "\"}]}";
+        return response;
+    }
+
+    std::map<std::string, double> requested_;
+    std::set<std::string> queried_;
+};
+
+class FilledBybitExchange final : public exchange::bybit::BybitExchange {
+public:
+    explicit FilledBybitExchange(net::io_context& ioc) : exchange::bybit::BybitExchange(ioc, {}) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    void subscribe_ticker(const std::vector<SymbolId>&) override {}
+    void subscribe_orderbook(const std::vector<SymbolId>&) override {}
+    std::vector<SymbolId> get_available_symbols() override { return {}; }
+    std::vector<Ticker> fetch_all_tickers() override { return {}; }
+    bool cancel_order(uint64_t) override { return false; }
+    double get_balance(const std::string&) override { return 0.0; }
+
+    Order close_short(const SymbolId& symbol, Quantity quantity) override { return cover(symbol, quantity); }
+    Order close_short_ioc(const SymbolId& symbol, Quantity quantity, Price) override { return cover(symbol, quantity); }
+
+    double covered{0.0};
+
+private:
+    Order cover(const SymbolId& symbol, Quantity quantity) {
+        covered += quantity;
+        Order order;
+        order.exchange = Exchange::Bybit;
+        order.symbol = symbol;
+        order.side = Side::Buy;
+        order.type = OrderType::Market;
+        order.status = OrderStatus::Filled;
+        order.quantity = quantity;
+        order.filled_quantity = quantity;
+        order.average_price = 9.5;
+        return order;
+    }
+};
+
+void test_fill_query_failure() {
+    // An unanswered fill query must not read the IOC as fully filled: the
+    // Korean leg would stop selling with half the coins still held
+    net::io_context ioc;
+    auto upbit = std::make_shared<AckingUpbitExchange>(ioc);
+    auto bybit = std::make_shared<FilledBybitExchange>(ioc);
+    OrderManager manager;
+    manager.set_exchange(Exchange::Upbit, upbit);
+    manager.set_exchange(Exchange::Bybit, bybit);
+    manager.set_price_protection(protection());
+
+    const Position position = seeded_position(SymbolId("BTC", "KRW"), 4.0);
+    const auto result = manager.execute_spot_relay_exit(exit_signal(position), position);
+    expect(result.success && !result.position.is_active, "exit completes");
+    expect(upbit->failed_queries >= 1, "fill queries went unanswered");
+    expect(near(upbit->ioc_sold + upbit->market_sold, bybit->covered), "Korean leg sold what was covered");
+    expect(upbit->market_sold > 0.0, "unfilled IOC remainder unwound, not assumed sold");
+}
+
+// Keeps each POST body and acks it; GETs get the canned fill reply
+struct CapturingRest {
+    CapturingRest(std::string ack_body, std::string fill_body)
+        : ack(std::move(ack_body)), fill(std::move(fill_body)) {}
+
+    std::string ack;
+    std::string fill;
+    std::vector<std::string> bodies;
+
+    exchange::RestClient::Transport transport() {
+        return [this](exchange::http::verb method, const std::string&, const std::string& body,
+                      std::chrono::milliseconds) {
+            exchange::HttpResponse response;
+            response.status_code = 200;
+            response.success = true;
+            if (method == exchange::http::verb::post) {
+                bodies.push_back(body);
+                response.body = ack;
+            } else {
+                response.body = fill;
+            }
+            return response;
+        };
+    }
+};
+
+// String field of the first POST body ("" when absent or not JSON)
+std::string field(simdjson::dom::parser& parser, const CapturingRest& rest, const char* key) {
+    simdjson::dom::element body;
+    std::string_view value;
+    if (rest.bodies.empty() || parser.parse(rest.bodies.front()).get(body) != simdjson::SUCCESS ||
+        body[key].get(value) != simdjson::SUCCESS) {
+        return {};
+    }
+    return std::string(value);
+}
+
+void test_ioc_request_bodies() {
+    net::io_context ioc;
+    simdjson::dom::parser parser;
+    const SymbolId foreign("BTC", "USDT");
+
+    exchange::bybit::BybitExchange bybit(ioc, keyed_credentials());
+    CapturingRest bybit_rest(R"({"retCode":0,"retMsg":"OK","result":{"orderId":"bb-1"}})", "");
+    bybit.set_rest_transport(bybit_rest.transport());
+    const Order bybit_order = bybit.place_ioc_order(foreign, Side::Buy, 0.5, 9.5);
+    auto bybit_field = [&](const char* key) { return field(parser, bybit_rest, key); };
+    expect(bybit_order.type == OrderType::Limit && bybit_order.order_id_str == "bb-1", "Bybit IOC acked");
+    expect(bybit_rest.bodies.size() == 1, "Bybit IOC posted once");
+    expect(bybit_field("orderType") == "Limit" && bybit_field("timeInForce") == "IOC",
+           "Bybit: limit order, timeInForce IOC");
+    expect(bybit_field("price") == "9.5" && bybit_field("side") == "Buy" &&
+           near(std::atof(bybit_field("qty").c_str()), 0.5), "Bybit: price, side and qty");
+    expect(bybit_field("orderLinkId") == bybit_order.client_id, "Bybit: orderLinkId is the client id");
+    expect(bybit_field("marketUnit").empty(), "Bybit: no market-order fields");
+
+    exchange::okx::OkxExchange okx(ioc, keyed_credentials());
+    CapturingRest okx_rest(R"({"code":"0","msg":"","data":[{"ordId":"ok-1","sCode":"0","sMsg":""}]})", "");
+    okx.set_rest_transport(okx_rest.transport());
+    const Order okx_order = okx.place_ioc_order(foreign, Side::Sell, 0.5, 9.5);
+    auto okx_field = [&](const char* key) { return field(parser, okx_rest, key); };
+    expect(okx_order.type == OrderType::Limit && okx_order.order_id_str == "ok-1", "OKX IOC acked");
+    expect(okx_field("ordType") == "ioc" && okx_field("px") == "9.5", "OKX: ordType ioc at px");
+    expect(okx_field("side") == "sell" && okx_field("clOrdId") == okx_order.client_id, "OKX: side and clOrdId");
+    expect(near(std::atof(okx_field("sz").c_str()), 0.5), "OKX: size");
+
+    exchange::upbit::UpbitExchange upbit(ioc, keyed_credentials());
+    CapturingRest upbit_rest(R"({"uuid":"up-1","side":"ask","ord_type":"limit","state":"wait","price":"13150",)"
+                             R"("volume":"2","executed_volume":"0","remaining_volume":"2"})", "");
+    upbit.set_rest_transport(upbit_rest.transport());
+    const Order upbit_order = upbit.place_ioc_order(SymbolId("BTC", "KRW"), Side::Sell, 2.0, 13150.0);
+    auto upbit_field = [&](const char* key) { return field(parser, upbit_rest, key); };
+    expect(upbit_order.type == OrderType::Limit && upbit_order.order_id_str == "up-1", "Upbit IOC acked");
+    expect(upbit_field("ord_type") == "limit" && upbit_field("time_in_force") == "ioc",
+           "Upbit: limit order, time_in_force ioc");
+    expect(upbit_field("price") == "13150" && upbit_field("volume") == "2" && upbit_field("side") == "ask" &&
+           upbit_field("market") == "KRW-BTC", "Upbit: price, volume, side and market");
+    expect(upbit_field("identifier") == upbit_order.client_id, "Upbit: identifier is the client id");
+}
+
+void test_bybit_ioc_fill_status() {
+    net::io_context ioc;
+    exchange::bybit::BybitExchange bybit(ioc, keyed_credentials());
+
+    // Partly crossed, remainder cancelled: the cumulative fill is what counts
+    CapturingRest partial("", R"({"retCode":0,"result":{"list":[{"orderId":"bb-1",)"
+                              R"("orderStatus":"PartiallyFilledCanceled","avgPrice":"9.48","cumExecQty":"0.2"}]}})");
+    bybit.set_rest_transport(partial.transport());
+    Order order;
+    order.type = OrderType::Limit;
+    order.quantity = 0.5;
+    expect(bybit.query_order_fill("bb-1", order), "PartiallyFilledCanceled is terminal");
+    expect(near(order.filled_quantity, 0.2) && near(order.average_price, 9.48),
+           "PartiallyFilledCanceled reports the crossed part");
+
+    // Nothing crossed: terminal, with no fill to read
+    CapturingRest none("", R"({"retCode":0,"result":{"list":[{"orderId":"bb-2",)"
+                           R"("orderStatus":"Cancelled","avgPrice":"","cumExecQty":"0"}]}})");
+    bybit.set_rest_transport(none.transport());
+    Order empty;
+    empty.type = OrderType::Limit;
+    empty.quantity = 0.5;
+    expect(bybit.query_order_fill("bb-2", empty), "Cancelled IOC is terminal");
+    expect(empty.filled_quantity == 0.0, "Cancelled IOC filled nothing");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Price-Protected IOC Legs Regression Test ===\n";
+    Logger::init("test_price_protection", "warn");
+
+    test_tick_rounding();
+    test_walk_limit_never_crosses();
+    test_paper_ioc_orders();
+    test_thin_books_unwound();
+    test_korean_remainder_repriced();
+    test_zero_fill_waits_for_update();
+    test_fill_query_failure();
+    test_ioc_request_bodies();
+    test_bybit_ioc_fill_status();
+
+    Logger::shutdown();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: tick rounding, bounded IOC fills, thin-book unwind, re-pricing, zero-fill retry, unknown fills re-queried, venue IOC bodies ***\n";
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "kimp/network/timestamped_tcp_stream.hpp"
+#include "kimp/network/websocket_client.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+#include "kimp/core/config.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+namespace net = boost::asio;
+using tcp = net::ip::tcp;
+using kimp::network::FrameRxInfo;
+using kimp::network::TimestampedTcpStream;
+using kimp::network::WebSocketClient;
+
+class TestBybitExchange : public kimp::exchange::bybit::BybitExchange {
+public:
+    using kimp::exchange::bybit::BybitExchange::BybitExchange;
+    using kimp::exchange::bybit::BybitExchange::on_ws_message;
+    using kimp::exchange::bybit::BybitExchange::record_rx_queue_delay;
+};
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+int64_t realtime_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+struct LoopbackPair {
+    net::io_context io_context;
+    tcp::acceptor acceptor{io_context, tcp::endpoint(net::ip::address_v4::loopback(), 0)};
+    tcp::socket server{io_context};
+    TimestampedTcpStream client{io_context};
+
+    LoopbackPair() {
+        client.socket().connect(acceptor.local_endpoint());
+        acceptor.accept(server);
+    }
+};
+
+void test_queued_frame_keeps_kernel_time() {
+    LoopbackPair pair;
+    if (!pair.client.enable_rx_timestamps()) {
+        std::cout << "  (kernel RX timestamps unsupported here, skipping socket checks)\n";
+        return;
+    }
+
+    const int64_t sent_ns = realtime_now_ns();
+    net::write(pair.server, net::buffer(std::string("hello")));
+    // Data sits in the socket queue while the "io thread" is busy
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    char buf[64];
+    std::size_t got = 0;
+    int64_t handler_ns = 0;
+    boost::beast::error_code read_ec;
+    pair.client.async_read_some(net::buffer(buf), [&](boost::beast::error_code ec, std::size_t n) {
+        read_ec = ec;
+        got = n;
+        handler_ns = realtime_now_ns();
+    });
+    pair.io_context.run();
+
+    const int64_t kernel_ns = pair.client.last_rx_realtime_ns();
+    expect(!read_ec && got == 5, "queued bytes read");
+    expect(kernel_ns != 0, "kernel RX timestamp captured");
+    expect(kernel_ns >= sent_ns - 1'000'000 && kernel_ns <= sent_ns + 10'000'000,
+           "timestamp is arrival time, not read time");
+    expect(handler_ns - kernel_ns >= 25'000'000, "socket-to-handler delay includes queueing");
+}
+
+void test_waiting_read_and_eof() {
+    LoopbackPair pair;
+    if (!pair.client.enable_rx_timestamps()) {
+        return;
+    }
+
+    char buf[64];
+    std::size_t got = 0;
+    int64_t handler_ns = 0;
+    boost::beast::error_code read_ec;
+    pair.client.async_read_some(net::buffer(buf), [&](boost::beast::error_code ec, std::size_t n) {
+        read_ec = ec;
+        got = n;
+        handler_ns = realtime_now_ns();
+    });
+
+    net::steady_timer timer(pair.io_context, std::chrono::milliseconds(10));
+    timer.async_wait([&](boost::beast::error_code) {
+        net::write(pair.server, net::buffer(std::string("frame")));
+    });
+    pair.io_context.run();
+
+    expect(!read_ec && got == 5, "read completes once data arrives");
+    expect(pair.client.last_rx_realtime_ns() != 0 &&
+           handler_ns - pair.client.last_rx_realtime_ns() < 10'000'000,
+           "idle reader wakes promptly");
+
+    pair.server.close();
+    pair.io_context.restart();
+    pair.client.async_read_some(net::buffer(buf), [&](boost::beast::error_code ec, std::size_t n) {
+        read_ec = ec;
+        got = n;
+    });
+    pair.io_context.run();
+    expect(read_ec == net::error::eof && got == 0, "peer close reported as eof");
+}
+
+void test_ticker_carries_frame_rx() {
+    boost::asio::io_context io_context;
+    kimp::ExchangeCredentials creds;
+    TestBybitExchange exchange(io_context, creds);
+
+    kimp::Ticker seen;
+    exchange.set_ticker_callback([&](const kimp::Ticker& ticker) { seen = ticker; });
+
+    const std::string frame =
+        R"({"topic":"orderbook.1.BTCUSDT","ts":1773342407942,"type":"snapshot","data":{"s":"BTCUSDT","b":[["69904.3","0.5"]],"a":[["69904.4","0.4"]],"u":1,"seq":7},"cts":1773342407934})";
+
+    const int64_t kernel_ns = realtime_now_ns() - 40'000;
+    {
+        WebSocketClient::FrameRxScope scope(FrameRxInfo{kernel_ns, kernel_ns + 15'000});
+        exchange.record_rx_queue_delay();
+        exchange.on_ws_message(frame);
+    }
+    expect(seen.kernel_rx_ns == kernel_ns, "ticker carries kernel RX time");
+    expect(seen.rx_queue_ns == 15'000, "ticker carries socket-to-handler delay");
+    expect(!WebSocketClient::current_frame_rx().valid(), "frame timing cleared after delivery");
+
+    exchange.on_ws_message(frame);
+    expect(seen.kernel_rx_ns == 0, "frames without kernel time stay unstamped");
+
+    const auto stats = exchange.get_rx_queue_stats();
+    expect(stats.frames == 1, "per-venue queue delay counted");
+    expect(stats.max_us == 15.0 && stats.p99_us == 15.0, "per-venue queue delay summarized");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Kernel RX Timestamp Regression Test ===\n";
+
+    test_queued_frame_keeps_kernel_time();
+    test_waiting_read_and_eof();
+    test_ticker_carries_frame_rx();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: kernel RX time reaches Ticker and per-venue queueing stats ***\n";
+    return 0;
+}
@@ -13,6 +13,7 @@
 #include "kimp/core/types.hpp"
 #include "kimp/core/config.hpp"
 #include "kimp/core/optimization.hpp"
+#include "kimp/core/cpu_topology.hpp"
 #include "kimp/strategy/arbitrage_engine.hpp"
 #include "kimp/execution/order_manager.hpp"
 #include "kimp/exchange/bithumb/bithumb.hpp"
@@ -57,17 +58,22 @@ void test_section6_thread_config_optimal() {
 
     auto cfg = kimp::opt::ThreadConfig::optimal();
     int cores = std::thread::hardware_concurrency();
-
-    if (cores >= 8) {
-        TEST("8+ cores: dedicated io_bithumb_core=0", cfg.io_bithumb_core == 0);
-        TEST("8+ cores: dedicated io_bybit_core=1", cfg.io_bybit_core == 1);
-        TEST("8+ cores: strategy_core=2", cfg.strategy_core == 2);
-        TEST("8+ cores: execution_core=3", cfg.execution_core == 3);
-    } else if (cores >= 4) {
-        TEST("4+ cores: shared io cores", cfg.io_bithumb_core == 0 && cfg.io_bybit_core == 1);
-        TEST("4+ cores: strategy_core=2", cfg.strategy_core == 2);
-        TEST("4+ cores: execution_core=3", cfg.execution_core == 3);
-    } else {
+    const auto& plan = kimp::opt::host_thread_plan();
+
+    TEST("optimal() returns the host plan",
+         cfg.io_bithumb_core == plan.config.io_bithumb_core &&
+         cfg.strategy_core == plan.config.strategy_core &&
+         cfg.execution_core == plan.config.execution_core);
+    if (cfg.strategy_core >= 0) {
+        std::unordered_set<int> hot{cfg.io_bithumb_core, cfg.io_bybit_core,
+                                    cfg.strategy_core, cfg.execution_core};
+        TEST("Pinned: io/strategy/execution on distinct cores", hot.size() == 4);
+        TEST("Pinned: cores within the CPU count",
+             cfg.execution_core < cores && cfg.strategy_core < cores);
+        TEST("Pinned: first execution worker on execution_core",
+             cfg.execution_worker_core(0) == cfg.execution_core);
+    }
+    if (cores < 4) {
         TEST("Low cores: no pinning (-1)", cfg.io_bithumb_core == -1 && cfg.strategy_core == -1);
     }
 
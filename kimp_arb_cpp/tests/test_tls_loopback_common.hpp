@@ -0,0 +1,155 @@
+#pragma once
+
+#include <openssl/bio.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// Local TLS 1.3 server for kTLS tests and benchmarks: self-signed
+// P-256 certificate, one client at a time, user-space OpenSSL.
+namespace tls_loopback {
+
+struct CtxDeleter {
+    void operator()(SSL_CTX* ctx) const { SSL_CTX_free(ctx); }
+};
+using CtxPtr = std::unique_ptr<SSL_CTX, CtxDeleter>;
+
+// cert_pem_path: also write the certificate there so a client can trust it
+// (e.g. SSL_CERT_FILE for WebSocketClient)
+inline CtxPtr make_server_context(const char* ciphersuites = nullptr, bool tls12_only = false,
+                                  const char* cert_pem_path = nullptr) {
+    CtxPtr ctx(SSL_CTX_new(TLS_server_method()));
+    if (!ctx) throw std::runtime_error("SSL_CTX_new");
+
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    X509* cert = X509_new();
+    ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+    X509_gmtime_adj(X509_getm_notBefore(cert), -60);
+    X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+    X509_set_pubkey(cert, key);
+    X509_NAME* name = X509_get_subject_name(cert);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                               reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(cert, name);
+    X509_sign(cert, key, EVP_sha256());
+    bool ok = SSL_CTX_use_certificate(ctx.get(), cert) == 1 && SSL_CTX_use_PrivateKey(ctx.get(), key) == 1;
+    if (ok && cert_pem_path) {
+        BIO* out = BIO_new_file(cert_pem_path, "w");
+        ok = out && PEM_write_bio_X509(out, cert) == 1;
+        BIO_free(out);
+    }
+    X509_free(cert);
+    EVP_PKEY_free(key);
+    if (!ok) throw std::runtime_error("server certificate");
+
+    if (tls12_only) {
+        SSL_CTX_set_max_proto_version(ctx.get(), TLS1_2_VERSION);
+    } else {
+        SSL_CTX_set_min_proto_version(ctx.get(), TLS1_3_VERSION);
+    }
+    if (ciphersuites) {
+        SSL_CTX_set_ciphersuites(ctx.get(), ciphersuites);
+    }
+    return ctx;
+}
+
+// Accepts connections on 127.0.0.1:<ephemeral> and runs session(ssl) for
+// each after the TLS handshake, on a background thread.
+class Server {
+public:
+    using Session = std::function<void(SSL*)>;
+
+    Server(CtxPtr ctx, Session session) : ctx_(std::move(ctx)), session_(std::move(session)) {
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        const int on = 1;
+        ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(addr);
+        if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(listen_fd_, 4) != 0 ||
+            ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+            throw std::runtime_error("listen");
+        }
+        port_ = ntohs(addr.sin_port);
+        thread_ = std::thread([this] { run(); });
+    }
+
+    ~Server() {
+        stopping_ = true;
+        ::shutdown(listen_fd_, SHUT_RDWR);
+        ::close(listen_fd_);
+        if (thread_.joinable()) thread_.join();
+    }
+
+    unsigned short port() const { return port_; }
+    std::string port_string() const { return std::to_string(port_); }
+
+private:
+    void run() {
+        while (!stopping_) {
+            const int fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            const int on = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+            SSL* ssl = SSL_new(ctx_.get());
+            SSL_set_fd(ssl, fd);
+            if (SSL_accept(ssl) == 1) {
+                session_(ssl);
+                SSL_shutdown(ssl);
+            }
+            SSL_free(ssl);
+            ::close(fd);
+        }
+    }
+
+    CtxPtr ctx_;
+    Session session_;
+    int listen_fd_{-1};
+    unsigned short port_{0};
+    std::atomic<bool> stopping_{false};
+    std::thread thread_;
+};
+
+// Blocking helpers for server sessions
+inline bool write_all(SSL* ssl, const void* data, std::size_t size) {
+    const auto* p = static_cast<const char*>(data);
+    while (size > 0) {
+        const int n = SSL_write(ssl, p, static_cast<int>(size));
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+inline bool read_exact(SSL* ssl, void* data, std::size_t size) {
+    auto* p = static_cast<char*>(data);
+    while (size > 0) {
+        const int n = SSL_read(ssl, p, static_cast<int>(size));
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+} // namespace tls_loopback
@@ -0,0 +1,172 @@
+#include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/strategy/trade_stats.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::strategy;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+bool near(double a, double b, double eps = 1e-9) { return std::fabs(a - b) <= eps; }
+
+void test_moments_match_naive() {
+    TradeStats stats(1000.0);
+    const std::vector<double> pnls{5.0, -2.0, 3.5, -1.0, 7.25, 0.0, -4.0, 2.0};
+    for (double p : pnls) stats.record(p);
+
+    double mean = 0.0;
+    for (double p : pnls) mean += p;
+    mean /= static_cast<double>(pnls.size());
+    double ss = 0.0;
+    for (double p : pnls) ss += (p - mean) * (p - mean);
+    const double sd = std::sqrt(ss / static_cast<double>(pnls.size() - 1));
+
+    const auto s = stats.summary();
+    expect(s.all.trades == 8 && s.all.wins == 4, "trade and win counts");
+    expect(near(s.all.mean, mean), "Welford mean");
+    expect(near(s.all.stddev(), sd), "Welford stddev");
+    expect(near(s.all.sharpe(), mean / sd), "per-trade Sharpe");
+    expect(near(s.all.profit_factor(), 17.75 / 7.0), "profit factor");
+    expect(near(s.all.best, 7.25) && near(s.all.worst, -4.0), "best and worst");
+    expect(near(s.rolling_mean, mean) && s.rolling_trades == 8, "rolling window before it fills");
+}
+
+void test_drawdown() {
+    TradeStats stats(100.0);
+    stats.record(10.0);   // 110 peak
+    stats.record(-5.0);   // 105
+    stats.record(-15.0);  // 90 -> DD 20 of 110
+    stats.record(30.0);   // 120 new peak
+    stats.record(-6.0);   // 114
+
+    const auto s = stats.summary();
+    expect(near(s.peak_equity, 120.0), "peak equity");
+    expect(near(s.max_drawdown_usd, 20.0), "max drawdown USD");
+    expect(near(s.max_drawdown_pct, 20.0 / 110.0 * 100.0), "max drawdown % of peak");
+    expect(near(s.drawdown_usd, 6.0), "current drawdown");
+}
+
+void test_rolling_window() {
+    TradeStats stats;
+    for (std::size_t i = 0; i < TradeStats::ROLLING_WINDOW; ++i) stats.record(-1.0);
+    for (std::size_t i = 0; i < TradeStats::ROLLING_WINDOW; ++i) stats.record(i % 2 == 0 ? 3.0 : 1.0);
+
+    const auto s = stats.summary();
+    expect(s.rolling_trades == TradeStats::ROLLING_WINDOW, "window capped");
+    expect(near(s.rolling_mean, 2.0), "old trades left the window");
+    expect(s.rolling_sharpe() > 1.0 && s.all.sharpe() < s.rolling_sharpe(), "rolling Sharpe tracks recent trades");
+}
+
+void test_breakdowns_and_history() {
+    TradeStats stats(0.0, 4);
+    const SymbolId btc("BTC", "KRW");
+    const SymbolId xrp("XRP", "KRW");
+    stats.record(2.0, btc, Exchange::Bithumb, Exchange::Bybit);
+    stats.record(-1.0, btc, Exchange::Upbit, Exchange::OKX);
+    stats.record(4.0, xrp, Exchange::Bithumb, Exchange::Bybit);
+    for (int i = 0; i < 5; ++i) stats.record(0.5, xrp, Exchange::Bithumb, Exchange::Bybit);
+
+    const auto b = stats.symbol_breakdown(btc);
+    expect(b && b->stats.trades == 2 && near(b->stats.total_pnl, 1.0), "per-symbol breakdown");
+    expect(!stats.symbol_breakdown(SymbolId("DOGE", "KRW")), "unknown symbol");
+
+    const auto pair = stats.pair_breakdown(Exchange::Bithumb, Exchange::Bybit);
+    expect(pair.stats.trades == 7 && near(pair.stats.total_pnl, 8.5), "per-pair breakdown");
+    expect(stats.pair_breakdowns().size() == 2, "two active pairs");
+
+    const auto top = stats.symbol_breakdowns();
+    expect(top.size() == 2 && top.front().symbol == xrp, "symbols sorted by P&L");
+
+    const auto recent = stats.recent_trades();
+    expect(recent.size() == 4, "history ring bounded");
+    expect(near(recent.back().pnl_usd, 0.5) && recent.back().symbol == xrp, "newest trade last");
+}
+
+void test_symbol_table_overflow() {
+    TradeStats stats;
+    for (std::size_t i = 0; i < TradeStats::SYMBOL_SLOTS + 3; ++i) {
+        stats.record(1.0, SymbolId("C" + std::to_string(i), "KRW"), Exchange::Bithumb, Exchange::Bybit);
+    }
+    const auto s = stats.summary();
+    expect(s.all.trades == TradeStats::SYMBOL_SLOTS + 3, "every trade in the totals");
+    expect(s.untracked_symbol_trades == 3, "overflow counted, memory stays bounded");
+}
+
+void test_concurrent_readers_see_consistent_summaries() {
+    TradeStats stats(1000.0);
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            const auto s = stats.summary();
+            // Every trade is +1.0: a torn read would break these invariants
+            if (s.all.wins != s.all.trades || !near(s.all.total_pnl, static_cast<double>(s.all.trades)) ||
+                !near(s.peak_equity, 1000.0 + static_cast<double>(s.all.trades))) {
+                torn.fetch_add(1);
+            }
+        }
+    });
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([&] {
+            for (int i = 0; i < 5000; ++i) stats.record(1.0, SymbolId("BTC", "KRW"), Exchange::Bithumb, Exchange::Bybit);
+        });
+    }
+    for (auto& t : writers) t.join();
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    expect(torn.load() == 0, "seqlock readers never see a torn summary");
+    expect(stats.summary().all.trades == 20000, "all concurrent trades recorded");
+    expect(stats.symbol_breakdown(SymbolId("BTC", "KRW"))->stats.trades == 20000, "breakdown consistent");
+}
+
+void test_capital_tracker_integration() {
+    CapitalTracker tracker(6000.0);
+    tracker.add_realized_pnl(1.5, SymbolId("SOL", "KRW"), Exchange::Bithumb, Exchange::Bybit);
+    tracker.add_realized_pnl(-0.5);
+    expect(tracker.get_total_trades() == 2 && near(tracker.get_realized_pnl(), 1.0), "totals unchanged");
+    expect(tracker.stats().summary().all.trades == 2, "stats fed by add_realized_pnl");
+    expect(tracker.get_pnl_history().size() == 2, "bounded history still available");
+
+    tracker.reset_session();
+    expect(tracker.stats().summary().all.trades == 0 && tracker.get_pnl_history().empty(), "reset clears stats");
+    expect(near(tracker.stats().summary().peak_equity, 6000.0), "peak restarts at initial capital");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Trade Stats Regression Test ===\n";
+
+    test_moments_match_naive();
+    test_drawdown();
+    test_rolling_window();
+    test_breakdowns_and_history();
+    test_symbol_table_overflow();
+    test_concurrent_readers_see_consistent_summaries();
+    test_capital_tracker_integration();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: streaming trade stats are exact, bounded and safe to read concurrently ***\n";
+    return 0;
+}
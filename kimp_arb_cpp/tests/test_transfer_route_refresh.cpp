@@ -0,0 +1,122 @@
+#include "kimp/strategy/arbitrage_engine.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace kimp;
+using namespace kimp::strategy;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+PriceCache::TransferRouteUpdate full_update(double btc_fee) {
+    PriceCache::TransferRouteUpdate update;
+    update.withdraw_fees[Exchange::Bithumb]["BTC"] = {{"Bitcoin", btc_fee}};
+    update.withdraw_fees[Exchange::Bithumb]["XRP"] = {{"XRP", 0.4}};
+    update.withdraw_fees[Exchange::Bithumb]["SOL"] = {{"Solana", 0.01}};
+    update.withdraw_enabled[Exchange::Bithumb]["BTC"] = true;
+    update.withdraw_enabled[Exchange::Bithumb]["XRP"] = true;
+    update.withdraw_enabled[Exchange::Bithumb]["SOL"] = true;
+    update.deposit_nets[Exchange::Bybit]["BTC"] = {"BTC"};
+    update.deposit_nets[Exchange::Bybit]["XRP"] = {"xrp"};
+    update.deposit_nets[Exchange::Bybit]["SOL"] = {"SOL"};
+    return update;
+}
+
+void test_initial_publish() {
+    PriceCache pc;
+    const auto diff = pc.apply_transfer_routes(full_update(0.0002));
+    expect(pc.available_transfer_route_count() == 3, "three routes published");
+    expect(diff.routes_opened == 3 && diff.routes_closed == 0, "initial publish opens all routes");
+    expect((diff.changed_coins == std::vector<std::string>{"BTC", "SOL", "XRP"}), "changed coins sorted");
+    expect(pc.get_withdraw_fee(Exchange::Bithumb, Exchange::Bybit, "BTC") == 0.0002, "chain aliases normalized");
+}
+
+void test_unchanged_refresh_is_empty_diff() {
+    PriceCache pc;
+    pc.apply_transfer_routes(full_update(0.0002));
+    const auto diff = pc.apply_transfer_routes(full_update(0.0002));
+    expect(!diff.any(), "identical refresh changes nothing");
+    expect(pc.available_transfer_route_count() == 3, "routes kept");
+}
+
+void test_fee_change_and_closure() {
+    PriceCache pc;
+    pc.apply_transfer_routes(full_update(0.0002));
+
+    auto update = full_update(0.0005);
+    update.withdraw_enabled[Exchange::Bithumb]["SOL"] = false;
+    const auto diff = pc.apply_transfer_routes(std::move(update));
+    expect((diff.changed_coins == std::vector<std::string>{"BTC", "SOL"}), "only BTC and SOL changed");
+    expect(diff.fees_changed == 1 && diff.routes_closed == 1 && diff.routes_opened == 0, "diff counts");
+    expect(pc.get_withdraw_fee(Exchange::Bithumb, Exchange::Bybit, "BTC") == 0.0005, "new fee live");
+    expect(!pc.is_transfer_route_available(Exchange::Bithumb, Exchange::Bybit, "SOL"), "SOL closed");
+}
+
+void test_failed_venue_keeps_last_data() {
+    PriceCache pc;
+    pc.apply_transfer_routes(full_update(0.0002));
+
+    // Bybit fetch failed: only the Korean side is staged
+    auto update = full_update(0.0002);
+    update.deposit_nets.clear();
+    const auto diff = pc.apply_transfer_routes(std::move(update));
+    expect(!diff.any(), "missing venue is not treated as closed");
+    expect(pc.available_transfer_route_count() == 3, "deposit networks retained");
+}
+
+void test_dropped_coin_closes_route() {
+    PriceCache pc;
+    pc.apply_transfer_routes(full_update(0.0002));
+
+    auto update = full_update(0.0002);
+    update.deposit_nets[Exchange::Bybit].erase("XRP");
+    const auto diff = pc.apply_transfer_routes(std::move(update));
+    expect((diff.changed_coins == std::vector<std::string>{"XRP"}), "delisted deposit network diffed");
+    expect(diff.routes_closed == 1, "route closed");
+}
+
+void test_targeted_entry_refresh() {
+    ArbitrageEngine engine;
+    engine.add_exchange_pair(Exchange::Bithumb, Exchange::Bybit);
+    engine.add_symbol(SymbolId("BTC", "KRW"));
+    engine.add_symbol(SymbolId("XRP", "KRW"));
+
+    const uint64_t seq = engine.get_update_seq();
+    engine.refresh_entry_filters(std::vector<std::string>{});
+    expect(engine.get_update_seq() == seq, "empty diff leaves entry state alone");
+    engine.refresh_entry_filters(std::vector<std::string>{"DOGE"});
+    expect(engine.get_update_seq() == seq, "unmonitored coin is a no-op");
+    engine.refresh_entry_filters(std::vector<std::string>{"XRP"});
+    expect(engine.get_update_seq() == seq + 1, "monitored coin re-evaluated");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Transfer Route Refresh Regression Test ===\n";
+
+    test_initial_publish();
+    test_unchanged_refresh_is_empty_diff();
+    test_fee_change_and_closure();
+    test_failed_venue_keeps_last_data();
+    test_dropped_coin_closes_route();
+    test_targeted_entry_refresh();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: staged transfer routes publish atomically and diff per coin ***\n";
+    return 0;
+}
@@ -0,0 +1,341 @@
+#include "kimp/exchange/upbit/upbit_fee_collector.hpp"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+namespace net = boost::asio;
+namespace beast = boost::beast;
+namespace http = beast::http;
+using tcp = net::ip::tcp;
+using Clock = std::chrono::steady_clock;
+using kimp::exchange::HttpResponse;
+using kimp::exchange::upbit::WithdrawFeeCollector;
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+/**
+ * Local HTTP stand-in for /v1/withdraws/chance
+ *
+ * Enforces a per-second request limit the way Upbit does: requests over the
+ * limit in the current 1s window get 429, every response carries
+ * Remaining-Req. Records accept times so the test can check the peak rate.
+ */
+class StandInServer {
+public:
+    StandInServer(int limit_per_sec, std::chrono::milliseconds latency)
+        : limit_per_sec_(limit_per_sec)
+        , latency_(latency)
+        , acceptor_(io_context_, tcp::endpoint(net::ip::address_v4::loopback(), 0)) {
+        port_ = acceptor_.local_endpoint().port();
+        accept_thread_ = std::thread([this] { accept_loop(); });
+    }
+
+    ~StandInServer() {
+        stopping_.store(true);
+        try {
+            // Unblock the synchronous accept
+            net::io_context ioc;
+            tcp::socket s(ioc);
+            s.connect(tcp::endpoint(net::ip::address_v4::loopback(), port_));
+        } catch (...) {
+        }
+        accept_thread_.join();
+        for (auto& t : connection_threads_) {
+            t.join();
+        }
+    }
+
+    uint16_t port() const { return port_; }
+
+    void fail_coin(const std::string& coin) {
+        std::lock_guard lock(mutex_);
+        failing_coins_.insert(coin);
+    }
+    void ban() { banned_.store(true); }
+
+    std::size_t accepted() const {
+        std::lock_guard lock(mutex_);
+        return served_.size();
+    }
+    std::size_t rejected() const { return rejected_.load(); }
+
+    // Most requests served inside any 1s sliding window
+    std::size_t peak_per_sec() const {
+        std::lock_guard lock(mutex_);
+        std::size_t peak = 0;
+        std::size_t lo = 0;
+        for (std::size_t hi = 0; hi < served_.size(); ++hi) {
+            while (served_[hi] - served_[lo] >= std::chrono::seconds(1)) ++lo;
+            peak = std::max(peak, hi - lo + 1);
+        }
+        return peak;
+    }
+
+private:
+    void accept_loop() {
+        while (!stopping_.load()) {
+            tcp::socket socket(io_context_);
+            beast::error_code ec;
+            acceptor_.accept(socket, ec);
+            if (ec || stopping_.load()) break;
+            connection_threads_.emplace_back([this, s = std::move(socket)]() mutable { serve(std::move(s)); });
+        }
+    }
+
+    void serve(tcp::socket socket) {
+        beast::error_code ec;
+        beast::flat_buffer buffer;
+        http::request<http::string_body> req;
+        http::read(socket, buffer, req, ec);
+        if (ec) return;
+
+        std::this_thread::sleep_for(latency_);
+        const std::string target(req.target());
+        const auto coin_begin = target.find("currency=") + 9;
+        const auto coin_end = target.find('&', coin_begin);
+        const std::string coin = target.substr(coin_begin, coin_end == std::string::npos
+                                                               ? std::string::npos
+                                                               : coin_end - coin_begin);
+
+        http::response<http::string_body> res;
+        res.version(11);
+        int remaining = 0;
+        bool admitted = false;
+        bool failing = false;
+        {
+            // Fixed 1s windows, as Upbit's "sec=" counter resets each second
+            std::lock_guard lock(mutex_);
+            const auto now = Clock::now();
+            if (now - window_start_ >= std::chrono::seconds(1)) {
+                window_start_ = now;
+                window_count_ = 0;
+            }
+            if (window_count_ < limit_per_sec_) {
+                ++window_count_;
+                served_.push_back(now);
+                admitted = true;
+            }
+            remaining = std::max(limit_per_sec_ - window_count_, 0);
+            failing = failing_coins_.count(coin) > 0;
+        }
+        res.set("Remaining-Req", "group=default; min=1800; sec=" + std::to_string(remaining));
+
+        if (banned_.load()) {
+            res.result(418);
+        } else if (!admitted) {
+            ++rejected_;
+            res.result(http::status::too_many_requests);
+            res.body() = R"({"error":{"name":"too_many_requests"}})";
+        } else if (failing) {
+            res.result(http::status::bad_request);
+            res.body() = R"({"error":{"name":"invalid_currency"}})";
+        } else {
+            res.result(http::status::ok);
+            std::string body = R"({"currency":{"code":")";
+            body.append(coin).append(R"(","withdraw_fee":"0.5"}})");
+            res.body() = std::move(body);
+        }
+        res.set(http::field::content_length, std::to_string(res.body().size()));
+        http::write(socket, res, ec);
+        socket.shutdown(tcp::socket::shutdown_both, ec);
+    }
+
+    const int limit_per_sec_;
+    const std::chrono::milliseconds latency_;
+    net::io_context io_context_;
+    tcp::acceptor acceptor_;
+    uint16_t port_{0};
+    std::atomic<bool> stopping_{false};
+    std::atomic<bool> banned_{false};
+    std::atomic<std::size_t> rejected_{0};
+    std::thread accept_thread_;
+    std::vector<std::thread> connection_threads_;
+
+    mutable std::mutex mutex_;
+    Clock::time_point window_start_{};
+    int window_count_{0};
+    std::deque<Clock::time_point> served_;
+    std::unordered_set<std::string> failing_coins_;
+};
+
+// Plain HTTP client for the stand-in, one connection per request
+WithdrawFeeCollector::RequestFn client_for(uint16_t port) {
+    return [port](const std::string& coin, const std::string& net_type) {
+        HttpResponse out;
+        try {
+            net::io_context ioc;
+            tcp::socket socket(ioc);
+            socket.connect(tcp::endpoint(net::ip::address_v4::loopback(), port));
+            std::string target = "/v1/withdraws/chance?currency=" + coin;
+            if (!net_type.empty()) target += "&net_type=" + net_type;
+            http::request<http::empty_body> req{http::verb::get, target, 11};
+            req.set(http::field::host, "127.0.0.1");
+            http::write(socket, req);
+            beast::flat_buffer buffer;
+            http::response<http::string_body> res;
+            http::read(socket, buffer, res);
+            out.status_code = res.result_int();
+            out.body = res.body();
+            out.success = res.result() == http::status::ok;
+            for (const auto& field : res) {
+                out.headers[std::string(field.name_string())] = std::string(field.value());
+            }
+        } catch (const std::exception& e) {
+            out.error = e.what();
+        }
+        return out;
+    };
+}
+
+std::vector<WithdrawFeeCollector::CoinNetworks> make_coins(int count) {
+    std::vector<WithdrawFeeCollector::CoinNetworks> coins;
+    for (int i = 0; i < count; ++i) {
+        coins.push_back({"C" + std::to_string(i), {}});
+    }
+    return coins;
+}
+
+void test_header_and_body_parsing() {
+    HttpResponse r;
+    r.headers["remaining-req"] = "group=default; min=1799; sec=29";
+    auto sec = WithdrawFeeCollector::remaining_req_sec(r);
+    expect(sec && *sec == 29, "Remaining-Req sec parsed case-insensitively");
+    r.headers.clear();
+    expect(!WithdrawFeeCollector::remaining_req_sec(r), "missing header");
+
+    double fee = -1.0;
+    expect(WithdrawFeeCollector::parse_withdraw_fee(R"({"currency":{"withdraw_fee":"0.0005"}})", fee) &&
+               fee == 0.0005, "string fee");
+    expect(WithdrawFeeCollector::parse_withdraw_fee(R"({"currency":{"withdraw_fee":2}})", fee) &&
+               fee == 2.0, "integer fee");
+    expect(!WithdrawFeeCollector::parse_withdraw_fee(R"({"error":{}})", fee), "error body rejected");
+    expect(WithdrawFeeCollector::normalize_network("erc-20") == "ERC20", "net_type normalized");
+}
+
+void test_throughput_within_limit() {
+    StandInServer server(40, std::chrono::milliseconds(15));
+    WithdrawFeeCollector::Options options;
+    options.requests_per_sec = 30.0;
+    options.burst = 5.0;
+    options.workers = 4;
+    WithdrawFeeCollector collector(options);
+
+    auto coins = make_coins(50);
+    coins[0].net_types = {"ERC20", "TRC20"};
+    const auto fees = collector.collect(coins, client_for(server.port()));
+    const auto stats = collector.last_stats();
+
+    expect(fees.size() == 50 && stats.fetched == 50, "every coin fetched");
+    expect(fees.at("C0").size() == 2, "one fee per net_type");
+    expect(stats.throttled == 0 && server.rejected() == 0, "bucket stays under the server limit");
+    expect(server.peak_per_sec() <= 36, "peak rate within rate + burst");
+    // 51 requests at 30/s with a 5-token burst: ~1.5s, far below one-at-a-time pacing
+    expect(stats.elapsed_ms >= 1300 && stats.elapsed_ms < 5000, "paced by the bucket, not serialized");
+}
+
+void test_throttle_feedback() {
+    // The bucket is configured above what the server allows: Remaining-Req
+    // clamps and 429 pauses must still get every coin through
+    StandInServer server(15, std::chrono::milliseconds(5));
+    WithdrawFeeCollector::Options options;
+    options.requests_per_sec = 100.0;
+    options.burst = 20.0;
+    options.workers = 4;
+    options.throttle_pause = std::chrono::milliseconds(300);
+    options.max_attempts = 10;
+    WithdrawFeeCollector collector(options);
+
+    const auto fees = collector.collect(make_coins(30), client_for(server.port()));
+    const auto stats = collector.last_stats();
+    const auto bucket = collector.bucket().stats();
+    expect(fees.size() == 30, "all coins fetched despite throttling");
+    expect(stats.throttled == server.rejected(), "429s counted");
+    expect(bucket.clamped > 0 || bucket.paused > 0, "server feedback reached the bucket");
+    expect(server.peak_per_sec() <= 15, "server limit held");
+}
+
+void test_ttl_cache_and_stale_fallback() {
+    StandInServer server(100, std::chrono::milliseconds(1));
+    WithdrawFeeCollector::Options options;
+    options.requests_per_sec = 200.0;
+    options.burst = 20.0;
+    WithdrawFeeCollector collector(options);
+    auto coins = make_coins(10);
+
+    collector.collect(coins, client_for(server.port()));
+    const std::size_t first = server.accepted();
+    expect(first == 10, "first pass fetches every coin");
+
+    collector.collect(coins, client_for(server.port()));
+    expect(server.accepted() == first, "second pass served from cache");
+    expect(collector.last_stats().cache_hits == 10, "cache hits counted");
+
+    coins[3].net_types = {"BEP20"};
+    collector.collect(coins, client_for(server.port()));
+    expect(server.accepted() == first + 1, "changed net_type set refetches only that coin");
+
+    WithdrawFeeCollector::Options no_ttl = options;
+    no_ttl.ttl = std::chrono::seconds(0);
+    WithdrawFeeCollector expiring(no_ttl);
+    expiring.collect(coins, client_for(server.port()));
+    server.fail_coin("C5");
+    const auto fees = expiring.collect(coins, client_for(server.port()));
+    const auto stats = expiring.last_stats();
+    expect(stats.fetched == 9 && stats.stale_served == 1, "failed refresh serves last known fees");
+    expect(fees.count("C5") == 1 && stats.failed_coins.empty(), "stale coin still returned");
+}
+
+void test_ban_stops_collection() {
+    StandInServer server(100, std::chrono::milliseconds(1));
+    server.ban();
+    WithdrawFeeCollector::Options options;
+    options.requests_per_sec = 200.0;
+    WithdrawFeeCollector collector(options);
+    const auto fees = collector.collect(make_coins(40), client_for(server.port()));
+    const auto stats = collector.last_stats();
+    expect(stats.banned && fees.empty(), "418 stops the collection");
+    expect(stats.requests <= options.workers, "no requests after the ban");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Upbit Fee Collector Regression Test ===\n";
+
+    test_header_and_body_parsing();
+    test_throughput_within_limit();
+    test_throttle_feedback();
+    test_ttl_cache_and_stale_fallback();
+    test_ban_stops_collection();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: fee collection is concurrent, rate-limited, throttle-aware and cached ***\n";
+    return 0;
+}
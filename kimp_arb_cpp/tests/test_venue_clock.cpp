@@ -0,0 +1,198 @@
+#include "kimp/network/venue_clock.hpp"
+#include "kimp/network/websocket_client.hpp"
+#include "kimp/exchange/bybit/bybit.hpp"
+#include "kimp/strategy/arbitrage_engine.hpp"
+#include "kimp/core/config.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+
+using kimp::network::ClockSample;
+using kimp::network::FrameRxInfo;
+using kimp::network::VenueClock;
+using kimp::network::WebSocketClient;
+
+constexpr int64_t MS = 1'000'000;
+constexpr int64_t SEC = 1'000 * MS;
+
+// Venue clock runs 1s ahead of ours; server time comes from a stub instead of REST
+class TestBybitExchange : public kimp::exchange::bybit::BybitExchange {
+public:
+    using kimp::exchange::bybit::BybitExchange::BybitExchange;
+    using kimp::exchange::bybit::BybitExchange::on_ws_message;
+    using kimp::exchange::bybit::BybitExchange::stamp_venue_event;
+    using kimp::exchange::bybit::BybitExchange::VenueEventScope;
+
+    static constexpr int64_t VENUE_AHEAD_NS = SEC;
+
+protected:
+    bool fetch_server_time_ns(int64_t& server_ns) override {
+        server_ns = realtime_now_ns() + VENUE_AHEAD_NS;
+        return true;
+    }
+};
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Sample at local time t with one-way delays out/back; venue = local + offset
+ClockSample make_sample(int64_t t, int64_t offset, int64_t out_ns, int64_t back_ns) {
+    return {t, t + out_ns + offset, t + out_ns + back_ns};
+}
+
+void test_min_rtt_filter() {
+    VenueClock clock;
+    expect(!clock.synced(), "unsynced before samples");
+
+    const int64_t offset = 37 * MS;
+    const int64_t base = 1'773'000'000 * SEC;
+    // Slow samples carry one-sided response queueing that biases the offset
+    clock.add_sample(make_sample(base, offset, 2 * MS, 14 * MS));
+    clock.add_sample(make_sample(base + SEC, offset, 1 * MS, 1 * MS));
+    clock.add_sample(make_sample(base + 2 * SEC, offset, 9 * MS, 2 * MS));
+
+    const auto est = clock.estimate();
+    expect(est.synced && est.samples == 3, "samples accepted");
+    expect(est.rtt_ns == 2 * MS, "lowest-RTT sample selected");
+    expect(std::llabs(est.offset_ns - offset) <= est.error_ns, "offset within RTT/2 bound");
+    expect(est.drift_ppm == 0.0, "no drift before the window spans a minute");
+
+    expect(!clock.add_sample({base, offset, base - 1}), "negative RTT rejected");
+    expect(!clock.add_sample({base, base + offset, base + 5 * SEC}), "oversized RTT rejected");
+    expect(clock.estimate().samples == 3, "rejected samples not stored");
+}
+
+void test_drift_and_conversion() {
+    VenueClock clock;
+    const int64_t base = 1'773'000'000 * SEC;
+    const double drift_ppm = 20.0;
+    for (int i = 0; i < 24; ++i) {
+        const int64_t t = base + i * 30 * SEC;
+        const int64_t offset = 5 * MS + static_cast<int64_t>(drift_ppm * 1e-6 * static_cast<double>(t - base));
+        const int64_t extra = (i % 3 == 0) ? 6 * MS : 0;  // every third sample queued
+        clock.add_sample(make_sample(t, offset, 1 * MS, 1 * MS + extra));
+    }
+
+    const auto est = clock.estimate();
+    expect(est.drift_ppm > 18.0 && est.drift_ppm < 22.0, "drift recovered from low-RTT samples");
+
+    // 10 minutes past the last sample the model follows the drift
+    const int64_t later = base + 23 * 30 * SEC + 600 * SEC;
+    const int64_t true_offset = 5 * MS + static_cast<int64_t>(drift_ppm * 1e-6 * static_cast<double>(later - base));
+    expect(std::llabs(est.offset_at(later) - true_offset) < MS / 2, "offset extrapolated with drift");
+
+    const int64_t venue_ns = later + true_offset;
+    expect(std::llabs(est.venue_to_local_ns(venue_ns) - later) < MS / 2, "venue time mapped to local");
+    expect(std::llabs(est.local_to_venue_ns(est.venue_to_local_ns(venue_ns)) - venue_ns) < 1000,
+           "conversion round-trips");
+}
+
+void test_venue_clock_step() {
+    VenueClock clock;
+    const int64_t base = 1'773'000'000 * SEC;
+    for (int i = 0; i < 5; ++i) {
+        clock.add_sample(make_sample(base + i * SEC, 10 * MS, 1 * MS, 1 * MS));
+    }
+    // Venue clock jumps by 2s: old samples no longer describe it
+    clock.add_sample(make_sample(base + 6 * SEC, 2 * SEC + 10 * MS, 3 * MS, 3 * MS));
+
+    const auto est = clock.estimate();
+    expect(clock.steps() == 1, "step detected");
+    expect(est.samples == 1 && std::llabs(est.offset_ns - (2 * SEC + 10 * MS)) <= est.error_ns,
+           "model re-based on the new clock");
+}
+
+void test_ticker_venue_age() {
+    boost::asio::io_context io_context;
+    kimp::ExchangeCredentials creds;
+    TestBybitExchange exchange(io_context, creds);
+
+    kimp::Ticker seen;
+    exchange.set_ticker_callback([&](const kimp::Ticker& ticker) { seen = ticker; });
+
+    auto frame_at = [](int64_t venue_ms) {
+        return std::string(R"({"topic":"orderbook.1.BTCUSDT","ts":)") + std::to_string(venue_ms) +
+               R"(,"type":"snapshot","data":{"s":"BTCUSDT","b":[["69904.3","0.5"]],"a":[["69904.4","0.4"]],"u":1,"seq":7},"cts":1})";
+    };
+    auto deliver = [&](const std::string& frame, int64_t kernel_ns) {
+        WebSocketClient::FrameRxScope rx(FrameRxInfo{kernel_ns, kernel_ns + 20'000});
+        TestBybitExchange::VenueEventScope venue_event(exchange.stamp_venue_event(frame));
+        exchange.on_ws_message(frame);
+    };
+
+    const auto local_now = [] {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    };
+
+    // Before any clock sample venue times cannot be trusted
+    int64_t kernel_ns = local_now();
+    deliver(frame_at((kernel_ns + TestBybitExchange::VENUE_AHEAD_NS - 80 * MS) / MS), kernel_ns);
+    expect(seen.venue_event_ns == 0 && seen.venue_age_ns == 0, "unsynced venue leaves tickers unstamped");
+
+    for (int i = 0; i < 4; ++i) {
+        expect(exchange.sample_clock(), "clock sample taken");
+    }
+    const auto sync = exchange.get_clock_sync_stats();
+    expect(sync.clock.synced && std::llabs(sync.clock.offset_ns - TestBybitExchange::VENUE_AHEAD_NS) < MS,
+           "exchange clock offset estimated");
+
+    // Frame generated 80ms before it reached our socket
+    kernel_ns = local_now();
+    deliver(frame_at((kernel_ns + TestBybitExchange::VENUE_AHEAD_NS - 80 * MS) / MS), kernel_ns);
+    expect(seen.venue_event_ns != 0 && std::llabs(seen.venue_event_ns - (kernel_ns - 80 * MS)) < 2 * MS,
+           "ticker carries offset-corrected venue event time");
+    expect(seen.venue_age_ns > 78 * MS && seen.venue_age_ns < 83 * MS, "ticker carries venue age");
+    expect(!WebSocketClient::current_frame_rx().valid(), "frame timing cleared after delivery");
+
+    const auto feed = exchange.get_clock_sync_stats().feed_latency;
+    expect(feed.count == 1 && feed.max_us > 78'000.0 && feed.max_us < 82'000.0, "one-way feed latency recorded");
+}
+
+void test_quote_age_uses_venue_time() {
+    kimp::strategy::PriceCache cache;
+    const kimp::SymbolId symbol("BTC", "USDT");
+
+    cache.update(kimp::Exchange::Bybit, symbol, 100.0, 100.1, 100.0, 10'000, 1.0, 1.0);
+    auto price = cache.get_price(kimp::Exchange::Bybit, symbol);
+    expect(price.quote_ts() == 10'000, "receive time used without venue time");
+
+    cache.update(kimp::Exchange::Bybit, symbol, 100.0, 100.1, 100.0, 10'050, 1.0, 1.0, 9'400);
+    price = cache.get_price(kimp::Exchange::Bybit, symbol);
+    expect(price.timestamp == 10'050 && price.quote_ts() == 9'400, "venue event time ages the quote");
+
+    cache.update(kimp::Exchange::Bybit, symbol, 100.0, 100.1, 100.0, 10'100, 1.0, 1.0);
+    price = cache.get_price(kimp::Exchange::Bybit, symbol);
+    expect(price.quote_ts() == 10'100, "stale venue time cleared by an unstamped update");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== Venue Clock Offset Regression Test ===\n";
+
+    test_min_rtt_filter();
+    test_drift_and_conversion();
+    test_venue_clock_step();
+    test_ticker_venue_age();
+    test_quote_age_uses_venue_time();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: venue clock offsets correct event times and quote ages ***\n";
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include "kimp/network/websocket_client.hpp"
+#include "test_ws_deflate_common.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using kimp::network::DeflateOptions;
+using kimp::network::WebSocketClient;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+constexpr std::size_t FRAMES = 300;
+
+std::string cert_path() {
+    return "/tmp/kimp_test_ws_deflate_" + std::to_string(::getpid()) + ".pem";
+}
+
+struct Session {
+    bool negotiated{false};
+    std::vector<std::string> received;
+    ws_replay::Server::Result server;
+};
+
+Session run_session(const DeflateOptions& client_options, bool server_deflate) {
+    const auto frames = ws_replay::synthetic_frames(FRAMES);
+    ws_replay::Server server(cert_path(), server_deflate, frames);
+    ::setenv("SSL_CERT_FILE", cert_path().c_str(), 1);
+
+    Session session;
+    boost::asio::io_context ioc;
+    auto client = std::make_shared<WebSocketClient>(ioc, "deflate-test");
+    client->set_deflate(client_options);
+    client->set_message_callback([&](std::string_view message, kimp::network::MessageType) {
+        session.received.emplace_back(message);
+        if (session.received.size() == FRAMES) {
+            session.negotiated = client->deflate_negotiated();
+            client->disconnect();
+        }
+    });
+    client->connect(server.url());
+    ioc.run_for(std::chrono::seconds(20));
+    client->disconnect();
+    server.join();
+    session.server = server.result();
+    return session;
+}
+
+bool frames_intact(const Session& session) {
+    return session.received == ws_replay::synthetic_frames(FRAMES);
+}
+
+void test_option_mapping() {
+    auto pmd = WebSocketClient::deflate_option({});
+    expect(!pmd.client_enable, "deflate is off by default");
+
+    pmd = WebSocketClient::deflate_option({true, true, 15});
+    expect(pmd.client_enable, "offer enabled");
+    expect(!pmd.client_no_context_takeover && !pmd.server_no_context_takeover, "context takeover kept");
+    expect(pmd.client_max_window_bits == 15 && pmd.server_max_window_bits == 15, "window bits passed through");
+
+    pmd = WebSocketClient::deflate_option({true, false, 4});
+    expect(pmd.client_no_context_takeover && pmd.server_no_context_takeover, "no context takeover requested");
+    expect(pmd.client_max_window_bits == 9 && pmd.server_max_window_bits == 9, "window bits clamped to 9");
+    pmd = WebSocketClient::deflate_option({true, true, 20});
+    expect(pmd.server_max_window_bits == 15, "window bits clamped to 15");
+}
+
+void test_negotiated_with_context_takeover() {
+    const Session session = run_session({true, true, 15}, true);
+    expect(session.server.offered_extensions.find("permessage-deflate") != std::string::npos,
+           "client offers permessage-deflate");
+    expect(session.server.accepted_extensions.find("permessage-deflate") != std::string::npos,
+           "server accepts the offer");
+    expect(session.negotiated, "client reports deflate negotiated");
+    expect(frames_intact(session), "every frame inflated intact");
+    expect(session.server.wire_bytes * 4 < session.server.payload_bytes * 3, "frames compressed on the wire");
+
+    const Session no_takeover = run_session({true, false, 15}, true);
+    expect(no_takeover.server.offered_extensions.find("no_context_takeover") != std::string::npos,
+           "no_context_takeover offered");
+    expect(no_takeover.server.accepted_extensions.find("server_no_context_takeover") != std::string::npos,
+           "server agrees to reset its window");
+    expect(no_takeover.negotiated && frames_intact(no_takeover), "no-takeover session intact");
+    std::cout << "  payload " << session.server.payload_bytes << " B, wire " << session.server.wire_bytes
+              << " B (takeover) / " << no_takeover.server.wire_bytes << " B (no takeover)\n";
+}
+
+void test_declined_and_disabled() {
+    const Session declined = run_session({true, true, 15}, false);
+    expect(declined.server.offered_extensions.find("permessage-deflate") != std::string::npos,
+           "offer sent to a server without deflate");
+    expect(!declined.negotiated, "declined offer reported");
+    expect(frames_intact(declined), "uncompressed fallback intact");
+
+    const Session disabled = run_session({}, true);
+    expect(disabled.server.offered_extensions.find("permessage-deflate") == std::string::npos,
+           "no offer when disabled");
+    expect(!disabled.negotiated && frames_intact(disabled), "disabled session intact");
+    expect(disabled.server.wire_bytes > disabled.server.payload_bytes, "uncompressed wire carries full payload");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== WebSocket permessage-deflate Regression Test ===\n";
+    spdlog::set_level(spdlog::level::warn);
+
+    test_option_mapping();
+    test_negotiated_with_context_takeover();
+    test_declined_and_disabled();
+    std::remove(cert_path().c_str());
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "*** PASS: deflate offer, negotiation, decline fallback, no-takeover over loopback wss ***\n";
+    return 0;
+}
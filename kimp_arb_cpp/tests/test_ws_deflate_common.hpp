@@ -0,0 +1,187 @@
+#pragma once
+
+#include "test_tls_loopback_common.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Local wss:// server replaying venue frames to WebSocketClient, for the
+// permessage-deflate test and benchmark.
+namespace ws_replay {
+
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+namespace net = boost::asio;
+using tcp = net::ip::tcp;
+
+// Bybit-style orderbook deltas (what public feeds mostly carry), deterministic
+inline std::vector<std::string> synthetic_frames(std::size_t count) {
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> step(0.0, 0.5);
+    std::uniform_int_distribution<int> levels(3, 8);
+    std::uniform_real_distribution<double> qty(0.001, 2.5);
+    double mid = 65000.0;
+    std::vector<std::string> frames;
+    frames.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        mid += step(rng);
+        std::ostringstream out;
+        out << std::fixed;
+        out << R"({"topic":"orderbook.50.BTCUSDT","type":"delta","ts":)" << 1700000000000 + i * 10
+            << R"(,"data":{"s":"BTCUSDT","b":[)";
+        const int bids = levels(rng);
+        for (int l = 0; l < bids; ++l) {
+            out << (l ? "," : "") << "[\"" << std::setprecision(1) << mid - 0.1 * (l + 1) << "\",\""
+                << std::setprecision(6) << qty(rng) << "\"]";
+        }
+        out << R"(],"a":[)";
+        const int asks = levels(rng);
+        for (int l = 0; l < asks; ++l) {
+            out << (l ? "," : "") << "[\"" << std::setprecision(1) << mid + 0.1 * (l + 1) << "\",\""
+                << std::setprecision(6) << qty(rng) << "\"]";
+        }
+        out << R"(],"u":)" << 4000000 + i << R"(,"seq":)" << 90000000000 + i * 7 << R"(},"cts":)"
+            << 1700000000000 + i * 10 - 3 << "}";
+        frames.push_back(out.str());
+    }
+    return frames;
+}
+
+// One frame per line (e.g. captured with a logging message callback)
+inline std::vector<std::string> load_frames(const std::string& path) {
+    std::vector<std::string> frames;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty()) frames.push_back(line);
+    }
+    return frames;
+}
+
+// TLS record bytes an SSL has produced, i.e. what went on the wire
+inline uint64_t tls_bytes_written(SSL* ssl) {
+    return BIO_number_written(SSL_get_wbio(ssl));
+}
+
+inline int64_t steady_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Accepts one wss client, replays frames (paced), then waits for the close.
+// The server's trust anchor is written to cert_path for SSL_CERT_FILE.
+class Server {
+public:
+    struct Result {
+        std::string offered_extensions;   // Client's Sec-WebSocket-Extensions
+        std::string accepted_extensions;  // Ours, as sent back
+        uint64_t wire_bytes{0};           // Sent after the upgrade (incl. the close frame)
+        uint64_t payload_bytes{0};
+    };
+
+    Server(const std::string& cert_path, bool server_deflate, std::vector<std::string> frames,
+           std::chrono::microseconds pace = std::chrono::microseconds(0))
+        : ssl_ctx_(tls_loopback::make_server_context(nullptr, false, cert_path.c_str()).release())
+        , acceptor_(ioc_, tcp::endpoint(net::ip::address_v4::loopback(), 0))
+        , server_deflate_(server_deflate)
+        , frames_(std::move(frames))
+        , pace_(pace)
+        , sent_ns_(std::make_unique<std::atomic<int64_t>[]>(frames_.size())) {
+        thread_ = std::thread([this] { run(); });
+    }
+
+    ~Server() {
+        ::shutdown(acceptor_.native_handle(), SHUT_RDWR);  // Unblock accept() if no client came
+        if (thread_.joinable()) thread_.join();
+    }
+
+    unsigned short port() const { return acceptor_.local_endpoint().port(); }
+    std::string url() const { return "wss://127.0.0.1:" + std::to_string(port()) + "/ws"; }
+    const std::vector<std::string>& frames() const { return frames_; }
+    // Steady-clock time frame i was handed to the socket (0 = not yet)
+    int64_t sent_ns(std::size_t i) const { return sent_ns_[i].load(std::memory_order_acquire); }
+    // Valid once the client closed
+    const Result& result() const { return result_; }
+    void join() {
+        if (thread_.joinable()) thread_.join();
+    }
+
+private:
+    void run() {
+        boost::system::error_code ec;
+        tcp::socket socket(ioc_);
+        acceptor_.accept(socket, ec);
+        if (ec) return;
+        socket.set_option(tcp::no_delay(true));
+
+        websocket::stream<beast::ssl_stream<beast::tcp_stream>> ws(std::move(socket), ssl_ctx_);
+        ws.next_layer().handshake(net::ssl::stream_base::server, ec);
+        if (ec) return;
+
+        websocket::permessage_deflate pmd;
+        pmd.server_enable = server_deflate_;
+        ws.set_option(pmd);
+
+        beast::flat_buffer buffer;
+        beast::http::request<beast::http::string_body> request;
+        beast::http::read(ws.next_layer(), buffer, request, ec);
+        if (ec) return;
+        result_.offered_extensions = std::string(request[beast::http::field::sec_websocket_extensions]);
+        ws.set_option(websocket::stream_base::decorator([this](websocket::response_type& res) {
+            result_.accepted_extensions = std::string(res[beast::http::field::sec_websocket_extensions]);
+        }));
+        ws.accept(request, ec);
+        if (ec) return;
+
+        const uint64_t start_bytes = tls_bytes_written(ws.next_layer().native_handle());
+        ws.text(true);
+        for (std::size_t i = 0; i < frames_.size(); ++i) {
+            if (pace_.count() > 0) {
+                std::this_thread::sleep_for(pace_);
+            }
+            sent_ns_[i].store(steady_ns(), std::memory_order_release);
+            ws.write(net::buffer(frames_[i]), ec);
+            if (ec) return;
+            result_.payload_bytes += frames_[i].size();
+        }
+
+        // Client closes once it has everything
+        beast::flat_buffer sink;
+        while (!ec) {
+            ws.read(sink, ec);
+            sink.consume(sink.size());
+        }
+        result_.wire_bytes = tls_bytes_written(ws.next_layer().native_handle()) - start_bytes;
+    }
+
+    net::io_context ioc_;
+    net::ssl::context ssl_ctx_;
+    tcp::acceptor acceptor_;
+    bool server_deflate_;
+    std::vector<std::string> frames_;
+    std::chrono::microseconds pace_;
+    std::unique_ptr<std::atomic<int64_t>[]> sent_ns_;
+    Result result_;
+    std::thread thread_;
+};
+
+} // namespace ws_replay
@@ -0,0 +1,151 @@
+#include "kimp/exchange/bybit/bybit.hpp"
+#include "kimp/network/websocket_client.hpp"
+#include "kimp/core/config.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+using kimp::network::WebSocketClient;
+
+// Drives the public-stream session callbacks directly; the io_context is
+// never run, so no socket is opened.
+class TestBybitExchange : public kimp::exchange::bybit::BybitExchange {
+public:
+    using kimp::exchange::bybit::BybitExchange::BybitExchange;
+    using kimp::exchange::bybit::BybitExchange::start_public_ws;
+    using kimp::exchange::bybit::BybitExchange::send_public;
+    using kimp::exchange::bybit::BybitExchange::on_public_ws_message;
+    using kimp::exchange::bybit::BybitExchange::on_public_ws_connect;
+    using kimp::exchange::bybit::BybitExchange::on_public_ws_disconnect;
+    using kimp::exchange::bybit::BybitExchange::on_public_ws_stall;
+
+    WebSocketClient* active() {
+        std::lock_guard lock(public_ws_mutex_);
+        return ws_client_.get();
+    }
+    WebSocketClient* standby() {
+        std::lock_guard lock(public_ws_mutex_);
+        return standby_ws_.get();
+    }
+};
+
+int failures = 0;
+
+void expect(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+std::string bybit_book(uint64_t seq, const char* bid) {
+    return std::string(R"({"topic":"orderbook.1.BTCUSDT","ts":1773342407942,"type":"delta","data":{"s":"BTCUSDT","b":[[")") +
+           bid + R"(","0.5"]],"a":[["69904.4","0.4"]],"u":1,"seq":)" + std::to_string(seq) + R"(},"cts":1773342407934})";
+}
+
+void test_backoff_schedule() {
+    expect(WebSocketClient::reconnect_delay_ms(1) == 0, "first reconnect is immediate");
+    expect(WebSocketClient::reconnect_delay_ms(2) == 250, "second reconnect after 250ms");
+    expect(WebSocketClient::reconnect_delay_ms(3) == 500, "backoff doubles");
+    expect(WebSocketClient::reconnect_delay_ms(5) == 2000, "backoff doubles again");
+    expect(WebSocketClient::reconnect_delay_ms(9) == 30000, "backoff capped at 30s");
+    expect(WebSocketClient::reconnect_delay_ms(1000) == 30000, "cap holds for long outages");
+}
+
+void test_make_before_break() {
+    boost::asio::io_context io_context;
+    kimp::ExchangeCredentials creds;
+    TestBybitExchange exchange(io_context, creds);
+
+    std::vector<double> bids;
+    exchange.set_ticker_callback([&](const kimp::Ticker& ticker) { bids.push_back(ticker.bid); });
+
+    exchange.start_public_ws("Bybit-WS", "wss://127.0.0.1:9/v5/public/spot", std::chrono::milliseconds(3000));
+    WebSocketClient* old_session = exchange.active();
+    exchange.on_public_ws_connect(old_session, true, "");
+    expect(exchange.is_connected(), "initial session connected");
+    exchange.send_public(R"({"op":"subscribe","args":["orderbook.1.BTCUSDT"]})");
+
+    exchange.on_public_ws_message(old_session, bybit_book(1, "69900.1"));
+    expect(bids.size() == 1, "active session delivers");
+
+    expect(exchange.rotate_public_ws("planned"), "rotation starts");
+    expect(!exchange.rotate_public_ws("planned"), "only one rotation pending at a time");
+    WebSocketClient* new_session = exchange.standby();
+    expect(new_session != nullptr && new_session != old_session, "standby session opened");
+
+    // Standby handshake must not run on_ws_connected or drop the live session
+    exchange.on_public_ws_connect(new_session, true, "");
+    exchange.on_public_ws_message(old_session, bybit_book(2, "69900.2"));
+    expect(bids.size() == 2, "old session keeps delivering until the switch");
+    expect(exchange.active() == old_session, "no switch before standby data");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    exchange.on_public_ws_message(new_session, bybit_book(3, "69900.3"));
+    expect(bids.size() == 3 && bids.back() == 69900.3, "first standby frame is delivered");
+    expect(exchange.active() == new_session, "standby promoted on first data");
+    expect(exchange.standby() == nullptr, "standby slot cleared");
+
+    exchange.on_public_ws_message(old_session, bybit_book(4, "69800.0"));
+    expect(bids.size() == 3, "retired session frames are dropped");
+    exchange.on_public_ws_disconnect(old_session, "Connection closed");
+    expect(exchange.is_connected(), "retired session close does not mark venue down");
+
+    const auto stats = exchange.get_public_stream_stats();
+    expect(stats.rotations == 1, "rotation counted");
+    expect(stats.last_blind_ms >= 15.0 && stats.last_blind_ms < 5000.0, "blind gap measured across the switch");
+
+    exchange.on_public_ws_disconnect(new_session, "Server closed connection");
+    expect(!exchange.is_connected(), "active session loss still marks venue down");
+}
+
+void test_stall_failover() {
+    boost::asio::io_context io_context;
+    kimp::ExchangeCredentials creds;
+    TestBybitExchange exchange(io_context, creds);
+
+    exchange.start_public_ws("Bybit-WS", "wss://127.0.0.1:9/v5/public/spot", std::chrono::milliseconds(1));
+    WebSocketClient* session = exchange.active();
+    exchange.on_public_ws_connect(session, true, "");
+
+    exchange.on_public_ws_stall(session, 1);
+    expect(exchange.standby() == nullptr, "silence before any subscription is not a stall");
+
+    exchange.send_public(R"({"op":"subscribe","args":["orderbook.1.BTCUSDT"]})");
+    exchange.on_public_ws_stall(session, 1);
+    expect(exchange.standby() != nullptr, "stall opens a standby session");
+
+    // Standby never delivers within another budget: fall back to reconnect in place
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    exchange.on_public_ws_stall(session, 1);
+    expect(exchange.standby() == nullptr, "silent standby abandoned");
+    expect(exchange.active() == session, "active session kept for in-place reconnect");
+
+    const auto stats = exchange.get_public_stream_stats();
+    expect(stats.stalls == 2, "stalls counted");
+    expect(stats.rotation_aborts == 1, "abort counted");
+    expect(stats.rotations == 0, "no switch without standby data");
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "=== WebSocket Rotation Regression Test ===\n";
+
+    test_backoff_schedule();
+    test_make_before_break();
+    test_stall_failover();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "*** PASS: public streams switch make-before-break and fail over on stall ***\n";
+    return 0;
+}